@@ -43,10 +43,14 @@
 #include "testing_gebsrmv.hpp"
 #include "testing_gemvi.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_spmv_bsr.hpp"
+#include "testing_spmv_sell.hpp"
 #include "testing_spmv_coo.hpp"
 #include "testing_spmv_coo_aos.hpp"
+#include "testing_spmv_csc.hpp"
 #include "testing_spmv_csr.hpp"
 #include "testing_spmv_ell.hpp"
+#include "testing_spmv_mixed.hpp"
 
 // Level3
 #include "testing_bsrmm.hpp"
@@ -56,8 +60,11 @@
 #include "testing_gebsrmm.hpp"
 #include "testing_gemmi.hpp"
 #include "testing_sddmm.hpp"
+#include "testing_spmm_bsr.hpp"
 #include "testing_spmm_coo.hpp"
 #include "testing_spmm_csr.hpp"
+#include "testing_spmm_mixed.hpp"
+#include "testing_sddmm_mixed.hpp"
 
 // Extra
 #include "testing_csrgeam.hpp"
@@ -68,9 +75,19 @@
 #include "testing_bsrilu0.hpp"
 #include "testing_csric0.hpp"
 #include "testing_csrilu0.hpp"
+#include "testing_csriluk.hpp"
+#include "testing_csrilut.hpp"
+#include "testing_csritic0.hpp"
+#include "testing_csrmcic0.hpp"
+#include "testing_csrmcilu0.hpp"
+#include "testing_csritilu0.hpp"
 #include "testing_gtsv.hpp"
 #include "testing_gtsv_no_pivot.hpp"
 #include "testing_gtsv_no_pivot_strided_batch.hpp"
+#include "testing_gtsv_strided_batch.hpp"
+#include "testing_gtsv_interleaved_batch.hpp"
+#include "testing_gpsv_strided_batch.hpp"
+#include "testing_gpsv_interleaved_batch.hpp"
 
 // Conversion
 #include "testing_bsr2csr.hpp"
@@ -85,6 +102,7 @@
 #include "testing_csr2csr_compress.hpp"
 #include "testing_csr2dense.hpp"
 #include "testing_csr2ell.hpp"
+#include "testing_csr2sell.hpp"
 #include "testing_csr2gebsr.hpp"
 #include "testing_csr2hyb.hpp"
 #include "testing_csrsort.hpp"
@@ -105,12 +123,17 @@
 #include "testing_prune_csr2csr_by_percentage.hpp"
 #include "testing_prune_dense2csr.hpp"
 #include "testing_prune_dense2csr_by_percentage.hpp"
+#include "testing_sparse_to_dense_bsr.hpp"
 #include "testing_sparse_to_dense_coo.hpp"
 #include "testing_sparse_to_dense_csc.hpp"
 #include "testing_sparse_to_dense_csr.hpp"
 
 // Reordering
 #include "testing_csrcolor.hpp"
+#include "testing_csrcolor_permute.hpp"
+#include "testing_csrpermute.hpp"
+#include "testing_csrrcm.hpp"
+#include "testing_csramd.hpp"
 
 #include <iostream>
 #include <rocsparse.h>
@@ -147,12 +170,17 @@ int main(int argc, char* argv[])
     int           baseD;
     int           action;
     int           part;
+    char          mtype;
     char          diag;
     char          uplo;
     char          apol;
+    char          spol;
     rocsparse_int dir;
     rocsparse_int order;
     rocsparse_int format;
+    int           coloralg;
+    int           gtsvalg;
+    int           gpsvalg;
 
     rocsparse_int device_id;
 
@@ -200,6 +228,26 @@ int main(int argc, char* argv[])
         value<rocsparse_int>(&arg.col_block_dimB)->default_value(2),
         "General BSR col block dimension (default: 2)")
 
+        ("slicesize",
+        value<rocsparse_int>(&arg.slice_size)->default_value(64),
+        "SELL slice size (default: 64)")
+
+        ("sigma",
+        value<rocsparse_int>(&arg.sigma)->default_value(256),
+        "SELL sorting window size (default: 256)")
+
+        ("levelfill",
+        value<rocsparse_int>(&arg.level_of_fill)->default_value(1),
+        "ILU(k) level of fill (default: 1)")
+
+        ("maxfill",
+        value<rocsparse_int>(&arg.max_fill)->default_value(10),
+        "ILUT maximum number of entries per row in L and U (default: 10)")
+
+        ("sweeps",
+        value<rocsparse_int>(&arg.nsweeps)->default_value(3),
+        "Number of Jacobi sweeps for iterative ILU0, IC0 and csrsv (default: 3)")
+
         ("mtx",
         value<std::string>(&filename)->default_value(""), "read from matrix "
         "market (.mtx) format. This will override parameters -m, -n, and -z.")
@@ -268,6 +316,10 @@ int main(int argc, char* argv[])
         "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
         "2 = rocsparse_hyb_partition_max, (default: 0)")
 
+        ("mtype",
+        value<char>(&mtype)->default_value('G'),
+        "G = general, S = symmetric, H = hermitian, T = triangular, (default = G)")
+
         ("diag",
         value<char>(&diag)->default_value('N'),
         "N = non-unit diagonal, U = unit diagonal, (default = N)")
@@ -280,19 +332,41 @@ int main(int argc, char* argv[])
         value<char>(&apol)->default_value('R'),
         "R = reuse meta data, F = force re-build, (default = R)")
 
+        ("spolicy",
+        value<char>(&spol)->default_value('A'),
+        "A = auto, L = level scheduled, P = push (transposed solve), J = Jacobi sweeps, "
+        "(default = A)")
+
+        ("coloralg",
+        value<int>(&coloralg)->default_value(0),
+        "0 = distance-1 coloring, 1 = distance-2 coloring, (default: 0)")
+
+        ("gtsv_interleaved_alg",
+        value<int>(&gtsvalg)->default_value(0),
+        "0 = default, 1 = thomas, 2 = lu, 3 = qr, (default: 0)")
+
+        ("gpsv_interleaved_alg",
+        value<int>(&gpsvalg)->default_value(0),
+        "0 = default, 1 = qr, (default: 0)")
+
+        ("colorbalance",
+        value<int>(&arg.colorbalance)->default_value(0),
+        "0 = unbalanced colors, 1 = balanced number of nodes per color, (default: 0)")
+
         ("function,f",
         value<std::string>(&function)->default_value("axpyi"),
         "SPARSE function to test. Options:\n"
         "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-        "  Level2: bsrmv, bsrxmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrsv, ellmv, hybmv, gebsrmv, gemvi\n"
-        "  Level3: bsrmm, bsrsm, gebsrmm, csrmm, coomm, csrsm, gemmi, sddmm\n"
+        "  Level2: bsrmv, bsrxmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, cscmv, csrsv, ellmv, hybmv, gebsrmv, gemvi, spmv_bsr, spmv_sell, spmv_mixed\n"
+        "  Level3: bsrmm, bsrsm, gebsrmm, csrmm, coomm, csrsm, gemmi, sddmm, spmm_bsr, spmm_mixed, sddmm_mixed\n"
         "  Extra: csrgeam, csrgemm\n"
-        "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch\n"
-        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
+        "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, csriluk, csrilut, csritilu0, csritic0, csrmcilu0, csrmcic0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_strided_batch, gtsv_interleaved_batch, gpsv_strided_batch, gpsv_interleaved_batch\n"
+        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2sell, csr2hyb, csr2bsr, csr2gebsr\n"
         "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
         "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
-        "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
+        "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, sparse_to_dense_bsr, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
         "  Sorting: cscsort, csrsort, coosort\n"
+        "  Reordering: csrcolor, csrcolor_permute, csrpermute, csrrcm, csramd\n"
         "  Misc: identity, nnz")
 
         ("indextype",
@@ -410,15 +484,32 @@ int main(int argc, char* argv[])
     arg.part   = (part == 0)   ? rocsparse_hyb_partition_auto
                  : (part == 1) ? rocsparse_hyb_partition_user
                                : rocsparse_hyb_partition_max;
+    arg.matrix_type = (mtype == 'S')   ? rocsparse_matrix_type_symmetric
+                      : (mtype == 'H') ? rocsparse_matrix_type_hermitian
+                      : (mtype == 'T') ? rocsparse_matrix_type_triangular
+                                       : rocsparse_matrix_type_general;
     arg.diag   = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
     arg.uplo   = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
     arg.apol   = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
-    arg.spol   = rocsparse_solve_policy_auto;
+    arg.spol   = (spol == 'L')   ? rocsparse_solve_policy_level
+                 : (spol == 'P') ? rocsparse_solve_policy_push
+                 : (spol == 'J') ? rocsparse_solve_policy_jacobi
+                                 : rocsparse_solve_policy_auto;
     arg.direction
         = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
     arg.order  = (order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
     arg.format = (rocsparse_format)format;
 
+    arg.color_alg = (coloralg == 1) ? rocsparse_color_alg_jpl_distance2 : rocsparse_color_alg_jpl;
+
+    arg.gtsv_interleaved_alg = (gtsvalg == 1)   ? rocsparse_gtsv_interleaved_alg_thomas
+                               : (gtsvalg == 2) ? rocsparse_gtsv_interleaved_alg_lu
+                               : (gtsvalg == 3) ? rocsparse_gtsv_interleaved_alg_qr
+                                                : rocsparse_gtsv_interleaved_alg_default;
+
+    arg.gpsv_interleaved_alg = (gpsvalg == 1) ? rocsparse_gpsv_interleaved_alg_qr
+                                              : rocsparse_gpsv_interleaved_alg_default;
+
     // rocALUTION parameter overrides filename parameter
     if(rocalution != "")
     {
@@ -547,6 +638,36 @@ int main(int argc, char* argv[])
         return -1;
     }
 
+    if(arg.slice_size < 1)
+    {
+        std::cerr << "Invalid value for --slicesize" << std::endl;
+        return -1;
+    }
+
+    if(arg.sigma < 1)
+    {
+        std::cerr << "Invalid value for --sigma" << std::endl;
+        return -1;
+    }
+
+    if(arg.level_of_fill < 0)
+    {
+        std::cerr << "Invalid value for --levelfill" << std::endl;
+        return -1;
+    }
+
+    if(arg.max_fill < 0)
+    {
+        std::cerr << "Invalid value for --maxfill" << std::endl;
+        return -1;
+    }
+
+    if(arg.nsweeps <= 0)
+    {
+        std::cerr << "Invalid value for --sweeps" << std::endl;
+        return -1;
+    }
+
     // Level1
     if(function == "axpyi")
     {
@@ -632,6 +753,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_bsrmv<rocsparse_double_complex>(arg);
     }
+    else if(function == "spmv_bsr")
+    {
+        if(precision == 's')
+            testing_spmv_bsr<float>(arg);
+        else if(precision == 'd')
+            testing_spmv_bsr<double>(arg);
+        else if(precision == 'c')
+            testing_spmv_bsr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_spmv_bsr<rocsparse_double_complex>(arg);
+    }
+    else if(function == "spmv_sell")
+    {
+        if(precision == 's')
+            testing_spmv_sell<float>(arg);
+        else if(precision == 'd')
+            testing_spmv_sell<double>(arg);
+        else if(precision == 'c')
+            testing_spmv_sell<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_spmv_sell<rocsparse_double_complex>(arg);
+    }
     else if(function == "bsrxmv")
     {
         if(precision == 's')
@@ -755,6 +898,75 @@ int main(int argc, char* argv[])
                 testing_spmv_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
+    else if(function == "spmv_mixed")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_mixed<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_mixed<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_mixed<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_mixed<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_mixed<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_mixed<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_mixed<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_mixed<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_mixed<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "cscmv")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmv_csc<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmv_csc<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmv_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
     else if(function == "csrmv_managed")
     {
         if(precision == 's')
@@ -933,6 +1145,17 @@ int main(int argc, char* argv[])
                 testing_spmm_coo<int64_t, rocsparse_double_complex>(arg);
         }
     }
+    else if(function == "spmm_bsr")
+    {
+        if(precision == 's')
+            testing_spmm_bsr<float>(arg);
+        else if(precision == 'd')
+            testing_spmm_bsr<double>(arg);
+        else if(precision == 'c')
+            testing_spmm_bsr<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_spmm_bsr<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrsm")
     {
         if(precision == 's')
@@ -1055,6 +1278,48 @@ int main(int argc, char* argv[])
                 testing_sddmm<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
+    else if(function == "spmm_mixed")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmm_mixed<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmm_mixed<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmm_mixed<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmm_mixed<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmm_mixed<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmm_mixed<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_spmm_mixed<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_spmm_mixed<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_spmm_mixed<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
+    else if(function == "sddmm_mixed")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_sddmm_mixed<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_sddmm_mixed<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_sddmm_mixed<int64_t, int64_t, float>(arg);
+        }
+    }
     else if(function == "bsric0")
     {
         if(precision == 's')
@@ -1099,6 +1364,72 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrilu0<rocsparse_double_complex>(arg);
     }
+    else if(function == "csriluk")
+    {
+        if(precision == 's')
+            testing_csriluk<float>(arg);
+        else if(precision == 'd')
+            testing_csriluk<double>(arg);
+        else if(precision == 'c')
+            testing_csriluk<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csriluk<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrilut")
+    {
+        if(precision == 's')
+            testing_csrilut<float>(arg);
+        else if(precision == 'd')
+            testing_csrilut<double>(arg);
+        else if(precision == 'c')
+            testing_csrilut<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrilut<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csritilu0")
+    {
+        if(precision == 's')
+            testing_csritilu0<float>(arg);
+        else if(precision == 'd')
+            testing_csritilu0<double>(arg);
+        else if(precision == 'c')
+            testing_csritilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csritilu0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csritic0")
+    {
+        if(precision == 's')
+            testing_csritic0<float>(arg);
+        else if(precision == 'd')
+            testing_csritic0<double>(arg);
+        else if(precision == 'c')
+            testing_csritic0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csritic0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmcilu0")
+    {
+        if(precision == 's')
+            testing_csrmcilu0<float>(arg);
+        else if(precision == 'd')
+            testing_csrmcilu0<double>(arg);
+        else if(precision == 'c')
+            testing_csrmcilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmcilu0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmcic0")
+    {
+        if(precision == 's')
+            testing_csrmcic0<float>(arg);
+        else if(precision == 'd')
+            testing_csrmcic0<double>(arg);
+        else if(precision == 'c')
+            testing_csrmcic0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmcic0<rocsparse_double_complex>(arg);
+    }
     else if(function == "gtsv")
     {
         if(precision == 's')
@@ -1132,6 +1463,50 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_gtsv_no_pivot_strided_batch<rocsparse_double_complex>(arg);
     }
+    else if(function == "gtsv_strided_batch")
+    {
+        if(precision == 's')
+            testing_gtsv_strided_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_strided_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_strided_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_strided_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gtsv_interleaved_batch")
+    {
+        if(precision == 's')
+            testing_gtsv_interleaved_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_interleaved_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_interleaved_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_interleaved_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gpsv_strided_batch")
+    {
+        if(precision == 's')
+            testing_gpsv_strided_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gpsv_strided_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gpsv_strided_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gpsv_strided_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gpsv_interleaved_batch")
+    {
+        if(precision == 's')
+            testing_gpsv_interleaved_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gpsv_interleaved_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gpsv_interleaved_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gpsv_interleaved_batch<rocsparse_double_complex>(arg);
+    }
     else if(function == "nnz")
     {
         if(precision == 's')
@@ -1260,6 +1635,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csr2ell<rocsparse_double_complex>(arg);
     }
+    else if(function == "csr2sell")
+    {
+        if(precision == 's')
+            testing_csr2sell<float>(arg);
+        else if(precision == 'd')
+            testing_csr2sell<double>(arg);
+        else if(precision == 'c')
+            testing_csr2sell<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csr2sell<rocsparse_double_complex>(arg);
+    }
     else if(function == "csr2hyb")
     {
         if(precision == 's')
@@ -1595,6 +1981,45 @@ int main(int argc, char* argv[])
                 testing_sparse_to_dense_csc<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
+    else if(function == "sparse_to_dense_bsr")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_sparse_to_dense_bsr<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_bsr<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_sparse_to_dense_bsr<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_sparse_to_dense_bsr<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_bsr<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_sparse_to_dense_bsr<int64_t, int64_t, double>(arg);
+        }
+        else if(precision == 'c')
+        {
+            if(indextype == 's')
+                testing_sparse_to_dense_bsr<int32_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_bsr<int64_t, int32_t, rocsparse_float_complex>(arg);
+            else if(indextype == 'd')
+                testing_sparse_to_dense_bsr<int64_t, int64_t, rocsparse_float_complex>(arg);
+        }
+        else if(precision == 'z')
+        {
+            if(indextype == 's')
+                testing_sparse_to_dense_bsr<int32_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'm')
+                testing_sparse_to_dense_bsr<int64_t, int32_t, rocsparse_double_complex>(arg);
+            else if(indextype == 'd')
+                testing_sparse_to_dense_bsr<int64_t, int64_t, rocsparse_double_complex>(arg);
+        }
+    }
     else if(function == "csrcolor")
     {
         if(precision == 's')
@@ -1606,6 +2031,36 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrcolor<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrcolor_permute")
+    {
+        if(precision == 's')
+            testing_csrcolor_permute<float>(arg);
+        else if(precision == 'd')
+            testing_csrcolor_permute<double>(arg);
+        else if(precision == 'c')
+            testing_csrcolor_permute<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrcolor_permute<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrpermute")
+    {
+        if(precision == 's')
+            testing_csrpermute<float>(arg);
+        else if(precision == 'd')
+            testing_csrpermute<double>(arg);
+        else if(precision == 'c')
+            testing_csrpermute<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrpermute<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrrcm")
+    {
+        testing_csrrcm<float>(arg);
+    }
+    else if(function == "csramd")
+    {
+        testing_csramd<float>(arg);
+    }
     else if(function == "csrsort")
     {
         testing_csrsort<float>(arg);
@@ -1277,7 +1277,9 @@ void host_bsrsv(rocsparse_operation  trans,
 }
 
 template <typename I, typename T>
-void host_coomv(I                    M,
+void host_coomv(rocsparse_operation  trans,
+                I                    M,
+                I                    N,
                 I                    nnz,
                 T                    alpha,
                 const I*             coo_row_ind,
@@ -1288,23 +1290,42 @@ void host_coomv(I                    M,
                 T*                   y,
                 rocsparse_index_base base)
 {
+    I ysize = (trans == rocsparse_operation_none) ? M : N;
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(I i = 0; i < M; ++i)
+    for(I i = 0; i < ysize; ++i)
     {
         y[i] *= beta;
     }
 
-    for(I i = 0; i < nnz; ++i)
+    if(trans == rocsparse_operation_none)
+    {
+        for(I i = 0; i < nnz; ++i)
+        {
+            y[coo_row_ind[i] - base] = std::fma(
+                alpha * coo_val[i], x[coo_col_ind[i] - base], y[coo_row_ind[i] - base]);
+        }
+    }
+    else
     {
-        y[coo_row_ind[i] - base]
-            = std::fma(alpha * coo_val[i], x[coo_col_ind[i] - base], y[coo_row_ind[i] - base]);
+        for(I i = 0; i < nnz; ++i)
+        {
+            T val = (trans == rocsparse_operation_conjugate_transpose)
+                        ? rocsparse_conj(coo_val[i])
+                        : coo_val[i];
+
+            y[coo_col_ind[i] - base]
+                = std::fma(alpha * val, x[coo_row_ind[i] - base], y[coo_col_ind[i] - base]);
+        }
     }
 }
 
 template <typename I, typename T>
-void host_coomv_aos(I                    M,
+void host_coomv_aos(rocsparse_operation  trans,
+                    I                    M,
+                    I                    N,
                     I                    nnz,
                     T                    alpha,
                     const I*             coo_ind,
@@ -1314,23 +1335,42 @@ void host_coomv_aos(I                    M,
                     T*                   y,
                     rocsparse_index_base base)
 {
+    I ysize = (trans == rocsparse_operation_none) ? M : N;
+
 #ifdef _OPENMP
 #pragma omp parallel for schedule(dynamic, 1024)
 #endif
-    for(I i = 0; i < M; ++i)
+    for(I i = 0; i < ysize; ++i)
     {
         y[i] *= beta;
     }
 
-    for(I i = 0; i < nnz; ++i)
+    if(trans == rocsparse_operation_none)
+    {
+        for(I i = 0; i < nnz; ++i)
+        {
+            y[coo_ind[2 * i] - base] = std::fma(
+                alpha * coo_val[i], x[coo_ind[2 * i + 1] - base], y[coo_ind[2 * i] - base]);
+        }
+    }
+    else
     {
-        y[coo_ind[2 * i] - base]
-            = std::fma(alpha * coo_val[i], x[coo_ind[2 * i + 1] - base], y[coo_ind[2 * i] - base]);
+        for(I i = 0; i < nnz; ++i)
+        {
+            T val = (trans == rocsparse_operation_conjugate_transpose)
+                        ? rocsparse_conj(coo_val[i])
+                        : coo_val[i];
+
+            y[coo_ind[2 * i + 1] - base] = std::fma(
+                alpha * val, x[coo_ind[2 * i] - base], y[coo_ind[2 * i + 1] - base]);
+        }
     }
 }
 
 template <typename I, typename J, typename T>
-void host_csrmv(J                    M,
+void host_csrmv(rocsparse_operation  trans,
+                J                    M,
+                J                    N,
                 I                    nnz,
                 T                    alpha,
                 const I*             csr_row_ptr,
@@ -1342,6 +1382,35 @@ void host_csrmv(J                    M,
                 rocsparse_index_base base,
                 int                  algo)
 {
+    if(trans != rocsparse_operation_none)
+    {
+        // Scale y with beta
+        for(J i = 0; i < N; ++i)
+        {
+            y[i] *= beta;
+        }
+
+        // Scatter the contribution of each row into y
+        for(J i = 0; i < M; ++i)
+        {
+            I row_begin = csr_row_ptr[i] - base;
+            I row_end   = csr_row_ptr[i + 1] - base;
+
+            T row_val = alpha * x[i];
+
+            for(I j = row_begin; j < row_end; ++j)
+            {
+                J col  = csr_col_ind[j] - base;
+                T val  = (trans == rocsparse_operation_conjugate_transpose)
+                             ? rocsparse_conj(csr_val[j])
+                             : csr_val[j];
+                y[col] = std::fma(val, row_val, y[col]);
+            }
+        }
+
+        return;
+    }
+
     if(algo == 0)
     {
         // Get device properties
@@ -1850,7 +1919,18 @@ void host_hybmv(rocsparse_int        M,
     // COO part
     if(coo_nnz > 0)
     {
-        host_coomv(M, coo_nnz, alpha, coo_row_ind, coo_col_ind, coo_val, x, coo_beta, y, base);
+        host_coomv(rocsparse_operation_none,
+                   M,
+                   N,
+                   coo_nnz,
+                   alpha,
+                   coo_row_ind,
+                   coo_col_ind,
+                   coo_val,
+                   x,
+                   coo_beta,
+                   y,
+                   base);
     }
 }
 
@@ -5321,6 +5401,83 @@ void host_csr_to_hyb(rocsparse_int                     M,
     }
 }
 
+template <typename T>
+void host_csr_to_sell(rocsparse_int                     M,
+                      const std::vector<rocsparse_int>& csr_row_ptr,
+                      const std::vector<rocsparse_int>& csr_col_ind,
+                      const std::vector<T>&             csr_val,
+                      rocsparse_int                     slice_size,
+                      rocsparse_int                     sigma,
+                      std::vector<rocsparse_int>&       sell_slice_ptr,
+                      std::vector<rocsparse_int>&       sell_perm,
+                      std::vector<rocsparse_int>&       sell_col_ind,
+                      std::vector<T>&                   sell_val,
+                      rocsparse_int&                    sell_nnz,
+                      rocsparse_index_base              csr_base,
+                      rocsparse_index_base              sell_base)
+{
+    // Sort rows by decreasing length within each window of sigma rows
+    sell_perm.resize(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        sell_perm[i] = i;
+    }
+
+    for(rocsparse_int w = 0; w < M; w += std::min(sigma, M - w))
+    {
+        rocsparse_int w_end = w + std::min(sigma, M - w);
+
+        std::stable_sort(sell_perm.begin() + w,
+                         sell_perm.begin() + w_end,
+                         [&](const rocsparse_int& a, const rocsparse_int& b) {
+                             return csr_row_ptr[a + 1] - csr_row_ptr[a]
+                                    > csr_row_ptr[b + 1] - csr_row_ptr[b];
+                         });
+    }
+
+    // Each slice is padded to its longest row
+    rocsparse_int nslices = (M > 0) ? (M - 1) / slice_size + 1 : 0;
+
+    sell_slice_ptr.resize(nslices + 1);
+    sell_slice_ptr[0] = sell_base;
+
+    for(rocsparse_int s = 0; s < nslices; ++s)
+    {
+        rocsparse_int width = 0;
+
+        for(rocsparse_int i = s * slice_size; i < std::min((s + 1) * slice_size, M); ++i)
+        {
+            rocsparse_int row = sell_perm[i];
+            width             = std::max(width, csr_row_ptr[row + 1] - csr_row_ptr[row]);
+        }
+
+        sell_slice_ptr[s + 1] = sell_slice_ptr[s] + width * slice_size;
+    }
+
+    sell_nnz = sell_slice_ptr[nslices] - sell_base;
+
+    sell_col_ind.resize(sell_nnz, -1);
+    sell_val.resize(sell_nnz, static_cast<T>(0));
+
+    // Fill slices, entries of a row are strided by the slice size
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row   = sell_perm[i];
+        rocsparse_int slice = i / slice_size;
+        rocsparse_int idx   = sell_slice_ptr[slice] - sell_base + i - slice * slice_size;
+
+        for(rocsparse_int j = csr_row_ptr[row] - csr_base; j < csr_row_ptr[row + 1] - csr_base;
+            ++j)
+        {
+            sell_col_ind[idx] = csr_col_ind[j] - csr_base + sell_base;
+            sell_val[idx]     = csr_val[j];
+
+            idx += slice_size;
+        }
+    }
+}
+
 template <typename T>
 void host_csr_to_csr_compress(rocsparse_int                     M,
                               rocsparse_int                     N,
@@ -6161,6 +6318,20 @@ template void host_csr_to_hyb(rocsparse_int                     M,
                               rocsparse_hyb_partition           part,
                               rocsparse_index_base              base);
 
+template void host_csr_to_sell(rocsparse_int                     M,
+                               const std::vector<rocsparse_int>& csr_row_ptr,
+                               const std::vector<rocsparse_int>& csr_col_ind,
+                               const std::vector<float>&         csr_val,
+                               rocsparse_int                     slice_size,
+                               rocsparse_int                     sigma,
+                               std::vector<rocsparse_int>&       sell_slice_ptr,
+                               std::vector<rocsparse_int>&       sell_perm,
+                               std::vector<rocsparse_int>&       sell_col_ind,
+                               std::vector<float>&               sell_val,
+                               rocsparse_int&                    sell_nnz,
+                               rocsparse_index_base              csr_base,
+                               rocsparse_index_base              sell_base);
+
 template void host_csr_to_csr_compress(rocsparse_int                     M,
                                        rocsparse_int                     N,
                                        rocsparse_int                     nnz,
@@ -6645,6 +6816,20 @@ template void host_csr_to_hyb(rocsparse_int                     M,
                               rocsparse_hyb_partition           part,
                               rocsparse_index_base              base);
 
+template void host_csr_to_sell(rocsparse_int                     M,
+                               const std::vector<rocsparse_int>& csr_row_ptr,
+                               const std::vector<rocsparse_int>& csr_col_ind,
+                               const std::vector<double>&        csr_val,
+                               rocsparse_int                     slice_size,
+                               rocsparse_int                     sigma,
+                               std::vector<rocsparse_int>&       sell_slice_ptr,
+                               std::vector<rocsparse_int>&       sell_perm,
+                               std::vector<rocsparse_int>&       sell_col_ind,
+                               std::vector<double>&              sell_val,
+                               rocsparse_int&                    sell_nnz,
+                               rocsparse_index_base              csr_base,
+                               rocsparse_index_base              sell_base);
+
 template void host_csr_to_csr_compress(rocsparse_int                     M,
                                        rocsparse_int                     N,
                                        rocsparse_int                     nnz,
@@ -7108,6 +7293,20 @@ template void host_csr_to_hyb(rocsparse_int                                M,
                               rocsparse_hyb_partition                      part,
                               rocsparse_index_base                         base);
 
+template void host_csr_to_sell(rocsparse_int                                M,
+                               const std::vector<rocsparse_int>&            csr_row_ptr,
+                               const std::vector<rocsparse_int>&            csr_col_ind,
+                               const std::vector<rocsparse_double_complex>& csr_val,
+                               rocsparse_int                                slice_size,
+                               rocsparse_int                                sigma,
+                               std::vector<rocsparse_int>&                  sell_slice_ptr,
+                               std::vector<rocsparse_int>&                  sell_perm,
+                               std::vector<rocsparse_int>&                  sell_col_ind,
+                               std::vector<rocsparse_double_complex>&       sell_val,
+                               rocsparse_int&                               sell_nnz,
+                               rocsparse_index_base                         csr_base,
+                               rocsparse_index_base                         sell_base);
+
 template void host_csr_to_csr_compress(rocsparse_int                                M,
                                        rocsparse_int                                N,
                                        rocsparse_int                                nnz,
@@ -7544,6 +7743,20 @@ template void host_csr_to_hyb(rocsparse_int                               M,
                               rocsparse_hyb_partition                     part,
                               rocsparse_index_base                        base);
 
+template void host_csr_to_sell(rocsparse_int                               M,
+                               const std::vector<rocsparse_int>&           csr_row_ptr,
+                               const std::vector<rocsparse_int>&           csr_col_ind,
+                               const std::vector<rocsparse_float_complex>& csr_val,
+                               rocsparse_int                               slice_size,
+                               rocsparse_int                               sigma,
+                               std::vector<rocsparse_int>&                 sell_slice_ptr,
+                               std::vector<rocsparse_int>&                 sell_perm,
+                               std::vector<rocsparse_int>&                 sell_col_ind,
+                               std::vector<rocsparse_float_complex>&       sell_val,
+                               rocsparse_int&                              sell_nnz,
+                               rocsparse_index_base                        csr_base,
+                               rocsparse_index_base                        sell_base);
+
 template void host_csr_to_csr_compress(rocsparse_int                               M,
                                        rocsparse_int                               N,
                                        rocsparse_int                               nnz,
@@ -7606,7 +7819,9 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                                   std::vector<TTYPE>&       coo_val,             \
                                                   std::vector<ITYPE>&       coo_row_ind,         \
                                                   std::vector<ITYPE>&       coo_col_ind);              \
-    template void host_coomv<ITYPE, TTYPE>(ITYPE                M,                               \
+    template void host_coomv<ITYPE, TTYPE>(rocsparse_operation  trans,                           \
+                                           ITYPE                M,                               \
+                                           ITYPE                N,                               \
                                            ITYPE                nnz,                             \
                                            TTYPE                alpha,                           \
                                            const ITYPE*         coo_row_ind,                     \
@@ -7616,7 +7831,9 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                            TTYPE                beta,                            \
                                            TTYPE*               y,                               \
                                            rocsparse_index_base base);                           \
-    template void host_coomv_aos<ITYPE, TTYPE>(ITYPE                M,                           \
+    template void host_coomv_aos<ITYPE, TTYPE>(rocsparse_operation  trans,                       \
+                                               ITYPE                M,                           \
+                                               ITYPE                N,                           \
                                                ITYPE                nnz,                         \
                                                TTYPE                alpha,                       \
                                                const ITYPE*         coo_ind,                     \
@@ -7683,7 +7900,9 @@ template void host_coosort_by_column(rocsparse_int                         M,
         ITYPE nnz, const TTYPE* x_val, const ITYPE* x_ind, TTYPE* y, rocsparse_index_base base);
 
 #define INSTANTIATE3(ITYPE, JTYPE, TTYPE)                                                        \
-    template void host_csrmv<ITYPE, JTYPE, TTYPE>(JTYPE                M,                        \
+    template void host_csrmv<ITYPE, JTYPE, TTYPE>(rocsparse_operation  trans,                    \
+                                                  JTYPE                M,                        \
+                                                  JTYPE                N,                        \
                                                   ITYPE                nnz,                      \
                                                   TTYPE                alpha,                    \
                                                   const ITYPE*         csr_row_ptr,              \
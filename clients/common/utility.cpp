@@ -26,6 +26,7 @@
 #include "rocsparse_random.hpp"
 
 #include <cstdlib>
+#include <hip/hip_bfloat16.h>
 #include <sys/time.h>
 
 // Random number generator
@@ -96,6 +97,24 @@ rocsparse_indextype get_indextype<int64_t>(void)
 }
 
 /*! \brief  Return \ref rocsparse_datatype */
+template <>
+rocsparse_datatype get_datatype<int8_t>(void)
+{
+    return rocsparse_datatype_i8_r;
+}
+
+template <>
+rocsparse_datatype get_datatype<_Float16>(void)
+{
+    return rocsparse_datatype_f16_r;
+}
+
+template <>
+rocsparse_datatype get_datatype<hip_bfloat16>(void)
+{
+    return rocsparse_datatype_bf16_r;
+}
+
 template <>
 rocsparse_datatype get_datatype<float>(void)
 {
@@ -125,6 +125,18 @@ inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_direction& p)
     return rocsparse_status_invalid_value;
 }
 
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_gtsv_interleaved_alg& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_gpsv_interleaved_alg& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
 template <>
 inline void auto_testing_bad_arg_set_invalid(rocsparse_operation& p)
 {
@@ -172,6 +184,18 @@ inline void auto_testing_bad_arg_set_invalid(rocsparse_solve_policy& p)
     p = (rocsparse_solve_policy)-1;
 }
 
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_gtsv_interleaved_alg& p)
+{
+    p = (rocsparse_gtsv_interleaved_alg)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_gpsv_interleaved_alg& p)
+{
+    p = (rocsparse_gpsv_interleaved_alg)-1;
+}
+
 template <typename... T>
 struct auto_testing_bad_arg_t
 {
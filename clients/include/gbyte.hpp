@@ -105,6 +105,14 @@ constexpr double csrmv_gbyte_count(J M, J N, I nnz, bool beta = false)
            / 1e9;
 }
 
+template <typename I, typename J, typename A, typename X, typename T>
+constexpr double csrmv_mixed_gbyte_count(J M, J N, I nnz, bool beta = false)
+{
+    return ((M + 1) * sizeof(I) + nnz * sizeof(J) + nnz * sizeof(A) + N * sizeof(X)
+            + (M + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double bsrsv_gbyte_count(rocsparse_int mb, rocsparse_int nnzb, rocsparse_int bsr_dim)
 {
@@ -125,6 +133,15 @@ constexpr double ellmv_gbyte_count(I M, I N, I nnz, bool beta = false)
     return (nnz * sizeof(I) + (M + N + nnz + (beta ? M : 0)) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double
+    sellcmv_gbyte_count(rocsparse_int M, rocsparse_int N, rocsparse_int sell_nnz, bool beta = false)
+{
+    return ((M + sell_nnz) * sizeof(rocsparse_int)
+            + (M + N + sell_nnz + (beta ? M : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double gebsrmv_gbyte_count(rocsparse_int mb,
                                      rocsparse_int nb,
@@ -197,6 +214,14 @@ constexpr double csrmm_gbyte_count(J M, I nnz_A, I nnz_B, I nnz_C, bool beta = f
            / 1e9;
 }
 
+template <typename I, typename J, typename A, typename X, typename T>
+constexpr double csrmm_mixed_gbyte_count(J M, I nnz_A, I nnz_B, I nnz_C, bool beta = false)
+{
+    return ((M + 1) * sizeof(I) + nnz_A * sizeof(J) + nnz_A * sizeof(A) + nnz_B * sizeof(X)
+            + (nnz_C + (beta ? nnz_C : 0)) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T, typename I>
 constexpr double coomm_gbyte_count(I nnz_A, I nnz_B, I nnz_C, bool beta = false)
 {
@@ -263,6 +288,14 @@ struct rocsparse_gbyte_count<rocsparse_format_ell>
     }
 };
 
+template <typename I, typename J, typename X, typename T>
+constexpr double csrddmm_mixed_gbyte_count(J M, J N, I nnz, J K, bool beta = false)
+{
+    return ((M + 1) * sizeof(I) + nnz * sizeof(J) + (M + N) * K * sizeof(X)
+            + (nnz + (beta ? nnz : 0)) * sizeof(T))
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    extra SPARSE
@@ -340,6 +373,12 @@ constexpr double gtsv_strided_batch_gbyte_count(rocsparse_int M, rocsparse_int N
     return ((3 * M * N + 2 * M * N) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double gpsv_strided_batch_gbyte_count(rocsparse_int M, rocsparse_int N)
+{
+    return ((5 * M * N + 2 * M * N) * sizeof(T)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -406,6 +445,18 @@ constexpr double csx2dense_gbyte_count(J M, J N, I nnz)
     return (read_csx + write_dense) / 1e9;
 }
 
+template <typename T, typename I, typename J>
+constexpr double bsr2dense_gbyte_count(J Mb, J Nb, I nnzb, J block_dim)
+{
+    const size_t nnz      = size_t(nnzb) * block_dim * block_dim;
+    const size_t read_bsr = nnz * sizeof(T) + nnzb * sizeof(J) + (Mb + 1) * sizeof(I);
+
+    // set to zero + nnz assignments.
+    const size_t write_dense
+        = size_t(Mb) * Nb * block_dim * block_dim * sizeof(T) + nnz * sizeof(T);
+    return (read_bsr + write_dense) / 1e9;
+}
+
 template <typename T, typename I>
 constexpr double coo2dense_gbyte_count(I M, I N, I nnz)
 {
@@ -459,6 +510,13 @@ constexpr double csr2ell_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocspar
     return ((M + 1.0 + ell_nnz) * sizeof(rocsparse_int) + (nnz + ell_nnz) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csr2sell_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int sell_nnz)
+{
+    return ((2.0 * M + 1.0 + sell_nnz) * sizeof(rocsparse_int) + (nnz + sell_nnz) * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double ell2csr_gbyte_count(rocsparse_int M, rocsparse_int csr_nnz, rocsparse_int ell_nnz)
 {
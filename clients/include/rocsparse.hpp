@@ -852,6 +852,129 @@ REAL_COMPLEX_TEMPLATE(csrilu0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+// csriluk
+REAL_COMPLEX_TEMPLATE(csriluk,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             nnz_lu,
+                      T*                        csr_val_lu,
+                      const rocsparse_int*      csr_row_ptr_lu,
+                      const rocsparse_int*      csr_col_ind_lu,
+                      rocsparse_mat_info        info,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+// csrilut
+REAL_COMPLEX_TEMPLATE(csrilut,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const floating_data_t<T>* drop_tol,
+                      rocsparse_int             max_fill,
+                      rocsparse_int             nnz_lu,
+                      T*                        csr_val_lu,
+                      const rocsparse_int*      csr_row_ptr_lu,
+                      const rocsparse_int*      csr_col_ind_lu,
+                      rocsparse_mat_info        info,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+// csrilut_compress
+REAL_COMPLEX_TEMPLATE(csrilut_compress,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      const rocsparse_mat_descr descr,
+                      rocsparse_int             nnz_lu,
+                      T*                        csr_val_lu,
+                      rocsparse_int*            csr_row_ptr_lu,
+                      rocsparse_int*            csr_col_ind_lu,
+                      rocsparse_int*            nnz_lu_compressed,
+                      rocsparse_mat_info        info,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+// csritilu0_buffer_size
+REAL_COMPLEX_TEMPLATE(csritilu0_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      size_t*                   buffer_size);
+
+// csritilu0
+REAL_COMPLEX_TEMPLATE(csritilu0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             nsweeps,
+                      void*                     temp_buffer);
+
+// csritic0_buffer_size
+REAL_COMPLEX_TEMPLATE(csritic0_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      size_t*                   buffer_size);
+
+// csritic0
+REAL_COMPLEX_TEMPLATE(csritic0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_int             nsweeps,
+                      void*                     temp_buffer);
+
+// csrmcilu0
+REAL_COMPLEX_TEMPLATE(csrmcilu0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             ncolors,
+                      const rocsparse_int*      color_ptr,
+                      rocsparse_mat_info        info);
+
+// csrmcic0
+REAL_COMPLEX_TEMPLATE(csrmcic0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             ncolors,
+                      const rocsparse_int*      color_ptr,
+                      rocsparse_mat_info        info);
+
 REAL_COMPLEX_TEMPLATE(gtsv_buffer_size,
                       rocsparse_handle handle,
                       rocsparse_int    m,
@@ -920,6 +1043,110 @@ REAL_COMPLEX_TEMPLATE(gtsv_no_pivot_strided_batch,
                       rocsparse_int    batch_stride,
                       void*            temp_buffer);
 
+// gtsv_strided_batch
+REAL_COMPLEX_TEMPLATE(gtsv_strided_batch_buffer_size,
+                      rocsparse_handle handle,
+                      rocsparse_int    m,
+                      const T*         dl,
+                      const T*         d,
+                      const T*         du,
+                      const T*         x,
+                      rocsparse_int    batch_count,
+                      rocsparse_int    batch_stride,
+                      size_t*          buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gtsv_strided_batch,
+                      rocsparse_handle handle,
+                      rocsparse_int    m,
+                      const T*         dl,
+                      const T*         d,
+                      const T*         du,
+                      T*               x,
+                      rocsparse_int    batch_count,
+                      rocsparse_int    batch_stride,
+                      void*            temp_buffer);
+
+// gtsv_interleaved_batch
+REAL_COMPLEX_TEMPLATE(gtsv_interleaved_batch_buffer_size,
+                      rocsparse_handle               handle,
+                      rocsparse_gtsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      const T*                       dl,
+                      const T*                       d,
+                      const T*                       du,
+                      const T*                       x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      size_t*                        buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gtsv_interleaved_batch,
+                      rocsparse_handle               handle,
+                      rocsparse_gtsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      T*                             dl,
+                      T*                             d,
+                      T*                             du,
+                      T*                             x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      void*                          temp_buffer);
+
+// gpsv_strided_batch
+REAL_COMPLEX_TEMPLATE(gpsv_strided_batch_buffer_size,
+                      rocsparse_handle handle,
+                      rocsparse_int    m,
+                      const T*         ds,
+                      const T*         dl,
+                      const T*         d,
+                      const T*         du,
+                      const T*         dw,
+                      const T*         x,
+                      rocsparse_int    batch_count,
+                      rocsparse_int    batch_stride,
+                      size_t*          buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gpsv_strided_batch,
+                      rocsparse_handle handle,
+                      rocsparse_int    m,
+                      const T*         ds,
+                      const T*         dl,
+                      const T*         d,
+                      const T*         du,
+                      const T*         dw,
+                      T*               x,
+                      rocsparse_int    batch_count,
+                      rocsparse_int    batch_stride,
+                      void*            temp_buffer);
+
+// gpsv_interleaved_batch
+REAL_COMPLEX_TEMPLATE(gpsv_interleaved_batch_buffer_size,
+                      rocsparse_handle               handle,
+                      rocsparse_gpsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      const T*                       ds,
+                      const T*                       dl,
+                      const T*                       d,
+                      const T*                       du,
+                      const T*                       dw,
+                      const T*                       x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      size_t*                        buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gpsv_interleaved_batch,
+                      rocsparse_handle               handle,
+                      rocsparse_gpsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      T*                             ds,
+                      T*                             dl,
+                      T*                             d,
+                      T*                             du,
+                      T*                             dw,
+                      T*                             x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      void*                          temp_buffer);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -1168,6 +1395,21 @@ REAL_COMPLEX_TEMPLATE(csr2ell,
                       T*                        ell_val,
                       rocsparse_int*            ell_col_ind);
 
+// csr2sell
+REAL_COMPLEX_TEMPLATE(csr2sell,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      const rocsparse_mat_descr csr_descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const rocsparse_mat_descr sell_descr,
+                      rocsparse_int             sell_slice_size,
+                      const rocsparse_int*      sell_slice_ptr,
+                      const rocsparse_int*      sell_perm,
+                      T*                        sell_val,
+                      rocsparse_int*            sell_col_ind);
+
 // csr2hyb
 REAL_COMPLEX_TEMPLATE(csr2hyb,
                       rocsparse_handle          handle,
@@ -1464,4 +1706,37 @@ REAL_COMPLEX_TEMPLATE(csrcolor,
                       rocsparse_int*            reordering,
                       rocsparse_mat_info        info);
 
+// csrcolor_permute
+REAL_COMPLEX_TEMPLATE(csrcolor_permute,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             ncolors,
+                      const rocsparse_int*      coloring,
+                      rocsparse_int*            perm,
+                      rocsparse_int*            color_ptr,
+                      T*                        csr_val_mc,
+                      rocsparse_int*            csr_row_ptr_mc,
+                      rocsparse_int*            csr_col_ind_mc,
+                      void*                     temp_buffer);
+
+// csrpermute
+REAL_COMPLEX_TEMPLATE(csrpermute,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const rocsparse_int*      perm,
+                      T*                        csr_val_perm,
+                      rocsparse_int*            csr_row_ptr_perm,
+                      rocsparse_int*            csr_col_ind_perm,
+                      void*                     temp_buffer);
+
 #endif // ROCSPARSE_HPP
@@ -50,6 +50,11 @@ struct Arguments
     rocsparse_int col_block_dimA;
     rocsparse_int row_block_dimB;
     rocsparse_int col_block_dimB;
+    rocsparse_int slice_size;
+    rocsparse_int sigma;
+    rocsparse_int level_of_fill;
+    rocsparse_int max_fill;
+    rocsparse_int nsweeps;
 
     rocsparse_int dimx;
     rocsparse_int dimy;
@@ -66,27 +71,31 @@ struct Arguments
     double threshold;
     double percentage;
 
-    rocsparse_operation           transA;
-    rocsparse_operation           transB;
-    rocsparse_index_base          baseA;
-    rocsparse_index_base          baseB;
-    rocsparse_index_base          baseC;
-    rocsparse_index_base          baseD;
-    rocsparse_action              action;
-    rocsparse_hyb_partition       part;
-    rocsparse_diag_type           diag;
-    rocsparse_fill_mode           uplo;
-    rocsparse_analysis_policy     apol;
-    rocsparse_solve_policy        spol;
-    rocsparse_direction           direction;
-    rocsparse_order               order;
-    rocsparse_format              format;
-    rocsparse_sddmm_alg           sddmm_alg;
-    rocsparse_spmv_alg            spmv_alg;
-    rocsparse_spmm_alg            spmm_alg;
-    rocsparse_spgemm_alg          spgemm_alg;
-    rocsparse_sparse_to_dense_alg sparse_to_dense_alg;
-    rocsparse_dense_to_sparse_alg dense_to_sparse_alg;
+    rocsparse_operation            transA;
+    rocsparse_operation            transB;
+    rocsparse_index_base           baseA;
+    rocsparse_index_base           baseB;
+    rocsparse_index_base           baseC;
+    rocsparse_index_base           baseD;
+    rocsparse_action               action;
+    rocsparse_hyb_partition        part;
+    rocsparse_matrix_type          matrix_type;
+    rocsparse_diag_type            diag;
+    rocsparse_fill_mode            uplo;
+    rocsparse_analysis_policy      apol;
+    rocsparse_solve_policy         spol;
+    rocsparse_direction            direction;
+    rocsparse_order                order;
+    rocsparse_format               format;
+    rocsparse_sddmm_alg            sddmm_alg;
+    rocsparse_spmv_alg             spmv_alg;
+    rocsparse_spmm_alg             spmm_alg;
+    rocsparse_spgemm_alg           spgemm_alg;
+    rocsparse_sparse_to_dense_alg  sparse_to_dense_alg;
+    rocsparse_dense_to_sparse_alg  dense_to_sparse_alg;
+    rocsparse_color_alg            color_alg;
+    rocsparse_gtsv_interleaved_alg gtsv_interleaved_alg;
+    rocsparse_gpsv_interleaved_alg gpsv_interleaved_alg;
 
     rocsparse_matrix_init      matrix;
     rocsparse_matrix_init_kind matrix_init_kind;
@@ -104,6 +113,8 @@ struct Arguments
     double boostval;
     double boostvali;
 
+    int colorbalance;
+
     double tolm;
 
     char filename[64];
@@ -157,6 +168,11 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(col_block_dimA);
         ROCSPARSE_FORMAT_CHECK(row_block_dimB);
         ROCSPARSE_FORMAT_CHECK(col_block_dimB);
+        ROCSPARSE_FORMAT_CHECK(slice_size);
+        ROCSPARSE_FORMAT_CHECK(sigma);
+        ROCSPARSE_FORMAT_CHECK(level_of_fill);
+        ROCSPARSE_FORMAT_CHECK(max_fill);
+        ROCSPARSE_FORMAT_CHECK(nsweeps);
         ROCSPARSE_FORMAT_CHECK(dimx);
         ROCSPARSE_FORMAT_CHECK(dimy);
         ROCSPARSE_FORMAT_CHECK(dimz);
@@ -177,6 +193,7 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(baseD);
         ROCSPARSE_FORMAT_CHECK(action);
         ROCSPARSE_FORMAT_CHECK(part);
+        ROCSPARSE_FORMAT_CHECK(matrix_type);
         ROCSPARSE_FORMAT_CHECK(diag);
         ROCSPARSE_FORMAT_CHECK(uplo);
         ROCSPARSE_FORMAT_CHECK(apol);
@@ -190,6 +207,9 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(spgemm_alg);
         ROCSPARSE_FORMAT_CHECK(sparse_to_dense_alg);
         ROCSPARSE_FORMAT_CHECK(dense_to_sparse_alg);
+        ROCSPARSE_FORMAT_CHECK(color_alg);
+        ROCSPARSE_FORMAT_CHECK(gtsv_interleaved_alg);
+        ROCSPARSE_FORMAT_CHECK(gpsv_interleaved_alg);
         ROCSPARSE_FORMAT_CHECK(matrix);
         ROCSPARSE_FORMAT_CHECK(matrix_init_kind);
         ROCSPARSE_FORMAT_CHECK(unit_check);
@@ -201,6 +221,7 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(boosttol);
         ROCSPARSE_FORMAT_CHECK(boostval);
         ROCSPARSE_FORMAT_CHECK(boostvali);
+        ROCSPARSE_FORMAT_CHECK(colorbalance);
         ROCSPARSE_FORMAT_CHECK(tolm);
         ROCSPARSE_FORMAT_CHECK(filename);
         ROCSPARSE_FORMAT_CHECK(function);
@@ -348,6 +369,11 @@ private:
         print("col_block_dimA", arg.col_block_dimA);
         print("row_block_dimB", arg.row_block_dimB);
         print("col_block_dimB", arg.col_block_dimB);
+        print("slice_size", arg.slice_size);
+        print("sigma", arg.sigma);
+        print("level_of_fill", arg.level_of_fill);
+        print("max_fill", arg.max_fill);
+        print("nsweeps", arg.nsweeps);
         print("dim_x", arg.dimx);
         print("dim_y", arg.dimy);
         print("dim_z", arg.dimz);
@@ -359,6 +385,7 @@ private:
         print("percentage", arg.percentage);
         print("action", rocsparse_action2string(arg.action));
         print("part", rocsparse_partition2string(arg.part));
+        print("matrix_type", rocsparse_matrixtype2string(arg.matrix_type));
         print("diag", rocsparse_diagtype2string(arg.diag));
         print("uplo", rocsparse_fillmode2string(arg.uplo));
         print("analysis_policy", rocsparse_analysis2string(arg.apol));
@@ -372,6 +399,11 @@ private:
         print("spgemm_alg", rocsparse_spgemmalg2string(arg.spgemm_alg));
         print("sparse_to_dense_alg", rocsparse_sparsetodensealg2string(arg.sparse_to_dense_alg));
         print("dense_to_sparse_alg", rocsparse_densetosparsealg2string(arg.dense_to_sparse_alg));
+        print("color_alg", rocsparse_coloralg2string(arg.color_alg));
+        print("gtsv_interleaved_alg",
+              rocsparse_gtsvinterleavedalg2string(arg.gtsv_interleaved_alg));
+        print("gpsv_interleaved_alg",
+              rocsparse_gpsvinterleavedalg2string(arg.gpsv_interleaved_alg));
         print("matrix", rocsparse_matrix2string(arg.matrix));
         print("matrix_init_kind", rocsparse_matrix_init_kind2string(arg.matrix_init_kind));
         print("file", arg.filename);
@@ -380,6 +412,7 @@ private:
         print("boost_tol", arg.boosttol);
         print("boost_val", arg.boostval);
         print("boost_vali", arg.boostvali);
+        print("color_balance", arg.colorbalance);
         print("tolm", arg.tolm);
         print("name", arg.name);
         print("category", arg.category);
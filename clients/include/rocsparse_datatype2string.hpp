@@ -91,6 +91,8 @@ constexpr auto rocsparse_datatype2string(rocsparse_datatype type)
 {
     switch(type)
     {
+    case rocsparse_datatype_f16_r:
+        return "f16_r";
     case rocsparse_datatype_f32_r:
         return "f32_r";
     case rocsparse_datatype_f64_r:
@@ -99,6 +101,10 @@ constexpr auto rocsparse_datatype2string(rocsparse_datatype type)
         return "f32_c";
     case rocsparse_datatype_f64_c:
         return "f64_c";
+    case rocsparse_datatype_i8_r:
+        return "i8_r";
+    case rocsparse_datatype_bf16_r:
+        return "bf16_r";
     }
     return "invalid";
 }
@@ -129,6 +135,22 @@ constexpr auto rocsparse_operation2string(rocsparse_operation trans)
     return "invalid";
 }
 
+constexpr auto rocsparse_matrixtype2string(rocsparse_matrix_type type)
+{
+    switch(type)
+    {
+    case rocsparse_matrix_type_general:
+        return "GE";
+    case rocsparse_matrix_type_symmetric:
+        return "SY";
+    case rocsparse_matrix_type_hermitian:
+        return "HE";
+    case rocsparse_matrix_type_triangular:
+        return "TR";
+    }
+    return "invalid";
+}
+
 constexpr auto rocsparse_diagtype2string(rocsparse_diag_type diag)
 {
     switch(diag)
@@ -197,6 +219,12 @@ constexpr auto rocsparse_solve2string(rocsparse_solve_policy policy)
     {
     case rocsparse_solve_policy_auto:
         return "auto";
+    case rocsparse_solve_policy_level:
+        return "level";
+    case rocsparse_solve_policy_push:
+        return "push";
+    case rocsparse_solve_policy_jacobi:
+        return "jacobi";
     }
     return "invalid";
 }
@@ -239,6 +267,10 @@ constexpr auto rocsparse_format2string(rocsparse_format format)
         return "csc";
     case rocsparse_format_ell:
         return "ell";
+    case rocsparse_format_bsr:
+        return "bsr";
+    case rocsparse_format_sell:
+        return "sell";
     }
     return "invalid";
 }
@@ -267,6 +299,12 @@ constexpr auto rocsparse_spmvalg2string(rocsparse_spmv_alg alg)
         return "csrstream";
     case rocsparse_spmv_alg_ell:
         return "ell";
+    case rocsparse_spmv_alg_csr_merge:
+        return "csrmerge";
+    case rocsparse_spmv_alg_sell:
+        return "sell";
+    case rocsparse_spmv_alg_auto:
+        return "auto";
     }
     return "invalid";
 }
@@ -300,6 +338,50 @@ constexpr auto rocsparse_spgemmalg2string(rocsparse_spgemm_alg alg)
     {
     case rocsparse_spgemm_alg_default:
         return "default";
+    case rocsparse_spgemm_alg_esc:
+        return "esc";
+    case rocsparse_spgemm_alg_dense_acc:
+        return "dense_acc";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_coloralg2string(rocsparse_color_alg alg)
+{
+    switch(alg)
+    {
+    case rocsparse_color_alg_jpl:
+        return "jpl";
+    case rocsparse_color_alg_jpl_distance2:
+        return "jpl_distance2";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_gtsvinterleavedalg2string(rocsparse_gtsv_interleaved_alg alg)
+{
+    switch(alg)
+    {
+    case rocsparse_gtsv_interleaved_alg_default:
+        return "default";
+    case rocsparse_gtsv_interleaved_alg_thomas:
+        return "thomas";
+    case rocsparse_gtsv_interleaved_alg_lu:
+        return "lu";
+    case rocsparse_gtsv_interleaved_alg_qr:
+        return "qr";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_gpsvinterleavedalg2string(rocsparse_gpsv_interleaved_alg alg)
+{
+    switch(alg)
+    {
+    case rocsparse_gpsv_interleaved_alg_default:
+        return "default";
+    case rocsparse_gpsv_interleaved_alg_qr:
+        return "qr";
     }
     return "invalid";
 }
@@ -234,7 +234,9 @@ void host_bsrsv(rocsparse_operation  trans,
                 rocsparse_int*       numeric_pivot);
 
 template <typename I, typename T>
-void host_coomv(I                    M,
+void host_coomv(rocsparse_operation  trans,
+                I                    M,
+                I                    N,
                 I                    nnz,
                 T                    alpha,
                 const I*             coo_row_ind,
@@ -246,7 +248,9 @@ void host_coomv(I                    M,
                 rocsparse_index_base base);
 
 template <typename I, typename T>
-void host_coomv_aos(I                    M,
+void host_coomv_aos(rocsparse_operation  trans,
+                    I                    M,
+                    I                    N,
                     I                    nnz,
                     T                    alpha,
                     const I*             coo_ind,
@@ -257,7 +261,9 @@ void host_coomv_aos(I                    M,
                     rocsparse_index_base base);
 
 template <typename I, typename J, typename T>
-void host_csrmv(J                    M,
+void host_csrmv(rocsparse_operation  trans,
+                J                    M,
+                J                    N,
                 I                    nnz,
                 T                    alpha,
                 const I*             csr_row_ptr,
@@ -834,6 +840,21 @@ void host_csr_to_ell(J                     M,
                      rocsparse_index_base  csr_base,
                      rocsparse_index_base  ell_base);
 
+template <typename T>
+void host_csr_to_sell(rocsparse_int                     M,
+                      const std::vector<rocsparse_int>& csr_row_ptr,
+                      const std::vector<rocsparse_int>& csr_col_ind,
+                      const std::vector<T>&             csr_val,
+                      rocsparse_int                     slice_size,
+                      rocsparse_int                     sigma,
+                      std::vector<rocsparse_int>&       sell_slice_ptr,
+                      std::vector<rocsparse_int>&       sell_perm,
+                      std::vector<rocsparse_int>&       sell_col_ind,
+                      std::vector<T>&                   sell_val,
+                      rocsparse_int&                    sell_nnz,
+                      rocsparse_index_base              csr_base,
+                      rocsparse_index_base              sell_base);
+
 template <typename T>
 void host_csr_to_hyb(rocsparse_int                     M,
                      rocsparse_int                     nnz,
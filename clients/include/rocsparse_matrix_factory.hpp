@@ -883,6 +883,135 @@ struct rocsparse_matrix_utils
 
         return rocsparse_status_success;
     }
+
+    //
+    // @brief Extract the triangular part of a square matrix that is stored for a
+    // symmetric or Hermitian matrix, together with the full matrix it represents.
+    // @param[in] A Square matrix.
+    // @param[in] type Symmetric or Hermitian matrix type.
+    // @param[in] uplo Triangular part that is stored.
+    // @param[out] triA Stored triangular part of \p A, including the diagonal.
+    // @param[out] fullA Full symmetric or Hermitian matrix represented by \p triA.
+    //
+    template <typename T, typename I, typename J>
+    static rocsparse_status host_csrtri(const host_csr_matrix<T, I, J>& A,
+                                        rocsparse_matrix_type           type,
+                                        rocsparse_fill_mode             uplo,
+                                        host_csr_matrix<T, I, J>&       triA,
+                                        host_csr_matrix<T, I, J>&       fullA)
+    {
+        const auto M    = A.m;
+        const auto base = A.base;
+
+        if(M != A.n)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        auto stored = [uplo](J i, J j) {
+            return (uplo == rocsparse_fill_mode_lower) ? (j <= i) : (j >= i);
+        };
+
+        //
+        // Count entries of the triangular part and of the full matrix.
+        //
+        triA.define(M, M, 0, base);
+        fullA.define(M, M, 0, base);
+
+        for(J i = 0; i <= M; ++i)
+        {
+            triA.ptr[i]  = 0;
+            fullA.ptr[i] = 0;
+        }
+
+        for(J i = 0; i < M; ++i)
+        {
+            for(I k = A.ptr[i] - base; k < A.ptr[i + 1] - base; ++k)
+            {
+                const J j = A.ind[k] - base;
+                if(stored(i, j))
+                {
+                    ++triA.ptr[i + 1];
+                    ++fullA.ptr[i + 1];
+
+                    if(i != j)
+                    {
+                        ++fullA.ptr[j + 1];
+                    }
+                }
+            }
+        }
+
+        for(J i = 0; i < M; ++i)
+        {
+            triA.ptr[i + 1] += triA.ptr[i];
+            fullA.ptr[i + 1] += fullA.ptr[i];
+        }
+
+        triA.define(M, M, triA.ptr[M], base);
+        fullA.define(M, M, fullA.ptr[M], base);
+
+        //
+        // Fill both matrices, the diagonal of a Hermitian matrix is real.
+        //
+        std::vector<I> fill(M);
+        for(J i = 0; i < M; ++i)
+        {
+            fill[i] = fullA.ptr[i];
+        }
+
+        for(J i = 0; i < M; ++i)
+        {
+            I idx = triA.ptr[i];
+            for(I k = A.ptr[i] - base; k < A.ptr[i + 1] - base; ++k)
+            {
+                const J j = A.ind[k] - base;
+                if(stored(i, j))
+                {
+                    T val = A.val[k];
+                    if(type == rocsparse_matrix_type_hermitian && i == j)
+                    {
+                        val = (val + rocsparse_conj(val)) / static_cast<T>(2);
+                    }
+
+                    triA.ind[idx]   = j;
+                    triA.val[idx++] = val;
+
+                    fullA.ind[fill[i]]   = j;
+                    fullA.val[fill[i]++] = val;
+
+                    if(i != j)
+                    {
+                        fullA.ind[fill[j]]   = i;
+                        fullA.val[fill[j]++] = (type == rocsparse_matrix_type_hermitian)
+                                                   ? rocsparse_conj(val)
+                                                   : val;
+                    }
+                }
+            }
+        }
+
+        if(rocsparse_index_base_one == base)
+        {
+            for(J i = 0; i <= M; ++i)
+            {
+                triA.ptr[i] += base;
+                fullA.ptr[i] += base;
+            }
+
+            for(I i = 0; i < triA.nnz; ++i)
+            {
+                triA.ind[i] += base;
+            }
+
+            for(I i = 0; i < fullA.nnz; ++i)
+            {
+                fullA.ind[i] += base;
+            }
+        }
+
+        return rocsparse_status_success;
+    }
 };
 
 template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
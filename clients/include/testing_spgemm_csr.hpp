@@ -28,6 +28,8 @@
 template <typename I, typename J, typename T>
 void testing_spgemm_csr_bad_arg(const Arguments& arg);
 template <typename I, typename J, typename T>
+void testing_spgemm_csr_accumulators(const Arguments& arg);
+template <typename I, typename J, typename T>
 void testing_spgemm_csr(const Arguments& arg);
 
 #endif // TESTING_SPGEMM_CSR_HPP
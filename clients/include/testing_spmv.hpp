@@ -42,6 +42,18 @@ struct testing_matrix_type_traits<rocsparse_format_csr, I, J, T>
     using device_sparse_matrix = device_csr_matrix<U, I, J>;
 };
 
+//
+// TRAITS FOR CSC FORMAT.
+//
+template <typename I, typename J, typename T>
+struct testing_matrix_type_traits<rocsparse_format_csc, I, J, T>
+{
+    template <typename U>
+    using host_sparse_matrix = host_csc_matrix<U, I, J>;
+    template <typename U>
+    using device_sparse_matrix = device_csc_matrix<U, I, J>;
+};
+
 //
 // TRAITS FOR COO FORMAT.
 //
@@ -102,11 +114,74 @@ struct testing_spmv_dispatch_traits<rocsparse_format_csr, I, J, T>
         matrix_factory.init_csr(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
+    {
+        host_csrmv<I, J, T>(trans,
+                            hA.m,
+                            hA.n,
+                            hA.nnz,
+                            *h_alpha,
+                            hA.ptr,
+                            hA.ind,
+                            hA.val,
+                            hx,
+                            *h_beta,
+                            hy,
+                            hA.base,
+                            adaptive);
+    }
+};
+
+//
+// TRAITS FOR CSC FORMAT.
+//
+template <typename I, typename J, typename T>
+struct testing_spmv_dispatch_traits<rocsparse_format_csc, I, J, T>
+{
+    using traits = testing_matrix_type_traits<rocsparse_format_csc, I, J, T>;
+
+    template <typename U>
+    using host_sparse_matrix = typename traits::template host_sparse_matrix<U>;
+    template <typename U>
+    using device_sparse_matrix = typename traits::template device_sparse_matrix<U>;
+
+    template <typename... Ts>
+    static void sparse_initialization(rocsparse_matrix_factory<T, I, J>& matrix_factory,
+                                      host_sparse_matrix<T>&             hA,
+                                      Ts&&... ts)
+    {
+        matrix_factory.init_csc(hA, ts...);
+    }
+
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
-        host_csrmv<I, J, T>(
-            hA.m, hA.nnz, *h_alpha, hA.ptr, hA.ind, hA.val, hx, *h_beta, hy, hA.base, adaptive);
+        // The CSC matrix is the transpose of a CSR matrix with the same arrays
+        host_csrmv<I, J, T>((trans == rocsparse_operation_none) ? rocsparse_operation_transpose
+                                                                : rocsparse_operation_none,
+                            hA.n,
+                            hA.m,
+                            hA.nnz,
+                            *h_alpha,
+                            hA.ptr,
+                            hA.ind,
+                            hA.val,
+                            hx,
+                            *h_beta,
+                            hy,
+                            hA.base,
+                            adaptive);
     }
 };
 
@@ -131,11 +206,26 @@ struct testing_spmv_dispatch_traits<rocsparse_format_coo, I, I, T>
         matrix_factory.init_coo(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
-        host_coomv<I, T>(
-            hA.m, hA.nnz, *h_alpha, hA.row_ind, hA.col_ind, hA.val, hx, *h_beta, hy, hA.base);
+        host_coomv<I, T>(trans,
+                         hA.m,
+                         hA.n,
+                         hA.nnz,
+                         *h_alpha,
+                         hA.row_ind,
+                         hA.col_ind,
+                         hA.val,
+                         hx,
+                         *h_beta,
+                         hy,
+                         hA.base);
     };
 };
 
@@ -160,10 +250,16 @@ struct testing_spmv_dispatch_traits<rocsparse_format_coo_aos, I, I, T>
         matrix_factory.init_coo_aos(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
-        host_coomv_aos<I, T>(hA.m, hA.nnz, *h_alpha, hA.ind, hA.val, hx, *h_beta, hy, hA.base);
+        host_coomv_aos<I, T>(
+            trans, hA.m, hA.n, hA.nnz, *h_alpha, hA.ind, hA.val, hx, *h_beta, hy, hA.base);
     };
 };
 
@@ -187,8 +283,13 @@ struct testing_spmv_dispatch_traits<rocsparse_format_ell, I, I, T>
         matrix_factory.init_ell(hA, ts...);
     }
 
-    static void host_calculation(
-        T* h_alpha, host_sparse_matrix<T>& hA, T* hx, T* h_beta, T* hy, bool adaptive)
+    static void host_calculation(rocsparse_operation    trans,
+                                 T*                     h_alpha,
+                                 host_sparse_matrix<T>& hA,
+                                 T*                     hx,
+                                 T*                     h_beta,
+                                 T*                     hy,
+                                 bool                   adaptive)
     {
         host_ellmv<I, T>(hA.m, hA.n, *h_alpha, hA.ind, hA.val, hA.width, hx, *h_beta, hy, hA.base);
     };
@@ -247,6 +348,15 @@ public:
                 break;
             }
             case rocsparse_datatype_f64_r:
+            {
+                device_sparse_matrix<rocsparse_float_complex> dA;
+                rocsparse_local_spmat                         A(dA);
+                EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+                break;
+            }
+            case rocsparse_datatype_i8_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             case rocsparse_datatype_f32_c:
             case rocsparse_datatype_f64_c:
             {
@@ -275,6 +385,9 @@ public:
                 EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
                 break;
             }
+            case rocsparse_datatype_i8_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             case rocsparse_datatype_f64_r:
             case rocsparse_datatype_f32_c:
             case rocsparse_datatype_f64_c:
@@ -304,6 +417,9 @@ public:
                 EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
                 break;
             }
+            case rocsparse_datatype_i8_r:
+            case rocsparse_datatype_f16_r:
+            case rocsparse_datatype_bf16_r:
             case rocsparse_datatype_f64_r:
             case rocsparse_datatype_f32_c:
             case rocsparse_datatype_f64_c:
@@ -420,11 +536,11 @@ public:
 
         device_sparse_matrix<T> dA(hA);
 
-        host_dense_matrix<T> hx(N, 1);
+        host_dense_matrix<T> hx((trans == rocsparse_operation_none) ? N : M, 1);
         rocsparse_matrix_utils::init_exact(hx);
         device_dense_matrix<T> dx(hx);
 
-        host_dense_matrix<T> hy(M, 1);
+        host_dense_matrix<T> hy((trans == rocsparse_operation_none) ? M : N, 1);
         rocsparse_matrix_utils::init_exact(hy);
 
         device_dense_matrix<T> dy(hy);
@@ -450,7 +566,7 @@ public:
                 //
                 // HOST CALCULATION
                 //
-                traits::host_calculation(h_alpha, hA, hx, h_beta, hy, adaptive);
+                traits::host_calculation(trans, h_alpha, hA, hx, h_beta, hy, adaptive);
                 hy.near_check(dy);
                 dy.transfer_from(hy_copy);
             }
@@ -464,6 +580,87 @@ public:
             }
 
             hy.near_check(dy);
+
+            // The automatic algorithm selection is tuned for the operation and the scalars.
+            // Changing them on the same matrix descriptor has to select an algorithm that
+            // supports the new parameters.
+            if(alg == rocsparse_spmv_alg_auto
+               && (FORMAT == rocsparse_format_csr || FORMAT == rocsparse_format_csc))
+            {
+                static const rocsparse_operation ops[3]
+                    = {rocsparse_operation_none,
+                       rocsparse_operation_transpose,
+                       rocsparse_operation_conjugate_transpose};
+
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+                for(auto op : ops)
+                {
+                    // Not supported for CSC matrices
+                    if(FORMAT == rocsparse_format_csc
+                       && op == rocsparse_operation_conjugate_transpose)
+                    {
+                        continue;
+                    }
+
+                    T                    betas[2] = {static_cast<T>(0), *h_beta};
+                    host_dense_matrix<T> hx_op((op == rocsparse_operation_none) ? N : M, 1);
+                    rocsparse_matrix_utils::init_exact(hx_op);
+                    device_dense_matrix<T> dx_op(hx_op);
+                    rocsparse_local_dnvec  x_op(dx_op);
+
+                    // The tuning runs during the buffer size query for beta == 0. The
+                    // computation with the second beta skips the query and has to fall
+                    // back to an algorithm that needs no tuning.
+                    size_t buffer_size_op;
+                    void*  dbuffer_op = nullptr;
+
+                    for(int b = 0; b < 2; ++b)
+                    {
+                        T beta_op = betas[b];
+
+                        host_dense_matrix<T> hy_op((op == rocsparse_operation_none) ? M : N, 1);
+                        rocsparse_matrix_utils::init_exact(hy_op);
+                        device_dense_matrix<T> dy_op(hy_op);
+                        rocsparse_local_dnvec  y_op(dy_op);
+
+                        if(b == 0)
+                        {
+                            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                                 op,
+                                                                 h_alpha,
+                                                                 A,
+                                                                 x_op,
+                                                                 &beta_op,
+                                                                 y_op,
+                                                                 ttype,
+                                                                 alg,
+                                                                 &buffer_size_op,
+                                                                 nullptr));
+                            CHECK_HIP_ERROR(hipMalloc(&dbuffer_op, buffer_size_op));
+                        }
+
+                        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(handle,
+                                                             op,
+                                                             h_alpha,
+                                                             A,
+                                                             x_op,
+                                                             &beta_op,
+                                                             y_op,
+                                                             ttype,
+                                                             alg,
+                                                             &buffer_size_op,
+                                                             dbuffer_op));
+
+                        traits::host_calculation(
+                            op, h_alpha, hA, hx_op, &beta_op, hy_op, adaptive);
+                        hy_op.near_check(dy_op);
+                    }
+
+                    CHECK_HIP_ERROR(hipFree(dbuffer_op));
+                }
+            }
         }
 
         if(arg.timing)
@@ -507,7 +704,7 @@ public:
                                 "beta",
                                 *h_beta,
                                 "Algorithm",
-                                (adaptive ? "adaptive" : "stream"),
+                                rocsparse_spmvalg2string(alg),
                                 "GFlop/s",
                                 gpu_gflops,
                                 "GB/s",
@@ -396,6 +396,82 @@ public:
     {
     }
 
+    rocsparse_local_spmat(int64_t              mb,
+                          int64_t              nb,
+                          int64_t              nnzb,
+                          rocsparse_direction  block_dir,
+                          int64_t              block_dim,
+                          void*                bsr_row_ptr,
+                          void*                bsr_col_ind,
+                          void*                bsr_val,
+                          rocsparse_indextype  row_ptr_type,
+                          rocsparse_indextype  col_ind_type,
+                          rocsparse_index_base idx_base,
+                          rocsparse_datatype   compute_type)
+    {
+        rocsparse_create_bsr_descr(&this->descr,
+                                   mb,
+                                   nb,
+                                   nnzb,
+                                   block_dir,
+                                   block_dim,
+                                   bsr_row_ptr,
+                                   bsr_col_ind,
+                                   bsr_val,
+                                   row_ptr_type,
+                                   col_ind_type,
+                                   idx_base,
+                                   compute_type);
+    }
+
+    template <memory_mode::value_t MODE,
+              typename T,
+              typename I = rocsparse_int,
+              typename J = rocsparse_int>
+    rocsparse_local_spmat(gebsx_matrix<MODE, rocsparse_direction_row, T, I, J>& h)
+        : rocsparse_local_spmat(h.mb,
+                                h.nb,
+                                h.nnzb,
+                                h.block_direction,
+                                h.row_block_dim,
+                                h.ptr,
+                                h.ind,
+                                h.val,
+                                get_indextype<I>(),
+                                get_indextype<J>(),
+                                h.base,
+                                get_datatype<T>())
+    {
+    }
+
+    rocsparse_local_spmat(int64_t              m,
+                          int64_t              n,
+                          int64_t              sell_nnz,
+                          int64_t              slice_size,
+                          void*                sell_slice_ptr,
+                          void*                sell_perm,
+                          void*                sell_col_ind,
+                          void*                sell_val,
+                          rocsparse_indextype  slice_ptr_type,
+                          rocsparse_indextype  idx_type,
+                          rocsparse_index_base idx_base,
+                          rocsparse_datatype   compute_type)
+    {
+        rocsparse_create_sell_descr(&this->descr,
+                                    m,
+                                    n,
+                                    sell_nnz,
+                                    slice_size,
+                                    sell_slice_ptr,
+                                    sell_perm,
+                                    sell_col_ind,
+                                    sell_val,
+                                    slice_ptr_type,
+                                    idx_type,
+                                    idx_base,
+                                    compute_type);
+    }
+
     ~rocsparse_local_spmat()
     {
         if(this->descr != nullptr)
@@ -61,20 +61,6 @@ void testing_coomv_bad_arg(const Arguments& arg)
 
     auto_testing_bad_arg(rocsparse_coomv<T>, PARAMS);
 
-    for(auto operation : rocsparse_operation_t::values)
-    {
-        if(operation != rocsparse_operation_none)
-        {
-            {
-                auto tmp = trans;
-                trans    = operation;
-                EXPECT_ROCSPARSE_STATUS(rocsparse_coomv<T>(PARAMS),
-                                        rocsparse_status_not_implemented);
-                trans = tmp;
-            }
-        }
-    }
-
     for(auto matrix_type : rocsparse_matrix_type_t::values)
     {
         if(matrix_type != rocsparse_matrix_type_general)
@@ -136,8 +122,8 @@ void testing_coomv(const Arguments& arg)
 
     matrix_factory.init_coo(hA, M, N, base);
 
-    host_dense_matrix<T> hx(N, 1);
-    host_dense_matrix<T> hy(M, 1);
+    host_dense_matrix<T> hx((trans == rocsparse_operation_none) ? N : M, 1);
+    host_dense_matrix<T> hy((trans == rocsparse_operation_none) ? M : N, 1);
 
     rocsparse_matrix_utils::init(hx);
     rocsparse_matrix_utils::init(hy);
@@ -154,8 +140,18 @@ void testing_coomv(const Arguments& arg)
         {
             host_dense_matrix<T> hy_copy(hy);
             // CPU coomv
-            host_coomv<rocsparse_int, T>(
-                hA.m, hA.nnz, *h_alpha, hA.row_ind, hA.col_ind, hA.val, hx, *h_beta, hy, hA.base);
+            host_coomv<rocsparse_int, T>(trans,
+                                         hA.m,
+                                         hA.n,
+                                         hA.nnz,
+                                         *h_alpha,
+                                         hA.row_ind,
+                                         hA.col_ind,
+                                         hA.val,
+                                         hx,
+                                         *h_beta,
+                                         hy,
+                                         hA.base);
             hy.near_check(dy);
             dy.transfer_from(hy_copy);
         }
@@ -0,0 +1,652 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csr2sell_bad_arg(const Arguments& arg)
+{
+    static const size_t  safe_size  = 100;
+    static const int32_t slice_size = 4;
+    static const int32_t sigma      = 8;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for SELL matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dsell_slice_ptr(safe_size);
+    device_vector<rocsparse_int> dsell_perm(safe_size);
+    device_vector<rocsparse_int> dsell_col_ind(safe_size);
+    device_vector<T>             dsell_val(safe_size);
+    device_vector<char>          dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_perm
+       || !dsell_col_ind || !dsell_val || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csr2sell_buffer_size()
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sell_buffer_size(
+            nullptr, safe_size, descrA, dcsr_row_ptr, slice_size, sigma, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sell_buffer_size(
+            handle, safe_size, nullptr, dcsr_row_ptr, slice_size, sigma, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sell_buffer_size(
+            handle, safe_size, descrA, dcsr_row_ptr, 0, sigma, &buffer_size),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sell_buffer_size(
+            handle, safe_size, descrA, dcsr_row_ptr, slice_size, 0, &buffer_size),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csr2sell_buffer_size(
+            handle, safe_size, descrA, dcsr_row_ptr, slice_size, sigma, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csr2sell_nnz()
+    rocsparse_int sell_nnz;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(nullptr,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   nullptr,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   nullptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   nullptr,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   nullptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   nullptr,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   nullptr,
+                                                   dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   slice_size,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                   safe_size,
+                                                   descrA,
+                                                   dcsr_row_ptr,
+                                                   descrB,
+                                                   0,
+                                                   sigma,
+                                                   dsell_slice_ptr,
+                                                   dsell_perm,
+                                                   &sell_nnz,
+                                                   dbuffer),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csr2sell()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(nullptr,
+                                                  safe_size,
+                                                  descrA,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  descrB,
+                                                  slice_size,
+                                                  dsell_slice_ptr,
+                                                  dsell_perm,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  descrB,
+                                                  slice_size,
+                                                  dsell_slice_ptr,
+                                                  dsell_perm,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                  safe_size,
+                                                  descrA,
+                                                  dcsr_val,
+                                                  nullptr,
+                                                  dcsr_col_ind,
+                                                  descrB,
+                                                  slice_size,
+                                                  dsell_slice_ptr,
+                                                  dsell_perm,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                  safe_size,
+                                                  descrA,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  nullptr,
+                                                  slice_size,
+                                                  dsell_slice_ptr,
+                                                  dsell_perm,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                  safe_size,
+                                                  descrA,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  descrB,
+                                                  slice_size,
+                                                  nullptr,
+                                                  dsell_perm,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                  safe_size,
+                                                  descrA,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  descrB,
+                                                  slice_size,
+                                                  dsell_slice_ptr,
+                                                  nullptr,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                  safe_size,
+                                                  descrA,
+                                                  dcsr_val,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  descrB,
+                                                  0,
+                                                  dsell_slice_ptr,
+                                                  dsell_perm,
+                                                  dsell_val,
+                                                  dsell_col_ind),
+                            rocsparse_status_invalid_size);
+}
+
+template <typename T>
+void testing_csr2sell(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M          = arg.M;
+    rocsparse_int               N          = arg.N;
+    rocsparse_int               slice_size = arg.slice_size;
+    rocsparse_int               sigma      = arg.sigma;
+    rocsparse_index_base        baseA      = arg.baseA;
+    rocsparse_index_base        baseB      = arg.baseB;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor for CSR matrix
+    rocsparse_local_mat_descr descrA;
+
+    // Create matrix descriptor for SELL matrix
+    rocsparse_local_mat_descr descrB;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || slice_size <= 0 || sigma <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              ptr_size  = std::max(safe_size, static_cast<size_t>(M + 1));
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(ptr_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dsell_slice_ptr(ptr_size);
+        device_vector<rocsparse_int> dsell_perm(ptr_size);
+        device_vector<rocsparse_int> dsell_col_ind(safe_size);
+        device_vector<T>             dsell_val(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_perm
+           || !dsell_col_ind || !dsell_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Need to initialize csr_row_ptr with 0
+        CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr, 0, sizeof(rocsparse_int) * ptr_size));
+
+        rocsparse_status status = (M < 0 || slice_size <= 0 || sigma <= 0)
+                                      ? rocsparse_status_invalid_size
+                                      : rocsparse_status_success;
+
+        size_t        buffer_size = safe_size;
+        rocsparse_int sell_nnz;
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csr2sell_buffer_size(
+                handle, M, descrA, dcsr_row_ptr, slice_size, sigma, &buffer_size),
+            status);
+
+        device_vector<char> dbuffer(std::max(safe_size, buffer_size));
+
+        if(!dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell_nnz(handle,
+                                                       M,
+                                                       descrA,
+                                                       dcsr_row_ptr,
+                                                       descrB,
+                                                       slice_size,
+                                                       sigma,
+                                                       dsell_slice_ptr,
+                                                       dsell_perm,
+                                                       &sell_nnz,
+                                                       dbuffer),
+                                status);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csr2sell<T>(handle,
+                                                      M,
+                                                      descrA,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      descrB,
+                                                      slice_size,
+                                                      dsell_slice_ptr,
+                                                      dsell_perm,
+                                                      dsell_val,
+                                                      dsell_col_ind),
+                                (M < 0 || slice_size <= 0) ? rocsparse_status_invalid_size
+                                                           : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+    host_vector<rocsparse_int> hsell_slice_ptr_gold;
+    host_vector<rocsparse_int> hsell_perm_gold;
+    host_vector<rocsparse_int> hsell_col_ind_gold;
+    host_vector<T>             hsell_val_gold;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, baseA);
+
+    rocsparse_int nslices = (M - 1) / slice_size + 1;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dsell_slice_ptr(nslices + 1);
+    device_vector<rocsparse_int> dsell_perm(M);
+    device_vector<rocsparse_int> dsell_nnz(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dsell_slice_ptr || !dsell_perm
+       || !dsell_nnz)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_buffer_size(
+        handle, M, descrA, dcsr_row_ptr, slice_size, sigma, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Obtain SELL slice pointers and row permutation, pointer mode host
+        rocsparse_int hsell_nnz_1;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                     M,
+                                                     descrA,
+                                                     dcsr_row_ptr,
+                                                     descrB,
+                                                     slice_size,
+                                                     sigma,
+                                                     dsell_slice_ptr,
+                                                     dsell_perm,
+                                                     &hsell_nnz_1,
+                                                     dbuffer));
+
+        // Pointer mode device
+        rocsparse_int hsell_nnz_2;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                     M,
+                                                     descrA,
+                                                     dcsr_row_ptr,
+                                                     descrB,
+                                                     slice_size,
+                                                     sigma,
+                                                     dsell_slice_ptr,
+                                                     dsell_perm,
+                                                     dsell_nnz,
+                                                     dbuffer));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hsell_nnz_2, dsell_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Allocate device memory
+        device_vector<rocsparse_int> dsell_col_ind(hsell_nnz_1);
+        device_vector<T>             dsell_val(hsell_nnz_1);
+
+        if(!dsell_col_ind || !dsell_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform SELL conversion
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell<T>(handle,
+                                                    M,
+                                                    descrA,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    descrB,
+                                                    slice_size,
+                                                    dsell_slice_ptr,
+                                                    dsell_perm,
+                                                    dsell_val,
+                                                    dsell_col_ind));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hsell_slice_ptr(nslices + 1);
+        host_vector<rocsparse_int> hsell_perm(M);
+        host_vector<rocsparse_int> hsell_col_ind(hsell_nnz_1);
+        host_vector<T>             hsell_val(hsell_nnz_1);
+
+        CHECK_HIP_ERROR(hipMemcpy(hsell_slice_ptr,
+                                  dsell_slice_ptr,
+                                  sizeof(rocsparse_int) * (nslices + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hsell_perm, dsell_perm, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hsell_col_ind,
+                                  dsell_col_ind,
+                                  sizeof(rocsparse_int) * hsell_nnz_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hsell_val, dsell_val, sizeof(T) * hsell_nnz_1, hipMemcpyDeviceToHost));
+
+        // CPU csr2sell
+        rocsparse_int hsell_nnz_gold;
+        host_csr_to_sell<T>(M,
+                            hcsr_row_ptr,
+                            hcsr_col_ind,
+                            hcsr_val,
+                            slice_size,
+                            sigma,
+                            hsell_slice_ptr_gold,
+                            hsell_perm_gold,
+                            hsell_col_ind_gold,
+                            hsell_val_gold,
+                            hsell_nnz_gold,
+                            baseA,
+                            baseB);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &hsell_nnz_gold, &hsell_nnz_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, &hsell_nnz_gold, &hsell_nnz_2);
+        unit_check_general<rocsparse_int>(
+            1, nslices + 1, 1, hsell_slice_ptr_gold, hsell_slice_ptr);
+        unit_check_general<rocsparse_int>(1, M, 1, hsell_perm_gold, hsell_perm);
+        unit_check_general<rocsparse_int>(1, hsell_nnz_1, 1, hsell_col_ind_gold, hsell_col_ind);
+        unit_check_general<T>(1, hsell_nnz_1, 1, hsell_val_gold, hsell_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int sell_nnz;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                         M,
+                                                         descrA,
+                                                         dcsr_row_ptr,
+                                                         descrB,
+                                                         slice_size,
+                                                         sigma,
+                                                         dsell_slice_ptr,
+                                                         dsell_perm,
+                                                         &sell_nnz,
+                                                         dbuffer));
+
+            device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+            device_vector<T>             dsell_val(sell_nnz);
+
+            if(!dsell_col_ind || !dsell_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell<T>(handle,
+                                                        M,
+                                                        descrA,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        descrB,
+                                                        slice_size,
+                                                        dsell_slice_ptr,
+                                                        dsell_perm,
+                                                        dsell_val,
+                                                        dsell_col_ind));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell_nnz(handle,
+                                                         M,
+                                                         descrA,
+                                                         dcsr_row_ptr,
+                                                         descrB,
+                                                         slice_size,
+                                                         sigma,
+                                                         dsell_slice_ptr,
+                                                         dsell_perm,
+                                                         &sell_nnz,
+                                                         dbuffer));
+
+            device_vector<rocsparse_int> dsell_col_ind(sell_nnz);
+            device_vector<T>             dsell_val(sell_nnz);
+
+            if(!dsell_col_ind || !dsell_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2sell<T>(handle,
+                                                        M,
+                                                        descrA,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        descrB,
+                                                        slice_size,
+                                                        dsell_slice_ptr,
+                                                        dsell_perm,
+                                                        dsell_val,
+                                                        dsell_col_ind));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csr2sell_gbyte_count<T>(M, nnz, sell_nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "C"
+                  << std::setw(12) << "sigma" << std::setw(12) << "SELL nnz" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << slice_size
+                  << std::setw(12) << sigma << std::setw(12) << sell_nnz << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csr2sell_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csr2sell<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
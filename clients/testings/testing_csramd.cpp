@@ -0,0 +1,352 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csramd.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+// Off-diagonal adjacency of the symmetric sparsity pattern
+template <typename T>
+static void host_csramd_adjacency(const host_csr_matrix<T>&                hA,
+                                  std::vector<std::vector<rocsparse_int>>& adj)
+{
+    adj.resize(hA.m);
+
+    for(rocsparse_int i = 0; i < hA.m; ++i)
+    {
+        for(rocsparse_int j = hA.ptr[i] - hA.base; j < hA.ptr[i + 1] - hA.base; ++j)
+        {
+            if(hA.ind[j] - hA.base != i)
+            {
+                adj[i].push_back(hA.ind[j] - hA.base);
+            }
+        }
+    }
+}
+
+// Reference minimum degree ordering with exact degrees on the elimination graph. The
+// neighbours of each pivot are connected to a clique before the pivot is removed. Ties
+// are broken by the smaller index.
+static void host_minimum_degree(rocsparse_int                           m,
+                                std::vector<std::vector<rocsparse_int>> adj,
+                                std::vector<rocsparse_int>&             perm)
+{
+    std::vector<int>           eliminated(m, 0);
+    std::vector<rocsparse_int> mark(m, -1);
+
+    for(rocsparse_int k = 0; k < m; ++k)
+    {
+        rocsparse_int p = -1;
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            if(!eliminated[i] && (p == -1 || adj[i].size() < adj[p].size()))
+            {
+                p = i;
+            }
+        }
+
+        perm[k]       = p;
+        eliminated[p] = 1;
+
+        for(rocsparse_int i : adj[p])
+        {
+            std::vector<rocsparse_int> merged;
+
+            for(rocsparse_int j : adj[i])
+            {
+                if(j != p)
+                {
+                    mark[j] = i;
+                    merged.push_back(j);
+                }
+            }
+
+            for(rocsparse_int j : adj[p])
+            {
+                if(j != i && mark[j] != i)
+                {
+                    merged.push_back(j);
+                }
+            }
+
+            adj[i].swap(merged);
+        }
+
+        std::vector<rocsparse_int>().swap(adj[p]);
+    }
+}
+
+// Number of non-zero entries of the Cholesky factor L of the reordered pattern. Each row
+// of L is the row subtree of the elimination tree, that is reached from the entries of
+// the corresponding row of the reordered pattern.
+static int64_t host_cholesky_fill(rocsparse_int                                  m,
+                                  const std::vector<std::vector<rocsparse_int>>& adj,
+                                  const rocsparse_int*                           perm)
+{
+    std::vector<rocsparse_int> iperm(m);
+    std::vector<rocsparse_int> parent(m, -1);
+    std::vector<rocsparse_int> ancestor(m, -1);
+    std::vector<rocsparse_int> mark(m, -1);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        iperm[perm[i]] = i;
+    }
+
+    // Elimination tree with path compression
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j : adj[perm[i]])
+        {
+            rocsparse_int k = iperm[j];
+
+            while(k != -1 && k < i)
+            {
+                rocsparse_int next = ancestor[k];
+                ancestor[k]        = i;
+
+                if(next == -1)
+                {
+                    parent[k] = i;
+                }
+
+                k = next;
+            }
+        }
+    }
+
+    int64_t nnz = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        mark[i] = i;
+        ++nnz;
+
+        for(rocsparse_int j : adj[perm[i]])
+        {
+            for(rocsparse_int k = iperm[j]; k < i && mark[k] != i; k = parent[k])
+            {
+                mark[k] = i;
+                ++nnz;
+            }
+        }
+    }
+
+    return nnz;
+}
+
+template <typename T>
+void testing_csramd_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int*            perm        = (rocsparse_int*)0x4;
+
+#define PARAMS handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm
+
+    auto_testing_bad_arg(rocsparse_csramd, PARAMS);
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csramd(PARAMS), rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csramd(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csramd(handle, M, 0, descr, nullptr, nullptr, nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR matrix with symmetric sparsity pattern
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    M = hA.m;
+
+    // Allocate device memory and transfer data from host
+    device_csr_matrix<T>               dA(hA);
+    device_dense_vector<rocsparse_int> dperm(M);
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csramd(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm));
+
+        host_dense_vector<rocsparse_int> hperm(dperm);
+
+        // Check that perm is a permutation
+        host_dense_vector<rocsparse_int> cache(M);
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            cache[i] = 0;
+        }
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            EXPECT_ROCSPARSE_STATUS((hperm[i] >= 0 && hperm[i] < M)
+                                        ? rocsparse_status_success
+                                        : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+
+            cache[hperm[i]] = 1;
+        }
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            EXPECT_ROCSPARSE_STATUS((cache[i] != 0) ? rocsparse_status_success
+                                                    : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+        }
+
+        // The first pivot is the node of minimum degree with the smallest index
+        rocsparse_int pivot     = -1;
+        rocsparse_int pivot_deg = M;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int deg = 0;
+            for(rocsparse_int j = hA.ptr[i] - base; j < hA.ptr[i + 1] - base; ++j)
+            {
+                deg += (hA.ind[j] - base != i);
+            }
+
+            if(deg < pivot_deg)
+            {
+                pivot     = i;
+                pivot_deg = deg;
+            }
+        }
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &pivot, hperm);
+
+        // The fill of the factor of the reordered matrix has to be close to the fill
+        // of an exact minimum degree ordering. The reference is skipped for large
+        // matrices, since its cost grows with the fill.
+        static constexpr rocsparse_int reference_max_m = 4096;
+
+        if(M <= reference_max_m)
+        {
+            std::vector<std::vector<rocsparse_int>> adj;
+            host_csramd_adjacency(hA, adj);
+
+            std::vector<rocsparse_int> hperm_gold(M);
+            host_minimum_degree(M, adj, hperm_gold);
+
+            int64_t fill      = host_cholesky_fill(M, adj, hperm);
+            int64_t fill_gold = host_cholesky_fill(M, adj, hperm_gold.data());
+
+            // Approximate degrees may lead to slightly more fill
+            EXPECT_ROCSPARSE_STATUS((fill <= fill_gold + fill_gold / 10)
+                                        ? rocsparse_status_success
+                                        : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csramd(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csramd(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_csramd_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csramd<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
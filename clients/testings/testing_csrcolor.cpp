@@ -90,6 +90,30 @@ void testing_csrcolor_bad_arg(const Arguments& arg)
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
 
 #undef PARAMS
+
+    //
+    // Coloring options.
+    //
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_options(nullptr, info, rocsparse_color_alg_jpl, 0),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_options(handle, nullptr, rocsparse_color_alg_jpl, 0),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_options(handle, info, (rocsparse_color_alg)-1, 0),
+                            rocsparse_status_invalid_value);
+
+    //
+    // Color offsets, no coloring has been computed yet.
+    //
+    rocsparse_int* color_ptr = (rocsparse_int*)0x4;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_color_ptr(nullptr, info, color_ptr),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_color_ptr(handle, nullptr, color_ptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_color_ptr(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_color_ptr(handle, info, color_ptr),
+                            rocsparse_status_invalid_pointer);
 }
 
 template <typename T>
@@ -115,6 +139,10 @@ void testing_csrcolor(const Arguments& arg)
     rocsparse_local_mat_info  mat_info;
     rocsparse_set_mat_index_base(csr_descr, csr_base);
 
+    const bool distance2 = (arg.color_alg == rocsparse_color_alg_jpl_distance2);
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrcolor_options(handle, mat_info, arg.color_alg, arg.colorbalance));
+
     rocsparse_int ncolor;
 
     //
@@ -192,6 +220,7 @@ void testing_csrcolor(const Arguments& arg)
 
         //
         // CHECK CONSISTENCY: CHECK ANY COLOR NOT BEING SHARED BY TWO ADJACENT NODES.
+        // For a distance-2 coloring, also nodes with a common neighbor must not share a color.
         //
         for(rocsparse_int i = 0; i < M; ++i)
         {
@@ -205,6 +234,19 @@ void testing_csrcolor(const Arguments& arg)
                     EXPECT_ROCSPARSE_STATUS((icolor != jcolor) ? rocsparse_status_success
                                                                : rocsparse_status_internal_error,
                                             rocsparse_status_success);
+
+                    if(distance2)
+                    {
+                        for(rocsparse_int k = hA.ptr[j] - hA.base; k < hA.ptr[j + 1] - hA.base;
+                            ++k)
+                        {
+                            auto l = hA.ind[k] - hA.base;
+                            EXPECT_ROCSPARSE_STATUS((l == i || icolor != hcoloring[l])
+                                                        ? rocsparse_status_success
+                                                        : rocsparse_status_internal_error,
+                                                    rocsparse_status_success);
+                        }
+                    }
                 }
             }
         }
@@ -292,6 +334,74 @@ void testing_csrcolor(const Arguments& arg)
                                                         : rocsparse_status_internal_error,
                                         rocsparse_status_success);
             }
+
+            //
+            // Verify the color offsets, the nodes of color c are
+            // hreordering[hcolor_ptr[c]] to hreordering[hcolor_ptr[c + 1] - 1].
+            //
+            device_dense_vector<rocsparse_int> dcolor_ptr(ncolor + 1);
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_color_ptr(handle, mat_info, dcolor_ptr));
+            host_dense_vector<rocsparse_int> hcolor_ptr(dcolor_ptr);
+
+            EXPECT_ROCSPARSE_STATUS((hcolor_ptr[0] == 0 && hcolor_ptr[ncolor] == M)
+                                        ? rocsparse_status_success
+                                        : rocsparse_status_internal_error,
+                                    rocsparse_status_success);
+
+            rocsparse_int max_color_size = 0;
+            for(rocsparse_int c = 0; c < ncolor; ++c)
+            {
+                for(rocsparse_int i = hcolor_ptr[c]; i < hcolor_ptr[c + 1]; ++i)
+                {
+                    EXPECT_ROCSPARSE_STATUS((hcoloring[hreordering[i]] == c)
+                                                ? rocsparse_status_success
+                                                : rocsparse_status_internal_error,
+                                            rocsparse_status_success);
+                }
+
+                max_color_size = std::max(max_color_size, hcolor_ptr[c + 1] - hcolor_ptr[c]);
+            }
+
+            //
+            // Balancing must not increase the size of the largest color.
+            //
+            if(arg.colorbalance)
+            {
+                rocsparse_local_mat_info ref_info;
+                rocsparse_int            ref_ncolor;
+
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_csrcolor_options(handle, ref_info, arg.color_alg, 0));
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                            dA.m,
+                                                            dA.nnz,
+                                                            csr_descr,
+                                                            dA.val,
+                                                            dA.ptr,
+                                                            dA.ind,
+                                                            &fraction_to_color,
+                                                            &ref_ncolor,
+                                                            dcoloring,
+                                                            nullptr,
+                                                            ref_info));
+
+                unit_check_general<rocsparse_int>(1, 1, 1, &ref_ncolor, &ncolor);
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_color_ptr(handle, ref_info, dcolor_ptr));
+                host_dense_vector<rocsparse_int> href_color_ptr(dcolor_ptr);
+
+                rocsparse_int ref_max_color_size = 0;
+                for(rocsparse_int c = 0; c < ncolor; ++c)
+                {
+                    ref_max_color_size = std::max(ref_max_color_size,
+                                                  href_color_ptr[c + 1] - href_color_ptr[c]);
+                }
+
+                EXPECT_ROCSPARSE_STATUS((max_color_size <= ref_max_color_size)
+                                            ? rocsparse_status_success
+                                            : rocsparse_status_internal_error,
+                                        rocsparse_status_success);
+            }
         }
     }
 
@@ -0,0 +1,345 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csrcolor_permute.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <algorithm>
+
+// Group rows and columns of A by color, rows of the same color keep their relative order
+template <typename T>
+static void host_csrcolor_permute(const host_csr_matrix<T>&               A,
+                                  rocsparse_int                           ncolors,
+                                  const host_dense_vector<rocsparse_int>& coloring,
+                                  host_vector<rocsparse_int>&             perm,
+                                  host_vector<rocsparse_int>&             color_ptr,
+                                  host_csr_matrix<T>&                     A_mc)
+{
+    rocsparse_int        M    = A.m;
+    rocsparse_index_base base = A.base;
+
+    // Color offsets
+    std::fill(color_ptr.begin(), color_ptr.end(), 0);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ++color_ptr[coloring[i] + 1];
+    }
+
+    for(rocsparse_int c = 0; c < ncolors; ++c)
+    {
+        color_ptr[c + 1] += color_ptr[c];
+    }
+
+    // Permutation and its inverse
+    host_vector<rocsparse_int> offset(color_ptr);
+    host_vector<rocsparse_int> iperm(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row = offset[coloring[i]]++;
+
+        perm[row] = i;
+        iperm[i]  = row;
+    }
+
+    // Permuted matrix with sorted columns
+    A_mc.ptr[0] = base;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row       = perm[i];
+        rocsparse_int row_begin = A.ptr[row] - base;
+        rocsparse_int row_end   = A.ptr[row + 1] - base;
+
+        std::vector<std::pair<rocsparse_int, T>> entries;
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            entries.push_back(std::make_pair(iperm[A.ind[j] - base] + base, A.val[j]));
+        }
+
+        std::stable_sort(entries.begin(),
+                         entries.end(),
+                         [](const std::pair<rocsparse_int, T>& a,
+                            const std::pair<rocsparse_int, T>& b) { return a.first < b.first; });
+
+        rocsparse_int offset_mc = A_mc.ptr[i] - base;
+        for(size_t j = 0; j < entries.size(); ++j)
+        {
+            A_mc.ind[offset_mc + j] = entries[j].first;
+            A_mc.val[offset_mc + j] = entries[j].second;
+        }
+
+        A_mc.ptr[i + 1] = A_mc.ptr[i] + (row_end - row_begin);
+    }
+}
+
+template <typename T>
+void testing_csrcolor_permute_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle         = local_handle;
+    rocsparse_int             m              = safe_size;
+    rocsparse_int             nnz            = safe_size;
+    const rocsparse_mat_descr descr          = local_descr;
+    const T*                  csr_val        = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr    = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind    = (const rocsparse_int*)0x4;
+    rocsparse_int             ncolors        = safe_size;
+    const rocsparse_int*      coloring       = (const rocsparse_int*)0x4;
+    rocsparse_int*            perm           = (rocsparse_int*)0x4;
+    rocsparse_int*            color_ptr      = (rocsparse_int*)0x4;
+    T*                        csr_val_mc     = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_mc = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_mc = (rocsparse_int*)0x4;
+    size_t*                   buffer_size    = (size_t*)0x4;
+    void*                     temp_buffer    = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_row_ptr, csr_col_ind, ncolors, buffer_size
+#define PARAMS                                                                                   \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, ncolors, coloring, perm, color_ptr, \
+        csr_val_mc, csr_row_ptr_mc, csr_col_ind_mc, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrcolor_permute_buffer_size, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrcolor_permute<T>, PARAMS);
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_permute<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csrcolor_permute(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int            M                 = arg.M;
+    rocsparse_index_base     base              = arg.baseA;
+    const floating_data_t<T> fraction_to_color = static_cast<floating_data_t<T>>(arg.percentage);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrcolor_permute_buffer_size(
+                handle, M, 0, descr, (const rocsparse_int*)0x4, nullptr, 0, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor_permute<T>(handle,
+                                                              M,
+                                                              0,
+                                                              descr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr,
+                                                              nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR matrix with symmetric sparsity pattern
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    M = hA.m;
+
+    // Allocate device memory and transfer data from host
+    device_csr_matrix<T>               dA(hA);
+    device_csr_matrix<T>               dA_mc(M, M, hA.nnz, base);
+    device_dense_vector<rocsparse_int> dcoloring(M);
+    device_dense_vector<rocsparse_int> dperm(M);
+
+    // Coloring
+    rocsparse_int ncolors;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                dA.m,
+                                                dA.nnz,
+                                                descr,
+                                                dA.val,
+                                                dA.ptr,
+                                                dA.ind,
+                                                &fraction_to_color,
+                                                &ncolors,
+                                                dcoloring,
+                                                nullptr,
+                                                info));
+
+    device_dense_vector<rocsparse_int> dcolor_ptr(ncolors + 1);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_permute_buffer_size(
+        handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, ncolors, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_permute<T>(handle,
+                                                            dA.m,
+                                                            dA.nnz,
+                                                            descr,
+                                                            dA.val,
+                                                            dA.ptr,
+                                                            dA.ind,
+                                                            ncolors,
+                                                            dcoloring,
+                                                            dperm,
+                                                            dcolor_ptr,
+                                                            dA_mc.val,
+                                                            dA_mc.ptr,
+                                                            dA_mc.ind,
+                                                            dbuffer));
+
+        // CPU color permutation
+        host_dense_vector<rocsparse_int> hcoloring(dcoloring);
+        host_vector<rocsparse_int>       hperm_gold(M);
+        host_vector<rocsparse_int>       hcolor_ptr_gold(ncolors + 1);
+        host_csr_matrix<T>               hA_mc_gold(M, M, hA.nnz, base);
+
+        host_csrcolor_permute(hA, ncolors, hcoloring, hperm_gold, hcolor_ptr_gold, hA_mc_gold);
+
+        host_dense_vector<rocsparse_int> hperm(dperm);
+        host_dense_vector<rocsparse_int> hcolor_ptr(dcolor_ptr);
+
+        unit_check_general<rocsparse_int>(1, M, 1, hperm_gold, hperm);
+        unit_check_general<rocsparse_int>(1, ncolors + 1, 1, hcolor_ptr_gold, hcolor_ptr);
+        hA_mc_gold.unit_check(dA_mc);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_permute<T>(handle,
+                                                                dA.m,
+                                                                dA.nnz,
+                                                                descr,
+                                                                dA.val,
+                                                                dA.ptr,
+                                                                dA.ind,
+                                                                ncolors,
+                                                                dcoloring,
+                                                                dperm,
+                                                                dcolor_ptr,
+                                                                dA_mc.val,
+                                                                dA_mc.ptr,
+                                                                dA_mc.ind,
+                                                                dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_permute<T>(handle,
+                                                                dA.m,
+                                                                dA.nnz,
+                                                                descr,
+                                                                dA.val,
+                                                                dA.ptr,
+                                                                dA.ind,
+                                                                ncolors,
+                                                                dcoloring,
+                                                                dperm,
+                                                                dcolor_ptr,
+                                                                dA_mc.val,
+                                                                dA_mc.ptr,
+                                                                dA_mc.ind,
+                                                                dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "ncolors",
+                            ncolors,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                       \
+    template void testing_csrcolor_permute_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrcolor_permute<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,820 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csriluk.hpp"
+
+#include <map>
+
+// Level of fill sparsity pattern of the incomplete LU factorization
+static void host_csriluk_pattern(rocsparse_int                     M,
+                                 const std::vector<rocsparse_int>& csr_row_ptr,
+                                 const std::vector<rocsparse_int>& csr_col_ind,
+                                 rocsparse_index_base              base,
+                                 rocsparse_int                     level_of_fill,
+                                 std::vector<rocsparse_int>&       csr_row_ptr_lu,
+                                 std::vector<rocsparse_int>&       csr_col_ind_lu)
+{
+    // Levels of the strictly upper part of each row
+    std::vector<std::map<rocsparse_int, rocsparse_int>> upper(M);
+
+    csr_row_ptr_lu.resize(M + 1);
+    csr_col_ind_lu.clear();
+
+    csr_row_ptr_lu[0] = base;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        std::map<rocsparse_int, rocsparse_int> row;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            row[csr_col_ind[j] - base] = 0;
+        }
+
+        // Diagonal entry is always part of the pattern
+        row[i] = 0;
+
+        // Eliminate with all previous rows in ascending order, fill-in entries
+        // inserted left of the diagonal are picked up by the iterator
+        for(auto it = row.begin(); it->first < i; ++it)
+        {
+            rocsparse_int k     = it->first;
+            rocsparse_int lev_k = it->second;
+
+            for(auto& u : upper[k])
+            {
+                rocsparse_int lev = lev_k + u.second + 1;
+
+                if(lev > level_of_fill)
+                {
+                    continue;
+                }
+
+                auto found = row.find(u.first);
+
+                if(found == row.end())
+                {
+                    row[u.first] = lev;
+                }
+                else
+                {
+                    found->second = std::min(found->second, lev);
+                }
+            }
+        }
+
+        for(auto& entry : row)
+        {
+            csr_col_ind_lu.push_back(entry.first + base);
+
+            if(entry.first > i)
+            {
+                upper[i][entry.first] = entry.second;
+            }
+        }
+
+        csr_row_ptr_lu[i + 1] = static_cast<rocsparse_int>(csr_col_ind_lu.size()) + base;
+    }
+}
+
+// Copy the values of A into the sparsity pattern of LU, fill-in entries are zero
+template <typename T>
+static void host_csriluk_scatter(rocsparse_int                     M,
+                                 const std::vector<rocsparse_int>& csr_row_ptr,
+                                 const std::vector<rocsparse_int>& csr_col_ind,
+                                 const std::vector<T>&             csr_val,
+                                 const std::vector<rocsparse_int>& csr_row_ptr_lu,
+                                 const std::vector<rocsparse_int>& csr_col_ind_lu,
+                                 std::vector<T>&                   csr_val_lu,
+                                 rocsparse_index_base              base)
+{
+    csr_val_lu.assign(csr_col_ind_lu.size(), static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int k = csr_row_ptr_lu[i] - base;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            while(csr_col_ind_lu[k] != csr_col_ind[j])
+            {
+                ++k;
+            }
+
+            csr_val_lu[k] = csr_val[j];
+        }
+    }
+}
+
+template <typename T>
+void testing_csriluk_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_lu(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_lu(safe_size);
+    device_vector<T>             dcsr_val_lu(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_row_ptr_lu || !dcsr_col_ind_lu
+       || !dcsr_val_lu || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csriluk_nnz()
+    rocsparse_int nnz_lu;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(nullptr,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  1,
+                                                  dcsr_row_ptr_lu,
+                                                  &nnz_lu),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  nullptr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  1,
+                                                  dcsr_row_ptr_lu,
+                                                  &nnz_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  nullptr,
+                                                  dcsr_col_ind,
+                                                  1,
+                                                  dcsr_row_ptr_lu,
+                                                  &nnz_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  nullptr,
+                                                  1,
+                                                  dcsr_row_ptr_lu,
+                                                  &nnz_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  -1,
+                                                  dcsr_row_ptr_lu,
+                                                  &nnz_lu),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  1,
+                                                  nullptr,
+                                                  &nnz_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  safe_size,
+                                                  safe_size,
+                                                  descr,
+                                                  dcsr_row_ptr,
+                                                  dcsr_col_ind,
+                                                  1,
+                                                  dcsr_row_ptr_lu,
+                                                  nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csriluk_symbolic()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(nullptr,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       1,
+                                                       dcsr_col_ind_lu),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       nullptr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       1,
+                                                       dcsr_col_ind_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       nullptr,
+                                                       dcsr_col_ind,
+                                                       1,
+                                                       dcsr_col_ind_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       nullptr,
+                                                       1,
+                                                       dcsr_col_ind_lu),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       -1,
+                                                       dcsr_col_ind_lu),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                       safe_size,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       1,
+                                                       nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csriluk()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(nullptr,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 nullptr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 nullptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 nullptr,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 nullptr,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 nullptr,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csriluk(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    rocsparse_analysis_policy apol          = arg.apol;
+    rocsparse_solve_policy    spol          = arg.spol;
+    rocsparse_int             level_of_fill = arg.level_of_fill;
+    rocsparse_index_base      base          = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       nnz_lu;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_lu(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_lu(safe_size);
+        device_vector<T>             dcsr_val_lu(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_row_ptr_lu || !dcsr_col_ind_lu
+           || !dcsr_val_lu || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                      M,
+                                                      safe_size,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      level_of_fill,
+                                                      dcsr_row_ptr_lu,
+                                                      &nnz_lu),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                           M,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           level_of_fill,
+                                                           dcsr_col_ind_lu),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     safe_size,
+                                                     dcsr_val_lu,
+                                                     dcsr_row_ptr_lu,
+                                                     dcsr_col_ind_lu,
+                                                     info,
+                                                     spol,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcsr_row_ptr_lu(M + 1);
+    device_vector<rocsparse_int> dnnz_lu(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_row_ptr_lu || !dnnz_lu)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain the number of non-zero entries of LU, pointer mode host
+    rocsparse_int nnz_lu;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                M,
+                                                nnz,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                level_of_fill,
+                                                dcsr_row_ptr_lu,
+                                                &nnz_lu));
+
+    // Allocate device memory for LU
+    device_vector<rocsparse_int> dcsr_col_ind_lu(nnz_lu);
+    device_vector<T>             dcsr_val_lu(nnz_lu);
+
+    if(!dcsr_col_ind_lu || !dcsr_val_lu)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, dcsr_col_ind_lu));
+
+    // Obtain required buffer size and analysis meta data of LU
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(handle,
+                                                           M,
+                                                           nnz_lu,
+                                                           descr,
+                                                           dcsr_val_lu,
+                                                           dcsr_row_ptr_lu,
+                                                           dcsr_col_ind_lu,
+                                                           info,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        M,
+                                                        nnz_lu,
+                                                        descr,
+                                                        dcsr_val_lu,
+                                                        dcsr_row_ptr_lu,
+                                                        dcsr_col_ind_lu,
+                                                        info,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode device
+        rocsparse_int hnnz_lu_2;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                    M,
+                                                    nnz,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    level_of_fill,
+                                                    dcsr_row_ptr_lu,
+                                                    dnnz_lu));
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_lu_2, dnnz_lu, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Numerical factorization
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   nnz_lu,
+                                                   dcsr_val_lu,
+                                                   dcsr_row_ptr_lu,
+                                                   dcsr_col_ind_lu,
+                                                   info,
+                                                   spol,
+                                                   dbuffer));
+
+        rocsparse_int h_solve_pivot_1;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, &h_solve_pivot_1),
+                                (h_solve_pivot_1 != -1) ? rocsparse_status_zero_pivot
+                                                        : rocsparse_status_success);
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_lu(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind_lu(nnz_lu);
+        host_vector<T>             hcsr_val_lu(nnz_lu);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_lu,
+                                  dcsr_row_ptr_lu,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_lu,
+                                  dcsr_col_ind_lu,
+                                  sizeof(rocsparse_int) * nnz_lu,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_lu, dcsr_val_lu, sizeof(T) * nnz_lu, hipMemcpyDeviceToHost));
+
+        // CPU level of fill pattern
+        host_vector<rocsparse_int> hcsr_row_ptr_lu_gold;
+        host_vector<rocsparse_int> hcsr_col_ind_lu_gold;
+        host_vector<T>             hcsr_val_lu_gold;
+
+        host_csriluk_pattern(M,
+                             hcsr_row_ptr,
+                             hcsr_col_ind,
+                             base,
+                             level_of_fill,
+                             hcsr_row_ptr_lu_gold,
+                             hcsr_col_ind_lu_gold);
+
+        rocsparse_int nnz_lu_gold = hcsr_row_ptr_lu_gold[M] - base;
+
+        // Check pattern
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_lu_gold, &nnz_lu);
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_lu_gold, &hnnz_lu_2);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_lu_gold, hcsr_row_ptr_lu);
+        unit_check_general<rocsparse_int>(1, nnz_lu, 1, hcsr_col_ind_lu_gold, hcsr_col_ind_lu);
+
+        // CPU csrilu0 on the level of fill pattern
+        rocsparse_int h_analysis_pivot_gold;
+        rocsparse_int h_solve_pivot_gold;
+
+        host_csriluk_scatter(M,
+                             hcsr_row_ptr,
+                             hcsr_col_ind,
+                             hcsr_val,
+                             hcsr_row_ptr_lu_gold,
+                             hcsr_col_ind_lu_gold,
+                             hcsr_val_lu_gold,
+                             base);
+        host_csrilu0<T>(M,
+                        hcsr_row_ptr_lu_gold,
+                        hcsr_col_ind_lu_gold,
+                        hcsr_val_lu_gold,
+                        base,
+                        &h_analysis_pivot_gold,
+                        &h_solve_pivot_gold,
+                        false,
+                        static_cast<floating_data_t<T>>(0),
+                        static_cast<T>(0));
+
+        // Check pivot
+        unit_check_general<rocsparse_int>(1, 1, 1, &h_solve_pivot_gold, &h_solve_pivot_1);
+
+        // Check solution if no pivot has been found
+        if(h_analysis_pivot_gold == -1 && h_solve_pivot_gold == -1)
+        {
+            near_check_general<T>(1, nnz_lu, 1, hcsr_val_lu_gold, hcsr_val_lu);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nnz_lu,
+                                                       dcsr_val_lu,
+                                                       dcsr_row_ptr_lu,
+                                                       dcsr_col_ind_lu,
+                                                       info,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        double gpu_symbolic_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                    M,
+                                                    nnz,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    level_of_fill,
+                                                    dcsr_row_ptr_lu,
+                                                    &nnz_lu));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+            handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, dcsr_col_ind_lu));
+
+        gpu_symbolic_time_used = get_time_us() - gpu_symbolic_time_used;
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nnz_lu,
+                                                       dcsr_val_lu,
+                                                       dcsr_row_ptr_lu,
+                                                       dcsr_col_ind_lu,
+                                                       info,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrilu0_gbyte_count<T>(M, nnz_lu) / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nnz_lu"
+                  << std::setw(12) << "levelfill" << std::setw(16) << "solve policy"
+                  << std::setw(12) << "GB/s" << std::setw(16) << "symbolic msec" << std::setw(16)
+                  << "solve msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz_lu
+                  << std::setw(12) << level_of_fill << std::setw(16)
+                  << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
+                  << gpu_symbolic_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear csrilu0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csriluk_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csriluk<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
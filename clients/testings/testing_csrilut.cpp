@@ -0,0 +1,1074 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csrilut.hpp"
+
+#include <algorithm>
+
+// Copy the values of A into the sparsity pattern of LU, fill-in entries are zero
+template <typename T>
+static void host_csrilut_scatter(rocsparse_int                     M,
+                                 const std::vector<rocsparse_int>& csr_row_ptr,
+                                 const std::vector<rocsparse_int>& csr_col_ind,
+                                 const std::vector<T>&             csr_val,
+                                 const std::vector<rocsparse_int>& csr_row_ptr_lu,
+                                 const std::vector<rocsparse_int>& csr_col_ind_lu,
+                                 std::vector<T>&                   csr_val_lu,
+                                 rocsparse_index_base              base)
+{
+    csr_val_lu.assign(csr_col_ind_lu.size(), static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int k = csr_row_ptr_lu[i] - base;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            while(csr_col_ind_lu[k] != csr_col_ind[j])
+            {
+                ++k;
+            }
+
+            csr_val_lu[k] = csr_val[j];
+        }
+    }
+}
+
+// Keep the entries in [begin, end) that are not below tau and, among those, at most
+// max_fill entries of largest magnitude. Ties are broken by position.
+template <typename T, typename U>
+static void host_csrilut_drop(
+    rocsparse_int begin, rocsparse_int end, std::vector<T>& csr_val, U tau, rocsparse_int max_fill)
+{
+    std::vector<rocsparse_int> perm(end - begin);
+    for(rocsparse_int j = 0; j < end - begin; ++j)
+    {
+        perm[j] = begin + j;
+    }
+
+    std::stable_sort(perm.begin(), perm.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return std::abs(csr_val[a]) > std::abs(csr_val[b]);
+    });
+
+    for(rocsparse_int j = 0; j < end - begin; ++j)
+    {
+        if(j >= max_fill || std::abs(csr_val[perm[j]]) < tau)
+        {
+            csr_val[perm[j]] = static_cast<T>(0);
+        }
+    }
+}
+
+// Incomplete LU factorization with dual threshold dropping on a given sparsity pattern
+template <typename T>
+static void host_csrilut(rocsparse_int                     M,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         std::vector<T>&                   csr_val,
+                         rocsparse_index_base              base,
+                         floating_data_t<T>                drop_tol,
+                         rocsparse_int                     max_fill,
+                         rocsparse_int*                    numeric_pivot)
+{
+    *numeric_pivot = -1;
+
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            if(csr_col_ind[j] - base == i)
+            {
+                diag_offset[i] = j;
+                break;
+            }
+        }
+
+        // Drop tolerance relative to the 2-norm of the current row
+        floating_data_t<T> norm = static_cast<floating_data_t<T>>(0);
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            norm += std::abs(csr_val[j]) * std::abs(csr_val[j]);
+        }
+
+        floating_data_t<T> tau = drop_tol * std::sqrt(norm);
+
+        for(rocsparse_int j = row_begin; j < diag_offset[i]; ++j)
+        {
+            rocsparse_int col_j  = csr_col_ind[j] - base;
+            rocsparse_int diag_j = diag_offset[col_j];
+
+            T diag_val = csr_val[diag_j];
+
+            // Check for numeric pivot
+            if(diag_val == static_cast<T>(0))
+            {
+                *numeric_pivot = col_j + base;
+                return;
+            }
+
+            T local_val = csr_val[j] / diag_val;
+
+            // Drop small multipliers
+            if(std::abs(local_val) < tau)
+            {
+                csr_val[j] = static_cast<T>(0);
+                continue;
+            }
+
+            csr_val[j] = local_val;
+
+            // Linear combination with the upper part of row col_j
+            rocsparse_int l = j + 1;
+            for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base; ++k)
+            {
+                while(l < row_end && csr_col_ind[l] < csr_col_ind[k])
+                {
+                    ++l;
+                }
+
+                if(l < row_end && csr_col_ind[l] == csr_col_ind[k])
+                {
+                    csr_val[l] = std::fma(-local_val, csr_val[k], csr_val[l]);
+                }
+            }
+        }
+
+        // Dual threshold dropping of the strictly lower and strictly upper part
+        host_csrilut_drop(row_begin, diag_offset[i], csr_val, tau, max_fill);
+        host_csrilut_drop(diag_offset[i] + 1, row_end, csr_val, tau, max_fill);
+    }
+}
+
+// Remove the explicit zeros of LU
+template <typename T>
+static void host_csrilut_compress(rocsparse_int                     M,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  const std::vector<T>&             csr_val,
+                                  std::vector<rocsparse_int>&       csr_row_ptr_c,
+                                  std::vector<rocsparse_int>&       csr_col_ind_c,
+                                  std::vector<T>&                   csr_val_c,
+                                  rocsparse_index_base              base)
+{
+    csr_row_ptr_c.resize(M + 1);
+    csr_col_ind_c.clear();
+    csr_val_c.clear();
+
+    csr_row_ptr_c[0] = base;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_val[j] != static_cast<T>(0))
+            {
+                csr_col_ind_c.push_back(csr_col_ind[j]);
+                csr_val_c.push_back(csr_val[j]);
+            }
+        }
+
+        csr_row_ptr_c[i + 1] = csr_col_ind_c.size() + base;
+    }
+}
+
+template <typename T>
+void testing_csrilut_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    floating_data_t<T> drop_tol = static_cast<floating_data_t<T>>(0.01);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_lu(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_lu(safe_size);
+    device_vector<T>             dcsr_val_lu(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_row_ptr_lu || !dcsr_col_ind_lu
+       || !dcsr_val_lu || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrilut()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(nullptr,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 nullptr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 nullptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 nullptr,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 nullptr,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 nullptr,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 nullptr,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 nullptr,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 10,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descr,
+                                                 dcsr_val,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &drop_tol,
+                                                 -1,
+                                                 safe_size,
+                                                 dcsr_val_lu,
+                                                 dcsr_row_ptr_lu,
+                                                 dcsr_col_ind_lu,
+                                                 info,
+                                                 rocsparse_solve_policy_auto,
+                                                 dbuffer),
+                            rocsparse_status_invalid_value);
+
+    // Test rocsparse_csrilut_compress()
+    rocsparse_int nnz_lu_compressed;
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_compress<T>(nullptr,
+                                                          safe_size,
+                                                          descr,
+                                                          safe_size,
+                                                          dcsr_val_lu,
+                                                          dcsr_row_ptr_lu,
+                                                          dcsr_col_ind_lu,
+                                                          &nnz_lu_compressed,
+                                                          info,
+                                                          rocsparse_solve_policy_auto,
+                                                          dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_compress<T>(handle,
+                                                          safe_size,
+                                                          nullptr,
+                                                          safe_size,
+                                                          dcsr_val_lu,
+                                                          dcsr_row_ptr_lu,
+                                                          dcsr_col_ind_lu,
+                                                          &nnz_lu_compressed,
+                                                          info,
+                                                          rocsparse_solve_policy_auto,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_compress<T>(handle,
+                                                          safe_size,
+                                                          descr,
+                                                          safe_size,
+                                                          nullptr,
+                                                          dcsr_row_ptr_lu,
+                                                          dcsr_col_ind_lu,
+                                                          &nnz_lu_compressed,
+                                                          info,
+                                                          rocsparse_solve_policy_auto,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_compress<T>(handle,
+                                                          safe_size,
+                                                          descr,
+                                                          safe_size,
+                                                          dcsr_val_lu,
+                                                          dcsr_row_ptr_lu,
+                                                          dcsr_col_ind_lu,
+                                                          nullptr,
+                                                          info,
+                                                          rocsparse_solve_policy_auto,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_compress<T>(handle,
+                                                          safe_size,
+                                                          descr,
+                                                          safe_size,
+                                                          dcsr_val_lu,
+                                                          dcsr_row_ptr_lu,
+                                                          dcsr_col_ind_lu,
+                                                          &nnz_lu_compressed,
+                                                          nullptr,
+                                                          rocsparse_solve_policy_auto,
+                                                          dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_compress<T>(handle,
+                                                          safe_size,
+                                                          descr,
+                                                          safe_size,
+                                                          dcsr_val_lu,
+                                                          dcsr_row_ptr_lu,
+                                                          dcsr_col_ind_lu,
+                                                          &nnz_lu_compressed,
+                                                          info,
+                                                          rocsparse_solve_policy_auto,
+                                                          nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrilut(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    rocsparse_analysis_policy apol          = arg.apol;
+    rocsparse_solve_policy    spol          = arg.spol;
+    rocsparse_int             level_of_fill = arg.level_of_fill;
+    rocsparse_int             max_fill      = arg.max_fill;
+    rocsparse_index_base      base          = arg.baseA;
+
+    floating_data_t<T> h_drop_tol = arg.get_threshold<floating_data_t<T>>();
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_lu(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_lu(safe_size);
+        device_vector<T>             dcsr_val_lu(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_row_ptr_lu || !dcsr_col_ind_lu
+           || !dcsr_val_lu || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     &h_drop_tol,
+                                                     max_fill,
+                                                     safe_size,
+                                                     dcsr_val_lu,
+                                                     dcsr_row_ptr_lu,
+                                                     dcsr_col_ind_lu,
+                                                     info,
+                                                     spol,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int>      dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int>      dcsr_col_ind(nnz);
+    device_vector<T>                  dcsr_val(nnz);
+    device_vector<rocsparse_int>      dcsr_row_ptr_lu(M + 1);
+    device_vector<floating_data_t<T>> d_drop_tol(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_row_ptr_lu || !d_drop_tol)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Sparsity pattern of LU from the level of fill
+    rocsparse_int nnz_lu;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                M,
+                                                nnz,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                level_of_fill,
+                                                dcsr_row_ptr_lu,
+                                                &nnz_lu));
+
+    // Allocate device memory for LU
+    device_vector<rocsparse_int> dcsr_col_ind_lu(nnz_lu);
+    device_vector<T>             dcsr_val_lu_1(nnz_lu);
+    device_vector<T>             dcsr_val_lu_2(nnz_lu);
+
+    if(!dcsr_col_ind_lu || !dcsr_val_lu_1 || !dcsr_val_lu_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, dcsr_col_ind_lu));
+
+    // Obtain required buffer size and analysis meta data of LU
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(handle,
+                                                           M,
+                                                           nnz_lu,
+                                                           descr,
+                                                           dcsr_val_lu_1,
+                                                           dcsr_row_ptr_lu,
+                                                           dcsr_col_ind_lu,
+                                                           info,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        M,
+                                                        nnz_lu,
+                                                        descr,
+                                                        dcsr_val_lu_1,
+                                                        dcsr_row_ptr_lu,
+                                                        dcsr_col_ind_lu,
+                                                        info,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+
+    if(arg.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(
+            d_drop_tol, &h_drop_tol, sizeof(floating_data_t<T>), hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   &h_drop_tol,
+                                                   max_fill,
+                                                   nnz_lu,
+                                                   dcsr_val_lu_1,
+                                                   dcsr_row_ptr_lu,
+                                                   dcsr_col_ind_lu,
+                                                   info,
+                                                   spol,
+                                                   dbuffer));
+
+        rocsparse_int h_solve_pivot_1;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, &h_solve_pivot_1),
+                                (h_solve_pivot_1 != -1) ? rocsparse_status_zero_pivot
+                                                        : rocsparse_status_success);
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   d_drop_tol,
+                                                   max_fill,
+                                                   nnz_lu,
+                                                   dcsr_val_lu_2,
+                                                   dcsr_row_ptr_lu,
+                                                   dcsr_col_ind_lu,
+                                                   info,
+                                                   spol,
+                                                   dbuffer));
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_lu(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind_lu(nnz_lu);
+        host_vector<T>             hcsr_val_lu_1(nnz_lu);
+        host_vector<T>             hcsr_val_lu_2(nnz_lu);
+        host_vector<T>             hcsr_val_lu_gold;
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_lu,
+                                  dcsr_row_ptr_lu,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_lu,
+                                  dcsr_col_ind_lu,
+                                  sizeof(rocsparse_int) * nnz_lu,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_lu_1, dcsr_val_lu_1, sizeof(T) * nnz_lu, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_lu_2, dcsr_val_lu_2, sizeof(T) * nnz_lu, hipMemcpyDeviceToHost));
+
+        // CPU csrilut
+        rocsparse_int h_solve_pivot_gold;
+
+        host_csrilut_scatter(M,
+                             hcsr_row_ptr,
+                             hcsr_col_ind,
+                             hcsr_val,
+                             hcsr_row_ptr_lu,
+                             hcsr_col_ind_lu,
+                             hcsr_val_lu_gold,
+                             base);
+        host_csrilut(M,
+                     hcsr_row_ptr_lu,
+                     hcsr_col_ind_lu,
+                     hcsr_val_lu_gold,
+                     base,
+                     h_drop_tol,
+                     max_fill,
+                     &h_solve_pivot_gold);
+
+        // Check pivot
+        unit_check_general<rocsparse_int>(1, 1, 1, &h_solve_pivot_gold, &h_solve_pivot_1);
+
+        // Check solution if no pivot has been found
+        if(h_solve_pivot_gold == -1)
+        {
+            near_check_general<T>(1, nnz_lu, 1, hcsr_val_lu_gold, hcsr_val_lu_1);
+            near_check_general<T>(1, nnz_lu, 1, hcsr_val_lu_gold, hcsr_val_lu_2);
+
+            // Compress a copy of LU with its own analysis meta data
+            rocsparse_local_mat_info info_c;
+
+            device_vector<rocsparse_int> dcsr_row_ptr_lu_c(M + 1);
+            device_vector<rocsparse_int> dcsr_col_ind_lu_c(nnz_lu);
+            device_vector<T>             dx(M);
+            device_vector<T>             dy(M);
+            device_vector<T>             dz(M);
+
+            if(!dcsr_row_ptr_lu_c || !dcsr_col_ind_lu_c || !dx || !dy || !dz)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_lu_c,
+                                      dcsr_row_ptr_lu,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(dcsr_col_ind_lu_c,
+                                      dcsr_col_ind_lu,
+                                      sizeof(rocsparse_int) * nnz_lu,
+                                      hipMemcpyDeviceToDevice));
+
+            rocsparse_int nnz_lu_c;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_compress<T>(handle,
+                                                                M,
+                                                                descr,
+                                                                nnz_lu,
+                                                                dcsr_val_lu_2,
+                                                                dcsr_row_ptr_lu_c,
+                                                                dcsr_col_ind_lu_c,
+                                                                &nnz_lu_c,
+                                                                info_c,
+                                                                spol,
+                                                                dbuffer));
+
+            // CPU compression of the device result
+            host_vector<rocsparse_int> hcsr_row_ptr_lu_c_gold;
+            host_vector<rocsparse_int> hcsr_col_ind_lu_c_gold;
+            host_vector<T>             hcsr_val_lu_c_gold;
+
+            host_csrilut_compress(M,
+                                  hcsr_row_ptr_lu,
+                                  hcsr_col_ind_lu,
+                                  hcsr_val_lu_2,
+                                  hcsr_row_ptr_lu_c_gold,
+                                  hcsr_col_ind_lu_c_gold,
+                                  hcsr_val_lu_c_gold,
+                                  base);
+
+            rocsparse_int nnz_lu_c_gold = hcsr_col_ind_lu_c_gold.size();
+            unit_check_general<rocsparse_int>(1, 1, 1, &nnz_lu_c_gold, &nnz_lu_c);
+
+            host_vector<rocsparse_int> hcsr_row_ptr_lu_c(M + 1);
+            host_vector<rocsparse_int> hcsr_col_ind_lu_c(nnz_lu_c);
+            host_vector<T>             hcsr_val_lu_c(nnz_lu_c);
+
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_lu_c,
+                                      dcsr_row_ptr_lu_c,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_lu_c,
+                                      dcsr_col_ind_lu_c,
+                                      sizeof(rocsparse_int) * nnz_lu_c,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hcsr_val_lu_c, dcsr_val_lu_2, sizeof(T) * nnz_lu_c, hipMemcpyDeviceToHost));
+
+            unit_check_general<rocsparse_int>(
+                1, M + 1, 1, hcsr_row_ptr_lu_c_gold, hcsr_row_ptr_lu_c);
+            unit_check_general<rocsparse_int>(
+                1, nnz_lu_c, 1, hcsr_col_ind_lu_c_gold, hcsr_col_ind_lu_c);
+            unit_check_general<T>(1, nnz_lu_c, 1, hcsr_val_lu_c_gold, hcsr_val_lu_c);
+
+            // Solve L U z = x with the compressed factors, using the re-analysed meta data
+            rocsparse_local_mat_descr descr_L;
+            rocsparse_local_mat_descr descr_U;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_L, base));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_U, base));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit));
+
+            size_t buffer_size_L;
+            size_t buffer_size_U;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                                 rocsparse_operation_none,
+                                                                 M,
+                                                                 nnz_lu_c,
+                                                                 descr_L,
+                                                                 dcsr_val_lu_2,
+                                                                 dcsr_row_ptr_lu_c,
+                                                                 dcsr_col_ind_lu_c,
+                                                                 info_c,
+                                                                 &buffer_size_L));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                                 rocsparse_operation_none,
+                                                                 M,
+                                                                 nnz_lu_c,
+                                                                 descr_U,
+                                                                 dcsr_val_lu_2,
+                                                                 dcsr_row_ptr_lu_c,
+                                                                 dcsr_col_ind_lu_c,
+                                                                 info_c,
+                                                                 &buffer_size_U));
+
+            void* dbuffer_sv;
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer_sv, std::max(buffer_size_L, buffer_size_U)));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              M,
+                                                              nnz_lu_c,
+                                                              descr_L,
+                                                              dcsr_val_lu_2,
+                                                              dcsr_row_ptr_lu_c,
+                                                              dcsr_col_ind_lu_c,
+                                                              info_c,
+                                                              rocsparse_analysis_policy_reuse,
+                                                              rocsparse_solve_policy_auto,
+                                                              dbuffer_sv));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              M,
+                                                              nnz_lu_c,
+                                                              descr_U,
+                                                              dcsr_val_lu_2,
+                                                              dcsr_row_ptr_lu_c,
+                                                              dcsr_col_ind_lu_c,
+                                                              info_c,
+                                                              rocsparse_analysis_policy_reuse,
+                                                              rocsparse_solve_policy_auto,
+                                                              dbuffer_sv));
+
+            host_vector<T> hx(M);
+            rocsparse_init<T>(hx, M, 1, M);
+
+            CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * M, hipMemcpyHostToDevice));
+
+            T h_one = static_cast<T>(1);
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                           rocsparse_operation_none,
+                                                           M,
+                                                           nnz_lu_c,
+                                                           &h_one,
+                                                           descr_L,
+                                                           dcsr_val_lu_2,
+                                                           dcsr_row_ptr_lu_c,
+                                                           dcsr_col_ind_lu_c,
+                                                           info_c,
+                                                           dx,
+                                                           dy,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer_sv));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                           rocsparse_operation_none,
+                                                           M,
+                                                           nnz_lu_c,
+                                                           &h_one,
+                                                           descr_U,
+                                                           dcsr_val_lu_2,
+                                                           dcsr_row_ptr_lu_c,
+                                                           dcsr_col_ind_lu_c,
+                                                           info_c,
+                                                           dy,
+                                                           dz,
+                                                           rocsparse_solve_policy_auto,
+                                                           dbuffer_sv));
+
+            host_vector<T> hz(M);
+            CHECK_HIP_ERROR(hipMemcpy(hz, dz, sizeof(T) * M, hipMemcpyDeviceToHost));
+
+            // CPU solve with the uncompressed factors, the explicit zeros must not matter
+            host_vector<T> hy_gold(M);
+            host_vector<T> hz_gold(M);
+            rocsparse_int  struct_pivot;
+            rocsparse_int  numeric_pivot;
+
+            host_csrsv(rocsparse_operation_none,
+                       M,
+                       nnz_lu,
+                       h_one,
+                       hcsr_row_ptr_lu.data(),
+                       hcsr_col_ind_lu.data(),
+                       hcsr_val_lu_2.data(),
+                       hx.data(),
+                       hy_gold.data(),
+                       rocsparse_diag_type_unit,
+                       rocsparse_fill_mode_lower,
+                       base,
+                       &struct_pivot,
+                       &numeric_pivot);
+            host_csrsv(rocsparse_operation_none,
+                       M,
+                       nnz_lu,
+                       h_one,
+                       hcsr_row_ptr_lu.data(),
+                       hcsr_col_ind_lu.data(),
+                       hcsr_val_lu_2.data(),
+                       hy_gold.data(),
+                       hz_gold.data(),
+                       rocsparse_diag_type_non_unit,
+                       rocsparse_fill_mode_upper,
+                       base,
+                       &struct_pivot,
+                       &numeric_pivot);
+
+            near_check_general<T>(M, 1, M, hz_gold, hz);
+
+            CHECK_HIP_ERROR(hipFree(dbuffer_sv));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       &h_drop_tol,
+                                                       max_fill,
+                                                       nnz_lu,
+                                                       dcsr_val_lu_1,
+                                                       dcsr_row_ptr_lu,
+                                                       dcsr_col_ind_lu,
+                                                       info,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       &h_drop_tol,
+                                                       max_fill,
+                                                       nnz_lu,
+                                                       dcsr_val_lu_1,
+                                                       dcsr_row_ptr_lu,
+                                                       dcsr_col_ind_lu,
+                                                       info,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrilu0_gbyte_count<T>(M, nnz_lu) / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nnz_lu"
+                  << std::setw(12) << "threshold" << std::setw(12) << "maxfill" << std::setw(16)
+                  << "solve policy" << std::setw(12) << "GB/s" << std::setw(16) << "solve msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz_lu
+                  << std::setw(12) << h_drop_tol << std::setw(12) << max_fill << std::setw(16)
+                  << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
+                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear csrilu0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrilut_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrilut<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,422 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csritic0.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <algorithm>
+
+// Fixed-point sweeps of the iterative incomplete Cholesky factorization, mirroring the
+// synchronous sweeps of rocsparse_csritic0. The first row with a missing or non-positive
+// diagonal in the final sweep is returned as zero pivot.
+template <typename T>
+static void host_csritic0(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          const std::vector<rocsparse_int>& csr_col_ind,
+                          std::vector<T>&                   csr_val,
+                          rocsparse_index_base              base,
+                          rocsparse_int                     nsweeps,
+                          rocsparse_int*                    zero_pivot)
+{
+    *zero_pivot = -1;
+
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base == i)
+            {
+                diag_offset[i] = j;
+                break;
+            }
+        }
+    }
+
+    std::vector<T> a(csr_val);
+    std::vector<T> src(csr_val);
+    std::vector<T> dst(csr_val);
+
+    for(rocsparse_int s = 0; s < nsweeps; ++s)
+    {
+        bool last = (s == nsweeps - 1);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int row_begin = csr_row_ptr[i] - base;
+            rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+            // Structural zero pivot
+            if(last && *zero_pivot == -1 && diag_offset[i] == -1)
+            {
+                *zero_pivot = i + base;
+            }
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                // Skip upper triangular part
+                if(col > i)
+                {
+                    break;
+                }
+
+                T sum = a[j];
+
+                for(rocsparse_int k = row_begin; k < row_end; ++k)
+                {
+                    rocsparse_int col_k = csr_col_ind[k] - base;
+
+                    if(col_k >= col)
+                    {
+                        break;
+                    }
+
+                    // Look up l_jk in row j
+                    auto first = csr_col_ind.begin() + csr_row_ptr[col] - base;
+                    auto last  = csr_col_ind.begin() + csr_row_ptr[col + 1] - base;
+                    auto it    = std::lower_bound(first, last, col_k + base);
+
+                    if(it != last && *it == col_k + base)
+                    {
+                        sum = std::fma(-src[it - csr_col_ind.begin()], rocsparse_conj(src[k]), sum);
+                    }
+                }
+
+                if(col < i)
+                {
+                    T l_jj = (diag_offset[col] != -1) ? src[diag_offset[col]] : static_cast<T>(1);
+
+                    dst[j] = (l_jj != static_cast<T>(0)) ? sum / l_jj : sum;
+                }
+                else
+                {
+                    // Numerical zero pivot
+                    if(last && *zero_pivot == -1 && std::real(sum) <= 0)
+                    {
+                        *zero_pivot = i + base;
+                    }
+
+                    dst[j] = std::sqrt(std::abs(sum));
+                }
+            }
+        }
+
+        src = dst;
+    }
+
+    csr_val = src;
+}
+
+template <typename T>
+void testing_csritic0_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    T*                        csr_val     = (T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    rocsparse_int             nsweeps     = 3;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, nsweeps, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csritic0_buffer_size<T>, PARAMS_BUFFER_SIZE);
+
+    {
+        // Exclude nsweeps, which is not a size
+        static constexpr int nargs_to_exclude                  = 1;
+        static constexpr int args_to_exclude[nargs_to_exclude] = {8};
+
+        auto_testing_bad_arg(rocsparse_csritic0<T>, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+
+    // Negative number of sweeps
+    nsweeps = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0<T>(PARAMS), rocsparse_status_invalid_value);
+    nsweeps = 3;
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csritic0(const Arguments& arg)
+{
+    rocsparse_int        M       = arg.M;
+    rocsparse_int        N       = arg.N;
+    rocsparse_int        nsweeps = arg.nsweeps;
+    rocsparse_index_base base    = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csritic0_buffer_size<T>(
+                handle, M, safe_size, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0<T>(handle,
+                                                      M,
+                                                      safe_size,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      nsweeps,
+                                                      dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csritic0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritic0<T>(
+            handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, nsweeps, dbuffer));
+
+        // Copy output to host
+        host_vector<T> hcsr_val_gold(hcsr_val);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // Zero pivot of the final sweep
+        host_vector<rocsparse_int> h_pivot(1);
+        host_vector<rocsparse_int> h_pivot_gold(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_zero_pivot(handle, info, h_pivot),
+                                (h_pivot[0] != -1) ? rocsparse_status_zero_pivot
+                                                   : rocsparse_status_success);
+
+        // CPU csritic0
+        host_csritic0(M, hcsr_row_ptr, hcsr_col_ind, hcsr_val_gold, base, nsweeps, h_pivot_gold);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, h_pivot_gold, h_pivot);
+        near_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val);
+
+        // A symmetric matrix that is not positive definite reports its second row
+        host_vector<rocsparse_int> hind_ptr(3);
+        host_vector<rocsparse_int> hind_col(4);
+        host_vector<T>             hind_val(4);
+
+        hind_ptr[0] = base;
+        hind_ptr[1] = base + 2;
+        hind_ptr[2] = base + 4;
+        hind_col[0] = base;
+        hind_col[1] = base + 1;
+        hind_col[2] = base;
+        hind_col[3] = base + 1;
+        hind_val[0] = static_cast<T>(1);
+        hind_val[1] = static_cast<T>(2);
+        hind_val[2] = static_cast<T>(2);
+        hind_val[3] = static_cast<T>(1);
+
+        device_vector<rocsparse_int> dind_ptr(hind_ptr);
+        device_vector<rocsparse_int> dind_col(hind_col);
+        device_vector<T>             dind_val(hind_val);
+
+        size_t ind_buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritic0_buffer_size<T>(
+            handle, 2, 4, descr, dind_val, dind_ptr, dind_col, &ind_buffer_size));
+
+        device_vector<char> dind_buffer(ind_buffer_size);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritic0<T>(
+            handle, 2, 4, descr, dind_val, dind_ptr, dind_col, info, 2, dind_buffer));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_zero_pivot(handle, info, h_pivot),
+                                rocsparse_status_zero_pivot);
+
+        h_pivot_gold[0] = base + 1;
+        unit_check_general<rocsparse_int>(1, 1, 1, h_pivot_gold, h_pivot);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritic0<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        nsweeps,
+                                                        dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritic0<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        nsweeps,
+                                                        dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gbyte_count = csric0_gbyte_count<T>(M, nnz) * nsweeps;
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "sweeps"
+                  << std::setw(12) << "GB/s" << std::setw(16) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nsweeps
+                  << std::setw(12) << gpu_gbyte << std::setw(16) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csritic0_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csritic0<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
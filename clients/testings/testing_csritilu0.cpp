@@ -0,0 +1,330 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csritilu0.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <algorithm>
+
+// Fixed-point sweeps of the iterative incomplete LU factorization, mirroring the
+// synchronous sweeps of rocsparse_csritilu0
+template <typename T>
+static void host_csritilu0(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           std::vector<T>&                   csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     nsweeps)
+{
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base == i)
+            {
+                diag_offset[i] = j;
+                break;
+            }
+        }
+    }
+
+    std::vector<T> a(csr_val);
+    std::vector<T> src(csr_val);
+    std::vector<T> dst(csr_val);
+
+    for(rocsparse_int s = 0; s < nsweeps; ++s)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int row_begin = csr_row_ptr[i] - base;
+            rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col  = csr_col_ind[j] - base;
+                rocsparse_int kmax = std::min(i, col);
+
+                T sum = a[j];
+
+                for(rocsparse_int k = row_begin; k < row_end; ++k)
+                {
+                    rocsparse_int col_k = csr_col_ind[k] - base;
+
+                    if(col_k >= kmax)
+                    {
+                        break;
+                    }
+
+                    // Look up u_kj in row k
+                    auto first = csr_col_ind.begin() + csr_row_ptr[col_k] - base;
+                    auto last  = csr_col_ind.begin() + csr_row_ptr[col_k + 1] - base;
+                    auto it    = std::lower_bound(first, last, col + base);
+
+                    if(it != last && *it == col + base)
+                    {
+                        sum = std::fma(-src[k], src[it - csr_col_ind.begin()], sum);
+                    }
+                }
+
+                if(col < i)
+                {
+                    T u_jj = (diag_offset[col] != -1) ? src[diag_offset[col]] : static_cast<T>(1);
+
+                    dst[j] = (u_jj != static_cast<T>(0)) ? sum / u_jj : sum;
+                }
+                else
+                {
+                    dst[j] = sum;
+                }
+            }
+        }
+
+        src = dst;
+    }
+
+    csr_val = src;
+}
+
+template <typename T>
+void testing_csritilu0_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    T*                        csr_val     = (T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int             nsweeps     = 3;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, nsweeps, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csritilu0_buffer_size<T>, PARAMS_BUFFER_SIZE);
+
+    {
+        // Exclude nsweeps, which is not a size
+        static constexpr int nargs_to_exclude                  = 1;
+        static constexpr int args_to_exclude[nargs_to_exclude] = {7};
+
+        auto_testing_bad_arg(rocsparse_csritilu0<T>, nargs_to_exclude, args_to_exclude, PARAMS);
+    }
+
+    // Negative number of sweeps
+    nsweeps = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0<T>(PARAMS), rocsparse_status_invalid_value);
+    nsweeps = 3;
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csritilu0(const Arguments& arg)
+{
+    rocsparse_int        M       = arg.M;
+    rocsparse_int        N       = arg.N;
+    rocsparse_int        nsweeps = arg.nsweeps;
+    rocsparse_index_base base    = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csritilu0_buffer_size<T>(
+                handle, M, safe_size, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0<T>(handle,
+                                                       M,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nsweeps,
+                                                       dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0<T>(
+            handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, nsweeps, dbuffer));
+
+        // Copy output to host
+        host_vector<T> hcsr_val_gold(hcsr_val);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val, dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU csritilu0
+        host_csritilu0(M, hcsr_row_ptr, hcsr_col_ind, hcsr_val_gold, base, nsweeps);
+
+        near_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0<T>(
+                handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, nsweeps, dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0<T>(
+                handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, nsweeps, dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gbyte_count = csrilu0_gbyte_count<T>(M, nnz) * nsweeps;
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "sweeps"
+                  << std::setw(12) << "GB/s" << std::setw(16) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nsweeps
+                  << std::setw(12) << gpu_gbyte << std::setw(16) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_csritilu0_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csritilu0<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
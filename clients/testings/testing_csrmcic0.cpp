@@ -0,0 +1,330 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csrmcic0.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_csrmcic0_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+    rocsparse_local_mat_info  local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    T*                        csr_val     = (T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int             ncolors     = safe_size;
+    const rocsparse_int*      color_ptr   = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+
+#define PARAMS handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, ncolors, color_ptr, info
+
+    auto_testing_bad_arg(rocsparse_csrmcic0<T>, PARAMS);
+
+    // Missing analysis
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcic0<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcic0<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csrmcic0(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+
+    rocsparse_index_base base = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Color all rows
+    const floating_data_t<T> fraction_to_color = static_cast<floating_data_t<T>>(1);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrmcic0<T>(
+                handle, M, 0, descr, nullptr, nullptr, nullptr, 0, nullptr, info),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Init a CSR matrix with symmetric sparsity pattern
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    M                 = hA.m;
+    rocsparse_int nnz = hA.nnz;
+
+    // Allocate device memory and transfer data from host
+    device_csr_matrix<T>               dA(hA);
+    device_csr_matrix<T>               dA_mc(M, M, nnz, base);
+    device_dense_vector<rocsparse_int> dcoloring(M);
+    device_dense_vector<rocsparse_int> dperm(M);
+
+    // Coloring
+    rocsparse_int ncolors;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                M,
+                                                nnz,
+                                                descr,
+                                                dA.val,
+                                                dA.ptr,
+                                                dA.ind,
+                                                &fraction_to_color,
+                                                &ncolors,
+                                                dcoloring,
+                                                nullptr,
+                                                info));
+
+    device_dense_vector<rocsparse_int> dcolor_ptr(ncolors + 1);
+
+    // Permute the matrix by color
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_permute_buffer_size(
+        handle, M, nnz, descr, dA.ptr, dA.ind, ncolors, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_permute<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dA.val,
+                                                        dA.ptr,
+                                                        dA.ind,
+                                                        ncolors,
+                                                        dcoloring,
+                                                        dperm,
+                                                        dcolor_ptr,
+                                                        dA_mc.val,
+                                                        dA_mc.ptr,
+                                                        dA_mc.ind,
+                                                        dbuffer));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+    // Host copy of the color permuted matrix
+    host_vector<rocsparse_int> hcsr_row_ptr(M + 1);
+    host_vector<rocsparse_int> hcsr_col_ind(nnz);
+    host_vector<T>             hcsr_val_gold(nnz);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr, dA_mc.ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hcsr_col_ind, dA_mc.ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_gold, dA_mc.val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    // Allocate host memory for vectors
+    host_vector<T>             hcsr_val_1(nnz);
+    host_vector<T>             hcsr_val_2(nnz);
+    host_vector<rocsparse_int> h_analysis_pivot_gold(1);
+    host_vector<rocsparse_int> h_solve_pivot_1(1);
+    host_vector<rocsparse_int> h_solve_pivot_2(1);
+    host_vector<rocsparse_int> h_solve_pivot_gold(1);
+
+    // Allocate device memory
+    device_vector<T>             dcsr_val_2(nnz);
+    device_vector<rocsparse_int> d_solve_pivot_2(1);
+
+    if(!dcsr_val_2 || !d_solve_pivot_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // The multicolor factorization relies on the csric0 analysis of the permuted matrix
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_buffer_size<T>(
+        handle, M, nnz, descr, dA_mc.val, dA_mc.ptr, dA_mc.ind, info, &buffer_size));
+
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_analysis<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dA_mc.val,
+                                                       dA_mc.ptr,
+                                                       dA_mc.ind,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_auto,
+                                                       dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_2, hcsr_val_gold, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmcic0<T>(
+            handle, M, nnz, descr, dA_mc.val, dA_mc.ptr, dA_mc.ind, ncolors, dcolor_ptr, info));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_zero_pivot(handle, info, h_solve_pivot_1),
+                                (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmcic0<T>(
+            handle, M, nnz, descr, dcsr_val_2, dA_mc.ptr, dA_mc.ind, ncolors, dcolor_ptr, info));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csric0_zero_pivot(handle, info, d_solve_pivot_2),
+                                (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_1, dA_mc.val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_val_2, dcsr_val_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            h_solve_pivot_2, d_solve_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // CPU csric0 on the color permuted matrix
+        host_csric0<T>(M,
+                       hcsr_row_ptr,
+                       hcsr_col_ind,
+                       hcsr_val_gold,
+                       base,
+                       h_analysis_pivot_gold,
+                       h_solve_pivot_gold);
+
+        // Check pivots
+        unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_2);
+
+        // Check factors if no pivot has been found
+        if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
+        {
+            near_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val_1);
+            near_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcic0<T>(
+                handle, M, nnz, descr, dA_mc.val, dA_mc.ptr, dA_mc.ind, ncolors, dcolor_ptr, info));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcic0<T>(
+                handle, M, nnz, descr, dA_mc.val, dA_mc.ptr, dA_mc.ind, ncolors, dcolor_ptr, info));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gbyte_count = csric0_gbyte_count<T>(M, nnz);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            nnz,
+                            "ncolors",
+                            ncolors,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    // Clear csric0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csrmcic0_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrmcic0<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -62,22 +62,34 @@ void testing_csrmm_bad_arg(const Arguments& arg)
 
     auto_testing_bad_arg(rocsparse_csrmm<T>, PARAMS);
 
-    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_triangular));
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm<T>(PARAMS), rocsparse_status_not_implemented);
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+    // Symmetric and Hermitian matrices need to be square
+    k = safe_size + 1;
+    for(auto type : {rocsparse_matrix_type_symmetric, rocsparse_matrix_type_hermitian})
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, type));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmm<T>(PARAMS), rocsparse_status_invalid_size);
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+    k = safe_size;
 #undef PARAMS
 }
 
 template <typename T>
 void testing_csrmm(const Arguments& arg)
 {
-    rocsparse_int        M      = arg.M;
-    rocsparse_int        N      = arg.N;
-    rocsparse_int        K      = arg.K;
-    rocsparse_operation  transA = arg.transA;
-    rocsparse_operation  transB = arg.transB;
-    rocsparse_index_base base   = arg.baseA;
-    rocsparse_order      order  = rocsparse_order_column;
+    rocsparse_int         M      = arg.M;
+    rocsparse_int         N      = arg.N;
+    rocsparse_int         K      = arg.K;
+    rocsparse_operation   transA = arg.transA;
+    rocsparse_operation   transB = arg.transB;
+    rocsparse_index_base  base   = arg.baseA;
+    rocsparse_matrix_type type   = arg.matrix_type;
+    rocsparse_fill_mode   uplo   = arg.uplo;
+    rocsparse_order       order  = rocsparse_order_column;
 
     host_scalar<T> h_alpha, h_beta;
 
@@ -93,8 +105,16 @@ void testing_csrmm(const Arguments& arg)
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set matrix type and fill mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, type));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, uplo));
+
+    // Symmetric and Hermitian matrices need to be square
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || (type != rocsparse_matrix_type_general && M != K);
+
     // Argument sanity check before allocating invalid memory
-    if(M <= 0 || N <= 0 || K <= 0)
+    if(M <= 0 || N <= 0 || K <= 0 || invalid_size)
     {
         static const size_t safe_size = 100;
 
@@ -123,8 +143,8 @@ void testing_csrmm(const Arguments& arg)
                                                    h_beta.val,
                                                    dC,
                                                    safe_size),
-                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
-                                                          : rocsparse_status_success);
+                                invalid_size ? rocsparse_status_invalid_size
+                                             : rocsparse_status_success);
 
         return;
     }
@@ -137,6 +157,17 @@ void testing_csrmm(const Arguments& arg)
                             (transA == rocsparse_operation_none ? M : K),
                             (transA == rocsparse_operation_none ? K : M));
 
+    // Symmetric and Hermitian matrices only store one triangular part, the host
+    // reference is computed from the full matrix it represents
+    host_csr_matrix<T> hA_stored, hA_full;
+    if(type != rocsparse_matrix_type_general)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_matrix_utils::host_csrtri(hA, type, uplo, hA_stored, hA_full));
+    }
+
+    const host_csr_matrix<T>& hA_ref = (type != rocsparse_matrix_type_general) ? hA_full : hA;
+
     // Some matrix properties
     rocsparse_int A_m = (transA == rocsparse_operation_none ? M : K);
     // rocsparse_int A_n = (transA == rocsparse_operation_none ? K : M);
@@ -159,7 +190,7 @@ void testing_csrmm(const Arguments& arg)
     rocsparse_matrix_utils::init(hB);
     rocsparse_matrix_utils::init(hC);
 
-    device_csr_matrix<T>   dA(hA);
+    device_csr_matrix<T>   dA((type != rocsparse_matrix_type_general) ? hA_stored : hA);
     device_dense_matrix<T> dB(hB);
     device_dense_matrix<T> dC(hC);
 
@@ -186,9 +217,9 @@ void testing_csrmm(const Arguments& arg)
                        transA,
                        transB,
                        *h_alpha.val,
-                       hA.ptr,
-                       hA.ind,
-                       hA.val,
+                       hA_ref.ptr,
+                       hA_ref.ind,
+                       hA_ref.val,
                        hB.val,
                        hB.ld,
                        *h_beta.val,
@@ -235,7 +266,7 @@ void testing_csrmm(const Arguments& arg)
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
 
         double gflop_count = csrmm_gflop_count<rocsparse_int, rocsparse_int>(
-            N, dA.nnz, C_m * C_n, *h_beta.val != static_cast<T>(0));
+            N, hA_ref.nnz, C_m * C_n, *h_beta.val != static_cast<T>(0));
         double gpu_gflops  = get_gpu_gflops(gpu_time_used, gflop_count);
         double gbyte_count = csrmm_gbyte_count<T, rocsparse_int, rocsparse_int>(
             A_m, dA.nnz, B_m * B_n, C_m * C_n, *h_beta.val != static_cast<T>(0));
@@ -251,6 +282,8 @@ void testing_csrmm(const Arguments& arg)
                             rocsparse_operation2string(transA),
                             "transB",
                             rocsparse_operation2string(transB),
+                            "type",
+                            rocsparse_matrixtype2string(type),
                             "nnz_A",
                             dA.nnz,
                             "nnz_B",
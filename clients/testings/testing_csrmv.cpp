@@ -78,7 +78,7 @@ void testing_csrmv_bad_arg(const Arguments& arg)
 
     for(auto matrix_type : rocsparse_matrix_type_t::values)
     {
-        if(matrix_type != rocsparse_matrix_type_general)
+        if(matrix_type == rocsparse_matrix_type_triangular)
         {
             CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(PARAMS_ANALYSIS),
@@ -87,6 +87,16 @@ void testing_csrmv_bad_arg(const Arguments& arg)
         }
     }
 
+    // Symmetric and Hermitian matrices need to be square
+    n = safe_size + 1;
+    for(auto matrix_type : {rocsparse_matrix_type_symmetric, rocsparse_matrix_type_hermitian})
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(PARAMS_ANALYSIS),
+                                rocsparse_status_invalid_size);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv<T>(PARAMS), rocsparse_status_invalid_size);
+    }
+
 #undef PARAMS_ANALYSIS
 #undef PARAMS
 }
@@ -94,12 +104,14 @@ void testing_csrmv_bad_arg(const Arguments& arg)
 template <typename T>
 void testing_csrmv(const Arguments& arg)
 {
-    auto                 tol      = get_near_check_tol<T>(arg);
-    rocsparse_int        M        = arg.M;
-    rocsparse_int        N        = arg.N;
-    rocsparse_operation  trans    = arg.transA;
-    rocsparse_index_base base     = arg.baseA;
-    uint32_t             adaptive = arg.algo;
+    auto                  tol      = get_near_check_tol<T>(arg);
+    rocsparse_int         M        = arg.M;
+    rocsparse_int         N        = arg.N;
+    rocsparse_operation   trans    = arg.transA;
+    rocsparse_index_base  base     = arg.baseA;
+    rocsparse_matrix_type type     = arg.matrix_type;
+    rocsparse_fill_mode   uplo     = arg.uplo;
+    uint32_t              adaptive = arg.algo;
 
     host_scalar<T> h_alpha(arg.get_alpha<T>());
     host_scalar<T> h_beta(arg.get_beta<T>());
@@ -120,12 +132,16 @@ void testing_csrmv(const Arguments& arg)
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set matrix type and fill mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, type));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, uplo));
+
 #define PARAMS_ANALYSIS(A_) handle, trans, A_.m, A_.n, A_.nnz, descr, A_.val, A_.ptr, A_.ind, info
 #define PARAMS(alpha_, A_, x_, beta_, y_) \
     handle, trans, A_.m, A_.n, A_.nnz, alpha_, descr, A_.val, A_.ptr, A_.ind, info, x_, beta_, y_
 
     // Argument sanity check before allocating invalid memory
-    if(M <= 0 || N <= 0)
+    if(M <= 0 || N <= 0 || (type != rocsparse_matrix_type_general && M != N))
     {
         static const size_t safe_size = 100;
 
@@ -136,19 +152,22 @@ void testing_csrmv(const Arguments& arg)
         dA.n   = N;
         dA.nnz = safe_size;
 
+        // Symmetric and Hermitian matrices need to be square
+        bool invalid_size = M < 0 || N < 0 || (type != rocsparse_matrix_type_general && M != N);
+
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
 
         // If adaptive, perform analysis step
         if(adaptive)
         {
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv_analysis<T>(PARAMS_ANALYSIS(dA)),
-                                    (M < 0 || N < 0) ? rocsparse_status_invalid_size
-                                                     : rocsparse_status_success);
+                                    invalid_size ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
         }
 
         EXPECT_ROCSPARSE_STATUS(rocsparse_csrmv<T>(PARAMS(h_alpha, dA, dx, h_beta, dy)),
-                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
-                                                 : rocsparse_status_success);
+                                invalid_size ? rocsparse_status_invalid_size
+                                             : rocsparse_status_success);
 
         // If adaptive, clear data
         if(adaptive)
@@ -167,20 +186,31 @@ void testing_csrmv(const Arguments& arg)
     hipDeviceProp_t prop;
     hipGetDeviceProperties(&prop, dev);
 
-    bool type = (prop.warpSize == 32) ? true : adaptive;
+    bool to_int = (prop.warpSize == 32) ? true : adaptive;
 
     static constexpr bool       full_rank = false;
-    rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : type, full_rank);
+    rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : to_int, full_rank);
 
     host_csr_matrix<T> hA;
     matrix_factory.init_csr(hA, M, N);
-    device_csr_matrix<T> dA(hA);
 
-    host_dense_matrix<T> hx(N, 1);
+    // Symmetric and Hermitian matrices only store one triangular part, the host
+    // reference is computed from the full matrix it represents
+    host_csr_matrix<T> hA_stored, hA_full;
+    if(type != rocsparse_matrix_type_general)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_matrix_utils::host_csrtri(hA, type, uplo, hA_stored, hA_full));
+    }
+
+    const host_csr_matrix<T>& hA_ref = (type != rocsparse_matrix_type_general) ? hA_full : hA;
+    device_csr_matrix<T>      dA((type != rocsparse_matrix_type_general) ? hA_stored : hA);
+
+    host_dense_matrix<T> hx((trans == rocsparse_operation_none) ? N : M, 1);
     rocsparse_matrix_utils::init_exact(hx);
     device_dense_matrix<T> dx(hx);
 
-    host_dense_matrix<T> hy(M, 1);
+    host_dense_matrix<T> hy((trans == rocsparse_operation_none) ? M : N, 1);
     rocsparse_matrix_utils::init_exact(hy);
     device_dense_matrix<T> dy(hy);
 
@@ -199,8 +229,19 @@ void testing_csrmv(const Arguments& arg)
         {
             host_dense_matrix<T> hy_copy(hy);
             // CPU csrmv
-            host_csrmv<rocsparse_int, rocsparse_int, T>(
-                M, hA.nnz, *h_alpha, hA.ptr, hA.ind, hA.val, hx, *h_beta, hy, base, adaptive);
+            host_csrmv<rocsparse_int, rocsparse_int, T>(trans,
+                                                        M,
+                                                        N,
+                                                        hA_ref.nnz,
+                                                        *h_alpha,
+                                                        hA_ref.ptr,
+                                                        hA_ref.ind,
+                                                        hA_ref.val,
+                                                        hx,
+                                                        *h_beta,
+                                                        hy,
+                                                        base,
+                                                        adaptive);
             hy.near_check(dy, tol);
             dy.transfer_from(hy_copy);
         }
@@ -235,7 +276,7 @@ void testing_csrmv(const Arguments& arg)
 
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
 
-        double gflop_count = spmv_gflop_count(M, dA.nnz, *h_beta != static_cast<T>(0));
+        double gflop_count = spmv_gflop_count(M, hA_ref.nnz, *h_beta != static_cast<T>(0));
         double gbyte_count = csrmv_gbyte_count<T>(M, N, dA.nnz, *h_beta != static_cast<T>(0));
 
         double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
@@ -251,6 +292,8 @@ void testing_csrmv(const Arguments& arg)
                             *h_alpha,
                             "beta",
                             *h_beta,
+                            "type",
+                            rocsparse_matrixtype2string(type),
                             "Algorithm",
                             (adaptive ? "adaptive" : "stream"),
                             "GFlop/s",
@@ -506,7 +506,9 @@ void testing_csrmv_managed(const Arguments& arg)
         }
 
         // CPU csrmv
-        host_csrmv<rocsparse_int, rocsparse_int, T>(M,
+        host_csrmv<rocsparse_int, rocsparse_int, T>(trans,
+                                                    M,
+                                                    N,
                                                     nnz,
                                                     *alpha,
                                                     csr_row_ptr,
@@ -0,0 +1,283 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csrpermute.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <algorithm>
+
+// Symmetric permutation of A, row i of A_perm is row perm[i] of A
+template <typename T>
+static void host_csrpermute(const host_csr_matrix<T>&         A,
+                            const host_vector<rocsparse_int>& perm,
+                            host_csr_matrix<T>&               A_perm)
+{
+    rocsparse_int        M    = A.m;
+    rocsparse_index_base base = A.base;
+
+    // Inverse permutation
+    host_vector<rocsparse_int> iperm(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        iperm[perm[i]] = i;
+    }
+
+    // Permuted matrix with sorted columns
+    A_perm.ptr[0] = base;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row       = perm[i];
+        rocsparse_int row_begin = A.ptr[row] - base;
+        rocsparse_int row_end   = A.ptr[row + 1] - base;
+
+        std::vector<std::pair<rocsparse_int, T>> entries;
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            entries.push_back(std::make_pair(iperm[A.ind[j] - base] + base, A.val[j]));
+        }
+
+        std::stable_sort(entries.begin(),
+                         entries.end(),
+                         [](const std::pair<rocsparse_int, T>& a,
+                            const std::pair<rocsparse_int, T>& b) { return a.first < b.first; });
+
+        rocsparse_int offset = A_perm.ptr[i] - base;
+        for(size_t j = 0; j < entries.size(); ++j)
+        {
+            A_perm.ind[offset + j] = entries[j].first;
+            A_perm.val[offset + j] = entries[j].second;
+        }
+
+        A_perm.ptr[i + 1] = A_perm.ptr[i] + (row_end - row_begin);
+    }
+}
+
+template <typename T>
+void testing_csrpermute_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle           = local_handle;
+    rocsparse_int             m                = safe_size;
+    rocsparse_int             nnz              = safe_size;
+    const rocsparse_mat_descr descr            = local_descr;
+    const T*                  csr_val          = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr      = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind      = (const rocsparse_int*)0x4;
+    const rocsparse_int*      perm             = (const rocsparse_int*)0x4;
+    T*                        csr_val_perm     = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_perm = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_perm = (rocsparse_int*)0x4;
+    size_t*                   buffer_size      = (size_t*)0x4;
+    void*                     temp_buffer      = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS                                                                    \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, perm, csr_val_perm, \
+        csr_row_ptr_perm, csr_col_ind_perm, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrpermute_buffer_size, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrpermute<T>, PARAMS);
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrpermute<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csrpermute(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrpermute_buffer_size(
+                handle, M, 0, descr, (const rocsparse_int*)0x4, nullptr, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrpermute<T>(handle,
+                                                        M,
+                                                        0,
+                                                        descr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr,
+                                                        nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        return;
+    }
+
+    // Init a square CSR matrix
+    host_csr_matrix<T> hA;
+    matrix_factory.init_csr(hA, M, M, base);
+
+    M = hA.m;
+
+    // Random permutation
+    host_vector<rocsparse_int> hperm(M);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        hperm[i] = i;
+    }
+
+    std::shuffle(hperm.begin(), hperm.end(), rocsparse_rng);
+
+    // Allocate device memory and transfer data from host
+    device_csr_matrix<T>               dA(hA);
+    device_csr_matrix<T>               dA_perm(M, M, hA.nnz, base);
+    device_dense_vector<rocsparse_int> dperm(hperm);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrpermute_buffer_size(
+        handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrpermute<T>(handle,
+                                                      dA.m,
+                                                      dA.nnz,
+                                                      descr,
+                                                      dA.val,
+                                                      dA.ptr,
+                                                      dA.ind,
+                                                      dperm,
+                                                      dA_perm.val,
+                                                      dA_perm.ptr,
+                                                      dA_perm.ind,
+                                                      dbuffer));
+
+        // CPU permutation
+        host_csr_matrix<T> hA_perm_gold(M, M, hA.nnz, base);
+
+        host_csrpermute(hA, hperm, hA_perm_gold);
+
+        hA_perm_gold.unit_check(dA_perm);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrpermute<T>(handle,
+                                                          dA.m,
+                                                          dA.nnz,
+                                                          descr,
+                                                          dA.val,
+                                                          dA.ptr,
+                                                          dA.ind,
+                                                          dperm,
+                                                          dA_perm.val,
+                                                          dA_perm.ptr,
+                                                          dA_perm.ind,
+                                                          dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrpermute<T>(handle,
+                                                          dA.m,
+                                                          dA.nnz,
+                                                          descr,
+                                                          dA.val,
+                                                          dA.ptr,
+                                                          dA.ind,
+                                                          dperm,
+                                                          dA_perm.val,
+                                                          dA_perm.ptr,
+                                                          dA_perm.ind,
+                                                          dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                 \
+    template void testing_csrpermute_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrpermute<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,345 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "testing_csrrcm.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+#include <algorithm>
+
+// Breadth first search from root, the unvisited neighbours of each node are appended
+// to the queue by increasing degree. Returns the number of levels.
+static rocsparse_int host_csrrcm_bfs(rocsparse_int                     root,
+                                     rocsparse_int                     stamp,
+                                     const host_vector<rocsparse_int>& csr_row_ptr,
+                                     const host_vector<rocsparse_int>& csr_col_ind,
+                                     rocsparse_index_base              base,
+                                     const host_vector<rocsparse_int>& degree,
+                                     host_vector<rocsparse_int>&       mark,
+                                     std::vector<rocsparse_int>&       queue,
+                                     rocsparse_int&                    last_level)
+{
+    queue.clear();
+    queue.push_back(root);
+    mark[root] = stamp;
+
+    rocsparse_int level_begin = 0;
+    rocsparse_int nlevels     = 1;
+
+    last_level = 0;
+
+    while(true)
+    {
+        rocsparse_int level_end = queue.size();
+
+        for(rocsparse_int q = level_begin; q < level_end; ++q)
+        {
+            rocsparse_int row = queue[q];
+
+            std::vector<rocsparse_int> nodes;
+            for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(mark[col] != stamp && mark[col] != -1)
+                {
+                    mark[col] = stamp;
+                    nodes.push_back(col);
+                }
+            }
+
+            std::sort(nodes.begin(), nodes.end(), [&](rocsparse_int a, rocsparse_int b) {
+                return degree[a] < degree[b] || (degree[a] == degree[b] && a < b);
+            });
+
+            queue.insert(queue.end(), nodes.begin(), nodes.end());
+        }
+
+        if(queue.size() == (size_t)level_end)
+        {
+            break;
+        }
+
+        level_begin = level_end;
+        last_level  = level_begin;
+        ++nlevels;
+    }
+
+    return nlevels;
+}
+
+// Reverse Cuthill-McKee ordering with a pseudo-peripheral start node per component
+static void host_csrrcm(rocsparse_int                     M,
+                        const host_vector<rocsparse_int>& csr_row_ptr,
+                        const host_vector<rocsparse_int>& csr_col_ind,
+                        rocsparse_index_base              base,
+                        host_vector<rocsparse_int>&       perm)
+{
+    host_vector<rocsparse_int> degree(M, 0);
+    host_vector<rocsparse_int> mark(M, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            degree[i] += (csr_col_ind[j] - base != i);
+        }
+    }
+
+    // Isolated nodes come first
+    rocsparse_int nordered = 0;
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        if(degree[i] == 0)
+        {
+            perm[nordered++] = i;
+            mark[i]          = -1;
+        }
+    }
+
+    rocsparse_int              stamp = 0;
+    std::vector<rocsparse_int> queue;
+
+    auto min_degree = [&](const rocsparse_int* nodes, rocsparse_int n) {
+        rocsparse_int node = -1;
+        for(rocsparse_int i = 0; i < n; ++i)
+        {
+            rocsparse_int c = nodes[i];
+            if(mark[c] == -1)
+            {
+                continue;
+            }
+
+            if(node == -1 || degree[c] < degree[node] || (degree[c] == degree[node] && c < node))
+            {
+                node = c;
+            }
+        }
+        return node;
+    };
+
+    host_vector<rocsparse_int> identity(M);
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        identity[i] = i;
+    }
+
+    while(nordered < M)
+    {
+        rocsparse_int last_level;
+        rocsparse_int root = min_degree(identity.data(), M);
+        rocsparse_int nlevels = host_csrrcm_bfs(
+            root, ++stamp, csr_row_ptr, csr_col_ind, base, degree, mark, queue, last_level);
+
+        for(int i = 0; i < 8; ++i)
+        {
+            rocsparse_int nlevels_prev = nlevels;
+
+            root    = min_degree(queue.data() + last_level, queue.size() - last_level);
+            nlevels = host_csrrcm_bfs(
+                root, ++stamp, csr_row_ptr, csr_col_ind, base, degree, mark, queue, last_level);
+
+            if(nlevels <= nlevels_prev)
+            {
+                break;
+            }
+        }
+
+        for(rocsparse_int node : queue)
+        {
+            perm[nordered++] = node;
+            mark[node]       = -1;
+        }
+    }
+
+    std::reverse(perm.begin(), perm.end());
+}
+
+template <typename T>
+void testing_csrrcm_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    rocsparse_local_handle    local_handle;
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int*            perm        = (rocsparse_int*)0x4;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrrcm_buffer_size, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrrcm, PARAMS);
+
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrrcm(PARAMS), rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csrrcm(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrcm_buffer_size(
+                handle, M, 0, descr, (const rocsparse_int*)0x4, nullptr, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrcm(handle, M, 0, descr, nullptr, nullptr, nullptr, nullptr),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR matrix with symmetric sparsity pattern
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    M = hA.m;
+
+    // Allocate device memory and transfer data from host
+    device_csr_matrix<T>               dA(hA);
+    device_dense_vector<rocsparse_int> dperm(M);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrrcm_buffer_size(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrrcm(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm, dbuffer));
+
+        // CPU reverse Cuthill-McKee
+        host_vector<rocsparse_int> hcsr_row_ptr(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind(hA.nnz);
+        host_vector<rocsparse_int> hperm_gold(M);
+
+        for(rocsparse_int i = 0; i <= M; ++i)
+        {
+            hcsr_row_ptr[i] = hA.ptr[i];
+        }
+
+        for(rocsparse_int i = 0; i < hA.nnz; ++i)
+        {
+            hcsr_col_ind[i] = hA.ind[i];
+        }
+
+        host_csrrcm(M, hcsr_row_ptr, hcsr_col_ind, base, hperm_gold);
+
+        host_dense_vector<rocsparse_int> hperm(dperm);
+
+        unit_check_general<rocsparse_int>(1, M, 1, hperm_gold, hperm);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrrcm(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm, dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrrcm(handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm, dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_csrrcm_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrrcm<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -125,6 +125,29 @@ void testing_csrsv_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(handle, descr, info, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrsv_level_count()
+    rocsparse_int nlevels;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_count(nullptr, rocsparse_operation_none, descr, info, &nlevels),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_count(handle, rocsparse_operation_none, nullptr, info, &nlevels),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_count(handle, rocsparse_operation_none, descr, nullptr, &nlevels),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_count(handle, rocsparse_operation_none, descr, info, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrsv_jacobi_sweeps()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_jacobi_sweeps(nullptr, info, 1),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_jacobi_sweeps(handle, nullptr, 1),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_jacobi_sweeps(handle, info, 0),
+                            rocsparse_status_invalid_value);
+
     // Test rocsparse_csrsv_clear()
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_clear(nullptr, descr, info),
                             rocsparse_status_invalid_handle);
@@ -134,6 +157,47 @@ void testing_csrsv_bad_arg(const Arguments& arg)
                             rocsparse_status_invalid_pointer);
 }
 
+// Number of levels of the triangular part of A that is used by csrsv
+template <typename T>
+static rocsparse_int host_csrsv_level_count(const host_csr_matrix<T>& A,
+                                            rocsparse_operation       trans,
+                                            rocsparse_fill_mode       uplo)
+{
+    std::vector<rocsparse_int> level(A.m, 1);
+
+    // Lower triangular part of A for non-transposed, upper for transposed solve are
+    // processed in forward order
+    bool forward = (uplo == rocsparse_fill_mode_lower) == (trans == rocsparse_operation_none);
+
+    for(rocsparse_int k = 0; k < A.m; ++k)
+    {
+        rocsparse_int i = forward ? k : A.m - 1 - k;
+
+        for(rocsparse_int j = A.ptr[i] - A.base; j < A.ptr[i + 1] - A.base; ++j)
+        {
+            rocsparse_int col = A.ind[j] - A.base;
+
+            if((uplo == rocsparse_fill_mode_lower) ? (col >= i) : (col <= i))
+            {
+                continue;
+            }
+
+            if(trans == rocsparse_operation_none)
+            {
+                // Row i depends on row col
+                level[i] = std::max(level[i], level[col] + 1);
+            }
+            else
+            {
+                // Row col of the transposed matrix depends on row i
+                level[col] = std::max(level[col], level[i] + 1);
+            }
+        }
+    }
+
+    return *std::max_element(level.begin(), level.end());
+}
+
 template <typename T>
 void testing_csrsv(const Arguments& arg)
 {
@@ -241,6 +305,10 @@ void testing_csrsv(const Arguments& arg)
     {
         host_scalar<rocsparse_int> analysis_no_pivot(-1);
         host_dense_matrix<T>       hy(M, 1);
+
+        // Jacobi sweeps are exact once their number reaches the number of levels
+        rocsparse_int nsweeps = std::max(host_csrsv_level_count(hA, trans, uplo), 1);
+
         // CPU csrsv
         host_csrsv<T>(trans,
                       hA.m,
@@ -279,6 +347,7 @@ void testing_csrsv(const Arguments& arg)
             // Call it twice.
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, info, nsweeps));
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(handle, descr, info, analysis_pivot),
                                     (*analysis_pivot != -1) ? rocsparse_status_zero_pivot
                                                             : rocsparse_status_success);
@@ -290,6 +359,16 @@ void testing_csrsv(const Arguments& arg)
             CHECK_HIP_ERROR(hipDeviceSynchronize());
             h_analysis_pivot.unit_check(analysis_pivot);
             h_solve_pivot.unit_check(solve_pivot);
+
+            // Check number of levels
+            rocsparse_int nlevels;
+            rocsparse_int hnlevels
+                = (trans == rocsparse_operation_transpose && spol == rocsparse_solve_policy_push)
+                      ? 0
+                      : host_csrsv_level_count(hA, trans, uplo);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrsv_level_count(handle, trans, descr, info, &nlevels));
+            unit_check_general<rocsparse_int>(1, 1, 1, &hnlevels, &nlevels);
         }
 
         if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
@@ -328,6 +407,7 @@ void testing_csrsv(const Arguments& arg)
             // Call it twice.
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, info, nsweeps));
             EXPECT_ROCSPARSE_STATUS(
                 rocsparse_csrsv_zero_pivot(handle, descr, info, d_analysis_pivot),
                 (*h_analysis_pivot != -1) ? rocsparse_status_zero_pivot : rocsparse_status_success);
@@ -346,6 +426,178 @@ void testing_csrsv(const Arguments& arg)
             hy.near_check(dy, tol);
         }
 
+        //
+        // RE-USE ANALYSIS DATA OF ANOTHER SOLVE POLICY.
+        //
+        if(apol == rocsparse_analysis_policy_reuse)
+        {
+            // Meta data without level information, or created for the other kind of
+            // transposed solve, has to be re-built for spol
+            rocsparse_solve_policy other = (spol == rocsparse_solve_policy_auto)
+                                               ? rocsparse_solve_policy_push
+                                               : rocsparse_solve_policy_auto;
+
+            info.reset();
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              trans,
+                                                              dA.m,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info,
+                                                              apol,
+                                                              other,
+                                                              dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, info, nsweeps));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            // The push analysis does not compute levels
+            rocsparse_int nlevels;
+            rocsparse_int hnlevels
+                = (trans == rocsparse_operation_transpose && spol == rocsparse_solve_policy_push)
+                      ? 0
+                      : host_csrsv_level_count(hA, trans, uplo);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrsv_level_count(handle, trans, descr, info, &nlevels));
+            unit_check_general<rocsparse_int>(1, 1, 1, &hnlevels, &nlevels);
+
+            if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+            {
+                hy.near_check(dy, tol);
+            }
+        }
+
+        //
+        // SOLVE WITH EXPORTED AND IMPORTED ANALYSIS DATA.
+        //
+        {
+            size_t blob_size;
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_export_size(handle, info, &blob_size));
+
+            std::vector<char> blob(blob_size);
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_export(
+                handle, dA.m, dA.n, dA.nnz, descr, dA.ptr, dA.ind, info, blob.data()));
+
+            rocsparse_local_mat_info imported;
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_import(handle,
+                                                            dA.m,
+                                                            dA.n,
+                                                            dA.nnz,
+                                                            descr,
+                                                            dA.ptr,
+                                                            dA.ind,
+                                                            imported,
+                                                            blob.data(),
+                                                            blob_size));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, imported, nsweeps));
+
+            // Importing into an info structure that holds meta data is not allowed
+            EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_import(handle,
+                                                              dA.m,
+                                                              dA.n,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info,
+                                                              blob.data(),
+                                                              blob_size),
+                                    rocsparse_status_invalid_value);
+
+            // Truncated data, within the meta data and within the header
+            rocsparse_local_mat_info rejected;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_import(handle,
+                                                              dA.m,
+                                                              dA.n,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              rejected,
+                                                              blob.data(),
+                                                              blob_size - 8),
+                                    rocsparse_status_invalid_value);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_import(handle,
+                                                              dA.m,
+                                                              dA.n,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              rejected,
+                                                              blob.data(),
+                                                              16),
+                                    rocsparse_status_invalid_value);
+
+            // Corrupted magic number, version, sparsity pattern checksum and meta data.
+            // The header starts with the 64 bit magic number and the 32 bit version, the
+            // sparsity pattern checksum is stored at byte 24.
+            const size_t corrupted_offsets[] = {0, 8, 24, blob_size - 1};
+            for(size_t offset : corrupted_offsets)
+            {
+                std::vector<char> corrupted(blob);
+                corrupted[offset] ^= 0x10;
+
+                EXPECT_ROCSPARSE_STATUS(rocsparse_mat_info_import(handle,
+                                                                  dA.m,
+                                                                  dA.n,
+                                                                  dA.nnz,
+                                                                  descr,
+                                                                  dA.ptr,
+                                                                  dA.ind,
+                                                                  rejected,
+                                                                  corrupted.data(),
+                                                                  blob_size),
+                                        rocsparse_status_invalid_value);
+            }
+
+            // Failed imports leave no meta data behind, such that valid data can still
+            // be imported
+            CHECK_ROCSPARSE_ERROR(rocsparse_mat_info_import(handle,
+                                                            dA.m,
+                                                            dA.n,
+                                                            dA.nnz,
+                                                            descr,
+                                                            dA.ptr,
+                                                            dA.ind,
+                                                            rejected,
+                                                            blob.data(),
+                                                            blob_size));
+
+            host_scalar<rocsparse_int> solve_pivot;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(T) * M));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                           trans,
+                                                           dA.m,
+                                                           dA.nnz,
+                                                           h_alpha,
+                                                           descr,
+                                                           dA.val,
+                                                           dA.ptr,
+                                                           dA.ind,
+                                                           imported,
+                                                           dx,
+                                                           dy,
+                                                           spol,
+                                                           dbuffer));
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_csrsv_zero_pivot(handle, descr, imported, solve_pivot),
+                (*h_solve_pivot != -1) ? rocsparse_status_zero_pivot : rocsparse_status_success);
+            h_solve_pivot.unit_check(solve_pivot);
+        }
+
+        if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            hy.near_check(dy, tol);
+        }
+
         //
         // A BIT MORE FOR CODE COVERAGE, WE ONLY DO ANALYSIS FOR INFO ASSIGNMENT.
         //
@@ -523,6 +775,7 @@ void testing_csrsv(const Arguments& arg)
         int number_hot_calls  = arg.iters;
 
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, info, arg.nsweeps));
 
         // Warm up
         for(int iter = 0; iter < number_cold_calls; ++iter)
@@ -0,0 +1,272 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_gtsv_interleaved_batch_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle               handle       = local_handle;
+    rocsparse_gtsv_interleaved_alg alg          = rocsparse_gtsv_interleaved_alg_default;
+    rocsparse_int                  m            = safe_size;
+    rocsparse_int                  batch_count  = safe_size;
+    rocsparse_int                  batch_stride = safe_size;
+    const T*                       dl1          = (const T*)0x4;
+    const T*                       d1           = (const T*)0x4;
+    const T*                       du1          = (const T*)0x4;
+    const T*                       x1           = (const T*)0x4;
+    T*                             dl2          = (T*)0x4;
+    T*                             d2           = (T*)0x4;
+    T*                             du2          = (T*)0x4;
+    T*                             x2           = (T*)0x4;
+    size_t*                        buffer_size  = (size_t*)0x4;
+    void*                          temp_buffer  = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, alg, m, dl1, d1, du1, x1, batch_count, batch_stride, buffer_size
+#define PARAMS_SOLVE handle, alg, m, dl2, d2, du2, x2, batch_count, batch_stride, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_gtsv_interleaved_batch_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_gtsv_interleaved_batch<T>, PARAMS_SOLVE);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_SOLVE
+}
+
+template <typename T>
+void testing_gtsv_interleaved_batch(const Arguments& arg)
+{
+    rocsparse_gtsv_interleaved_alg alg          = arg.gtsv_interleaved_alg;
+    rocsparse_int                  m            = arg.M;
+    rocsparse_int                  batch_count  = arg.N;
+    rocsparse_int                  batch_stride = arg.denseld;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+#define PARAMS_BUFFER_SIZE handle, alg, m, ddl, dd, ddu, dx, batch_count, batch_stride, &buffer_size
+#define PARAMS_SOLVE handle, alg, m, ddl, dd, ddu, dx, batch_count, batch_stride, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 1 || batch_count <= 0 || batch_stride < batch_count)
+    {
+        size_t buffer_size;
+        T*     ddl     = nullptr;
+        T*     dd      = nullptr;
+        T*     ddu     = nullptr;
+        T*     dx      = nullptr;
+        void*  dbuffer = nullptr;
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_gtsv_interleaved_batch_buffer_size<T>(PARAMS_BUFFER_SIZE),
+            (m <= 1 || batch_count < 0 || batch_stride < batch_count)
+                ? rocsparse_status_invalid_size
+                : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE),
+                                (m <= 1 || batch_count < 0 || batch_stride < batch_count)
+                                    ? rocsparse_status_invalid_size
+                                    : rocsparse_status_success);
+
+        return;
+    }
+
+    rocsparse_seedrand();
+
+    // Host tri-diagonal matrix, where entry i of system j is stored at i * batch_stride + j
+    host_vector<T> hdl(m * batch_stride, static_cast<T>(7));
+    host_vector<T> hd(m * batch_stride, static_cast<T>(7));
+    host_vector<T> hdu(m * batch_stride, static_cast<T>(7));
+
+    // Initialize tri-diagonal matrix. Thomas algorithm requires a diagonally dominant
+    // matrix, whereas the pivoting algorithms are tested with small diagonal entries
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = 0; j < batch_count; ++j)
+        {
+            rocsparse_int idx = i * batch_stride + j;
+
+            if(alg == rocsparse_gtsv_interleaved_alg_thomas)
+            {
+                hdl[idx] = random_generator<T>(1, 8);
+                hd[idx]  = random_generator<T>(17, 32);
+                hdu[idx] = random_generator<T>(1, 8);
+            }
+            else
+            {
+                // Pairs of rows are coupled by large off-diagonal entries
+                bool even = (i & 1) == 0;
+
+                hdl[idx] = random_generator<T>(even ? 1 : 17, even ? 4 : 32);
+                hd[idx]  = random_generator<T>(-1, 1);
+                hdu[idx] = random_generator<T>(even ? 17 : 1, even ? 32 : 4);
+
+                // Last row of an odd sized system has no partner row to pivot with
+                if(i == m - 1 && even)
+                {
+                    hd[idx] = random_generator<T>(17, 32);
+                }
+            }
+        }
+    }
+
+    for(rocsparse_int j = 0; j < batch_count; ++j)
+    {
+        hdl[j]                          = static_cast<T>(0);
+        hdu[(m - 1) * batch_stride + j] = static_cast<T>(0);
+    }
+
+    // Host dense rhs
+    host_vector<T> hx(m * batch_stride, static_cast<T>(7));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = 0; j < batch_count; ++j)
+        {
+            hx[i * batch_stride + j] = random_generator<T>(-10, 10);
+        }
+    }
+
+    host_vector<T> hx_original = hx;
+
+    // Device tri-diagonal matrix
+    device_vector<T> ddl(m * batch_stride);
+    device_vector<T> dd(m * batch_stride);
+    device_vector<T> ddu(m * batch_stride);
+
+    // Device dense rhs
+    device_vector<T> dx(m * batch_stride);
+
+    // Copy to device
+    ddl.transfer_from(hdl);
+    dd.transfer_from(hd);
+    ddu.transfer_from(hdu);
+    dx.transfer_from(hx);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch_buffer_size<T>(PARAMS_BUFFER_SIZE));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE));
+
+        hx.transfer_from(dx);
+
+        // Check
+        std::vector<T> hresult(m * batch_stride, static_cast<T>(7));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(rocsparse_int j = 0; j < batch_count; j++)
+        {
+            for(rocsparse_int i = 0; i < m; i++)
+            {
+                rocsparse_int idx = i * batch_stride + j;
+
+                T sum = hd[idx] * hx[idx];
+
+                if(i > 0)
+                {
+                    sum += hdl[idx] * hx[idx - batch_stride];
+                }
+
+                if(i < m - 1)
+                {
+                    sum += hdu[idx] * hx[idx + batch_stride];
+                }
+
+                hresult[idx] = sum;
+            }
+        }
+
+        near_check_general<T>(1, m * batch_stride, 1, hx_original.data(), hresult.data());
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE));
+        }
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gbyte_count = gtsv_strided_batch_gbyte_count<T>(m, batch_count);
+
+        double gpu_gbyte = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "batch_count" << std::setw(12)
+                  << "batch_stride" << std::setw(12) << "algorithm" << std::setw(12) << "GB/s"
+                  << std::setw(12) << "solve_msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << m << std::setw(12) << batch_count << std::setw(12)
+                  << batch_stride << std::setw(12) << rocsparse_gtsvinterleavedalg2string(alg)
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_solve_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_SOLVE
+}
+
+#define INSTANTIATE(TYPE)                                                             \
+    template void testing_gtsv_interleaved_batch_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_gtsv_interleaved_batch<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
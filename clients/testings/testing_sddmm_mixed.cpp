@@ -0,0 +1,316 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_sddmm_mixed.hpp"
+
+#include <hip/hip_bfloat16.h>
+
+template <typename I, typename J, typename T, typename X>
+static void testing_sddmm_mixed_bad_arg_template(const Arguments& arg)
+{
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(1);
+
+    rocsparse_local_handle handle;
+
+    rocsparse_operation trans_A     = rocsparse_operation_none;
+    rocsparse_operation trans_B     = rocsparse_operation_none;
+    rocsparse_datatype  ttype       = get_datatype<T>();
+    rocsparse_sddmm_alg alg         = rocsparse_sddmm_alg_default;
+    size_t              buffer_size = 0;
+    void*               dbuffer     = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE \
+    handle, trans_A, trans_B, &h_alpha, A, B, &h_beta, C, ttype, alg, &buffer_size
+#define PARAMS handle, trans_A, trans_B, &h_alpha, A, B, &h_beta, C, ttype, alg, dbuffer
+
+    {
+        //
+        // A AND B MUST BE STORED IN THE SAME PRECISION.
+        //
+        device_dense_matrix<X>     dA(0, 0);
+        device_dense_matrix<T>     dB(0, 0);
+        device_csr_matrix<T, I, J> dC;
+        rocsparse_local_dnmat      A(dA);
+        rocsparse_local_dnmat      B(dB);
+        rocsparse_local_spmat      C(dC);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_buffer_size(PARAMS_BUFFER_SIZE),
+                                rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_preprocess(PARAMS),
+                                rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    {
+        //
+        // C MUST BE STORED IN THE COMPUTE PRECISION.
+        //
+        device_dense_matrix<X>     dA(0, 0);
+        device_dense_matrix<X>     dB(0, 0);
+        device_csr_matrix<X, I, J> dC;
+        rocsparse_local_dnmat      A(dA);
+        rocsparse_local_dnmat      B(dB);
+        rocsparse_local_spmat      C(dC);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_buffer_size(PARAMS_BUFFER_SIZE),
+                                rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_preprocess(PARAMS),
+                                rocsparse_status_not_implemented);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm(PARAMS), rocsparse_status_not_implemented);
+    }
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename I, typename J, typename T, typename X>
+static void testing_sddmm_mixed_template(const Arguments& arg)
+{
+    J                    M       = arg.M;
+    J                    N       = arg.N;
+    J                    K       = arg.K;
+    rocsparse_operation  trans_A = arg.transA;
+    rocsparse_operation  trans_B = arg.transB;
+    rocsparse_index_base base    = arg.baseA;
+    rocsparse_sddmm_alg  alg     = rocsparse_sddmm_alg_default;
+    rocsparse_order      order   = arg.order;
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS_BUFFER_SIZE(alpha_, A_, B_, beta_, C_) \
+    handle, trans_A, trans_B, alpha_, A_, B_, beta_, C_, ttype, alg, &buffer_size
+#define PARAMS(alpha_, A_, B_, beta_, C_) \
+    handle, trans_A, trans_B, alpha_, A_, B_, beta_, C_, ttype, alg, dbuffer
+
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        if(M == 0 || N == 0 || K == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            device_dense_matrix<X>     dA(0, 0, order);
+            device_dense_matrix<X>     dB(0, 0, order);
+            device_csr_matrix<T, I, J> dC;
+
+            rocsparse_local_dnmat A(dA);
+            rocsparse_local_dnmat B(dB);
+            rocsparse_local_spmat C(dC);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_sddmm_buffer_size(PARAMS_BUFFER_SIZE(h_alpha, A, B, h_beta, C)),
+                rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm_preprocess(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_sddmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+        return;
+    }
+
+    // Sparsity pattern and values of C
+    host_csr_matrix<T, I, J> hC;
+    {
+        static constexpr bool             to_int    = true;
+        static constexpr bool             full_rank = false;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hC, M, N, base);
+    }
+
+    device_csr_matrix<T, I, J> dC(hC);
+
+    // Generate the dense matrices in the compute precision, using integer values such that
+    // the conversion into the storage precision is exact
+    host_dense_matrix<T> hA((trans_A == rocsparse_operation_none) ? M : K,
+                            (trans_A == rocsparse_operation_none) ? K : M,
+                            order);
+    host_dense_matrix<T> hB((trans_B == rocsparse_operation_none) ? K : N,
+                            (trans_B == rocsparse_operation_none) ? N : K,
+                            order);
+    rocsparse_matrix_utils::init_exact(hA);
+    rocsparse_matrix_utils::init_exact(hB);
+
+    host_dense_matrix<X> hA_mixed(hA.m, hA.n, order);
+    host_dense_matrix<X> hB_mixed(hB.m, hB.n, order);
+    for(rocsparse_int i = 0; i < hA.m * hA.n; ++i)
+    {
+        hA_mixed.val[i] = static_cast<X>(hA.val[i]);
+    }
+    for(rocsparse_int i = 0; i < hB.m * hB.n; ++i)
+    {
+        hB_mixed.val[i] = static_cast<X>(hB.val[i]);
+    }
+
+    device_dense_matrix<X> dA(hA_mixed);
+    device_dense_matrix<X> dB(hB_mixed);
+
+    rocsparse_local_dnmat A(dA);
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_spmat C(dC);
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_sddmm_buffer_size(PARAMS_BUFFER_SIZE(h_alpha, A, B, h_beta, C)));
+    void* dbuffer = nullptr;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, std::max(buffer_size, sizeof(I))));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sddmm_preprocess(PARAMS(h_alpha, A, B, h_beta, C)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sddmm(PARAMS(h_alpha, A, B, h_beta, C)));
+
+        // CPU csrddmm in the compute precision
+        host_vector<T> hC_val_copy(hC.val);
+        rocsparse_host<T, I, J>::csrddmm(trans_A,
+                                         trans_B,
+                                         hA.order,
+                                         hB.order,
+                                         hC.m,
+                                         hC.n,
+                                         K,
+                                         hC.nnz,
+                                         h_alpha,
+                                         hA,
+                                         hA.ld,
+                                         hB,
+                                         hB.ld,
+                                         h_beta,
+                                         hC.ptr,
+                                         hC.ind,
+                                         hC.val,
+                                         hC.base);
+        hC.near_check(dC);
+        dC.val.transfer_from(hC_val_copy);
+
+        // Pointer mode device
+        device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sddmm_preprocess(PARAMS(d_alpha, A, B, d_beta, C)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_sddmm(PARAMS(d_alpha, A, B, d_beta, C)));
+
+        hC.near_check(dC);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sddmm_preprocess(PARAMS(h_alpha, A, B, h_beta, C)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_sddmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sddmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = rocsparse_gflop_count<rocsparse_format_csr>::sddmm(
+            dC.m, dC.n, dC.nnz, K, *h_beta != static_cast<T>(0));
+        double gbyte_count = csrddmm_mixed_gbyte_count<I, J, X, T>(
+            dC.m, dC.n, dC.nnz, K, *h_beta != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("transA",
+                            rocsparse_operation2string(trans_A),
+                            "transB",
+                            rocsparse_operation2string(trans_B),
+                            "M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "nnz",
+                            dC.nnz,
+                            "A, B",
+                            rocsparse_datatype2string(get_datatype<X>()),
+                            "alpha",
+                            *h_alpha,
+                            "beta",
+                            *h_beta,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+}
+
+//
+// The dense matrices are stored in f16 or bf16 (X) with single precision computation (T).
+//
+template <typename I, typename J, typename T>
+void testing_sddmm_mixed_bad_arg(const Arguments& arg)
+{
+    testing_sddmm_mixed_bad_arg_template<I, J, T, _Float16>(arg);
+    testing_sddmm_mixed_bad_arg_template<I, J, T, hip_bfloat16>(arg);
+}
+
+template <typename I, typename J, typename T>
+void testing_sddmm_mixed(const Arguments& arg)
+{
+    testing_sddmm_mixed_template<I, J, T, _Float16>(arg);
+    testing_sddmm_mixed_template<I, J, T, hip_bfloat16>(arg);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                  \
+    template void testing_sddmm_mixed_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_sddmm_mixed<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int64_t, float);
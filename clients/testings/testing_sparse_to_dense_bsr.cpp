@@ -0,0 +1,372 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+template <typename I, typename J, typename T>
+void testing_sparse_to_dense_bsr_bad_arg(const Arguments& arg)
+{
+    size_t safe_size = 100;
+    J      mb        = 5;
+    J      nb        = 5;
+    I      nnzb      = 5;
+    J      block_dim = 2;
+    I      ld        = mb * block_dim;
+
+    rocsparse_index_base          base  = rocsparse_index_base_zero;
+    rocsparse_direction           dir   = rocsparse_direction_row;
+    rocsparse_sparse_to_dense_alg alg   = rocsparse_sparse_to_dense_alg_default;
+    rocsparse_order               order = rocsparse_order_column;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    device_vector<T> d_dense_val(safe_size);
+    device_vector<I> d_bsr_row_ptr(mb + 1);
+    device_vector<J> d_bsr_col_ind(nnzb);
+    device_vector<T> d_bsr_val(nnzb * block_dim * block_dim);
+
+    if(!d_dense_val || !d_bsr_row_ptr || !d_bsr_col_ind || !d_bsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Sparse and dense matrix structures
+    rocsparse_local_spmat mat_A(mb,
+                                nb,
+                                nnzb,
+                                dir,
+                                block_dim,
+                                d_bsr_row_ptr,
+                                d_bsr_col_ind,
+                                d_bsr_val,
+                                itype,
+                                jtype,
+                                base,
+                                ttype);
+    rocsparse_local_dnmat mat_B(mb * block_dim, nb * block_dim, ld, d_dense_val, ttype, order);
+
+    // Test sparse_to_dense with invalid buffer
+    size_t buffer_size;
+
+    // Testing invalid handle.
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(nullptr, mat_A, mat_B, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_handle);
+
+    // Testing invalid pointers.
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(handle, nullptr, mat_B, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(handle, mat_A, nullptr, alg, &buffer_size, nullptr),
+        rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(rocsparse_sparse_to_dense(handle, mat_A, mat_B, alg, nullptr, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test sparse_to_dense with valid buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, 100));
+
+    // Testing invalid handle.
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(nullptr, mat_A, mat_B, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_handle);
+
+    // Testing invalid pointers.
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(handle, nullptr, mat_B, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_sparse_to_dense(handle, mat_A, nullptr, alg, &buffer_size, dbuffer),
+        rocsparse_status_invalid_pointer);
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+template <typename I, typename J, typename T>
+void testing_sparse_to_dense_bsr(const Arguments& arg)
+{
+    J                             M         = arg.M;
+    J                             N         = arg.N;
+    I                             ld        = arg.denseld;
+    J                             block_dim = arg.block_dim;
+    rocsparse_direction           dir       = arg.direction;
+    rocsparse_index_base          base      = arg.baseA;
+    rocsparse_sparse_to_dense_alg alg       = arg.sparse_to_dense_alg;
+    rocsparse_order               order     = arg.order;
+
+    // BSR dimensions
+    J mb = (block_dim > 0) ? (M + block_dim - 1) / block_dim : 0;
+    J nb = (block_dim > 0) ? (N + block_dim - 1) / block_dim : 0;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || block_dim <= 0)
+    {
+        if(M == 0 && N == 0 && block_dim > 0)
+        {
+            static const size_t safe_size = 100;
+
+            device_vector<I> d_bsr_row_ptr(safe_size);
+            device_vector<T> d_dense_val(safe_size);
+
+            if(!d_bsr_row_ptr || !d_dense_val)
+            {
+                CHECK_HIP_ERROR(hipErrorOutOfMemory);
+                return;
+            }
+
+            rocsparse_local_spmat mat_A(mb,
+                                        nb,
+                                        0,
+                                        dir,
+                                        block_dim,
+                                        d_bsr_row_ptr,
+                                        nullptr,
+                                        nullptr,
+                                        itype,
+                                        jtype,
+                                        base,
+                                        ttype);
+            rocsparse_local_dnmat mat_B(M, N, ld, d_dense_val, ttype, order);
+
+            size_t buffer_size;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_sparse_to_dense(handle, mat_A, mat_B, alg, &buffer_size, nullptr),
+                rocsparse_status_success);
+
+            void* dbuffer;
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, safe_size));
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_sparse_to_dense(handle, mat_A, mat_B, alg, &buffer_size, dbuffer),
+                rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Sample the block sparsity pattern and fill the blocks with random values
+    rocsparse_matrix_factory<T, I, J> matrix_factory(arg);
+
+    host_csr_matrix<T, I, J> hpattern;
+    matrix_factory.init_csr(hpattern, mb, nb, base);
+
+    host_gebsr_matrix<T, I, J> hA;
+    hA.define(dir, mb, nb, hpattern.nnz, block_dim, block_dim, base);
+
+    for(J i = 0; i <= mb; ++i)
+    {
+        hA.ptr[i] = hpattern.ptr[i];
+    }
+
+    for(I k = 0; k < hA.nnzb; ++k)
+    {
+        hA.ind[k] = hpattern.ind[k];
+    }
+
+    for(I k = 0; k < hA.nnzb * block_dim * block_dim; ++k)
+    {
+        hA.val[k] = random_generator<T>(1, 9);
+    }
+
+    device_gebsr_matrix<T, I, J> dA(hA);
+
+    // Dense matrix dimensions
+    M = mb * block_dim;
+    N = nb * block_dim;
+
+    I mn = (order == rocsparse_order_column) ? M : N;
+    I nm = (order == rocsparse_order_column) ? N : M;
+
+    if(ld < mn)
+    {
+        return;
+    }
+
+    // Padding of the leading dimension must remain untouched
+    host_vector<T>   h_dense_val(ld * nm, static_cast<T>(-2));
+    device_vector<T> d_dense_val(ld * nm);
+
+    if(!d_dense_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_dense_val, h_dense_val, sizeof(T) * ld * nm, hipMemcpyHostToDevice));
+
+    rocsparse_local_spmat mat_sparse(dA);
+    rocsparse_local_dnmat mat_dense(M, N, ld, d_dense_val, ttype, order);
+
+    // Find size of required temporary buffer
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_sparse_to_dense(handle, mat_sparse, mat_dense, alg, &buffer_size, nullptr));
+
+    // Allocate temporary buffer on device
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_sparse_to_dense(handle, mat_sparse, mat_dense, alg, &buffer_size, dbuffer));
+
+        host_vector<T> gpu_dense_val(ld * nm);
+        CHECK_HIP_ERROR(
+            hipMemcpy(gpu_dense_val, d_dense_val, sizeof(T) * ld * nm, hipMemcpyDeviceToHost));
+
+        // Host bsr2dense
+        host_vector<T> cpu_dense_val = h_dense_val;
+
+        for(I j = 0; j < nm; ++j)
+        {
+            for(I i = 0; i < mn; ++i)
+            {
+                cpu_dense_val[j * ld + i] = static_cast<T>(0);
+            }
+        }
+
+        for(J bi = 0; bi < mb; ++bi)
+        {
+            for(I k = hA.ptr[bi] - base; k < hA.ptr[bi + 1] - base; ++k)
+            {
+                J bj = hA.ind[k] - base;
+
+                for(J r = 0; r < block_dim; ++r)
+                {
+                    for(J c = 0; c < block_dim; ++c)
+                    {
+                        I idx = k * block_dim * block_dim
+                                + ((dir == rocsparse_direction_row) ? r * block_dim + c
+                                                                    : c * block_dim + r);
+
+                        I row = static_cast<I>(bi) * block_dim + r;
+                        I col = static_cast<I>(bj) * block_dim + c;
+
+                        if(order == rocsparse_order_column)
+                        {
+                            cpu_dense_val[col * ld + row] = hA.val[idx];
+                        }
+                        else
+                        {
+                            cpu_dense_val[row * ld + col] = hA.val[idx];
+                        }
+                    }
+                }
+            }
+        }
+
+        // Compare including the padding
+        unit_check_general(ld, nm, ld, (T*)cpu_dense_val, (T*)gpu_dense_val);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm-up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sparse_to_dense(
+                handle, mat_sparse, mat_dense, alg, &buffer_size, dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_sparse_to_dense(
+                handle, mat_sparse, mat_dense, alg, &buffer_size, dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gbyte_count = bsr2dense_gbyte_count<T>(mb, nb, hA.nnzb, block_dim);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "LD",
+                            ld,
+                            "BSR dim",
+                            block_dim,
+                            "dir",
+                            rocsparse_direction2string(dir),
+                            "order",
+                            rocsparse_order2string(order),
+                            "nnzb",
+                            hA.nnzb,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TYPE)                                                          \
+    template void testing_sparse_to_dense_bsr_bad_arg<ITYPE, JTYPE, TYPE>(const Arguments& arg); \
+    template void testing_sparse_to_dense_bsr<ITYPE, JTYPE, TYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
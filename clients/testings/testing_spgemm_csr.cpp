@@ -323,6 +323,96 @@ void testing_spgemm_csr_bad_arg(const Arguments& arg)
     CHECK_HIP_ERROR(hipFree(dbuffer));
 }
 
+// Collects the chunks of C computed by rocsparse_spgemm_chunked
+template <typename I, typename J, typename T>
+struct spgemm_chunked_data
+{
+    host_csr_matrix<T, I, J>* C;
+    I                         nnz;
+};
+
+template <typename I, typename J, typename T>
+rocsparse_status spgemm_chunked_callback(int64_t     row_begin,
+                                         int64_t     row_end,
+                                         int64_t     nnz,
+                                         const void* csr_row_ptr,
+                                         const void* csr_col_ind,
+                                         const void* csr_val,
+                                         void*       user_data)
+{
+    spgemm_chunked_data<I, J, T>* data = (spgemm_chunked_data<I, J, T>*)user_data;
+
+    if(data->nnz + nnz > data->C->nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    I* ptr = data->C->ptr;
+    J* ind = data->C->ind;
+    T* val = data->C->val;
+
+    for(int64_t i = 0; i <= row_end - row_begin; ++i)
+    {
+        ptr[row_begin + i] = ((const I*)csr_row_ptr)[i] + data->nnz;
+    }
+
+    for(int64_t j = 0; j < nnz; ++j)
+    {
+        ind[data->nnz + j] = ((const J*)csr_col_ind)[j];
+        val[data->nnz + j] = ((const T*)csr_val)[j];
+    }
+
+    data->nnz += nnz;
+
+    return rocsparse_status_success;
+}
+
+// Restricts C to the (complemented) sparsity pattern of the mask M
+template <typename I, typename J, typename T>
+void host_spgemm_mask(const host_csr_matrix<T, I, J>& C,
+                      const host_csr_matrix<T, I, J>& M,
+                      bool                            complement,
+                      host_csr_matrix<T, I, J>&       C_masked)
+{
+    std::vector<I> ptr(C.m + 1, C.base);
+    std::vector<J> ind;
+    std::vector<T> val;
+
+    const I* ptr_C = C.ptr;
+    const J* ind_C = C.ind;
+    const T* val_C = C.val;
+    const I* ptr_M = M.ptr;
+    const J* ind_M = M.ind;
+
+    for(J i = 0; i < C.m; ++i)
+    {
+        for(I j = ptr_C[i] - C.base; j < ptr_C[i + 1] - C.base; ++j)
+        {
+            J    col   = ind_C[j] - C.base;
+            bool found = std::binary_search(
+                ind_M + ptr_M[i] - M.base, ind_M + ptr_M[i + 1] - M.base, col + M.base);
+
+            if(found != complement)
+            {
+                ind.push_back(ind_C[j]);
+                val.push_back(val_C[j]);
+            }
+        }
+
+        ptr[i + 1] = static_cast<I>(ind.size()) + C.base;
+    }
+
+    C_masked.define(C.m, C.n, static_cast<I>(ind.size()), C.base);
+
+    I* ptr_masked = C_masked.ptr;
+    J* ind_masked = C_masked.ind;
+    T* val_masked = C_masked.val;
+
+    std::copy(ptr.begin(), ptr.end(), ptr_masked);
+    std::copy(ind.begin(), ind.end(), ind_masked);
+    std::copy(val.begin(), val.end(), val_masked);
+}
+
 template <typename I, typename J, typename T>
 void testing_spgemm_csr(const Arguments& arg)
 {
@@ -570,6 +660,311 @@ void testing_spgemm_csr(const Arguments& arg)
                 hC.near_check(dC);
             }
 
+            //
+            // Re-compute C with the symbolic and numeric stages.
+            //
+            {
+                size_t buffer_size;
+                void*  dbuffer = nullptr;
+
+                stage = rocsparse_spgemm_stage_buffer_size;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+                CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                stage = rocsparse_spgemm_stage_symbolic;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+
+                // Values of C must be entirely re-computed by the numeric stage
+                CHECK_HIP_ERROR(hipMemset(dC.val, 0, sizeof(T) * dC.nnz));
+
+                stage = rocsparse_spgemm_stage_numeric;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+                CHECK_HIP_ERROR(hipFree(dbuffer));
+
+                stage = rocsparse_spgemm_stage_auto;
+            }
+
+            hC.near_check(dC);
+
+            //
+            // Compute C in chunks with bounded device memory.
+            //
+            {
+                size_t buffer_size;
+                void*  dbuffer = nullptr;
+
+                stage = rocsparse_spgemm_stage_buffer_size;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+                stage = rocsparse_spgemm_stage_auto;
+
+                // Device memory budget, such that each chunk holds at least a single row of C
+                buffer_size = 2 * buffer_size
+                              + 4 * (sizeof(I) * (M + 1) + (sizeof(J) + sizeof(T)) * N + 1024);
+                CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                // C in pinned host memory, row offsets first. The descriptor of C only
+                // describes its sizes and types, its device arrays are not accessed.
+                host_csr              hC_chunked(M, N, 0, base_C);
+                device_csr            dC_chunked(M, N, 0, base_C);
+                rocsparse_local_spmat C_chunked(dC_chunked);
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_chunked(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               h_alpha_ptr,
+                                                               A,
+                                                               B,
+                                                               h_beta_ptr,
+                                                               D,
+                                                               C_chunked,
+                                                               ttype,
+                                                               alg,
+                                                               hC_chunked.ptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               buffer_size,
+                                                               dbuffer));
+
+                int64_t C_m, C_n, C_nnz;
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C_chunked, &C_m, &C_n, &C_nnz));
+                hC_chunked.define(hC_chunked.m, hC_chunked.n, C_nnz, hC_chunked.base);
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_chunked(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               h_alpha_ptr,
+                                                               A,
+                                                               B,
+                                                               h_beta_ptr,
+                                                               D,
+                                                               C_chunked,
+                                                               ttype,
+                                                               alg,
+                                                               hC_chunked.ptr,
+                                                               hC_chunked.ind,
+                                                               hC_chunked.val,
+                                                               nullptr,
+                                                               nullptr,
+                                                               buffer_size,
+                                                               dbuffer));
+
+                hC.near_check(hC_chunked);
+
+                // C passed to a callback chunk by chunk
+                host_csr                     hC_callback(M, N, hC.nnz, base_C);
+                spgemm_chunked_data<I, J, T> data = {&hC_callback, 0};
+
+                CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_chunked(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               h_alpha_ptr,
+                                                               A,
+                                                               B,
+                                                               h_beta_ptr,
+                                                               D,
+                                                               C,
+                                                               ttype,
+                                                               alg,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               spgemm_chunked_callback<I, J, T>,
+                                                               &data,
+                                                               buffer_size,
+                                                               dbuffer));
+
+                hC.near_check(hC_callback);
+
+                CHECK_HIP_ERROR(hipFree(dbuffer));
+            }
+
+            //
+            // Compute alpha * A * B restricted to the sparsity pattern of D and its complement.
+            //
+            if(h_alpha_ptr != nullptr)
+            {
+                host_csr hAB;
+
+                {
+                    I hAB_nnz = 0;
+                    hAB.define(M, N, hAB_nnz, base_C);
+                    host_csrgemm_nnz(M,
+                                     N,
+                                     K,
+                                     h_alpha_ptr,
+                                     hA.ptr,
+                                     hA.ind,
+                                     hB.ptr,
+                                     hB.ind,
+                                     (T*)nullptr,
+                                     hD.ptr,
+                                     hD.ind,
+                                     hAB.ptr,
+                                     &hAB_nnz,
+                                     hA.base,
+                                     hB.base,
+                                     hAB.base,
+                                     hD.base);
+                    hAB.define(hAB.m, hAB.n, hAB_nnz, hAB.base);
+                }
+
+                host_csrgemm(M,
+                             N,
+                             K,
+                             h_alpha_ptr,
+                             hA.ptr,
+                             hA.ind,
+                             hA.val,
+                             hB.ptr,
+                             hB.ind,
+                             hB.val,
+                             (T*)nullptr,
+                             hD.ptr,
+                             hD.ind,
+                             hD.val,
+                             hAB.ptr,
+                             hAB.ind,
+                             hAB.val,
+                             hA.base,
+                             hB.base,
+                             hAB.base,
+                             hD.base);
+
+                for(rocsparse_spgemm_mask mask :
+                    {rocsparse_spgemm_mask_structural, rocsparse_spgemm_mask_complement})
+                {
+                    host_csr hC_masked;
+                    host_spgemm_mask(
+                        hAB, hD, mask == rocsparse_spgemm_mask_complement, hC_masked);
+
+                    device_csr dC_masked;
+                    dC_masked.define(M, N, 0, base_C);
+                    rocsparse_local_spmat C_masked(dC_masked);
+
+                    size_t buffer_size;
+                    void*  dbuffer = nullptr;
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_masked(handle,
+                                                                  trans_A,
+                                                                  trans_B,
+                                                                  h_alpha_ptr,
+                                                                  A,
+                                                                  B,
+                                                                  D,
+                                                                  mask,
+                                                                  C_masked,
+                                                                  ttype,
+                                                                  alg,
+                                                                  stage,
+                                                                  &buffer_size,
+                                                                  dbuffer));
+                    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_masked(handle,
+                                                                  trans_A,
+                                                                  trans_B,
+                                                                  h_alpha_ptr,
+                                                                  A,
+                                                                  B,
+                                                                  D,
+                                                                  mask,
+                                                                  C_masked,
+                                                                  ttype,
+                                                                  alg,
+                                                                  stage,
+                                                                  &buffer_size,
+                                                                  dbuffer));
+
+                    int64_t C_m, C_n, C_nnz;
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C_masked, &C_m, &C_n, &C_nnz));
+                    dC_masked.define(dC_masked.m, dC_masked.n, C_nnz, dC_masked.base);
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(C_masked, dC_masked));
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_masked(handle,
+                                                                  trans_A,
+                                                                  trans_B,
+                                                                  h_alpha_ptr,
+                                                                  A,
+                                                                  B,
+                                                                  D,
+                                                                  mask,
+                                                                  C_masked,
+                                                                  ttype,
+                                                                  alg,
+                                                                  stage,
+                                                                  &buffer_size,
+                                                                  dbuffer));
+                    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+                    hC_masked.near_check(dC_masked);
+
+                    // C does not keep the mask, such that an unmasked product with the same
+                    // descriptor computes all entries of alpha * A * B
+                    dC_masked.define(M, N, 0, base_C);
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(C_masked, dC_masked));
+
+                    dbuffer = nullptr;
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(handle,
+                                                           trans_A,
+                                                           trans_B,
+                                                           h_alpha_ptr,
+                                                           A,
+                                                           B,
+                                                           (const T*)nullptr,
+                                                           D,
+                                                           C_masked,
+                                                           ttype,
+                                                           alg,
+                                                           rocsparse_spgemm_stage_buffer_size,
+                                                           &buffer_size,
+                                                           dbuffer));
+                    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(handle,
+                                                           trans_A,
+                                                           trans_B,
+                                                           h_alpha_ptr,
+                                                           A,
+                                                           B,
+                                                           (const T*)nullptr,
+                                                           D,
+                                                           C_masked,
+                                                           ttype,
+                                                           alg,
+                                                           rocsparse_spgemm_stage_nnz,
+                                                           &buffer_size,
+                                                           dbuffer));
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C_masked, &C_m, &C_n, &C_nnz));
+                    dC_masked.define(dC_masked.m, dC_masked.n, C_nnz, dC_masked.base);
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(C_masked, dC_masked));
+
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(handle,
+                                                           trans_A,
+                                                           trans_B,
+                                                           h_alpha_ptr,
+                                                           A,
+                                                           B,
+                                                           (const T*)nullptr,
+                                                           D,
+                                                           C_masked,
+                                                           ttype,
+                                                           alg,
+                                                           rocsparse_spgemm_stage_compute,
+                                                           &buffer_size,
+                                                           dbuffer));
+                    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+                    hAB.near_check(dC_masked);
+                }
+            }
+
             {
                 device_vector<T> d_alpha(1);
                 device_vector<T> d_beta(1);
@@ -757,8 +1152,206 @@ void testing_spgemm_csr(const Arguments& arg)
     }
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                 \
-    template void testing_spgemm_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+// Builds an m x n matrix with nnz_per_row entries in each row, where entry j of row i is
+// located in column col(i, j). Columns have to be strictly increasing in j.
+template <typename I, typename J, typename T, typename F>
+static void testing_spgemm_csr_pattern(host_csr_matrix<T, I, J>& A, J m, J n, J nnz_per_row, F col)
+{
+    A.define(m, n, static_cast<I>(m) * nnz_per_row, rocsparse_index_base_zero);
+
+    A.ptr[0] = 0;
+    for(J i = 0; i < m; ++i)
+    {
+        for(J j = 0; j < nnz_per_row; ++j)
+        {
+            I idx = static_cast<I>(i) * nnz_per_row + j;
+
+            A.ind[idx] = col(i, j);
+            A.val[idx] = static_cast<T>(static_cast<int>((i + j) % 3) + 1);
+        }
+
+        A.ptr[i + 1] = static_cast<I>(i + 1) * nnz_per_row;
+    }
+}
+
+// Computes C = A * B with the default algorithm for sparsity patterns, where the rows of C
+// fall into the same group and the default algorithm selects the dense, the ESC or the hash
+// accumulator for this group.
+template <typename I, typename J, typename T>
+void testing_spgemm_csr_accumulators(const Arguments& arg)
+{
+    using host_csr   = host_csr_matrix<T, I, J>;
+    using device_csr = device_csr_matrix<T, I, J>;
+
+    rocsparse_local_handle handle;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    rocsparse_operation    trans = rocsparse_operation_none;
+    rocsparse_datatype     ttype = get_datatype<T>();
+    rocsparse_spgemm_alg   alg   = rocsparse_spgemm_alg_default;
+    rocsparse_spgemm_stage stage = rocsparse_spgemm_stage_auto;
+
+    T  h_alpha     = static_cast<T>(1);
+    T* h_alpha_ptr = &h_alpha;
+    T* h_beta_ptr  = nullptr;
+
+    static constexpr J M = 128;
+    static constexpr J K = 128;
+
+    for(int acc = 0; acc < 3; ++acc)
+    {
+        host_csr hA, hB, hD;
+        J        N;
+
+        if(acc == 0)
+        {
+            // Dense: all 200 columns of C fit into the table of the group of 33 - 256
+            // non-zeros per row
+            N = 200;
+            testing_spgemm_csr_pattern(hA, M, K, 40, [](J i, J j) { return 3 * j + i % 3; });
+            testing_spgemm_csr_pattern(hB, K, N, 8, [](J i, J j) { return 25 * j + i % 25; });
+        }
+        else if(acc == 1)
+        {
+            // ESC: the rows of B are disjoint, such that the 128 intermediate products of
+            // each row are not compressed at all
+            N = 5000;
+            testing_spgemm_csr_pattern(hA, M, K, 16, [](J i, J j) { return 8 * j + i % 8; });
+            testing_spgemm_csr_pattern(hB, K, N, 8, [](J i, J j) { return 32 * i + j; });
+        }
+        else
+        {
+            // Hash: all rows of B share the same 100 columns, such that the 6400 intermediate
+            // products of each row exceed the table and compress into 100 non-zeros
+            N = 5000;
+            testing_spgemm_csr_pattern(hA, M, K, 64, [](J i, J j) { return 2 * j + i % 2; });
+            testing_spgemm_csr_pattern(hB, K, N, 100, [](J i, J j) { return 40 * j; });
+        }
+
+        hD.define(M, N, 0, rocsparse_index_base_zero);
+        for(J i = 0; i <= M; ++i)
+        {
+            hD.ptr[i] = 0;
+        }
+
+        // Compute C on host
+        host_csr hC;
+        {
+            I hC_nnz = 0;
+            hC.define(M, N, hC_nnz, rocsparse_index_base_zero);
+            host_csrgemm_nnz(M,
+                             N,
+                             K,
+                             h_alpha_ptr,
+                             hA.ptr,
+                             hA.ind,
+                             hB.ptr,
+                             hB.ind,
+                             h_beta_ptr,
+                             hD.ptr,
+                             hD.ind,
+                             hC.ptr,
+                             &hC_nnz,
+                             hA.base,
+                             hB.base,
+                             hC.base,
+                             hD.base);
+            hC.define(hC.m, hC.n, hC_nnz, hC.base);
+        }
+
+        host_csrgemm(M,
+                     N,
+                     K,
+                     h_alpha_ptr,
+                     hA.ptr,
+                     hA.ind,
+                     hA.val,
+                     hB.ptr,
+                     hB.ind,
+                     hB.val,
+                     h_beta_ptr,
+                     hD.ptr,
+                     hD.ind,
+                     hD.val,
+                     hC.ptr,
+                     hC.ind,
+                     hC.val,
+                     hA.base,
+                     hB.base,
+                     hC.base,
+                     hD.base);
+
+        // Compute C on device
+        device_csr dA(hA), dB(hB), dD(hD);
+        device_csr dC;
+        dC.define(M, N, 0, rocsparse_index_base_zero);
+
+        rocsparse_local_spmat A(dA), B(dB), C(dC), D(dD);
+
+        size_t buffer_size;
+        void*  dbuffer = nullptr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(handle,
+                                               trans,
+                                               trans,
+                                               h_alpha_ptr,
+                                               A,
+                                               B,
+                                               h_beta_ptr,
+                                               D,
+                                               C,
+                                               ttype,
+                                               alg,
+                                               stage,
+                                               &buffer_size,
+                                               dbuffer));
+        CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+        // Compute symbolic C
+        CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(handle,
+                                               trans,
+                                               trans,
+                                               h_alpha_ptr,
+                                               A,
+                                               B,
+                                               h_beta_ptr,
+                                               D,
+                                               C,
+                                               ttype,
+                                               alg,
+                                               stage,
+                                               &buffer_size,
+                                               dbuffer));
+
+        int64_t C_m, C_n, C_nnz;
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &C_m, &C_n, &C_nnz));
+        dC.define(dC.m, dC.n, C_nnz, dC.base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(C, dC));
+
+        // Compute numeric C
+        CHECK_ROCSPARSE_ERROR(rocsparse_spgemm(handle,
+                                               trans,
+                                               trans,
+                                               h_alpha_ptr,
+                                               A,
+                                               B,
+                                               h_beta_ptr,
+                                               D,
+                                               C,
+                                               ttype,
+                                               alg,
+                                               stage,
+                                               &buffer_size,
+                                               dbuffer));
+        CHECK_HIP_ERROR(hipFree(dbuffer));
+
+        hC.near_check(dC);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                   \
+    template void testing_spgemm_csr_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg);   \
+    template void testing_spgemm_csr_accumulators<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
     template void testing_spgemm_csr<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
 
 INSTANTIATE(int32_t, int32_t, float);
@@ -183,6 +183,61 @@ void testing_spmat_descr_bad_arg(const Arguments& arg)
         rocsparse_create_ell_descr(&A, 100, 100, col_data, val_data, 200, itype, base, ttype),
         rocsparse_status_invalid_size);
 
+    // rocsparse_create_bsr_descr
+    rocsparse_direction dir       = rocsparse_direction_row;
+    int64_t             block_dim = 2;
+
+#define PARAMS_BSR(mb_, nb_, nnzb_, dir_, block_dim_, ptr_, ind_, val_) \
+    mb_, nb_, nnzb_, dir_, block_dim_, ptr_, ind_, val_, itype, jtype, base, ttype
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            nullptr,
+            PARAMS_BSR(rows, cols, nnz, dir, block_dim, row_data, col_data, val_data)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(-1, cols, nnz, dir, block_dim, row_data, col_data, val_data)),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, -1, nnz, dir, block_dim, row_data, col_data, val_data)),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, cols, -1, dir, block_dim, row_data, col_data, val_data)),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, cols, nnz, dir, 0, row_data, col_data, val_data)),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(100, 100, 20000, dir, block_dim, row_data, col_data, val_data)),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(&A,
+                                   PARAMS_BSR(rows,
+                                              cols,
+                                              nnz,
+                                              (rocsparse_direction)2,
+                                              block_dim,
+                                              row_data,
+                                              col_data,
+                                              val_data)),
+        rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, cols, nnz, dir, block_dim, nullptr, col_data, val_data)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, cols, nnz, dir, block_dim, row_data, nullptr, val_data)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, cols, nnz, dir, block_dim, row_data, col_data, nullptr)),
+        rocsparse_status_invalid_pointer);
+
     // rocsparse_destroy_spmat_descr
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(nullptr),
                             rocsparse_status_invalid_pointer);
@@ -246,6 +301,18 @@ void testing_spmat_descr_bad_arg(const Arguments& arg)
         rocsparse_status_success);
     EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(A), rocsparse_status_success);
 
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(0, cols, 0, dir, block_dim, nullptr, nullptr, nullptr)),
+        rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(A), rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_create_bsr_descr(
+            &A, PARAMS_BSR(rows, cols, 0, dir, block_dim, row_data, nullptr, nullptr)),
+        rocsparse_status_success);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_destroy_spmat_descr(A), rocsparse_status_success);
+#undef PARAMS_BSR
+
     // Create valid descriptor
     rocsparse_spmat_descr coo;
     rocsparse_spmat_descr csr;
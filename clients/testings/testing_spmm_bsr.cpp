@@ -0,0 +1,332 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing.hpp"
+
+template <typename T>
+void testing_spmm_bsr_bad_arg(const Arguments& arg)
+{
+    static const int64_t safe_size = 10;
+
+    T alpha = static_cast<T>(0.6);
+    T beta  = static_cast<T>(0.1);
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle  = local_handle;
+    rocsparse_operation trans_A = rocsparse_operation_none;
+    rocsparse_operation trans_B = rocsparse_operation_none;
+    const void*         p_alpha = (const void*)&alpha;
+    const void*         p_beta  = (const void*)&beta;
+    rocsparse_spmm_alg  alg     = rocsparse_spmm_alg_default;
+    size_t              buffer_size;
+    size_t*             p_buffer_size = &buffer_size;
+    void*               temp_buffer   = (void*)0x4;
+    rocsparse_datatype  ttype         = get_datatype<T>();
+
+    rocsparse_local_spmat A(safe_size,
+                            safe_size,
+                            safe_size,
+                            rocsparse_direction_row,
+                            2,
+                            (void*)0x4,
+                            (void*)0x4,
+                            (void*)0x4,
+                            rocsparse_indextype_i32,
+                            rocsparse_indextype_i32,
+                            rocsparse_index_base_zero,
+                            ttype);
+    rocsparse_local_dnmat B(
+        2 * safe_size, safe_size, 2 * safe_size, (void*)0x4, ttype, rocsparse_order_column);
+    rocsparse_local_dnmat C(
+        2 * safe_size, safe_size, 2 * safe_size, (void*)0x4, ttype, rocsparse_order_column);
+
+#define PARAMS                                                                                   \
+    handle, trans_A, trans_B, p_alpha, (const rocsparse_spmat_descr&)A,                          \
+        (const rocsparse_dnmat_descr&)B, p_beta, (const rocsparse_dnmat_descr&)C, ttype, alg, \
+        p_buffer_size, temp_buffer
+
+    {
+        //
+        // WITH 2 ARGUMENTS BEING SKIPPED DURING THE CHECK.
+        //
+        static const int nex   = 2;
+        static const int ex[2] = {10, 11};
+        auto_testing_bad_arg(rocsparse_spmm, nex, ex, PARAMS);
+    }
+
+    //
+    // NOT IMPLEMENTED CASES
+    //
+    {
+        // Row major dense matrices
+        rocsparse_local_dnmat B(
+            2 * safe_size, safe_size, safe_size, (void*)0x4, ttype, rocsparse_order_row);
+        rocsparse_local_dnmat C(
+            2 * safe_size, safe_size, safe_size, (void*)0x4, ttype, rocsparse_order_row);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    {
+        // 64 bit indices
+        rocsparse_local_spmat A(safe_size,
+                                safe_size,
+                                safe_size,
+                                rocsparse_direction_row,
+                                2,
+                                (void*)0x4,
+                                (void*)0x4,
+                                (void*)0x4,
+                                rocsparse_indextype_i64,
+                                rocsparse_indextype_i64,
+                                rocsparse_index_base_zero,
+                                ttype);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    p_buffer_size = nullptr;
+    temp_buffer   = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_spmm_bsr(const Arguments& arg)
+{
+    rocsparse_int        M         = arg.M;
+    rocsparse_int        N         = arg.N;
+    rocsparse_int        K         = arg.K;
+    rocsparse_direction  dir       = arg.direction;
+    rocsparse_operation  trans_A   = arg.transA;
+    rocsparse_operation  trans_B   = arg.transB;
+    rocsparse_index_base base      = arg.baseA;
+    rocsparse_int        block_dim = arg.block_dim;
+    rocsparse_spmm_alg   alg       = arg.spmm_alg;
+    rocsparse_datatype   ttype     = get_datatype<T>();
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>()), h_beta(arg.get_beta<T>());
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // BSR dimensions
+    rocsparse_int mb = (block_dim > 0) ? (M + block_dim - 1) / block_dim : 0;
+    rocsparse_int kb = (block_dim > 0) ? (K + block_dim - 1) / block_dim : 0;
+
+#define PARAMS(alpha_, A_, B_, beta_, C_) \
+    handle, trans_A, trans_B, alpha_, A_, B_, beta_, C_, ttype, alg, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(mb <= 0 || kb <= 0 || N <= 0 || block_dim <= 0)
+    {
+        if(M == 0 && N == 0 && K == 0 && block_dim > 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            device_dense_matrix<T> dB, dC;
+
+            rocsparse_local_spmat A(mb,
+                                    kb,
+                                    0,
+                                    dir,
+                                    block_dim,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    rocsparse_indextype_i32,
+                                    rocsparse_indextype_i32,
+                                    base,
+                                    ttype);
+            rocsparse_local_dnmat B(dB);
+            rocsparse_local_dnmat C(dC);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Create matrix descriptor for the host reference
+    rocsparse_local_mat_descr descr;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    //
+    // Declare and initialize matrices.
+    //
+    host_gebsr_matrix<T>   hA;
+    device_gebsr_matrix<T> dA;
+    matrix_factory.init_bsr(hA, dA, mb, kb);
+
+    M = dA.mb * dA.row_block_dim;
+    K = dA.nb * dA.col_block_dim;
+
+    host_dense_matrix<T> hB((trans_B == rocsparse_operation_none) ? K : N,
+                            (trans_B == rocsparse_operation_none) ? N : K);
+    host_dense_matrix<T> hC(M, N);
+
+    rocsparse_matrix_utils::init(hB);
+    rocsparse_matrix_utils::init(hC);
+
+    device_dense_matrix<T> dB(hB), dC(hC);
+
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_dnmat C(dC);
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+
+        {
+            host_dense_matrix<T> hC_copy(hC);
+
+            // CPU bsrmm
+            host_bsrmm<T>(handle,
+                          dir,
+                          trans_A,
+                          trans_B,
+                          hA.mb,
+                          N,
+                          hA.nb,
+                          hA.nnzb,
+                          h_alpha,
+                          descr,
+                          hA.val,
+                          hA.ptr,
+                          hA.ind,
+                          hA.row_block_dim,
+                          hB,
+                          hB.ld,
+                          h_beta,
+                          hC,
+                          hC.ld);
+
+            hC.near_check(dC);
+            dC.transfer_from(hC_copy);
+        }
+
+        // Pointer mode device
+        {
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(d_alpha, A, B, d_beta, C)));
+        }
+
+        hC.near_check(dC);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = bsrmm_gflop_count(
+            N, dA.nnzb, dA.row_block_dim, dC.m * dC.n, *h_beta != static_cast<T>(0));
+        double gbyte_count = bsrmm_gbyte_count<T>(dA.mb,
+                                                  dA.nnzb,
+                                                  dA.row_block_dim,
+                                                  dB.m * dB.n,
+                                                  dC.m * dC.n,
+                                                  *h_beta != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "BSR dim",
+                            dA.row_block_dim,
+                            "dir",
+                            rocsparse_direction2string(dA.block_direction),
+                            "transB",
+                            rocsparse_operation2string(trans_B),
+                            "alpha",
+                            *h_alpha.val,
+                            "beta",
+                            *h_beta.val,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_spmm_bsr_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_spmm_bsr<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
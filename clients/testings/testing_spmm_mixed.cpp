@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_spmm_mixed.hpp"
+
+#include <hip/hip_bfloat16.h>
+
+template <typename I, typename J, typename T, typename A, typename X>
+static void testing_spmm_mixed_bad_arg_template(const Arguments& arg)
+{
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(1);
+
+    rocsparse_local_handle handle;
+
+    rocsparse_operation trans_A     = rocsparse_operation_none;
+    rocsparse_operation trans_B     = rocsparse_operation_none;
+    rocsparse_datatype  ttype       = get_datatype<T>();
+    rocsparse_spmm_alg  alg         = rocsparse_spmm_alg_default;
+    size_t              buffer_size = 0;
+    void*               dbuffer     = (void*)0x4;
+
+#define PARAMS \
+    handle, trans_A, trans_B, &h_alpha, A, B, &h_beta, C, ttype, alg, &buffer_size, dbuffer
+
+    {
+        //
+        // MIXED PRECISION IS ONLY SUPPORTED FOR CSR.
+        //
+        device_coo_matrix<A>   dA;
+        device_dense_matrix<X> dB(0, 0);
+        device_dense_matrix<T> dC(0, 0);
+        rocsparse_local_spmat  A(dA);
+        rocsparse_local_dnmat  B(dB);
+        rocsparse_local_dnmat  C(dC);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    {
+        //
+        // C MUST BE STORED IN THE COMPUTE PRECISION.
+        //
+        device_csr_matrix<A, I, J> dA;
+        device_dense_matrix<X>     dB(0, 0);
+        device_dense_matrix<X>     dC(0, 0);
+        rocsparse_local_spmat      A(dA);
+        rocsparse_local_dnmat      B(dB);
+        rocsparse_local_dnmat      C(dC);
+        if(!std::is_same<X, T>{})
+        {
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS), rocsparse_status_not_implemented);
+        }
+    }
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T, typename A, typename X>
+static void testing_spmm_mixed_template(const Arguments& arg)
+{
+    J                    M       = arg.M;
+    J                    N       = arg.N;
+    J                    K       = arg.K;
+    rocsparse_operation  trans_A = arg.transA;
+    rocsparse_operation  trans_B = arg.transB;
+    rocsparse_index_base base    = arg.baseA;
+    rocsparse_spmm_alg   alg     = arg.spmm_alg;
+    rocsparse_order      order   = arg.order;
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS(alpha_, A_, B_, beta_, C_) \
+    handle, trans_A, trans_B, alpha_, A_, B_, beta_, C_, ttype, alg, &buffer_size, dbuffer
+
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        if(M == 0 || N == 0 || K == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            device_csr_matrix<A, I, J> dA;
+            device_dense_matrix<X>     dB(0, 0, order);
+            device_dense_matrix<T>     dC(0, 0, order);
+
+            rocsparse_local_spmat A(dA);
+            rocsparse_local_dnmat B(dB);
+            rocsparse_local_dnmat C(dC);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+        return;
+    }
+
+    // Generate the matrix in the compute precision, using integer values such that
+    // the conversion into the storage precision is exact
+    host_csr_matrix<T, I, J> hA;
+    {
+        static constexpr bool             to_int    = true;
+        static constexpr bool             full_rank = false;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA,
+                                (trans_A == rocsparse_operation_none) ? M : K,
+                                (trans_A == rocsparse_operation_none) ? K : M,
+                                base);
+    }
+
+    host_csr_matrix<A, I, J> hA_mixed(hA.m, hA.n, hA.nnz, hA.base);
+    hA_mixed.ptr.transfer_from(hA.ptr);
+    hA_mixed.ind.transfer_from(hA.ind);
+    for(I i = 0; i < hA.nnz; ++i)
+    {
+        hA_mixed.val[i] = static_cast<A>(hA.val[i]);
+        hA.val[i]       = static_cast<T>(hA_mixed.val[i]);
+    }
+
+    device_csr_matrix<A, I, J> dA(hA_mixed);
+
+    host_dense_matrix<T> hB((trans_B == rocsparse_operation_none) ? K : N,
+                            (trans_B == rocsparse_operation_none) ? N : K,
+                            order);
+    rocsparse_matrix_utils::init_exact(hB);
+
+    host_dense_matrix<X> hB_mixed(hB.m, hB.n, order);
+    for(rocsparse_int i = 0; i < hB.m * hB.n; ++i)
+    {
+        hB_mixed.val[i] = static_cast<X>(hB.val[i]);
+    }
+
+    device_dense_matrix<X> dB(hB_mixed);
+
+    host_dense_matrix<T> hC(M, N, order);
+    rocsparse_matrix_utils::init_exact(hC);
+    device_dense_matrix<T> dC(hC);
+
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnmat B(dB);
+    rocsparse_local_dnmat C(dC);
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+
+        // CPU csrmm in the compute precision
+        host_dense_matrix<T> hC_copy(hC);
+        host_csrmm(M,
+                   N,
+                   K,
+                   trans_A,
+                   trans_B,
+                   *h_alpha,
+                   hA.ptr,
+                   hA.ind,
+                   hA.val,
+                   hB.val,
+                   (J)hB.ld,
+                   *h_beta,
+                   hC.val,
+                   (J)hC.ld,
+                   order,
+                   hA.base);
+        hC.near_check(dC);
+        dC.transfer_from(hC_copy);
+
+        // Pointer mode device
+        device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(d_alpha, A, B, d_beta, C)));
+
+        hC.near_check(dC);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmm(PARAMS(h_alpha, A, B, h_beta, C)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count
+            = spmm_gflop_count(N, dA.nnz, (I)M * (I)N, *h_beta != static_cast<T>(0));
+        double gbyte_count = csrmm_mixed_gbyte_count<I, J, A, X, T>(
+            dA.m, dA.nnz, (I)hB.m * (I)hB.n, (I)M * (I)N, *h_beta != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "K",
+                            K,
+                            "nnz",
+                            dA.nnz,
+                            "A",
+                            rocsparse_datatype2string(get_datatype<A>()),
+                            "B",
+                            rocsparse_datatype2string(get_datatype<X>()),
+                            "alpha",
+                            *h_alpha,
+                            "beta",
+                            *h_beta,
+                            "Algorithm",
+                            rocsparse_spmmalg2string(alg),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS
+}
+
+//
+// Storage precisions of the matrix (A) and of B (X) that are tested for a given compute
+// precision (T).
+//
+template <typename T>
+struct testing_spmm_mixed_precisions;
+
+template <>
+struct testing_spmm_mixed_precisions<float>
+{
+    template <typename I, typename J>
+    static void bad_arg(const Arguments& arg)
+    {
+        testing_spmm_mixed_bad_arg_template<I, J, float, int8_t, int8_t>(arg);
+        testing_spmm_mixed_bad_arg_template<I, J, float, _Float16, _Float16>(arg);
+        testing_spmm_mixed_bad_arg_template<I, J, float, hip_bfloat16, hip_bfloat16>(arg);
+    }
+
+    template <typename I, typename J>
+    static void run(const Arguments& arg)
+    {
+        testing_spmm_mixed_template<I, J, float, int8_t, int8_t>(arg);
+        testing_spmm_mixed_template<I, J, float, int8_t, float>(arg);
+        testing_spmm_mixed_template<I, J, float, _Float16, _Float16>(arg);
+        testing_spmm_mixed_template<I, J, float, _Float16, float>(arg);
+        testing_spmm_mixed_template<I, J, float, hip_bfloat16, hip_bfloat16>(arg);
+        testing_spmm_mixed_template<I, J, float, hip_bfloat16, float>(arg);
+    }
+};
+
+template <>
+struct testing_spmm_mixed_precisions<double>
+{
+    template <typename I, typename J>
+    static void bad_arg(const Arguments& arg)
+    {
+        testing_spmm_mixed_bad_arg_template<I, J, double, float, double>(arg);
+    }
+
+    template <typename I, typename J>
+    static void run(const Arguments& arg)
+    {
+        testing_spmm_mixed_template<I, J, double, float, double>(arg);
+    }
+};
+
+template <>
+struct testing_spmm_mixed_precisions<rocsparse_double_complex>
+{
+    template <typename I, typename J>
+    static void bad_arg(const Arguments& arg)
+    {
+        testing_spmm_mixed_bad_arg_template<I,
+                                            J,
+                                            rocsparse_double_complex,
+                                            rocsparse_float_complex,
+                                            rocsparse_double_complex>(arg);
+    }
+
+    template <typename I, typename J>
+    static void run(const Arguments& arg)
+    {
+        testing_spmm_mixed_template<I,
+                                    J,
+                                    rocsparse_double_complex,
+                                    rocsparse_float_complex,
+                                    rocsparse_double_complex>(arg);
+    }
+};
+
+template <typename I, typename J, typename T>
+void testing_spmm_mixed_bad_arg(const Arguments& arg)
+{
+    testing_spmm_mixed_precisions<T>::template bad_arg<I, J>(arg);
+}
+
+template <typename I, typename J, typename T>
+void testing_spmm_mixed(const Arguments& arg)
+{
+    testing_spmm_mixed_precisions<T>::template run<I, J>(arg);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                 \
+    template void testing_spmm_mixed_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmm_mixed<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
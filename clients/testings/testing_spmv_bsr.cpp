@@ -0,0 +1,313 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the Software), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED AS IS, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing.hpp"
+
+template <typename T>
+void testing_spmv_bsr_bad_arg(const Arguments& arg)
+{
+    static const int64_t safe_size = 10;
+
+    T alpha = static_cast<T>(0.6);
+    T beta  = static_cast<T>(0.1);
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle  = local_handle;
+    rocsparse_operation trans   = rocsparse_operation_none;
+    const void*         p_alpha = (const void*)&alpha;
+    const void*         p_beta  = (const void*)&beta;
+    rocsparse_spmv_alg  alg     = rocsparse_spmv_alg_default;
+    size_t              buffer_size;
+    size_t*             p_buffer_size = &buffer_size;
+    void*               temp_buffer   = (void*)0x4;
+    rocsparse_datatype  ttype         = get_datatype<T>();
+
+    rocsparse_local_spmat A(safe_size,
+                            safe_size,
+                            safe_size,
+                            rocsparse_direction_row,
+                            2,
+                            (void*)0x4,
+                            (void*)0x4,
+                            (void*)0x4,
+                            rocsparse_indextype_i32,
+                            rocsparse_indextype_i32,
+                            rocsparse_index_base_zero,
+                            ttype);
+    rocsparse_local_dnvec x(2 * safe_size, (void*)0x4, ttype);
+    rocsparse_local_dnvec y(2 * safe_size, (void*)0x4, ttype);
+
+#define PARAMS                                                                                \
+    handle, trans, p_alpha, (const rocsparse_spmat_descr&)A, (const rocsparse_dnvec_descr&)x, \
+        p_beta, (rocsparse_dnvec_descr&)y, ttype, alg, p_buffer_size, temp_buffer
+
+    {
+        //
+        // WITH 2 ARGUMENTS BEING SKIPPED DURING THE CHECK.
+        //
+        static const int nex   = 2;
+        static const int ex[2] = {9, 10};
+        auto_testing_bad_arg(rocsparse_spmv, nex, ex, PARAMS);
+    }
+
+    //
+    // NOT IMPLEMENTED CASES
+    //
+    {
+        // Transposed BSR matrices
+        trans = rocsparse_operation_transpose;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+        trans = rocsparse_operation_none;
+    }
+
+    {
+        // 64 bit indices
+        rocsparse_local_spmat A(safe_size,
+                                safe_size,
+                                safe_size,
+                                rocsparse_direction_row,
+                                2,
+                                (void*)0x4,
+                                (void*)0x4,
+                                (void*)0x4,
+                                rocsparse_indextype_i64,
+                                rocsparse_indextype_i64,
+                                rocsparse_index_base_zero,
+                                ttype);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    p_buffer_size = nullptr;
+    temp_buffer   = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_spmv_bsr(const Arguments& arg)
+{
+    rocsparse_int        M         = arg.M;
+    rocsparse_int        N         = arg.N;
+    rocsparse_direction  dir       = arg.direction;
+    rocsparse_operation  trans     = arg.transA;
+    rocsparse_index_base base      = arg.baseA;
+    rocsparse_int        block_dim = arg.block_dim;
+    rocsparse_spmv_alg   alg       = arg.spmv_alg;
+    rocsparse_datatype   ttype     = get_datatype<T>();
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>()), h_beta(arg.get_beta<T>());
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // BSR dimensions
+    rocsparse_int mb = (block_dim > 0) ? (M + block_dim - 1) / block_dim : 0;
+    rocsparse_int nb = (block_dim > 0) ? (N + block_dim - 1) / block_dim : 0;
+
+#define PARAMS(alpha_, A_, x_, beta_, y_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, &buffer_size, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(mb <= 0 || nb <= 0 || M <= 0 || N <= 0 || block_dim <= 0)
+    {
+        if(mb == 0 || nb == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            device_dense_matrix<T> dx, dy;
+
+            rocsparse_local_spmat A(mb,
+                                    nb,
+                                    0,
+                                    dir,
+                                    (block_dim > 0) ? block_dim : 1,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    rocsparse_indextype_i32,
+                                    rocsparse_indextype_i32,
+                                    base,
+                                    ttype);
+            rocsparse_local_dnvec x(dx);
+            rocsparse_local_dnvec y(dy);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Wavefront size
+    int dev;
+    hipGetDevice(&dev);
+
+    hipDeviceProp_t prop;
+    hipGetDeviceProperties(&prop, dev);
+
+    bool                        type = (prop.warpSize == 32) ? (arg.timing ? false : true) : false;
+    static constexpr bool       full_rank = false;
+    rocsparse_matrix_factory<T> matrix_factory(arg, type, full_rank);
+
+    //
+    // Declare and initialize matrices.
+    //
+    host_gebsr_matrix<T>   hA;
+    device_gebsr_matrix<T> dA;
+    matrix_factory.init_bsr(hA, dA, mb, nb);
+
+    M = dA.mb * dA.row_block_dim;
+    N = dA.nb * dA.col_block_dim;
+
+    host_dense_matrix<T> hx(N, 1), hy(M, 1);
+
+    rocsparse_matrix_utils::init(hx);
+    rocsparse_matrix_utils::init(hy);
+
+    device_dense_matrix<T> dx(hx), dy(hy);
+
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+
+        {
+            host_dense_matrix<T> hy_copy(hy);
+
+            // CPU bsrmv
+            host_bsrmv<T>(dir,
+                          trans,
+                          hA.mb,
+                          hA.nb,
+                          hA.nnzb,
+                          *h_alpha,
+                          hA.ptr,
+                          hA.ind,
+                          hA.val,
+                          hA.row_block_dim,
+                          hx,
+                          *h_beta,
+                          hy,
+                          base);
+
+            hy.near_check(dy);
+            dy.transfer_from(hy_copy);
+        }
+
+        // Pointer mode device
+        {
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(d_alpha, A, x, d_beta, y)));
+        }
+
+        hy.near_check(dy);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = spmv_gflop_count(
+            M, dA.nnzb * dA.row_block_dim * dA.col_block_dim, *h_beta != static_cast<T>(0));
+        double gbyte_count = bsrmv_gbyte_count<T>(
+            dA.mb, dA.nb, dA.nnzb, dA.row_block_dim, *h_beta != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "BSR dim",
+                            dA.row_block_dim,
+                            "dir",
+                            rocsparse_direction2string(dA.block_direction),
+                            "alpha",
+                            *h_alpha.val,
+                            "beta",
+                            *h_beta.val,
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_spmv_bsr_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_spmv_bsr<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
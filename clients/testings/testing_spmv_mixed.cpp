@@ -0,0 +1,372 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_spmv_mixed.hpp"
+
+#include <hip/hip_bfloat16.h>
+
+template <typename I, typename J, typename T, typename A, typename X>
+static void testing_spmv_mixed_bad_arg_template(const Arguments& arg)
+{
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(1);
+
+    rocsparse_local_handle handle;
+
+    rocsparse_operation trans       = rocsparse_operation_none;
+    rocsparse_datatype  ttype       = get_datatype<T>();
+    rocsparse_spmv_alg  alg         = rocsparse_spmv_alg_default;
+    size_t              buffer_size = 0;
+    void*               dbuffer     = (void*)0x4;
+
+#define PARAMS handle, trans, &h_alpha, A, x, &h_beta, y, ttype, alg, &buffer_size, dbuffer
+
+    {
+        //
+        // MIXED PRECISION IS ONLY SUPPORTED FOR CSR AND CSC.
+        //
+        device_coo_matrix<A>   dA;
+        device_dense_matrix<X> dx;
+        device_dense_matrix<T> dy;
+        rocsparse_local_spmat  A(dA);
+        rocsparse_local_dnvec  x(dx);
+        rocsparse_local_dnvec  y(dy);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+    }
+
+    {
+        //
+        // Y MUST BE STORED IN THE COMPUTE PRECISION.
+        //
+        device_csr_matrix<A, I, J> dA;
+        device_dense_matrix<X>     dx;
+        device_dense_matrix<X>     dy;
+        rocsparse_local_spmat      A(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+        if(!std::is_same<X, T>{})
+        {
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+        }
+    }
+
+    {
+        //
+        // CONJUGATE TRANSPOSE IS NOT SUPPORTED FOR CSC.
+        //
+        device_csc_matrix<A, I, J> dA;
+        device_dense_matrix<X>     dx;
+        device_dense_matrix<T>     dy;
+        rocsparse_local_spmat      A(dA);
+        rocsparse_local_dnvec      x(dx);
+        rocsparse_local_dnvec      y(dy);
+        trans = rocsparse_operation_conjugate_transpose;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS), rocsparse_status_not_implemented);
+    }
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T, typename A, typename X>
+static void testing_spmv_mixed_template(const Arguments& arg)
+{
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+    rocsparse_spmv_alg   alg   = arg.spmv_alg;
+
+    bool               adaptive = (alg == rocsparse_spmv_alg_csr_stream) ? false : true;
+    rocsparse_datatype ttype    = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS(alpha_, A_, x_, beta_, y_) \
+    handle, trans, alpha_, A_, x_, beta_, y_, ttype, alg, &buffer_size, dbuffer
+
+    if(M <= 0 || N <= 0)
+    {
+        if(M == 0 || N == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            device_csr_matrix<A, I, J> dA;
+            device_dense_matrix<X>     dx;
+            device_dense_matrix<T>     dy;
+
+            rocsparse_local_spmat A(dA);
+            rocsparse_local_dnvec x(dx);
+            rocsparse_local_dnvec y(dy);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 10));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)),
+                                    rocsparse_status_success);
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+        return;
+    }
+
+    // Generate the matrix in the compute precision, using integer values such that
+    // the conversion into the storage precision is exact
+    host_csr_matrix<T, I, J> hA;
+    {
+        static constexpr bool             to_int    = true;
+        static constexpr bool             full_rank = false;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    host_csr_matrix<A, I, J> hA_mixed(hA.m, hA.n, hA.nnz, hA.base);
+    hA_mixed.ptr.transfer_from(hA.ptr);
+    hA_mixed.ind.transfer_from(hA.ind);
+    for(I i = 0; i < hA.nnz; ++i)
+    {
+        hA_mixed.val[i] = static_cast<A>(hA.val[i]);
+        hA.val[i]       = static_cast<T>(hA_mixed.val[i]);
+    }
+
+    device_csr_matrix<A, I, J> dA(hA_mixed);
+
+    host_dense_matrix<T> hx((trans == rocsparse_operation_none) ? N : M, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+
+    host_dense_matrix<X> hx_mixed(hx.m, 1);
+    for(rocsparse_int i = 0; i < hx.m; ++i)
+    {
+        hx_mixed.val[i] = static_cast<X>(hx.val[i]);
+    }
+
+    device_dense_matrix<X> dx(hx_mixed);
+
+    host_dense_matrix<T> hy((trans == rocsparse_operation_none) ? M : N, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    void*  dbuffer = nullptr;
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+
+        // CPU csrmv in the compute precision
+        host_dense_matrix<T> hy_copy(hy);
+        host_csrmv<I, J, T>(trans,
+                            hA.m,
+                            hA.n,
+                            hA.nnz,
+                            *h_alpha,
+                            hA.ptr,
+                            hA.ind,
+                            hA.val,
+                            hx,
+                            *h_beta,
+                            hy,
+                            hA.base,
+                            adaptive);
+        hy.near_check(dy);
+        dy.transfer_from(hy_copy);
+
+        // Pointer mode device
+        device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(d_alpha, A, x, d_beta, y)));
+
+        hy.near_check(dy);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv(PARAMS(h_alpha, A, x, h_beta, y)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gflop_count = spmv_gflop_count(dA.m, dA.nnz, *h_beta != static_cast<T>(0));
+        double gbyte_count = csrmv_mixed_gbyte_count<I, J, A, X, T>(
+            dA.m, dA.n, dA.nnz, *h_beta != static_cast<T>(0));
+
+        double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+        double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "N",
+                            N,
+                            "nnz",
+                            dA.nnz,
+                            "A",
+                            rocsparse_datatype2string(get_datatype<A>()),
+                            "x",
+                            rocsparse_datatype2string(get_datatype<X>()),
+                            "alpha",
+                            *h_alpha,
+                            "beta",
+                            *h_beta,
+                            "Algorithm",
+                            rocsparse_spmvalg2string(alg),
+                            "GFlop/s",
+                            gpu_gflops,
+                            "GB/s",
+                            gpu_gbyte,
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS
+}
+
+//
+// Storage precisions of the matrix (A) and of x (X) that are tested for a given compute
+// precision (T).
+//
+template <typename T>
+struct testing_spmv_mixed_precisions;
+
+template <>
+struct testing_spmv_mixed_precisions<float>
+{
+    template <typename I, typename J>
+    static void bad_arg(const Arguments& arg)
+    {
+        testing_spmv_mixed_bad_arg_template<I, J, float, int8_t, int8_t>(arg);
+        testing_spmv_mixed_bad_arg_template<I, J, float, _Float16, _Float16>(arg);
+        testing_spmv_mixed_bad_arg_template<I, J, float, hip_bfloat16, hip_bfloat16>(arg);
+    }
+
+    template <typename I, typename J>
+    static void run(const Arguments& arg)
+    {
+        testing_spmv_mixed_template<I, J, float, int8_t, int8_t>(arg);
+        testing_spmv_mixed_template<I, J, float, int8_t, float>(arg);
+        testing_spmv_mixed_template<I, J, float, _Float16, _Float16>(arg);
+        testing_spmv_mixed_template<I, J, float, _Float16, float>(arg);
+        testing_spmv_mixed_template<I, J, float, hip_bfloat16, hip_bfloat16>(arg);
+        testing_spmv_mixed_template<I, J, float, hip_bfloat16, float>(arg);
+    }
+};
+
+template <>
+struct testing_spmv_mixed_precisions<double>
+{
+    template <typename I, typename J>
+    static void bad_arg(const Arguments& arg)
+    {
+        testing_spmv_mixed_bad_arg_template<I, J, double, float, double>(arg);
+    }
+
+    template <typename I, typename J>
+    static void run(const Arguments& arg)
+    {
+        testing_spmv_mixed_template<I, J, double, float, double>(arg);
+    }
+};
+
+template <>
+struct testing_spmv_mixed_precisions<rocsparse_double_complex>
+{
+    template <typename I, typename J>
+    static void bad_arg(const Arguments& arg)
+    {
+        testing_spmv_mixed_bad_arg_template<I,
+                                            J,
+                                            rocsparse_double_complex,
+                                            rocsparse_float_complex,
+                                            rocsparse_double_complex>(arg);
+    }
+
+    template <typename I, typename J>
+    static void run(const Arguments& arg)
+    {
+        testing_spmv_mixed_template<I,
+                                    J,
+                                    rocsparse_double_complex,
+                                    rocsparse_float_complex,
+                                    rocsparse_double_complex>(arg);
+    }
+};
+
+template <typename I, typename J, typename T>
+void testing_spmv_mixed_bad_arg(const Arguments& arg)
+{
+    testing_spmv_mixed_precisions<T>::template bad_arg<I, J>(arg);
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_mixed(const Arguments& arg)
+{
+    testing_spmv_mixed_precisions<T>::template run<I, J>(arg);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                 \
+    template void testing_spmv_mixed_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_mixed<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
@@ -86,14 +86,16 @@ namespace
                        << rocsparse_datatype2string(arg.compute_type) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
                        << rocsparse_matrix2string(arg.matrix) << '_'
-                       << rocsparse_filename2string(arg.filename);
+                       << rocsparse_filename2string(arg.filename) << '_'
+                       << rocsparse_coloralg2string(arg.color_alg) << '_' << arg.colorbalance;
             }
             else
             {
                 return RocSPARSE_TestName<csrcolor>{}
                        << rocsparse_datatype2string(arg.compute_type) << '_' << arg.M << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
-                       << rocsparse_matrix2string(arg.matrix);
+                       << rocsparse_matrix2string(arg.matrix) << '_'
+                       << rocsparse_coloralg2string(arg.color_alg) << '_' << arg.colorbalance;
             }
         }
     };
@@ -100,7 +100,9 @@ namespace
                                                    << rocsparse_operation2string(arg.transA) << '_'
                                                    << rocsparse_operation2string(arg.transB) << '_'
                                                    << rocsparse_indexbase2string(arg.baseA) << '_'
-                                                   << rocsparse_matrix2string(arg.matrix);
+                                                   << rocsparse_matrixtype2string(arg.matrix_type)
+                                                   << '_' << rocsparse_fillmode2string(arg.uplo)
+                                                   << '_' << rocsparse_matrix2string(arg.matrix);
             }
         }
     };
@@ -97,6 +97,8 @@ namespace
                        << arg.N << '_' << arg.alpha << '_' << arg.alphai << '_' << arg.beta << '_'
                        << arg.betai << '_' << rocsparse_operation2string(arg.transA) << '_'
                        << rocsparse_indexbase2string(arg.baseA) << '_'
+                       << rocsparse_matrixtype2string(arg.matrix_type) << '_'
+                       << rocsparse_fillmode2string(arg.uplo) << '_'
                        << rocsparse_matrix2string(arg.matrix) << '_' << arg.algo;
             }
         }
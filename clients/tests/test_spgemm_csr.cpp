@@ -62,6 +62,8 @@ namespace
                 testing_spgemm_csr<I, J, T>(arg);
             else if(!strcmp(arg.function, "spgemm_csr_bad_arg"))
                 testing_spgemm_csr_bad_arg<I, J, T>(arg);
+            else if(!strcmp(arg.function, "spgemm_csr_accumulators"))
+                testing_spgemm_csr_accumulators<I, J, T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -79,7 +81,8 @@ namespace
         static bool function_filter(const Arguments& arg)
         {
             return !strcmp(arg.function, "spgemm_csr")
-                   || !strcmp(arg.function, "spgemm_csr_bad_arg");
+                   || !strcmp(arg.function, "spgemm_csr_bad_arg")
+                   || !strcmp(arg.function, "spgemm_csr_accumulators");
         }
 
         // Google Test name suffix based on parameters
@@ -99,7 +102,8 @@ namespace
                        << rocsparse_indexbase2string(arg.baseB) << '_'
                        << rocsparse_indexbase2string(arg.baseC) << '_'
                        << rocsparse_indexbase2string(arg.baseD) << '_'
-                       << rocsparse_matrix2string(arg.matrix) << '_' << arg.filename;
+                       << rocsparse_matrix2string(arg.matrix) << '_' << arg.filename << '_'
+                       << rocsparse_spgemmalg2string(arg.spgemm_alg);
             }
             else
             {
@@ -115,7 +119,8 @@ namespace
                        << rocsparse_indexbase2string(arg.baseB) << '_'
                        << rocsparse_indexbase2string(arg.baseC) << '_'
                        << rocsparse_indexbase2string(arg.baseD) << '_'
-                       << rocsparse_matrix2string(arg.matrix);
+                       << rocsparse_matrix2string(arg.matrix) << '_'
+                       << rocsparse_spgemmalg2string(arg.spgemm_alg);
             }
         }
     };
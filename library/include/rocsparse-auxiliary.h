@@ -468,6 +468,153 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Query the size of a serialized matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_export_size returns the size in bytes that is required to
+ *  serialize a matrix info structure with rocsparse_mat_info_export().
+ *
+ *  @param[in]
+ *  handle  handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info    the info structure.
+ *  @param[out]
+ *  size    number of bytes required to hold the serialized info structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_pointer \p info or \p size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_export_size(rocsparse_handle         handle,
+                                                const rocsparse_mat_info info,
+                                                size_t*                  size);
+
+/*! \ingroup aux_module
+ *  \brief Serialize a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_export writes the analysis meta data of a matrix info
+ *  structure into a flat, versioned byte array. This includes the meta data of
+ *  csrmv (adaptive), csrsv, csrsm, csrilu0 and csric0. Meta data of BSR routines and
+ *  of the csrmv merge path algorithm is not exported. A checksum of the sparsity
+ *  pattern of the sparse CSR matrix, that has been analysed, and a checksum of the
+ *  serialized meta data are stored alongside.
+ *  The data can be imported by rocsparse_mat_info_import() to skip the analysis
+ *  step, e.g. after a restart of the application.
+ *
+ *  \note
+ *  The serialized data depends on the device architecture, the index type and the
+ *  rocSPARSE version. It should only be imported on the same system configuration.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        the info structure that holds the analysis meta data of the matrix.
+ *  @param[out]
+ *  data        array of at least the number of bytes returned by
+ *              rocsparse_mat_info_export_size(), can be in host or device memory.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+ *          \p info or \p data pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_export(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           const rocsparse_mat_info  info,
+                                           void*                     data);
+
+/*! \ingroup aux_module
+ *  \brief Deserialize a matrix info structure
+ *
+ *  \details
+ *  \p rocsparse_mat_info_import restores the analysis meta data, that has been
+ *  serialized by rocsparse_mat_info_export(), into a matrix info structure. The
+ *  sparsity pattern of the sparse CSR matrix and the serialized meta data are verified
+ *  against the checksums that have been stored during the export. Afterwards, the meta
+ *  data can be used with the given matrix descriptor and CSR arrays, as if the
+ *  corresponding analysis routines have been called. If the import fails, \p info is
+ *  left without any meta data.
+ *
+ *  \note
+ *  \p info must not hold any csrmv, csrsv, csrsm, csrilu0 or csric0 meta data.
+ *
+ *  \note
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  info        the info structure that receives the analysis meta data.
+ *  @param[in]
+ *  data        serialized info structure, can be in host or device memory.
+ *  @param[in]
+ *  size        size of \p data in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid or does not
+ *          match the serialized data.
+ *  \retval rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+ *          \p info or \p data pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p data is not a valid serialized info
+ *          structure of this version, the sparsity pattern or meta data checksum does
+ *          not match, or \p info already holds meta data.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_mat_info_import(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const void*               data,
+                                           size_t                    size);
+
 /*! \ingroup aux_module
  *  \brief Create a color info structure
  *
@@ -598,6 +745,36 @@ rocsparse_status rocsparse_create_ell_descr(rocsparse_spmat_descr* descr,
                                             rocsparse_index_base   idx_base,
                                             rocsparse_datatype     data_type);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_bsr_descr(rocsparse_spmat_descr* descr,
+                                            int64_t                mb,
+                                            int64_t                nb,
+                                            int64_t                nnzb,
+                                            rocsparse_direction    block_dir,
+                                            int64_t                block_dim,
+                                            void*                  bsr_row_ptr,
+                                            void*                  bsr_col_ind,
+                                            void*                  bsr_val,
+                                            rocsparse_indextype    row_ptr_type,
+                                            rocsparse_indextype    col_ind_type,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_datatype     data_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_sell_descr(rocsparse_spmat_descr* descr,
+                                             int64_t                rows,
+                                             int64_t                cols,
+                                             int64_t                sell_nnz,
+                                             int64_t                slice_size,
+                                             void*                  sell_slice_ptr,
+                                             void*                  sell_perm,
+                                             void*                  sell_col_ind,
+                                             void*                  sell_val,
+                                             rocsparse_indextype    slice_ptr_type,
+                                             rocsparse_indextype    idx_type,
+                                             rocsparse_index_base   idx_base,
+                                             rocsparse_datatype     data_type);
+
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_spmat_descr(rocsparse_spmat_descr descr);
 
@@ -694,6 +871,18 @@ rocsparse_status rocsparse_spmat_get_values(rocsparse_spmat_descr descr, void**
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_spmat_set_values(rocsparse_spmat_descr descr, void* values);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_get_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               void*                     data,
+                                               size_t                    data_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_set_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               const void*               data,
+                                               size_t                    data_size);
+
 // Dense vector
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_create_dnvec_descr(rocsparse_dnvec_descr* descr,
@@ -81,6 +81,14 @@ public:
     {
     }
 
+    // Conversion from complex numbers of a different precision
+    template <typename U>
+    __device__ __host__ explicit rocsparse_complex_num(const rocsparse_complex_num<U>& z)
+        : x(static_cast<T>(z.x))
+        , y(static_cast<T>(z.y))
+    {
+    }
+
     // Conversion from std::complex<T>
     __device__ __host__ rocsparse_complex_num(const std::complex<T>& z)
         : x(reinterpret_cast<T (&)[2]>(z)[0])
@@ -183,6 +191,9 @@ public:
     }
 
 private:
+    template <typename U>
+    friend class rocsparse_complex_num;
+
     // Internal real absolute function, to be sure we're on both device and host
     static __forceinline__ __device__ __host__ T abs(T x)
     {
@@ -1495,9 +1495,6 @@ rocsparse_status rocsparse_zbsrsv_solve(rocsparse_handle                handle,
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
-*  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
-*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
@@ -1537,7 +1534,6 @@ rocsparse_status rocsparse_zbsrsv_solve(rocsparse_handle                handle,
 *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
@@ -1650,8 +1646,7 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
 *              could not be allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
 */
 /**@{*/
 ROCSPARSE_EXPORT
@@ -1761,6 +1756,12 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  the \p csrmv computation. If \p info == \p NULL, general \p csrmv routine will be
 *  used instead.
 *
+*  For \ref rocsparse_matrix_type_symmetric and \ref rocsparse_matrix_type_hermitian
+*  matrices, only the triangular part selected by the \ref rocsparse_fill_mode of
+*  \p descr, including the diagonal, is read. Entries outside of this triangular part are
+*  ignored, and the remaining part of the matrix is implied by symmetry. In this case,
+*  the matrix needs to be square and \p info is not used.
+*
 *  \code{.c}
 *      for(i = 0; i < m; ++i)
 *      {
@@ -1777,9 +1778,6 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
-*  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
-*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
@@ -1794,7 +1792,8 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*              \ref rocsparse_matrix_type_general, \ref rocsparse_matrix_type_symmetric
+*              and \ref rocsparse_matrix_type_hermitian are supported.
 *  @param[in]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
@@ -1825,8 +1824,7 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
 *              invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
 *
 *  \par Example
 *  This example performs a sparse matrix vector multiplication in CSR format
@@ -1975,6 +1973,77 @@ rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
                                             rocsparse_mat_info        info,
                                             rocsparse_int*            position);
 
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_level_count returns the number of levels of the triangular
+*  matrix, that has been determined by rocsparse_scsrsv_analysis(),
+*  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() or
+*  rocsparse_zcsrsv_analysis(). Rows within the same level are independent of each
+*  other and are solved concurrently if \ref rocsparse_solve_policy_level is passed to
+*  rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() or
+*  rocsparse_zcsrsv_solve(). A small number of levels relative to \f$m\f$ indicates
+*  a high degree of parallelism.
+*
+*  \p nlevels can be in host or device memory. If no analysis data is available for
+*  the requested operation and fill mode, or if the transposed analysis has been
+*  performed with \ref rocsparse_solve_policy_push, \p nlevels is set to 0.
+*
+*  \note \p rocsparse_csrsv_level_count is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans       matrix operation type.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  nlevels     pointer to the number of levels, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p info or \p nlevels pointer
+*              is invalid.
+*  \retval     rocsparse_status_invalid_value \p trans is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_level_count(rocsparse_handle          handle,
+                                             rocsparse_operation       trans,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int*            nlevels);
+
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_jacobi_sweeps sets the number of Jacobi sweeps that are performed
+*  by rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and
+*  rocsparse_zcsrsv_solve() if \ref rocsparse_solve_policy_jacobi is passed. Each sweep
+*  updates all rows concurrently, using the previous iterate. The default is 3 sweeps.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  nsweeps     number of sweeps, at least 1.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_invalid_value \p nsweeps is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_jacobi_sweeps(rocsparse_handle   handle,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int      nsweeps);
+
 /*! \ingroup level2_module
 *  \brief Sparse triangular solve using CSR storage format
 *
@@ -2098,6 +2167,20 @@ rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                ha
 *  pattern remains unchanged. If this cannot be assured,
 *  \ref rocsparse_analysis_policy_force has to be used.
 *
+*  For transposed solves, the analysis creates a transposed copy of the sparsity
+*  pattern, which requires additional \f$O(nnz)\f$ device memory. If
+*  \ref rocsparse_solve_policy_push is passed, no transposed copy is created and the
+*  subsequent transposed solve operates directly on the CSR matrix, requiring only
+*  \f$O(m)\f$ additional device memory. Such meta data cannot be shared with
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(), rocsparse_ccsrsm_analysis()
+*  and rocsparse_zcsrsm_analysis().
+*
+*  With \ref rocsparse_analysis_policy_reuse, existing meta data is only re-used if it
+*  suits the \p solve policy, i.e. if it holds the level information for
+*  \ref rocsparse_solve_policy_level and if it has been created with or without
+*  \ref rocsparse_solve_policy_push for transposed solves, respectively. Otherwise, the
+*  meta data is re-built as with \ref rocsparse_analysis_policy_force.
+*
 *  \note
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
 *
@@ -2130,7 +2213,8 @@ rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                ha
 *  analysis    \ref rocsparse_analysis_policy_reuse or
 *              \ref rocsparse_analysis_policy_force.
 *  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  solve       \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_level,
+*              \ref rocsparse_solve_policy_push or \ref rocsparse_solve_policy_jacobi.
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
@@ -2265,6 +2349,27 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *  \ref rocsparse_diag_type == \ref rocsparse_diag_type_unit, no zero pivot will be
 *  reported, even if \f$A_{j,j} = 0\f$ for some \f$j\f$.
 *
+*  With \ref rocsparse_solve_policy_level, the rows are solved level by level, using
+*  the level sets that have been computed during the analysis step. Each level is
+*  processed by a single kernel launch, where consecutive levels with only a few rows
+*  are grouped into one launch. This avoids the inter-row synchronization of the
+*  default solver and can be faster for matrices with few, wide levels. The number of
+*  levels can be queried by rocsparse_csrsv_level_count(). The level sets are only
+*  stored if \ref rocsparse_solve_policy_level has also been passed to the analysis,
+*  otherwise the default solver is used.
+*
+*  If the analysis has been performed with \ref rocsparse_solve_policy_push, transposed
+*  solves are computed without the transposed matrix. Each solved row pushes its
+*  contribution to the dependent rows using atomic updates.
+*
+*  With \ref rocsparse_solve_policy_jacobi, the solution is approximated by
+*  \f$y_{k+1} = D^{-1}(\alpha x - (op(A) - D) y_k)\f$, starting from \f$y_0 = 0\f$,
+*  where \f$D\f$ is the diagonal of \f$op(A)\f$. All rows are updated concurrently in
+*  each sweep. The number of sweeps is set by rocsparse_csrsv_jacobi_sweeps(). The
+*  result is exact once the number of sweeps reaches the number of levels returned by
+*  rocsparse_csrsv_level_count(). Transposed solves with analysis data obtained by
+*  \ref rocsparse_solve_policy_push are not approximated.
+*
 *  \note
 *  The sparse CSR matrix has to be sorted. This can be achieved by calling
 *  rocsparse_csrsort().
@@ -2304,7 +2409,8 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *  @param[out]
 *  y           array of \p m elements, holding the solution.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_level,
+*              \ref rocsparse_solve_policy_push or \ref rocsparse_solve_policy_jacobi.
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
@@ -3611,6 +3717,12 @@ rocsparse_status rocsparse_zgebsrmm(rocsparse_handle                handle,
 *      }
 *  \endcode
 *
+*  For \ref rocsparse_matrix_type_symmetric and \ref rocsparse_matrix_type_hermitian
+*  matrices, only the triangular part selected by the \ref rocsparse_fill_mode of
+*  \p descr, including the diagonal, is read. Entries outside of this triangular part are
+*  ignored, and the remaining part of the matrix is implied by symmetry. In this case,
+*  \f$A\f$ needs to be square.
+*
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
@@ -3633,7 +3745,8 @@ rocsparse_status rocsparse_zgebsrmm(rocsparse_handle                handle,
 *  alpha       scalar \f$\alpha\f$.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix \f$A\f$. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*              \ref rocsparse_matrix_type_general, \ref rocsparse_matrix_type_symmetric
+*              and \ref rocsparse_matrix_type_hermitian are supported.
 *  @param[in]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix \f$A\f$.
 *  @param[in]
@@ -3666,7 +3779,7 @@ rocsparse_status rocsparse_zgebsrmm(rocsparse_handle                handle,
 *              \p csr_row_ptr, \p csr_col_ind, \p B, \p beta or \p C pointer is invalid.
 *  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_not_implemented
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \ref rocsparse_matrix_type == \ref rocsparse_matrix_type_triangular.
 *
 *  \par Example
 *  This example multiplies a CSR matrix with a dense matrix.
@@ -5506,11 +5619,9 @@ rocsparse_status rocsparse_zcsrgeam(rocsparse_handle                handle,
 *  storage buffer must be allocated by the user.
 *
 *  \note
-*  Please note, that for matrix products with more than 4096 non-zero entries per row,
-*  additional temporary storage buffer is allocated by the algorithm.
-*  \note
-*  Please note, that for matrix products with more than 8192 intermediate products per
-*  row, additional temporary storage buffer is allocated by the algorithm.
+*  The temporary storage buffer also covers matrix products with more than 4096
+*  non-zero entries or more than 8192 intermediate products per row, such that no
+*  additional device memory is allocated by the algorithm.
 *  \note
 *  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
 *  supported.
@@ -5705,9 +5816,6 @@ rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *  \note
-*  Please note, that for matrix products with more than 8192 intermediate products per
-*  row, additional temporary storage buffer is allocated by the algorithm.
-*  \note
 *  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
 *  supported.
 *  \note
@@ -5787,8 +5895,6 @@ rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle
 *          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
 *          \p descr_D, \p csr_row_ptr_D, \p csr_col_ind_D, \p descr_C,
 *          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
-*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
-*          allocated.
 *  \retval rocsparse_status_not_implemented
 *          \p trans_A != \ref rocsparse_operation_none,
 *          \p trans_B != \ref rocsparse_operation_none, or
@@ -5870,8 +5976,6 @@ rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
 *  \note Currently, only \ref rocsparse_matrix_type_general is supported.
 *  \note This function is non blocking and executed asynchronously with respect to the
 *        host. It may return before the actual computation has finished.
-*  \note Please note, that for matrix products with more than 4096 non-zero entries per
-*  row, additional temporary storage buffer is allocated by the algorithm.
 *
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
@@ -5961,8 +6065,6 @@ rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
 *          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
 *          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
 *          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
-*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
-*          allocated.
 *  \retval rocsparse_status_not_implemented
 *          \p trans_A != \ref rocsparse_operation_none,
 *          \p trans_B != \ref rocsparse_operation_none, or
@@ -7540,7 +7642,9 @@ rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
 *  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
 *  structural or numerical zero has been found during rocsparse_scsric0() or
 *  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
-*  is stored in \p position, using same index base as the CSR matrix.
+*  is stored in \p position, using same index base as the CSR matrix. This also
+*  applies to the last call of rocsparse_scsritic0() or rocsparse_dcsritic0() with
+*  \p info.
 *
 *  \p position can be in host or device memory. If no zero pivot has been found,
 *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
@@ -8736,425 +8840,566 @@ rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver with pivoting
+*  \brief Incomplete LU factorization with level of fill using CSR storage format
 *
 *  \details
-*  \p rocsparse_gtsv_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sgtsv(), rocsparse_dgtsv(),
-*  rocsparse_cgtsv() and rocsparse_zgtsv(). The temporary storage buffer
-*  must be allocated by the user.
+*  \p rocsparse_csriluk_nnz computes the number of non-zero entries per row of the
+*  sparsity pattern of the incomplete LU factorization \f$A \approx LU\f$ with
+*  \p level_of_fill levels of fill-in (ILU(k)) of a sparse \f$m \times m\f$ CSR matrix
+*  \f$A\f$. Both factors \f$L\f$ and \f$U\f$ are stored in a single CSR matrix \f$LU\f$.
+*  The diagonal is always part of the pattern. For \p level_of_fill = 0, the pattern of
+*  \f$LU\f$ is identical to the pattern of \f$A\f$ plus its diagonal.
+*
+*  The total number of non-zero entries of \f$LU\f$ is stored in \p nnz_lu, which can be
+*  in host or device memory.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  The symbolic factorization is inherently sequential and is performed on the host.
+*  This function is blocking with respect to the host.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  m           size of the tri-diagonal linear system (must be >= 2).
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  n           number of columns in the dense matrix B.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  nnz             number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  descr           descriptor of the sparse CSR matrix.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  csr_row_ptr     array of \p m+1 elements that point to the start
+*                  of every row of the sparse CSR matrix.
 *  @param[in]
-*  B           Dense matrix of size ( \p ldb, \p n ).
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
 *  @param[in]
-*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  level_of_fill   maximum level of fill-in \f$k \ge 0\f$.
 *  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgtsv(), rocsparse_dgtsv(), rocsparse_cgtsv()
-*              and rocsparse_zgtsv().
+*  csr_row_ptr_lu  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  nnz_lu          pointer to the number of non-zero entries of \f$LU\f$.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
-*              \p B or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p level_of_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p csr_row_ptr_lu or \p nnz_lu pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_buffer_size(rocsparse_handle handle,
-                                             rocsparse_int    m,
-                                             rocsparse_int    n,
-                                             const float*     dl,
-                                             const float*     d,
-                                             const float*     du,
-                                             const float*     B,
-                                             rocsparse_int    ldb,
-                                             size_t*          buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_buffer_size(rocsparse_handle handle,
-                                             rocsparse_int    m,
-                                             rocsparse_int    n,
-                                             const double*    dl,
-                                             const double*    d,
-                                             const double*    du,
-                                             const double*    B,
-                                             rocsparse_int    ldb,
-                                             size_t*          buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_buffer_size(rocsparse_handle               handle,
-                                             rocsparse_int                  m,
-                                             rocsparse_int                  n,
-                                             const rocsparse_float_complex* dl,
-                                             const rocsparse_float_complex* d,
-                                             const rocsparse_float_complex* du,
-                                             const rocsparse_float_complex* B,
-                                             rocsparse_int                  ldb,
-                                             size_t*                        buffer_size);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_buffer_size(rocsparse_handle                handle,
-                                             rocsparse_int                   m,
-                                             rocsparse_int                   n,
-                                             const rocsparse_double_complex* dl,
-                                             const rocsparse_double_complex* d,
-                                             const rocsparse_double_complex* du,
-                                             const rocsparse_double_complex* B,
-                                             rocsparse_int                   ldb,
-                                             size_t*                         buffer_size);
-/**@}*/
+rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             level_of_fill,
+                                       rocsparse_int*            csr_row_ptr_lu,
+                                       rocsparse_int*            nnz_lu);
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver with pivoting
+*  \brief Incomplete LU factorization with level of fill using CSR storage format
 *
 *  \details
-*  \p rocsparse_gtsv solves a tridiagonal system for multiple right hand sides using pivoting.
+*  \p rocsparse_csriluk_symbolic computes the sorted column indices of the sparsity
+*  pattern of the incomplete LU factorization \f$A \approx LU\f$ with \p level_of_fill
+*  levels of fill-in. \p csr_col_ind_lu has to be allocated by the user with the number
+*  of non-zero entries returned by rocsparse_csriluk_nnz().
+*
+*  The pattern of \f$LU\f$ can be passed to rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis() and to the csrsv analysis of the triangular factors.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  The symbolic factorization is inherently sequential and is performed on the host.
+*  This function is blocking with respect to the host.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  m           size of the tri-diagonal linear system (must be >= 2).
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  n           number of columns in the dense matrix B.
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  nnz             number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  descr           descriptor of the sparse CSR matrix.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
-*  @param[inout]
-*  B           Dense matrix of size ( \p ldb, \p n ).
+*  csr_row_ptr     array of \p m+1 elements that point to the start
+*                  of every row of the sparse CSR matrix.
 *  @param[in]
-*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  level_of_fill   maximum level of fill-in \f$k \ge 0\f$.
+*  @param[out]
+*  csr_col_ind_lu  array of \p nnz_lu elements containing the column indices of the
+*                  sparse CSR matrix \f$LU\f$.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
-*              \p du, \p B or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p level_of_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind or \p csr_col_ind_lu pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv(rocsparse_handle handle,
-                                 rocsparse_int    m,
-                                 rocsparse_int    n,
-                                 const float*     dl,
-                                 const float*     d,
-                                 const float*     du,
-                                 float*           B,
-                                 rocsparse_int    ldb,
-                                 void*            temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv(rocsparse_handle handle,
-                                 rocsparse_int    m,
-                                 rocsparse_int    n,
-                                 const double*    dl,
-                                 const double*    d,
-                                 const double*    du,
-                                 double*          B,
-                                 rocsparse_int    ldb,
-                                 void*            temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv(rocsparse_handle               handle,
-                                 rocsparse_int                  m,
-                                 rocsparse_int                  n,
-                                 const rocsparse_float_complex* dl,
-                                 const rocsparse_float_complex* d,
-                                 const rocsparse_float_complex* du,
-                                 rocsparse_float_complex*       B,
-                                 rocsparse_int                  ldb,
-                                 void*                          temp_buffer);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv(rocsparse_handle                handle,
-                                 rocsparse_int                   m,
-                                 rocsparse_int                   n,
-                                 const rocsparse_double_complex* dl,
-                                 const rocsparse_double_complex* d,
-                                 const rocsparse_double_complex* du,
-                                 rocsparse_double_complex*       B,
-                                 rocsparse_int                   ldb,
-                                 void*                           temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             level_of_fill,
+                                            rocsparse_int*            csr_col_ind_lu);
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver (no pivoting)
+*  \brief Incomplete LU factorization with level of fill using CSR storage format
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(),
-*  rocsparse_cgtsv_no_pivot() and rocsparse_zgtsv_no_pivot(). The temporary storage buffer
-*  must be allocated by the user.
+*  \p rocsparse_csriluk computes the numerical values of the incomplete LU factorization
+*  \f$A \approx LU\f$ with level of fill-in, using the sparsity pattern of \f$LU\f$
+*  obtained by rocsparse_csriluk_nnz() and rocsparse_csriluk_symbolic(). The entries of
+*  \f$A\f$ are copied into the pattern of \f$LU\f$, before the factorization is computed
+*  in place.
+*
+*  \p rocsparse_csriluk requires analysis meta data of the sparsity pattern of \f$LU\f$,
+*  obtained by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(), and a temporary
+*  buffer of the size returned by the corresponding csrilu0 buffer size function for
+*  \f$LU\f$. Numeric boosting set by rocsparse_scsrilu0_numeric_boost(),
+*  rocsparse_dcsrilu0_numeric_boost(), rocsparse_ccsrilu0_numeric_boost() or
+*  rocsparse_zcsrilu0_numeric_boost() is applied. The zero pivot status can be obtained
+*  by calling rocsparse_csrilu0_zero_pivot().
+*
+*  The factors can be used with rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(),
+*  rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve() by passing the \f$LU\f$ matrix
+*  with lower and upper fill mode, respectively.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           size of the tri-diagonal linear system (must be >= 2).
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns in the dense matrix B.
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  descr           descriptor of the sparse CSR matrices \f$A\f$ and \f$LU\f$.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  csr_val         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  csr_row_ptr     array of \p m+1 elements that point to the start
+*                  of every row of the sparse CSR matrix \f$A\f$.
 *  @param[in]
-*  B           Dense matrix of size ( \p ldb, \p n ).
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
 *  @param[in]
-*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  nnz_lu          number of non-zero entries of the sparse CSR matrix \f$LU\f$.
 *  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(), rocsparse_cgtsv_no_pivot()
-*              and rocsparse_zgtsv_no_pivot().
+*  csr_val_lu      array of \p nnz_lu elements of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_row_ptr_lu  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_col_ind_lu  array of \p nnz_lu elements containing the column indices of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  info            structure that holds the csrilu0 analysis of \f$LU\f$.
+*  @param[in]
+*  policy          \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
-*              \p B or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nnz_lu is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p csr_val_lu, \p csr_row_ptr_lu, \p csr_col_ind_lu,
+*              \p info or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot_buffer_size(rocsparse_handle handle,
-                                                      rocsparse_int    m,
-                                                      rocsparse_int    n,
-                                                      const float*     dl,
-                                                      const float*     d,
-                                                      const float*     du,
-                                                      const float*     B,
-                                                      rocsparse_int    ldb,
-                                                      size_t*          buffer_size);
+rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             nnz_lu,
+                                    float*                    csr_val_lu,
+                                    const rocsparse_int*      csr_row_ptr_lu,
+                                    const rocsparse_int*      csr_col_ind_lu,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot_buffer_size(rocsparse_handle handle,
-                                                      rocsparse_int    m,
-                                                      rocsparse_int    n,
-                                                      const double*    dl,
-                                                      const double*    d,
-                                                      const double*    du,
-                                                      const double*    B,
-                                                      rocsparse_int    ldb,
-                                                      size_t*          buffer_size);
+rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             nnz_lu,
+                                    double*                   csr_val_lu,
+                                    const rocsparse_int*      csr_row_ptr_lu,
+                                    const rocsparse_int*      csr_col_ind_lu,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_no_pivot_buffer_size(rocsparse_handle               handle,
-                                                      rocsparse_int                  m,
-                                                      rocsparse_int                  n,
-                                                      const rocsparse_float_complex* dl,
-                                                      const rocsparse_float_complex* d,
-                                                      const rocsparse_float_complex* du,
-                                                      const rocsparse_float_complex* B,
-                                                      rocsparse_int                  ldb,
-                                                      size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsriluk(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_int                  nnz_lu,
+                                    rocsparse_float_complex*       csr_val_lu,
+                                    const rocsparse_int*           csr_row_ptr_lu,
+                                    const rocsparse_int*           csr_col_ind_lu,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_solve_policy         policy,
+                                    void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot_buffer_size(rocsparse_handle                handle,
-                                                      rocsparse_int                   m,
-                                                      rocsparse_int                   n,
-                                                      const rocsparse_double_complex* dl,
-                                                      const rocsparse_double_complex* d,
-                                                      const rocsparse_double_complex* du,
-                                                      const rocsparse_double_complex* B,
-                                                      rocsparse_int                   ldb,
-                                                      size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsriluk(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_int                   nnz_lu,
+                                    rocsparse_double_complex*       csr_val_lu,
+                                    const rocsparse_int*            csr_row_ptr_lu,
+                                    const rocsparse_int*            csr_col_ind_lu,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_solve_policy          policy,
+                                    void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver (no pivoting)
+*  \brief Incomplete LU factorization with threshold dropping using CSR storage format
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot  solves a tridiagonal linear system for multiple right-hand sides
+*  \p rocsparse_csrilut computes the incomplete LU factorization \f$A \approx LU\f$ with
+*  dual threshold dropping (ILUT). While row \f$i\f$ is factorized, multipliers
+*  \f$l_{i,j}\f$ with \f$|l_{i,j}| < \tau_i\f$ are dropped before they are applied,
+*  where \f$\tau_i = \text{drop_tol} \cdot \|a_{i,:}\|_2\f$. Once the row is complete,
+*  entries below \f$\tau_i\f$ are dropped and only the \p max_fill entries of largest
+*  magnitude are kept in the strictly lower and in the strictly upper part of the row,
+*  respectively. The diagonal is never dropped.
+*
+*  Fill-in is restricted to a sparsity pattern \f$LU\f$ that is passed by the user,
+*  typically the level of fill pattern obtained by rocsparse_csriluk_nnz() and
+*  rocsparse_csriluk_symbolic(). Dropped entries are stored as explicit zeros in
+*  \p csr_val_lu, such that the pattern of \f$LU\f$ and its analysis meta data remain
+*  valid. The zeros can be removed by rocsparse_scsrilut_compress(),
+*  rocsparse_dcsrilut_compress(), rocsparse_ccsrilut_compress() or
+*  rocsparse_zcsrilut_compress().
+*
+*  \p rocsparse_csrilut requires analysis meta data of the sparsity pattern of \f$LU\f$,
+*  obtained by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(), and a temporary
+*  buffer of the size returned by the corresponding csrilu0 buffer size function for
+*  \f$LU\f$. The zero pivot status can be obtained by calling
+*  rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  \p drop_tol can be in host or device memory.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           size of the tri-diagonal linear system (must be >= 2).
+*  m               number of rows of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns in the dense matrix B.
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  descr           descriptor of the sparse CSR matrices \f$A\f$ and \f$LU\f$.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  csr_val         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
-*  @param[inout]
-*  B           Dense matrix of size ( \p ldb, \p n ).
+*  csr_row_ptr     array of \p m+1 elements that point to the start
+*                  of every row of the sparse CSR matrix \f$A\f$.
 *  @param[in]
-*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  drop_tol        relative drop tolerance \f$\ge 0\f$.
+*  @param[in]
+*  max_fill        maximum number of entries that are kept in the strictly lower and
+*                  strictly upper part of each row \f$\ge 0\f$.
+*  @param[in]
+*  nnz_lu          number of non-zero entries of the sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  csr_val_lu      array of \p nnz_lu elements of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_row_ptr_lu  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_col_ind_lu  array of \p nnz_lu elements containing the column indices of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  info            structure that holds the csrilu0 analysis of \f$LU\f$.
+*  @param[in]
+*  policy          \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
-*              \p du, \p B or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nnz_lu is invalid.
+*  \retval     rocsparse_status_invalid_value \p max_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p drop_tol, \p csr_val_lu, \p csr_row_ptr_lu,
+*              \p csr_col_ind_lu, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot(rocsparse_handle handle,
-                                          rocsparse_int    m,
-                                          rocsparse_int    n,
-                                          const float*     dl,
-                                          const float*     d,
-                                          const float*     du,
-                                          float*           B,
-                                          rocsparse_int    ldb,
-                                          void*            temp_buffer);
+rocsparse_status rocsparse_scsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const float*              drop_tol,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int             nnz_lu,
+                                    float*                    csr_val_lu,
+                                    const rocsparse_int*      csr_row_ptr_lu,
+                                    const rocsparse_int*      csr_col_ind_lu,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot(rocsparse_handle handle,
-                                          rocsparse_int    m,
-                                          rocsparse_int    n,
-                                          const double*    dl,
-                                          const double*    d,
-                                          const double*    du,
-                                          double*          B,
-                                          rocsparse_int    ldb,
-                                          void*            temp_buffer);
+rocsparse_status rocsparse_dcsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const double*             drop_tol,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int             nnz_lu,
+                                    double*                   csr_val_lu,
+                                    const rocsparse_int*      csr_row_ptr_lu,
+                                    const rocsparse_int*      csr_col_ind_lu,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_no_pivot(rocsparse_handle               handle,
-                                          rocsparse_int                  m,
-                                          rocsparse_int                  n,
-                                          const rocsparse_float_complex* dl,
-                                          const rocsparse_float_complex* d,
-                                          const rocsparse_float_complex* du,
-                                          rocsparse_float_complex*       B,
-                                          rocsparse_int                  ldb,
-                                          void*                          temp_buffer);
+rocsparse_status rocsparse_ccsrilut(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    const float*                   drop_tol,
+                                    rocsparse_int                  max_fill,
+                                    rocsparse_int                  nnz_lu,
+                                    rocsparse_float_complex*       csr_val_lu,
+                                    const rocsparse_int*           csr_row_ptr_lu,
+                                    const rocsparse_int*           csr_col_ind_lu,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_solve_policy         policy,
+                                    void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot(rocsparse_handle                handle,
-                                          rocsparse_int                   m,
-                                          rocsparse_int                   n,
-                                          const rocsparse_double_complex* dl,
-                                          const rocsparse_double_complex* d,
-                                          const rocsparse_double_complex* du,
-                                          rocsparse_double_complex*       B,
-                                          rocsparse_int                   ldb,
-                                          void*                           temp_buffer);
+rocsparse_status rocsparse_zcsrilut(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    const double*                   drop_tol,
+                                    rocsparse_int                   max_fill,
+                                    rocsparse_int                   nnz_lu,
+                                    rocsparse_double_complex*       csr_val_lu,
+                                    const rocsparse_int*            csr_row_ptr_lu,
+                                    const rocsparse_int*            csr_col_ind_lu,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_solve_policy          policy,
+                                    void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Strided Batch tridiagonal solver (no pivoting)
+*  \brief Remove the dropped entries of an incomplete LU factorization with threshold
+*  dropping using CSR storage format
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot_strided_batch_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(),
-*  rocsparse_cgtsv_no_pivot_strided_batch() and rocsparse_zgtsv_no_pivot_strided_batch(). The temporary
-*  storage buffer must be allocated by the user.
+*  \p rocsparse_csrilut_compress removes the explicit zeros that rocsparse_scsrilut(),
+*  rocsparse_dcsrilut(), rocsparse_ccsrilut() or rocsparse_zcsrilut() left in
+*  \f$LU\f$ for the dropped entries. The arrays of \f$LU\f$ are compressed in place
+*  and the csrilu0 analysis meta data in \p info is re-computed for the compressed
+*  sparsity pattern, such that subsequent triangular solves only touch the kept entries.
+*
+*  The compression requires a temporary device copy of \f$LU\f$, a host
+*  synchronization to obtain the compressed number of non-zeros and a full
+*  re-analysis of \f$LU\f$. It pays off when \f$LU\f$ is applied in many solves or
+*  when a large share of the entries has been dropped.
+*
+*  \p temp_buffer can be the buffer that has been passed to the csrilut call. Other
+*  meta data of the uncompressed pattern in \p info, e.g. from the csrsv analysis of
+*  \f$L\f$ or \f$U\f$, is not valid anymore and has to be cleared and re-computed.
+*
+*  \note
+*  A diagonal entry is only removed if it is a numerical zero, which has been reported
+*  as zero pivot by the factorization. The re-analysis reports it as a structural zero
+*  pivot.
+*
+*  \note
+*  \p nnz_lu_compressed can be in host or device memory.
+*
+*  \note
+*  This function is blocking with respect to the host.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  m           size of the tri-diagonal linear system.
+*  handle            handle to the rocsparse library context queue.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
+*  m                 number of rows of the sparse CSR matrix.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
+*  descr             descriptor of the sparse CSR matrix \f$LU\f$.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
+*  nnz_lu            number of non-zero entries of the sparse CSR matrix \f$LU\f$.
 *  @param[inout]
-*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  csr_val_lu        array of \p nnz_lu elements of the sparse CSR matrix \f$LU\f$. On
+*                    return, the first \p nnz_lu_compressed elements hold the kept entries.
+*  @param[inout]
+*  csr_row_ptr_lu    array of \p m+1 elements that point to the start of every row of the
+*                    sparse CSR matrix \f$LU\f$.
+*  @param[inout]
+*  csr_col_ind_lu    array of \p nnz_lu elements containing the column indices of the
+*                    sparse CSR matrix \f$LU\f$. On return, the first
+*                    \p nnz_lu_compressed elements hold the kept column indices.
+*  @param[out]
+*  nnz_lu_compressed number of non-zero entries of the compressed sparse CSR matrix
+*                    \f$LU\f$.
+*  @param[inout]
+*  info              structure that holds the csrilu0 analysis of \f$LU\f$.
 *  @param[in]
-*  batch_count The number of systems to solve.
+*  policy            \ref rocsparse_solve_policy_auto.
 *  @param[in]
-*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
-*  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(), rocsparse_cgtsv_no_pivot_strided_batch()
-*              and rocsparse_zgtsv_no_pivot_strided_batch().
+*  temp_buffer       temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
-*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz_lu is invalid.
+*  \retval     rocsparse_status_invalid_value \p policy is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val_lu,
+*              \p csr_row_ptr_lu, \p csr_col_ind_lu, \p nnz_lu_compressed, \p info or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_memory_error the temporary copy of \f$LU\f$ could not be
+*              allocated.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
-                                                                    rocsparse_int    m,
-                                                                    const float*     dl,
-                                                                    const float*     d,
-                                                                    const float*     du,
-                                                                    const float*     x,
-                                                                    rocsparse_int    batch_count,
-                                                                    rocsparse_int    batch_stride,
-                                                                    size_t*          buffer_size);
+rocsparse_status rocsparse_scsrilut_compress(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_int             nnz_lu,
+                                             float*                    csr_val_lu,
+                                             rocsparse_int*            csr_row_ptr_lu,
+                                             rocsparse_int*            csr_col_ind_lu,
+                                             rocsparse_int*            nnz_lu_compressed,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
-                                                                    rocsparse_int    m,
-                                                                    const double*    dl,
-                                                                    const double*    d,
-                                                                    const double*    du,
-                                                                    const double*    x,
-                                                                    rocsparse_int    batch_count,
-                                                                    rocsparse_int    batch_stride,
-                                                                    size_t*          buffer_size);
+rocsparse_status rocsparse_dcsrilut_compress(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_int             nnz_lu,
+                                             double*                   csr_val_lu,
+                                             rocsparse_int*            csr_row_ptr_lu,
+                                             rocsparse_int*            csr_col_ind_lu,
+                                             rocsparse_int*            nnz_lu_compressed,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status
-    rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
-                                                       rocsparse_int                  m,
-                                                       const rocsparse_float_complex* dl,
-                                                       const rocsparse_float_complex* d,
-                                                       const rocsparse_float_complex* du,
-                                                       const rocsparse_float_complex* x,
-                                                       rocsparse_int                  batch_count,
-                                                       rocsparse_int                  batch_stride,
-                                                       size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsrilut_compress(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_int             nnz_lu,
+                                             rocsparse_float_complex*  csr_val_lu,
+                                             rocsparse_int*            csr_row_ptr_lu,
+                                             rocsparse_int*            csr_col_ind_lu,
+                                             rocsparse_int*            nnz_lu_compressed,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status
-    rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
-                                                       rocsparse_int                   m,
-                                                       const rocsparse_double_complex* dl,
-                                                       const rocsparse_double_complex* d,
-                                                       const rocsparse_double_complex* du,
-                                                       const rocsparse_double_complex* x,
-                                                       rocsparse_int                   batch_count,
-                                                       rocsparse_int                   batch_stride,
-                                                       size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsrilut_compress(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_int             nnz_lu,
+                                             rocsparse_double_complex* csr_val_lu,
+                                             rocsparse_int*            csr_row_ptr_lu,
+                                             rocsparse_int*            csr_col_ind_lu,
+                                             rocsparse_int*            nnz_lu_compressed,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Strided Batch tridiagonal solver (no pivoting)
+*  \brief Iterative incomplete LU factorization with 0 fill-ins using CSR storage format
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot_strided_batch  solves a batched tridiagonal linear system
+*  \p rocsparse_csritilu0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsritilu0(), rocsparse_dcsritilu0(), rocsparse_ccsritilu0()
+*  and rocsparse_zcsritilu0().
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -9163,1305 +9408,1415 @@ rocsparse_status
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           size of the tri-diagonal linear system (must be >= 2).
-*  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
-*  @param[inout]
-*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  batch_count The number of systems to solve.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsritilu0(), rocsparse_dcsritilu0(), rocsparse_ccsritilu0() and
+*              rocsparse_zcsritilu0().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
-*              \p du, \p x or \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch(rocsparse_handle handle,
-                                                        rocsparse_int    m,
-                                                        const float*     dl,
-                                                        const float*     d,
-                                                        const float*     du,
-                                                        float*           x,
-                                                        rocsparse_int    batch_count,
-                                                        rocsparse_int    batch_stride,
-                                                        void*            temp_buffer);
+rocsparse_status rocsparse_scsritilu0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch(rocsparse_handle handle,
-                                                        rocsparse_int    m,
-                                                        const double*    dl,
-                                                        const double*    d,
-                                                        const double*    du,
-                                                        double*          x,
-                                                        rocsparse_int    batch_count,
-                                                        rocsparse_int    batch_stride,
-                                                        void*            temp_buffer);
+rocsparse_status rocsparse_dcsritilu0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_no_pivot_strided_batch(rocsparse_handle               handle,
-                                                        rocsparse_int                  m,
-                                                        const rocsparse_float_complex* dl,
-                                                        const rocsparse_float_complex* d,
-                                                        const rocsparse_float_complex* du,
-                                                        rocsparse_float_complex*       x,
-                                                        rocsparse_int                  batch_count,
-                                                        rocsparse_int                  batch_stride,
-                                                        void*                          temp_buffer);
+rocsparse_status rocsparse_ccsritilu0_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_int                  m,
+                                                  rocsparse_int                  nnz,
+                                                  const rocsparse_mat_descr      descr,
+                                                  const rocsparse_float_complex* csr_val,
+                                                  const rocsparse_int*           csr_row_ptr,
+                                                  const rocsparse_int*           csr_col_ind,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot_strided_batch(rocsparse_handle                handle,
-                                                        rocsparse_int                   m,
-                                                        const rocsparse_double_complex* dl,
-                                                        const rocsparse_double_complex* d,
-                                                        const rocsparse_double_complex* du,
-                                                        rocsparse_double_complex*       x,
-                                                        rocsparse_int                   batch_count,
-                                                        rocsparse_int batch_stride,
-                                                        void*         temp_buffer);
+rocsparse_status rocsparse_zcsritilu0_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_int                   m,
+                                                  rocsparse_int                   nnz,
+                                                  const rocsparse_mat_descr       descr,
+                                                  const rocsparse_double_complex* csr_val,
+                                                  const rocsparse_int*            csr_row_ptr,
+                                                  const rocsparse_int*            csr_col_ind,
+                                                  size_t*                         buffer_size);
 /**@}*/
 
-/*
-* ===========================================================================
-*    Sparse Format Conversions
-* ===========================================================================
-*/
-
-/*! \ingroup conv_module
-*  \brief
-*  This function computes the number of nonzero elements per row or column and the total number of nonzero elements in a dense matrix.
+/*! \ingroup precond_module
+*  \brief Iterative incomplete LU factorization with 0 fill-ins using CSR storage format
+*
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  \p rocsparse_csritilu0 computes an approximation of the incomplete LU factorization
+*  with 0 fill-ins and no pivoting \f$A \approx LU\f$ by fixed-point sweeps, where all
+*  entries of \f$L\f$ and \f$U\f$ are updated in parallel. Starting from \f$A\f$, each
+*  sweep computes
+*  \f[
+*    s_{ij} = a_{ij} - \sum_{k < \min(i,j)} l_{ik} u_{kj}, \quad
+*    l_{ij} = s_{ij} / u_{jj} \; (j < i), \quad u_{ij} = s_{ij} \; (j \ge i)
+*  \f]
+*  from the iterate of the previous sweep. The factors are exact once \p nsweeps reaches
+*  the depth of the dependency graph of the factorization, but a few sweeps typically
+*  suffice for a preconditioner. The result is stored in \p csr_val in the same format
+*  as the output of rocsparse_scsrilu0(), i.e. the unit diagonal of \f$L\f$ is not
+*  stored.
+*
+*  No analysis is required and all sweeps are bandwidth bound kernels without any
+*  dependencies within a sweep. Zero and missing diagonal entries are not reported;
+*  the corresponding divisions are skipped.
+*
+*  Consecutive sweeps alternate between \p csr_val and the temporary storage buffer
+*  of size returned by rocsparse_csritilu0_buffer_size(), such that each sweep only
+*  depends on the previous one and the result is deterministic.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  dir        direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A.
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
-*
-*  @param[out]
-*  nnz_per_row_columns
-*              array of size \p m or \p n containing the number of nonzero elements per row or column, respectively.
-*  @param[out]
-*  nnz_total_dev_host_ptr
-*              total number of nonzero elements in device or host memory.
+*  nsweeps     number of fixed-point sweeps \f$\ge 0\f$. If \p nsweeps is zero,
+*              \p csr_val is not modified.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_row_columns or \p nnz_total_dev_host_ptr
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p nsweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_snnz(rocsparse_handle          handle,
-                                rocsparse_direction       dir,
-                                rocsparse_int             m,
-                                rocsparse_int             n,
-                                const rocsparse_mat_descr descr,
-                                const float*              A,
-                                rocsparse_int             ld,
-                                rocsparse_int*            nnz_per_row_columns,
-                                rocsparse_int*            nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_scsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             nsweeps,
+                                      void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dnnz(rocsparse_handle          handle,
-                                rocsparse_direction       dir,
-                                rocsparse_int             m,
-                                rocsparse_int             n,
-                                const rocsparse_mat_descr descr,
-                                const double*             A,
-                                rocsparse_int             ld,
-                                rocsparse_int*            nnz_per_row_columns,
-                                rocsparse_int*            nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_dcsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             nsweeps,
+                                      void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cnnz(rocsparse_handle               handle,
-                                rocsparse_direction            dir,
-                                rocsparse_int                  m,
-                                rocsparse_int                  n,
-                                const rocsparse_mat_descr      descr,
-                                const rocsparse_float_complex* A,
-                                rocsparse_int                  ld,
-                                rocsparse_int*                 nnz_per_row_columns,
-                                rocsparse_int*                 nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_ccsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_float_complex*  csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             nsweeps,
+                                      void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_znnz(rocsparse_handle                handle,
-                                rocsparse_direction             dir,
-                                rocsparse_int                   m,
-                                rocsparse_int                   n,
-                                const rocsparse_mat_descr       descr,
-                                const rocsparse_double_complex* A,
-                                rocsparse_int                   ld,
-                                rocsparse_int*                  nnz_per_row_columns,
-                                rocsparse_int*                  nnz_total_dev_host_ptr);
+rocsparse_status rocsparse_zcsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             nsweeps,
+                                      void*                     temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the matrix A in dense format into a sparse matrix in CSR format.
-*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_row, which can be pre-computed with rocsparse_xnnz().
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+/*! \ingroup precond_module
+*  \brief Iterative incomplete Cholesky factorization with 0 fill-ins using CSR storage format
+*
 *  \details
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  \p rocsparse_csritic0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsritic0(), rocsparse_dcsritic0(), rocsparse_ccsritic0()
+*  and rocsparse_zcsritic0().
 *
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
-*
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  nnz_per_rows   array of size \p n containing the number of non-zero elements per row.
-*
-*  @param[out]
-*  csr_val
-*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*  @param[out]
-*  csr_row_ptr
-*              integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
 *  @param[out]
-*  csr_col_ind
-*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsritic0(), rocsparse_dcsritic0(), rocsparse_ccsritic0() and
+*              rocsparse_zcsritic0().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_rows or \p csr_val \p csr_row_ptr or \p csr_col_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sdense2csr(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_rows,
-                                      float*                    csr_val,
-                                      rocsparse_int*            csr_row_ptr,
-                                      rocsparse_int*            csr_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ddense2csr(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_rows,
-                                      double*                   csr_val,
-                                      rocsparse_int*            csr_row_ptr,
-                                      rocsparse_int*            csr_col_ind);
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cdense2csr(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* A,
-                                      rocsparse_int                  ld,
-                                      const rocsparse_int*           nnz_per_rows,
-                                      rocsparse_float_complex*       csr_val,
-                                      rocsparse_int*                 csr_row_ptr,
-                                      rocsparse_int*                 csr_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zdense2csr(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* A,
-                                      rocsparse_int                   ld,
-                                      const rocsparse_int*            nnz_per_rows,
-                                      rocsparse_double_complex*       csr_val,
-                                      rocsparse_int*                  csr_row_ptr,
-                                      rocsparse_int*                  csr_col_ind);
+rocsparse_status rocsparse_scsritic0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritic0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritic0_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_int                  m,
+                                                 rocsparse_int                  nnz,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 const rocsparse_int*           csr_row_ptr,
+                                                 const rocsparse_int*           csr_col_ind,
+                                                 size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritic0_buffer_size(rocsparse_handle                handle,
+                                                 rocsparse_int                   m,
+                                                 rocsparse_int                   nnz,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 const rocsparse_int*            csr_row_ptr,
+                                                 const rocsparse_int*            csr_col_ind,
+                                                 size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function computes the the size of the user allocated temporary storage buffer used when converting and pruning
-*  a dense matrix to a CSR matrix.
+/*! \ingroup precond_module
+*  \brief Iterative incomplete Cholesky factorization with 0 fill-ins using CSR storage format
 *
 *  \details
-*  \p rocsparse_prune_dense2csr_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
-*  rocsparse_sprune_dense2csr(), and rocsparse_dprune_dense2csr(). The temporary
-*  storage buffer must be allocated by the user.
+*  \p rocsparse_csritic0 computes an approximation of the incomplete Cholesky
+*  factorization with 0 fill-ins and no pivoting \f$A \approx LL^T\f$ by fixed-point
+*  sweeps, where all entries of \f$L\f$ are updated in parallel. Starting from the lower
+*  triangular part of \f$A\f$, each sweep computes
+*  \f[
+*    s_{ij} = a_{ij} - \sum_{k < j} l_{jk} \overline{l_{ik}}, \quad
+*    l_{ij} = s_{ij} / l_{jj} \; (j < i), \quad l_{ii} = \sqrt{|s_{ii}|}
+*  \f]
+*  from the iterate of the previous sweep. The factor is exact once \p nsweeps reaches
+*  the depth of the dependency graph of the factorization, but a few sweeps typically
+*  suffice for a preconditioner. The result is stored in the lower triangular part of
+*  \p csr_val in the same format as the output of rocsparse_scsric0(), the strictly
+*  upper triangular part is not modified.
+*
+*  No analysis is required and all sweeps are bandwidth bound kernels without any
+*  dependencies within a sweep. The first row with a missing diagonal entry or a
+*  non-positive \f$s_{ii}\f$ in the final sweep is reported as zero pivot, which can
+*  be obtained by calling rocsparse_csric0_zero_pivot(). The corresponding divisions
+*  are skipped.
+*
+*  Consecutive sweeps alternate between \p csr_val and the temporary storage buffer
+*  of size returned by rocsparse_csritic0_buffer_size(), such that each sweep only
+*  depends on the previous one and the result is deterministic.
 *
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
 *
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
-*
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  csr_val
-*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the zero pivot of the factorization.
 *  @param[in]
-*  csr_row_ptr
-*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  nsweeps     number of fixed-point sweeps \f$\ge 0\f$. If \p nsweeps is zero,
+*              \p csr_val is not modified.
 *  @param[in]
-*  csr_col_ind
-*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
-*  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
-*              rocsparse_sprune_dense2csr() and rocsparse_dprune_dense2csr().
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p nsweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_buffer_size(rocsparse_handle          handle,
-                                                        rocsparse_int             m,
-                                                        rocsparse_int             n,
-                                                        const float*              A,
-                                                        rocsparse_int             lda,
-                                                        const float*              threshold,
-                                                        const rocsparse_mat_descr descr,
-                                                        const float*              csr_val,
-                                                        const rocsparse_int*      csr_row_ptr,
-                                                        const rocsparse_int*      csr_col_ind,
-                                                        size_t*                   buffer_size);
+rocsparse_status rocsparse_scsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_buffer_size(rocsparse_handle          handle,
-                                                        rocsparse_int             m,
-                                                        rocsparse_int             n,
-                                                        const double*             A,
-                                                        rocsparse_int             lda,
-                                                        const double*             threshold,
-                                                        const rocsparse_mat_descr descr,
-                                                        const double*             csr_val,
-                                                        const rocsparse_int*      csr_row_ptr,
-                                                        const rocsparse_int*      csr_col_ind,
-                                                        size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_float_complex*  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     void*                     temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix once
-*  elements less than the threshold are pruned from the matrix.
+/*! \ingroup precond_module
+*  \brief Multicolor incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
 *
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  \p rocsparse_csrmcilu0 computes the incomplete LU factorization with 0 fill-ins and no
+*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$ that has been symmetrically
+*  permuted by color using rocsparse_csrcolor_permute(), such that
+*  \f[
+*    A \approx LU
+*  \f]
+*
+*  Rows of the same color do not depend on each other. The factorization is therefore
+*  computed color by color, where all rows of a color are processed concurrently and no
+*  synchronization between rows is required. The number of dependent steps is the number
+*  of colors instead of the depth of the dependency graph of \f$A\f$. The factors are
+*  stored in \p csr_val in the same format as the output of rocsparse_scsrilu0().
+*
+*  \p rocsparse_csrmcilu0 requires a prior call to rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis() on the color permuted matrix, whose temporary buffer
+*  is not required by this function. Numeric
+*  boosting, as set up by rocsparse_scsrilu0_numeric_boost(), is applied in the same way
+*  as in rocsparse_scsrilu0(). \p rocsparse_csrmcilu0 reports the first zero pivot
+*  (either numerical or structural zero) in the same way as rocsparse_scsrilu0(), which
+*  can be obtained by calling rocsparse_csrilu0_zero_pivot(). Indices refer to the color
+*  permuted matrix.
+*
+*  The triangular factors can be solved with rocsparse_scsrsv_solve() using
+*  \ref rocsparse_solve_policy_level. Since the strictly lower and strictly upper
+*  triangular part of each row only couples to rows of other colors, the number of
+*  levels of each triangular factor does not exceed \p ncolors.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted and \p color_ptr has to be obtained from a
+*  distance-1 coloring of the symmetric sparsity pattern of the matrix, e.g. by
+*  rocsparse_scsrcolor() followed by rocsparse_scsrcolor_permute().
+*
+*  \note
+*  This function is blocking with respect to the host, since the color offsets are
+*  required on the host to launch each color.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           number of rows of the color permuted sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  nnz         number of non-zero entries of the color permuted sparse CSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  descr       descriptor of the color permuted sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the color permuted sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              color permuted sparse CSR matrix.
 *  @param[in]
-*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
-*
+*  csr_col_ind array of \p nnz elements containing the column indices of the color
+*              permuted sparse CSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A.
-*
-*  @param[out]
-*  csr_row_ptr
-*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*  @param[out]
-*  nnz_total_dev_host_ptr
-*              total number of nonzero elements in device or host memory.
-*
-*  @param[out]
-*  temp_buffer
-*              buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
+*  ncolors     number of colors.
+*  @param[in]
+*  color_ptr   array of \p ncolors+1 elements that point to the first row of every
+*              color, as returned by rocsparse_csrcolor_permute().
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p threshold or \p descr or \p csr_row_ptr
-*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p ncolors is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p color_ptr or \p info pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_nnz(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                const float*              A,
-                                                rocsparse_int             lda,
-                                                const float*              threshold,
-                                                const rocsparse_mat_descr descr,
-                                                rocsparse_int*            csr_row_ptr,
-                                                rocsparse_int*            nnz_total_dev_host_ptr,
-                                                void*                     temp_buffer);
+rocsparse_status rocsparse_scsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             ncolors,
+                                      const rocsparse_int*      color_ptr,
+                                      rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_nnz(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                const double*             A,
-                                                rocsparse_int             lda,
-                                                const double*             threshold,
-                                                const rocsparse_mat_descr descr,
-                                                rocsparse_int*            csr_row_ptr,
-                                                rocsparse_int*            nnz_total_dev_host_ptr,
-                                                void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             ncolors,
+                                      const rocsparse_int*      color_ptr,
+                                      rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_float_complex*  csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             ncolors,
+                                      const rocsparse_int*      color_ptr,
+                                      rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_int             ncolors,
+                                      const rocsparse_int*      color_ptr,
+                                      rocsparse_mat_info        info);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
-*  that are less than the threshold. All the parameters are assumed to have been pre-allocated by the user.
+/*! \ingroup precond_module
+*  \brief Multicolor incomplete Cholesky factorization with 0 fill-ins and no pivoting
+*  using CSR storage format
 *
 *  \details
-*  The user first allocates \p csr_row_ptr to have \p m+1 elements and then calls rocsparse_xprune_dense2csr_nnz()
-*  which fills in the \p csr_row_ptr array and stores the number of elements that are larger than the pruning threshold
-*  in \p nnz_total_dev_host_ptr. The user then allocates \p csr_col_ind and \p csr_val to have size \p nnz_total_dev_host_ptr
-*  and completes the conversion by calling rocsparse_xprune_dense2csr(). A temporary storage buffer is used by both
-*  rocsparse_xprune_dense2csr_nnz() and rocsparse_xprune_dense2csr() and must be allocated by the user and whose size is determined
-*  by rocsparse_xprune_dense2csr_buffer_size(). The routine rocsparse_xprune_dense2csr() is executed asynchronously with
-*  respect to the host and may return control to the application on the host before the entire result is ready.
+*  \p rocsparse_csrmcic0 computes the incomplete Cholesky factorization with 0 fill-ins
+*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$ that has been
+*  symmetrically permuted by color using rocsparse_csrcolor_permute(), such that
+*  \f[
+*    A \approx LL^T
+*  \f]
+*
+*  Rows of the same color do not depend on each other. The factorization is therefore
+*  computed color by color, where all rows of a color are processed concurrently and no
+*  synchronization between rows is required. The number of dependent steps is the number
+*  of colors instead of the depth of the dependency graph of \f$A\f$. The factor is
+*  stored in \p csr_val in the same format as the output of rocsparse_scsric0().
+*
+*  \p rocsparse_csrmcic0 requires a prior call to rocsparse_scsric0_analysis(),
+*  rocsparse_dcsric0_analysis(), rocsparse_ccsric0_analysis() or
+*  rocsparse_zcsric0_analysis() on the color permuted matrix, whose temporary buffer is
+*  not required by this function. \p rocsparse_csrmcic0 reports the first zero pivot
+*  (either numerical or structural zero) in the same way as rocsparse_scsric0(), which
+*  can be obtained by calling rocsparse_csric0_zero_pivot(). Indices refer to the color
+*  permuted matrix.
+*
+*  The triangular factor can be solved with rocsparse_scsrsv_solve() using
+*  \ref rocsparse_solve_policy_level, requiring at most \p ncolors levels.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted and \p color_ptr has to be obtained from a
+*  distance-1 coloring of the symmetric sparsity pattern of the matrix, e.g. by
+*  rocsparse_scsrcolor() followed by rocsparse_scsrcolor_permute().
+*
+*  \note
+*  This function is blocking with respect to the host, since the color offsets are
+*  required on the host to launch each color.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           number of rows of the color permuted sparse CSR matrix.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  nnz         number of non-zero entries of the color permuted sparse CSR matrix.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  descr       descriptor of the color permuted sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the color permuted sparse CSR matrix.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              color permuted sparse CSR matrix.
 *  @param[in]
-*  threshold   pointer to the non-negative pruning threshold which can exist in either host or device memory.
-*
+*  csr_col_ind array of \p nnz elements containing the column indices of the color
+*              permuted sparse CSR matrix.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
-*  @param[out]
-*  csr_val
-*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  ncolors     number of colors.
 *  @param[in]
-*  csr_row_ptr
-*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*  @param[out]
-*  csr_col_ind
-*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  color_ptr   array of \p ncolors+1 elements that point to the first row of every
+*              color, as returned by rocsparse_csrcolor_permute().
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_xprune_dense2csr_buffer_size().
+*  info        structure that holds the information collected during the analysis step.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p threshold or \p csr_val
-*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p ncolors is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p color_ptr or \p info pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             n,
-                                            const float*              A,
-                                            rocsparse_int             lda,
-                                            const float*              threshold,
-                                            const rocsparse_mat_descr descr,
-                                            float*                    csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            rocsparse_int*            csr_col_ind,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_scsrmcic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             ncolors,
+                                     const rocsparse_int*      color_ptr,
+                                     rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             n,
-                                            const double*             A,
-                                            rocsparse_int             lda,
-                                            const double*             threshold,
-                                            const rocsparse_mat_descr descr,
-                                            double*                   csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            rocsparse_int*            csr_col_ind,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrmcic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             ncolors,
+                                     const rocsparse_int*      color_ptr,
+                                     rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmcic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_float_complex*  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             ncolors,
+                                     const rocsparse_int*      color_ptr,
+                                     rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmcic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_int             ncolors,
+                                     const rocsparse_int*      color_ptr,
+                                     rocsparse_mat_info        info);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function computes the size of the user allocated temporary storage buffer used when converting and pruning by percentage a
-*  dense matrix to a CSR matrix.
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver with pivoting
 *
 *  \details
-*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
-*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
-*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
-*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
-*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
-*
-*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
-*  sorted array by
-*  \f[
-*    pos = ceil(m*n*(percentage/100)) - 1
-*    pos = min(pos, m*n-1)
-*    pos = max(pos, 0)
-*    threshold = sorted_A[pos]
-*  \f]
-*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
-*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \p rocsparse_gtsv_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv(), rocsparse_dgtsv(),
+*  rocsparse_cgtsv() and rocsparse_zgtsv(). The temporary storage buffer
+*  must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
-*  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
-*  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
-*  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  m           size of the tri-diagonal linear system (must be >= 2).
 *  @param[in]
-*  percentage  percentage >= 0 and percentage <= 100.
-*
+*  n           number of columns in the dense matrix B.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  csr_val    array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
 *  @param[in]
-*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
+*  B           Dense matrix of size ( \p ldb, \p n ).
 *  @param[in]
-*  info prune information structure
-*
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
 *  @param[out]
 *  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sprune_dense2csr_nnz_by_percentage(), rocsparse_dprune_dense2csr_nnz_by_percentage(),
-*              rocsparse_sprune_dense2csr_by_percentage() and rocsparse_dprune_dense2csr_by_percentage().
+*              rocsparse_sgtsv(), rocsparse_dgtsv(), rocsparse_cgtsv()
+*              and rocsparse_zgtsv().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p B or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status
-    rocsparse_sprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
-                                                         rocsparse_int             m,
-                                                         rocsparse_int             n,
-                                                         const float*              A,
-                                                         rocsparse_int             lda,
-                                                         float                     percentage,
-                                                         const rocsparse_mat_descr descr,
-                                                         const float*              csr_val,
-                                                         const rocsparse_int*      csr_row_ptr,
-                                                         const rocsparse_int*      csr_col_ind,
-                                                         rocsparse_mat_info        info,
-                                                         size_t*                   buffer_size);
+rocsparse_status rocsparse_sgtsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_int    m,
+                                             rocsparse_int    n,
+                                             const float*     dl,
+                                             const float*     d,
+                                             const float*     du,
+                                             const float*     B,
+                                             rocsparse_int    ldb,
+                                             size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status
-    rocsparse_dprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
-                                                         rocsparse_int             m,
-                                                         rocsparse_int             n,
-                                                         const double*             A,
-                                                         rocsparse_int             lda,
-                                                         double                    percentage,
-                                                         const rocsparse_mat_descr descr,
-                                                         const double*             csr_val,
-                                                         const rocsparse_int*      csr_row_ptr,
-                                                         const rocsparse_int*      csr_col_ind,
-                                                         rocsparse_mat_info        info,
-                                                         size_t*                   buffer_size);
-/**@}*/
+rocsparse_status rocsparse_dgtsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_int    m,
+                                             rocsparse_int    n,
+                                             const double*    dl,
+                                             const double*    d,
+                                             const double*    du,
+                                             const double*    B,
+                                             rocsparse_int    ldb,
+                                             size_t*          buffer_size);
 
-/*! \ingroup conv_module
-*  \brief
-*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix
-*  when converting and pruning by percentage a dense matrix to a CSR matrix.
-*
-*  \details
-*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
-*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
-*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
-*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
-*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
-*
-*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
-*  sorted array by
-*  \f[
-*    pos = ceil(m*n*(percentage/100)) - 1
-*    pos = min(pos, m*n-1)
-*    pos = max(pos, 0)
-*    threshold = sorted_A[pos]
-*  \f]
-*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. The routine does
-*  support asynchronous execution if the pointer mode is set to device.
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_buffer_size(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             const rocsparse_float_complex* dl,
+                                             const rocsparse_float_complex* d,
+                                             const rocsparse_float_complex* du,
+                                             const rocsparse_float_complex* B,
+                                             rocsparse_int                  ldb,
+                                             size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_buffer_size(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             const rocsparse_double_complex* dl,
+                                             const rocsparse_double_complex* d,
+                                             const rocsparse_double_complex* du,
+                                             const rocsparse_double_complex* B,
+                                             rocsparse_int                   ldb,
+                                             size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver with pivoting
+*
+*  \details
+*  \p rocsparse_gtsv solves a tridiagonal system for multiple right hand sides using pivoting.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system (must be >= 2).
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  n           number of columns in the dense matrix B.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  percentage  percentage >= 0 and percentage <= 100.
-*
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  B           Dense matrix of size ( \p ldb, \p n ).
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A.
-*
-*  @param[out]
-*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*
-*  @param[out]
-*  nnz_total_dev_host_ptr total number of nonzero elements in device or host memory.
-*
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
 *  @param[in]
-*  info prune information structure
-*
-*  @param[out]
-*  temp_buffer buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_row_ptr
-*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p B or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
-                                                              rocsparse_int             m,
-                                                              rocsparse_int             n,
-                                                              const float*              A,
-                                                              rocsparse_int             lda,
-                                                              float                     percentage,
-                                                              const rocsparse_mat_descr descr,
-                                                              rocsparse_int*            csr_row_ptr,
-                                                              rocsparse_int* nnz_total_dev_host_ptr,
-                                                              rocsparse_mat_info info,
-                                                              void*              temp_buffer);
+rocsparse_status rocsparse_sgtsv(rocsparse_handle handle,
+                                 rocsparse_int    m,
+                                 rocsparse_int    n,
+                                 const float*     dl,
+                                 const float*     d,
+                                 const float*     du,
+                                 float*           B,
+                                 rocsparse_int    ldb,
+                                 void*            temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
-                                                              rocsparse_int             m,
-                                                              rocsparse_int             n,
-                                                              const double*             A,
-                                                              rocsparse_int             lda,
-                                                              double                    percentage,
-                                                              const rocsparse_mat_descr descr,
-                                                              rocsparse_int*            csr_row_ptr,
-                                                              rocsparse_int* nnz_total_dev_host_ptr,
-                                                              rocsparse_mat_info info,
-                                                              void*              temp_buffer);
+rocsparse_status rocsparse_dgtsv(rocsparse_handle handle,
+                                 rocsparse_int    m,
+                                 rocsparse_int    n,
+                                 const double*    dl,
+                                 const double*    d,
+                                 const double*    du,
+                                 double*          B,
+                                 rocsparse_int    ldb,
+                                 void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv(rocsparse_handle               handle,
+                                 rocsparse_int                  m,
+                                 rocsparse_int                  n,
+                                 const rocsparse_float_complex* dl,
+                                 const rocsparse_float_complex* d,
+                                 const rocsparse_float_complex* du,
+                                 rocsparse_float_complex*       B,
+                                 rocsparse_int                  ldb,
+                                 void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv(rocsparse_handle                handle,
+                                 rocsparse_int                   m,
+                                 rocsparse_int                   n,
+                                 const rocsparse_double_complex* dl,
+                                 const rocsparse_double_complex* d,
+                                 const rocsparse_double_complex* du,
+                                 rocsparse_double_complex*       B,
+                                 rocsparse_int                   ldb,
+                                 void*                           temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
-*  based on percentage.
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver (no pivoting)
 *
 *  \details
-*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
-*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
-*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
-*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
-*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
-*
-*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
-*  sorted array by
-*  \f[
-*    pos = ceil(m*n*(percentage/100)) - 1
-*    pos = min(pos, m*n-1)
-*    pos = max(pos, 0)
-*    threshold = sorted_A[pos]
-*  \f]
-*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
-*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \p rocsparse_gtsv_no_pivot_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(),
+*  rocsparse_cgtsv_no_pivot() and rocsparse_zgtsv_no_pivot(). The temporary storage buffer
+*  must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system (must be >= 2).
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  n           number of columns in the dense matrix B.
 *  @param[in]
-*  A           array of dimensions (\p lda, \p n)
-*
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  lda         leading dimension of dense array \p A.
-*
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  percentage  percentage >= 0 and percentage <= 100.
-*
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
-*  @param[out]
-*  csr_val array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
-*
+*  B           Dense matrix of size ( \p ldb, \p n ).
 *  @param[in]
-*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
-*
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
 *  @param[out]
-*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
-*  @param[in]
-*  info prune information structure
-*
-*  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_xprune_dense2csr_buffer_size().
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(), rocsparse_cgtsv_no_pivot()
+*              and rocsparse_zgtsv_no_pivot().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_val
-*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p B or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sprune_dense2csr_by_percentage(rocsparse_handle          handle,
-                                                          rocsparse_int             m,
-                                                          rocsparse_int             n,
-                                                          const float*              A,
-                                                          rocsparse_int             lda,
-                                                          float                     percentage,
-                                                          const rocsparse_mat_descr descr,
-                                                          float*                    csr_val,
-                                                          const rocsparse_int*      csr_row_ptr,
-                                                          rocsparse_int*            csr_col_ind,
-                                                          rocsparse_mat_info        info,
-                                                          void*                     temp_buffer);
+rocsparse_status rocsparse_sgtsv_no_pivot_buffer_size(rocsparse_handle handle,
+                                                      rocsparse_int    m,
+                                                      rocsparse_int    n,
+                                                      const float*     dl,
+                                                      const float*     d,
+                                                      const float*     du,
+                                                      const float*     B,
+                                                      rocsparse_int    ldb,
+                                                      size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dprune_dense2csr_by_percentage(rocsparse_handle          handle,
-                                                          rocsparse_int             m,
-                                                          rocsparse_int             n,
-                                                          const double*             A,
-                                                          rocsparse_int             lda,
-                                                          double                    percentage,
-                                                          const rocsparse_mat_descr descr,
-                                                          double*                   csr_val,
-                                                          const rocsparse_int*      csr_row_ptr,
-                                                          rocsparse_int*            csr_col_ind,
-                                                          rocsparse_mat_info        info,
-                                                          void*                     temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_dgtsv_no_pivot_buffer_size(rocsparse_handle handle,
+                                                      rocsparse_int    m,
+                                                      rocsparse_int    n,
+                                                      const double*    dl,
+                                                      const double*    d,
+                                                      const double*    du,
+                                                      const double*    B,
+                                                      rocsparse_int    ldb,
+                                                      size_t*          buffer_size);
 
-/*! \ingroup conv_module
-*  \brief
-*
-*  This function converts the matrix A in dense format into a sparse matrix in CSC format.
-*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_columns, which can be pre-computed with rocsparse_xnnz().
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
-*
-*  \details
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_no_pivot_buffer_size(rocsparse_handle               handle,
+                                                      rocsparse_int                  m,
+                                                      rocsparse_int                  n,
+                                                      const rocsparse_float_complex* dl,
+                                                      const rocsparse_float_complex* d,
+                                                      const rocsparse_float_complex* du,
+                                                      const rocsparse_float_complex* B,
+                                                      rocsparse_int                  ldb,
+                                                      size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_no_pivot_buffer_size(rocsparse_handle                handle,
+                                                      rocsparse_int                   m,
+                                                      rocsparse_int                   n,
+                                                      const rocsparse_double_complex* dl,
+                                                      const rocsparse_double_complex* d,
+                                                      const rocsparse_double_complex* du,
+                                                      const rocsparse_double_complex* B,
+                                                      rocsparse_int                   ldb,
+                                                      size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p rocsparse_gtsv_no_pivot  solves a tridiagonal linear system for multiple right-hand sides
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system (must be >= 2).
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  n           number of columns in the dense matrix B.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
-*
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  B           Dense matrix of size ( \p ldb, \p n ).
 *  @param[in]
-*  nnz_per_columns   array of size \p n containing the number of non-zero elements per column.
-*
-*  @param[out]
-*  csc_val
-*              array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
-*  @param[out]
-*  csc_col_ptr
-*              integer array of m+1 elements that contains the start of every column and the end of the last column plus one.
-*  @param[out]
-*  csc_row_ind
-*              integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_columns or \p csc_val \p csc_col_ptr or \p csc_row_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p B or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sdense2csc(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_columns,
-                                      float*                    csc_val,
-                                      rocsparse_int*            csc_col_ptr,
-                                      rocsparse_int*            csc_row_ind);
+rocsparse_status rocsparse_sgtsv_no_pivot(rocsparse_handle handle,
+                                          rocsparse_int    m,
+                                          rocsparse_int    n,
+                                          const float*     dl,
+                                          const float*     d,
+                                          const float*     du,
+                                          float*           B,
+                                          rocsparse_int    ldb,
+                                          void*            temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ddense2csc(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_columns,
-                                      double*                   csc_val,
-                                      rocsparse_int*            csc_col_ptr,
-                                      rocsparse_int*            csc_row_ind);
+rocsparse_status rocsparse_dgtsv_no_pivot(rocsparse_handle handle,
+                                          rocsparse_int    m,
+                                          rocsparse_int    n,
+                                          const double*    dl,
+                                          const double*    d,
+                                          const double*    du,
+                                          double*          B,
+                                          rocsparse_int    ldb,
+                                          void*            temp_buffer);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cdense2csc(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* A,
-                                      rocsparse_int                  ld,
-                                      const rocsparse_int*           nnz_per_columns,
-                                      rocsparse_float_complex*       csc_val,
-                                      rocsparse_int*                 csc_col_ptr,
-                                      rocsparse_int*                 csc_row_ind);
+rocsparse_status rocsparse_cgtsv_no_pivot(rocsparse_handle               handle,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  n,
+                                          const rocsparse_float_complex* dl,
+                                          const rocsparse_float_complex* d,
+                                          const rocsparse_float_complex* du,
+                                          rocsparse_float_complex*       B,
+                                          rocsparse_int                  ldb,
+                                          void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zdense2csc(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* A,
-                                      rocsparse_int                   ld,
-                                      const rocsparse_int*            nnz_per_columns,
-                                      rocsparse_double_complex*       csc_val,
-                                      rocsparse_int*                  csc_col_ptr,
-                                      rocsparse_int*                  csc_row_ind);
+rocsparse_status rocsparse_zgtsv_no_pivot(rocsparse_handle                handle,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   n,
+                                          const rocsparse_double_complex* dl,
+                                          const rocsparse_double_complex* d,
+                                          const rocsparse_double_complex* du,
+                                          rocsparse_double_complex*       B,
+                                          rocsparse_int                   ldb,
+                                          void*                           temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*
-*  This function converts the matrix A in dense format into a sparse matrix in COO format.
-*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_rows, which can be pre-computed with rocsparse_xnnz().
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver (no pivoting)
 *
 *  \details
+*  \p rocsparse_gtsv_no_pivot_strided_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(),
+*  rocsparse_cgtsv_no_pivot_strided_batch() and rocsparse_zgtsv_no_pivot_strided_batch(). The temporary
+*  storage buffer must be allocated by the user.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
 *  @param[in]
-*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
 *  @param[in]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
 *  @param[in]
-*  ld         leading dimension of dense array \p A.
-*
+*  batch_count The number of systems to solve.
 *  @param[in]
-*  nnz_per_rows   array of size \p n containing the number of non-zero elements per row.
-*
-*  @param[out]
-*  coo_val
-*              array of nnz nonzero elements of matrix \p A.
-*  @param[out]
-*  coo_row_ind
-*              integer array of nnz row indices of the non-zero elements of matrix \p A.
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
 *  @param[out]
-*  coo_col_ind integer array of nnz column indices of the non-zero elements of matrix \p A.
-*
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(), rocsparse_cgtsv_no_pivot_strided_batch()
+*              and rocsparse_zgtsv_no_pivot_strided_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_rows or \p coo_val \p coo_col_ind or \p coo_row_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sdense2coo(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_rows,
-                                      float*                    coo_val,
-                                      rocsparse_int*            coo_row_ind,
-                                      rocsparse_int*            coo_col_ind);
+rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const float*     dl,
+                                                                    const float*     d,
+                                                                    const float*     du,
+                                                                    const float*     x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ddense2coo(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             A,
-                                      rocsparse_int             ld,
-                                      const rocsparse_int*      nnz_per_rows,
-                                      double*                   coo_val,
-                                      rocsparse_int*            coo_row_ind,
-                                      rocsparse_int*            coo_col_ind);
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cdense2coo(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* A,
-                                      rocsparse_int                  ld,
-                                      const rocsparse_int*           nnz_per_rows,
-                                      rocsparse_float_complex*       coo_val,
-                                      rocsparse_int*                 coo_row_ind,
-                                      rocsparse_int*                 coo_col_ind);
+rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const double*    dl,
+                                                                    const double*    d,
+                                                                    const double*    du,
+                                                                    const double*    x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zdense2coo(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* A,
-                                      rocsparse_int                   ld,
-                                      const rocsparse_int*            nnz_per_rows,
-                                      rocsparse_double_complex*       coo_val,
-                                      rocsparse_int*                  coo_row_ind,
-                                      rocsparse_int*                  coo_col_ind);
+rocsparse_status
+    rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
+                                                       rocsparse_int                  m,
+                                                       const rocsparse_float_complex* dl,
+                                                       const rocsparse_float_complex* d,
+                                                       const rocsparse_float_complex* du,
+                                                       const rocsparse_float_complex* x,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_int                  batch_stride,
+                                                       size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
+                                                       rocsparse_int                   m,
+                                                       const rocsparse_double_complex* dl,
+                                                       const rocsparse_double_complex* d,
+                                                       const rocsparse_double_complex* du,
+                                                       const rocsparse_double_complex* x,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_int                   batch_stride,
+                                                       size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the sparse matrix in CSR format into a dense matrix.
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver (no pivoting)
+*
 *  \details
+*  \p rocsparse_gtsv_no_pivot_strided_batch  solves a batched tridiagonal linear system
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system (must be >= 2).
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  csr_val     array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
 *  @param[in]
-*  csr_row_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  batch_count The number of systems to solve.
 *  @param[in]
-*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
-*  @param[out]
-*  A           array of dimensions (\p ld, \p n)
-*
-*  @param[out]
-*  ld          leading dimension of dense array \p A.
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p csr_val \p csr_row_ptr or \p csr_col_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              csr_val,
-                                      const rocsparse_int*      csr_row_ptr,
-                                      const rocsparse_int*      csr_col_ind,
-                                      float*                    A,
-                                      rocsparse_int             ld);
+rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const float*     dl,
+                                                        const float*     d,
+                                                        const float*     du,
+                                                        float*           x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             csr_val,
-                                      const rocsparse_int*      csr_row_ptr,
-                                      const rocsparse_int*      csr_col_ind,
-                                      double*                   A,
-                                      rocsparse_int             ld);
+rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const double*    dl,
+                                                        const double*    d,
+                                                        const double*    du,
+                                                        double*          x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2dense(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* csr_val,
-                                      const rocsparse_int*           csr_row_ptr,
-                                      const rocsparse_int*           csr_col_ind,
-                                      rocsparse_float_complex*       A,
-                                      rocsparse_int                  ld);
+rocsparse_status rocsparse_cgtsv_no_pivot_strided_batch(rocsparse_handle               handle,
+                                                        rocsparse_int                  m,
+                                                        const rocsparse_float_complex* dl,
+                                                        const rocsparse_float_complex* d,
+                                                        const rocsparse_float_complex* du,
+                                                        rocsparse_float_complex*       x,
+                                                        rocsparse_int                  batch_count,
+                                                        rocsparse_int                  batch_stride,
+                                                        void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2dense(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* csr_val,
-                                      const rocsparse_int*            csr_row_ptr,
-                                      const rocsparse_int*            csr_col_ind,
-                                      rocsparse_double_complex*       A,
-                                      rocsparse_int                   ld);
+rocsparse_status rocsparse_zgtsv_no_pivot_strided_batch(rocsparse_handle                handle,
+                                                        rocsparse_int                   m,
+                                                        const rocsparse_double_complex* dl,
+                                                        const rocsparse_double_complex* d,
+                                                        const rocsparse_double_complex* du,
+                                                        rocsparse_double_complex*       x,
+                                                        rocsparse_int                   batch_count,
+                                                        rocsparse_int batch_stride,
+                                                        void*         temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the sparse matrix in CSC format into a dense matrix.
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver (with pivoting)
+*
 *  \details
+*  \p rocsparse_gtsv_strided_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_strided_batch(), rocsparse_dgtsv_strided_batch(),
+*  rocsparse_cgtsv_strided_batch() and rocsparse_zgtsv_strided_batch(). The temporary
+*  storage buffer must be allocated by the user.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system.
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
 *  @param[in]
-*  csc_val     array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
+*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
 *  @param[in]
-*  csc_col_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
 *  @param[in]
-*  csc_row_ind integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
-*
-*  @param[out]
-*  A           array of dimensions (\p ld, \p n)
-*
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
 *  @param[out]
-*  ld          leading dimension of dense array \p A.
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_strided_batch(), rocsparse_dgtsv_strided_batch(), rocsparse_cgtsv_strided_batch()
+*              and rocsparse_zgtsv_strided_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p csc_val \p csc_col_ptr or \p csc_row_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsc2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              csc_val,
-                                      const rocsparse_int*      csc_col_ptr,
-                                      const rocsparse_int*      csc_row_ind,
-                                      float*                    A,
-                                      rocsparse_int             ld);
+rocsparse_status rocsparse_sgtsv_strided_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const float*     dl,
+                                                           const float*     d,
+                                                           const float*     du,
+                                                           const float*     x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsc2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             csc_val,
-                                      const rocsparse_int*      csc_col_ptr,
-                                      const rocsparse_int*      csc_row_ind,
-                                      double*                   A,
-                                      rocsparse_int             ld);
+rocsparse_status rocsparse_dgtsv_strided_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const double*    dl,
+                                                           const double*    d,
+                                                           const double*    du,
+                                                           const double*    x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsc2dense(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* csc_val,
-                                      const rocsparse_int*           csc_col_ptr,
-                                      const rocsparse_int*           csc_row_ind,
-                                      rocsparse_float_complex*       A,
-                                      rocsparse_int                  ld);
+rocsparse_status
+    rocsparse_cgtsv_strided_batch_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              const rocsparse_float_complex* dl,
+                                              const rocsparse_float_complex* d,
+                                              const rocsparse_float_complex* du,
+                                              const rocsparse_float_complex* x,
+                                              rocsparse_int                  batch_count,
+                                              rocsparse_int                  batch_stride,
+                                              size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsc2dense(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* csc_val,
-                                      const rocsparse_int*            csc_col_ptr,
-                                      const rocsparse_int*            csc_row_ind,
-                                      rocsparse_double_complex*       A,
-                                      rocsparse_int                   ld);
+rocsparse_status
+    rocsparse_zgtsv_strided_batch_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              const rocsparse_double_complex* dl,
+                                              const rocsparse_double_complex* d,
+                                              const rocsparse_double_complex* du,
+                                              const rocsparse_double_complex* x,
+                                              rocsparse_int                   batch_count,
+                                              rocsparse_int                   batch_stride,
+                                              size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the sparse matrix in COO format into a dense matrix.
-*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver (with pivoting)
+*
 *  \details
+*  \p rocsparse_gtsv_strided_batch solves a batched tridiagonal linear system using LU
+*  factorization with partial pivoting. Each system is solved by a single thread, after the
+*  systems have been transposed into interleaved layout in the temporary storage buffer. This
+*  is most efficient for a large number of small to medium sized systems.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  m           number of rows of the dense matrix \p A.
-*
+*  m           size of the tri-diagonal linear system (must be >= 2).
 *  @param[in]
-*  n           number of columns of the dense matrix \p A.
-*
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse COO matrix.
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
 *  @param[in]
-*  coo_val     array of nnz nonzero elements of matrix \p A.
+*  batch_count The number of systems to solve.
 *  @param[in]
-*  coo_row_ind integer array of nnz row indices of the non-zero elements of matrix \p A.
-*
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
 *  @param[in]
-*  coo_col_ind integer array of nnz column indices of the non-zero elements of matrix \p A.
-*  @param[out]
-*  A           array of dimensions (\p ld, \p n)
-*
-*  @param[out]
-*  ld          leading dimension of dense array \p A.
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p nnz or \p ld is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p A or \p coo_val \p coo_col_ind or \p coo_row_ind
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scoo2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      rocsparse_int             nnz,
-                                      const rocsparse_mat_descr descr,
-                                      const float*              coo_val,
-                                      const rocsparse_int*      coo_row_ind,
-                                      const rocsparse_int*      coo_col_ind,
-                                      float*                    A,
-                                      rocsparse_int             ld);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcoo2dense(rocsparse_handle          handle,
-                                      rocsparse_int             m,
-                                      rocsparse_int             n,
-                                      rocsparse_int             nnz,
-                                      const rocsparse_mat_descr descr,
-                                      const double*             coo_val,
-                                      const rocsparse_int*      coo_row_ind,
-                                      const rocsparse_int*      coo_col_ind,
-                                      double*                   A,
-                                      rocsparse_int             ld);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccoo2dense(rocsparse_handle               handle,
-                                      rocsparse_int                  m,
-                                      rocsparse_int                  n,
-                                      rocsparse_int                  nnz,
-                                      const rocsparse_mat_descr      descr,
-                                      const rocsparse_float_complex* coo_val,
-                                      const rocsparse_int*           coo_row_ind,
-                                      const rocsparse_int*           coo_col_ind,
-                                      rocsparse_float_complex*       A,
-                                      rocsparse_int                  ld);
+rocsparse_status rocsparse_sgtsv_strided_batch(rocsparse_handle handle,
+                                               rocsparse_int    m,
+                                               const float*     dl,
+                                               const float*     d,
+                                               const float*     du,
+                                               float*           x,
+                                               rocsparse_int    batch_count,
+                                               rocsparse_int    batch_stride,
+                                               void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_strided_batch(rocsparse_handle handle,
+                                               rocsparse_int    m,
+                                               const double*    dl,
+                                               const double*    d,
+                                               const double*    du,
+                                               double*          x,
+                                               rocsparse_int    batch_count,
+                                               rocsparse_int    batch_stride,
+                                               void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_strided_batch(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               const rocsparse_float_complex* dl,
+                                               const rocsparse_float_complex* d,
+                                               const rocsparse_float_complex* du,
+                                               rocsparse_float_complex*       x,
+                                               rocsparse_int                  batch_count,
+                                               rocsparse_int                  batch_stride,
+                                               void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcoo2dense(rocsparse_handle                handle,
-                                      rocsparse_int                   m,
-                                      rocsparse_int                   n,
-                                      rocsparse_int                   nnz,
-                                      const rocsparse_mat_descr       descr,
-                                      const rocsparse_double_complex* coo_val,
-                                      const rocsparse_int*            coo_row_ind,
-                                      const rocsparse_int*            coo_col_ind,
-                                      rocsparse_double_complex*       A,
-                                      rocsparse_int                   ld);
+rocsparse_status rocsparse_zgtsv_strided_batch(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               const rocsparse_double_complex* dl,
+                                               const rocsparse_double_complex* d,
+                                               const rocsparse_double_complex* du,
+                                               rocsparse_double_complex*       x,
+                                               rocsparse_int                   batch_count,
+                                               rocsparse_int                   batch_stride,
+                                               void*                           temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  Given a sparse CSR matrix and a non-negative tolerance, this function computes how many entries would be left
-*  in each row of the matrix if elements less than the tolerance were removed. It also computes the total number
-*  of remaining elements in the matrix.
+/*! \ingroup precond_module
+*  \brief Interleaved Batch tridiagonal solver
 *
-*  @param[in]
-*  handle        handle to the rocsparse library context queue.
+*  \details
+*  \p rocsparse_gtsv_interleaved_batch_buffer_size returns the size of the temporary storage
+*  buffer that is required by rocsparse_sgtsv_interleaved_batch(),
+*  rocsparse_dgtsv_interleaved_batch(), rocsparse_cgtsv_interleaved_batch() and
+*  rocsparse_zgtsv_interleaved_batch(). The temporary storage buffer must be allocated by the
+*  user.
 *
 *  @param[in]
-*  m             number of rows of the sparse CSR matrix.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  descr_A       the descriptor of the sparse CSR matrix.
-*
+*  alg         algorithm to solve the linear system.
 *  @param[in]
-*  csr_val_A     array of \p nnz_A elements of the sparse CSR matrix.
+*  m           size of the tri-diagonal linear system.
 *  @param[in]
-*  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
-*                uncompressed sparse CSR matrix.
-*  @param[out]
-*  nnz_per_row   array of length \p m containing the number of entries that will be kept per row in
-*                the final compressed CSR matrix.
-*  @param[out]
-*  nnz_C         number of elements in the column indices and values arrays of the compressed
-*                sparse CSR matrix. Can be either host or device pointer.
+*  dl          lower diagonal of tri-diagonal system where the jth entry of the ith system is
+*              stored at \p dl+batch_stride*j+i.
 *  @param[in]
-*  tol           the non-negative tolerance used for compression. If \p tol is complex then only the magnitude
-*                of the real part is used. Entries in the input uncompressed CSR array that are below the tolerance
-*                are removed in output compressed CSR matrix.
+*  d           main diagonal of tri-diagonal system where the jth entry of the ith system is
+*              stored at \p d+batch_stride*j+i.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system where the jth entry of the ith system is
+*              stored at \p du+batch_stride*j+i.
+*  @param[in]
+*  x           Dense array of righthand-sides where the jth entry of the ith righthand-side is
+*              stored at \p x+batch_stride*j+i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate consecutive entries of a system. Must
+*              satisfy \p batch_stride >= batch_count.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_interleaved_batch(), rocsparse_dgtsv_interleaved_batch(),
+*              rocsparse_cgtsv_interleaved_batch() and rocsparse_zgtsv_interleaved_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
-*  \retval     rocsparse_status_invalid_value \p tol is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_val_A or \p csr_row_ptr_A or \p nnz_per_row or \p nnz_C
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_snnz_compress(rocsparse_handle          handle,
-                                         rocsparse_int             m,
-                                         const rocsparse_mat_descr descr_A,
-                                         const float*              csr_val_A,
-                                         const rocsparse_int*      csr_row_ptr_A,
-                                         rocsparse_int*            nnz_per_row,
-                                         rocsparse_int*            nnz_C,
-                                         float                     tol);
+rocsparse_status
+    rocsparse_sgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const float*                   dl,
+                                                  const float*                   d,
+                                                  const float*                   du,
+                                                  const float*                   x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dnnz_compress(rocsparse_handle          handle,
-                                         rocsparse_int             m,
-                                         const rocsparse_mat_descr descr_A,
-                                         const double*             csr_val_A,
-                                         const rocsparse_int*      csr_row_ptr_A,
-                                         rocsparse_int*            nnz_per_row,
-                                         rocsparse_int*            nnz_C,
-                                         double                    tol);
+rocsparse_status
+    rocsparse_dgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const double*                  dl,
+                                                  const double*                  d,
+                                                  const double*                  du,
+                                                  const double*                  x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cnnz_compress(rocsparse_handle               handle,
-                                         rocsparse_int                  m,
-                                         const rocsparse_mat_descr      descr_A,
-                                         const rocsparse_float_complex* csr_val_A,
-                                         const rocsparse_int*           csr_row_ptr_A,
-                                         rocsparse_int*                 nnz_per_row,
-                                         rocsparse_int*                 nnz_C,
-                                         rocsparse_float_complex        tol);
+rocsparse_status
+    rocsparse_cgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const rocsparse_float_complex* dl,
+                                                  const rocsparse_float_complex* d,
+                                                  const rocsparse_float_complex* du,
+                                                  const rocsparse_float_complex* x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_znnz_compress(rocsparse_handle                handle,
-                                         rocsparse_int                   m,
-                                         const rocsparse_mat_descr       descr_A,
-                                         const rocsparse_double_complex* csr_val_A,
-                                         const rocsparse_int*            csr_row_ptr_A,
-                                         rocsparse_int*                  nnz_per_row,
-                                         rocsparse_int*                  nnz_C,
-                                         rocsparse_double_complex        tol);
+rocsparse_status
+    rocsparse_zgtsv_interleaved_batch_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_gtsv_interleaved_alg  alg,
+                                                  rocsparse_int                   m,
+                                                  const rocsparse_double_complex* dl,
+                                                  const rocsparse_double_complex* d,
+                                                  const rocsparse_double_complex* du,
+                                                  const rocsparse_double_complex* x,
+                                                  rocsparse_int                   batch_count,
+                                                  rocsparse_int                   batch_stride,
+                                                  size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse COO matrix
+/*! \ingroup precond_module
+*  \brief Interleaved Batch tridiagonal solver
 *
 *  \details
-*  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
-*  to the start of every row, into a COO array of row indices.
+*  \p rocsparse_gtsv_interleaved_batch solves a batched tridiagonal linear system, where the
+*  systems are stored in interleaved layout, i.e. the jth entries of all systems are stored
+*  contiguously. Each system is solved by a single thread, which results in fully coalesced
+*  memory accesses. The algorithm is selected by \p alg, see \ref rocsparse_gtsv_interleaved_alg.
 *
 *  \note
-*  It can also be used to convert a CSC array containing the column offsets into a COO
-*  array of column indices.
+*  The systems are factorized in place, thus \p dl, \p d and \p du are overwritten.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -10470,137 +10825,200 @@ rocsparse_status rocsparse_znnz_compress(rocsparse_handle                handle,
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row
-*              of the sparse CSR matrix.
+*  alg         algorithm to solve the linear system.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  m           size of the tri-diagonal linear system (must be >= 2).
+*  @param[inout]
+*  dl          lower diagonal of tri-diagonal system. First entry of each system must be zero.
+*  @param[inout]
+*  d           main diagonal of tri-diagonal system.
+*  @param[inout]
+*  du          upper diagonal of tri-diagonal system. Last entry of each system must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the jth entry of the ith righthand-side is
+*              stored at \p x+batch_stride*j+i.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
-*  @param[out]
-*  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
-*              matrix.
+*  batch_count The number of systems to solve.
 *  @param[in]
-*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  batch_stride The number of elements that separate consecutive entries of a system. Must
+*              satisfy \p batch_stride >= batch_count.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
-*              pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
-*
-*  \par Example
-*  This example converts a CSR matrix into a COO matrix.
-*  \code{.c}
-*      //     1 2 0 3 0
-*      // A = 0 4 5 0 0
-*      //     6 0 0 7 8
-*
-*      rocsparse_int m   = 3;
-*      rocsparse_int n   = 5;
-*      rocsparse_int nnz = 8;
-*
-*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
-*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
-*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
-*
-*      // Allocate COO matrix arrays
-*      rocsparse_int* coo_row_ind;
-*      rocsparse_int* coo_col_ind;
-*      float* coo_val;
-*
-*      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
-*      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
-*      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
-*
-*      // Convert the csr row offsets into coo row indices
-*      rocsparse_csr2coo(handle,
-*                        csr_row_ptr,
-*                        nnz,
-*                        m,
-*                        coo_row_ind,
-*                        rocsparse_index_base_zero);
-*
-*      // Copy the column and value arrays
-*      hipMemcpy(coo_col_ind,
-*                csr_col_ind,
-*                sizeof(rocsparse_int) * nnz,
-*                hipMemcpyDeviceToDevice);
-*
-*      hipMemcpy(coo_val,
-*                csr_val,
-*                sizeof(float) * nnz,
-*                hipMemcpyDeviceToDevice);
-*  \endcode
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
-                                   const rocsparse_int* csr_row_ptr,
-                                   rocsparse_int        nnz,
-                                   rocsparse_int        m,
-                                   rocsparse_int*       coo_row_ind,
-                                   rocsparse_index_base idx_base);
+rocsparse_status rocsparse_sgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   float*                         dl,
+                                                   float*                         d,
+                                                   float*                         du,
+                                                   float*                         x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   double*                        dl,
+                                                   double*                        d,
+                                                   double*                        du,
+                                                   double*                        x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_float_complex*       dl,
+                                                   rocsparse_float_complex*       d,
+                                                   rocsparse_float_complex*       du,
+                                                   rocsparse_float_complex*       x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_double_complex*      dl,
+                                                   rocsparse_double_complex*      d,
+                                                   rocsparse_double_complex*      du,
+                                                   rocsparse_double_complex*      x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+/**@}*/
 
-/*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+/*! \ingroup precond_module
+*  \brief Strided Batch pentadiagonal solver
 *
 *  \details
-*  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
-*  required by rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
-*  rocsparse_zcsr2csc(). The temporary storage buffer must be allocated by the user.
+*  \p rocsparse_gpsv_strided_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgpsv_strided_batch(), rocsparse_dgpsv_strided_batch(),
+*  rocsparse_cgpsv_strided_batch() and rocsparse_zgpsv_strided_batch(). The temporary
+*  storage buffer must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           size of the pentadiagonal linear system.
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  ds          lower diagonal (distance 2) of pentadiagonal system where the ith system lower
+*              diagonal starts at \p ds+batch_stride*i.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  dl          lower diagonal of pentadiagonal system where the ith system lower diagonal
+*              starts at \p dl+batch_stride*i.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  d           main diagonal of pentadiagonal system where the ith system diagonal starts at
+*              \p d+batch_stride*i.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  du          upper diagonal of pentadiagonal system where the ith system upper diagonal
+*              starts at \p du+batch_stride*i.
 *  @param[in]
-*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  dw          upper diagonal (distance 2) of pentadiagonal system where the ith system upper
+*              diagonal starts at \p dw+batch_stride*i.
+*  @param[in]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at
+*              \p x+batch_stride*i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate each system. Must satisfy
+*              \p batch_stride >= m.
 *  @param[out]
 *  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
-*              rocsparse_zcsr2csc().
+*              rocsparse_sgpsv_strided_batch(), rocsparse_dgpsv_strided_batch(),
+*              rocsparse_cgpsv_strided_batch() and rocsparse_zgpsv_strided_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
-*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
-                                               rocsparse_int        m,
-                                               rocsparse_int        n,
-                                               rocsparse_int        nnz,
-                                               const rocsparse_int* csr_row_ptr,
-                                               const rocsparse_int* csr_col_ind,
-                                               rocsparse_action     copy_values,
-                                               size_t*              buffer_size);
+rocsparse_status rocsparse_sgpsv_strided_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const float*     ds,
+                                                           const float*     dl,
+                                                           const float*     d,
+                                                           const float*     du,
+                                                           const float*     dw,
+                                                           const float*     x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_strided_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const double*    ds,
+                                                           const double*    dl,
+                                                           const double*    d,
+                                                           const double*    du,
+                                                           const double*    dw,
+                                                           const double*    x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
 
-/*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_cgpsv_strided_batch_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              const rocsparse_float_complex* ds,
+                                              const rocsparse_float_complex* dl,
+                                              const rocsparse_float_complex* d,
+                                              const rocsparse_float_complex* du,
+                                              const rocsparse_float_complex* dw,
+                                              const rocsparse_float_complex* x,
+                                              rocsparse_int                  batch_count,
+                                              rocsparse_int                  batch_stride,
+                                              size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgpsv_strided_batch_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              const rocsparse_double_complex* ds,
+                                              const rocsparse_double_complex* dl,
+                                              const rocsparse_double_complex* d,
+                                              const rocsparse_double_complex* du,
+                                              const rocsparse_double_complex* dw,
+                                              const rocsparse_double_complex* x,
+                                              rocsparse_int                   batch_count,
+                                              rocsparse_int                   batch_stride,
+                                              size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided Batch pentadiagonal solver
 *
 *  \details
-*  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
-*  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
-*  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
-*  or not (\ref rocsparse_action_symbolic).
-*
-*  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
-*  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
+*  \p rocsparse_gpsv_strided_batch solves a batched pentadiagonal linear system. Systems with
+*  \p m <= 512 are treated as block tridiagonal systems with 2 x 2 blocks and are solved
+*  without pivoting by parallel cyclic reduction in shared memory, one thread block per
+*  system. Larger systems are transposed into interleaved layout in the temporary storage
+*  buffer and solved by QR factorization with Givens rotations, one thread per system.
 *
 *  \note
-*  The resulting matrix can also be seen as the transpose of the input matrix.
+*  For \p m <= 512, no pivoting is performed, thus the systems should be diagonally dominant.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -10609,268 +11027,218 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           size of the pentadiagonal linear system (must be >= 3).
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  ds          lower diagonal (distance 2) of pentadiagonal system. First two entries must be
+*              zero.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  dl          lower diagonal of pentadiagonal system. First entry must be zero.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  d           main diagonal of pentadiagonal system.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  du          upper diagonal of pentadiagonal system. Last entry must be zero.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[out]
-*  csc_val     array of \p nnz elements of the sparse CSC matrix.
-*  @param[out]
-*  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
-*              matrix.
-*  @param[out]
-*  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
-*              sparse CSC matrix.
+*  dw          upper diagonal (distance 2) of pentadiagonal system. Last two entries must be
+*              zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at
+*              \p x+batch_stride*i.
 *  @param[in]
-*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  batch_count The number of systems to solve.
 *  @param[in]
-*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  batch_stride The number of elements that separate each system. Must satisfy
+*              \p batch_stride >= m.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_csr2csc_buffer_size().
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
-*              \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*
-*  \par Example
-*  This example computes the transpose of a CSR matrix.
-*  \code{.c}
-*      //     1 2 0 3 0
-*      // A = 0 4 5 0 0
-*      //     6 0 0 7 8
-*
-*      rocsparse_int m_A   = 3;
-*      rocsparse_int n_A   = 5;
-*      rocsparse_int nnz_A = 8;
-*
-*      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
-*      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
-*      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
-*
-*      // Allocate memory for transposed CSR matrix
-*      rocsparse_int m_T   = n_A;
-*      rocsparse_int n_T   = m_A;
-*      rocsparse_int nnz_T = nnz_A;
-*
-*      rocsparse_int* csr_row_ptr_T;
-*      rocsparse_int* csr_col_ind_T;
-*      float* csr_val_T;
-*
-*      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
-*      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
-*      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
-*
-*      // Obtain the temporary buffer size
-*      size_t buffer_size;
-*      rocsparse_csr2csc_buffer_size(handle,
-*                                    m_A,
-*                                    n_A,
-*                                    nnz_A,
-*                                    csr_row_ptr_A,
-*                                    csr_col_ind_A,
-*                                    rocsparse_action_numeric,
-*                                    &buffer_size);
-*
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
-*
-*      rocsparse_scsr2csc(handle,
-*                         m_A,
-*                         n_A,
-*                         nnz_A,
-*                         csr_val_A,
-*                         csr_row_ptr_A,
-*                         csr_col_ind_A,
-*                         csr_val_T,
-*                         csr_col_ind_T,
-*                         csr_row_ptr_T,
-*                         rocsparse_action_numeric,
-*                         rocsparse_index_base_zero,
-*                         temp_buffer);
-*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
-                                    rocsparse_int        m,
-                                    rocsparse_int        n,
-                                    rocsparse_int        nnz,
-                                    const float*         csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    float*               csc_val,
-                                    rocsparse_int*       csc_row_ind,
-                                    rocsparse_int*       csc_col_ptr,
-                                    rocsparse_action     copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void*                temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
-                                    rocsparse_int        m,
-                                    rocsparse_int        n,
-                                    rocsparse_int        nnz,
-                                    const double*        csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    double*              csc_val,
-                                    rocsparse_int*       csc_row_ind,
-                                    rocsparse_int*       csc_col_ptr,
-                                    rocsparse_action     copy_values,
-                                    rocsparse_index_base idx_base,
-                                    void*                temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2csc(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    rocsparse_int                  nnz,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    rocsparse_float_complex*       csc_val,
-                                    rocsparse_int*                 csc_row_ind,
-                                    rocsparse_int*                 csc_col_ptr,
-                                    rocsparse_action               copy_values,
-                                    rocsparse_index_base           idx_base,
-                                    void*                          temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2csc(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    rocsparse_int                   nnz,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    rocsparse_double_complex*       csc_val,
-                                    rocsparse_int*                  csc_row_ind,
-                                    rocsparse_int*                  csc_col_ptr,
-                                    rocsparse_action                copy_values,
-                                    rocsparse_index_base            idx_base,
-                                    void*                           temp_buffer);
+rocsparse_status rocsparse_sgpsv_strided_batch(rocsparse_handle handle,
+                                               rocsparse_int    m,
+                                               const float*     ds,
+                                               const float*     dl,
+                                               const float*     d,
+                                               const float*     du,
+                                               const float*     dw,
+                                               float*           x,
+                                               rocsparse_int    batch_count,
+                                               rocsparse_int    batch_stride,
+                                               void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_strided_batch(rocsparse_handle handle,
+                                               rocsparse_int    m,
+                                               const double*    ds,
+                                               const double*    dl,
+                                               const double*    d,
+                                               const double*    du,
+                                               const double*    dw,
+                                               double*          x,
+                                               rocsparse_int    batch_count,
+                                               rocsparse_int    batch_stride,
+                                               void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgpsv_strided_batch(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               const rocsparse_float_complex* ds,
+                                               const rocsparse_float_complex* dl,
+                                               const rocsparse_float_complex* d,
+                                               const rocsparse_float_complex* du,
+                                               const rocsparse_float_complex* dw,
+                                               rocsparse_float_complex*       x,
+                                               rocsparse_int                  batch_count,
+                                               rocsparse_int                  batch_stride,
+                                               void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgpsv_strided_batch(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               const rocsparse_double_complex* ds,
+                                               const rocsparse_double_complex* dl,
+                                               const rocsparse_double_complex* d,
+                                               const rocsparse_double_complex* du,
+                                               const rocsparse_double_complex* dw,
+                                               rocsparse_double_complex*       x,
+                                               rocsparse_int                   batch_count,
+                                               rocsparse_int                   batch_stride,
+                                               void*                           temp_buffer);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
+/*! \ingroup precond_module
+*  \brief Interleaved Batch pentadiagonal solver
 *
 *  \details
-*  \p rocsparse_gebsr2gebsc_buffer_size returns the size of the temporary storage buffer
-*  required by rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
-*  rocsparse_zgebsr2gebsc(). The temporary storage buffer must be allocated by the user.
+*  \p rocsparse_gpsv_interleaved_batch_buffer_size returns the size of the temporary storage
+*  buffer that is required by rocsparse_sgpsv_interleaved_batch(),
+*  rocsparse_dgpsv_interleaved_batch(), rocsparse_cgpsv_interleaved_batch() and
+*  rocsparse_zgpsv_interleaved_batch(). The temporary storage buffer must be allocated by the
+*  user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  mb           number of rows of the sparse GEneral BSR matrix.
+*  alg         algorithm to solve the linear system.
 *  @param[in]
-*  nb           number of columns of the sparse GEneral BSR matrix.
+*  m           size of the pentadiagonal linear system.
 *  @param[in]
-*  nnzb         number of non-zero entries of the sparse GEneral BSR matrix.
+*  ds          lower diagonal (distance 2) of pentadiagonal system where the jth entry of the
+*              ith system is stored at \p ds+batch_stride*j+i.
 *  @param[in]
-*  bsr_val     array of \p nnzb*row_block_dim*col_block_dim containing the values of the sparse GEneral BSR matrix.
+*  dl          lower diagonal of pentadiagonal system where the jth entry of the ith system is
+*              stored at \p dl+batch_stride*j+i.
 *  @param[in]
-*  bsr_row_ptr array of \p mb+1 elements that point to the start of every row of the
-*              sparse GEneral BSR matrix.
+*  d           main diagonal of pentadiagonal system where the jth entry of the ith system is
+*              stored at \p d+batch_stride*j+i.
 *  @param[in]
-*  bsr_col_ind array of \p nnzb elements containing the column indices of the sparse
-*              GEneral BSR matrix.
+*  du          upper diagonal of pentadiagonal system where the jth entry of the ith system is
+*              stored at \p du+batch_stride*j+i.
 *  @param[in]
-*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
+*  dw          upper diagonal (distance 2) of pentadiagonal system where the jth entry of the
+*              ith system is stored at \p dw+batch_stride*j+i.
 *  @param[in]
-*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
-
+*  x           Dense array of righthand-sides where the jth entry of the ith righthand-side is
+*              stored at \p x+batch_stride*j+i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate consecutive entries of a system. Must
+*              satisfy \p batch_stride >= batch_count.
 *  @param[out]
-*  p_buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
-*              rocsparse_zgebsr2gebsc().
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgpsv_interleaved_batch(), rocsparse_dgpsv_interleaved_batch(),
+*              rocsparse_cgpsv_interleaved_batch() and rocsparse_zgpsv_interleaved_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr, \p bsr_col_ind or
-*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgebsr2gebsc_buffer_size(rocsparse_handle     handle,
-                                                    rocsparse_int        mb,
-                                                    rocsparse_int        nb,
-                                                    rocsparse_int        nnzb,
-                                                    const float*         bsr_val,
-                                                    const rocsparse_int* bsr_row_ptr,
-                                                    const rocsparse_int* bsr_col_ind,
-                                                    rocsparse_int        row_block_dim,
-                                                    rocsparse_int        col_block_dim,
-                                                    size_t*              p_buffer_size);
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgebsr2gebsc_buffer_size(rocsparse_handle     handle,
-                                                    rocsparse_int        mb,
-                                                    rocsparse_int        nb,
-                                                    rocsparse_int        nnzb,
-                                                    const double*        bsr_val,
-                                                    const rocsparse_int* bsr_row_ptr,
-                                                    const rocsparse_int* bsr_col_ind,
-                                                    rocsparse_int        row_block_dim,
-                                                    rocsparse_int        col_block_dim,
-                                                    size_t*              p_buffer_size);
+rocsparse_status
+    rocsparse_sgpsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gpsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const float*                   ds,
+                                                  const float*                   dl,
+                                                  const float*                   d,
+                                                  const float*                   du,
+                                                  const float*                   dw,
+                                                  const float*                   x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgebsr2gebsc_buffer_size(rocsparse_handle               handle,
-                                                    rocsparse_int                  mb,
-                                                    rocsparse_int                  nb,
-                                                    rocsparse_int                  nnzb,
-                                                    const rocsparse_float_complex* bsr_val,
-                                                    const rocsparse_int*           bsr_row_ptr,
-                                                    const rocsparse_int*           bsr_col_ind,
-                                                    rocsparse_int                  row_block_dim,
-                                                    rocsparse_int                  col_block_dim,
-                                                    size_t*                        p_buffer_size);
+rocsparse_status
+    rocsparse_dgpsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gpsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const double*                  ds,
+                                                  const double*                  dl,
+                                                  const double*                  d,
+                                                  const double*                  du,
+                                                  const double*                  dw,
+                                                  const double*                  x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgebsr2gebsc_buffer_size(rocsparse_handle                handle,
-                                                    rocsparse_int                   mb,
-                                                    rocsparse_int                   nb,
-                                                    rocsparse_int                   nnzb,
-                                                    const rocsparse_double_complex* bsr_val,
-                                                    const rocsparse_int*            bsr_row_ptr,
-                                                    const rocsparse_int*            bsr_col_ind,
-                                                    rocsparse_int                   row_block_dim,
-                                                    rocsparse_int                   col_block_dim,
-                                                    size_t*                         p_buffer_size);
+rocsparse_status
+    rocsparse_cgpsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gpsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const rocsparse_float_complex* ds,
+                                                  const rocsparse_float_complex* dl,
+                                                  const rocsparse_float_complex* d,
+                                                  const rocsparse_float_complex* du,
+                                                  const rocsparse_float_complex* dw,
+                                                  const rocsparse_float_complex* x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgpsv_interleaved_batch_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_gpsv_interleaved_alg  alg,
+                                                  rocsparse_int                   m,
+                                                  const rocsparse_double_complex* ds,
+                                                  const rocsparse_double_complex* dl,
+                                                  const rocsparse_double_complex* d,
+                                                  const rocsparse_double_complex* du,
+                                                  const rocsparse_double_complex* dw,
+                                                  const rocsparse_double_complex* x,
+                                                  rocsparse_int                   batch_count,
+                                                  rocsparse_int                   batch_stride,
+                                                  size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
+/*! \ingroup precond_module
+*  \brief Interleaved Batch pentadiagonal solver
 *
 *  \details
-*  \p rocsparse_gebsr2gebsc converts a GEneral BSR matrix into a GEneral BSC matrix. \p rocsparse_gebsr2gebsc
-*  can also be used to convert a GEneral BSC matrix into a GEneral BSR matrix. \p copy_values decides
-*  whether \p bsc_val is being filled during conversion (\ref rocsparse_action_numeric)
-*  or not (\ref rocsparse_action_symbolic).
-*
-*  \p rocsparse_gebsr2gebsc requires extra temporary storage buffer that has to be allocated
-*  by the user. Storage buffer size can be determined by rocsparse_gebsr2gebsc_buffer_size().
+*  \p rocsparse_gpsv_interleaved_batch solves a batched pentadiagonal linear system, where
+*  the systems are stored in interleaved layout, i.e. the jth entries of all systems are
+*  stored contiguously. Each system is solved by a single thread using QR factorization with
+*  Givens rotations, which results in fully coalesced memory accesses. The algorithm is
+*  selected by \p alg, see \ref rocsparse_gpsv_interleaved_alg.
 *
 *  \note
-*  The resulting matrix can also be seen as the transpose of the input matrix.
+*  The systems are factorized in place, thus \p ds, \p dl, \p d, \p du and \p dw are
+*  overwritten.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -10879,990 +11247,3039 @@ rocsparse_status rocsparse_zgebsr2gebsc_buffer_size(rocsparse_handle
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  mb          number of rows of the sparse GEneral BSR matrix.
-*  @param[in]
-*  nb          number of columns of the sparse GEneral BSR matrix.
-*  @param[in]
-*  nnzb        number of non-zero entries of the sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_val     array of \p nnzb * \p row_block_dim * \p col_block_dim  elements of the sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse GEneral BSR matrix.
-*  @param[in]
-*  bsr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              GEneral BSR matrix.
-*  @param[in]
-*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
+*  alg         algorithm to solve the linear system.
 *  @param[in]
-*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
-*  @param[out]
-*  bsc_val     array of \p nnz elements of the sparse BSC matrix.
-*  @param[out]
-*  bsc_row_ind array of \p nnz elements containing the row indices of the sparse BSC
-*              matrix.
-*  @param[out]
-*  bsc_col_ptr array of \p n+1 elements that point to the start of every column of the
-*              sparse BSC matrix.
+*  m           size of the pentadiagonal linear system (must be >= 3).
+*  @param[inout]
+*  ds          lower diagonal (distance 2) of pentadiagonal system. First two entries of each
+*              system must be zero.
+*  @param[inout]
+*  dl          lower diagonal of pentadiagonal system. First entry of each system must be
+*              zero.
+*  @param[inout]
+*  d           main diagonal of pentadiagonal system.
+*  @param[inout]
+*  du          upper diagonal of pentadiagonal system. Last entry of each system must be zero.
+*  @param[inout]
+*  dw          upper diagonal (distance 2) of pentadiagonal system. Last two entries of each
+*              system must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the jth entry of the ith righthand-side is
+*              stored at \p x+batch_stride*j+i.
 *  @param[in]
-*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  batch_count The number of systems to solve.
 *  @param[in]
-*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  batch_stride The number of elements that separate consecutive entries of a system. Must
+*              satisfy \p batch_stride >= batch_count.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user, size is returned by
-*              rocsparse_gebsr2gebsc_buffer_size().
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_val, \p bsr_row_ptr,
-*              \p bsr_col_ind, \p bsc_val, \p bsc_row_ind, \p bsc_col_ptr or
-*              \p temp_buffer pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   float*                         ds,
+                                                   float*                         dl,
+                                                   float*                         d,
+                                                   float*                         du,
+                                                   float*                         dw,
+                                                   float*                         x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   double*                        ds,
+                                                   double*                        dl,
+                                                   double*                        d,
+                                                   double*                        du,
+                                                   double*                        dw,
+                                                   double*                        x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_float_complex*       ds,
+                                                   rocsparse_float_complex*       dl,
+                                                   rocsparse_float_complex*       d,
+                                                   rocsparse_float_complex*       du,
+                                                   rocsparse_float_complex*       dw,
+                                                   rocsparse_float_complex*       x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_double_complex*      ds,
+                                                   rocsparse_double_complex*      dl,
+                                                   rocsparse_double_complex*      d,
+                                                   rocsparse_double_complex*      du,
+                                                   rocsparse_double_complex*      dw,
+                                                   rocsparse_double_complex*      x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+/**@}*/
+
+/*
+* ===========================================================================
+*    Sparse Format Conversions
+* ===========================================================================
+*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero elements per row or column and the total number of nonzero elements in a dense matrix.
+*  \details
+*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *
-*  \par Example
-*  This example computes the transpose of a GEneral BSR matrix.
-*  \code{.c}
-*      //     1 2 0 3
-*      // A = 0 4 5 0
-*      //     6 0 0 7
-*      //     1 2 3 4
-*
-*      rocsparse_int mb_A   = 2;
-*      rocsparse_int row_block_dim = 2;
-*      rocsparse_int col_block_dim = 2;
-*      rocsparse_int nb_A   = 2;
-*      rocsparse_int nnzb_A = 4;
+*  @param[in]
+*  dir        direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
 *
-*      bsr_row_ptr_A[mb_A+1] = {0, 2, 4};               // device memory
-*      bsr_col_ind_A[nnzb_A] = {0, 1, 0, 1}; // device memory
-*      bsr_val_A[nnzb_A]     = {1, 0, 2, 4, 0, 5, 3, 0, 6, 1, 0, 2, 0, 3, 7, 4}; // device memory
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
 *
-*      // Allocate memory for transposed BSR matrix
-*      rocsparse_int mb_T   = nb_A;
-*      rocsparse_int nb_T   = mb_A;
-*      rocsparse_int nnzb_T = nnzb_A;
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
 *
-*      rocsparse_int* bsr_row_ptr_T;
-*      rocsparse_int* bsr_col_ind_T;
-*      float* bsr_val_T;
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A.
 *
-*      hipMalloc((void**)&bsr_row_ptr_T, sizeof(rocsparse_int) * (mb_T + 1));
-*      hipMalloc((void**)&bsr_col_ind_T, sizeof(rocsparse_int) * nnzb_T);
-*      hipMalloc((void**)&bsr_val_T, sizeof(float) * nnzb_T);
+*  @param[in]
+*  A           array of dimensions (\p ld, \p n)
 *
-*      // Obtain the temporary buffer size
-*      size_t buffer_size;
-*      rocsparse_gebsr2gebsc_buffer_size(handle,
-*                                    mb_A,
-*                                    nb_A,
-*                                    nnzb_A,
-*                                    bsr_row_ptr_A,
-*                                    bsr_col_ind_A,
-*                                    rocsparse_action_numeric,
-*                                    &buffer_size);
+*  @param[in]
+*  ld         leading dimension of dense array \p A.
 *
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
+*  @param[out]
+*  nnz_per_row_columns
+*              array of size \p m or \p n containing the number of nonzero elements per row or column, respectively.
+*  @param[out]
+*  nnz_total_dev_host_ptr
+*              total number of nonzero elements in device or host memory.
 *
-*      rocsparse_sgebsr2gebsc(handle,
-*                         mb_A,
-*                         nb_A,
-*                         nnzb_A,
-*                         bsr_val_A,
-*                         bsr_row_ptr_A,
-*                         bsr_col_ind_A,
-*                         row_block_dim,
-*                         col_block_dim,
-*                         bsr_val_T,
-*                         bsr_col_ind_T,
-*                         bsr_row_ptr_T,
-*                         rocsparse_action_numeric,
-*                         rocsparse_index_base_zero,
-*                         temp_buffer);
-*  \endcode
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_row_columns or \p nnz_total_dev_host_ptr
+*              pointer is invalid.
 */
 /**@{*/
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgebsr2gebsc(rocsparse_handle     handle,
-                                        rocsparse_int        mb,
-                                        rocsparse_int        nb,
-                                        rocsparse_int        nnzb,
-                                        const float*         bsr_val,
-                                        const rocsparse_int* bsr_row_ptr,
-                                        const rocsparse_int* bsr_col_ind,
-                                        rocsparse_int        row_block_dim,
-                                        rocsparse_int        col_block_dim,
-                                        float*               bsc_val,
-                                        rocsparse_int*       bsc_row_ind,
-                                        rocsparse_int*       bsc_col_ptr,
-                                        rocsparse_action     copy_values,
-                                        rocsparse_index_base idx_base,
-                                        void*                temp_buffer);
+rocsparse_status rocsparse_snnz(rocsparse_handle          handle,
+                                rocsparse_direction       dir,
+                                rocsparse_int             m,
+                                rocsparse_int             n,
+                                const rocsparse_mat_descr descr,
+                                const float*              A,
+                                rocsparse_int             ld,
+                                rocsparse_int*            nnz_per_row_columns,
+                                rocsparse_int*            nnz_total_dev_host_ptr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgebsr2gebsc(rocsparse_handle     handle,
-                                        rocsparse_int        mb,
-                                        rocsparse_int        nb,
-                                        rocsparse_int        nnzb,
-                                        const double*        bsr_val,
-                                        const rocsparse_int* bsr_row_ptr,
-                                        const rocsparse_int* bsr_col_ind,
-                                        rocsparse_int        row_block_dim,
-                                        rocsparse_int        col_block_dim,
-                                        double*              bsc_val,
-                                        rocsparse_int*       bsc_row_ind,
-                                        rocsparse_int*       bsc_col_ptr,
-                                        rocsparse_action     copy_values,
-                                        rocsparse_index_base idx_base,
-                                        void*                temp_buffer);
+rocsparse_status rocsparse_dnnz(rocsparse_handle          handle,
+                                rocsparse_direction       dir,
+                                rocsparse_int             m,
+                                rocsparse_int             n,
+                                const rocsparse_mat_descr descr,
+                                const double*             A,
+                                rocsparse_int             ld,
+                                rocsparse_int*            nnz_per_row_columns,
+                                rocsparse_int*            nnz_total_dev_host_ptr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgebsr2gebsc(rocsparse_handle               handle,
-                                        rocsparse_int                  mb,
-                                        rocsparse_int                  nb,
-                                        rocsparse_int                  nnzb,
-                                        const rocsparse_float_complex* bsr_val,
-                                        const rocsparse_int*           bsr_row_ptr,
-                                        const rocsparse_int*           bsr_col_ind,
-                                        rocsparse_int                  row_block_dim,
-                                        rocsparse_int                  col_block_dim,
-                                        rocsparse_float_complex*       bsc_val,
-                                        rocsparse_int*                 bsc_row_ind,
-                                        rocsparse_int*                 bsc_col_ptr,
-                                        rocsparse_action               copy_values,
-                                        rocsparse_index_base           idx_base,
-                                        void*                          temp_buffer);
+rocsparse_status rocsparse_cnnz(rocsparse_handle               handle,
+                                rocsparse_direction            dir,
+                                rocsparse_int                  m,
+                                rocsparse_int                  n,
+                                const rocsparse_mat_descr      descr,
+                                const rocsparse_float_complex* A,
+                                rocsparse_int                  ld,
+                                rocsparse_int*                 nnz_per_row_columns,
+                                rocsparse_int*                 nnz_total_dev_host_ptr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgebsr2gebsc(rocsparse_handle                handle,
-                                        rocsparse_int                   mb,
-                                        rocsparse_int                   nb,
-                                        rocsparse_int                   nnzb,
-                                        const rocsparse_double_complex* bsr_val,
-                                        const rocsparse_int*            bsr_row_ptr,
-                                        const rocsparse_int*            bsr_col_ind,
-                                        rocsparse_int                   row_block_dim,
-                                        rocsparse_int                   col_block_dim,
-                                        rocsparse_double_complex*       bsc_val,
-                                        rocsparse_int*                  bsc_row_ind,
-                                        rocsparse_int*                  bsc_col_ptr,
-                                        rocsparse_action                copy_values,
-                                        rocsparse_index_base            idx_base,
-                                        void*                           temp_buffer);
-
+rocsparse_status rocsparse_znnz(rocsparse_handle                handle,
+                                rocsparse_direction             dir,
+                                rocsparse_int                   m,
+                                rocsparse_int                   n,
+                                const rocsparse_mat_descr       descr,
+                                const rocsparse_double_complex* A,
+                                rocsparse_int                   ld,
+                                rocsparse_int*                  nnz_per_row_columns,
+                                rocsparse_int*                  nnz_total_dev_host_ptr);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
-*
+*  \brief
+*  This function converts the matrix A in dense format into a sparse matrix in CSR format.
+*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_row, which can be pre-computed with rocsparse_xnnz().
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *  \details
-*  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
-*  over all rows, the ELL \p width, for a given CSR matrix.
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
 *  @param[in]
-*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  A           array of dimensions (\p ld, \p n)
+*
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  ld         leading dimension of dense array \p A.
+*
 *  @param[in]
-*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  nnz_per_rows   array of size \p n containing the number of non-zero elements per row.
+*
 *  @param[out]
-*  ell_width   pointer to the number of non-zero elements per row in ELL storage
-*              format.
+*  csr_val
+*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[out]
+*  csr_row_ptr
+*              integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[out]
+*  csr_col_ind
+*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
-*              \p ell_width pointer is invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_rows or \p csr_val \p csr_row_ptr or \p csr_col_ind
+*              pointer is invalid.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
-                                         rocsparse_int             m,
-                                         const rocsparse_mat_descr csr_descr,
-                                         const rocsparse_int*      csr_row_ptr,
-                                         const rocsparse_mat_descr ell_descr,
-                                         rocsparse_int*            ell_width);
+rocsparse_status rocsparse_sdense2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_rows,
+                                      float*                    csr_val,
+                                      rocsparse_int*            csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddense2csr(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_rows,
+                                      double*                   csr_val,
+                                      rocsparse_int*            csr_row_ptr,
+                                      rocsparse_int*            csr_col_ind);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdense2csr(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* A,
+                                      rocsparse_int                  ld,
+                                      const rocsparse_int*           nnz_per_rows,
+                                      rocsparse_float_complex*       csr_val,
+                                      rocsparse_int*                 csr_row_ptr,
+                                      rocsparse_int*                 csr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdense2csr(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* A,
+                                      rocsparse_int                   ld,
+                                      const rocsparse_int*            nnz_per_rows,
+                                      rocsparse_double_complex*       csr_val,
+                                      rocsparse_int*                  csr_row_ptr,
+                                      rocsparse_int*                  csr_col_ind);
+/**@}*/
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+*  \brief
+*  This function computes the the size of the user allocated temporary storage buffer used when converting and pruning
+*  a dense matrix to a CSR matrix.
 *
 *  \details
-*  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
-*  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
-*  number of rows times the number of ELL non-zero elements per row, such that
-*  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
-*  non-zero elements per row is obtained by rocsparse_csr2ell_width().
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  \p rocsparse_prune_dense2csr_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
+*  rocsparse_sprune_dense2csr(), and rocsparse_dprune_dense2csr(). The temporary
+*  storage buffer must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           number of rows of the dense matrix \p A.
+*
 *  @param[in]
-*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  csr_val     array containing the values of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
+*
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  lda         leading dimension of dense array \p A.
+*
 *  @param[in]
-*  csr_col_ind array containing the column indices of the sparse CSR matrix.
+*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
+*
 *  @param[in]
-*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
-*              \ref rocsparse_matrix_type_general is supported.
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
 *  @param[in]
-*  ell_width   number of non-zero elements per row in ELL storage format.
-*  @param[out]
-*  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+*  csr_val
+*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[in]
+*  csr_row_ptr
+*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[in]
+*  csr_col_ind
+*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
 *  @param[out]
-*  ell_col_ind array of \p m times \p ell_width elements containing the column indices
-*              of the sparse ELL matrix.
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sprune_dense2csr_nnz(), rocsparse_dprune_dense2csr_nnz(),
+*              rocsparse_sprune_dense2csr() and rocsparse_dprune_dense2csr().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
-*              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
-*              \p ell_col_ind pointer is invalid.
-*  \retval     rocsparse_status_not_implemented
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sprune_dense2csr_buffer_size(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        const float*              A,
+                                                        rocsparse_int             lda,
+                                                        const float*              threshold,
+                                                        const rocsparse_mat_descr descr,
+                                                        const float*              csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dprune_dense2csr_buffer_size(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             n,
+                                                        const double*             A,
+                                                        rocsparse_int             lda,
+                                                        const double*             threshold,
+                                                        const rocsparse_mat_descr descr,
+                                                        const double*             csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix once
+*  elements less than the threshold are pruned from the matrix.
 *
-*  \par Example
-*  This example converts a CSR matrix into an ELL matrix.
-*  \code{.c}
-*      //     1 2 0 3 0
-*      // A = 0 4 5 0 0
-*      //     6 0 0 7 8
+*  \details
+*  The routine does support asynchronous execution if the pointer mode is set to device.
 *
-*      rocsparse_int m   = 3;
-*      rocsparse_int n   = 5;
-*      rocsparse_int nnz = 8;
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
 *
-*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
-*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
-*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
 *
-*      // Create ELL matrix descriptor
-*      rocsparse_mat_descr ell_descr;
-*      rocsparse_create_mat_descr(&ell_descr);
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
 *
-*      // Obtain the ELL width
-*      rocsparse_int ell_width;
-*      rocsparse_csr2ell_width(handle,
-*                              m,
-*                              csr_descr,
-*                              csr_row_ptr,
-*                              ell_descr,
-*                              &ell_width);
+*  @param[in]
+*  A           array of dimensions (\p lda, \p n)
 *
-*      // Compute ELL non-zero entries
-*      rocsparse_int ell_nnz = m * ell_width;
+*  @param[in]
+*  lda         leading dimension of dense array \p A.
 *
-*      // Allocate ELL column and value arrays
-*      rocsparse_int* ell_col_ind;
-*      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+*  @param[in]
+*  threshold   pointer to the pruning non-negative threshold which can exist in either host or device memory.
 *
-*      float* ell_val;
-*      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A.
 *
-*      // Format conversion
-*      rocsparse_scsr2ell(handle,
-*                         m,
-*                         csr_descr,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         ell_descr,
-*                         ell_width,
-*                         ell_val,
-*                         ell_col_ind);
-*  \endcode
-*/
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    float*                    ell_val,
-                                    rocsparse_int*            ell_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    const rocsparse_mat_descr ell_descr,
-                                    rocsparse_int             ell_width,
-                                    double*                   ell_val,
-                                    rocsparse_int*            ell_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2ell(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    const rocsparse_mat_descr      csr_descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    const rocsparse_mat_descr      ell_descr,
-                                    rocsparse_int                  ell_width,
-                                    rocsparse_float_complex*       ell_val,
-                                    rocsparse_int*                 ell_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    const rocsparse_mat_descr       csr_descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    const rocsparse_mat_descr       ell_descr,
-                                    rocsparse_int                   ell_width,
-                                    rocsparse_double_complex*       ell_val,
-                                    rocsparse_int*                  ell_col_ind);
-/**@}*/
-
-/*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
-*
-*  \details
-*  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
-*  that \p hyb has been initialized with rocsparse_create_hyb_mat().
-*
-*  \note
-*  This function requires a significant amount of storage for the HYB matrix,
-*  depending on the matrix structure.
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  @param[out]
+*  csr_row_ptr
+*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[out]
+*  nnz_total_dev_host_ptr
+*              total number of nonzero elements in device or host memory.
 *
-*  @param[in]
-*  handle          handle to the rocsparse library context queue.
-*  @param[in]
-*  m               number of rows of the sparse CSR matrix.
-*  @param[in]
-*  n               number of columns of the sparse CSR matrix.
-*  @param[in]
-*  descr           descriptor of the sparse CSR matrix. Currently, only
-*                  \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  csr_val         array containing the values of the sparse CSR matrix.
-*  @param[in]
-*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix.
-*  @param[in]
-*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
 *  @param[out]
-*  hyb             sparse matrix in HYB format.
-*  @param[in]
-*  user_ell_width  width of the ELL part of the HYB matrix (only required if
-*                  \p partition_type == \ref rocsparse_hyb_partition_user).
-*  @param[in]
-*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
-*                  \ref rocsparse_hyb_partition_user or
-*                  \ref rocsparse_hyb_partition_max.
+*  temp_buffer
+*              buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
-*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
-*              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
-*              allocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*
-*  \par Example
-*  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
-*  \code{.c}
-*      // Create HYB matrix structure
-*      rocsparse_hyb_mat hyb;
-*      rocsparse_create_hyb_mat(&hyb);
-*
-*      // User defined ell width
-*      rocsparse_int user_ell_width = 5;
-*
-*      // Perform the conversion
-*      rocsparse_scsr2hyb(handle,
-*                         m,
-*                         n,
-*                         descr,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         hyb,
-*                         user_ell_width,
-*                         rocsparse_hyb_partition_user);
-*
-*      // Do some work
-*
-*      // Clean up
-*      rocsparse_destroy_hyb_mat(hyb);
-*  \endcode
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p threshold or \p descr or \p csr_row_ptr
+*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_hyb_mat         hyb,
-                                    rocsparse_int             user_ell_width,
-                                    rocsparse_hyb_partition   partition_type);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    const rocsparse_mat_descr      descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    rocsparse_hyb_mat              hyb,
-                                    rocsparse_int                  user_ell_width,
-                                    rocsparse_hyb_partition        partition_type);
+rocsparse_status rocsparse_sprune_dense2csr_nnz(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const float*              A,
+                                                rocsparse_int             lda,
+                                                const float*              threshold,
+                                                const rocsparse_mat_descr descr,
+                                                rocsparse_int*            csr_row_ptr,
+                                                rocsparse_int*            nnz_total_dev_host_ptr,
+                                                void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    const rocsparse_mat_descr       descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    rocsparse_hyb_mat               hyb,
-                                    rocsparse_int                   user_ell_width,
-                                    rocsparse_hyb_partition         partition_type);
+rocsparse_status rocsparse_dprune_dense2csr_nnz(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                const double*             A,
+                                                rocsparse_int             lda,
+                                                const double*             threshold,
+                                                const rocsparse_mat_descr descr,
+                                                rocsparse_int*            csr_row_ptr,
+                                                rocsparse_int*            nnz_total_dev_host_ptr,
+                                                void*                     temp_buffer);
 /**@}*/
 
 /*! \ingroup conv_module
 *  \brief
-*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
-*  BSR matrix given a sparse CSR matrix as input.
+*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
+*  that are less than the threshold. All the parameters are assumed to have been pre-allocated by the user.
 *
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  The user first allocates \p csr_row_ptr to have \p m+1 elements and then calls rocsparse_xprune_dense2csr_nnz()
+*  which fills in the \p csr_row_ptr array and stores the number of elements that are larger than the pruning threshold
+*  in \p nnz_total_dev_host_ptr. The user then allocates \p csr_col_ind and \p csr_val to have size \p nnz_total_dev_host_ptr
+*  and completes the conversion by calling rocsparse_xprune_dense2csr(). A temporary storage buffer is used by both
+*  rocsparse_xprune_dense2csr_nnz() and rocsparse_xprune_dense2csr() and must be allocated by the user and whose size is determined
+*  by rocsparse_xprune_dense2csr_buffer_size(). The routine rocsparse_xprune_dense2csr() is executed asynchronously with
+*  respect to the host and may return control to the application on the host before the entire result is ready.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *
 *  @param[in]
-*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
-*              \ref rocsparse_direction_row.
+*  m           number of rows of the dense matrix \p A.
 *
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  n           number of columns of the dense matrix \p A.
 *
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
 *
 *  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*  lda         leading dimension of dense array \p A.
 *
 *  @param[in]
-*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
+*  threshold   pointer to the non-negative pruning threshold which can exist in either host or device memory.
 *
 *  @param[in]
-*  block_dim   the block dimension of the BSR matrix. Between 1 and min(m, n)
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
+*  @param[out]
+*  csr_val
+*              array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
 *  @param[in]
-*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  csr_row_ptr
+*              integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
 *  @param[out]
-*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the BSR matrix
+*  csr_col_ind
+*              integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
 *
-*  @param[out]
-*  bsr_nnz     total number of nonzero elements in device or host memory.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_xprune_dense2csr_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p bsr_nnz
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p threshold or \p csr_val
+*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          handle,
-                                       rocsparse_direction       dir,
-                                       rocsparse_int             m,
-                                       rocsparse_int             n,
-                                       const rocsparse_mat_descr csr_descr,
-                                       const rocsparse_int*      csr_row_ptr,
-                                       const rocsparse_int*      csr_col_ind,
-                                       rocsparse_int             block_dim,
-                                       const rocsparse_mat_descr bsr_descr,
-                                       rocsparse_int*            bsr_row_ptr,
-                                       rocsparse_int*            bsr_nnz);
-
-/*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse BSR matrix
-*
-*  \details
-*  \p rocsparse_csr2bsr converts a CSR matrix into a BSR matrix. It is assumed,
-*  that \p bsr_val, \p bsr_col_ind and \p bsr_row_ptr are allocated. Allocation size
-*  for \p bsr_row_ptr is computed as \p mb+1 where \p mb is the number of block rows in
-*  the BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
-*  \p csr2bsr_nnz() which also fills in \p bsr_row_ptr.
-*
-*  \p rocsparse_csr2bsr requires extra temporary storage that is allocated internally if \p block_dim>16
-*
-*  @param[in]
-*  handle       handle to the rocsparse library context queue.
-*  @param[in]
-*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
-*  @param[in]
-*  m            number of rows in the sparse CSR matrix.
-*  @param[in]
-*  n            number of columns in the sparse CSR matrix.
-*  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
-*  @param[in]
-*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
-*               sparse CSR matrix.
-*  @param[in]
-*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
-*  @param[in]
-*  block_dim    size of the blocks in the sparse BSR matrix.
-*  @param[in]
-*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
-*  @param[out]
-*  bsr_val      array of \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
-*  @param[out]
-*  bsr_row_ptr  array of \p mb+1 elements that point to the start of every block row of the
-*               sparse BSR matrix.
-*  @param[out]
-*  bsr_col_ind  array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
-*
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_val,
-*              \p bsr_row_ptr, \p bsr_col_ind, \p csr_val, \p csr_row_ptr or
-*              \p csr_col_ind pointer is invalid.
-*
-*  \par Example
-*  This example converts a CSR matrix into an BSR matrix.
-*  \code{.c}
-*      //     1 4 0 0 0 0
-*      // A = 0 2 3 0 0 0
-*      //     5 0 0 7 8 0
-*      //     0 0 9 0 6 0
-*
-*      rocsparse_int m   = 4;
-*      rocsparse_int n   = 6;
-*      rocsparse_int block_dim = 2;
-*      rocsparse_int nnz = 9;
-*      rocsparse_int mb = (m + block_dim - 1) / block_dim;
-*      rocsparse_int nb = (n + block_dim - 1) / block_dim;
-*
-*      csr_row_ptr[m+1]  = {0, 2, 4, 7, 9};             // device memory
-*      csr_col_ind[nnz]  = {0, 1, 1, 2, 0, 3, 4, 2, 4}; // device memory
-*      csr_val[nnz]      = {1, 4, 2, 3, 5, 7, 8, 9, 6}; // device memory
-*
-*      hipMalloc(&bsr_row_ptr, sizeof(rocsparse_int) *(mb + 1));
-*      rocsparse_int nnzb;
-*      rocsparse_int* nnzTotalHostPtr = &nnzb;
-*      csr2bsr_nnz(handle,
-*                  rocsparse_direction_row,
-*                  m,
-*                  n,
-*                  csr_descr,
-*                  csr_row_ptr,
-*                  csr_col_ind,
-*                  block_dim,
-*                  bsr_descr,
-*                  bsr_row_ptr,
-*                  nnzTotalHostPtr);
-*      nnzb = *nnzTotalDevHostPtr;
-*      hipMalloc(&bsr_col_ind, sizeof(int)*nnzb);
-*      hipMalloc(&bsr_val, sizeof(float)*(block_dim * block_dim) * nnzb);
-*      scsr2bsr(handle,
-*               rocsparse_direction_row,
-*               m,
-*               n,
-*               csr_descr,
-*               csr_val,
-*               csr_row_ptr,
-*               csr_col_ind,
-*               block_dim,
-*               bsr_descr,
-*               bsr_val,
-*               bsr_row_ptr,
-*               bsr_col_ind);
-*  \endcode
-*/
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2bsr(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const float*              csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    const rocsparse_mat_descr bsr_descr,
-                                    float*                    bsr_val,
-                                    rocsparse_int*            bsr_row_ptr,
-                                    rocsparse_int*            bsr_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2bsr(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    const rocsparse_mat_descr csr_descr,
-                                    const double*             csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    const rocsparse_mat_descr bsr_descr,
-                                    double*                   bsr_val,
-                                    rocsparse_int*            bsr_row_ptr,
-                                    rocsparse_int*            bsr_col_ind);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2bsr(rocsparse_handle               handle,
-                                    rocsparse_direction            dir,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    const rocsparse_mat_descr      csr_descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int*           csr_row_ptr,
-                                    const rocsparse_int*           csr_col_ind,
-                                    rocsparse_int                  block_dim,
-                                    const rocsparse_mat_descr      bsr_descr,
-                                    rocsparse_float_complex*       bsr_val,
-                                    rocsparse_int*                 bsr_row_ptr,
-                                    rocsparse_int*                 bsr_col_ind);
+rocsparse_status rocsparse_sprune_dense2csr(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const float*              A,
+                                            rocsparse_int             lda,
+                                            const float*              threshold,
+                                            const rocsparse_mat_descr descr,
+                                            float*                    csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            rocsparse_int*            csr_col_ind,
+                                            void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2bsr(rocsparse_handle                handle,
-                                    rocsparse_direction             dir,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    const rocsparse_mat_descr       csr_descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*            csr_row_ptr,
-                                    const rocsparse_int*            csr_col_ind,
-                                    rocsparse_int                   block_dim,
-                                    const rocsparse_mat_descr       bsr_descr,
-                                    rocsparse_double_complex*       bsr_val,
-                                    rocsparse_int*                  bsr_row_ptr,
-                                    rocsparse_int*                  bsr_col_ind);
+rocsparse_status rocsparse_dprune_dense2csr(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            const double*             A,
+                                            rocsparse_int             lda,
+                                            const double*             threshold,
+                                            const rocsparse_mat_descr descr,
+                                            double*                   csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            rocsparse_int*            csr_col_ind,
+                                            void*                     temp_buffer);
 /**@}*/
 
 /*! \ingroup conv_module
 *  \brief
- *  \details
- *  \p rocsparse_csr2gebsr_buffer_size returns the size of the temporary buffer that
- *  is required by \p rocsparse_csr2gebcsr_nnz,
- *   \p rocsparse_scsr2gebcsr, \p rocsparse_dcsr2gebsr, \p rocsparse_ccsr2gebsr and \p rocsparse_zcsr2gebsr.
- *  The temporary storage
- *  buffer must be allocated by the user.
- *
-*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
-*  GEneral BSR matrix given a sparse CSR matrix as input.
+*  This function computes the size of the user allocated temporary storage buffer used when converting and pruning by percentage a
+*  dense matrix to a CSR matrix.
 *
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
+*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
+*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
+*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
+*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
+*
+*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
+*  sorted array by
+*  \f[
+*    pos = ceil(m*n*(percentage/100)) - 1
+*    pos = min(pos, m*n-1)
+*    pos = max(pos, 0)
+*    threshold = sorted_A[pos]
+*  \f]
+*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
+*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *
 *  @param[in]
-*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
-*              \ref rocsparse_direction_row.
+*  m           number of rows of the dense matrix \p A.
 *
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  n           number of columns of the dense matrix \p A.
 *
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
 *
 *  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  lda         leading dimension of dense array \p A.
 *
 *  @param[in]
-*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*  percentage  percentage >= 0 and percentage <= 100.
 *
 *  @param[in]
-*  csr_row_ptr  integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
 *
 *  @param[in]
-*  csr_col_ind  integer array of the column indices for each non-zero element in the CSR matrix
+*  csr_val    array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
 *
 *  @param[in]
-*  row_block_dim   the row block dimension of the GEneral BSR matrix. Between 1 and \p m
+*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
 *
 *  @param[in]
-*  col_block_dim   the col block dimension of the GEneral BSR matrix. Between 1 and \p n
+*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  @param[in]
+*  info prune information structure
 *
 *  @param[out]
-*  p_buffer_size  (host/device) number of bytes of the temporary storage buffer required by \p rocsparse_csr2gebsr_nnz and \p rocsparse_scsr2gebsr.
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sprune_dense2csr_nnz_by_percentage(), rocsparse_dprune_dense2csr_nnz_by_percentage(),
+*              rocsparse_sprune_dense2csr_by_percentage() and rocsparse_dprune_dense2csr_by_percentage().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim  \p col_block_dim is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_val or \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p p_buffer_size
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2gebsr_buffer_size(rocsparse_handle          handle,
-                                                  rocsparse_direction       dir,
-                                                  rocsparse_int             m,
-                                                  rocsparse_int             n,
-                                                  const rocsparse_mat_descr csr_descr,
-                                                  const float*              csr_val,
-                                                  const rocsparse_int*      csr_row_ptr,
-                                                  const rocsparse_int*      csr_col_ind,
-                                                  rocsparse_int             row_block_dim,
-                                                  rocsparse_int             col_block_dim,
-                                                  size_t*                   p_buffer_size);
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2gebsr_buffer_size(rocsparse_handle          handle,
-                                                  rocsparse_direction       dir,
-                                                  rocsparse_int             m,
-                                                  rocsparse_int             n,
-                                                  const rocsparse_mat_descr csr_descr,
-                                                  const double*             csr_val,
-                                                  const rocsparse_int*      csr_row_ptr,
-                                                  const rocsparse_int*      csr_col_ind,
-                                                  rocsparse_int             row_block_dim,
-                                                  rocsparse_int             col_block_dim,
-                                                  size_t*                   p_buffer_size);
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsr2gebsr_buffer_size(rocsparse_handle               handle,
-                                                  rocsparse_direction            dir,
-                                                  rocsparse_int                  m,
-                                                  rocsparse_int                  n,
-                                                  const rocsparse_mat_descr      csr_descr,
-                                                  const rocsparse_float_complex* csr_val,
-                                                  const rocsparse_int*           csr_row_ptr,
-                                                  const rocsparse_int*           csr_col_ind,
-                                                  rocsparse_int                  row_block_dim,
-                                                  rocsparse_int                  col_block_dim,
-                                                  size_t*                        p_buffer_size);
+rocsparse_status
+    rocsparse_sprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         const float*              A,
+                                                         rocsparse_int             lda,
+                                                         float                     percentage,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsr2gebsr_buffer_size(rocsparse_handle                handle,
-                                                  rocsparse_direction             dir,
-                                                  rocsparse_int                   m,
-                                                  rocsparse_int                   n,
-                                                  const rocsparse_mat_descr       csr_descr,
-                                                  const rocsparse_double_complex* csr_val,
-                                                  const rocsparse_int*            csr_row_ptr,
-                                                  const rocsparse_int*            csr_col_ind,
-                                                  rocsparse_int                   row_block_dim,
-                                                  rocsparse_int                   col_block_dim,
-                                                  size_t*                         p_buffer_size);
+rocsparse_status
+    rocsparse_dprune_dense2csr_by_percentage_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         const double*             A,
+                                                         rocsparse_int             lda,
+                                                         double                    percentage,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size);
 /**@}*/
 
 /*! \ingroup conv_module
 *  \brief
-*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
-*  GEneral BSR matrix given a sparse CSR matrix as input.
+*  This function computes the number of nonzero elements per row and the total number of nonzero elements in a dense matrix
+*  when converting and pruning by percentage a dense matrix to a CSR matrix.
 *
 *  \details
-*  The routine does support asynchronous execution if the pointer mode is set to device.
+*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
+*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
+*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
+*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
+*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
+*
+*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
+*  sorted array by
+*  \f[
+*    pos = ceil(m*n*(percentage/100)) - 1
+*    pos = min(pos, m*n-1)
+*    pos = max(pos, 0)
+*    threshold = sorted_A[pos]
+*  \f]
+*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. The routine does
+*  support asynchronous execution if the pointer mode is set to device.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *
 *  @param[in]
-*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
-*              \ref rocsparse_direction_row.
+*  m           number of rows of the dense matrix \p A.
 *
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  n           number of columns of the dense matrix \p A.
 *
 *  @param[in]
-*  n           number of columns of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
 *
 *  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
-*  @param[in]
-*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*  lda         leading dimension of dense array \p A.
 *
 *  @param[in]
-*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
+*  percentage  percentage >= 0 and percentage <= 100.
 *
 *  @param[in]
-*  bsr_descr    descriptor of the sparse GEneral BSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  descr       the descriptor of the dense matrix \p A.
+*
 *  @param[out]
-*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the General BSR matrix
+*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
 *
-*  @param[in]
-*  row_block_dim   the row block dimension of the GEneral BSR matrix. Between 1 and min(m, n)
+*  @param[out]
+*  nnz_total_dev_host_ptr total number of nonzero elements in device or host memory.
 *
 *  @param[in]
-*  col_block_dim   the col block dimension of the GEneral BSR matrix. Between 1 and min(m, n)
+*  info prune information structure
 *
 *  @param[out]
-*  bsr_nnz_devhost  total number of nonzero elements in device or host memory.
-*
-*  @param[in]
-*  p_buffer    buffer allocated by the user whose size is determined by calling \p rocsparse_xcsr2gebsr_buffer_size.
+*  temp_buffer buffer allocated by the user whose size is determined by calling rocsparse_xprune_dense2csr_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim \p col_block_dim is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p bsr_nnz_devhost
-*              pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_row_ptr
+*              or \p nnz_total_dev_host_ptr or \p temp_buffer pointer is invalid.
 */
 /**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
+                                                              rocsparse_int             m,
+                                                              rocsparse_int             n,
+                                                              const float*              A,
+                                                              rocsparse_int             lda,
+                                                              float                     percentage,
+                                                              const rocsparse_mat_descr descr,
+                                                              rocsparse_int*            csr_row_ptr,
+                                                              rocsparse_int* nnz_total_dev_host_ptr,
+                                                              rocsparse_mat_info info,
+                                                              void*              temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          handle,
-                                         rocsparse_direction       dir,
-                                         rocsparse_int             m,
-                                         rocsparse_int             n,
-                                         const rocsparse_mat_descr csr_descr,
-                                         const rocsparse_int*      csr_row_ptr,
-                                         const rocsparse_int*      csr_col_ind,
-                                         const rocsparse_mat_descr bsr_descr,
-                                         rocsparse_int*            bsr_row_ptr,
-                                         rocsparse_int             row_block_dim,
-                                         rocsparse_int             col_block_dim,
-                                         rocsparse_int*            bsr_nnz_devhost,
-                                         void*                     p_buffer);
+rocsparse_status rocsparse_dprune_dense2csr_nnz_by_percentage(rocsparse_handle          handle,
+                                                              rocsparse_int             m,
+                                                              rocsparse_int             n,
+                                                              const double*             A,
+                                                              rocsparse_int             lda,
+                                                              double                    percentage,
+                                                              const rocsparse_mat_descr descr,
+                                                              rocsparse_int*            csr_row_ptr,
+                                                              rocsparse_int* nnz_total_dev_host_ptr,
+                                                              rocsparse_mat_info info,
+                                                              void*              temp_buffer);
 /**@}*/
 
 /*! \ingroup conv_module
-*  \brief Convert a sparse CSR matrix into a sparse GEneral BSR matrix
+*  \brief
+*  This function converts the matrix A in dense format into a sparse matrix in CSR format while pruning values
+*  based on percentage.
 *
 *  \details
-*  \p rocsparse_csr2gebsr converts a CSR matrix into a GEneral BSR matrix. It is assumed,
-*  that \p bsr_val, \p bsr_col_ind and \p bsr_row_ptr are allocated. Allocation size
-*  for \p bsr_row_ptr is computed as \p mb+1 where \p mb is the number of block rows in
-*  the GEneral BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
-*  \p csr2gebsr_nnz() which also fills in \p bsr_row_ptr.
+*  When converting and pruning a dense matrix A to a CSR matrix by percentage the following steps are performed. First the user
+*  calls \p rocsparse_prune_dense2csr_by_percentage_buffer_size which determines the size of the temporary storage buffer. Once
+*  determined, this buffer must be allocated by the user. Next the user allocates the csr_row_ptr array to have \p m+1 elements
+*  and calls \p rocsparse_prune_dense2csr_nnz_by_percentage. Finally the user finishes the conversion by allocating the csr_col_ind
+*  and csr_val arrays (whos size is determined by the value at nnz_total_dev_host_ptr) and calling \p rocsparse_prune_dense2csr_by_percentage.
+*
+*  The pruning by percentage works by first sorting the absolute values of the dense matrix \p A. We then determine a position in this
+*  sorted array by
+*  \f[
+*    pos = ceil(m*n*(percentage/100)) - 1
+*    pos = min(pos, m*n-1)
+*    pos = max(pos, 0)
+*    threshold = sorted_A[pos]
+*  \f]
+*  Once we have this threshold we prune values in the dense matrix \p A as in \p rocsparse_prune_dense2csr. It is executed
+*  asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
 *
 *  @param[in]
-*  handle       handle to the rocsparse library context queue.
-*  @param[in]
-*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
-*  @param[in]
-*  m            number of rows in the sparse CSR matrix.
+*  handle      handle to the rocsparse library context queue.
+*
 *  @param[in]
-*  n            number of columns in the sparse CSR matrix.
+*  m           number of rows of the dense matrix \p A.
+*
 *  @param[in]
-*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
+*  n           number of columns of the dense matrix \p A.
+*
 *  @param[in]
-*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*  A           array of dimensions (\p lda, \p n)
+*
 *  @param[in]
-*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
-*               sparse CSR matrix.
+*  lda         leading dimension of dense array \p A.
+*
 *  @param[in]
-*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
+*  percentage  percentage >= 0 and percentage <= 100.
+*
 *  @param[in]
-*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
-*               \ref rocsparse_matrix_type_general is supported.
-*  @param[out]
-*  bsr_val      array of \p nnzb* \p row_block_dim*\p col_block_dim containing the values of the sparse BSR matrix.
-*  @param[out]
-*  bsr_row_ptr  array of \p mb+1 elements that point to the start of every block row of the
-*               sparse BSR matrix.
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
 *  @param[out]
-*  bsr_col_ind  array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+*  csr_val array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*
 *  @param[in]
-*  row_block_dim    row size of the blocks in the sparse GEneral BSR matrix.
+*  csr_row_ptr integer array of \p m+1 elements that contains the start of every row and the end of the last row plus one.
+*
+*  @param[out]
+*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
 *  @param[in]
-*  col_block_dim    col size of the blocks in the sparse GEneral BSR matrix.
+*  info prune information structure
+*
 *  @param[in]
-*  p_buffer    buffer allocated by the user whose size is determined by calling \p rocsparse_xcsr2gebsr_buffer_size.
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_xprune_dense2csr_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim or \p col_block_dim is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_val,
-*              \p bsr_row_ptr, \p bsr_col_ind, \p csr_val, \p csr_row_ptr or
-*              \p csr_col_ind pointer is invalid.
-*
-*  \par Example
-*  This example converts a CSR matrix into an BSR matrix.
-*  \code{.c}
-*      //     1 4 0 0 0 0
-*      // A = 0 2 3 0 0 0
-*      //     5 0 0 7 8 0
-*      //     0 0 9 0 6 0
-*
-*      rocsparse_int m   = 4;
-*      rocsparse_int n   = 6;
-*      rocsparse_int row_block_dim = 2;
-*      rocsparse_int col_block_dim = 3;
-*      rocsparse_int nnz = 9;
-*      rocsparse_int mb = (m + row_block_dim - 1) / row_block_dim;
-*      rocsparse_int nb = (n + col_block_dim - 1) / col_block_dim;
-*
-*      csr_row_ptr[m+1]  = {0, 2, 4, 7, 9};             // device memory
-*      csr_col_ind[nnz]  = {0, 1, 1, 2, 0, 3, 4, 2, 4}; // device memory
-*      csr_val[nnz]      = {1, 4, 2, 3, 5, 7, 8, 9, 6}; // device memory
-*
-*      hipMalloc(&bsr_row_ptr, sizeof(rocsparse_int) *(mb + 1));
-*      rocsparse_int nnzb;
-*      rocsparse_int* nnzTotalHostPtr = &nnzb;
-*      csr2gebsr_nnz(handle,
-*                  rocsparse_direction_row,
-*                  m,
-*                  n,
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p lda or \p percentage is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p descr or \p info or \p csr_val
+*              or \p csr_row_ptr or \p csr_col_ind or \p temp_buffer pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sprune_dense2csr_by_percentage(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          const float*              A,
+                                                          rocsparse_int             lda,
+                                                          float                     percentage,
+                                                          const rocsparse_mat_descr descr,
+                                                          float*                    csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          rocsparse_int*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dprune_dense2csr_by_percentage(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             n,
+                                                          const double*             A,
+                                                          rocsparse_int             lda,
+                                                          double                    percentage,
+                                                          const rocsparse_mat_descr descr,
+                                                          double*                   csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          rocsparse_int*            csr_col_ind,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*
+*  This function converts the matrix A in dense format into a sparse matrix in CSC format.
+*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_columns, which can be pre-computed with rocsparse_xnnz().
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*
+*  \details
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
+*
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
+*
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  A           array of dimensions (\p ld, \p n)
+*
+*  @param[in]
+*  ld         leading dimension of dense array \p A.
+*
+*  @param[in]
+*  nnz_per_columns   array of size \p n containing the number of non-zero elements per column.
+*
+*  @param[out]
+*  csc_val
+*              array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[out]
+*  csc_col_ptr
+*              integer array of m+1 elements that contains the start of every column and the end of the last column plus one.
+*  @param[out]
+*  csc_row_ind
+*              integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_columns or \p csc_val \p csc_col_ptr or \p csc_row_ind
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdense2csc(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_columns,
+                                      float*                    csc_val,
+                                      rocsparse_int*            csc_col_ptr,
+                                      rocsparse_int*            csc_row_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddense2csc(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_columns,
+                                      double*                   csc_val,
+                                      rocsparse_int*            csc_col_ptr,
+                                      rocsparse_int*            csc_row_ind);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdense2csc(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* A,
+                                      rocsparse_int                  ld,
+                                      const rocsparse_int*           nnz_per_columns,
+                                      rocsparse_float_complex*       csc_val,
+                                      rocsparse_int*                 csc_col_ptr,
+                                      rocsparse_int*                 csc_row_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdense2csc(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* A,
+                                      rocsparse_int                   ld,
+                                      const rocsparse_int*            nnz_per_columns,
+                                      rocsparse_double_complex*       csc_val,
+                                      rocsparse_int*                  csc_col_ptr,
+                                      rocsparse_int*                  csc_row_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*
+*  This function converts the matrix A in dense format into a sparse matrix in COO format.
+*  All the parameters are assumed to have been pre-allocated by the user and the arrays are filled in based on nnz_per_rows, which can be pre-computed with rocsparse_xnnz().
+*
+*  \details
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
+*
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
+*
+*  @param[in]
+*  descr      the descriptor of the dense matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  A           array of dimensions (\p ld, \p n)
+*
+*  @param[in]
+*  ld         leading dimension of dense array \p A.
+*
+*  @param[in]
+*  nnz_per_rows   array of size \p n containing the number of non-zero elements per row.
+*
+*  @param[out]
+*  coo_val
+*              array of nnz nonzero elements of matrix \p A.
+*  @param[out]
+*  coo_row_ind
+*              integer array of nnz row indices of the non-zero elements of matrix \p A.
+*  @param[out]
+*  coo_col_ind integer array of nnz column indices of the non-zero elements of matrix \p A.
+*
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p nnz_per_rows or \p coo_val \p coo_col_ind or \p coo_row_ind
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sdense2coo(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_rows,
+                                      float*                    coo_val,
+                                      rocsparse_int*            coo_row_ind,
+                                      rocsparse_int*            coo_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ddense2coo(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             A,
+                                      rocsparse_int             ld,
+                                      const rocsparse_int*      nnz_per_rows,
+                                      double*                   coo_val,
+                                      rocsparse_int*            coo_row_ind,
+                                      rocsparse_int*            coo_col_ind);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cdense2coo(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* A,
+                                      rocsparse_int                  ld,
+                                      const rocsparse_int*           nnz_per_rows,
+                                      rocsparse_float_complex*       coo_val,
+                                      rocsparse_int*                 coo_row_ind,
+                                      rocsparse_int*                 coo_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zdense2coo(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* A,
+                                      rocsparse_int                   ld,
+                                      const rocsparse_int*            nnz_per_rows,
+                                      rocsparse_double_complex*       coo_val,
+                                      rocsparse_int*                  coo_row_ind,
+                                      rocsparse_int*                  coo_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the sparse matrix in CSR format into a dense matrix.
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \details
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
+*
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
+*
+*  @param[in]
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  csr_val     array of nnz ( = \p csr_row_ptr[m] - \p csr_row_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[in]
+*  csr_row_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[in]
+*  csr_col_ind integer array of nnz ( = \p csr_row_ptr[m] - csr_row_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  @param[out]
+*  A           array of dimensions (\p ld, \p n)
+*
+*  @param[out]
+*  ld          leading dimension of dense array \p A.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p csr_val \p csr_row_ptr or \p csr_col_ind
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      float*                    A,
+                                      rocsparse_int             ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      double*                   A,
+                                      rocsparse_int             ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2dense(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* csr_val,
+                                      const rocsparse_int*           csr_row_ptr,
+                                      const rocsparse_int*           csr_col_ind,
+                                      rocsparse_float_complex*       A,
+                                      rocsparse_int                  ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2dense(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*            csr_row_ptr,
+                                      const rocsparse_int*            csr_col_ind,
+                                      rocsparse_double_complex*       A,
+                                      rocsparse_int                   ld);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the sparse matrix in CSC format into a dense matrix.
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \details
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
+*
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
+*
+*  @param[in]
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  csc_val     array of nnz ( = \p csc_col_ptr[m] - \p csc_col_ptr[0] ) nonzero elements of matrix \p A.
+*  @param[in]
+*  csc_col_ptr integer array of m+1 elements that contains the start of every row and the end of the last row plus one.
+*  @param[in]
+*  csc_row_ind integer array of nnz ( = \p csc_col_ptr[m] - csc_col_ptr[0] ) column indices of the non-zero elements of matrix \p A.
+*
+*  @param[out]
+*  A           array of dimensions (\p ld, \p n)
+*
+*  @param[out]
+*  ld          leading dimension of dense array \p A.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p csc_val \p csc_col_ptr or \p csc_row_ind
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsc2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              csc_val,
+                                      const rocsparse_int*      csc_col_ptr,
+                                      const rocsparse_int*      csc_row_ind,
+                                      float*                    A,
+                                      rocsparse_int             ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsc2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             csc_val,
+                                      const rocsparse_int*      csc_col_ptr,
+                                      const rocsparse_int*      csc_row_ind,
+                                      double*                   A,
+                                      rocsparse_int             ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsc2dense(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* csc_val,
+                                      const rocsparse_int*           csc_col_ptr,
+                                      const rocsparse_int*           csc_row_ind,
+                                      rocsparse_float_complex*       A,
+                                      rocsparse_int                  ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsc2dense(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* csc_val,
+                                      const rocsparse_int*            csc_col_ptr,
+                                      const rocsparse_int*            csc_row_ind,
+                                      rocsparse_double_complex*       A,
+                                      rocsparse_int                   ld);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the sparse matrix in COO format into a dense matrix.
+*  It is executed asynchronously with respect to the host and may return control to the application on the host before the entire result is ready.
+*  \details
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m           number of rows of the dense matrix \p A.
+*
+*  @param[in]
+*  n           number of columns of the dense matrix \p A.
+*
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse COO matrix.
+*  @param[in]
+*  descr       the descriptor of the dense matrix \p A, the supported matrix type is \ref rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  coo_val     array of nnz nonzero elements of matrix \p A.
+*  @param[in]
+*  coo_row_ind integer array of nnz row indices of the non-zero elements of matrix \p A.
+*
+*  @param[in]
+*  coo_col_ind integer array of nnz column indices of the non-zero elements of matrix \p A.
+*  @param[out]
+*  A           array of dimensions (\p ld, \p n)
+*
+*  @param[out]
+*  ld          leading dimension of dense array \p A.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p nnz or \p ld is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p A or \p coo_val \p coo_col_ind or \p coo_row_ind
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scoo2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      const float*              coo_val,
+                                      const rocsparse_int*      coo_row_ind,
+                                      const rocsparse_int*      coo_col_ind,
+                                      float*                    A,
+                                      rocsparse_int             ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcoo2dense(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      const double*             coo_val,
+                                      const rocsparse_int*      coo_row_ind,
+                                      const rocsparse_int*      coo_col_ind,
+                                      double*                   A,
+                                      rocsparse_int             ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccoo2dense(rocsparse_handle               handle,
+                                      rocsparse_int                  m,
+                                      rocsparse_int                  n,
+                                      rocsparse_int                  nnz,
+                                      const rocsparse_mat_descr      descr,
+                                      const rocsparse_float_complex* coo_val,
+                                      const rocsparse_int*           coo_row_ind,
+                                      const rocsparse_int*           coo_col_ind,
+                                      rocsparse_float_complex*       A,
+                                      rocsparse_int                  ld);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcoo2dense(rocsparse_handle                handle,
+                                      rocsparse_int                   m,
+                                      rocsparse_int                   n,
+                                      rocsparse_int                   nnz,
+                                      const rocsparse_mat_descr       descr,
+                                      const rocsparse_double_complex* coo_val,
+                                      const rocsparse_int*            coo_row_ind,
+                                      const rocsparse_int*            coo_col_ind,
+                                      rocsparse_double_complex*       A,
+                                      rocsparse_int                   ld);
+/**@}*/
+
+/*! \ingroup conv_module
+*  Given a sparse CSR matrix and a non-negative tolerance, this function computes how many entries would be left
+*  in each row of the matrix if elements less than the tolerance were removed. It also computes the total number
+*  of remaining elements in the matrix.
+*
+*  @param[in]
+*  handle        handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  m             number of rows of the sparse CSR matrix.
+*
+*  @param[in]
+*  descr_A       the descriptor of the sparse CSR matrix.
+*
+*  @param[in]
+*  csr_val_A     array of \p nnz_A elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr_A array of \p m+1 elements that point to the start of every row of the
+*                uncompressed sparse CSR matrix.
+*  @param[out]
+*  nnz_per_row   array of length \p m containing the number of entries that will be kept per row in
+*                the final compressed CSR matrix.
+*  @param[out]
+*  nnz_C         number of elements in the column indices and values arrays of the compressed
+*                sparse CSR matrix. Can be either host or device pointer.
+*  @param[in]
+*  tol           the non-negative tolerance used for compression. If \p tol is complex then only the magnitude
+*                of the real part is used. Entries in the input uncompressed CSR array that are below the tolerance
+*                are removed in output compressed CSR matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+*  \retval     rocsparse_status_invalid_value \p tol is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val_A or \p csr_row_ptr_A or \p nnz_per_row or \p nnz_C
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_snnz_compress(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr descr_A,
+                                         const float*              csr_val_A,
+                                         const rocsparse_int*      csr_row_ptr_A,
+                                         rocsparse_int*            nnz_per_row,
+                                         rocsparse_int*            nnz_C,
+                                         float                     tol);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnnz_compress(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr descr_A,
+                                         const double*             csr_val_A,
+                                         const rocsparse_int*      csr_row_ptr_A,
+                                         rocsparse_int*            nnz_per_row,
+                                         rocsparse_int*            nnz_C,
+                                         double                    tol);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cnnz_compress(rocsparse_handle               handle,
+                                         rocsparse_int                  m,
+                                         const rocsparse_mat_descr      descr_A,
+                                         const rocsparse_float_complex* csr_val_A,
+                                         const rocsparse_int*           csr_row_ptr_A,
+                                         rocsparse_int*                 nnz_per_row,
+                                         rocsparse_int*                 nnz_C,
+                                         rocsparse_float_complex        tol);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_znnz_compress(rocsparse_handle                handle,
+                                         rocsparse_int                   m,
+                                         const rocsparse_mat_descr       descr_A,
+                                         const rocsparse_double_complex* csr_val_A,
+                                         const rocsparse_int*            csr_row_ptr_A,
+                                         rocsparse_int*                  nnz_per_row,
+                                         rocsparse_int*                  nnz_C,
+                                         rocsparse_double_complex        tol);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse COO matrix
+*
+*  \details
+*  \p rocsparse_csr2coo converts the CSR array containing the row offsets, that point
+*  to the start of every row, into a COO array of row indices.
+*
+*  \note
+*  It can also be used to convert a CSC array containing the column offsets into a COO
+*  array of column indices.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row
+*              of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[out]
+*  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+*              matrix.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p coo_row_ind
+*              pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*
+*  \par Example
+*  This example converts a CSR matrix into a COO matrix.
+*  \code{.c}
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
+*
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 5;
+*      rocsparse_int nnz = 8;
+*
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*
+*      // Allocate COO matrix arrays
+*      rocsparse_int* coo_row_ind;
+*      rocsparse_int* coo_col_ind;
+*      float* coo_val;
+*
+*      hipMalloc((void**)&coo_row_ind, sizeof(rocsparse_int) * nnz);
+*      hipMalloc((void**)&coo_col_ind, sizeof(rocsparse_int) * nnz);
+*      hipMalloc((void**)&coo_val, sizeof(float) * nnz);
+*
+*      // Convert the csr row offsets into coo row indices
+*      rocsparse_csr2coo(handle,
+*                        csr_row_ptr,
+*                        nnz,
+*                        m,
+*                        coo_row_ind,
+*                        rocsparse_index_base_zero);
+*
+*      // Copy the column and value arrays
+*      hipMemcpy(coo_col_ind,
+*                csr_col_ind,
+*                sizeof(rocsparse_int) * nnz,
+*                hipMemcpyDeviceToDevice);
+*
+*      hipMemcpy(coo_val,
+*                csr_val,
+*                sizeof(float) * nnz,
+*                hipMemcpyDeviceToDevice);
+*  \endcode
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2coo(rocsparse_handle     handle,
+                                   const rocsparse_int* csr_row_ptr,
+                                   rocsparse_int        nnz,
+                                   rocsparse_int        m,
+                                   rocsparse_int*       coo_row_ind,
+                                   rocsparse_index_base idx_base);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+*
+*  \details
+*  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
+*  required by rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
+*  rocsparse_zcsr2csc(). The temporary storage buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
+*              rocsparse_zcsr2csc().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle     handle,
+                                               rocsparse_int        m,
+                                               rocsparse_int        n,
+                                               rocsparse_int        nnz,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_action     copy_values,
+                                               size_t*              buffer_size);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse CSC matrix
+*
+*  \details
+*  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
+*  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
+*  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
+*  or not (\ref rocsparse_action_symbolic).
+*
+*  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
+*  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
+*
+*  \note
+*  The resulting matrix can also be seen as the transpose of the input matrix.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  csc_val     array of \p nnz elements of the sparse CSC matrix.
+*  @param[out]
+*  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+*              matrix.
+*  @param[out]
+*  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
+*              sparse CSC matrix.
+*  @param[in]
+*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_csr2csc_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  This example computes the transpose of a CSR matrix.
+*  \code{.c}
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
+*
+*      rocsparse_int m_A   = 3;
+*      rocsparse_int n_A   = 5;
+*      rocsparse_int nnz_A = 8;
+*
+*      csr_row_ptr_A[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind_A[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val_A[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*
+*      // Allocate memory for transposed CSR matrix
+*      rocsparse_int m_T   = n_A;
+*      rocsparse_int n_T   = m_A;
+*      rocsparse_int nnz_T = nnz_A;
+*
+*      rocsparse_int* csr_row_ptr_T;
+*      rocsparse_int* csr_col_ind_T;
+*      float* csr_val_T;
+*
+*      hipMalloc((void**)&csr_row_ptr_T, sizeof(rocsparse_int) * (m_T + 1));
+*      hipMalloc((void**)&csr_col_ind_T, sizeof(rocsparse_int) * nnz_T);
+*      hipMalloc((void**)&csr_val_T, sizeof(float) * nnz_T);
+*
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csr2csc_buffer_size(handle,
+*                                    m_A,
+*                                    n_A,
+*                                    nnz_A,
+*                                    csr_row_ptr_A,
+*                                    csr_col_ind_A,
+*                                    rocsparse_action_numeric,
+*                                    &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      rocsparse_scsr2csc(handle,
+*                         m_A,
+*                         n_A,
+*                         nnz_A,
+*                         csr_val_A,
+*                         csr_row_ptr_A,
+*                         csr_col_ind_A,
+*                         csr_val_T,
+*                         csr_col_ind_T,
+*                         csr_row_ptr_T,
+*                         rocsparse_action_numeric,
+*                         rocsparse_index_base_zero,
+*                         temp_buffer);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2csc(rocsparse_handle     handle,
+                                    rocsparse_int        m,
+                                    rocsparse_int        n,
+                                    rocsparse_int        nnz,
+                                    const float*         csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    float*               csc_val,
+                                    rocsparse_int*       csc_row_ind,
+                                    rocsparse_int*       csc_col_ptr,
+                                    rocsparse_action     copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2csc(rocsparse_handle     handle,
+                                    rocsparse_int        m,
+                                    rocsparse_int        n,
+                                    rocsparse_int        nnz,
+                                    const double*        csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    double*              csc_val,
+                                    rocsparse_int*       csc_row_ind,
+                                    rocsparse_int*       csc_col_ptr,
+                                    rocsparse_action     copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2csc(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_float_complex*       csc_val,
+                                    rocsparse_int*                 csc_row_ind,
+                                    rocsparse_int*                 csc_col_ptr,
+                                    rocsparse_action               copy_values,
+                                    rocsparse_index_base           idx_base,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2csc(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_double_complex*       csc_val,
+                                    rocsparse_int*                  csc_row_ind,
+                                    rocsparse_int*                  csc_col_ptr,
+                                    rocsparse_action                copy_values,
+                                    rocsparse_index_base            idx_base,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
+*
+*  \details
+*  \p rocsparse_gebsr2gebsc_buffer_size returns the size of the temporary storage buffer
+*  required by rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
+*  rocsparse_zgebsr2gebsc(). The temporary storage buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  mb           number of rows of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nb           number of columns of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nnzb         number of non-zero entries of the sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_val     array of \p nnzb*row_block_dim*col_block_dim containing the values of the sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_row_ptr array of \p mb+1 elements that point to the start of every row of the
+*              sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_col_ind array of \p nnzb elements containing the column indices of the sparse
+*              GEneral BSR matrix.
+*  @param[in]
+*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
+*  @param[in]
+*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
+
+*  @param[out]
+*  p_buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgebsr2gebsc(), rocsparse_dgebsr2gebsc(), rocsparse_cgebsr2gebsc() and
+*              rocsparse_zgebsr2gebsc().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr, \p bsr_col_ind or
+*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgebsr2gebsc_buffer_size(rocsparse_handle     handle,
+                                                    rocsparse_int        mb,
+                                                    rocsparse_int        nb,
+                                                    rocsparse_int        nnzb,
+                                                    const float*         bsr_val,
+                                                    const rocsparse_int* bsr_row_ptr,
+                                                    const rocsparse_int* bsr_col_ind,
+                                                    rocsparse_int        row_block_dim,
+                                                    rocsparse_int        col_block_dim,
+                                                    size_t*              p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgebsr2gebsc_buffer_size(rocsparse_handle     handle,
+                                                    rocsparse_int        mb,
+                                                    rocsparse_int        nb,
+                                                    rocsparse_int        nnzb,
+                                                    const double*        bsr_val,
+                                                    const rocsparse_int* bsr_row_ptr,
+                                                    const rocsparse_int* bsr_col_ind,
+                                                    rocsparse_int        row_block_dim,
+                                                    rocsparse_int        col_block_dim,
+                                                    size_t*              p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgebsr2gebsc_buffer_size(rocsparse_handle               handle,
+                                                    rocsparse_int                  mb,
+                                                    rocsparse_int                  nb,
+                                                    rocsparse_int                  nnzb,
+                                                    const rocsparse_float_complex* bsr_val,
+                                                    const rocsparse_int*           bsr_row_ptr,
+                                                    const rocsparse_int*           bsr_col_ind,
+                                                    rocsparse_int                  row_block_dim,
+                                                    rocsparse_int                  col_block_dim,
+                                                    size_t*                        p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgebsr2gebsc_buffer_size(rocsparse_handle                handle,
+                                                    rocsparse_int                   mb,
+                                                    rocsparse_int                   nb,
+                                                    rocsparse_int                   nnzb,
+                                                    const rocsparse_double_complex* bsr_val,
+                                                    const rocsparse_int*            bsr_row_ptr,
+                                                    const rocsparse_int*            bsr_col_ind,
+                                                    rocsparse_int                   row_block_dim,
+                                                    rocsparse_int                   col_block_dim,
+                                                    size_t*                         p_buffer_size);
+
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse GEneral BSR matrix into a sparse GEneral BSC matrix
+*
+*  \details
+*  \p rocsparse_gebsr2gebsc converts a GEneral BSR matrix into a GEneral BSC matrix. \p rocsparse_gebsr2gebsc
+*  can also be used to convert a GEneral BSC matrix into a GEneral BSR matrix. \p copy_values decides
+*  whether \p bsc_val is being filled during conversion (\ref rocsparse_action_numeric)
+*  or not (\ref rocsparse_action_symbolic).
+*
+*  \p rocsparse_gebsr2gebsc requires extra temporary storage buffer that has to be allocated
+*  by the user. Storage buffer size can be determined by rocsparse_gebsr2gebsc_buffer_size().
+*
+*  \note
+*  The resulting matrix can also be seen as the transpose of the input matrix.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  mb          number of rows of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nb          number of columns of the sparse GEneral BSR matrix.
+*  @param[in]
+*  nnzb        number of non-zero entries of the sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_val     array of \p nnzb * \p row_block_dim * \p col_block_dim  elements of the sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse GEneral BSR matrix.
+*  @param[in]
+*  bsr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              GEneral BSR matrix.
+*  @param[in]
+*  row_block_dim   row size of the blocks in the sparse general BSR matrix.
+*  @param[in]
+*  col_block_dim   col size of the blocks in the sparse general BSR matrix.
+*  @param[out]
+*  bsc_val     array of \p nnz elements of the sparse BSC matrix.
+*  @param[out]
+*  bsc_row_ind array of \p nnz elements containing the row indices of the sparse BSC
+*              matrix.
+*  @param[out]
+*  bsc_col_ptr array of \p n+1 elements that point to the start of every column of the
+*              sparse BSC matrix.
+*  @param[in]
+*  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+*  @param[in]
+*  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_gebsr2gebsc_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb, \p nb or \p nnzb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_val, \p bsr_row_ptr,
+*              \p bsr_col_ind, \p bsc_val, \p bsc_row_ind, \p bsc_col_ptr or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*
+*  \par Example
+*  This example computes the transpose of a GEneral BSR matrix.
+*  \code{.c}
+*      //     1 2 0 3
+*      // A = 0 4 5 0
+*      //     6 0 0 7
+*      //     1 2 3 4
+*
+*      rocsparse_int mb_A   = 2;
+*      rocsparse_int row_block_dim = 2;
+*      rocsparse_int col_block_dim = 2;
+*      rocsparse_int nb_A   = 2;
+*      rocsparse_int nnzb_A = 4;
+*
+*      bsr_row_ptr_A[mb_A+1] = {0, 2, 4};               // device memory
+*      bsr_col_ind_A[nnzb_A] = {0, 1, 0, 1}; // device memory
+*      bsr_val_A[nnzb_A]     = {1, 0, 2, 4, 0, 5, 3, 0, 6, 1, 0, 2, 0, 3, 7, 4}; // device memory
+*
+*      // Allocate memory for transposed BSR matrix
+*      rocsparse_int mb_T   = nb_A;
+*      rocsparse_int nb_T   = mb_A;
+*      rocsparse_int nnzb_T = nnzb_A;
+*
+*      rocsparse_int* bsr_row_ptr_T;
+*      rocsparse_int* bsr_col_ind_T;
+*      float* bsr_val_T;
+*
+*      hipMalloc((void**)&bsr_row_ptr_T, sizeof(rocsparse_int) * (mb_T + 1));
+*      hipMalloc((void**)&bsr_col_ind_T, sizeof(rocsparse_int) * nnzb_T);
+*      hipMalloc((void**)&bsr_val_T, sizeof(float) * nnzb_T);
+*
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_gebsr2gebsc_buffer_size(handle,
+*                                    mb_A,
+*                                    nb_A,
+*                                    nnzb_A,
+*                                    bsr_row_ptr_A,
+*                                    bsr_col_ind_A,
+*                                    rocsparse_action_numeric,
+*                                    &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      rocsparse_sgebsr2gebsc(handle,
+*                         mb_A,
+*                         nb_A,
+*                         nnzb_A,
+*                         bsr_val_A,
+*                         bsr_row_ptr_A,
+*                         bsr_col_ind_A,
+*                         row_block_dim,
+*                         col_block_dim,
+*                         bsr_val_T,
+*                         bsr_col_ind_T,
+*                         bsr_row_ptr_T,
+*                         rocsparse_action_numeric,
+*                         rocsparse_index_base_zero,
+*                         temp_buffer);
+*  \endcode
+*/
+/**@{*/
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgebsr2gebsc(rocsparse_handle     handle,
+                                        rocsparse_int        mb,
+                                        rocsparse_int        nb,
+                                        rocsparse_int        nnzb,
+                                        const float*         bsr_val,
+                                        const rocsparse_int* bsr_row_ptr,
+                                        const rocsparse_int* bsr_col_ind,
+                                        rocsparse_int        row_block_dim,
+                                        rocsparse_int        col_block_dim,
+                                        float*               bsc_val,
+                                        rocsparse_int*       bsc_row_ind,
+                                        rocsparse_int*       bsc_col_ptr,
+                                        rocsparse_action     copy_values,
+                                        rocsparse_index_base idx_base,
+                                        void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgebsr2gebsc(rocsparse_handle     handle,
+                                        rocsparse_int        mb,
+                                        rocsparse_int        nb,
+                                        rocsparse_int        nnzb,
+                                        const double*        bsr_val,
+                                        const rocsparse_int* bsr_row_ptr,
+                                        const rocsparse_int* bsr_col_ind,
+                                        rocsparse_int        row_block_dim,
+                                        rocsparse_int        col_block_dim,
+                                        double*              bsc_val,
+                                        rocsparse_int*       bsc_row_ind,
+                                        rocsparse_int*       bsc_col_ptr,
+                                        rocsparse_action     copy_values,
+                                        rocsparse_index_base idx_base,
+                                        void*                temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgebsr2gebsc(rocsparse_handle               handle,
+                                        rocsparse_int                  mb,
+                                        rocsparse_int                  nb,
+                                        rocsparse_int                  nnzb,
+                                        const rocsparse_float_complex* bsr_val,
+                                        const rocsparse_int*           bsr_row_ptr,
+                                        const rocsparse_int*           bsr_col_ind,
+                                        rocsparse_int                  row_block_dim,
+                                        rocsparse_int                  col_block_dim,
+                                        rocsparse_float_complex*       bsc_val,
+                                        rocsparse_int*                 bsc_row_ind,
+                                        rocsparse_int*                 bsc_col_ptr,
+                                        rocsparse_action               copy_values,
+                                        rocsparse_index_base           idx_base,
+                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgebsr2gebsc(rocsparse_handle                handle,
+                                        rocsparse_int                   mb,
+                                        rocsparse_int                   nb,
+                                        rocsparse_int                   nnzb,
+                                        const rocsparse_double_complex* bsr_val,
+                                        const rocsparse_int*            bsr_row_ptr,
+                                        const rocsparse_int*            bsr_col_ind,
+                                        rocsparse_int                   row_block_dim,
+                                        rocsparse_int                   col_block_dim,
+                                        rocsparse_double_complex*       bsc_val,
+                                        rocsparse_int*                  bsc_row_ind,
+                                        rocsparse_int*                  bsc_col_ptr,
+                                        rocsparse_action                copy_values,
+                                        rocsparse_index_base            idx_base,
+                                        void*                           temp_buffer);
+
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+*
+*  \details
+*  \p rocsparse_csr2ell_width computes the maximum of the per row non-zero elements
+*  over all rows, the ELL \p width, for a given CSR matrix.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  ell_width   pointer to the number of non-zero elements per row in ELL storage
+*              format.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr, or
+*              \p ell_width pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2ell_width(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_mat_descr ell_descr,
+                                         rocsparse_int*            ell_width);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse ELL matrix
+*
+*  \details
+*  \p rocsparse_csr2ell converts a CSR matrix into an ELL matrix. It is assumed,
+*  that \p ell_val and \p ell_col_ind are allocated. Allocation size is computed by the
+*  number of rows times the number of ELL non-zero elements per row, such that
+*  \f$\text{nnz}_{\text{ELL}} = m \cdot \text{ell_width}\f$. The number of ELL
+*  non-zero elements per row is obtained by rocsparse_csr2ell_width().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr   descriptor of the sparse CSR matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val     array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  ell_descr   descriptor of the sparse ELL matrix. Currently, only
+*              \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  ell_width   number of non-zero elements per row in ELL storage format.
+*  @param[out]
+*  ell_val     array of \p m times \p ell_width elements of the sparse ELL matrix.
+*  @param[out]
+*  ell_col_ind array of \p m times \p ell_width elements containing the column indices
+*              of the sparse ELL matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p ell_width is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p ell_descr, \p ell_val or
+*              \p ell_col_ind pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example converts a CSR matrix into an ELL matrix.
+*  \code{.c}
+*      //     1 2 0 3 0
+*      // A = 0 4 5 0 0
+*      //     6 0 0 7 8
+*
+*      rocsparse_int m   = 3;
+*      rocsparse_int n   = 5;
+*      rocsparse_int nnz = 8;
+*
+*      csr_row_ptr[m+1] = {0, 3, 5, 8};             // device memory
+*      csr_col_ind[nnz] = {0, 1, 3, 1, 2, 0, 3, 4}; // device memory
+*      csr_val[nnz]     = {1, 2, 3, 4, 5, 6, 7, 8}; // device memory
+*
+*      // Create ELL matrix descriptor
+*      rocsparse_mat_descr ell_descr;
+*      rocsparse_create_mat_descr(&ell_descr);
+*
+*      // Obtain the ELL width
+*      rocsparse_int ell_width;
+*      rocsparse_csr2ell_width(handle,
+*                              m,
+*                              csr_descr,
+*                              csr_row_ptr,
+*                              ell_descr,
+*                              &ell_width);
+*
+*      // Compute ELL non-zero entries
+*      rocsparse_int ell_nnz = m * ell_width;
+*
+*      // Allocate ELL column and value arrays
+*      rocsparse_int* ell_col_ind;
+*      hipMalloc((void**)&ell_col_ind, sizeof(rocsparse_int) * ell_nnz);
+*
+*      float* ell_val;
+*      hipMalloc((void**)&ell_val, sizeof(float) * ell_nnz);
+*
+*      // Format conversion
+*      rocsparse_scsr2ell(handle,
+*                         m,
+*                         csr_descr,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         ell_descr,
+*                         ell_width,
+*                         ell_val,
+*                         ell_col_ind);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2ell(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    float*                    ell_val,
+                                    rocsparse_int*            ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2ell(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    const rocsparse_mat_descr ell_descr,
+                                    rocsparse_int             ell_width,
+                                    double*                   ell_val,
+                                    rocsparse_int*            ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2ell(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    const rocsparse_mat_descr      csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    const rocsparse_mat_descr      ell_descr,
+                                    rocsparse_int                  ell_width,
+                                    rocsparse_float_complex*       ell_val,
+                                    rocsparse_int*                 ell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    const rocsparse_mat_descr       csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    const rocsparse_mat_descr       ell_descr,
+                                    rocsparse_int                   ell_width,
+                                    rocsparse_double_complex*       ell_val,
+                                    rocsparse_int*                  ell_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
+*
+*  \details
+*  \p rocsparse_csr2sell_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csr2sell_nnz(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL matrix.
+*  @param[in]
+*  sell_sigma      number of rows per sorting window of the sparse SELL matrix.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csr2sell_nnz().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p sell_slice_size or \p sell_sigma
+*              is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr or \p buffer_size pointer
+*              is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2sell_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                const rocsparse_mat_descr csr_descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                rocsparse_int             sell_slice_size,
+                                                rocsparse_int             sell_sigma,
+                                                size_t*                   buffer_size);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
+*
+*  \details
+*  \p rocsparse_csr2sell_nnz sorts the rows of a CSR matrix by decreasing number of
+*  non-zero elements within each window of \p sell_sigma consecutive rows and stores
+*  the resulting row permutation in \p sell_perm. The sorted rows are then grouped
+*  into slices of \p sell_slice_size rows, each padded to the longest row of the
+*  slice. The start of every slice is written to \p sell_slice_ptr and the total
+*  number of stored elements, including padding, to \p sell_nnz.
+*
+*  \note
+*  A \p sell_sigma of 1 keeps the original row order, while a \p sell_sigma of
+*  \p m sorts all rows. A \p sell_slice_size equal to the wavefront size of the
+*  device and a \p sell_sigma that is a multiple of it is recommended.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  sell_descr      descriptor of the sparse SELL matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL matrix.
+*  @param[in]
+*  sell_sigma      number of rows per sorting window of the sparse SELL matrix.
+*  @param[out]
+*  sell_slice_ptr  array of \p (m-1)/sell_slice_size+2 elements that point to the start
+*                  of every slice of the sparse SELL matrix.
+*  @param[out]
+*  sell_perm       array of \p m elements containing the row of the CSR matrix that is
+*                  stored at each row position of the sparse SELL matrix (zero based).
+*  @param[out]
+*  sell_nnz        pointer to the number of elements stored by the sparse SELL matrix.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csr2sell_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p sell_slice_size or \p sell_sigma
+*              is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_row_ptr,
+*              \p sell_descr, \p sell_slice_ptr, \p sell_perm, \p sell_nnz or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2sell_nnz(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        const rocsparse_mat_descr csr_descr,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_mat_descr sell_descr,
+                                        rocsparse_int             sell_slice_size,
+                                        rocsparse_int             sell_sigma,
+                                        rocsparse_int*            sell_slice_ptr,
+                                        rocsparse_int*            sell_perm,
+                                        rocsparse_int*            sell_nnz,
+                                        void*                     temp_buffer);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse SELL-C-sigma matrix
+*
+*  \details
+*  \p rocsparse_csr2sell converts a CSR matrix into a SELL-C-sigma matrix. It is
+*  assumed, that \p sell_val and \p sell_col_ind are allocated with \p sell_nnz
+*  elements, and that \p sell_slice_ptr and \p sell_perm have been computed by
+*  rocsparse_csr2sell_nnz().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  csr_descr       descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  sell_descr      descriptor of the sparse SELL matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  sell_slice_size number of rows per slice of the sparse SELL matrix.
+*  @param[in]
+*  sell_slice_ptr  array of \p (m-1)/sell_slice_size+2 elements that point to the start
+*                  of every slice of the sparse SELL matrix.
+*  @param[in]
+*  sell_perm       array of \p m elements containing the row permutation of the sparse
+*                  SELL matrix.
+*  @param[out]
+*  sell_val        array of \p sell_nnz elements of the sparse SELL matrix.
+*  @param[out]
+*  sell_col_ind    array of \p sell_nnz elements containing the column indices of the
+*                  sparse SELL matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p sell_slice_size is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_descr, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p sell_descr, \p sell_slice_ptr,
+*              \p sell_perm, \p sell_val or \p sell_col_ind pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example converts a CSR matrix into a SELL-C-sigma matrix and creates a
+*  generic sparse matrix descriptor that can be passed to rocsparse_spmv().
+*  \code{.c}
+*      // Slices of one wavefront and windows of four slices
+*      rocsparse_int slice_size = 64;
+*      rocsparse_int sigma      = 4 * slice_size;
+*      rocsparse_int nslices    = (m - 1) / slice_size + 1;
+*
+*      // Create SELL matrix descriptor
+*      rocsparse_mat_descr sell_descr;
+*      rocsparse_create_mat_descr(&sell_descr);
+*
+*      // Allocate SELL slice pointer and permutation arrays
+*      rocsparse_int* sell_slice_ptr;
+*      rocsparse_int* sell_perm;
+*      hipMalloc((void**)&sell_slice_ptr, sizeof(rocsparse_int) * (nslices + 1));
+*      hipMalloc((void**)&sell_perm, sizeof(rocsparse_int) * m);
+*
+*      // Allocate temporary buffer
+*      size_t buffer_size;
+*      rocsparse_csr2sell_buffer_size(handle,
+*                                     m,
+*                                     csr_descr,
+*                                     csr_row_ptr,
+*                                     slice_size,
+*                                     sigma,
+*                                     &buffer_size);
+*
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Sort rows and compute the slices
+*      rocsparse_int sell_nnz;
+*      rocsparse_csr2sell_nnz(handle,
+*                             m,
+*                             csr_descr,
+*                             csr_row_ptr,
+*                             sell_descr,
+*                             slice_size,
+*                             sigma,
+*                             sell_slice_ptr,
+*                             sell_perm,
+*                             &sell_nnz,
+*                             temp_buffer);
+*
+*      // Allocate SELL column and value arrays
+*      rocsparse_int* sell_col_ind;
+*      hipMalloc((void**)&sell_col_ind, sizeof(rocsparse_int) * sell_nnz);
+*
+*      float* sell_val;
+*      hipMalloc((void**)&sell_val, sizeof(float) * sell_nnz);
+*
+*      // Format conversion
+*      rocsparse_scsr2sell(handle,
+*                          m,
+*                          csr_descr,
+*                          csr_val,
+*                          csr_row_ptr,
+*                          csr_col_ind,
+*                          sell_descr,
+*                          slice_size,
+*                          sell_slice_ptr,
+*                          sell_perm,
+*                          sell_val,
+*                          sell_col_ind);
+*
+*      // Generic sparse matrix descriptor
+*      rocsparse_spmat_descr mat;
+*      rocsparse_create_sell_descr(&mat,
+*                                  m,
+*                                  n,
+*                                  sell_nnz,
+*                                  slice_size,
+*                                  sell_slice_ptr,
+*                                  sell_perm,
+*                                  sell_col_ind,
+*                                  sell_val,
+*                                  rocsparse_indextype_i32,
+*                                  rocsparse_indextype_i32,
+*                                  rocsparse_index_base_zero,
+*                                  rocsparse_datatype_f32_r);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2sell(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_perm,
+                                     float*                    sell_val,
+                                     rocsparse_int*            sell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2sell(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     const rocsparse_mat_descr csr_descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const rocsparse_mat_descr sell_descr,
+                                     rocsparse_int             sell_slice_size,
+                                     const rocsparse_int*      sell_slice_ptr,
+                                     const rocsparse_int*      sell_perm,
+                                     double*                   sell_val,
+                                     rocsparse_int*            sell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2sell(rocsparse_handle               handle,
+                                     rocsparse_int                  m,
+                                     const rocsparse_mat_descr      csr_descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     const rocsparse_mat_descr      sell_descr,
+                                     rocsparse_int                  sell_slice_size,
+                                     const rocsparse_int*           sell_slice_ptr,
+                                     const rocsparse_int*           sell_perm,
+                                     rocsparse_float_complex*       sell_val,
+                                     rocsparse_int*                 sell_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2sell(rocsparse_handle                handle,
+                                     rocsparse_int                   m,
+                                     const rocsparse_mat_descr       csr_descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     const rocsparse_mat_descr       sell_descr,
+                                     rocsparse_int                   sell_slice_size,
+                                     const rocsparse_int*            sell_slice_ptr,
+                                     const rocsparse_int*            sell_perm,
+                                     rocsparse_double_complex*       sell_val,
+                                     rocsparse_int*                  sell_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse HYB matrix
+*
+*  \details
+*  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
+*  that \p hyb has been initialized with rocsparse_create_hyb_mat().
+*
+*  \note
+*  This function requires a significant amount of storage for the HYB matrix,
+*  depending on the matrix structure.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+*  @param[out]
+*  hyb             sparse matrix in HYB format.
+*  @param[in]
+*  user_ell_width  width of the ELL part of the HYB matrix (only required if
+*                  \p partition_type == \ref rocsparse_hyb_partition_user).
+*  @param[in]
+*  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+*                  \ref rocsparse_hyb_partition_user or
+*                  \ref rocsparse_hyb_partition_max.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
+*  \retval     rocsparse_status_invalid_value \p partition_type is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+*              \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer for the HYB matrix could not be
+*              allocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+*  \code{.c}
+*      // Create HYB matrix structure
+*      rocsparse_hyb_mat hyb;
+*      rocsparse_create_hyb_mat(&hyb);
+*
+*      // User defined ell width
+*      rocsparse_int user_ell_width = 5;
+*
+*      // Perform the conversion
+*      rocsparse_scsr2hyb(handle,
+*                         m,
+*                         n,
+*                         descr,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         hyb,
+*                         user_ell_width,
+*                         rocsparse_hyb_partition_user);
+*
+*      // Do some work
+*
+*      // Clean up
+*      rocsparse_destroy_hyb_mat(hyb);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_hyb_mat         hyb,
+                                    rocsparse_int             user_ell_width,
+                                    rocsparse_hyb_partition   partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_hyb_mat              hyb,
+                                    rocsparse_int                  user_ell_width,
+                                    rocsparse_hyb_partition        partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_hyb_mat               hyb,
+                                    rocsparse_int                   user_ell_width,
+                                    rocsparse_hyb_partition         partition_type);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
+*  BSR matrix given a sparse CSR matrix as input.
+*
+*  \details
+*  The routine does support asynchronous execution if the pointer mode is set to device.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+*              \ref rocsparse_direction_row.
+*
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*
+*  @param[in]
+*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
+*
+*  @param[in]
+*  block_dim   the block dimension of the BSR matrix. Between 1 and min(m, n)
+*
+*  @param[in]
+*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the BSR matrix
+*
+*  @param[out]
+*  bsr_nnz     total number of nonzero elements in device or host memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p bsr_nnz
+*              pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2bsr_nnz(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr csr_descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_mat_descr bsr_descr,
+                                       rocsparse_int*            bsr_row_ptr,
+                                       rocsparse_int*            bsr_nnz);
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse BSR matrix
+*
+*  \details
+*  \p rocsparse_csr2bsr converts a CSR matrix into a BSR matrix. It is assumed,
+*  that \p bsr_val, \p bsr_col_ind and \p bsr_row_ptr are allocated. Allocation size
+*  for \p bsr_row_ptr is computed as \p mb+1 where \p mb is the number of block rows in
+*  the BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
+*  \p csr2bsr_nnz() which also fills in \p bsr_row_ptr.
+*
+*  \p rocsparse_csr2bsr requires extra temporary storage that is allocated internally if \p block_dim>16
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  @param[in]
+*  m            number of rows in the sparse CSR matrix.
+*  @param[in]
+*  n            number of columns in the sparse CSR matrix.
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*               sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  block_dim    size of the blocks in the sparse BSR matrix.
+*  @param[in]
+*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_val      array of \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+*  @param[out]
+*  bsr_row_ptr  array of \p mb+1 elements that point to the start of every block row of the
+*               sparse BSR matrix.
+*  @param[out]
+*  bsr_col_ind  array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_val,
+*              \p bsr_row_ptr, \p bsr_col_ind, \p csr_val, \p csr_row_ptr or
+*              \p csr_col_ind pointer is invalid.
+*
+*  \par Example
+*  This example converts a CSR matrix into an BSR matrix.
+*  \code{.c}
+*      //     1 4 0 0 0 0
+*      // A = 0 2 3 0 0 0
+*      //     5 0 0 7 8 0
+*      //     0 0 9 0 6 0
+*
+*      rocsparse_int m   = 4;
+*      rocsparse_int n   = 6;
+*      rocsparse_int block_dim = 2;
+*      rocsparse_int nnz = 9;
+*      rocsparse_int mb = (m + block_dim - 1) / block_dim;
+*      rocsparse_int nb = (n + block_dim - 1) / block_dim;
+*
+*      csr_row_ptr[m+1]  = {0, 2, 4, 7, 9};             // device memory
+*      csr_col_ind[nnz]  = {0, 1, 1, 2, 0, 3, 4, 2, 4}; // device memory
+*      csr_val[nnz]      = {1, 4, 2, 3, 5, 7, 8, 9, 6}; // device memory
+*
+*      hipMalloc(&bsr_row_ptr, sizeof(rocsparse_int) *(mb + 1));
+*      rocsparse_int nnzb;
+*      rocsparse_int* nnzTotalHostPtr = &nnzb;
+*      csr2bsr_nnz(handle,
+*                  rocsparse_direction_row,
+*                  m,
+*                  n,
+*                  csr_descr,
+*                  csr_row_ptr,
+*                  csr_col_ind,
+*                  block_dim,
+*                  bsr_descr,
+*                  bsr_row_ptr,
+*                  nnzTotalHostPtr);
+*      nnzb = *nnzTotalDevHostPtr;
+*      hipMalloc(&bsr_col_ind, sizeof(int)*nnzb);
+*      hipMalloc(&bsr_val, sizeof(float)*(block_dim * block_dim) * nnzb);
+*      scsr2bsr(handle,
+*               rocsparse_direction_row,
+*               m,
+*               n,
+*               csr_descr,
+*               csr_val,
+*               csr_row_ptr,
+*               csr_col_ind,
+*               block_dim,
+*               bsr_descr,
+*               bsr_val,
+*               bsr_row_ptr,
+*               bsr_col_ind);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2bsr(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    float*                    bsr_val,
+                                    rocsparse_int*            bsr_row_ptr,
+                                    rocsparse_int*            bsr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2bsr(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr csr_descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    const rocsparse_mat_descr bsr_descr,
+                                    double*                   bsr_val,
+                                    rocsparse_int*            bsr_row_ptr,
+                                    rocsparse_int*            bsr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2bsr(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_mat_descr      csr_descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_int                  block_dim,
+                                    const rocsparse_mat_descr      bsr_descr,
+                                    rocsparse_float_complex*       bsr_val,
+                                    rocsparse_int*                 bsr_row_ptr,
+                                    rocsparse_int*                 bsr_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2bsr(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_mat_descr       csr_descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_int                   block_dim,
+                                    const rocsparse_mat_descr       bsr_descr,
+                                    rocsparse_double_complex*       bsr_val,
+                                    rocsparse_int*                  bsr_row_ptr,
+                                    rocsparse_int*                  bsr_col_ind);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+ *  \details
+ *  \p rocsparse_csr2gebsr_buffer_size returns the size of the temporary buffer that
+ *  is required by \p rocsparse_csr2gebcsr_nnz,
+ *   \p rocsparse_scsr2gebcsr, \p rocsparse_dcsr2gebsr, \p rocsparse_ccsr2gebsr and \p rocsparse_zcsr2gebsr.
+ *  The temporary storage
+ *  buffer must be allocated by the user.
+ *
+*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
+*  GEneral BSR matrix given a sparse CSR matrix as input.
+*
+*  \details
+*  The routine does support asynchronous execution if the pointer mode is set to device.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+*              \ref rocsparse_direction_row.
+*
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*
+*  @param[in]
+*  csr_row_ptr  integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*
+*  @param[in]
+*  csr_col_ind  integer array of the column indices for each non-zero element in the CSR matrix
+*
+*  @param[in]
+*  row_block_dim   the row block dimension of the GEneral BSR matrix. Between 1 and \p m
+*
+*  @param[in]
+*  col_block_dim   the col block dimension of the GEneral BSR matrix. Between 1 and \p n
+*
+*  @param[out]
+*  p_buffer_size  (host/device) number of bytes of the temporary storage buffer required by \p rocsparse_csr2gebsr_nnz and \p rocsparse_scsr2gebsr.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim  \p col_block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_val or \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p p_buffer_size
+*              pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2gebsr_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_direction       dir,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             row_block_dim,
+                                                  rocsparse_int             col_block_dim,
+                                                  size_t*                   p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2gebsr_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_direction       dir,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr csr_descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             row_block_dim,
+                                                  rocsparse_int             col_block_dim,
+                                                  size_t*                   p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2gebsr_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_direction            dir,
+                                                  rocsparse_int                  m,
+                                                  rocsparse_int                  n,
+                                                  const rocsparse_mat_descr      csr_descr,
+                                                  const rocsparse_float_complex* csr_val,
+                                                  const rocsparse_int*           csr_row_ptr,
+                                                  const rocsparse_int*           csr_col_ind,
+                                                  rocsparse_int                  row_block_dim,
+                                                  rocsparse_int                  col_block_dim,
+                                                  size_t*                        p_buffer_size);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2gebsr_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_direction             dir,
+                                                  rocsparse_int                   m,
+                                                  rocsparse_int                   n,
+                                                  const rocsparse_mat_descr       csr_descr,
+                                                  const rocsparse_double_complex* csr_val,
+                                                  const rocsparse_int*            csr_row_ptr,
+                                                  const rocsparse_int*            csr_col_ind,
+                                                  rocsparse_int                   row_block_dim,
+                                                  rocsparse_int                   col_block_dim,
+                                                  size_t*                         p_buffer_size);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief
+*  This function computes the number of nonzero block columns per row and the total number of nonzero blocks in a sparse
+*  GEneral BSR matrix given a sparse CSR matrix as input.
+*
+*  \details
+*  The routine does support asynchronous execution if the pointer mode is set to device.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  dir         direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+*              \ref rocsparse_direction_row.
+*
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*
+*  @param[in]
+*  n           number of columns of the sparse CSR matrix.
+*
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr integer array containing \p m+1 elements that point to the start of each row of the CSR matrix
+*
+*  @param[in]
+*  csr_col_ind integer array of the column indices for each non-zero element in the CSR matrix
+*
+*  @param[in]
+*  bsr_descr    descriptor of the sparse GEneral BSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_row_ptr integer array containing \p mb+1 elements that point to the start of each block row of the General BSR matrix
+*
+*  @param[in]
+*  row_block_dim   the row block dimension of the GEneral BSR matrix. Between 1 and min(m, n)
+*
+*  @param[in]
+*  col_block_dim   the col block dimension of the GEneral BSR matrix. Between 1 and min(m, n)
+*
+*  @param[out]
+*  bsr_nnz_devhost  total number of nonzero elements in device or host memory.
+*
+*  @param[in]
+*  p_buffer    buffer allocated by the user whose size is determined by calling \p rocsparse_xcsr2gebsr_buffer_size.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim \p col_block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr or \p csr_col_ind or \p bsr_row_ptr or \p bsr_nnz_devhost
+*              pointer is invalid.
+*/
+/**@{*/
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csr2gebsr_nnz(rocsparse_handle          handle,
+                                         rocsparse_direction       dir,
+                                         rocsparse_int             m,
+                                         rocsparse_int             n,
+                                         const rocsparse_mat_descr csr_descr,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_mat_descr bsr_descr,
+                                         rocsparse_int*            bsr_row_ptr,
+                                         rocsparse_int             row_block_dim,
+                                         rocsparse_int             col_block_dim,
+                                         rocsparse_int*            bsr_nnz_devhost,
+                                         void*                     p_buffer);
+/**@}*/
+
+/*! \ingroup conv_module
+*  \brief Convert a sparse CSR matrix into a sparse GEneral BSR matrix
+*
+*  \details
+*  \p rocsparse_csr2gebsr converts a CSR matrix into a GEneral BSR matrix. It is assumed,
+*  that \p bsr_val, \p bsr_col_ind and \p bsr_row_ptr are allocated. Allocation size
+*  for \p bsr_row_ptr is computed as \p mb+1 where \p mb is the number of block rows in
+*  the GEneral BSR matrix. Allocation size for \p bsr_val and \p bsr_col_ind is computed using
+*  \p csr2gebsr_nnz() which also fills in \p bsr_row_ptr.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  dir          the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  @param[in]
+*  m            number of rows in the sparse CSR matrix.
+*  @param[in]
+*  n            number of columns in the sparse CSR matrix.
+*  @param[in]
+*  csr_descr    descriptor of the sparse CSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val      array of \p nnz elements containing the values of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr  array of \p m+1 elements that point to the start of every row of the
+*               sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind  array of \p nnz elements containing the column indices of the sparse CSR matrix.
+*  @param[in]
+*  bsr_descr    descriptor of the sparse BSR matrix. Currently, only
+*               \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_val      array of \p nnzb* \p row_block_dim*\p col_block_dim containing the values of the sparse BSR matrix.
+*  @param[out]
+*  bsr_row_ptr  array of \p mb+1 elements that point to the start of every block row of the
+*               sparse BSR matrix.
+*  @param[out]
+*  bsr_col_ind  array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+*  @param[in]
+*  row_block_dim    row size of the blocks in the sparse GEneral BSR matrix.
+*  @param[in]
+*  col_block_dim    col size of the blocks in the sparse GEneral BSR matrix.
+*  @param[in]
+*  p_buffer    buffer allocated by the user whose size is determined by calling \p rocsparse_xcsr2gebsr_buffer_size.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p n or \p row_block_dim or \p col_block_dim is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_val,
+*              \p bsr_row_ptr, \p bsr_col_ind, \p csr_val, \p csr_row_ptr or
+*              \p csr_col_ind pointer is invalid.
+*
+*  \par Example
+*  This example converts a CSR matrix into an BSR matrix.
+*  \code{.c}
+*      //     1 4 0 0 0 0
+*      // A = 0 2 3 0 0 0
+*      //     5 0 0 7 8 0
+*      //     0 0 9 0 6 0
+*
+*      rocsparse_int m   = 4;
+*      rocsparse_int n   = 6;
+*      rocsparse_int row_block_dim = 2;
+*      rocsparse_int col_block_dim = 3;
+*      rocsparse_int nnz = 9;
+*      rocsparse_int mb = (m + row_block_dim - 1) / row_block_dim;
+*      rocsparse_int nb = (n + col_block_dim - 1) / col_block_dim;
+*
+*      csr_row_ptr[m+1]  = {0, 2, 4, 7, 9};             // device memory
+*      csr_col_ind[nnz]  = {0, 1, 1, 2, 0, 3, 4, 2, 4}; // device memory
+*      csr_val[nnz]      = {1, 4, 2, 3, 5, 7, 8, 9, 6}; // device memory
+*
+*      hipMalloc(&bsr_row_ptr, sizeof(rocsparse_int) *(mb + 1));
+*      rocsparse_int nnzb;
+*      rocsparse_int* nnzTotalHostPtr = &nnzb;
+*      csr2gebsr_nnz(handle,
+*                  rocsparse_direction_row,
+*                  m,
+*                  n,
 *                  csr_descr,
 *                  csr_row_ptr,
 *                  csr_col_ind,
@@ -14179,425 +16596,775 @@ rocsparse_status rocsparse_zgebsr2gebsr_buffer_size(rocsparse_handle
                                                     size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup conv_module
-*  \brief This function is used when converting a general BSR sparse matrix \p A to another general BSR sparse matrix \p C.
-*  Specifically, this function determines the number of non-zero blocks that will exist in \p C (stored using either a host
-*  or device pointer), and computes the row pointer array for \p C.
+/*! \ingroup conv_module
+*  \brief This function is used when converting a general BSR sparse matrix \p A to another general BSR sparse matrix \p C.
+*  Specifically, this function determines the number of non-zero blocks that will exist in \p C (stored using either a host
+*  or device pointer), and computes the row pointer array for \p C.
+*
+*  \details
+*  The routine does support asynchronous execution.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  dir         the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*
+*  @param[in]
+*  mb           number of block rows of the general BSR sparse matrix \p A.
+*
+*  @param[in]
+*  nb           number of block columns of the general BSR sparse matrix \p A.
+*
+*  @param[in]
+*  nnzb         number of blocks in the general BSR sparse matrix \p A.
+*
+*  @param[in]
+*  descr_A      the descriptor of the general BSR sparse matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  bsr_row_ptr_A array of \p mb+1 elements that point to the start of every block row of the
+*              sparse general BSR matrix \p A.
+*  @param[in]
+*  bsr_col_ind_A array of \p nnzb elements containing the block column indices of the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  row_block_dim_A   row size of the blocks in the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  col_block_dim_A   column size of the blocks in the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  descr_C      the descriptor of the general BSR sparse matrix \p C, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  bsr_row_ptr_C array of \p mb_C+1 elements that point to the start of every block row of the
+*              sparse general BSR matrix \p C where \p mb_C=(m+row_block_dim_C-1)/row_block_dim_C.
+*  @param[in]
+*  row_block_dim_C   row size of the blocks in the sparse general BSR matrix \p C.
+*
+*  @param[in]
+*  col_block_dim_C   column size of the blocks in the sparse general BSR matrix \p C.
+*
+*  @param[out]
+*  nnz_total_dev_host_ptr
+*              total number of nonzero blocks in general BSR sparse matrix \p C stored using device or host memory.
+*
+*  @param[out]
+*  temp_buffer
+*              buffer allocated by the user whose size is determined by calling rocsparse_xgebsr2gebsr_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb or \p nb or \p nnzb or \p row_block_dim_A or
+*              \p col_block_dim_A or \p row_block_dim_C or \p col_block_dim_C is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr_A or \p bsr_col_ind_A
+*              or \p bsr_row_ptr_C or \p descr_A or \p descr_C or \p temp_buffer pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_gebsr2gebsr_nnz(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nb,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr_A,
+                                           const rocsparse_int*      bsr_row_ptr_A,
+                                           const rocsparse_int*      bsr_col_ind_A,
+                                           rocsparse_int             row_block_dim_A,
+                                           rocsparse_int             col_block_dim_A,
+                                           const rocsparse_mat_descr descr_C,
+                                           rocsparse_int*            bsr_row_ptr_C,
+                                           rocsparse_int             row_block_dim_C,
+                                           rocsparse_int             col_block_dim_C,
+                                           rocsparse_int*            nnz_total_dev_host_ptr,
+                                           void*                     temp_buffer);
+
+/*! \ingroup conv_module
+*  \brief
+*  This function converts the general BSR sparse matrix \p A to another general BSR sparse matrix \p C.
+*
+*  \details
+*  The conversion uses three steps. First, the user calls rocsparse_xgebsr2gebsr_buffer_size() to determine the size of
+*  the required temporary storage buffer. The user then allocates this buffer. Secondly, the user then allocates \p mb_C+1
+*  integers for the row pointer array for \p C where \p mb_C=(m+row_block_dim_C-1)/row_block_dim_C. The user then calls
+*  rocsparse_xgebsr2gebsr_nnz() to fill in the row pointer array for \p C ( \p bsr_row_ptr_C ) and determine the number of
+*  non-zero blocks that will exist in \p C. Finally, the user allocates space for the colimn indices array of \p C to have
+*  \p nnzb_C elements and space for the values array of \p C to have \p nnzb_C*roc_block_dim_C*col_block_dim_C and then calls
+*  rocsparse_xgebsr2gebsr() to complete the conversion.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*
+*  @param[in]
+*  dir         the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*
+*  @param[in]
+*  mb           number of block rows of the general BSR sparse matrix \p A.
+*
+*  @param[in]
+*  nb           number of block columns of the general BSR sparse matrix \p A.
+*
+*  @param[in]
+*  nnzb         number of blocks in the general BSR sparse matrix \p A.
+*
+*  @param[in]
+*  descr_A      the descriptor of the general BSR sparse matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  bsr_val_A    array of \p nnzb*row_block_dim_A*col_block_dim_A containing the values of the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  bsr_row_ptr_A array of \p mb+1 elements that point to the start of every block row of the
+*              sparse general BSR matrix \p A.
+*  @param[in]
+*  bsr_col_ind_A array of \p nnzb elements containing the block column indices of the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  row_block_dim_A   row size of the blocks in the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  col_block_dim_A   column size of the blocks in the sparse general BSR matrix \p A.
+*
+*  @param[in]
+*  descr_C      the descriptor of the general BSR sparse matrix \p C, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*
+*  @param[in]
+*  bsr_val_C    array of \p nnzb_C*row_block_dim_C*col_block_dim_C containing the values of the sparse general BSR matrix \p C.
+*
+*  @param[in]
+*  bsr_row_ptr_C array of \p mb_C+1 elements that point to the start of every block row of the
+*              sparse general BSR matrix \p C.
+*  @param[in]
+*  bsr_col_ind_C array of \p nnzb_C elements containing the block column indices of the sparse general BSR matrix \p C.
+*
+*  @param[in]
+*  row_block_dim_C   row size of the blocks in the sparse general BSR matrix \p C.
+*
+*  @param[in]
+*  col_block_dim_C   column size of the blocks in the sparse general BSR matrix \p C.
+*
+*  @param[out]
+*  temp_buffer
+*              buffer allocated by the user whose size is determined by calling rocsparse_xgebsr2gebsr_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p mb or \p nb or \p nnzb or \p row_block_dim_A or
+*              \p col_block_dim_A or \p row_block_dim_C or \p col_block_dim_C is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr_A or \p bsr_col_ind_A or \p bsr_val_A
+*              or \p bsr_row_ptr_C or \p bsr_col_ind_C or \p bsr_val_C or \p descr_A or \p descr_C
+*              or \p temp_buffer pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgebsr2gebsr(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nb,
+                                        rocsparse_int             nnzb,
+                                        const rocsparse_mat_descr descr_A,
+                                        const float*              bsr_val_A,
+                                        const rocsparse_int*      bsr_row_ptr_A,
+                                        const rocsparse_int*      bsr_col_ind_A,
+                                        rocsparse_int             row_block_dim_A,
+                                        rocsparse_int             col_block_dim_A,
+                                        const rocsparse_mat_descr descr_C,
+                                        float*                    bsr_val_C,
+                                        rocsparse_int*            bsr_row_ptr_C,
+                                        rocsparse_int*            bsr_col_ind_C,
+                                        rocsparse_int             row_block_dim_C,
+                                        rocsparse_int             col_block_dim_C,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgebsr2gebsr(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nb,
+                                        rocsparse_int             nnzb,
+                                        const rocsparse_mat_descr descr_A,
+                                        const double*             bsr_val_A,
+                                        const rocsparse_int*      bsr_row_ptr_A,
+                                        const rocsparse_int*      bsr_col_ind_A,
+                                        rocsparse_int             row_block_dim_A,
+                                        rocsparse_int             col_block_dim_A,
+                                        const rocsparse_mat_descr descr_C,
+                                        double*                   bsr_val_C,
+                                        rocsparse_int*            bsr_row_ptr_C,
+                                        rocsparse_int*            bsr_col_ind_C,
+                                        rocsparse_int             row_block_dim_C,
+                                        rocsparse_int             col_block_dim_C,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgebsr2gebsr(rocsparse_handle               handle,
+                                        rocsparse_direction            dir,
+                                        rocsparse_int                  mb,
+                                        rocsparse_int                  nb,
+                                        rocsparse_int                  nnzb,
+                                        const rocsparse_mat_descr      descr_A,
+                                        const rocsparse_float_complex* bsr_val_A,
+                                        const rocsparse_int*           bsr_row_ptr_A,
+                                        const rocsparse_int*           bsr_col_ind_A,
+                                        rocsparse_int                  row_block_dim_A,
+                                        rocsparse_int                  col_block_dim_A,
+                                        const rocsparse_mat_descr      descr_C,
+                                        rocsparse_float_complex*       bsr_val_C,
+                                        rocsparse_int*                 bsr_row_ptr_C,
+                                        rocsparse_int*                 bsr_col_ind_C,
+                                        rocsparse_int                  row_block_dim_C,
+                                        rocsparse_int                  col_block_dim_C,
+                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgebsr2gebsr(rocsparse_handle                handle,
+                                        rocsparse_direction             dir,
+                                        rocsparse_int                   mb,
+                                        rocsparse_int                   nb,
+                                        rocsparse_int                   nnzb,
+                                        const rocsparse_mat_descr       descr_A,
+                                        const rocsparse_double_complex* bsr_val_A,
+                                        const rocsparse_int*            bsr_row_ptr_A,
+                                        const rocsparse_int*            bsr_col_ind_A,
+                                        rocsparse_int                   row_block_dim_A,
+                                        rocsparse_int                   col_block_dim_A,
+                                        const rocsparse_mat_descr       descr_C,
+                                        rocsparse_double_complex*       bsr_val_C,
+                                        rocsparse_int*                  bsr_row_ptr_C,
+                                        rocsparse_int*                  bsr_col_ind_C,
+                                        rocsparse_int                   row_block_dim_C,
+                                        rocsparse_int                   col_block_dim_C,
+                                        void*                           temp_buffer);
+/**@}*/
+
+/*
+* ===========================================================================
+*    generic SPARSE
+* ===========================================================================
+*/
+
+/*! \ingroup generic_module
+*  \brief Scale a sparse vector and add it to a scaled dense vector.
 *
 *  \details
-*  The routine does support asynchronous execution.
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  \ref rocsparse_axpby multiplies the sparse vector \f$x\f$ with scalar \f$\alpha\f$ and
+*  adds the result to the dense vector \f$y\f$ that is multiplied with scalar
+*  \f$\beta\f$, such that
 *
-*  @param[in]
-*  dir         the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
+*  \f[
+*      y := \alpha \cdot x + \beta \cdot y
+*  \f]
 *
-*  @param[in]
-*  mb           number of block rows of the general BSR sparse matrix \p A.
+*  \code{.c}
+*      for(i = 0; i < nnz; ++i)
+*      {
+*          y[x_ind[i]] = alpha * x_val[i] + beta * y[x_ind[i]]
+*      }
+*  \endcode
 *
-*  @param[in]
-*  nb           number of block columns of the general BSR sparse matrix \p A.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  nnzb         number of blocks in the general BSR sparse matrix \p A.
-*
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  descr_A      the descriptor of the general BSR sparse matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
-*
+*  alpha       scalar \f$\alpha\f$.
 *  @param[in]
-*  bsr_row_ptr_A array of \p mb+1 elements that point to the start of every block row of the
-*              sparse general BSR matrix \p A.
+*  x           sparse matrix descriptor.
 *  @param[in]
-*  bsr_col_ind_A array of \p nnzb elements containing the block column indices of the sparse general BSR matrix \p A.
+*  beta        scalar \f$\beta\f$.
+*  @param[inout]
+*  y           dense matrix descriptor.
 *
-*  @param[in]
-*  row_block_dim_A   row size of the blocks in the sparse general BSR matrix \p A.
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p x, \p beta or \p y pointer is
+*          invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_axpby(rocsparse_handle            handle,
+                                 const void*                 alpha,
+                                 const rocsparse_spvec_descr x,
+                                 const void*                 beta,
+                                 rocsparse_dnvec_descr       y);
+
+/*! \ingroup generic_module
+*  \brief Gather elements from a dense vector and store them into a sparse vector.
 *
-*  @param[in]
-*  col_block_dim_A   column size of the blocks in the sparse general BSR matrix \p A.
+*  \details
+*  \ref rocsparse_gather gathers the elements from the dense vector \f$y\f$ and stores
+*  them in the sparse vector \f$x\f$.
 *
-*  @param[in]
-*  descr_C      the descriptor of the general BSR sparse matrix \p C, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*  \code{.c}
+*      for(i = 0; i < nnz; ++i)
+*      {
+*          x_val[i] = y[x_ind[i]];
+*      }
+*  \endcode
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  bsr_row_ptr_C array of \p mb_C+1 elements that point to the start of every block row of the
-*              sparse general BSR matrix \p C where \p mb_C=(m+row_block_dim_C-1)/row_block_dim_C.
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  row_block_dim_C   row size of the blocks in the sparse general BSR matrix \p C.
+*  y            dense vector \f$y\f$.
+*  @param[out]
+*  x            sparse vector \f$x\f$.
 *
-*  @param[in]
-*  col_block_dim_C   column size of the blocks in the sparse general BSR matrix \p C.
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p x or \p y pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_gather(rocsparse_handle            handle,
+                                  const rocsparse_dnvec_descr y,
+                                  rocsparse_spvec_descr       x);
+
+/*! \ingroup generic_module
+*  \brief Scatter elements from a sparse vector into a dense vector.
 *
-*  @param[out]
-*  nnz_total_dev_host_ptr
-*              total number of nonzero blocks in general BSR sparse matrix \p C stored using device or host memory.
+*  \details
+*  \ref rocsparse_scatter scatters the elements from the sparse vector \f$x\f$ in the dense
+*  vector \f$y\f$.
+*
+*  \code{.c}
+*      for(i = 0; i < nnz; ++i)
+*      {
+*          y[x_ind[i]] = x_val[i];
+*      }
+*  \endcode
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  x            sparse vector \f$x\f$.
 *  @param[out]
-*  temp_buffer
-*              buffer allocated by the user whose size is determined by calling rocsparse_xgebsr2gebsr_buffer_size().
+*  y            dense vector \f$y\f$.
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p mb or \p nb or \p nnzb or \p row_block_dim_A or
-*              \p col_block_dim_A or \p row_block_dim_C or \p col_block_dim_C is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr_A or \p bsr_col_ind_A
-*              or \p bsr_row_ptr_C or \p descr_A or \p descr_C or \p temp_buffer pointer is invalid.
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p x or \p y pointer is invalid.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_gebsr2gebsr_nnz(rocsparse_handle          handle,
-                                           rocsparse_direction       dir,
-                                           rocsparse_int             mb,
-                                           rocsparse_int             nb,
-                                           rocsparse_int             nnzb,
-                                           const rocsparse_mat_descr descr_A,
-                                           const rocsparse_int*      bsr_row_ptr_A,
-                                           const rocsparse_int*      bsr_col_ind_A,
-                                           rocsparse_int             row_block_dim_A,
-                                           rocsparse_int             col_block_dim_A,
-                                           const rocsparse_mat_descr descr_C,
-                                           rocsparse_int*            bsr_row_ptr_C,
-                                           rocsparse_int             row_block_dim_C,
-                                           rocsparse_int             col_block_dim_C,
-                                           rocsparse_int*            nnz_total_dev_host_ptr,
-                                           void*                     temp_buffer);
+rocsparse_status rocsparse_scatter(rocsparse_handle            handle,
+                                   const rocsparse_spvec_descr x,
+                                   rocsparse_dnvec_descr       y);
 
-/*! \ingroup conv_module
-*  \brief
-*  This function converts the general BSR sparse matrix \p A to another general BSR sparse matrix \p C.
+/*! \ingroup generic_module
+*  \brief Apply Givens rotation to a dense and a sparse vector.
 *
 *  \details
-*  The conversion uses three steps. First, the user calls rocsparse_xgebsr2gebsr_buffer_size() to determine the size of
-*  the required temporary storage buffer. The user then allocates this buffer. Secondly, the user then allocates \p mb_C+1
-*  integers for the row pointer array for \p C where \p mb_C=(m+row_block_dim_C-1)/row_block_dim_C. The user then calls
-*  rocsparse_xgebsr2gebsr_nnz() to fill in the row pointer array for \p C ( \p bsr_row_ptr_C ) and determine the number of
-*  non-zero blocks that will exist in \p C. Finally, the user allocates space for the colimn indices array of \p C to have
-*  \p nnzb_C elements and space for the values array of \p C to have \p nnzb_C*roc_block_dim_C*col_block_dim_C and then calls
-*  rocsparse_xgebsr2gebsr() to complete the conversion.
+*  \ref rocsparse_rot applies the Givens rotation matrix \f$G\f$ to the sparse vector
+*  \f$x\f$ and the dense vector \f$y\f$, where
+*  \f[
+*    G = \begin{pmatrix} c & s \\ -s & c \end{pmatrix}
+*  \f]
+*
+*  \code{.c}
+*      for(i = 0; i < nnz; ++i)
+*      {
+*          x_tmp = x_val[i];
+*          y_tmp = y[x_ind[i]];
+*
+*          x_val[i]    = c * x_tmp + s * y_tmp;
+*          y[x_ind[i]] = c * y_tmp - s * x_tmp;
+*      }
+*  \endcode
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
-*
 *  @param[in]
-*  dir         the storage format of the blocks, \ref rocsparse_direction_row or \ref rocsparse_direction_column
-*
+*  c           pointer to the cosine element of \f$G\f$, can be on host or device.
 *  @param[in]
-*  mb           number of block rows of the general BSR sparse matrix \p A.
+*  s           pointer to the sine element of \f$G\f$, can be on host or device.
+*  @param[inout]
+*  x           sparse vector \f$x\f$.
+*  @param[inout]
+*  y           dense vector \f$y\f$.
 *
-*  @param[in]
-*  nb           number of block columns of the general BSR sparse matrix \p A.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x or \p y pointer is
+*              invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_rot(rocsparse_handle      handle,
+                               const void*           c,
+                               const void*           s,
+                               rocsparse_spvec_descr x,
+                               rocsparse_dnvec_descr y);
+
+/*! \ingroup generic_module
+*  \brief Sparse matrix to dense matrix conversion
 *
-*  @param[in]
-*  nnzb         number of blocks in the general BSR sparse matrix \p A.
+*  \details
+*  \p rocsparse_sparse_to_dense
+*  \p rocsparse_sparse_to_dense performs the conversion of a sparse matrix in CSR, CSC, COO or BSR format
+*     to a dense matrix
+*  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the sparse to dense operation, when a nullptr is passed for
+*  \p temp_buffer.
 *
-*  @param[in]
-*  descr_A      the descriptor of the general BSR sparse matrix \p A, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  bsr_val_A    array of \p nnzb*row_block_dim_A*col_block_dim_A containing the values of the sparse general BSR matrix \p A.
-*
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  bsr_row_ptr_A array of \p mb+1 elements that point to the start of every block row of the
-*              sparse general BSR matrix \p A.
+*  mat_A        sparse matrix descriptor.
 *  @param[in]
-*  bsr_col_ind_A array of \p nnzb elements containing the block column indices of the sparse general BSR matrix \p A.
-*
+*  mat_B        dense matrix descriptor.
 *  @param[in]
-*  row_block_dim_A   row size of the blocks in the sparse general BSR matrix \p A.
+*  alg          algorithm for the sparse to dense computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the sparse to dense operation.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p mat_A, \p mat_B, or \p buffer_size
+*               pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sparse_to_dense(rocsparse_handle              handle,
+                                           const rocsparse_spmat_descr   mat_A,
+                                           rocsparse_dnmat_descr         mat_B,
+                                           rocsparse_sparse_to_dense_alg alg,
+                                           size_t*                       buffer_size,
+                                           void*                         temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Dense matrix to sparse matrix conversion
 *
-*  @param[in]
-*  col_block_dim_A   column size of the blocks in the sparse general BSR matrix \p A.
+*  \details
+*  \p rocsparse_dense_to_sparse
+*  \p rocsparse_dense_to_sparse performs the conversion of a dense matrix to a sparse matrix in CSR, CSC, or COO format.
 *
-*  @param[in]
-*  descr_C      the descriptor of the general BSR sparse matrix \p C, the supported matrix type is rocsparse_matrix_type_general and also any valid value of the \ref rocsparse_index_base.
+*  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the dense to sparse operation, when a nullptr is passed for
+*  \p temp_buffer.
 *
-*  @param[in]
-*  bsr_val_C    array of \p nnzb_C*row_block_dim_C*col_block_dim_C containing the values of the sparse general BSR matrix \p C.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  bsr_row_ptr_C array of \p mb_C+1 elements that point to the start of every block row of the
-*              sparse general BSR matrix \p C.
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  bsr_col_ind_C array of \p nnzb_C elements containing the block column indices of the sparse general BSR matrix \p C.
-*
+*  mat_A        dense matrix descriptor.
 *  @param[in]
-*  row_block_dim_C   row size of the blocks in the sparse general BSR matrix \p C.
-*
+*  mat_B        sparse matrix descriptor.
 *  @param[in]
-*  col_block_dim_C   column size of the blocks in the sparse general BSR matrix \p C.
-*
+*  alg          algorithm for the sparse to dense computation.
 *  @param[out]
-*  temp_buffer
-*              buffer allocated by the user whose size is determined by calling rocsparse_xgebsr2gebsr_buffer_size().
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the dense to sparse operation.
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p mb or \p nb or \p nnzb or \p row_block_dim_A or
-*              \p col_block_dim_A or \p row_block_dim_C or \p col_block_dim_C is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p bsr_row_ptr_A or \p bsr_col_ind_A or \p bsr_val_A
-*              or \p bsr_row_ptr_C or \p bsr_col_ind_C or \p bsr_val_C or \p descr_A or \p descr_C
-*              or \p temp_buffer pointer is invalid.
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p mat_A, \p mat_B, or \p buffer_size
+*               pointer is invalid.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgebsr2gebsr(rocsparse_handle          handle,
-                                        rocsparse_direction       dir,
-                                        rocsparse_int             mb,
-                                        rocsparse_int             nb,
-                                        rocsparse_int             nnzb,
-                                        const rocsparse_mat_descr descr_A,
-                                        const float*              bsr_val_A,
-                                        const rocsparse_int*      bsr_row_ptr_A,
-                                        const rocsparse_int*      bsr_col_ind_A,
-                                        rocsparse_int             row_block_dim_A,
-                                        rocsparse_int             col_block_dim_A,
-                                        const rocsparse_mat_descr descr_C,
-                                        float*                    bsr_val_C,
-                                        rocsparse_int*            bsr_row_ptr_C,
-                                        rocsparse_int*            bsr_col_ind_C,
-                                        rocsparse_int             row_block_dim_C,
-                                        rocsparse_int             col_block_dim_C,
-                                        void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgebsr2gebsr(rocsparse_handle          handle,
-                                        rocsparse_direction       dir,
-                                        rocsparse_int             mb,
-                                        rocsparse_int             nb,
-                                        rocsparse_int             nnzb,
-                                        const rocsparse_mat_descr descr_A,
-                                        const double*             bsr_val_A,
-                                        const rocsparse_int*      bsr_row_ptr_A,
-                                        const rocsparse_int*      bsr_col_ind_A,
-                                        rocsparse_int             row_block_dim_A,
-                                        rocsparse_int             col_block_dim_A,
-                                        const rocsparse_mat_descr descr_C,
-                                        double*                   bsr_val_C,
-                                        rocsparse_int*            bsr_row_ptr_C,
-                                        rocsparse_int*            bsr_col_ind_C,
-                                        rocsparse_int             row_block_dim_C,
-                                        rocsparse_int             col_block_dim_C,
-                                        void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgebsr2gebsr(rocsparse_handle               handle,
-                                        rocsparse_direction            dir,
-                                        rocsparse_int                  mb,
-                                        rocsparse_int                  nb,
-                                        rocsparse_int                  nnzb,
-                                        const rocsparse_mat_descr      descr_A,
-                                        const rocsparse_float_complex* bsr_val_A,
-                                        const rocsparse_int*           bsr_row_ptr_A,
-                                        const rocsparse_int*           bsr_col_ind_A,
-                                        rocsparse_int                  row_block_dim_A,
-                                        rocsparse_int                  col_block_dim_A,
-                                        const rocsparse_mat_descr      descr_C,
-                                        rocsparse_float_complex*       bsr_val_C,
-                                        rocsparse_int*                 bsr_row_ptr_C,
-                                        rocsparse_int*                 bsr_col_ind_C,
-                                        rocsparse_int                  row_block_dim_C,
-                                        rocsparse_int                  col_block_dim_C,
-                                        void*                          temp_buffer);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgebsr2gebsr(rocsparse_handle                handle,
-                                        rocsparse_direction             dir,
-                                        rocsparse_int                   mb,
-                                        rocsparse_int                   nb,
-                                        rocsparse_int                   nnzb,
-                                        const rocsparse_mat_descr       descr_A,
-                                        const rocsparse_double_complex* bsr_val_A,
-                                        const rocsparse_int*            bsr_row_ptr_A,
-                                        const rocsparse_int*            bsr_col_ind_A,
-                                        rocsparse_int                   row_block_dim_A,
-                                        rocsparse_int                   col_block_dim_A,
-                                        const rocsparse_mat_descr       descr_C,
-                                        rocsparse_double_complex*       bsr_val_C,
-                                        rocsparse_int*                  bsr_row_ptr_C,
-                                        rocsparse_int*                  bsr_col_ind_C,
-                                        rocsparse_int                   row_block_dim_C,
-                                        rocsparse_int                   col_block_dim_C,
-                                        void*                           temp_buffer);
-/**@}*/
-
-/*
-* ===========================================================================
-*    generic SPARSE
-* ===========================================================================
-*/
+rocsparse_status rocsparse_dense_to_sparse(rocsparse_handle              handle,
+                                           const rocsparse_dnmat_descr   mat_A,
+                                           rocsparse_spmat_descr         mat_B,
+                                           rocsparse_dense_to_sparse_alg alg,
+                                           size_t*                       buffer_size,
+                                           void*                         temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Scale a sparse vector and add it to a scaled dense vector.
+*  \brief Sparse vector inner dot product
 *
 *  \details
-*  \ref rocsparse_axpby multiplies the sparse vector \f$x\f$ with scalar \f$\alpha\f$ and
-*  adds the result to the dense vector \f$y\f$ that is multiplied with scalar
-*  \f$\beta\f$, such that
-*
+*  \ref rocsparse_spvv computes the inner dot product of the sparse vecotr \f$x\f$ with the
+*  dense vector \f$y\f$, such that
 *  \f[
-*      y := \alpha \cdot x + \beta \cdot y
+*    \text{result} := x^{'} \cdot y,
+*  \f]
+*  with
+*  \f[
+*    op(x) = \left\{
+*    \begin{array}{ll}
+*        x,   & \text{if trans == rocsparse_operation_none} \\
+*        \bar{x}, & \text{if trans == rocsparse_operation_conjugate_transpose} \\
+*    \end{array}
+*    \right.
 *  \f]
 *
 *  \code{.c}
+*      result = 0;
 *      for(i = 0; i < nnz; ++i)
 *      {
-*          y[x_ind[i]] = alpha * x_val[i] + beta * y[x_ind[i]]
+*          result += x_val[i] * y[x_ind[i]];
 *      }
 *  \endcode
 *
 *  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the SpVV operation, when a nullptr is passed for
+*  \p temp_buffer.
+*
+*  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  alpha       scalar \f$\alpha\f$.
+*  trans        sparse vector operation type.
 *  @param[in]
-*  x           sparse matrix descriptor.
+*  x            sparse vector descriptor.
 *  @param[in]
-*  beta        scalar \f$\beta\f$.
-*  @param[inout]
-*  y           dense matrix descriptor.
+*  y            dense vector descriptor.
+*  @param[out]
+*  result       pointer to the result, can be host or device memory
+*  @param[in]
+*  compute_type floating point precision for the SpVV computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the SpVV operation.
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_pointer \p alpha, \p x, \p beta or \p y pointer is
-*          invalid.
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p x, \p y, \p result or \p buffer_size
+*               pointer is invalid.
+*  \retval      rocsparse_status_not_implemented \p compute_type is currently not
+*               supported.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_axpby(rocsparse_handle            handle,
-                                 const void*                 alpha,
-                                 const rocsparse_spvec_descr x,
-                                 const void*                 beta,
-                                 rocsparse_dnvec_descr       y);
+rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
+                                rocsparse_operation         trans,
+                                const rocsparse_spvec_descr x,
+                                const rocsparse_dnvec_descr y,
+                                void*                       result,
+                                rocsparse_datatype          compute_type,
+                                size_t*                     buffer_size,
+                                void*                       temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Gather elements from a dense vector and store them into a sparse vector.
+*  \brief Sparse matrix vector multiplication
 *
 *  \details
-*  \ref rocsparse_gather gathers the elements from the dense vector \f$y\f$ and stores
-*  them in the sparse vector \f$x\f$.
+*  \ref rocsparse_spmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+*  matrix and the dense vector \f$x\f$ and adds the result to the dense vector \f$y\f$
+*  that is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans == rocsparse_operation_none} \\
+*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
 *
-*  \code{.c}
-*      for(i = 0; i < nnz; ++i)
-*      {
-*          x_val[i] = y[x_ind[i]];
-*      }
-*  \endcode
+*  \note
+*  This function writes the required allocation size (in bytes) to \p buffer_size and
+*  returns without performing the SpMV operation, when a nullptr is passed for
+*  \p temp_buffer.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, \p trans != \ref rocsparse_operation_none is only supported for COO, COO (AoS),
+*  CSR and CSC formats. For CSC format, \p trans == \ref rocsparse_operation_conjugate_transpose
+*  is not supported.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  For BSR format, only 32 bit indices and \p trans == \ref rocsparse_operation_none are
+*  supported.
 *
-*  @param[in]
-*  handle       handle to the rocsparse library context queue.
-*  @param[in]
-*  y            dense vector \f$y\f$.
-*  @param[out]
-*  x            sparse vector \f$x\f$.
+*  \note
+*  A SELL-C-sigma matrix can be obtained from a CSR matrix with rocsparse_csr2sell_nnz()
+*  and rocsparse_csr2sell().
 *
-*  \retval      rocsparse_status_success the operation completed successfully.
-*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p x or \p y pointer is invalid.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_gather(rocsparse_handle            handle,
-                                  const rocsparse_dnvec_descr y,
-                                  rocsparse_spvec_descr       x);
-
-/*! \ingroup generic_module
-*  \brief Scatter elements from a sparse vector into a dense vector.
+*  \note
+*  For CSR format, symmetric and Hermitian matrices that only store the triangular part
+*  selected by the \ref rocsparse_fill_mode are supported. The matrix type and fill mode
+*  can be set with rocsparse_spmat_set_attribute().
 *
-*  \details
-*  \ref rocsparse_scatter scatters the elements from the sparse vector \f$x\f$ in the dense
-*  vector \f$y\f$.
+*  \note
+*  \ref rocsparse_spmv_alg_csr_merge splits the rows and non-zeros of the CSR matrix evenly
+*  across the workgroups, such that the performance does not depend on the distribution
+*  of the row lengths. For \p trans != \ref rocsparse_operation_none, the stream algorithm
+*  is used instead.
 *
-*  \code{.c}
-*      for(i = 0; i < nnz; ++i)
-*      {
-*          y[x_ind[i]] = x_val[i];
-*      }
-*  \endcode
+*  \note
+*  For CSR and CSC formats, \ref rocsparse_spmv_alg_auto times the stream, adaptive and
+*  merge path algorithms on the actual matrix when the buffer size is queried, i.e.
+*  \p temp_buffer is \p nullptr, and stores the fastest algorithm in the sparse matrix
+*  descriptor. The query blocks the host and requires valid \p x and \p y, which are
+*  left unchanged. The computation runs the stored algorithm without blocking the host,
+*  as long as \p trans, the data types of \p x and \p y, the pointer mode and, in host
+*  pointer mode, whether \p beta is zero are unchanged. The values and addresses of
+*  \p alpha and \p beta do not affect the selection. If these parameters have changed,
+*  or the matrix arrays have been replaced with rocsparse_csr_set_pointers() or
+*  rocsparse_csc_set_pointers(), the computation runs
+*  \ref rocsparse_spmv_alg_csr_stream until the buffer size is queried again. For all
+*  other formats, \ref rocsparse_spmv_alg_auto selects the only available algorithm.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  For CSR and CSC formats, the sparse matrix and the vector \p x can be stored in a lower
+*  precision than the \p compute_type. The vector \p y and the scalars \p alpha and
+*  \p beta are always of \p compute_type. The supported combinations of matrix, \p x and
+*  \p compute_type precisions are (\ref rocsparse_datatype_i8_r,
+*  \ref rocsparse_datatype_i8_r, \ref rocsparse_datatype_f32_r),
+*  (\ref rocsparse_datatype_i8_r, \ref rocsparse_datatype_f32_r,
+*  \ref rocsparse_datatype_f32_r), (\ref rocsparse_datatype_f32_r,
+*  \ref rocsparse_datatype_f64_r, \ref rocsparse_datatype_f64_r) and
+*  (\ref rocsparse_datatype_f32_c, \ref rocsparse_datatype_f64_c,
+*  \ref rocsparse_datatype_f64_c). Furthermore, a \ref rocsparse_datatype_f16_r or
+*  \ref rocsparse_datatype_bf16_r matrix can be used with \p x of the same precision or
+*  of \ref rocsparse_datatype_f32_r and \p compute_type \ref rocsparse_datatype_f32_r.
 *
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  x            sparse vector \f$x\f$.
+*  trans        matrix operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  y            vector descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpMV computation. This is also the
+*               precision of \p y.
+*  @param[in]
+*  alg          SpMV algorithm for the SpMV computation.
 *  @param[out]
-*  y            dense vector \f$y\f$.
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the SpMV operation.
 *
 *  \retval      rocsparse_status_success the operation completed successfully.
 *  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p x or \p y pointer is invalid.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta, \p y or
+*               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type or \p alg is
+*               currently not supported.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scatter(rocsparse_handle            handle,
-                                   const rocsparse_spvec_descr x,
-                                   rocsparse_dnvec_descr       y);
+rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
+                                rocsparse_operation         trans,
+                                const void*                 alpha,
+                                const rocsparse_spmat_descr mat,
+                                const rocsparse_dnvec_descr x,
+                                const void*                 beta,
+                                const rocsparse_dnvec_descr y,
+                                rocsparse_datatype          compute_type,
+                                rocsparse_spmv_alg          alg,
+                                size_t*                     buffer_size,
+                                void*                       temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Apply Givens rotation to a dense and a sparse vector.
+*  \brief Sparse matrix dense matrix multiplication
 *
 *  \details
-*  \ref rocsparse_rot applies the Givens rotation matrix \f$G\f$ to the sparse vector
-*  \f$x\f$ and the dense vector \f$y\f$, where
+*  \p rocsparse_spmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
+*  matrix \f$A\f$, defined in CSR or COO storage format, and the dense \f$k \times n\f$
+*  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+*  is multiplied by the scalar \f$\beta\f$, such that
 *  \f[
-*    G = \begin{pmatrix} c & s \\ -s & c \end{pmatrix}
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
 *  \f]
-*
-*  \code{.c}
-*      for(i = 0; i < nnz; ++i)
-*      {
-*          x_tmp = x_val[i];
-*          y_tmp = y[x_ind[i]];
-*
-*          x_val[i]    = c * x_tmp + s * y_tmp;
-*          y[x_ind[i]] = c * y_tmp - s * x_tmp;
-*      }
-*  \endcode
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  c           pointer to the cosine element of \f$G\f$, can be on host or device.
-*  @param[in]
-*  s           pointer to the sine element of \f$G\f$, can be on host or device.
-*  @param[inout]
-*  x           sparse vector \f$x\f$.
-*  @param[inout]
-*  y           dense vector \f$y\f$.
+*  \note
+*  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
 *
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p c, \p s, \p x or \p y pointer is
-*              invalid.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_rot(rocsparse_handle      handle,
-                               const void*           c,
-                               const void*           s,
-                               rocsparse_spvec_descr x,
-                               rocsparse_dnvec_descr y);
-
-/*! \ingroup generic_module
-*  \brief Sparse matrix to dense matrix conversion
+*  \note
+*  Currently, only CSR, COO and BSR sparse formats are supported. For BSR format, only
+*  32 bit indices and column major dense matrices are supported.
+*
+*  \note
+*  For CSR format, symmetric and Hermitian matrices that only store the triangular part
+*  selected by the \ref rocsparse_fill_mode are supported. The matrix type and fill mode
+*  can be set with rocsparse_spmat_set_attribute().
+*
+*  \note
+*  For CSR format, the sparse matrix and \p mat_B can be stored in a lower precision than
+*  the \p compute_type. The supported combinations of matrix, \p mat_B and
+*  \p compute_type precisions are the same as for the matrix, \p x and \p compute_type
+*  of rocsparse_spmv(). \p mat_C and the scalars \p alpha and \p beta are always of
+*  \p compute_type. For mixed precision, rocsparse_spmm_alg_csr_merge falls back to
+*  rocsparse_spmm_alg_csr.
+*
+*  \note
+*  Different algorithms are available which can provide better performance for different matrices.
+*  Currently, the available algorithms are rocsparse_spmm_alg_csr or rocsparse_spmm_alg_csr_row_split
+*  or rocsparse_spmm_alg_csr_merge for CSR matrices and rocsparse_spmm_alg_coo_segmented or
+*  rocsparse_spmm_alg_coo_atomic for COO matrices. Additionally,
+*  one can specify the algorithm to be rocsparse_spmm_alg_default. In the case of CSR matrices this will
+*  set the algorithm to be rocsparse_spmm_alg_csr and for COO matrices it will set the algorithm to be
+*  rocsparse_spmm_alg_coo_atomic.
 *
-*  \details
-*  \p rocsparse_sparse_to_dense
-*  \p rocsparse_sparse_to_dense performs the conversion of a sparse matrix in CSR, CSC, or COO format to
-*     a dense matrix
 *  \note
 *  This function writes the required allocation size (in bytes) to \p buffer_size and
-*  returns without performing the sparse to dense operation, when a nullptr is passed for
+*  returns without performing the SpMM operation, when a nullptr is passed for
 *  \p temp_buffer.
 *
 *  \note
@@ -14607,863 +17374,1402 @@ rocsparse_status rocsparse_rot(rocsparse_handle      handle,
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  mat_A        sparse matrix descriptor.
+*  trans_A      matrix operation type.
 *  @param[in]
-*  mat_B        dense matrix descriptor.
+*  trans_B      matrix operation type.
 *  @param[in]
-*  alg          algorithm for the sparse to dense computation.
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat_A        matrix descriptor.
+*  @param[in]
+*  mat_B        matrix descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[in]
+*  mat_C        matrix descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpMM computation. This is also the
+*               precision of \p mat_C.
+*  @param[in]
+*  alg          SpMM algorithm for the SpMM computation.
 *  @param[out]
-*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
-*               \p temp_buffer is nullptr.
+*  buffer_size  number of bytes of the temporary storage buffer. When \p buffer_size is not nullptr
+*               and \p temp_buffer is nullptr, \p buffer_size will be set and the function returns
+*               without performing the SpMM operation. Currently only rocsparse_spmm_alg_csr_merge
+*               requires a user allocated buffer. Attempting to get the buffer size with any other
+*               algorithm will return a buffer size of 4 bytes and is not required.
 *  @param[in]
-*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
-*               the required allocation size (in bytes) is written to \p buffer_size and
-*               function returns without performing the sparse to dense operation.
+*  temp_buffer  temporary storage buffer allocated by the user. When \p temp_buffer is not nullptr
+*               and \p buffer_size is nullptr, \p temp_buffer will be filled with any analysis data
+*               and the function returns without performing the SpMM operation. Currently only
+*               rocsparse_spmm_alg_csr_merge requires analysis data. Attempting to perform analysis
+*               with any other algorithm does nothing and is not necessary.
 *
 *  \retval      rocsparse_status_success the operation completed successfully.
 *  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p mat_A, \p mat_B, or \p buffer_size
-*               pointer is invalid.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat_A, \p mat_B, \p mat_C, \p beta, or
+*               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_not_implemented \p trans_A, \p trans_B, \p compute_type or \p alg is
+*               currently not supported.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sparse_to_dense(rocsparse_handle              handle,
-                                           const rocsparse_spmat_descr   mat_A,
-                                           rocsparse_dnmat_descr         mat_B,
-                                           rocsparse_sparse_to_dense_alg alg,
-                                           size_t*                       buffer_size,
-                                           void*                         temp_buffer);
+rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
+                                rocsparse_operation         trans_A,
+                                rocsparse_operation         trans_B,
+                                const void*                 alpha,
+                                const rocsparse_spmat_descr mat_A,
+                                const rocsparse_dnmat_descr mat_B,
+                                const void*                 beta,
+                                const rocsparse_dnmat_descr mat_C,
+                                rocsparse_datatype          compute_type,
+                                rocsparse_spmm_alg          alg,
+                                size_t*                     buffer_size,
+                                void*                       temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Dense matrix to sparse matrix conversion
+*  \brief Sparse matrix dense matrix multiplication, extension routine.
+*
+*  \details
+*  \p rocsparse_spmm_ex multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
+*  matrix \f$A\f$, defined in CSR or COO storage format, and the dense \f$k \times n\f$
+*  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
+*  is multiplied by the scalar \f$\beta\f$, such that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
 *
-*  \details
-*  \p rocsparse_dense_to_sparse
-*  \p rocsparse_dense_to_sparse performs the conversion of a dense matrix to a sparse matrix in CSR, CSC, or COO format.
+*  \note
+*  Currently, only CSR, COO and BSR sparse formats are supported. For BSR format, only
+*  32 bit indices and column major dense matrices are supported.
+*
+*  \note
+*  For CSR format, symmetric and Hermitian matrices that only store the triangular part
+*  selected by the \ref rocsparse_fill_mode are supported. The matrix type and fill mode
+*  can be set with rocsparse_spmat_set_attribute().
+*
+*  \note
+*  For CSR format, the sparse matrix and \p mat_B can be stored in a lower precision than
+*  the \p compute_type. The supported combinations of matrix, \p mat_B and
+*  \p compute_type precisions are the same as for the matrix, \p x and \p compute_type
+*  of rocsparse_spmv(). \p mat_C and the scalars \p alpha and \p beta are always of
+*  \p compute_type. For mixed precision, rocsparse_spmm_alg_csr_merge falls back to
+*  rocsparse_spmm_alg_csr.
+*
+*  \note
+*  Different algorithms are available which can provide better performance for different matrices.
+*  Currently, the available algorithms are rocsparse_spmm_alg_csr for CSR matrices and
+*  rocsparse_spmm_alg_coo_segmented or rocsparse_spmm_alg_coo_atomic for COO matrices. Additionally,
+*  one can specify the algorithm to be rocsparse_spmm_alg_default. In the case of CSR matrices this will
+*  set the algorithm to be rocsparse_spmm_alg_csr and for COO matrices it will set the algorithm to be
+*  rocsparse_spmm_alg_coo_atomic.
 *
 *  \note
 *  This function writes the required allocation size (in bytes) to \p buffer_size and
-*  returns without performing the dense to sparse operation, when a nullptr is passed for
+*  returns without performing the SpMM operation, when a nullptr is passed for
 *  \p temp_buffer.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
+*  \note SpMM requires three stages to complete. The first stage
+*  \ref rocsparse_spmm_stage_buffer_size will return the size of the temporary storage buffer
+*  that is required for subsequent calls to \ref rocsparse_spmm_ex. The second stage
+*  \ref rocsparse_spgemm_stage_preprocess will preprocess data that would be saved in the temporary storage buffer. In the final stage \ref rocsparse_spgemm_stage_compute, the actual
+*  computation is performed.
+*  \note If \ref rocsparse_spgemm_stage_auto is selected, rocSPARSE will automatically detect
+*  which stage is required based on the following indicators:
+*  If \p temp_buffer is equal to \p nullptr, the required buffer size will be returned.
+*  Else, the SpMM preprocess and the SpMM algorithm will be executed.
+*
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  mat_A        dense matrix descriptor.
+*  trans_A      matrix operation type.
 *  @param[in]
-*  mat_B        sparse matrix descriptor.
+*  trans_B      matrix operation type.
 *  @param[in]
-*  alg          algorithm for the sparse to dense computation.
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat_A        matrix descriptor.
+*  @param[in]
+*  mat_B        matrix descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[in]
+*  mat_C        matrix descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpMM computation. This is also the
+*               precision of \p mat_C.
+*  @param[in]
+*  alg          SpMM algorithm for the SpMM computation.
+*  @param[in]
+*  stage        SpMM stage for the SpMM computation.
 *  @param[out]
 *  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
 *               \p temp_buffer is nullptr.
 *  @param[in]
 *  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
 *               the required allocation size (in bytes) is written to \p buffer_size and
-*               function returns without performing the dense to sparse operation.
+*               function returns without performing the SpMM operation.
 *
 *  \retval      rocsparse_status_success the operation completed successfully.
 *  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p mat_A, \p mat_B, or \p buffer_size
-*               pointer is invalid.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat_A, \p mat_B, \p mat_C, \p beta, or
+*               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_not_implemented \p trans_A, \p trans_B, \p compute_type or \p alg is
+*               currently not supported.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dense_to_sparse(rocsparse_handle              handle,
-                                           const rocsparse_dnmat_descr   mat_A,
-                                           rocsparse_spmat_descr         mat_B,
-                                           rocsparse_dense_to_sparse_alg alg,
-                                           size_t*                       buffer_size,
-                                           void*                         temp_buffer);
+rocsparse_status rocsparse_spmm_ex(rocsparse_handle            handle,
+                                   rocsparse_operation         trans_A,
+                                   rocsparse_operation         trans_B,
+                                   const void*                 alpha,
+                                   const rocsparse_spmat_descr mat_A,
+                                   const rocsparse_dnmat_descr mat_B,
+                                   const void*                 beta,
+                                   const rocsparse_dnmat_descr mat_C,
+                                   rocsparse_datatype          compute_type,
+                                   rocsparse_spmm_alg          alg,
+                                   rocsparse_spmm_stage        stage,
+                                   size_t*                     buffer_size,
+                                   void*                       temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Sparse vector inner dot product
+*  \brief Sparse matrix sparse matrix multiplication
 *
 *  \details
-*  \ref rocsparse_spvv computes the inner dot product of the sparse vecotr \f$x\f$ with the
-*  dense vector \f$y\f$, such that
+*  \ref rocsparse_spgemm multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$ and
+*  adds the result to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by
+*  \f$\beta\f$. The final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$,
+*  such that
 *  \f[
-*    \text{result} := x^{'} \cdot y,
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
 *  \f]
 *  with
 *  \f[
-*    op(x) = \left\{
+*    op(A) = \left\{
 *    \begin{array}{ll}
-*        x,   & \text{if trans == rocsparse_operation_none} \\
-*        \bar{x}, & \text{if trans == rocsparse_operation_conjugate_transpose} \\
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
 *    \end{array}
 *    \right.
 *  \f]
 *
-*  \code{.c}
-*      result = 0;
-*      for(i = 0; i < nnz; ++i)
-*      {
-*          result += x_val[i] * y[x_ind[i]];
-*      }
-*  \endcode
-*
-*  \note
-*  This function writes the required allocation size (in bytes) to \p buffer_size and
-*  returns without performing the SpVV operation, when a nullptr is passed for
-*  \p temp_buffer.
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  \note SpGEMM requires three stages to complete. The first stage
+*  \ref rocsparse_spgemm_stage_buffer_size will return the size of the temporary storage buffer
+*  that is required for subsequent calls to \ref rocsparse_spgemm. The second stage
+*  \ref rocsparse_spgemm_stage_nnz will determine the number of non-zero elements of the
+*  resulting \f$C\f$ matrix. If the sparsity pattern of \f$C\f$ is already known, this
+*  stage can be skipped. In the final stage \ref rocsparse_spgemm_stage_compute, the actual
+*  computation is performed.
+*  \note If SpGEMM is performed repeatedly with matrices of unchanged sparsity patterns, the
+*  final stage can be split. The stage \ref rocsparse_spgemm_stage_symbolic performs the
+*  computation and additionally keeps the row analysis of \f$C\f$. Each subsequent stage
+*  \ref rocsparse_spgemm_stage_numeric only re-computes the values of \f$C\f$, without any
+*  sorting of column indices or synchronization with the host. Calling
+*  \ref rocsparse_spgemm_stage_buffer_size again invalidates the symbolic data.
+*  \note If \ref rocsparse_spgemm_stage_auto is selected, rocSPARSE will automatically detect
+*  which stage is required based on the following indicators:
+*  If \p temp_buffer is equal to \p nullptr, the required buffer size will be returned.
+*  Else, if the number of non-zeros of \f$C\f$ is zero, the number of non-zero entries will be
+*  computed.
+*  Else, the SpGEMM algorithm will be executed.
+*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be
+*  computed.
+*  \note \f$\alpha == beta == 0\f$ is invalid.
+*  \note It is allowed to pass the same sparse matrix for \f$C\f$ and \f$D\f$, if both
+*  matrices have the same sparsity pattern.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  trans        sparse vector operation type.
+*  trans_A      sparse matrix \f$A\f$ operation type.
 *  @param[in]
-*  x            sparse vector descriptor.
+*  trans_B      sparse matrix \f$B\f$ operation type.
 *  @param[in]
-*  y            dense vector descriptor.
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            sparse matrix \f$A\f$ descriptor.
+*  @param[in]
+*  B            sparse matrix \f$B\f$ descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[in]
+*  D            sparse matrix \f$D\f$ descriptor.
 *  @param[out]
-*  result       pointer to the result, can be host or device memory
+*  C            sparse matrix \f$C\f$ descriptor.
 *  @param[in]
-*  compute_type floating point precision for the SpVV computation.
+*  compute_type floating point precision for the SpGEMM computation.
+*  @param[in]
+*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  @param[in]
+*  stage        SpGEMM stage for the SpGEMM computation.
 *  @param[out]
 *  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
 *               \p temp_buffer is nullptr.
 *  @param[in]
 *  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
 *               the required allocation size (in bytes) is written to \p buffer_size and
-*               function returns without performing the SpVV operation.
+*               function returns without performing the SpGEMM operation.
 *
-*  \retval      rocsparse_status_success the operation completed successfully.
-*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p x, \p y, \p result or \p buffer_size
-*               pointer is invalid.
-*  \retval      rocsparse_status_not_implemented \p compute_type is currently not
-*               supported.
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p A, \p B, \p D, \p C or \p buffer_size pointer is invalid.
+*  \retval rocsparse_status_invalid_value \p alg is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none or
+*          \p trans_B != \ref rocsparse_operation_none.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_spvv(rocsparse_handle            handle,
-                                rocsparse_operation         trans,
-                                const rocsparse_spvec_descr x,
-                                const rocsparse_dnvec_descr y,
-                                void*                       result,
-                                rocsparse_datatype          compute_type,
-                                size_t*                     buffer_size,
-                                void*                       temp_buffer);
+rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
+                                  rocsparse_operation         trans_A,
+                                  rocsparse_operation         trans_B,
+                                  const void*                 alpha,
+                                  const rocsparse_spmat_descr A,
+                                  const rocsparse_spmat_descr B,
+                                  const void*                 beta,
+                                  const rocsparse_spmat_descr D,
+                                  rocsparse_spmat_descr       C,
+                                  rocsparse_datatype          compute_type,
+                                  rocsparse_spgemm_alg        alg,
+                                  rocsparse_spgemm_stage      stage,
+                                  size_t*                     buffer_size,
+                                  void*                       temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Sparse matrix vector multiplication
+*  \brief Sparse matrix sparse matrix multiplication with bounded device memory
 *
 *  \details
-*  \ref rocsparse_spmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
-*  matrix and the dense vector \f$x\f$ and adds the result to the dense vector \f$y\f$
-*  that is multiplied by the scalar \f$\beta\f$, such that
-*  \f[
-*    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
-*  \f]
-*  with
+*  \ref rocsparse_spgemm_chunked computes
 *  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if trans == rocsparse_operation_none} \\
-*        A^T, & \text{if trans == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D
 *  \f]
+*  for products, where \f$C\f$ does not fit into device memory. The rows of \f$C\f$ are
+*  computed in chunks, such that all device memory required by a chunk fits into the
+*  \p buffer_size bytes of \p temp_buffer. \f$A\f$, \f$B\f$ and \f$D\f$ are stored in
+*  device memory. Each finished chunk is transferred to the host on a second stream,
+*  while the next chunk is computed on the stream of \p handle.
+*
+*  The descriptor of \f$C\f$ provides its sizes, index and data types and index base,
+*  its device arrays are not accessed. If \p callback is not \p nullptr, each finished
+*  chunk is passed to \p callback, see \ref rocsparse_spgemm_chunk_callback, and
+*  \p csr_row_ptr_C, \p csr_col_ind_C and \p csr_val_C are not accessed. Otherwise,
+*  \f$C\f$ is written to the pinned host arrays \p csr_row_ptr_C, \p csr_col_ind_C
+*  and \p csr_val_C. If the number of non-zero entries of the descriptor of \f$C\f$ is
+*  zero, only \p csr_row_ptr_C and the number of non-zero entries of the descriptor,
+*  that can be obtained by rocsparse_spmat_get_size(), are computed. After allocating
+*  \p csr_col_ind_C and \p csr_val_C in pinned host memory, a second call computes the
+*  column indices and values of \f$C\f$.
 *
 *  \note
-*  This function writes the required allocation size (in bytes) to \p buffer_size and
-*  returns without performing the SpMV operation, when a nullptr is passed for
-*  \p temp_buffer.
-*
+*  Half of \p temp_buffer holds the workspace of the current chunk, the other half
+*  holds two finished chunks waiting for their transfer. The size of a chunk is based
+*  on the number of intermediate products of its rows. A larger buffer results in fewer
+*  and larger chunks.
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  This function is blocking with respect to the host.
+*  \note
+*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
+*  supported.
+*  \note
+*  Currently, only CSR matrices are supported.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A      sparse matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B      sparse matrix \f$B\f$ operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            sparse matrix \f$A\f$ descriptor.
+*  @param[in]
+*  B            sparse matrix \f$B\f$ descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[in]
+*  D            sparse matrix \f$D\f$ descriptor.
+*  @param[inout]
+*  C            sparse matrix \f$C\f$ descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpGEMM computation.
+*  @param[in]
+*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  @param[out]
+*  csr_row_ptr_C array of \p m+1 row offsets of \f$C\f$ in pinned host memory, or
+*                \p nullptr if \p callback is used.
+*  @param[out]
+*  csr_col_ind_C array of the column indices of \f$C\f$ in pinned host memory, or
+*                \p nullptr while only the row offsets are computed or \p callback is
+*                used.
+*  @param[out]
+*  csr_val_C    array of the values of \f$C\f$ in pinned host memory, or \p nullptr
+*               while only the row offsets are computed or \p callback is used.
+*  @param[in]
+*  callback     callback receiving the finished chunks of \f$C\f$, or \p nullptr.
+*  @param[in]
+*  user_data    user data passed to \p callback.
+*  @param[in]
+*  buffer_size  number of bytes of \p temp_buffer, i.e. the device memory budget.
+*  @param[in]
+*  temp_buffer  temporary storage buffer of \p buffer_size bytes allocated by the user.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p A, \p B, \p D, \p C, \p csr_row_ptr_C, \p csr_col_ind_C, \p csr_val_C
+*          or \p temp_buffer pointer is invalid.
+*  \retval rocsparse_status_invalid_value \p alg is invalid.
+*  \retval rocsparse_status_invalid_size \p buffer_size is too small to hold a single
+*          row of \f$C\f$, or the number of non-zero entries of \f$C\f$ is too small.
+*  \retval rocsparse_status_memory_error the pinned host buffers for \p callback could
+*          not be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none or the matrices are not in CSR
+*          format.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spgemm_chunked(rocsparse_handle                handle,
+                                          rocsparse_operation             trans_A,
+                                          rocsparse_operation             trans_B,
+                                          const void*                     alpha,
+                                          const rocsparse_spmat_descr     A,
+                                          const rocsparse_spmat_descr     B,
+                                          const void*                     beta,
+                                          const rocsparse_spmat_descr     D,
+                                          rocsparse_spmat_descr           C,
+                                          rocsparse_datatype              compute_type,
+                                          rocsparse_spgemm_alg            alg,
+                                          void*                           csr_row_ptr_C,
+                                          void*                           csr_col_ind_C,
+                                          void*                           csr_val_C,
+                                          rocsparse_spgemm_chunk_callback callback,
+                                          void*                           user_data,
+                                          size_t                          buffer_size,
+                                          void*                           temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Masked sparse matrix sparse matrix multiplication
 *
-*  \note
-*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*  \details
+*  \ref rocsparse_spgemm_masked multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$,
+*  restricted to the sparsity pattern of the sparse \f$m \times n\f$ mask matrix \f$M\f$,
+*  such that
+*  \f[
+*    C := \left(\alpha \cdot op(A) \cdot op(B)\right) \circ spy(M),
+*  \f]
+*  if \p mask == \ref rocsparse_spgemm_mask_structural, or
+*  \f[
+*    C := \left(\alpha \cdot op(A) \cdot op(B)\right) \circ \left(1 - spy(M)\right),
+*  \f]
+*  if \p mask == \ref rocsparse_spgemm_mask_complement. Only the sparsity pattern of
+*  \f$M\f$ is accessed, its values are ignored.
+*
+*  Intermediate products that are not admitted by the mask are discarded before they are
+*  accumulated, such that neither the number of non-zero entries nor the values of
+*  \f$C\f$ are computed for masked out entries. This is typically much faster than
+*  computing the full product and filtering it afterwards, e.g. for triangle counting or
+*  other graph algorithms, where \f$C\f$ is much sparser than \f$A \cdot B\f$.
+*
+*  \note The stages of \ref rocsparse_spgemm_masked are identical to the stages of
+*  \ref rocsparse_spgemm. The same mask has to be passed to all stages. The mask is
+*  not kept by \f$C\f$, subsequent calls to \ref rocsparse_spgemm with \f$C\f$ are not
+*  masked.
+*  \note The column indices of each row of \f$M\f$ have to be sorted.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only CSR matrices are supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  trans        matrix operation type.
+*  trans_A      sparse matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B      sparse matrix \f$B\f$ operation type.
 *  @param[in]
 *  alpha        scalar \f$\alpha\f$.
 *  @param[in]
-*  mat          matrix descriptor.
+*  A            sparse matrix \f$A\f$ descriptor.
 *  @param[in]
-*  x            vector descriptor.
+*  B            sparse matrix \f$B\f$ descriptor.
 *  @param[in]
-*  beta         scalar \f$\beta\f$.
-*  @param[inout]
-*  y            vector descriptor.
+*  M            sparse mask matrix \f$M\f$ descriptor.
 *  @param[in]
-*  compute_type floating point precision for the SpMV computation.
+*  mask         \ref rocsparse_spgemm_mask_structural or
+*               \ref rocsparse_spgemm_mask_complement.
+*  @param[out]
+*  C            sparse matrix \f$C\f$ descriptor.
 *  @param[in]
-*  alg          SpMV algorithm for the SpMV computation.
+*  compute_type floating point precision for the SpGEMM computation.
+*  @param[in]
+*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  @param[in]
+*  stage        SpGEMM stage for the SpGEMM computation.
 *  @param[out]
 *  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
 *               \p temp_buffer is nullptr.
 *  @param[in]
 *  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
 *               the required allocation size (in bytes) is written to \p buffer_size and
-*               function returns without performing the SpMV operation.
+*               function returns without performing the SpGEMM operation.
 *
-*  \retval      rocsparse_status_success the operation completed successfully.
-*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta, \p y or
-*               \p buffer_size pointer is invalid.
-*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type or \p alg is
-*               currently not supported.
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p A, \p B, \p M, \p C or
+*          \p buffer_size pointer is invalid.
+*  \retval rocsparse_status_invalid_size the dimensions of \f$M\f$ and \f$C\f$ do not
+*          match.
+*  \retval rocsparse_status_invalid_value \p mask or \p alg is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none or the matrices are not in CSR
+*          format.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
-                                rocsparse_operation         trans,
-                                const void*                 alpha,
-                                const rocsparse_spmat_descr mat,
-                                const rocsparse_dnvec_descr x,
-                                const void*                 beta,
-                                const rocsparse_dnvec_descr y,
-                                rocsparse_datatype          compute_type,
-                                rocsparse_spmv_alg          alg,
-                                size_t*                     buffer_size,
-                                void*                       temp_buffer);
+rocsparse_status rocsparse_spgemm_masked(rocsparse_handle            handle,
+                                         rocsparse_operation         trans_A,
+                                         rocsparse_operation         trans_B,
+                                         const void*                 alpha,
+                                         const rocsparse_spmat_descr A,
+                                         const rocsparse_spmat_descr B,
+                                         const rocsparse_spmat_descr M,
+                                         rocsparse_spgemm_mask       mask,
+                                         rocsparse_spmat_descr       C,
+                                         rocsparse_datatype          compute_type,
+                                         rocsparse_spgemm_alg        alg,
+                                         rocsparse_spgemm_stage      stage,
+                                         size_t*                     buffer_size,
+                                         void*                       temp_buffer);
 
 /*! \ingroup generic_module
-*  \brief Sparse matrix dense matrix multiplication
+*  \brief  Sampled Dense-Dense Matrix Multiplication.
 *
 *  \details
-*  \p rocsparse_spmm multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
-*  matrix \f$A\f$, defined in CSR or COO storage format, and the dense \f$k \times n\f$
-*  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
-*  is multiplied by the scalar \f$\beta\f$, such that
+*  \ref rocsparse_sddmm multiplies the scalar \f$\alpha\f$ with the dense
+*  \f$m \times k\f$ matrix \f$A\f$, the dense \f$k \times n\f$ matrix \f$B\f$, filtered by the sparsity pattern of the \f$m \times n\f$ sparse matrix \f$C\f$ and
+*  adds the result to \f$C\f$ scaled by
+*  \f$\beta\f$. The final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$,
+*  such that
 *  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
+*    C := \alpha ( opA(A) \cdot opB(B) ) \cdot spy(C) + \beta C,
 *  \f]
 *  with
 *  \f[
 *    op(A) = \left\{
 *    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*        A,   & \text{if opA == rocsparse_operation_none} \\
+*        A^T,   & \text{if opA == rocsparse_operation_transpose} \\
 *    \end{array}
 *    \right.
-*  \f]
-*  and
+*  \f],
 *  \f[
 *    op(B) = \left\{
 *    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*        B,   & \text{if opB == rocsparse_operation_none} \\
+*        B^T,   & \text{if opB == rocsparse_operation_transpose} \\
 *    \end{array}
 *    \right.
 *  \f]
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
-*  \note
-*  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
-*
-*  \note
-*  Currently, only CSR and COO sparse formats are supported.
-*
-*  \note
-*  Different algorithms are available which can provide better performance for different matrices.
-*  Currently, the available algorithms are rocsparse_spmm_alg_csr or rocsparse_spmm_alg_csr_row_split
-*  or rocsparse_spmm_alg_csr_merge for CSR matrices and rocsparse_spmm_alg_coo_segmented or
-*  rocsparse_spmm_alg_coo_atomic for COO matrices. Additionally,
-*  one can specify the algorithm to be rocsparse_spmm_alg_default. In the case of CSR matrices this will
-*  set the algorithm to be rocsparse_spmm_alg_csr and for COO matrices it will set the algorithm to be
-*  rocsparse_spmm_alg_coo_atomic.
-*
-*  \note
-*  This function writes the required allocation size (in bytes) to \p buffer_size and
-*  returns without performing the SpMM operation, when a nullptr is passed for
-*  \p temp_buffer.
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
+*   and
+*  \f[
+*    spy(C)_ij = \left\{
+*    \begin{array}{ll}
+*        1 \text{if i == j},   & 0 \text{if i != j} \\
+*    \end{array}
+*    \right.
+*  \f]
+*  \note \p opA == \ref rocsparse_operation_conjugate_transpose is not supported.
+*  \note \p opB == \ref rocsparse_operation_conjugate_transpose is not supported.
+*  \note With \p compute_type \ref rocsparse_datatype_f32_r, the dense matrices \f$A\f$
+*  and \f$B\f$ can be stored in \ref rocsparse_datatype_f16_r or
+*  \ref rocsparse_datatype_bf16_r. Both have to be of the same precision. \f$C\f$ and
+*  the scalars are of \p compute_type and the products are accumulated in single
+*  precision.
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A      matrix operation type.
+*  opA      dense matrix \f$A\f$ operation type.
 *  @param[in]
-*  trans_B      matrix operation type.
+*  opB      dense matrix \f$B\f$ operation type.
 *  @param[in]
 *  alpha        scalar \f$\alpha\f$.
 *  @param[in]
-*  mat_A        matrix descriptor.
+*  A            dense matrix \f$A\f$ descriptor.
 *  @param[in]
-*  mat_B        matrix descriptor.
+*  B            dense matrix \f$B\f$ descriptor.
 *  @param[in]
 *  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  C            sparse matrix \f$C\f$ descriptor.
 *  @param[in]
-*  mat_C        matrix descriptor.
-*  @param[in]
-*  compute_type floating point precision for the SpMM computation.
+*  compute_type floating point precision for the SDDMM computation.
 *  @param[in]
-*  alg          SpMM algorithm for the SpMM computation.
-*  @param[out]
-*  buffer_size  number of bytes of the temporary storage buffer. When \p buffer_size is not nullptr
-*               and \p temp_buffer is nullptr, \p buffer_size will be set and the function returns
-*               without performing the SpMM operation. Currently only rocsparse_spmm_alg_csr_merge
-*               requires a user allocated buffer. Attempting to get the buffer size with any other
-*               algorithm will return a buffer size of 4 bytes and is not required.
+*  alg specification of the algorithm to use.
 *  @param[in]
-*  temp_buffer  temporary storage buffer allocated by the user. When \p temp_buffer is not nullptr
-*               and \p buffer_size is nullptr, \p temp_buffer will be filled with any analysis data
-*               and the function returns without performing the SpMM operation. Currently only
-*               rocsparse_spmm_alg_csr_merge requires analysis data. Attempting to perform analysis
-*               with any other algorithm does nothing and is not necessary.
+*  temp_buffer  temporary storage buffer allocated by the user.
+*  The size must be greater or equal to the size obtained with \ref rocsparse_sddmm_buffer_size.
 *
-*  \retval      rocsparse_status_success the operation completed successfully.
-*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat_A, \p mat_B, \p mat_C, \p beta, or
-*               \p buffer_size pointer is invalid.
-*  \retval      rocsparse_status_not_implemented \p trans_A, \p trans_B, \p compute_type or \p alg is
-*               currently not supported.
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_value the value of \p trans\_A, \p trans\_B, \p compute\_type or alg is incorrect.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p A, \p B, \p D, \p C, \p csr_row_ptr_C, \p csr_col_ind_C, \p csr_val_C
+*          or \p temp_buffer pointer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p opA == \ref rocsparse_operation_conjugate_transpose or
+*          \p opB == \ref rocsparse_operation_conjugate_transpose.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
-                                rocsparse_operation         trans_A,
-                                rocsparse_operation         trans_B,
-                                const void*                 alpha,
-                                const rocsparse_spmat_descr mat_A,
-                                const rocsparse_dnmat_descr mat_B,
-                                const void*                 beta,
-                                const rocsparse_dnmat_descr mat_C,
-                                rocsparse_datatype          compute_type,
-                                rocsparse_spmm_alg          alg,
-                                size_t*                     buffer_size,
-                                void*                       temp_buffer);
-
-/*! \ingroup generic_module
-*  \brief Sparse matrix dense matrix multiplication, extension routine.
-*
-*  \details
-*  \p rocsparse_spmm_ex multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times k\f$
-*  matrix \f$A\f$, defined in CSR or COO storage format, and the dense \f$k \times n\f$
-*  matrix \f$B\f$ and adds the result to the dense \f$m \times n\f$ matrix \f$C\f$ that
-*  is multiplied by the scalar \f$\beta\f$, such that
-*  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot C,
-*  \f]
-*  with
-*  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  and
-*  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
-*  \note
-*  Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
-*
-*  \note
-*  Currently, only CSR and COO sparse formats are supported.
-*
-*  \note
-*  Different algorithms are available which can provide better performance for different matrices.
-*  Currently, the available algorithms are rocsparse_spmm_alg_csr for CSR matrices and
-*  rocsparse_spmm_alg_coo_segmented or rocsparse_spmm_alg_coo_atomic for COO matrices. Additionally,
-*  one can specify the algorithm to be rocsparse_spmm_alg_default. In the case of CSR matrices this will
-*  set the algorithm to be rocsparse_spmm_alg_csr and for COO matrices it will set the algorithm to be
-*  rocsparse_spmm_alg_coo_atomic.
-*
-*  \note
-*  This function writes the required allocation size (in bytes) to \p buffer_size and
-*  returns without performing the SpMM operation, when a nullptr is passed for
-*  \p temp_buffer.
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
-*
-*  \note SpMM requires three stages to complete. The first stage
-*  \ref rocsparse_spmm_stage_buffer_size will return the size of the temporary storage buffer
-*  that is required for subsequent calls to \ref rocsparse_spmm_ex. The second stage
-*  \ref rocsparse_spgemm_stage_preprocess will preprocess data that would be saved in the temporary storage buffer. In the final stage \ref rocsparse_spgemm_stage_compute, the actual
-*  computation is performed.
-*  \note If \ref rocsparse_spgemm_stage_auto is selected, rocSPARSE will automatically detect
-*  which stage is required based on the following indicators:
-*  If \p temp_buffer is equal to \p nullptr, the required buffer size will be returned.
-*  Else, the SpMM preprocess and the SpMM algorithm will be executed.
+rocsparse_status rocsparse_sddmm(rocsparse_handle            handle,
+                                 rocsparse_operation         opA,
+                                 rocsparse_operation         opB,
+                                 const void*                 alpha,
+                                 const rocsparse_dnmat_descr A,
+                                 const rocsparse_dnmat_descr B,
+                                 const void*                 beta,
+                                 rocsparse_spmat_descr       C,
+                                 rocsparse_datatype          compute_type,
+                                 rocsparse_sddmm_alg         alg,
+                                 void*                       temp_buffer);
+
+/*! \ingroup generic_module
+*  \brief Calculate the size in bytes of the required buffer for the use of \ref rocsparse_sddmm and \ref rocsparse_sddmm_preprocess
 *
+*  \details
+*  \ref rocsparse_sddmm_buffer_size returns the size of the required buffer to execute the SDDMM operation from a given configuration.
 *  @param[in]
 *  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A      matrix operation type.
+*  opA      dense matrix \f$A\f$ operation type.
 *  @param[in]
-*  trans_B      matrix operation type.
+*  opB      dense matrix \f$B\f$ operation type.
 *  @param[in]
 *  alpha        scalar \f$\alpha\f$.
 *  @param[in]
-*  mat_A        matrix descriptor.
+*  A            dense matrix \f$A\f$ descriptor.
 *  @param[in]
-*  mat_B        matrix descriptor.
+*  B            dense matrix \f$B\f$ descriptor.
 *  @param[in]
 *  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  C            sparse matrix \f$C\f$ descriptor.
 *  @param[in]
-*  mat_C        matrix descriptor.
+*  compute_type floating point precision for the SDDMM computation.
 *  @param[in]
-*  compute_type floating point precision for the SpMM computation.
+*  alg specification of the algorithm to use.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_value the value of \p trans\_A or \p trans\_B is incorrect.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p A, \p B, \p D, \p C or \p buffer_size pointer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p opA == \ref rocsparse_operation_conjugate_transpose or
+*          \p opB == \ref rocsparse_operation_conjugate_transpose.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sddmm_buffer_size(rocsparse_handle            handle,
+                                             rocsparse_operation         opA,
+                                             rocsparse_operation         opB,
+                                             const void*                 alpha,
+                                             const rocsparse_dnmat_descr A,
+                                             const rocsparse_dnmat_descr B,
+                                             const void*                 beta,
+                                             rocsparse_spmat_descr       C,
+                                             rocsparse_datatype          compute_type,
+                                             rocsparse_sddmm_alg         alg,
+                                             size_t*                     buffer_size);
+
+/*! \ingroup generic_module
+*  \brief Preprocess data before the use of \ref rocsparse_sddmm.
+*
+*  \details
+*  \ref rocsparse_sddmm_preprocess executes a part of the algorithm that can be calculated once in the context of multiple calls of the \ref rocsparse_sddmm
+*  with the same sparsity pattern.
 *  @param[in]
-*  alg          SpMM algorithm for the SpMM computation.
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  stage        SpMM stage for the SpMM computation.
-*  @param[out]
-*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
-*               \p temp_buffer is nullptr.
+*  opA      dense matrix \f$A\f$ operation type.
 *  @param[in]
-*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
-*               the required allocation size (in bytes) is written to \p buffer_size and
-*               function returns without performing the SpMM operation.
+*  opB      dense matrix \f$B\f$ operation type.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            dense matrix \f$A\f$ descriptor.
+*  @param[in]
+*  B            dense matrix \f$B\f$ descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  C            sparse matrix \f$C\f$ descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SDDMM computation.
+*  @param[in]
+*  alg specification of the algorithm to use.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
+*  The size must be greater or equal to the size obtained with \ref rocsparse_sddmm_buffer_size.
 *
-*  \retval      rocsparse_status_success the operation completed successfully.
-*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat_A, \p mat_B, \p mat_C, \p beta, or
-*               \p buffer_size pointer is invalid.
-*  \retval      rocsparse_status_not_implemented \p trans_A, \p trans_B, \p compute_type or \p alg is
-*               currently not supported.
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_value the value of \p trans\_A or \p trans\_B is incorrect.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p A, \p B, \p D, \p C, \p csr_row_ptr_C, \p csr_col_ind_C, \p csr_val_C
+*          or \p temp_buffer pointer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p opA == \ref rocsparse_operation_conjugate_transpose or
+*          \p opB == \ref rocsparse_operation_conjugate_transpose.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_spmm_ex(rocsparse_handle            handle,
-                                   rocsparse_operation         trans_A,
-                                   rocsparse_operation         trans_B,
-                                   const void*                 alpha,
-                                   const rocsparse_spmat_descr mat_A,
-                                   const rocsparse_dnmat_descr mat_B,
-                                   const void*                 beta,
-                                   const rocsparse_dnmat_descr mat_C,
-                                   rocsparse_datatype          compute_type,
-                                   rocsparse_spmm_alg          alg,
-                                   rocsparse_spmm_stage        stage,
-                                   size_t*                     buffer_size,
-                                   void*                       temp_buffer);
+rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle            handle,
+                                            rocsparse_operation         opA,
+                                            rocsparse_operation         opB,
+                                            const void*                 alpha,
+                                            const rocsparse_dnmat_descr A,
+                                            const rocsparse_dnmat_descr B,
+                                            const void*                 beta,
+                                            rocsparse_spmat_descr       C,
+                                            rocsparse_datatype          compute_type,
+                                            rocsparse_sddmm_alg         alg,
+                                            void*                       temp_buffer);
 
-/*! \ingroup generic_module
-*  \brief Sparse matrix sparse matrix multiplication
+/*! \ingroup reordering_module
+*  \brief Coloring of the adjacency graph of the matrix \f$A\f$ stored in the CSR format.
 *
 *  \details
-*  \ref rocsparse_spgemm multiplies the scalar \f$\alpha\f$ with the sparse
-*  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$ and
-*  adds the result to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by
-*  \f$\beta\f$. The final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$,
-*  such that
-*  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
-*  \f]
-*  with
-*  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  and
-*  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
+*  \p rocsparse_csrcolor performs the coloring of the undirected graph represented by the (symmetric) sparsity pattern of the matrix \f$A\f$ stored in CSR format. Graph coloring is a way of coloring the nodes of a graph such that no two adjacent nodes are of the same color. The \p fraction_to_color is a parameter to only color a given percentage of the graph nodes, the remaining uncolored nodes receive distinct new colors. The optional \p reordering array is a permutation array such that unknowns of the same color are grouped. The matrix \f$A\f$ must be stored as a general matrix with a symmetric sparsity pattern, and if the matrix \f$A\f$ is non-symmetric then the user is responsible to provide the symmetric part \f$\frac{A+A^T}{2}\f$.
 *
-*  \note SpGEMM requires three stages to complete. The first stage
-*  \ref rocsparse_spgemm_stage_buffer_size will return the size of the temporary storage buffer
-*  that is required for subsequent calls to \ref rocsparse_spgemm. The second stage
-*  \ref rocsparse_spgemm_stage_nnz will determine the number of non-zero elements of the
-*  resulting \f$C\f$ matrix. If the sparsity pattern of \f$C\f$ is already known, this
-*  stage can be skipped. In the final stage \ref rocsparse_spgemm_stage_compute, the actual
-*  computation is performed.
-*  \note If \ref rocsparse_spgemm_stage_auto is selected, rocSPARSE will automatically detect
-*  which stage is required based on the following indicators:
-*  If \p temp_buffer is equal to \p nullptr, the required buffer size will be returned.
-*  Else, if the number of non-zeros of \f$C\f$ is zero, the number of non-zero entries will be
-*  computed.
-*  Else, the SpGEMM algorithm will be executed.
-*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
-*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be
-*  computed.
-*  \note \f$\alpha == beta == 0\f$ is invalid.
-*  \note It is allowed to pass the same sparse matrix for \f$C\f$ and \f$D\f$, if both
-*  matrices have the same sparsity pattern.
-*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
-*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
-*  \note This function is non blocking and executed asynchronously with respect to the
-*        host. It may return before the actual computation has finished.
-*  \note Please note, that for rare matrix products with more than 4096 non-zero entries
-*  per row, additional temporary storage buffer is allocated by the algorithm.
+*  The colors are contiguous, i.e. \p coloring only contains values in the range
+*  [0, \p ncolors). By default, a distance-1 coloring is computed. A distance-2 coloring
+*  and balancing of the number of nodes per color can be requested with
+*  rocsparse_csrcolor_options(). The offsets of the colors within \p reordering can be
+*  obtained with rocsparse_csrcolor_color_ptr().
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of sparse matrix \f$A\f$.
+*  @param[in]
+*  nnz         number of non-zero entries of sparse matrix \f$A\f$.
+*  @param[in]
+*  descr      sparse matrix descriptor.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  fraction_to_color  fraction of nodes to be colored, which should be in the interval [0.0,1.0], for example 0.8 implies that 80 percent of nodes will be colored.
+*  @param[out]
+*  ncolors     	resulting number of distinct colors.
+*  @param[out]
+*  coloring     resulting mapping of colors.
+*  @param[out]
+*  reordering 	optional resulting reordering permutation if \p reordering is a non-null pointer.
+*  @param[inout]
+*  info    structure that holds the information collected during the coloring algorithm.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr, \p csr_col_ind, \p fraction_to_color, \p ncolors, \p coloring or \p info pointer is invalid.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrcolor(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const float*              fraction_to_color,
+                                     rocsparse_int*            ncolors,
+                                     rocsparse_int*            coloring,
+                                     rocsparse_int*            reordering,
+                                     rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcolor(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     const double*             fraction_to_color,
+                                     rocsparse_int*            ncolors,
+                                     rocsparse_int*            coloring,
+                                     rocsparse_int*            reordering,
+                                     rocsparse_mat_info        info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrcolor(rocsparse_handle               handle,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  nnz,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     const float*                   fraction_to_color,
+                                     rocsparse_int*                 ncolors,
+                                     rocsparse_int*                 coloring,
+                                     rocsparse_int*                 reordering,
+                                     rocsparse_mat_info             info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrcolor(rocsparse_handle                handle,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     const double*                   fraction_to_color,
+                                     rocsparse_int*                  ncolors,
+                                     rocsparse_int*                  coloring,
+                                     rocsparse_int*                  reordering,
+                                     rocsparse_mat_info              info);
+
+/**@}*/
+
+/*! \ingroup reordering_module
+*  \brief Coloring options of the adjacency graph of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrcolor_options sets the coloring algorithm that is used by
+*  rocsparse_scsrcolor(), rocsparse_dcsrcolor(), rocsparse_ccsrcolor() and
+*  rocsparse_zcsrcolor(). A distance-2 coloring (\ref rocsparse_color_alg_jpl_distance2)
+*  guarantees that nodes with a common neighbor have distinct colors, as it is required e.g.
+*  for the compression of Jacobian matrices. If \p enable_balance is non-zero, nodes are
+*  moved from colors with more than the average number of nodes to smaller colors, as long
+*  as the coloring remains valid. Balanced colors result in a similar amount of work for
+*  each color, when the nodes of one color are processed at a time. Balancing does not
+*  change the number of colors. The default is a distance-1 coloring without balancing.
 *
 *  @param[in]
-*  handle       handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
+*  @param[inout]
+*  info            structure that holds the information collected during the coloring
+*                  algorithm.
 *  @param[in]
-*  trans_A      sparse matrix \f$A\f$ operation type.
+*  alg             coloring algorithm.
 *  @param[in]
-*  trans_B      sparse matrix \f$B\f$ operation type.
+*  enable_balance  enable balancing of the number of nodes per color.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval rocsparse_status_invalid_value \p alg is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrcolor_options(rocsparse_handle    handle,
+                                            rocsparse_mat_info  info,
+                                            rocsparse_color_alg alg,
+                                            int                 enable_balance);
+
+/*! \ingroup reordering_module
+*  \brief Color offsets of the adjacency graph coloring of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrcolor_color_ptr returns the offsets of the colors computed by the
+*  last call to rocsparse_scsrcolor(), rocsparse_dcsrcolor(), rocsparse_ccsrcolor() or
+*  rocsparse_zcsrcolor() with \p info. The nodes of color \f$c\f$ are
+*  \p reordering[\p color_ptr[\f$c\f$]] to \p reordering[\p color_ptr[\f$c+1\f$] - 1].
+*  Hence, the nodes of each color can be processed in a single kernel launch.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
-*  alpha        scalar \f$\alpha\f$.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  A            sparse matrix \f$A\f$ descriptor.
+*  info        structure that holds the information collected during the coloring
+*              algorithm.
+*  @param[out]
+*  color_ptr   array of \p ncolors+1 elements containing the offsets of the colors.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p info or \p color_ptr pointer is invalid,
+*          or no coloring has been computed with \p info.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrcolor_color_ptr(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     color_ptr);
+
+/*! \ingroup reordering_module
+*  \brief Color permutation of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrcolor_permute_buffer_size returns the size of the temporary storage
+*  buffer that is required by rocsparse_scsrcolor_permute(),
+*  rocsparse_dcsrcolor_permute(), rocsparse_ccsrcolor_permute() and
+*  rocsparse_zcsrcolor_permute(). The temporary storage buffer must be allocated by the
+*  user.
+*
 *  @param[in]
-*  B            sparse matrix \f$B\f$ descriptor.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  beta         scalar \f$\beta\f$.
+*  m           number of rows of the sparse CSR matrix.
 *  @param[in]
-*  D            sparse matrix \f$D\f$ descriptor.
-*  @param[out]
-*  C            sparse matrix \f$C\f$ descriptor.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  compute_type floating point precision for the SpGEMM computation.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  stage        SpGEMM stage for the SpGEMM computation.
-*  @param[out]
-*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
-*               \p temp_buffer is nullptr.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
 *  @param[in]
-*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
-*               the required allocation size (in bytes) is written to \p buffer_size and
-*               function returns without performing the SpGEMM operation.
+*  ncolors     number of colors.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrcolor_permute(), rocsparse_dcsrcolor_permute(),
+*              rocsparse_ccsrcolor_permute() and rocsparse_zcsrcolor_permute().
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p A, \p B, \p D, \p C or \p buffer_size pointer is invalid.
-*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
-*          allocated.
-*  \retval rocsparse_status_not_implemented
-*          \p trans_A != \ref rocsparse_operation_none or
-*          \p trans_B != \ref rocsparse_operation_none.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p ncolors is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+*              or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
-                                  rocsparse_operation         trans_A,
-                                  rocsparse_operation         trans_B,
-                                  const void*                 alpha,
-                                  const rocsparse_spmat_descr A,
-                                  const rocsparse_spmat_descr B,
-                                  const void*                 beta,
-                                  const rocsparse_spmat_descr D,
-                                  rocsparse_spmat_descr       C,
-                                  rocsparse_datatype          compute_type,
-                                  rocsparse_spgemm_alg        alg,
-                                  rocsparse_spgemm_stage      stage,
-                                  size_t*                     buffer_size,
-                                  void*                       temp_buffer);
+rocsparse_status rocsparse_csrcolor_permute_buffer_size(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_int             ncolors,
+                                                        size_t*                   buffer_size);
 
-/*! \ingroup generic_module
-*  \brief  Sampled Dense-Dense Matrix Multiplication.
+/*! \ingroup reordering_module
+*  \brief Color permutation of a sparse CSR matrix
 *
 *  \details
-*  \ref rocsparse_sddmm multiplies the scalar \f$\alpha\f$ with the dense
-*  \f$m \times k\f$ matrix \f$A\f$, the dense \f$k \times n\f$ matrix \f$B\f$, filtered by the sparsity pattern of the \f$m \times n\f$ sparse matrix \f$C\f$ and
-*  adds the result to \f$C\f$ scaled by
-*  \f$\beta\f$. The final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$,
-*  such that
-*  \f[
-*    C := \alpha ( opA(A) \cdot opB(B) ) \cdot spy(C) + \beta C,
-*  \f]
-*  with
-*  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if opA == rocsparse_operation_none} \\
-*        A^T,   & \text{if opA == rocsparse_operation_transpose} \\
-*    \end{array}
-*    \right.
-*  \f],
-*  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if opB == rocsparse_operation_none} \\
-*        B^T,   & \text{if opB == rocsparse_operation_transpose} \\
-*    \end{array}
-*    \right.
-*  \f]
-*   and
+*  \p rocsparse_csrcolor_permute groups the rows and columns of a sparse \f$m \times m\f$
+*  CSR matrix \f$A\f$ by color, such that
 *  \f[
-*    spy(C)_ij = \left\{
-*    \begin{array}{ll}
-*        1 \text{if i == j},   & 0 \text{if i != j} \\
-*    \end{array}
-*    \right.
+*    A_{mc} = P A P^T,
 *  \f]
-*  \note \p opA == \ref rocsparse_operation_conjugate_transpose is not supported.
-*  \note \p opB == \ref rocsparse_operation_conjugate_transpose is not supported.
+*  where the permutation \f$P\f$ is given by \p perm, with row \p i of \f$A_{mc}\f$
+*  being row \p perm[i] of \f$A\f$. Rows of the same color keep their relative
+*  order. Additionally, \p color_ptr holds the offsets of each color, such that the rows
+*  \f$[\text{color_ptr}[c], \text{color_ptr}[c + 1])\f$ of \f$A_{mc}\f$ belong to color
+*  \f$c\f$. The permuted matrix \f$A_{mc}\f$ is sorted.
+*
+*  Given a distance-1 coloring of \f$A\f$, e.g. computed by rocsparse_scsrcolor(), the
+*  diagonal blocks of \f$A_{mc}\f$ that correspond to each color are diagonal. The
+*  output is suitable for the multicolor factorizations rocsparse_scsrmcilu0() and
+*  rocsparse_scsrmcic0().
+*
+*  \p rocsparse_csrcolor_permute requires a temporary storage buffer, which size is
+*  returned by rocsparse_csrcolor_permute_buffer_size().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
-*  handle       handle to the rocsparse library context queue.
+*  handle         handle to the rocsparse library context queue.
 *  @param[in]
-*  opA      dense matrix \f$A\f$ operation type.
+*  m              number of rows of the sparse CSR matrix.
 *  @param[in]
-*  opB      dense matrix \f$B\f$ operation type.
+*  nnz            number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  alpha        scalar \f$\alpha\f$.
+*  descr          descriptor of the sparse CSR matrix.
 *  @param[in]
-*  A            dense matrix \f$A\f$ descriptor.
+*  csr_val        array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  B            dense matrix \f$B\f$ descriptor.
+*  csr_row_ptr    array of \p m+1 elements that point to the start of every row of the
+*                 sparse CSR matrix.
 *  @param[in]
-*  beta         scalar \f$\beta\f$.
-*  @param[inout]
-*  C            sparse matrix \f$C\f$ descriptor.
+*  csr_col_ind    array of \p nnz elements containing the column indices of the sparse
+*                 CSR matrix.
 *  @param[in]
-*  compute_type floating point precision for the SDDMM computation.
+*  ncolors        number of colors.
 *  @param[in]
-*  alg specification of the algorithm to use.
+*  coloring       array of \p m elements containing the color of each row, in the range
+*                 \f$[0, \text{ncolors})\f$.
+*  @param[out]
+*  perm           array of \p m elements containing the permutation.
+*  @param[out]
+*  color_ptr      array of \p ncolors+1 elements that point to the first row of every
+*                 color of the permuted matrix.
+*  @param[out]
+*  csr_val_mc     array of \p nnz elements of the permuted sparse CSR matrix.
+*  @param[out]
+*  csr_row_ptr_mc array of \p m+1 elements that point to the start of every row of the
+*                 permuted sparse CSR matrix.
+*  @param[out]
+*  csr_col_ind_mc array of \p nnz elements containing the column indices of the
+*                 permuted sparse CSR matrix.
 *  @param[in]
-*  temp_buffer  temporary storage buffer allocated by the user.
-*  The size must be greater or equal to the size obtained with \ref rocsparse_sddmm_buffer_size.
+*  temp_buffer    temporary storage buffer allocated by the user, size is returned by
+*                 rocsparse_csrcolor_permute_buffer_size().
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_value the value of \p trans\_A, \p trans\_B, \p compute\_type or alg is incorrect.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p A, \p B, \p D, \p C or \p temp_buffer pointer is invalid.
-*  \retval rocsparse_status_not_implemented
-*          \p opA == \ref rocsparse_operation_conjugate_transpose or
-*          \p opB == \ref rocsparse_operation_conjugate_transpose.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p ncolors is invalid.
+*  \retval     rocsparse_status_invalid_value \ref rocsparse_index_base is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p coloring, \p perm, \p color_ptr, \p csr_val_mc,
+*              \p csr_row_ptr_mc, \p csr_col_ind_mc or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sddmm(rocsparse_handle            handle,
-                                 rocsparse_operation         opA,
-                                 rocsparse_operation         opB,
-                                 const void*                 alpha,
-                                 const rocsparse_dnmat_descr A,
-                                 const rocsparse_dnmat_descr B,
-                                 const void*                 beta,
-                                 rocsparse_spmat_descr       C,
-                                 rocsparse_datatype          compute_type,
-                                 rocsparse_sddmm_alg         alg,
-                                 void*                       temp_buffer);
+rocsparse_status rocsparse_scsrcolor_permute(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             ncolors,
+                                             const rocsparse_int*      coloring,
+                                             rocsparse_int*            perm,
+                                             rocsparse_int*            color_ptr,
+                                             float*                    csr_val_mc,
+                                             rocsparse_int*            csr_row_ptr_mc,
+                                             rocsparse_int*            csr_col_ind_mc,
+                                             void*                     temp_buffer);
 
-/*! \ingroup generic_module
-*  \brief Calculate the size in bytes of the required buffer for the use of \ref rocsparse_sddmm and \ref rocsparse_sddmm_preprocess
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcolor_permute(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             ncolors,
+                                             const rocsparse_int*      coloring,
+                                             rocsparse_int*            perm,
+                                             rocsparse_int*            color_ptr,
+                                             double*                   csr_val_mc,
+                                             rocsparse_int*            csr_row_ptr_mc,
+                                             rocsparse_int*            csr_col_ind_mc,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrcolor_permute(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_int                  ncolors,
+                                             const rocsparse_int*           coloring,
+                                             rocsparse_int*                 perm,
+                                             rocsparse_int*                 color_ptr,
+                                             rocsparse_float_complex*       csr_val_mc,
+                                             rocsparse_int*                 csr_row_ptr_mc,
+                                             rocsparse_int*                 csr_col_ind_mc,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrcolor_permute(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_int                   ncolors,
+                                             const rocsparse_int*            coloring,
+                                             rocsparse_int*                  perm,
+                                             rocsparse_int*                  color_ptr,
+                                             rocsparse_double_complex*       csr_val_mc,
+                                             rocsparse_int*                  csr_row_ptr_mc,
+                                             rocsparse_int*                  csr_col_ind_mc,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup reordering_module
+*  \brief Symmetric permutation of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrpermute_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrpermute(), rocsparse_dcsrpermute(),
+*  rocsparse_ccsrpermute() and rocsparse_zcsrpermute(). The temporary storage buffer
+*  must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrpermute(), rocsparse_dcsrpermute(), rocsparse_ccsrpermute()
+*              and rocsparse_zcsrpermute().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+*              or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrpermute_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  size_t*                   buffer_size);
+
+/*! \ingroup reordering_module
+*  \brief Symmetric permutation of a sparse CSR matrix
 *
 *  \details
-*  \ref rocsparse_sddmm_buffer_size returns the size of the required buffer to execute the SDDMM operation from a given configuration.
-*  @param[in]
-*  handle       handle to the rocsparse library context queue.
+*  \p rocsparse_csrpermute applies the symmetric permutation
+*  \f[
+*    A_{perm} = P A P^T
+*  \f]
+*  to a sparse \f$m \times m\f$ CSR matrix \f$A\f$, where the permutation \f$P\f$ is
+*  given by \p perm, with row \p i of \f$A_{perm}\f$ being row \p perm[i] of \f$A\f$.
+*  The column indices of \f$A_{perm}\f$ are sorted. \p perm is zero based, e.g. as
+*  returned by rocsparse_csrrcm() or rocsparse_csramd().
+*
+*  \p rocsparse_csrpermute requires a temporary storage buffer, which size is returned
+*  by rocsparse_csrpermute_buffer_size().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
 *  @param[in]
-*  opA      dense matrix \f$A\f$ operation type.
+*  handle           handle to the rocsparse library context queue.
 *  @param[in]
-*  opB      dense matrix \f$B\f$ operation type.
+*  m                number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  alpha        scalar \f$\alpha\f$.
+*  nnz              number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  A            dense matrix \f$A\f$ descriptor.
+*  descr            descriptor of the sparse CSR matrix.
 *  @param[in]
-*  B            dense matrix \f$B\f$ descriptor.
+*  csr_val          array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  beta         scalar \f$\beta\f$.
-*  @param[inout]
-*  C            sparse matrix \f$C\f$ descriptor.
+*  csr_row_ptr      array of \p m+1 elements that point to the start of every row of
+*                   the sparse CSR matrix.
 *  @param[in]
-*  compute_type floating point precision for the SDDMM computation.
+*  csr_col_ind      array of \p nnz elements containing the column indices of the
+*                   sparse CSR matrix.
 *  @param[in]
-*  alg specification of the algorithm to use.
+*  perm             array of \p m elements containing the permutation.
 *  @param[out]
-*  buffer_size  number of bytes of the temporary storage buffer.
+*  csr_val_perm     array of \p nnz elements of the permuted sparse CSR matrix.
+*  @param[out]
+*  csr_row_ptr_perm array of \p m+1 elements that point to the start of every row of
+*                   the permuted sparse CSR matrix.
+*  @param[out]
+*  csr_col_ind_perm array of \p nnz elements containing the column indices of the
+*                   permuted sparse CSR matrix.
+*  @param[in]
+*  temp_buffer      temporary storage buffer allocated by the user, size is returned by
+*                   rocsparse_csrpermute_buffer_size().
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_value the value of \p trans\_A or \p trans\_B is incorrect.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p A, \p B, \p D, \p C or \p buffer_size pointer is invalid.
-*  \retval rocsparse_status_not_implemented
-*          \p opA == \ref rocsparse_operation_conjugate_transpose or
-*          \p opB == \ref rocsparse_operation_conjugate_transpose.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \ref rocsparse_index_base is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p perm, \p csr_val_perm, \p csr_row_ptr_perm,
+*              \p csr_col_ind_perm or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sddmm_buffer_size(rocsparse_handle            handle,
-                                             rocsparse_operation         opA,
-                                             rocsparse_operation         opB,
-                                             const void*                 alpha,
-                                             const rocsparse_dnmat_descr A,
-                                             const rocsparse_dnmat_descr B,
-                                             const void*                 beta,
-                                             rocsparse_spmat_descr       C,
-                                             rocsparse_datatype          compute_type,
-                                             rocsparse_sddmm_alg         alg,
-                                             size_t*                     buffer_size);
+rocsparse_status rocsparse_scsrpermute(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const float*              csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       const rocsparse_int*      perm,
+                                       float*                    csr_val_perm,
+                                       rocsparse_int*            csr_row_ptr_perm,
+                                       rocsparse_int*            csr_col_ind_perm,
+                                       void*                     temp_buffer);
 
-/*! \ingroup generic_module
-*  \brief Preprocess data before the use of \ref rocsparse_sddmm.
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrpermute(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const double*             csr_val,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       const rocsparse_int*      perm,
+                                       double*                   csr_val_perm,
+                                       rocsparse_int*            csr_row_ptr_perm,
+                                       rocsparse_int*            csr_col_ind_perm,
+                                       void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrpermute(rocsparse_handle               handle,
+                                       rocsparse_int                  m,
+                                       rocsparse_int                  nnz,
+                                       const rocsparse_mat_descr      descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int*           csr_row_ptr,
+                                       const rocsparse_int*           csr_col_ind,
+                                       const rocsparse_int*           perm,
+                                       rocsparse_float_complex*       csr_val_perm,
+                                       rocsparse_int*                 csr_row_ptr_perm,
+                                       rocsparse_int*                 csr_col_ind_perm,
+                                       void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrpermute(rocsparse_handle                handle,
+                                       rocsparse_int                   m,
+                                       rocsparse_int                   nnz,
+                                       const rocsparse_mat_descr       descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int*            csr_row_ptr,
+                                       const rocsparse_int*            csr_col_ind,
+                                       const rocsparse_int*            perm,
+                                       rocsparse_double_complex*       csr_val_perm,
+                                       rocsparse_int*                  csr_row_ptr_perm,
+                                       rocsparse_int*                  csr_col_ind_perm,
+                                       void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup reordering_module
+*  \brief Reverse Cuthill-McKee ordering of a sparse CSR matrix
 *
 *  \details
-*  \ref rocsparse_sddmm_preprocess executes a part of the algorithm that can be calculated once in the context of multiple calls of the \ref rocsparse_sddmm
-*  with the same sparsity pattern.
+*  \p rocsparse_csrrcm_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_csrrcm(). The temporary storage buffer must be allocated by
+*  the user.
+*
 *  @param[in]
-*  handle       handle to the rocsparse library context queue.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  opA      dense matrix \f$A\f$ operation type.
+*  m           number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  opB      dense matrix \f$B\f$ operation type.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  alpha        scalar \f$\alpha\f$.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  A            dense matrix \f$A\f$ descriptor.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
-*  B            dense matrix \f$B\f$ descriptor.
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_csrrcm().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+*              or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrcm_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              size_t*                   buffer_size);
+
+/*! \ingroup reordering_module
+*  \brief Reverse Cuthill-McKee ordering of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrrcm computes the reverse Cuthill-McKee ordering of the adjacency
+*  graph of a sparse \f$m \times m\f$ CSR matrix, which reduces the bandwidth and
+*  profile of the matrix and improves the locality of accesses to \f$x\f$ in sparse
+*  matrix vector products. Row \p i of the reordered matrix is row \p perm[i] of the
+*  original matrix; the reordered matrix can be computed with rocsparse_scsrpermute().
+*
+*  Each connected component is traversed by a level synchronous breadth first search on
+*  the device, starting from a pseudo-peripheral node found by the algorithm of George
+*  and Liu. The nodes of each level are ordered by the position of their parent and by
+*  degree. Nodes without off-diagonal entries are ordered last. The ordering is
+*  deterministic.
+*
+*  \p rocsparse_csrrcm requires a temporary storage buffer, which size is returned by
+*  rocsparse_csrrcm_buffer_size().
+*
+*  \note
+*  The sparsity pattern of the matrix is expected to be symmetric.
+*
+*  \note
+*  This function is blocking with respect to the host, the number of nodes of each
+*  level is transferred to the host.
+*
 *  @param[in]
-*  beta         scalar \f$\beta\f$.
-*  @param[inout]
-*  C            sparse matrix \f$C\f$ descriptor.
+*  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  compute_type floating point precision for the SDDMM computation.
+*  m           number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  alg specification of the algorithm to use.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  temp_buffer  temporary storage buffer allocated by the user.
-*  The size must be greater or equal to the size obtained with \ref rocsparse_sddmm_buffer_size.
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  perm        array of \p m elements containing the zero based permutation.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user, size is returned by
+*              rocsparse_csrrcm_buffer_size().
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_value the value of \p trans\_A or \p trans\_B is incorrect.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p A, \p B, \p D, \p C or \p temp_buffer pointer is invalid.
-*  \retval rocsparse_status_not_implemented
-*          \p opA == \ref rocsparse_operation_conjugate_transpose or
-*          \p opB == \ref rocsparse_operation_conjugate_transpose.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \ref rocsparse_index_base is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p perm or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle            handle,
-                                            rocsparse_operation         opA,
-                                            rocsparse_operation         opB,
-                                            const void*                 alpha,
-                                            const rocsparse_dnmat_descr A,
-                                            const rocsparse_dnmat_descr B,
-                                            const void*                 beta,
-                                            rocsparse_spmat_descr       C,
-                                            rocsparse_datatype          compute_type,
-                                            rocsparse_sddmm_alg         alg,
-                                            void*                       temp_buffer);
+rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_int*            perm,
+                                  void*                     temp_buffer);
 
 /*! \ingroup reordering_module
-*  \brief Coloring of the adjacency graph of the matrix \f$A\f$ stored in the CSR format.
+*  \brief Approximate minimum degree ordering of a sparse CSR matrix
 *
 *  \details
-*  \p rocsparse_csrcolor performs the coloring of the undirected graph represented by the (symmetric) sparsity pattern of the matrix \f$A\f$ stored in CSR format. Graph coloring is a way of coloring the nodes of a graph such that no two adjacent nodes are of the same color. The \p fraction_to_color is a parameter to only color a given percentage of the graph nodes, the remaining uncolored nodes receive distinct new colors. The optional \p reordering array is a permutation array such that unknowns of the same color are grouped. The matrix \f$A\f$ must be stored as a general matrix with a symmetric sparsity pattern, and if the matrix \f$A\f$ is non-symmetric then the user is responsible to provide the symmetric part \f$\frac{A+A^T}{2}\f$.
+*  \p rocsparse_csramd computes a fill reducing ordering of a sparse \f$m \times m\f$
+*  CSR matrix by approximate minimum degree elimination on the quotient graph of
+*  \f$A + A^T\f$. The external degree of each node is approximated by the bound of
+*  Amestoy, Davis and Duff. Row \p i of the reordered matrix is row \p perm[i] of the
+*  original matrix; the reordered matrix can be computed with rocsparse_scsrpermute()
+*  prior to an incomplete factorization, e.g. rocsparse_scsrilu0().
+*
+*  \note
+*  The elimination is inherently sequential and is performed on the host. The sparsity
+*  pattern is transferred to the host and the permutation is transferred back to the
+*  device, hence this function is blocking with respect to the host.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of sparse matrix \f$A\f$.
-*  @param[in]
-*  nnz         number of non-zero entries of sparse matrix \f$A\f$.
+*  m           number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  descr      sparse matrix descriptor.
+*  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
 *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
 *              sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
-*  @param[in]
-*  fraction_to_color  fraction of nodes to be colored, which should be in the interval [0.0,1.0], for example 0.8 implies that 80 percent of nodes will be colored.
-*  @param[out]
-*  ncolors     	resulting number of distinct colors.
-*  @param[out]
-*  coloring     resulting mapping of colors.
 *  @param[out]
-*  reordering 	optional resulting reordering permutation if \p reordering is a non-null pointer.
-*  @param[inout]
-*  info    structure that holds the information collected during the coloring algorithm.
+*  perm        array of \p m elements containing the zero based permutation.
 *
-*  \retval rocsparse_status_success the operation completed successfully.
-*  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr, \p csr_col_ind, \p fraction_to_color, \p ncolors, \p coloring or \p info pointer is invalid.
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \ref rocsparse_index_base is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind or \p perm pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrcolor(rocsparse_handle          handle,
-                                     rocsparse_int             m,
-                                     rocsparse_int             nnz,
-                                     const rocsparse_mat_descr descr,
-                                     const float*              csr_val,
-                                     const rocsparse_int*      csr_row_ptr,
-                                     const rocsparse_int*      csr_col_ind,
-                                     const float*              fraction_to_color,
-                                     rocsparse_int*            ncolors,
-                                     rocsparse_int*            coloring,
-                                     rocsparse_int*            reordering,
-                                     rocsparse_mat_info        info);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrcolor(rocsparse_handle          handle,
-                                     rocsparse_int             m,
-                                     rocsparse_int             nnz,
-                                     const rocsparse_mat_descr descr,
-                                     const double*             csr_val,
-                                     const rocsparse_int*      csr_row_ptr,
-                                     const rocsparse_int*      csr_col_ind,
-                                     const double*             fraction_to_color,
-                                     rocsparse_int*            ncolors,
-                                     rocsparse_int*            coloring,
-                                     rocsparse_int*            reordering,
-                                     rocsparse_mat_info        info);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrcolor(rocsparse_handle               handle,
-                                     rocsparse_int                  m,
-                                     rocsparse_int                  nnz,
-                                     const rocsparse_mat_descr      descr,
-                                     const rocsparse_float_complex* csr_val,
-                                     const rocsparse_int*           csr_row_ptr,
-                                     const rocsparse_int*           csr_col_ind,
-                                     const float*                   fraction_to_color,
-                                     rocsparse_int*                 ncolors,
-                                     rocsparse_int*                 coloring,
-                                     rocsparse_int*                 reordering,
-                                     rocsparse_mat_info             info);
-
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrcolor(rocsparse_handle                handle,
-                                     rocsparse_int                   m,
-                                     rocsparse_int                   nnz,
-                                     const rocsparse_mat_descr       descr,
-                                     const rocsparse_double_complex* csr_val,
-                                     const rocsparse_int*            csr_row_ptr,
-                                     const rocsparse_int*            csr_col_ind,
-                                     const double*                   fraction_to_color,
-                                     rocsparse_int*                  ncolors,
-                                     rocsparse_int*                  coloring,
-                                     rocsparse_int*                  reordering,
-                                     rocsparse_mat_info              info);
-
-/**@}*/
+rocsparse_status rocsparse_csramd(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_int*            perm);
 
 #ifdef __cplusplus
 }
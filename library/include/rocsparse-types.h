@@ -240,13 +240,78 @@ typedef enum rocsparse_analysis_policy_
  *  \brief Specify policy in triangular solvers and factorizations.
  *
  *  \details
- *  This is a placeholder.
+ *  The \ref rocsparse_solve_policy specifies how the dependencies between the rows of a
+ *  triangular matrix are resolved. \ref rocsparse_solve_policy_auto lets each row wait
+ *  until the rows it depends on are solved, within a single kernel launch.
+ *  \ref rocsparse_solve_policy_level solves the rows level by level, using the level
+ *  information gathered during the analysis. \ref rocsparse_solve_policy_push only
+ *  affects transposed solves. When passed to the analysis, no transposed copy of the
+ *  matrix is created. Instead, the solve pushes the contribution of each solved row to
+ *  the remaining rows, operating on the non-transposed matrix.
+ *  \ref rocsparse_solve_policy_jacobi approximates the solution by a fixed number of
+ *  Jacobi sweeps, updating all rows concurrently in each sweep. Currently,
+ *  \ref rocsparse_solve_policy_level, \ref rocsparse_solve_policy_push and
+ *  \ref rocsparse_solve_policy_jacobi are only supported by rocsparse_csrsv_analysis()
+ *  and rocsparse_csrsv_solve(). All other routines treat them as
+ *  \ref rocsparse_solve_policy_auto.
  */
 typedef enum rocsparse_solve_policy_
 {
-    rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
+    rocsparse_solve_policy_auto   = 0, /**< automatically decide on level information. */
+    rocsparse_solve_policy_level  = 1, /**< one kernel launch per level or group of levels. */
+    rocsparse_solve_policy_push   = 2, /**< transposed solve without transposed matrix. */
+    rocsparse_solve_policy_jacobi = 3 /**< approximate solve by Jacobi sweeps. */
 } rocsparse_solve_policy;
 
+/*! \ingroup types_module
+ *  \brief List of graph coloring algorithms.
+ *
+ *  \details
+ *  The \ref rocsparse_color_alg specifies the coloring that is computed by
+ *  rocsparse_scsrcolor(), rocsparse_dcsrcolor(), rocsparse_ccsrcolor() and
+ *  rocsparse_zcsrcolor(). With \ref rocsparse_color_alg_jpl, no two adjacent nodes share
+ *  the same color. With \ref rocsparse_color_alg_jpl_distance2, additionally no two nodes
+ *  with a common neighbor share the same color. The algorithm can be set by
+ *  rocsparse_csrcolor_options().
+ */
+typedef enum rocsparse_color_alg_
+{
+    rocsparse_color_alg_jpl           = 0, /**< distance-1 Jones-Plassmann-Luby coloring. */
+    rocsparse_color_alg_jpl_distance2 = 1 /**< distance-2 Jones-Plassmann-Luby coloring. */
+} rocsparse_color_alg;
+
+/*! \ingroup types_module
+ *  \brief List of interleaved batched tridiagonal solver algorithms.
+ *
+ *  \details
+ *  The \ref rocsparse_gtsv_interleaved_alg specifies the algorithm that is used by
+ *  rocsparse_sgtsv_interleaved_batch(), rocsparse_dgtsv_interleaved_batch(),
+ *  rocsparse_cgtsv_interleaved_batch() and rocsparse_zgtsv_interleaved_batch().
+ *  \ref rocsparse_gtsv_interleaved_alg_thomas does not pivot and requires the systems to
+ *  be diagonally dominant or otherwise stable without pivoting.
+ */
+typedef enum rocsparse_gtsv_interleaved_alg_
+{
+    rocsparse_gtsv_interleaved_alg_default = 0, /**< same as rocsparse_gtsv_interleaved_alg_lu. */
+    rocsparse_gtsv_interleaved_alg_thomas  = 1, /**< Thomas algorithm without pivoting. */
+    rocsparse_gtsv_interleaved_alg_lu      = 2, /**< LU factorization with partial pivoting. */
+    rocsparse_gtsv_interleaved_alg_qr      = 3 /**< QR factorization by Givens rotations. */
+} rocsparse_gtsv_interleaved_alg;
+
+/*! \ingroup types_module
+ *  \brief List of interleaved batched pentadiagonal solver algorithms.
+ *
+ *  \details
+ *  The \ref rocsparse_gpsv_interleaved_alg specifies the algorithm that is used by
+ *  rocsparse_sgpsv_interleaved_batch(), rocsparse_dgpsv_interleaved_batch(),
+ *  rocsparse_cgpsv_interleaved_batch() and rocsparse_zgpsv_interleaved_batch().
+ */
+typedef enum rocsparse_gpsv_interleaved_alg_
+{
+    rocsparse_gpsv_interleaved_alg_default = 0, /**< same as rocsparse_gpsv_interleaved_alg_qr. */
+    rocsparse_gpsv_interleaved_alg_qr      = 1 /**< QR factorization by Givens rotations. */
+} rocsparse_gpsv_interleaved_alg;
+
 /*! \ingroup types_module
  *  \brief Indicates if the pointer is device pointer or host pointer.
  *
@@ -319,10 +384,13 @@ typedef enum rocsparse_indextype_
  */
 typedef enum rocsparse_datatype_
 {
-    rocsparse_datatype_f32_r = 151, /**< 32 bit floating point, real. */
-    rocsparse_datatype_f64_r = 152, /**< 64 bit floating point, real. */
-    rocsparse_datatype_f32_c = 154, /**< 32 bit floating point, complex. */
-    rocsparse_datatype_f64_c = 155 /**< 64 bit floating point, complex. */
+    rocsparse_datatype_f16_r  = 150, /**< 16 bit floating point, real. */
+    rocsparse_datatype_f32_r  = 151, /**< 32 bit floating point, real. */
+    rocsparse_datatype_f64_r  = 152, /**< 64 bit floating point, real. */
+    rocsparse_datatype_f32_c  = 154, /**< 32 bit floating point, complex. */
+    rocsparse_datatype_f64_c  = 155, /**< 64 bit floating point, complex. */
+    rocsparse_datatype_i8_r   = 160, /**< 8 bit signed integer, real. */
+    rocsparse_datatype_bf16_r = 168 /**< 16 bit bfloat16 floating point, real. */
 } rocsparse_datatype;
 
 /*! \ingroup types_module
@@ -338,9 +406,25 @@ typedef enum rocsparse_format_
     rocsparse_format_coo_aos = 1, /**< COO AoS sparse matrix format. */
     rocsparse_format_csr     = 2, /**< CSR sparse matrix format. */
     rocsparse_format_csc     = 3, /**< CSC sparse matrix format. */
-    rocsparse_format_ell     = 4 /**< ELL sparse matrix format. */
+    rocsparse_format_ell     = 4, /**< ELL sparse matrix format. */
+    rocsparse_format_bsr     = 5, /**< BSR sparse matrix format. */
+    rocsparse_format_sell    = 6 /**< SELL-C-sigma sparse matrix format. */
 } rocsparse_format;
 
+/*! \ingroup types_module
+ *  \brief List of sparse matrix attributes.
+ *
+ *  \details
+ *  This is a list of the \ref rocsparse_spmat_attribute types that can be set on or
+ *  queried from a sparse matrix descriptor.
+ */
+typedef enum rocsparse_spmat_attribute_
+{
+    rocsparse_spmat_fill_mode   = 0, /**< Fill mode, see \ref rocsparse_fill_mode. */
+    rocsparse_spmat_diag_type   = 1, /**< Diagonal type, see \ref rocsparse_diag_type. */
+    rocsparse_spmat_matrix_type = 2 /**< Matrix type, see \ref rocsparse_matrix_type. */
+} rocsparse_spmat_attribute;
+
 /*! \ingroup types_module
  *  \brief List of dense matrix ordering.
  *
@@ -367,7 +451,10 @@ typedef enum rocsparse_spmv_alg_
     rocsparse_spmv_alg_coo          = 1, /**< COO SpMV algorithm for COO matrices. */
     rocsparse_spmv_alg_csr_adaptive = 2, /**< CSR SpMV algorithm 1 (adaptive) for CSR matrices. */
     rocsparse_spmv_alg_csr_stream   = 3, /**< CSR SpMV algorithm 2 (stream) for CSR matrices. */
-    rocsparse_spmv_alg_ell          = 4 /**< ELL SpMV algorithm for ELL matrices. */
+    rocsparse_spmv_alg_ell          = 4, /**< ELL SpMV algorithm for ELL matrices. */
+    rocsparse_spmv_alg_csr_merge    = 5, /**< CSR SpMV algorithm 3 (merge path) for CSR matrices. */
+    rocsparse_spmv_alg_sell         = 6, /**< SELL SpMV algorithm for SELL-C-sigma matrices. */
+    rocsparse_spmv_alg_auto         = 7 /**< Autotuned SpMV algorithm, selected by timing. */
 } rocsparse_spmv_alg;
 
 /*! \ingroup types_module
@@ -451,13 +538,20 @@ typedef enum rocsparse_spmm_stage_
  *  \details
  *  This is a list of possible stages during SpGEMM computation. Typical order is
  *  rocsparse_spgemm_buffer_size, rocsparse_spgemm_nnz, rocsparse_spgemm_compute.
+ *  If SpGEMM is performed repeatedly on matrices with unchanged sparsity patterns,
+ *  rocsparse_spgemm_compute can be replaced by a single rocsparse_spgemm_symbolic,
+ *  followed by any number of rocsparse_spgemm_numeric stages.
  */
 typedef enum rocsparse_spgemm_stage_
 {
     rocsparse_spgemm_stage_auto        = 0, /**< Automatic stage detection. */
     rocsparse_spgemm_stage_buffer_size = 1, /**< Returns the required buffer size. */
     rocsparse_spgemm_stage_nnz         = 2, /**< Computes number of non-zero entries. */
-    rocsparse_spgemm_stage_compute     = 3 /**< Performs the actual SpGEMM computation. */
+    rocsparse_spgemm_stage_compute     = 3, /**< Performs the actual SpGEMM computation. */
+    rocsparse_spgemm_stage_symbolic    = 4, /**< Performs the SpGEMM computation and keeps
+                                                 the structure of C for numeric stages. */
+    rocsparse_spgemm_stage_numeric     = 5 /**< Re-computes the values of C only, using the
+                                                structure of C from the symbolic stage. */
 } rocsparse_spgemm_stage;
 
 /*! \ingroup types_module
@@ -465,13 +559,60 @@ typedef enum rocsparse_spgemm_stage_
  *
  *  \details
  *  This is a list of supported \ref rocsparse_spgemm_alg types that are used to perform
- *  sparse matrix sparse matrix product.
+ *  sparse matrix sparse matrix product. The rows of \f$C\f$ are accumulated in groups of
+ *  similar size. \ref rocsparse_spgemm_alg_dense_acc accumulates the rows of a group
+ *  densely, if a full row of \f$C\f$ fits into shared memory. \ref rocsparse_spgemm_alg_esc
+ *  expands, sorts and compresses (ESC) the intermediate products of a group, if the
+ *  intermediate products of each of its rows fit into shared memory. This requires an
+ *  additional pass over the rows of \f$A\f$ to count the intermediate products, and pays
+ *  off for groups of low compression only. All other groups and very short rows are always
+ *  hashed. \ref rocsparse_spgemm_alg_default selects the accumulator per group: dense if a
+ *  full row of \f$C\f$ fits into shared memory, ESC for groups of low compression and a
+ *  hash table otherwise.
  */
 typedef enum rocsparse_spgemm_alg_
 {
-    rocsparse_spgemm_alg_default = 0 /**< Default SpGEMM algorithm for the given format. */
+    rocsparse_spgemm_alg_default   = 0, /**< Default SpGEMM algorithm for the given format. */
+    rocsparse_spgemm_alg_esc       = 1, /**< Expand, sort and compress (ESC) algorithm. */
+    rocsparse_spgemm_alg_dense_acc = 2 /**< Dense accumulator algorithm. */
 } rocsparse_spgemm_alg;
 
+/*! \ingroup types_module
+ *  \brief List of SpGEMM mask types.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_spgemm_mask types that are used by
+ *  \ref rocsparse_spgemm_masked to restrict the sparsity pattern of \f$C\f$ by the
+ *  sparsity pattern of a mask matrix \f$M\f$. Only the structure of \f$M\f$ is taken
+ *  into account, its values are ignored.
+ */
+typedef enum rocsparse_spgemm_mask_
+{
+    rocsparse_spgemm_mask_structural = 0, /**< C is restricted to the pattern of M. */
+    rocsparse_spgemm_mask_complement = 1 /**< C is restricted to the complement of M. */
+} rocsparse_spgemm_mask;
+
+/*! \ingroup types_module
+ *  \brief Callback receiving a finished row range of a chunked SpGEMM.
+ *
+ *  \details
+ *  \ref rocsparse_spgemm_chunk_callback is called by \ref rocsparse_spgemm_chunked for
+ *  each chunk of rows \p row_begin to \p row_end (exclusive) of \f$C\f$, in ascending
+ *  order. \p csr_row_ptr holds \p row_end - \p row_begin + 1 offsets into the \p nnz
+ *  column indices \p csr_col_ind and values \p csr_val of the chunk, starting at the
+ *  index base of \f$C\f$. The arrays are stored in pinned host memory, using the index
+ *  and data types of \f$C\f$, and are only valid until the callback returns. If the
+ *  callback does not return \ref rocsparse_status_success, the computation is aborted
+ *  and the status is returned by \ref rocsparse_spgemm_chunked.
+ */
+typedef rocsparse_status (*rocsparse_spgemm_chunk_callback)(int64_t     row_begin,
+                                                             int64_t     row_end,
+                                                             int64_t     nnz,
+                                                             const void* csr_row_ptr,
+                                                             const void* csr_col_ind,
+                                                             const void* csr_val,
+                                                             void*       user_data);
+
 #ifdef __cplusplus
 }
 #endif
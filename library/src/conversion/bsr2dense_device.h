@@ -0,0 +1,82 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSR2DENSE_DEVICE_H
+#define BSR2DENSE_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// One thread block per block row, the threads stride over all entries of the
+// blocks in the block row
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void bsr2dense_kernel(rocsparse_direction  dir,
+                                                              J                    mb,
+                                                              J                    block_dim,
+                                                              I                    ld,
+                                                              rocsparse_index_base base,
+                                                              const T*             bsr_val,
+                                                              const I*             bsr_row_ptr,
+                                                              const J*             bsr_col_ind,
+                                                              T*                   A,
+                                                              rocsparse_order      order)
+{
+    J brow = hipBlockIdx_x;
+
+    if(brow >= mb)
+    {
+        return;
+    }
+
+    I block_size = static_cast<I>(block_dim) * block_dim;
+
+    I start = bsr_row_ptr[brow] - base;
+    I end   = bsr_row_ptr[brow + 1] - base;
+    I size  = (end - start) * block_size;
+
+    for(I idx = hipThreadIdx_x; idx < size; idx += BLOCKSIZE)
+    {
+        I k     = start + idx / block_size;
+        J local = idx % block_size;
+
+        J bi = (dir == rocsparse_direction_row) ? local / block_dim : local % block_dim;
+        J bj = (dir == rocsparse_direction_row) ? local % block_dim : local / block_dim;
+
+        I row = static_cast<I>(brow) * block_dim + bi;
+        I col = static_cast<I>(bsr_col_ind[k] - base) * block_dim + bj;
+
+        T val = bsr_val[start * block_size + idx];
+
+        if(order == rocsparse_order_column)
+        {
+            A[ld * col + row] = val;
+        }
+        else
+        {
+            A[ld * row + col] = val;
+        }
+    }
+}
+
+#endif // BSR2DENSE_DEVICE_H
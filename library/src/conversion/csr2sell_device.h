@@ -0,0 +1,172 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSR2SELL_DEVICE_H
+#define CSR2SELL_DEVICE_H
+
+#include "common.h"
+#include "handle.h"
+
+// Compute non-zero entries per CSR row, together with the row index that is
+// permuted alongside by the sort within the sigma windows
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sell_row_nnz_kernel(rocsparse_int        m,
+                                 const rocsparse_int* csr_row_ptr,
+                                 rocsparse_int*       row_nnz,
+                                 rocsparse_int*       row_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    row_nnz[gid] = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+    row_ind[gid] = gid;
+}
+
+// Compute the begin of each sigma window, that are the segments of the sort
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2sell_window_ptr_kernel(rocsparse_int  m,
+                                                                        rocsparse_int  sigma,
+                                                                        rocsparse_int  nwindows,
+                                                                        rocsparse_int* window_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid > nwindows)
+    {
+        return;
+    }
+
+    window_ptr[gid] = min(gid * sigma, m);
+}
+
+// Compute the number of stored entries of each slice, which is the slice size times
+// the maximum number of non-zero entries of the (sorted) rows within the slice
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2sell_slice_nnz_kernel(rocsparse_int        m,
+                                   rocsparse_int        slice_size,
+                                   rocsparse_int        nslices,
+                                   const rocsparse_int* row_nnz,
+                                   rocsparse_int*       sell_slice_ptr,
+                                   rocsparse_index_base sell_idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        sell_slice_ptr[0] = sell_idx_base;
+    }
+
+    if(gid >= nslices)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = gid * slice_size;
+    rocsparse_int row_end   = min(row_begin + slice_size, m);
+
+    rocsparse_int width = 0;
+    for(rocsparse_int i = row_begin; i < row_end; ++i)
+    {
+        width = max(width, row_nnz[i]);
+    }
+
+    sell_slice_ptr[gid + 1] = width * slice_size;
+}
+
+// Compute the total number of stored SELL entries, including padding
+__global__ void csr2sell_nnz_total_kernel(rocsparse_int        nslices,
+                                          const rocsparse_int* sell_slice_ptr,
+                                          rocsparse_int*       sell_nnz)
+{
+    if(hipThreadIdx_x == 0)
+    {
+        *sell_nnz = sell_slice_ptr[nslices] - sell_slice_ptr[0];
+    }
+}
+
+// CSR to SELL format conversion kernel. Each thread processes one (permuted) row of a
+// slice, including the rows that pad the last slice.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csr2sell_kernel(rocsparse_int        m,
+                                                             const T*             csr_val,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             rocsparse_index_base csr_idx_base,
+                                                             rocsparse_int        slice_size,
+                                                             rocsparse_int        nslices,
+                                                             const rocsparse_int* sell_slice_ptr,
+                                                             const rocsparse_int* sell_perm,
+                                                             rocsparse_int*       sell_col_ind,
+                                                             T*                   sell_val,
+                                                             rocsparse_index_base sell_idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nslices * slice_size)
+    {
+        return;
+    }
+
+    rocsparse_int slice = gid / slice_size;
+    rocsparse_int lane  = gid - slice * slice_size;
+
+    rocsparse_int slice_begin = sell_slice_ptr[slice] - sell_idx_base;
+    rocsparse_int slice_end   = sell_slice_ptr[slice + 1] - sell_idx_base;
+
+    rocsparse_int idx = slice_begin + lane;
+
+    // Fill SELL slice, entries of a row are strided by the slice size
+    if(gid < m)
+    {
+        rocsparse_int row = sell_perm[gid];
+
+        rocsparse_int row_begin = csr_row_ptr[row] - csr_idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - csr_idx_base;
+
+        for(rocsparse_int aj = row_begin; aj < row_end; ++aj)
+        {
+            sell_col_ind[idx] = csr_col_ind[aj] - csr_idx_base + sell_idx_base;
+            sell_val[idx]     = csr_val[aj];
+
+            idx += slice_size;
+        }
+    }
+
+    // Pad remaining SELL slice
+    for(; idx < slice_end; idx += slice_size)
+    {
+        sell_col_ind[idx] = -1;
+        sell_val[idx]     = static_cast<T>(0);
+    }
+}
+
+#endif // CSR2SELL_DEVICE_H
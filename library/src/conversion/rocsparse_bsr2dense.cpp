@@ -0,0 +1,162 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "utility.h"
+
+#include "rocsparse_bsr2dense.hpp"
+
+#include "bsr2dense_device.h"
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_bsr2dense_template(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              J                         mb,
+                                              J                         nb,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  bsr_val,
+                                              const I*                  bsr_row_ptr,
+                                              const J*                  bsr_col_ind,
+                                              J                         block_dim,
+                                              T*                        A,
+                                              I                         ld,
+                                              rocsparse_order           order)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsr2dense"),
+              dir,
+              mb,
+              nb,
+              descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)A,
+              ld);
+
+    // Check matrix descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Dense matrix sizes
+    I m = static_cast<I>(mb) * block_dim;
+    I n = static_cast<I>(nb) * block_dim;
+
+    // Check sizes
+    if(mb < 0 || nb < 0 || block_dim <= 0 || ld < (order == rocsparse_order_column ? m : n))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr || bsr_row_ptr == nullptr || bsr_col_ind == nullptr || A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    I mn = order == rocsparse_order_column ? m : n;
+    I nm = order == rocsparse_order_column ? n : m;
+
+    // Set memory to zero.
+    RETURN_IF_HIP_ERROR(hipMemset2DAsync(A, ld * sizeof(T), 0, mn * sizeof(T), nm, stream));
+
+#define BSR2DENSE_DIM 256
+    hipLaunchKernelGGL((bsr2dense_kernel<BSR2DENSE_DIM>),
+                       dim3(mb),
+                       dim3(BSR2DENSE_DIM),
+                       0,
+                       stream,
+                       dir,
+                       mb,
+                       block_dim,
+                       ld,
+                       descr->base,
+                       bsr_val,
+                       bsr_row_ptr,
+                       bsr_col_ind,
+                       A,
+                       order);
+#undef BSR2DENSE_DIM
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                         \
+    template rocsparse_status rocsparse_bsr2dense_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                        \
+        rocsparse_direction       dir,                                           \
+        JTYPE                     mb,                                            \
+        JTYPE                     nb,                                            \
+        const rocsparse_mat_descr descr,                                         \
+        const TTYPE*              bsr_val,                                       \
+        const ITYPE*              bsr_row_ptr,                                   \
+        const JTYPE*              bsr_col_ind,                                   \
+        JTYPE                     block_dim,                                     \
+        TTYPE*                    A,                                             \
+        ITYPE                     ld,                                            \
+        rocsparse_order           order);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+#undef INSTANTIATE
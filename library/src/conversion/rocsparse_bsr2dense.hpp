@@ -0,0 +1,45 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_BSR2DENSE_HPP
+#define ROCSPARSE_BSR2DENSE_HPP
+
+#include "handle.h"
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_bsr2dense_template(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              J                         mb,
+                                              J                         nb,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  bsr_val,
+                                              const I*                  bsr_row_ptr,
+                                              const J*                  bsr_col_ind,
+                                              J                         block_dim,
+                                              T*                        A,
+                                              I                         ld,
+                                              rocsparse_order           order);
+
+#endif // ROCSPARSE_BSR2DENSE_HPP
@@ -456,6 +456,28 @@ rocsparse_status rocsparse_csr2csr_compress_template(rocsparse_handle          h
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                                \
+    template rocsparse_status rocsparse_csr2csr_compress_template<TTYPE>( \
+        rocsparse_handle          handle,                                 \
+        rocsparse_int             m,                                      \
+        rocsparse_int             n,                                      \
+        const rocsparse_mat_descr descr_A,                                \
+        const TTYPE*              csr_val_A,                              \
+        const rocsparse_int*      csr_row_ptr_A,                          \
+        const rocsparse_int*      csr_col_ind_A,                          \
+        rocsparse_int             nnz_A,                                  \
+        const rocsparse_int*      nnz_per_row,                            \
+        TTYPE*                    csr_val_C,                              \
+        rocsparse_int*            csr_row_ptr_C,                          \
+        rocsparse_int*            csr_col_ind_C,                          \
+        TTYPE                     tol);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -0,0 +1,549 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csr2sell.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csr2sell_device.h"
+#include <rocprim/rocprim.hpp>
+
+template <typename T>
+rocsparse_status rocsparse_csr2sell_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             const rocsparse_mat_descr csr_descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             const rocsparse_mat_descr sell_descr,
+                                             rocsparse_int             sell_slice_size,
+                                             const rocsparse_int*      sell_slice_ptr,
+                                             const rocsparse_int*      sell_perm,
+                                             T*                        sell_val,
+                                             rocsparse_int*            sell_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2sell"),
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)sell_descr,
+              sell_slice_size,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_perm,
+              (const void*&)sell_val,
+              (const void*&)sell_col_ind);
+
+    log_bench(handle, "./rocsparse-bench -f csr2sell -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || sell_slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All other pointers may only be null, if the matrix does not hold any entries
+    if(csr_val == nullptr || csr_col_ind == nullptr || sell_val == nullptr
+       || sell_col_ind == nullptr)
+    {
+        rocsparse_int start = 0;
+        rocsparse_int end   = 0;
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&end, &csr_row_ptr[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&start, &csr_row_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        if(end - start != 0)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of slices
+    rocsparse_int nslices = (m - 1) / sell_slice_size + 1;
+
+#define CSR2SELL_DIM 512
+    dim3 csr2sell_blocks((nslices * sell_slice_size - 1) / CSR2SELL_DIM + 1);
+    dim3 csr2sell_threads(CSR2SELL_DIM);
+
+    hipLaunchKernelGGL((csr2sell_kernel<CSR2SELL_DIM>),
+                       csr2sell_blocks,
+                       csr2sell_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_descr->base,
+                       sell_slice_size,
+                       nslices,
+                       sell_slice_ptr,
+                       sell_perm,
+                       sell_col_ind,
+                       sell_val,
+                       sell_descr->base);
+#undef CSR2SELL_DIM
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status
+    rocsparse_csr2sell_buffer_size(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   rocsparse_int             sell_slice_size,
+                                   rocsparse_int             sell_sigma,
+                                   size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2sell_buffer_size",
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              sell_slice_size,
+              sell_sigma,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || sell_slice_size <= 0 || sell_sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int nslices  = (m - 1) / sell_slice_size + 1;
+    rocsparse_int nwindows = (m - 1) / sell_sigma + 1;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Determine rocprim buffer size
+    size_t size;
+    *buffer_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(
+        nullptr, size, ptr, ptr, ptr, ptr, m, nwindows, ptr, ptr + 1, 0, 32, stream));
+    *buffer_size = std::max(size, *buffer_size);
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, ptr, ptr, nslices + 1, rocprim::plus<rocsparse_int>(), stream));
+    *buffer_size = std::max(size, *buffer_size);
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // rocPRIM does not support in-place sorting, so we need additional buffer
+    // for the row lengths and row indices
+
+    // row nnz buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    // sorted row nnz buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    // row indices buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    // window buffer
+    *buffer_size += sizeof(rocsparse_int) * (nwindows / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csr2sell_nnz(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   const rocsparse_mat_descr csr_descr,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_mat_descr sell_descr,
+                                                   rocsparse_int             sell_slice_size,
+                                                   rocsparse_int             sell_sigma,
+                                                   rocsparse_int*            sell_slice_ptr,
+                                                   rocsparse_int*            sell_perm,
+                                                   rocsparse_int*            sell_nnz,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(csr_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csr2sell_nnz",
+              m,
+              (const void*&)csr_descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)sell_descr,
+              sell_slice_size,
+              sell_sigma,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_perm,
+              (const void*&)sell_nnz,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(csr_descr->base != rocsparse_index_base_zero && csr_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(sell_descr->base != rocsparse_index_base_zero
+       && sell_descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(csr_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(sell_descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || sell_slice_size <= 0 || sell_sigma <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sell_nnz pointer
+    if(sell_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(sell_nnz, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *sell_nnz = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_slice_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(sell_perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int nslices  = (m - 1) / sell_slice_size + 1;
+    rocsparse_int nwindows = (m - 1) / sell_sigma + 1;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    rocsparse_int* row_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* row_nnz_sorted = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* row_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* window_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (nwindows / 256 + 1) * 256;
+
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+#define CSR2SELL_DIM 256
+    // Row lengths and identity permutation
+    hipLaunchKernelGGL((csr2sell_row_nnz_kernel<CSR2SELL_DIM>),
+                       dim3((m - 1) / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       row_nnz,
+                       row_ind);
+
+    if(sell_sigma > 1)
+    {
+        // Sort the rows by descending length within each window of sigma rows. The
+        // sort is stable, such that rows of equal length keep their relative order.
+        hipLaunchKernelGGL((csr2sell_window_ptr_kernel<CSR2SELL_DIM>),
+                           dim3(nwindows / CSR2SELL_DIM + 1),
+                           dim3(CSR2SELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           sell_sigma,
+                           nwindows,
+                           window_ptr);
+
+        size_t size;
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(nullptr,
+                                                                     size,
+                                                                     row_nnz,
+                                                                     row_nnz_sorted,
+                                                                     row_ind,
+                                                                     sell_perm,
+                                                                     m,
+                                                                     nwindows,
+                                                                     window_ptr,
+                                                                     window_ptr + 1,
+                                                                     0,
+                                                                     32,
+                                                                     stream));
+        RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs_desc(tmp_rocprim,
+                                                                     size,
+                                                                     row_nnz,
+                                                                     row_nnz_sorted,
+                                                                     row_ind,
+                                                                     sell_perm,
+                                                                     m,
+                                                                     nwindows,
+                                                                     window_ptr,
+                                                                     window_ptr + 1,
+                                                                     0,
+                                                                     32,
+                                                                     stream));
+    }
+    else
+    {
+        // No sorting, rows keep their original order
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_nnz_sorted,
+                                           row_nnz,
+                                           sizeof(rocsparse_int) * m,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            sell_perm, row_ind, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+    }
+
+    // Slice widths
+    hipLaunchKernelGGL((csr2sell_slice_nnz_kernel<CSR2SELL_DIM>),
+                       dim3((nslices - 1) / CSR2SELL_DIM + 1),
+                       dim3(CSR2SELL_DIM),
+                       0,
+                       stream,
+                       m,
+                       sell_slice_size,
+                       nslices,
+                       row_nnz_sorted,
+                       sell_slice_ptr,
+                       sell_descr->base);
+#undef CSR2SELL_DIM
+
+    // Inclusive sum over the slice sizes to obtain the slice offsets
+    size_t size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                sell_slice_ptr,
+                                                sell_slice_ptr,
+                                                nslices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(tmp_rocprim,
+                                                size,
+                                                sell_slice_ptr,
+                                                sell_slice_ptr,
+                                                nslices + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Total number of stored entries
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL(csr2sell_nnz_total_kernel,
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           nslices,
+                           sell_slice_ptr,
+                           sell_nnz);
+    }
+    else
+    {
+        rocsparse_int hstart = 0;
+        rocsparse_int hend   = 0;
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            &hend, &sell_slice_ptr[nslices], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&hstart, &sell_slice_ptr[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        *sell_nnz = hend - hstart;
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,          \
+                                     rocsparse_int             m,               \
+                                     const rocsparse_mat_descr csr_descr,       \
+                                     const TYPE*               csr_val,         \
+                                     const rocsparse_int*      csr_row_ptr,     \
+                                     const rocsparse_int*      csr_col_ind,     \
+                                     const rocsparse_mat_descr sell_descr,      \
+                                     rocsparse_int             sell_slice_size, \
+                                     const rocsparse_int*      sell_slice_ptr,  \
+                                     const rocsparse_int*      sell_perm,       \
+                                     TYPE*                     sell_val,        \
+                                     rocsparse_int*            sell_col_ind)    \
+    {                                                                           \
+        return rocsparse_csr2sell_template(handle,                              \
+                                           m,                                   \
+                                           csr_descr,                           \
+                                           csr_val,                             \
+                                           csr_row_ptr,                         \
+                                           csr_col_ind,                         \
+                                           sell_descr,                          \
+                                           sell_slice_size,                     \
+                                           sell_slice_ptr,                      \
+                                           sell_perm,                           \
+                                           sell_val,                            \
+                                           sell_col_ind);                       \
+    }
+
+C_IMPL(rocsparse_scsr2sell, float);
+C_IMPL(rocsparse_dcsr2sell, double);
+C_IMPL(rocsparse_ccsr2sell, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsr2sell, rocsparse_double_complex);
+#undef C_IMPL
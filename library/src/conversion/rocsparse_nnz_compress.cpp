@@ -379,6 +379,23 @@ rocsparse_status rocsparse_nnz_compress_template(rocsparse_handle          handl
     return rocsparse_status_success;
 }
 
+#define INSTANTIATE(TTYPE)                                            \
+    template rocsparse_status rocsparse_nnz_compress_template<TTYPE>( \
+        rocsparse_handle          handle,                             \
+        rocsparse_int             m,                                  \
+        const rocsparse_mat_descr descr_A,                            \
+        const TTYPE*              csr_val_A,                          \
+        const rocsparse_int*      csr_row_ptr_A,                      \
+        rocsparse_int*            nnz_per_row,                        \
+        rocsparse_int*            nnz_C,                              \
+        TTYPE                     tol);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -26,6 +26,7 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include "rocsparse_bsr2dense.hpp"
 #include "rocsparse_coo2dense.hpp"
 #include "rocsparse_csx2dense_impl.hpp"
 
@@ -143,6 +144,23 @@ rocsparse_status rocsparse_sparse_to_dense_template(rocsparse_handle
                                                                     mat_B->order);
     }
 
+    // BSR
+    if(mat_A->format == rocsparse_format_bsr)
+    {
+        return rocsparse_bsr2dense_template(handle,
+                                            mat_A->block_dir,
+                                            (J)mat_A->rows,
+                                            (J)mat_A->cols,
+                                            mat_A->descr,
+                                            (const T*)mat_A->val_data,
+                                            (const I*)mat_A->row_data,
+                                            (const J*)mat_A->col_data,
+                                            (J)mat_A->block_dim,
+                                            (T*)mat_B->values,
+                                            (I)mat_B->ld,
+                                            mat_B->order);
+    }
+
     return rocsparse_status_not_implemented;
 }
 
@@ -28,6 +28,44 @@
 
 #include "common.h"
 
+// Shared memory accumulators of the block per row kernels
+typedef enum csrgemm_accumulator_
+{
+    csrgemm_accumulator_hash  = 0, // Hash table with linear probing
+    csrgemm_accumulator_esc   = 1, // Expand, sort and compress the intermediate products
+    csrgemm_accumulator_dense = 2 // Dense row, where each column owns a table entry
+} csrgemm_accumulator;
+
+// Select the accumulator of a row group, whose shared memory table holds size entries. The
+// table size is also the upper bound of the row nnz of C within the group. The dense
+// accumulator is used if a full row of C fits into the table. ESC expands, sorts and
+// compresses the intermediate products of the rows. ESC groups with more intermediate
+// products than the table can hold fall back to the hash table on the device, see
+// csrgemm_group_max_products, such that ESC covers groups of low compression only. The
+// default algorithm selects per group: dense if possible, otherwise ESC, which the device
+// turns into hashing for groups of high compression.
+static inline csrgemm_accumulator
+    csrgemm_select_accumulator(rocsparse_spgemm_alg alg, int64_t n, unsigned int size)
+{
+    switch(alg)
+    {
+    case rocsparse_spgemm_alg_esc:
+    {
+        return csrgemm_accumulator_esc;
+    }
+    case rocsparse_spgemm_alg_dense_acc:
+    {
+        return (n <= size) ? csrgemm_accumulator_dense : csrgemm_accumulator_hash;
+    }
+    case rocsparse_spgemm_alg_default:
+    {
+        return (n <= size) ? csrgemm_accumulator_dense : csrgemm_accumulator_esc;
+    }
+    }
+
+    return csrgemm_accumulator_hash;
+}
+
 // Decrement
 template <unsigned int BLOCKSIZE, typename I>
 __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_index_base(I* nnz)
@@ -53,6 +91,21 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_copy(I size,
     out[idx] = in[idx] - idx_base_in + idx_base_out;
 }
 
+// Shift row offsets, e.g. to extract or to place a chunk of rows
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_shift_row_ptr(J size, I shift, const I* in, I* out)
+{
+    J idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(idx >= size)
+    {
+        return;
+    }
+
+    out[idx] = in[idx] + shift;
+}
+
 // Copy and scale an array
 template <unsigned int BLOCKSIZE, typename I, typename T>
 __device__ void csrgemm_copy_scale_device(I size, T alpha, const T* in, T* out)
@@ -75,6 +128,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                                        const J* __restrict__ csr_col_ind_A,
                                        const I* __restrict__ csr_row_ptr_B,
                                        const I* __restrict__ csr_row_ptr_D,
+                                       const I* __restrict__ csr_row_ptr_M,
                                        I* __restrict__ int_prod,
                                        rocsparse_index_base idx_base_A,
                                        bool                 mul,
@@ -119,6 +173,12 @@ __launch_bounds__(BLOCKSIZE) __global__
     // Last lane writes result
     if(lid == WFSIZE - 1)
     {
+        // A structural mask bounds the number of entries of alpha * A * B
+        if(csr_row_ptr_M != nullptr)
+        {
+            nprod = min(nprod, csr_row_ptr_M[row + 1] - csr_row_ptr_M[row]);
+        }
+
         // beta * D part
         if(add == true)
         {
@@ -268,6 +328,153 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_group_reduce_part3(I* __res
     }
 }
 
+// Sort the rows into their groups, such that perm[offset[g]:offset[g + 1]] holds the rows of
+// group g. The order of the rows within a group is arbitrary. counter must be zero
+// initialized and holds the number of rows already placed into each group.
+template <unsigned int BLOCKSIZE, unsigned int GROUPS, typename K, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_group_permutation(J m,
+                                   const K* __restrict__ groups,
+                                   const J* __restrict__ offset,
+                                   J* __restrict__ counter,
+                                   J* __restrict__ perm)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // All rows belong to the first group, e.g. if all rows have few products.
+    // The identity permutation does not require any atomics
+    if(offset[1] == offset[GROUPS])
+    {
+        if(row < m)
+        {
+            perm[row] = row;
+        }
+
+        return;
+    }
+
+    // Number of rows of each group within the block and their offset into the group
+    __shared__ J scount[GROUPS];
+    __shared__ J soffset[GROUPS];
+
+    if(hipThreadIdx_x < GROUPS)
+    {
+        scount[hipThreadIdx_x] = 0;
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Group of the current row and its position within the group rows of the block
+    K group = 0;
+    J idx   = 0;
+
+    if(row < m)
+    {
+        group = groups[row];
+        idx   = atomicAdd(&scount[group], static_cast<J>(1));
+    }
+
+    // Wait for all threads to finish counting
+    __syncthreads();
+
+    // Reserve the space of the block within each group
+    if(hipThreadIdx_x < GROUPS)
+    {
+        J count = scount[hipThreadIdx_x];
+
+        soffset[hipThreadIdx_x]
+            = (count > 0) ? atomicAdd(&counter[hipThreadIdx_x], count) : static_cast<J>(0);
+    }
+
+    // Wait for all offsets to be reserved
+    __syncthreads();
+
+    // Scatter row into its group
+    if(row < m)
+    {
+        perm[offset[group] + soffset[group] + idx] = row;
+    }
+}
+
+// Determine the maximum number of intermediate products of the rows of each group, where
+// groups holds the group of each row. The ESC accumulator of a group requires all of them
+// to fit into the shared memory table. Values are clamped to the range of int, which
+// exceeds all table sizes. group_prod must be zero initialized.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int GROUPS, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_group_max_products(J m,
+                                    const int* __restrict__ groups,
+                                    const I* __restrict__ csr_row_ptr_A,
+                                    const J* __restrict__ csr_col_ind_A,
+                                    const I* __restrict__ csr_row_ptr_B,
+                                    const I* __restrict__ csr_row_ptr_D,
+                                    int* __restrict__ group_prod,
+                                    rocsparse_index_base idx_base_A,
+                                    bool                 mul,
+                                    bool                 add)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Each (sub)wavefront processes a row
+    J row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    // Maximum number of intermediate products of each group within the block
+    __shared__ int smax[GROUPS];
+
+    if(hipThreadIdx_x < GROUPS)
+    {
+        smax[hipThreadIdx_x] = 0;
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    if(row < m)
+    {
+        // Intermediate products of the current row
+        I nprod = 0;
+
+        // alpha * A * B part
+        if(mul == true)
+        {
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+            for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+            {
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                nprod += (csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A]);
+            }
+
+            // Gather nprod
+            rocsparse_wfreduce_sum<WFSIZE>(&nprod);
+        }
+
+        // Last lane updates the maximum of the group of the current row
+        if(lid == WFSIZE - 1)
+        {
+            // beta * D part
+            if(add == true)
+            {
+                nprod += (csr_row_ptr_D[row + 1] - csr_row_ptr_D[row]);
+            }
+
+            atomicMax(&smax[groups[row]], static_cast<int>(min(nprod, static_cast<I>(INT_MAX))));
+        }
+    }
+
+    // Wait for all rows of the block
+    __syncthreads();
+
+    if(hipThreadIdx_x < GROUPS && smax[hipThreadIdx_x] > 0)
+    {
+        atomicMax(&group_prod[hipThreadIdx_x], smax[hipThreadIdx_x]);
+    }
+}
+
 template <unsigned int BLOCKSIZE, typename I, typename J>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrgemm_max_row_nnz_part1(J m,
@@ -327,6 +534,40 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrgemm_max_row_nnz_part2(I* __rest
     }
 }
 
+// Check whether the mask admits an entry of C at column col, where the current mask row
+// is given by its (sorted) column entries in [row_begin_M, row_end_M)
+template <typename I, typename J>
+static __device__ __forceinline__ bool csrgemm_mask_pass(J                    col,
+                                                         I                    row_begin_M,
+                                                         I                    row_end_M,
+                                                         const J* __restrict__ csr_col_ind_M,
+                                                         rocsparse_index_base idx_base_M,
+                                                         bool                 complement_M)
+{
+    I left  = row_begin_M;
+    I right = row_end_M;
+
+    // Binary search for the first column entry of the mask row that is not less than col
+    while(left < right)
+    {
+        I mid = (left + right) >> 1;
+
+        if(csr_col_ind_M[mid] - idx_base_M < col)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+
+    bool found = (left < row_end_M) && (csr_col_ind_M[left] - idx_base_M == col);
+
+    // A complemented mask admits all columns that are not part of the mask row
+    return found != complement_M;
+}
+
 // Hash operation to insert key into hash table
 // Returns true if key has been added
 template <unsigned int HASHVAL, unsigned int HASHSIZE, typename I>
@@ -397,6 +638,155 @@ static __device__ __forceinline__ void
     }
 }
 
+// Insert key into dense table, where each key owns the table entry at position key
+// Returns true if key has been added
+template <typename I>
+static __device__ __forceinline__ bool insert_key_dense(I key, I* __restrict__ table)
+{
+    // Element already present
+    if(table[key] != -1)
+    {
+        return false;
+    }
+
+    // Only the first insertion of the key is counted
+    return atomicCAS(&table[key], -1, key) == -1;
+}
+
+// Insert pair into dense table, where each key owns the table entry at position key
+template <typename I, typename T>
+static __device__ __forceinline__ void
+    insert_pair_dense(I key, T val, I* __restrict__ table, T* __restrict__ data)
+{
+    table[key] = key;
+    atomicAdd(&data[key], val);
+}
+
+// Append pair to the list of size expanded intermediate products
+template <typename I, typename J, typename T>
+static __device__ __forceinline__ void
+    append_pair(J key, T val, J* __restrict__ table, T* __restrict__ data, I* __restrict__ size)
+{
+    I idx = atomicAdd(size, static_cast<I>(1));
+
+    table[idx] = key;
+    data[idx]  = val;
+}
+
+// Insert pair into the shared memory accumulator of a row
+template <unsigned int HASHVAL, unsigned int HASHSIZE, typename I, typename J, typename T>
+static __device__ __forceinline__ void accumulate_pair(csrgemm_accumulator acc,
+                                                       J                   key,
+                                                       T                   val,
+                                                       J* __restrict__ table,
+                                                       T* __restrict__ data,
+                                                       J empty,
+                                                       I* __restrict__ size)
+{
+    if(acc == csrgemm_accumulator_dense)
+    {
+        insert_pair_dense(key, val, table, data);
+    }
+    else if(acc == csrgemm_accumulator_esc)
+    {
+        append_pair(key, val, table, data, size);
+    }
+    else
+    {
+        insert_pair<HASHVAL, HASHSIZE>(key, val, table, data, empty);
+    }
+}
+
+// Sort the first size expanded intermediate products by their keys, using a block-wide
+// bitonic sort, and sum up the values of each key into its first entry. All other entries
+// of a key are marked as empty afterwards.
+template <unsigned int BLOCKSIZE, unsigned int HASHSIZE, typename I, typename J, typename T>
+static __device__ __forceinline__ void
+    sort_compress_pairs(I size, J* __restrict__ table, T* __restrict__ data, J empty)
+{
+    // Bitonic sort requires a power of two, entries beyond size are empty and thus in place
+    unsigned int sort_size = 1;
+
+    while(static_cast<I>(sort_size) < size)
+    {
+        sort_size <<= 1;
+    }
+
+    for(unsigned int stage = 2; stage <= sort_size; stage <<= 1)
+    {
+        for(unsigned int stride = stage >> 1; stride > 0; stride >>= 1)
+        {
+            for(unsigned int i = hipThreadIdx_x; i < sort_size; i += BLOCKSIZE)
+            {
+                unsigned int j = i ^ stride;
+
+                // Each pair is compared and swapped by the thread owning the lower index
+                if(j > i)
+                {
+                    J key_i = table[i];
+                    J key_j = table[j];
+
+                    // Direction of the bitonic sequence of the current stage
+                    bool ascending = (i & stage) == 0;
+
+                    if(ascending ? (key_i > key_j) : (key_i < key_j))
+                    {
+                        T val_i = data[i];
+
+                        table[i] = key_j;
+                        table[j] = key_i;
+                        data[i]  = data[j];
+                        data[j]  = val_i;
+                    }
+                }
+            }
+
+            // Wait for all threads to finish the current step
+            __syncthreads();
+        }
+    }
+
+    // Flags for the first entries of each key, owned by this thread
+    bool head[HASHSIZE / BLOCKSIZE];
+
+    // Sum up the values of each key into its first entry
+    for(unsigned int r = 0; r < HASHSIZE / BLOCKSIZE; ++r)
+    {
+        unsigned int i = r * BLOCKSIZE + hipThreadIdx_x;
+
+        J key = table[i];
+
+        head[r] = (key != empty) && (i == 0 || table[i - 1] != key);
+
+        if(head[r] == true)
+        {
+            T sum = data[i];
+
+            for(I j = i + 1; j < size && table[j] == key; ++j)
+            {
+                sum += data[j];
+            }
+
+            data[i] = sum;
+        }
+    }
+
+    // Wait for all threads to finish the summation
+    __syncthreads();
+
+    // Mark all other entries of each key as empty
+    for(unsigned int r = 0; r < HASHSIZE / BLOCKSIZE; ++r)
+    {
+        if(head[r] == false)
+        {
+            table[r * BLOCKSIZE + hipThreadIdx_x] = empty;
+        }
+    }
+
+    // Wait for all threads to finish marking
+    __syncthreads();
+}
+
 // Compute non-zero entries per row, where each row is processed by a single wavefront
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
@@ -405,8 +795,7 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_nnz_wf_per_row(J m,
-                                const J* __restrict__ offset,
+    void csrgemm_nnz_wf_per_row(const J* __restrict__ offset,
                                 const J* __restrict__ perm,
                                 const I* __restrict__ csr_row_ptr_A,
                                 const J* __restrict__ csr_col_ind_A,
@@ -419,91 +808,111 @@ __launch_bounds__(BLOCKSIZE) __global__
                                 rocsparse_index_base idx_base_B,
                                 rocsparse_index_base idx_base_D,
                                 bool                 mul,
-                                bool                 add)
+                                bool                 add,
+                                const I* __restrict__ csr_row_ptr_M,
+                                const J* __restrict__ csr_col_ind_M,
+                                rocsparse_index_base idx_base_M,
+                                bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
     int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each (sub)wavefront processes a row
-    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
-
     // Hash table in shared memory
     __shared__ J stable[BLOCKSIZE / WFSIZE * HASHSIZE];
 
     // Local hash table
     J* table = &stable[wid * HASHSIZE];
 
-    // Initialize hash table
-    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
-    {
-        table[i] = -1;
-    }
-
-    __threadfence_block();
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
 
-    // Bounds check
-    if(row >= m)
+    // Each (sub)wavefront processes a row of the group and loops over the group with a
+    // bounded grid. (Sub)wavefronts without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid; pos < size;
+        pos += hipGridDim_x * BLOCKSIZE / WFSIZE)
     {
-        return;
-    }
+        // Apply permutation, if available
+        J row = perm ? perm[pos + *offset] : pos;
 
-    // Apply permutation, if available
-    row = perm ? perm[row + *offset] : row;
+        // Initialize hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+        {
+            table[i] = -1;
+        }
 
-    // Initialize row nnz
-    J nnz = 0;
+        __threadfence_block();
 
-    // alpha * A * B part
-    if(mul == true)
-    {
-        // Get row boundaries of the current row in A
-        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
-        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+        // Row boundaries of the current row in the mask. Without a mask, the empty complemented
+        // mask row admits all columns
+        I row_begin_M = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row] - idx_base_M : 0;
+        I row_end_M   = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row + 1] - idx_base_M : 0;
+        complement_M  = complement_M || (csr_row_ptr_M == nullptr);
 
-        // Loop over columns of A in current row
-        for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+        // Initialize row nnz
+        J nnz = 0;
+
+        // alpha * A * B part
+        if(mul == true)
         {
-            // Column of A in current row
-            J col_A = csr_col_ind_A[j] - idx_base_A;
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+            {
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                // Loop over columns of B in row col_A
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                // Insert all admitted columns of B into hash table
+                for(I k = row_begin_B; k < row_end_B; ++k)
+                {
+                    // Column of B in row col_A
+                    J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                    // Count the actual insertions to obtain row nnz of C
+                    if(csrgemm_mask_pass(
+                           col_B, row_begin_M, row_end_M, csr_col_ind_M, idx_base_M, complement_M))
+                    {
+                        nnz += insert_key<HASHVAL, HASHSIZE>(col_B, table);
+                    }
+                }
+            }
+        }
 
-            // Loop over columns of B in row col_A
-            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+        // beta * D part
+        if(add == true)
+        {
+            // Get row boundaries of the current row in D
+            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-            // Insert all columns of B into hash table
-            for(I k = row_begin_B; k < row_end_B; ++k)
+            // Loop over columns of D in current row and insert all columns of D into hash table
+            for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
             {
                 // Count the actual insertions to obtain row nnz of C
-                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
             }
         }
-    }
 
-    // beta * D part
-    if(add == true)
-    {
-        // Get row boundaries of the current row in D
-        I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-        I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+        // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
+        // of the current row
+        rocsparse_wfreduce_sum<WFSIZE>(&nnz);
 
-        // Loop over columns of D in current row and insert all columns of D into hash table
-        for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
+        // Write result to global memory
+        if(lid == WFSIZE - 1)
         {
-            // Count the actual insertions to obtain row nnz of C
-            nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            row_nnz[row] = nnz;
         }
-    }
-
-    // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
-    // of the current row
-    rocsparse_wfreduce_sum<WFSIZE>(&nnz);
 
-    // Write result to global memory
-    if(lid == WFSIZE - 1)
-    {
-        row_nnz[row] = nnz;
+        // Wait for the (sub)wavefront before its table is reused for the next row
+        __threadfence_block();
     }
 }
 
@@ -528,97 +937,134 @@ __launch_bounds__(BLOCKSIZE) __global__
                                    rocsparse_index_base idx_base_B,
                                    rocsparse_index_base idx_base_D,
                                    bool                 mul,
-                                   bool                 add)
+                                   bool                 add,
+                                   bool                 dense,
+                                   const I* __restrict__ csr_row_ptr_M,
+                                   const J* __restrict__ csr_col_ind_M,
+                                   rocsparse_index_base idx_base_M,
+                                   bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
     int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each block processes a row (apply permutation)
-    J row = perm[hipBlockIdx_x + *offset];
-
-    // Hash table in shared memory
+    // Hash table in shared memory, or dense table if all columns of C fit into shared memory
     __shared__ J table[HASHSIZE];
 
-    // Initialize hash table
-    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
+
+    // Each block processes a row of the group and loops over the group with a bounded grid.
+    // Blocks without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x; pos < size; pos += hipGridDim_x)
     {
-        table[i] = -1;
-    }
+        // Apply permutation
+        J row = perm[pos + *offset];
 
-    // Wait for all threads to finish initialization
-    __syncthreads();
+        // Row boundaries of the current row in the mask. Without a mask, the empty complemented
+        // mask row admits all columns
+        I row_begin_M = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row] - idx_base_M : 0;
+        I row_end_M   = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row + 1] - idx_base_M : 0;
+        complement_M  = complement_M || (csr_row_ptr_M == nullptr);
 
-    // Initialize row nnz
-    J nnz = 0;
+        // Initialize hash table
+        for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+        {
+            table[i] = -1;
+        }
 
-    // alpha * A * B part
-    if(mul == true)
-    {
-        // Get row boundaries of the current row in A
-        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
-        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+        // Wait for all threads to finish initialization
+        __syncthreads();
 
-        // Loop over columns of A in current row
-        for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        // Initialize row nnz
+        J nnz = 0;
+
+        // alpha * A * B part
+        if(mul == true)
         {
-            // Column of A in current row
-            J col_A = csr_col_ind_A[j] - idx_base_A;
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+            {
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                // Loop over columns of B in row col_A
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+                {
+                    // Column of B in row col_A
+                    J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                    // Skip columns that are not admitted by the mask
+                    if(!csrgemm_mask_pass(
+                           col_B, row_begin_M, row_end_M, csr_col_ind_M, idx_base_M, complement_M))
+                    {
+                        continue;
+                    }
+
+                    // Count the actual insertions to obtain row nnz of C
+                    nnz += (dense == true) ? insert_key_dense(col_B, table)
+                                           : insert_key<HASHVAL, HASHSIZE>(col_B, table);
+                }
+            }
+        }
 
-            // Loop over columns of B in row col_A
-            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+        // beta * D part
+        if(add == true)
+        {
+            // Get row boundaries of the current row in D
+            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-            for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            // Loop over columns of D in current row and insert all columns of D into hash table
+            for(I j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
             {
+                // Column of D in current row
+                J col_D = csr_col_ind_D[j] - idx_base_D;
+
                 // Count the actual insertions to obtain row nnz of C
-                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                nnz += (dense == true) ? insert_key_dense(col_D, table)
+                                       : insert_key<HASHVAL, HASHSIZE>(col_D, table);
             }
         }
-    }
 
-    // beta * D part
-    if(add == true)
-    {
-        // Get row boundaries of the current row in D
-        I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-        I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+        // Wait for all threads to finish hash operation
+        __syncthreads();
+
+        // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
+        // of the current row
+        rocsparse_wfreduce_sum<WFSIZE>(&nnz);
 
-        // Loop over columns of D in current row and insert all columns of D into hash table
-        for(I j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
+        // Write result to shared memory for final reduction by first wavefront
+        if(lid == WFSIZE - 1)
         {
-            // Count the actual insertions to obtain row nnz of C
-            nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            table[wid] = nnz;
         }
-    }
-
-    // Wait for all threads to finish hash operation
-    __syncthreads();
 
-    // Accumulate all row nnz within each (sub)wavefront to obtain the total row nnz
-    // of the current row
-    rocsparse_wfreduce_sum<WFSIZE>(&nnz);
-
-    // Write result to shared memory for final reduction by first wavefront
-    if(lid == WFSIZE - 1)
-    {
-        table[wid] = nnz;
-    }
+        // Wait for all threads to finish reduction
+        __syncthreads();
 
-    // Wait for all threads to finish reduction
-    __syncthreads();
+        // Gather row nnz for the whole block
+        nnz = (hipThreadIdx_x < BLOCKSIZE / WFSIZE) ? table[hipThreadIdx_x] : 0;
 
-    // Gather row nnz for the whole block
-    nnz = (hipThreadIdx_x < BLOCKSIZE / WFSIZE) ? table[hipThreadIdx_x] : 0;
+        // First wavefront computes final sum
+        rocsparse_wfreduce_sum<BLOCKSIZE / WFSIZE>(&nnz);
 
-    // First wavefront computes final sum
-    rocsparse_wfreduce_sum<BLOCKSIZE / WFSIZE>(&nnz);
+        // Write result to global memory
+        if(hipThreadIdx_x == BLOCKSIZE / WFSIZE - 1)
+        {
+            row_nnz[row] = nnz;
+        }
 
-    // Write result to global memory
-    if(hipThreadIdx_x == BLOCKSIZE / WFSIZE - 1)
-    {
-        row_nnz[row] = nnz;
+        // Wait for all threads before the shared memory is reused for the next row
+        __syncthreads();
     }
 }
 
@@ -647,16 +1093,17 @@ __launch_bounds__(BLOCKSIZE) __global__
                                              rocsparse_index_base idx_base_B,
                                              rocsparse_index_base idx_base_D,
                                              bool                 mul,
-                                             bool                 add)
+                                             bool                 add,
+                                             const I* __restrict__ csr_row_ptr_M,
+                                             const J* __restrict__ csr_col_ind_M,
+                                             rocsparse_index_base idx_base_M,
+                                             bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
     int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each block processes a row (apply permutation)
-    J row = perm[hipBlockIdx_x + *offset];
-
     // Row nnz marker
     __shared__ bool table[CHUNKSIZE];
 
@@ -667,170 +1114,198 @@ __launch_bounds__(BLOCKSIZE) __global__
     // current chunk
     __shared__ J next_chunk;
 
-    // Begin of the current row chunk (this is the column index of the current row)
-    J chunk_begin = 0;
-    J chunk_end   = CHUNKSIZE;
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
 
-    // Initialize row nnz for the full row
-    if(hipThreadIdx_x == 0)
+    // Each block processes a row of the group and loops over the group with a bounded grid.
+    // Blocks without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x; pos < size; pos += hipGridDim_x)
     {
-        nnz = 0;
-    }
+        // Apply permutation
+        J row = perm[pos + *offset];
 
-    // Get row boundaries of the current row in A
-    I row_begin_A = (mul == true) ? csr_row_ptr_A[row] - idx_base_A : 0;
-    I row_end_A   = (mul == true) ? csr_row_ptr_A[row + 1] - idx_base_A : 0;
+        // Row boundaries of the current row in the mask. Without a mask, the empty complemented
+        // mask row admits all columns
+        I row_begin_M = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row] - idx_base_M : 0;
+        I row_end_M   = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row + 1] - idx_base_M : 0;
+        complement_M  = complement_M || (csr_row_ptr_M == nullptr);
 
-    // Loop over the row chunks until the end of the row has been reached (which is
-    // the number of total columns)
-    while(chunk_begin < n)
-    {
-        // Initialize row nnz table
-        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
-        {
-            table[i] = false;
-        }
+        // Begin of the current row chunk (this is the column index of the current row)
+        J chunk_begin = 0;
+        J chunk_end   = CHUNKSIZE;
 
-        // Initialize next chunk column index
+        // Initialize row nnz for the full row
         if(hipThreadIdx_x == 0)
         {
-            next_chunk = n;
+            nnz = 0;
         }
 
-        // Wait for all threads to finish initialization
-        __syncthreads();
-
-        // Initialize the beginning of the next chunk
-        J min_col = n;
+        // Get row boundaries of the current row in A
+        I row_begin_A = (mul == true) ? csr_row_ptr_A[row] - idx_base_A : 0;
+        I row_end_A   = (mul == true) ? csr_row_ptr_A[row + 1] - idx_base_A : 0;
 
-        // alpha * A * B part
-        if(mul == true)
+        // Loop over the row chunks until the end of the row has been reached (which is
+        // the number of total columns)
+        while(chunk_begin < n)
         {
-            // Loop over columns of A in current row
-            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+            // Initialize row nnz table
+            for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
             {
-                // Column of A in current row
-                J col_A = csr_col_ind_A[j] - idx_base_A;
+                table[i] = false;
+            }
 
-                // Loop over columns of B in row col_A
-                I row_begin_B
-                    = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
-                I row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+            // Initialize next chunk column index
+            if(hipThreadIdx_x == 0)
+            {
+                next_chunk = n;
+            }
+
+            // Wait for all threads to finish initialization
+            __syncthreads();
 
-                // Keep track of the first k where the column index of B is exceeding
-                // the current chunks end point
-                I next_k = row_begin_B + lid;
+            // Initialize the beginning of the next chunk
+            J min_col = n;
 
-                for(I k = next_k; k < row_end_B; k += WFSIZE)
+            // alpha * A * B part
+            if(mul == true)
+            {
+                // Loop over columns of A in current row
+                for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
                 {
-                    // Column of B in row col_A
-                    J col_B = csr_col_ind_B[k] - idx_base_B;
+                    // Column of A in current row
+                    J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                    // Loop over columns of B in row col_A
+                    I row_begin_B
+                        = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
+                    I row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
 
-                    if(col_B >= chunk_begin && col_B < chunk_end)
+                    // Keep track of the first k where the column index of B is exceeding
+                    // the current chunks end point
+                    I next_k = row_begin_B + lid;
+
+                    for(I k = next_k; k < row_end_B; k += WFSIZE)
                     {
-                        // Mark nnz table if entry at col_B
-                        table[col_B - chunk_begin] = true;
+                        // Column of B in row col_A
+                        J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                        if(col_B >= chunk_begin && col_B < chunk_end)
+                        {
+                            // Mark nnz table if entry at col_B is admitted by the mask
+                            if(csrgemm_mask_pass(col_B,
+                                                 row_begin_M,
+                                                 row_end_M,
+                                                 csr_col_ind_M,
+                                                 idx_base_M,
+                                                 complement_M))
+                            {
+                                table[col_B - chunk_begin] = true;
+                            }
+                        }
+                        else if(col_B >= chunk_end)
+                        {
+                            // If column index exceeds chunks end point, store k as starting
+                            // point of the columns of B for the next pass
+                            next_k = k;
+
+                            // Store the first column index of B that exceeds the current chunk
+                            min_col = min(min_col, col_B);
+                            break;
+                        }
                     }
-                    else if(col_B >= chunk_end)
-                    {
-                        // If column index exceeds chunks end point, store k as starting
-                        // point of the columns of B for the next pass
-                        next_k = k;
 
-                        // Store the first column index of B that exceeds the current chunk
-                        min_col = min(min_col, col_B);
-                        break;
+                    // Obtain the minimum of all k that exceed the current chunks end point
+                    rocsparse_wfreduce_min<WFSIZE>(&next_k);
+
+                    // Store the minimum globally for the next chunk
+                    if(lid == WFSIZE - 1)
+                    {
+                        workspace_B[j] = next_k;
                     }
                 }
+            }
 
-                // Obtain the minimum of all k that exceed the current chunks end point
-                rocsparse_wfreduce_min<WFSIZE>(&next_k);
+            // beta * D part
+            if(add == true)
+            {
+                // Get row boundaries of the current row in D
+                I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+                I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-                // Store the minimum globally for the next chunk
-                if(lid == WFSIZE - 1)
+                // Loop over columns of D in current row and insert all columns of D into hash table
+                for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
                 {
-                    workspace_B[j] = next_k;
+                    // Column of D in current row
+                    J col_D = csr_col_ind_D[j] - idx_base_D;
+
+                    if(col_D >= chunk_begin && col_D < chunk_end)
+                    {
+                        // Mark nnz table if entry at col_D
+                        table[col_D - chunk_begin] = true;
+                    }
+                    else if(col_D >= chunk_end)
+                    {
+                        // Store the first column index of D that exceeds the current chunk
+                        min_col = min(min_col, col_D);
+                        break;
+                    }
+
+                    // Performance can potentially improved by adding another temporary
+                    // workspace of dimension sizeof(J) * nnz, which is significant!
                 }
             }
-        }
 
-        // beta * D part
-        if(add == true)
-        {
-            // Get row boundaries of the current row in D
-            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+            // Gather wavefront-wide minimum for the next chunks starting column index
+            rocsparse_wfreduce_min<WFSIZE>(&min_col);
 
-            // Loop over columns of D in current row and insert all columns of D into hash table
-            for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+            // Last thread in each wavefront finds block-wide minimum atomically
+            if(lid == WFSIZE - 1)
             {
-                // Column of D in current row
-                J col_D = csr_col_ind_D[j] - idx_base_D;
+                // Atomically determine the new chunks beginning (minimum column index of B
+                // that is larger than the current chunks end point)
+                atomicMin(&next_chunk, min_col);
+            }
 
-                if(col_D >= chunk_begin && col_D < chunk_end)
-                {
-                    // Mark nnz table if entry at col_D
-                    table[col_D - chunk_begin] = true;
-                }
-                else if(col_D >= chunk_end)
-                {
-                    // Store the first column index of D that exceeds the current chunk
-                    min_col = min(min_col, col_D);
-                    break;
-                }
+            // Wait for all threads to finish row nnz operation
+            __syncthreads();
 
-                // Performance can potentially improved by adding another temporary
-                // workspace of dimension sizeof(J) * nnz, which is significant!
+            // Each thread loads its entry for the current chunk
+            J chunk_nnz = 0;
+            for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                chunk_nnz += (table[i] == true) ? 1 : 0;
             }
-        }
 
-        // Gather wavefront-wide minimum for the next chunks starting column index
-        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+            // Gather wavefront-wide nnz for the current chunk
+            rocsparse_wfreduce_sum<WFSIZE>(&chunk_nnz);
 
-        // Last thread in each wavefront finds block-wide minimum atomically
-        if(lid == WFSIZE - 1)
-        {
-            // Atomically determine the new chunks beginning (minimum column index of B
-            // that is larger than the current chunks end point)
-            atomicMin(&next_chunk, min_col);
-        }
+            // Last thread in each wavefront accumulates block-wide nnz atomically
+            if(lid == WFSIZE - 1)
+            {
+                // Atomically add this chunks nnz to the total row nnz
+                atomicAdd(&nnz, chunk_nnz);
+            }
 
-        // Wait for all threads to finish row nnz operation
-        __syncthreads();
+            // Wait for atomics to be processed
+            __syncthreads();
 
-        // Each thread loads its entry for the current chunk
-        J chunk_nnz = 0;
-        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
-        {
-            chunk_nnz += (table[i] == true) ? 1 : 0;
-        }
+            // Each thread loads the new chunk beginning and end point
+            chunk_begin = next_chunk;
+            chunk_end   = chunk_begin + CHUNKSIZE;
 
-        // Gather wavefront-wide nnz for the current chunk
-        rocsparse_wfreduce_sum<WFSIZE>(&chunk_nnz);
+            // Wait for all threads to finish load from shared memory
+            __syncthreads();
+        }
 
-        // Last thread in each wavefront accumulates block-wide nnz atomically
-        if(lid == WFSIZE - 1)
+        // Write accumulated total row nnz to global memory
+        if(hipThreadIdx_x == 0)
         {
-            // Atomically add this chunks nnz to the total row nnz
-            atomicAdd(&nnz, chunk_nnz);
+            row_nnz[row] = nnz;
         }
 
-        // Wait for atomics to be processed
-        __syncthreads();
-
-        // Each thread loads the new chunk beginning and end point
-        chunk_begin = next_chunk;
-        chunk_end   = chunk_begin + CHUNKSIZE;
-
-        // Wait for all threads to finish load from shared memory
+        // Wait for all threads before the shared memory is reused for the next row
         __syncthreads();
     }
-
-    // Write accumulated total row nnz to global memory
-    if(hipThreadIdx_x == 0)
-    {
-        row_nnz[row] = nnz;
-    }
 }
 
 // Compute column entries and accumulate values, where each row is processed by a single wavefront
@@ -841,8 +1316,7 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T>
-__device__ void csrgemm_fill_wf_per_row_device(J m,
-                                               J nk,
+__device__ void csrgemm_fill_wf_per_row_device(J nk,
                                                const J* __restrict__ offset,
                                                const J* __restrict__ perm,
                                                T alpha,
@@ -864,16 +1338,17 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
                                                rocsparse_index_base idx_base_C,
                                                rocsparse_index_base idx_base_D,
                                                bool                 mul,
-                                               bool                 add)
+                                               bool                 add,
+                                               const I* __restrict__ csr_row_ptr_M,
+                                               const J* __restrict__ csr_col_ind_M,
+                                               rocsparse_index_base idx_base_M,
+                                               bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
     int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each (sub)wavefront processes a row
-    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
-
     // Hash table in shared memory
     __shared__ J stable[BLOCKSIZE / WFSIZE * HASHSIZE];
     __shared__ T sdata[BLOCKSIZE / WFSIZE * HASHSIZE];
@@ -882,111 +1357,130 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
     J* table = &stable[wid * HASHSIZE];
     T* data  = &sdata[wid * HASHSIZE];
 
-    // Initialize hash table
-    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
-    {
-        table[i] = nk;
-        data[i]  = static_cast<T>(0);
-    }
-
-    __threadfence_block();
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
 
-    // Bounds check
-    if(row >= m)
+    // Each (sub)wavefront processes a row of the group and loops over the group with a
+    // bounded grid. (Sub)wavefronts without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid; pos < size;
+        pos += hipGridDim_x * BLOCKSIZE / WFSIZE)
     {
-        return;
-    }
+        // Apply permutation, if available
+        J row = perm ? perm[pos + *offset] : pos;
 
-    // Apply permutation, if available
-    row = perm ? perm[row + *offset] : row;
+        // Initialize hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+        {
+            table[i] = nk;
+            data[i]  = static_cast<T>(0);
+        }
 
-    // alpha * A * B part
-    if(mul == true)
-    {
-        // Get row boundaries of the current row in A
-        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
-        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+        __threadfence_block();
 
-        // Loop over columns of A in current row
-        for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
-        {
-            // Column of A in current row
-            J col_A = csr_col_ind_A[j] - idx_base_A;
-            // Value of A in current row
-            T val_A = alpha * csr_val_A[j];
+        // Row boundaries of the current row in the mask. Without a mask, the empty complemented
+        // mask row admits all columns
+        I row_begin_M = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row] - idx_base_M : 0;
+        I row_end_M   = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row + 1] - idx_base_M : 0;
+        complement_M  = complement_M || (csr_row_ptr_M == nullptr);
 
-            // Loop over columns of B in row col_A
-            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+        // alpha * A * B part
+        if(mul == true)
+        {
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
 
-            // Insert all columns of B into hash table
-            for(I k = row_begin_B; k < row_end_B; ++k)
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
             {
-                // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+                // Value of A in current row
+                T val_A = alpha * csr_val_A[j];
+
+                // Loop over columns of B in row col_A
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                // Insert all admitted columns of B into hash table
+                for(I k = row_begin_B; k < row_end_B; ++k)
+                {
+                    // Column of B in row col_A
+                    J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                    // Insert key value pair into hash table
+                    if(csrgemm_mask_pass(
+                           col_B, row_begin_M, row_end_M, csr_col_ind_M, idx_base_M, complement_M))
+                    {
+                        insert_pair<HASHVAL, HASHSIZE>(
+                            col_B, val_A * csr_val_B[k], table, data, nk);
+                    }
+                }
             }
         }
-    }
-
-    // beta * D part
-    if(add == true)
-    {
-        // Get row boundaries of the current row in D
-        I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-        I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-        // Loop over columns of D in current row and insert all columns of D into hash table
-        for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
+        // beta * D part
+        if(add == true)
         {
-            // Insert key value pair into hash table
-            insert_pair<HASHVAL, HASHSIZE>(
-                csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
-        }
-    }
+            // Get row boundaries of the current row in D
+            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-    __threadfence_block();
+            // Loop over columns of D in current row and insert all columns of D into hash table
+            for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
+            {
+                // Insert key value pair into hash table
+                insert_pair<HASHVAL, HASHSIZE>(
+                    csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
+            }
+        }
 
-    // Entry point of current row into C
-    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        __threadfence_block();
 
-    // Loop over hash table
-    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
-    {
-        // Get column from hash table to fill it into C
-        J col_C = table[i];
+        // Entry point of current row into C
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
 
-        // Skip hash table entry if not present
-        if(col_C >= nk)
+        // Loop over hash table
+        for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
         {
-            continue;
-        }
+            // Get column from hash table to fill it into C
+            J col_C = table[i];
+
+            // Skip hash table entry if not present
+            if(col_C >= nk)
+            {
+                continue;
+            }
 
-        // Initialize index into C
-        I idx_C = row_begin_C;
+            // Initialize index into C
+            I idx_C = row_begin_C;
 
-        // Initialize index into hash table
-        unsigned int hash_idx = 0;
+            // Initialize index into hash table
+            unsigned int hash_idx = 0;
 
-        // Loop through hash table to find the (sorted) index into C for the
-        // current column index
-        // Checking the whole hash table is actually faster for these hash
-        // table sizes, compared to hash table compression
-        while(hash_idx < HASHSIZE)
-        {
-            // Increment index into C if column entry is greater than table entry
-            if(col_C > table[hash_idx])
+            // Loop through hash table to find the (sorted) index into C for the
+            // current column index
+            // Checking the whole hash table is actually faster for these hash
+            // table sizes, compared to hash table compression
+            while(hash_idx < HASHSIZE)
             {
-                ++idx_C;
+                // Increment index into C if column entry is greater than table entry
+                if(col_C > table[hash_idx])
+                {
+                    ++idx_C;
+                }
+
+                // Goto next hash table index
+                ++hash_idx;
             }
 
-            // Goto next hash table index
-            ++hash_idx;
+            // Write column and accumulated value to the obtained position in C
+            csr_col_ind_C[idx_C] = col_C + idx_base_C;
+            csr_val_C[idx_C]     = data[i];
         }
 
-        // Write column and accumulated value to the obtained position in C
-        csr_col_ind_C[idx_C] = col_C + idx_base_C;
-        csr_val_C[idx_C]     = data[i];
+        // Wait for the (sub)wavefront before its table is reused for the next row
+        __threadfence_block();
     }
 }
 
@@ -1020,181 +1514,248 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
                                                   rocsparse_index_base idx_base_C,
                                                   rocsparse_index_base idx_base_D,
                                                   bool                 mul,
-                                                  bool                 add)
+                                                  bool                 add,
+                                                  csrgemm_accumulator  acc,
+                                                  const int* __restrict__ group_prod,
+                                                  const I* __restrict__ csr_row_ptr_M,
+                                                  const J* __restrict__ csr_col_ind_M,
+                                                  rocsparse_index_base idx_base_M,
+                                                  bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
     int wid = hipThreadIdx_x / WFSIZE;
 
-    // Hash table in shared memory
+    // Hash table in shared memory, which also holds the dense row or the expanded
+    // intermediate products, depending on the accumulator
     __shared__ J table[HASHSIZE];
     __shared__ T data[HASHSIZE];
 
-    // Initialize hash table
-    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
-    {
-        table[i] = nk;
-        data[i]  = static_cast<T>(0);
-    }
+    // Number of expanded intermediate products
+    __shared__ I nexp;
 
-    // Wait for all threads to finish initialization
-    __syncthreads();
+    // Scan offsets of the wavefronts for the hash table compression
+    __shared__ J scan_offsets[BLOCKSIZE / warpSize + 1];
 
-    // Each block processes a row (apply permutation)
-    J row = perm[hipBlockIdx_x + *offset];
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
 
-    // alpha * A * B part
-    if(mul == true)
+    // ESC requires all intermediate products of a row to fit into shared memory, otherwise
+    // the group falls back to the hash table
+    csrgemm_accumulator group_acc
+        = (acc == csrgemm_accumulator_esc && *group_prod > static_cast<int>(HASHSIZE))
+              ? csrgemm_accumulator_hash
+              : acc;
+
+    // Each block processes a row of the group and loops over the group with a bounded grid.
+    // Blocks without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x; pos < size; pos += hipGridDim_x)
     {
-        // Get row boundaries of the current row in A
-        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
-        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+        // Apply permutation
+        J row = perm[pos + *offset];
 
-        // Loop over columns of A in current row
-        for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        // Initialize hash table
+        for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
         {
-            // Column of A in current row
-            J col_A = csr_col_ind_A[j] - idx_base_A;
-            // Value of A in current row
-            T val_A = alpha * csr_val_A[j];
-
-            // Loop over columns of B in row col_A
-            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
-            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
-
-            for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
-            {
-                // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
-            }
+            table[i] = nk;
+            data[i]  = static_cast<T>(0);
         }
-    }
 
-    // beta * D part
-    if(add == true)
-    {
-        // Get row boundaries of the current row in D
-        I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
-        I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
-
-        // Loop over columns of D in current row and insert all columns of D into hash table
-        for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+        // Initialize expanded intermediate product counter
+        if(hipThreadIdx_x == 0)
         {
-            // Insert key value pair into hash table
-            insert_pair<HASHVAL, HASHSIZE>(
-                csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
+            nexp = 0;
         }
-    }
 
-    // Wait for hash operations to finish
-    __syncthreads();
+        // Wait for all threads to finish initialization
+        __syncthreads();
 
-    // Compress hash table, such that valid entries come first
-    __shared__ J scan_offsets[BLOCKSIZE / warpSize + 1];
+        // Row boundaries of the current row in the mask. Without a mask, the empty complemented
+        // mask row admits all columns
+        I row_begin_M = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row] - idx_base_M : 0;
+        I row_end_M   = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row + 1] - idx_base_M : 0;
+        complement_M  = complement_M || (csr_row_ptr_M == nullptr);
 
-    // Offset into hash table
-    J hash_offset = 0;
+        // alpha * A * B part
+        if(mul == true)
+        {
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
 
-    // Loop over the hash table and do the compression
-    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
-    {
-        // Get column and value from hash table
-        J col_C = table[i];
-        T val_C = data[i];
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+            {
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+                // Value of A in current row
+                T val_A = alpha * csr_val_A[j];
 
-        // Boolean to store if thread owns a non-zero element
-        bool has_nnz = col_C < nk;
+                // Loop over columns of B in row col_A
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
 
-        // Each thread obtains a bit mask of all wavefront-wide non-zero entries
-        // to compute its wavefront-wide non-zero offset
-        unsigned long long mask = __ballot(has_nnz);
+                for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+                {
+                    // Column of B in row col_A
+                    J col_B = csr_col_ind_B[k] - idx_base_B;
 
-        // The number of bits set to 1 is the amount of wavefront-wide non-zeros
-        int nnz = __popcll(mask);
+                    // Insert admitted key value pairs into the accumulator
+                    if(csrgemm_mask_pass(
+                           col_B, row_begin_M, row_end_M, csr_col_ind_M, idx_base_M, complement_M))
+                    {
+                        accumulate_pair<HASHVAL, HASHSIZE>(
+                            group_acc, col_B, val_A * csr_val_B[k], table, data, nk, &nexp);
+                    }
+                }
+            }
+        }
 
-        // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
-        // e.g. for lane id 7, lanemask_le = 0b11111111
-        // HIP implements only __lanemask_lt() unfortunately ...
-        unsigned long long lanemask_le
-            = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+        // beta * D part
+        if(add == true)
+        {
+            // Get row boundaries of the current row in D
+            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-        // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
-        int offset = __popcll(lanemask_le & mask);
+            // Loop over columns of D in current row and insert all columns of D into hash table
+            for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+            {
+                // Insert key value pair into the accumulator
+                accumulate_pair<HASHVAL, HASHSIZE>(group_acc,
+                                                   csr_col_ind_D[j] - idx_base_D,
+                                                   beta * csr_val_D[j],
+                                                   table,
+                                                   data,
+                                                   nk,
+                                                   &nexp);
+            }
+        }
 
-        // Need to sync here to make sure reading from data array has finished
+        // Wait for hash operations to finish
         __syncthreads();
 
-        // Each wavefront writes its offset / nnz into shared memory so we can compute the
-        // scan offset
-        scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+        // Sort the expanded intermediate products by column and sum up duplicated columns
+        if(group_acc == csrgemm_accumulator_esc)
+        {
+            sort_compress_pairs<BLOCKSIZE, HASHSIZE>(nexp, table, data, nk);
+        }
 
-        // Wait for all wavefronts to finish writing
-        __syncthreads();
+        // Compress hash table, such that valid entries come first. This preserves the order of
+        // the entries, thus the dense and ESC tables remain sorted by column index
 
-        // Each thread accumulates the offset of all previous wavefronts to obtain its offset
-        for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+        // Offset into hash table
+        J hash_offset = 0;
+
+        // Loop over the hash table and do the compression
+        for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
         {
-            if(hipThreadIdx_x >= j * warpSize)
+            // Get column and value from hash table
+            J col_C = table[i];
+            T val_C = data[i];
+
+            // Boolean to store if thread owns a non-zero element
+            bool has_nnz = col_C < nk;
+
+            // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+            // to compute its wavefront-wide non-zero offset
+            unsigned long long mask = __ballot(has_nnz);
+
+            // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+            int nnz = __popcll(mask);
+
+            // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+            // e.g. for lane id 7, lanemask_le = 0b11111111
+            // HIP implements only __lanemask_lt() unfortunately ...
+            unsigned long long lanemask_le
+                = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+            // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+            int offset = __popcll(lanemask_le & mask);
+
+            // Need to sync here to make sure reading from data array has finished
+            __syncthreads();
+
+            // Each wavefront writes its offset / nnz into shared memory so we can compute the
+            // scan offset
+            scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+            // Wait for all wavefronts to finish writing
+            __syncthreads();
+
+            // Each thread accumulates the offset of all previous wavefronts to obtain its offset
+            for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
             {
-                offset += scan_offsets[j - 1];
+                if(hipThreadIdx_x >= j * warpSize)
+                {
+                    offset += scan_offsets[j - 1];
+                }
             }
-        }
 
-        // Offset depends on all previously added non-zeros and need to be shifted by
-        // 1 (zero-based indexing)
-        J idx = hash_offset + offset - 1;
+            // Offset depends on all previously added non-zeros and need to be shifted by
+            // 1 (zero-based indexing)
+            J idx = hash_offset + offset - 1;
 
-        // Only threads with a non-zero value write their values
-        if(has_nnz)
-        {
-            table[idx] = col_C;
-            data[idx]  = val_C;
-        }
+            // Only threads with a non-zero value write their values
+            if(has_nnz)
+            {
+                table[idx] = col_C;
+                data[idx]  = val_C;
+            }
 
-        // Last thread in block writes the block-wide offset such that all subsequent
-        // entries are shifted by this offset
-        if(hipThreadIdx_x == BLOCKSIZE - 1)
-        {
-            scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
-        }
+            // Last thread in block writes the block-wide offset such that all subsequent
+            // entries are shifted by this offset
+            if(hipThreadIdx_x == BLOCKSIZE - 1)
+            {
+                scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+            }
 
-        // Wait for last thread in block to finish writing
-        __syncthreads();
+            // Wait for last thread in block to finish writing
+            __syncthreads();
 
-        // Each thread reads the block-wide offset and adds it to its local offset
-        hash_offset += scan_offsets[BLOCKSIZE / warpSize - 1];
-    }
+            // Each thread reads the block-wide offset and adds it to its local offset
+            hash_offset += scan_offsets[BLOCKSIZE / warpSize - 1];
+        }
 
-    // Entry point into row of C
-    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
-    I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
-    J row_nnz     = row_end_C - row_begin_C;
+        // Entry point into row of C
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+        J row_nnz     = row_end_C - row_begin_C;
 
-    // Loop over all valid entries in hash table
-    for(J i = hipThreadIdx_x; i < row_nnz; i += BLOCKSIZE)
-    {
-        J col_C = table[i];
-        T val_C = data[i];
+        // Loop over all valid entries in hash table
+        for(J i = hipThreadIdx_x; i < row_nnz; i += BLOCKSIZE)
+        {
+            J col_C = table[i];
+            T val_C = data[i];
 
-        // Index into C
-        I idx_C = row_begin_C;
+            // Index into C
+            I idx_C = row_begin_C + i;
 
-        // Loop through hash table to find the (sorted) index into C for the
-        // current column index
-        for(J j = 0; j < row_nnz; ++j)
-        {
-            // Increment index into C if column entry is greater than table entry
-            if(col_C > table[j])
+            // Only the hash table is unordered
+            if(group_acc == csrgemm_accumulator_hash)
             {
-                ++idx_C;
+                idx_C = row_begin_C;
+
+                // Loop through hash table to find the (sorted) index into C for the
+                // current column index
+                for(J j = 0; j < row_nnz; ++j)
+                {
+                    // Increment index into C if column entry is greater than table entry
+                    if(col_C > table[j])
+                    {
+                        ++idx_C;
+                    }
+                }
             }
+
+            // Write column and accumulated value to the obtain position in C
+            csr_col_ind_C[idx_C] = col_C + idx_base_C;
+            csr_val_C[idx_C]     = val_C;
         }
 
-        // Write column and accumulated value to the obtain position in C
-        csr_col_ind_C[idx_C] = col_C + idx_base_C;
-        csr_val_C[idx_C]     = val_C;
+        // Wait for all threads before the shared memory is reused for the next row
+        __syncthreads();
     }
 }
 
@@ -1231,16 +1792,17 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
                                                             rocsparse_index_base idx_base_C,
                                                             rocsparse_index_base idx_base_D,
                                                             bool                 mul,
-                                                            bool                 add)
+                                                            bool                 add,
+                                                            const I* __restrict__ csr_row_ptr_M,
+                                                            const J* __restrict__ csr_col_ind_M,
+                                                            rocsparse_index_base idx_base_M,
+                                                            bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
     int wid = hipThreadIdx_x / WFSIZE;
 
-    // Each block processes a row (apply permutation)
-    J row = perm[hipBlockIdx_x + *offset];
-
     // Row entry marker and value accumulator
     __shared__ bool table[CHUNKSIZE];
     __shared__ T    data[CHUNKSIZE];
@@ -1249,95 +1811,382 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
     // current chunk
     __shared__ J next_chunk;
 
-    // Begin of the current row chunk (this is the column index of the current row)
-    J chunk_begin = 0;
-    J chunk_end   = CHUNKSIZE;
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
 
-    // Get row boundaries of the current row in A
-    I row_begin_A = (mul == true) ? csr_row_ptr_A[row] - idx_base_A : 0;
-    I row_end_A   = (mul == true) ? csr_row_ptr_A[row + 1] - idx_base_A : 0;
+    // Each block processes a row of the group and loops over the group with a bounded grid.
+    // Blocks without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x; pos < size; pos += hipGridDim_x)
+    {
+        // Apply permutation
+        J row = perm[pos + *offset];
 
-    // Entry point into columns of C
-    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        // Row boundaries of the current row in the mask. Without a mask, the empty complemented
+        // mask row admits all columns
+        I row_begin_M = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row] - idx_base_M : 0;
+        I row_end_M   = (csr_row_ptr_M != nullptr) ? csr_row_ptr_M[row + 1] - idx_base_M : 0;
+        complement_M  = complement_M || (csr_row_ptr_M == nullptr);
 
-    // Loop over the row chunks until the end of the row has been reached (which is
-    // the number of total columns)
-    while(chunk_begin < n)
-    {
-        // Initialize row nnz table and accumulator
-        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        // Begin of the current row chunk (this is the column index of the current row)
+        J chunk_begin = 0;
+        J chunk_end   = CHUNKSIZE;
+
+        // Get row boundaries of the current row in A
+        I row_begin_A = (mul == true) ? csr_row_ptr_A[row] - idx_base_A : 0;
+        I row_end_A   = (mul == true) ? csr_row_ptr_A[row + 1] - idx_base_A : 0;
+
+        // Entry point into columns of C
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+        // Loop over the row chunks until the end of the row has been reached (which is
+        // the number of total columns)
+        while(chunk_begin < n)
         {
-            table[i] = 0;
-            data[i]  = static_cast<T>(0);
+            // Initialize row nnz table and accumulator
+            for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                table[i] = 0;
+                data[i]  = static_cast<T>(0);
+            }
+
+            // Initialize next chunk column index
+            if(hipThreadIdx_x == 0)
+            {
+                next_chunk = n;
+            }
+
+            // Wait for all threads to finish initialization
+            __syncthreads();
+
+            // Initialize the beginning of the next chunk
+            J min_col = n;
+
+            // alpha * A * B part
+            if(mul == true)
+            {
+                // Loop over columns of A in current row
+                for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+                {
+                    // Column of A in current row
+                    J col_A = csr_col_ind_A[j] - idx_base_A;
+
+                    // Value of A in current row
+                    T val_A = alpha * csr_val_A[j];
+
+                    // Loop over columns of B in row col_A
+                    I row_begin_B
+                        = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
+                    I row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                    // Keep track of the first k where the column index of B is exceeding
+                    // the current chunks end point
+                    I next_k = row_begin_B + lid;
+
+                    // Loop over columns of B in row col_A
+                    for(I k = next_k; k < row_end_B; k += WFSIZE)
+                    {
+                        // Column of B in row col_A
+                        J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                        if(col_B >= chunk_begin && col_B < chunk_end)
+                        {
+                            // Skip entries that are not admitted by the mask
+                            if(csrgemm_mask_pass(col_B,
+                                                 row_begin_M,
+                                                 row_end_M,
+                                                 csr_col_ind_M,
+                                                 idx_base_M,
+                                                 complement_M))
+                            {
+                                // Mark nnz table if entry at col_B
+                                table[col_B - chunk_begin] = 1;
+
+                                // Atomically accumulate the intermediate products
+                                atomicAdd(&data[col_B - chunk_begin], val_A * csr_val_B[k]);
+                            }
+                        }
+                        else if(col_B >= chunk_end)
+                        {
+                            // If column index exceeds chunks end point, store k as starting
+                            // point of the columns of B for the next pass
+                            next_k = k;
+
+                            // Store the first column index of B that exceeds the current chunk
+                            min_col = min(min_col, col_B);
+                            break;
+                        }
+                    }
+
+                    // Obtain the minimum of all k that exceed the current chunks end point
+                    rocsparse_wfreduce_min<WFSIZE>(&next_k);
+
+                    // Store the minimum globally for the next chunk
+                    if(lid == WFSIZE - 1)
+                    {
+                        workspace_B[j] = next_k;
+                    }
+                }
+            }
+
+            // beta * D part
+            if(add == true)
+            {
+                // Get row boundaries of the current row in D
+                I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+                I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+                // Loop over columns of D in current row
+                for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+                {
+                    // Column of D in row col_A
+                    J col_D = csr_col_ind_D[j] - idx_base_D;
+
+                    if(col_D >= chunk_begin && col_D < chunk_end)
+                    {
+                        // Mark nnz table if entry at col_D
+                        table[col_D - chunk_begin] = 1;
+
+                        // Atomically accumulate the entry of D
+                        atomicAdd(&data[col_D - chunk_begin], beta * csr_val_D[j]);
+                    }
+                    else if(col_D >= chunk_end)
+                    {
+                        // Store the first column index of D that exceeds the current chunk
+                        min_col = min(min_col, col_D);
+                        break;
+                    }
+
+                    // Performance can potentially improved by adding another temporary
+                    // workspace of dimension sizeof(J) * nnz, which is significant!
+                }
+            }
+
+            // Gather wavefront-wide minimum for the next chunks starting column index
+            rocsparse_wfreduce_min<WFSIZE>(&min_col);
+
+            // Last thread in each wavefront finds block-wide minimum atomically
+            if(lid == WFSIZE - 1)
+            {
+                // Atomically determine the new chunks beginning (minimum column index of B
+                // that is larger than the current chunks end point)
+                atomicMin(&next_chunk, min_col);
+            }
+
+            // Wait for all threads to finish
+            __syncthreads();
+
+            // We can re-use the shared memory to communicate the scan offsets of each
+            // wavefront
+            int* scan_offsets = reinterpret_cast<int*>(data);
+
+            // "Pseudo compress" the table array such that we can copy the values over into C
+            // In fact, we do an exclusive scan to obtain the index where each non-zero has
+            // to be copied to
+            for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+            {
+                // Each thread loads its marker and value to know whether it has to process a
+                // non-zero entry or not
+                bool has_nnz = table[i];
+                T    value   = data[i];
+
+                // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+                // to compute its wavefront-wide non-zero offset in C
+                unsigned long long mask = __ballot(has_nnz == true);
+
+                // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+                int nnz = __popcll(mask);
+
+                // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+                // e.g. for lane id 7, lanemask_le = 0b11111111
+                // HIP implements only __lanemask_lt() unfortunately ...
+                unsigned long long lanemask_le
+                    = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+                // Compute the intra wavefront offset of the lane id by bitwise AND with the lane
+                // mask
+                int offset = __popcll(lanemask_le & mask);
+
+                // Need to sync here to make sure reading from data array has finished
+                __syncthreads();
+
+                // Each wavefront writes its offset / nnz into shared memory so we can compute the
+                // scan offset
+                scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+                // Wait for all wavefronts to finish writing
+                __syncthreads();
+
+                // Each thread accumulates the offset of all previous wavefronts to obtain its
+                // offset into C
+                for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+                {
+                    if(hipThreadIdx_x >= j * warpSize)
+                    {
+                        offset += scan_offsets[j - 1];
+                    }
+                }
+
+                // Offset into C depends on all previously added non-zeros and need to be shifted by
+                // 1 (zero-based indexing)
+                I idx = row_begin_C + offset - 1;
+
+                // Only threads with a non-zero value write to C
+                if(has_nnz)
+                {
+                    csr_col_ind_C[idx] = i + chunk_begin + idx_base_C;
+                    csr_val_C[idx]     = value;
+                }
+
+                // Last thread in block writes the block-wide offset into C such that all subsequent
+                // entries are shifted by this offset
+                if(hipThreadIdx_x == BLOCKSIZE - 1)
+                {
+                    scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+                }
+
+                // Wait for last thread in block to finish writing
+                __syncthreads();
+
+                // Each thread reads the block-wide offset and adds it to its local offset into C
+                row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+            }
+
+            // Each thread loads the new chunk beginning and end point
+            chunk_begin = next_chunk;
+            chunk_end   = chunk_begin + CHUNKSIZE;
+
+            // Wait for all threads to finish load from shared memory
+            __syncthreads();
         }
 
-        // Initialize next chunk column index
-        if(hipThreadIdx_x == 0)
+        // Wait for all threads before the shared memory is reused for the next row
+        __syncthreads();
+    }
+}
+
+// Binary search for the position of column col in the (sorted) column entries of a row of C.
+// Returns nnz, if col is not an entry of the row, e.g. if it has been masked out
+template <typename I, typename J>
+static __device__ __forceinline__ I csrgemm_numeric_search(J col, const J* __restrict__ cols, I nnz)
+{
+    I left  = 0;
+    I right = nnz;
+
+    while(left < right)
+    {
+        I mid = (left + right) >> 1;
+
+        if(cols[mid] < col)
+        {
+            left = mid + 1;
+        }
+        else
         {
-            next_chunk = n;
+            right = mid;
         }
+    }
 
-        // Wait for all threads to finish initialization
-        __syncthreads();
+    return (left < nnz && cols[left] == col) ? left : nnz;
+}
+
+// Accumulate values of C, where the column entries of C are known from a previous symbolic
+// stage and each row is processed by a (sub)wavefront
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int NNZSIZE,
+          typename I,
+          typename J,
+          typename T>
+__device__ void csrgemm_numeric_fill_wf_per_row_device(const J* __restrict__ offset,
+                                                       const J* __restrict__ perm,
+                                                       T alpha,
+                                                       const I* __restrict__ csr_row_ptr_A,
+                                                       const J* __restrict__ csr_col_ind_A,
+                                                       const T* __restrict__ csr_val_A,
+                                                       const I* __restrict__ csr_row_ptr_B,
+                                                       const J* __restrict__ csr_col_ind_B,
+                                                       const T* __restrict__ csr_val_B,
+                                                       T beta,
+                                                       const I* __restrict__ csr_row_ptr_D,
+                                                       const J* __restrict__ csr_col_ind_D,
+                                                       const T* __restrict__ csr_val_D,
+                                                       const I* __restrict__ csr_row_ptr_C,
+                                                       const J* __restrict__ csr_col_ind_C,
+                                                       T* __restrict__ csr_val_C,
+                                                       rocsparse_index_base idx_base_A,
+                                                       rocsparse_index_base idx_base_B,
+                                                       rocsparse_index_base idx_base_C,
+                                                       rocsparse_index_base idx_base_D,
+                                                       bool                 mul,
+                                                       bool                 add)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Column entries and values of the current row of C in shared memory
+    __shared__ J scols[BLOCKSIZE / WFSIZE * NNZSIZE];
+    __shared__ T sdata[BLOCKSIZE / WFSIZE * NNZSIZE];
 
-        // Initialize the beginning of the next chunk
-        J min_col = n;
+    // Local row of C
+    J* cols = &scols[wid * NNZSIZE];
+    T* data = &sdata[wid * NNZSIZE];
+
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
+
+    // Each (sub)wavefront processes a row of the group and loops over the group with a
+    // bounded grid. (Sub)wavefronts without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid; pos < size;
+        pos += hipGridDim_x * BLOCKSIZE / WFSIZE)
+    {
+        // Apply permutation, if available
+        J row = perm ? perm[pos + *offset] : pos;
+
+        // Row boundaries of the current row in C
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        I row_nnz_C   = csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
+
+        // Load column entries of C and initialize values
+        for(I i = lid; i < row_nnz_C; i += WFSIZE)
+        {
+            cols[i] = csr_col_ind_C[row_begin_C + i] - idx_base_C;
+            data[i] = static_cast<T>(0);
+        }
+
+        __threadfence_block();
 
         // alpha * A * B part
         if(mul == true)
         {
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
             // Loop over columns of A in current row
-            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+            for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
             {
                 // Column of A in current row
                 J col_A = csr_col_ind_A[j] - idx_base_A;
-
                 // Value of A in current row
                 T val_A = alpha * csr_val_A[j];
 
                 // Loop over columns of B in row col_A
-                I row_begin_B
-                    = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
-                I row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
 
-                // Keep track of the first k where the column index of B is exceeding
-                // the current chunks end point
-                I next_k = row_begin_B + lid;
-
-                // Loop over columns of B in row col_A
-                for(I k = next_k; k < row_end_B; k += WFSIZE)
+                // Accumulate into the corresponding entry of C
+                for(I k = row_begin_B; k < row_end_B; ++k)
                 {
-                    // Column of B in row col_A
-                    J col_B = csr_col_ind_B[k] - idx_base_B;
+                    I idx = csrgemm_numeric_search(csr_col_ind_B[k] - idx_base_B, cols, row_nnz_C);
 
-                    if(col_B >= chunk_begin && col_B < chunk_end)
+                    // Skip products that are not part of C
+                    if(idx < row_nnz_C)
                     {
-                        // Mark nnz table if entry at col_B
-                        table[col_B - chunk_begin] = 1;
-
-                        // Atomically accumulate the intermediate products
-                        atomicAdd(&data[col_B - chunk_begin], val_A * csr_val_B[k]);
-                    }
-                    else if(col_B >= chunk_end)
-                    {
-                        // If column index exceeds chunks end point, store k as starting
-                        // point of the columns of B for the next pass
-                        next_k = k;
-
-                        // Store the first column index of B that exceeds the current chunk
-                        min_col = min(min_col, col_B);
-                        break;
+                        atomicAdd(&data[idx], val_A * csr_val_B[k]);
                     }
                 }
-
-                // Obtain the minimum of all k that exceed the current chunks end point
-                rocsparse_wfreduce_min<WFSIZE>(&next_k);
-
-                // Store the minimum globally for the next chunk
-                if(lid == WFSIZE - 1)
-                {
-                    workspace_B[j] = next_k;
-                }
             }
         }
 
@@ -1348,127 +2197,262 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
             I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
             I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-            // Loop over columns of D in current row
-            for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+            // Loop over columns of D in current row and accumulate into the entries of C
+            for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
             {
-                // Column of D in row col_A
-                J col_D = csr_col_ind_D[j] - idx_base_D;
-
-                if(col_D >= chunk_begin && col_D < chunk_end)
-                {
-                    // Mark nnz table if entry at col_D
-                    table[col_D - chunk_begin] = 1;
-
-                    // Atomically accumulate the entry of D
-                    atomicAdd(&data[col_D - chunk_begin], beta * csr_val_D[j]);
-                }
-                else if(col_D >= chunk_end)
-                {
-                    // Store the first column index of D that exceeds the current chunk
-                    min_col = min(min_col, col_D);
-                    break;
-                }
-
-                // Performance can potentially improved by adding another temporary
-                // workspace of dimension sizeof(J) * nnz, which is significant!
+                I idx = csrgemm_numeric_search(csr_col_ind_D[j] - idx_base_D, cols, row_nnz_C);
+                atomicAdd(&data[idx], beta * csr_val_D[j]);
             }
         }
 
-        // Gather wavefront-wide minimum for the next chunks starting column index
-        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+        __threadfence_block();
 
-        // Last thread in each wavefront finds block-wide minimum atomically
-        if(lid == WFSIZE - 1)
+        // Write accumulated values to C
+        for(I i = lid; i < row_nnz_C; i += WFSIZE)
         {
-            // Atomically determine the new chunks beginning (minimum column index of B
-            // that is larger than the current chunks end point)
-            atomicMin(&next_chunk, min_col);
+            csr_val_C[row_begin_C + i] = data[i];
         }
 
-        // Wait for all threads to finish
-        __syncthreads();
-
-        // We can re-use the shared memory to communicate the scan offsets of each
-        // wavefront
-        int* scan_offsets = reinterpret_cast<int*>(data);
+        // Wait for the (sub)wavefront before its row is reused for the next row
+        __threadfence_block();
+    }
+}
 
-        // "Pseudo compress" the table array such that we can copy the values over into C
-        // In fact, we do an exclusive scan to obtain the index where each non-zero has
-        // to be copied to
-        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
-        {
-            // Each thread loads its marker and value to know whether it has to process a
-            // non-zero entry or not
-            bool has_nnz = table[i];
-            T    value   = data[i];
+// Accumulate values of C, where the column entries of C are known from a previous symbolic
+// stage and each row is processed by a single block
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int NNZSIZE,
+          typename I,
+          typename J,
+          typename T>
+__device__ void csrgemm_numeric_fill_block_per_row_device(const J* __restrict__ offset,
+                                                          const J* __restrict__ perm,
+                                                          T alpha,
+                                                          const I* __restrict__ csr_row_ptr_A,
+                                                          const J* __restrict__ csr_col_ind_A,
+                                                          const T* __restrict__ csr_val_A,
+                                                          const I* __restrict__ csr_row_ptr_B,
+                                                          const J* __restrict__ csr_col_ind_B,
+                                                          const T* __restrict__ csr_val_B,
+                                                          T beta,
+                                                          const I* __restrict__ csr_row_ptr_D,
+                                                          const J* __restrict__ csr_col_ind_D,
+                                                          const T* __restrict__ csr_val_D,
+                                                          const I* __restrict__ csr_row_ptr_C,
+                                                          const J* __restrict__ csr_col_ind_C,
+                                                          T* __restrict__ csr_val_C,
+                                                          rocsparse_index_base idx_base_A,
+                                                          rocsparse_index_base idx_base_B,
+                                                          rocsparse_index_base idx_base_C,
+                                                          rocsparse_index_base idx_base_D,
+                                                          bool                 mul,
+                                                          bool                 add)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
 
-            // Each thread obtains a bit mask of all wavefront-wide non-zero entries
-            // to compute its wavefront-wide non-zero offset in C
-            unsigned long long mask = __ballot(has_nnz == true);
+    // Column entries and values of the current row of C in shared memory
+    __shared__ J cols[NNZSIZE];
+    __shared__ T data[NNZSIZE];
 
-            // The number of bits set to 1 is the amount of wavefront-wide non-zeros
-            int nnz = __popcll(mask);
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
 
-            // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
-            // e.g. for lane id 7, lanemask_le = 0b11111111
-            // HIP implements only __lanemask_lt() unfortunately ...
-            unsigned long long lanemask_le
-                = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+    // Each block processes a row of the group and loops over the group with a bounded grid.
+    // Blocks without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x; pos < size; pos += hipGridDim_x)
+    {
+        // Apply permutation
+        J row = perm[pos + *offset];
 
-            // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
-            int offset = __popcll(lanemask_le & mask);
+        // Row boundaries of the current row in C
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        I row_nnz_C   = csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
 
-            // Need to sync here to make sure reading from data array has finished
-            __syncthreads();
+        // Load column entries of C and initialize values
+        for(I i = hipThreadIdx_x; i < row_nnz_C; i += BLOCKSIZE)
+        {
+            cols[i] = csr_col_ind_C[row_begin_C + i] - idx_base_C;
+            data[i] = static_cast<T>(0);
+        }
 
-            // Each wavefront writes its offset / nnz into shared memory so we can compute the
-            // scan offset
-            scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+        // Wait for all threads to finish initialization
+        __syncthreads();
 
-            // Wait for all wavefronts to finish writing
-            __syncthreads();
+        // alpha * A * B part
+        if(mul == true)
+        {
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
 
-            // Each thread accumulates the offset of all previous wavefronts to obtain its
-            // offset into C
-            for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
             {
-                if(hipThreadIdx_x >= j * warpSize)
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+                // Value of A in current row
+                T val_A = alpha * csr_val_A[j];
+
+                // Loop over columns of B in row col_A
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                // Accumulate into the corresponding entries of C
+                for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
                 {
-                    offset += scan_offsets[j - 1];
+                    I idx = csrgemm_numeric_search(csr_col_ind_B[k] - idx_base_B, cols, row_nnz_C);
+
+                    // Skip products that are not part of C
+                    if(idx < row_nnz_C)
+                    {
+                        atomicAdd(&data[idx], val_A * csr_val_B[k]);
+                    }
                 }
             }
+        }
 
-            // Offset into C depends on all previously added non-zeros and need to be shifted by
-            // 1 (zero-based indexing)
-            I idx = row_begin_C + offset - 1;
+        // beta * D part
+        if(add == true)
+        {
+            // Get row boundaries of the current row in D
+            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-            // Only threads with a non-zero value write to C
-            if(has_nnz)
+            // Loop over columns of D in current row and accumulate into the entries of C
+            for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
             {
-                csr_col_ind_C[idx] = i + chunk_begin + idx_base_C;
-                csr_val_C[idx]     = value;
+                I idx = csrgemm_numeric_search(csr_col_ind_D[j] - idx_base_D, cols, row_nnz_C);
+                atomicAdd(&data[idx], beta * csr_val_D[j]);
             }
+        }
 
-            // Last thread in block writes the block-wide offset into C such that all subsequent
-            // entries are shifted by this offset
-            if(hipThreadIdx_x == BLOCKSIZE - 1)
+        // Wait for all threads to finish accumulation
+        __syncthreads();
+
+        // Write accumulated values to C
+        for(I i = hipThreadIdx_x; i < row_nnz_C; i += BLOCKSIZE)
+        {
+            csr_val_C[row_begin_C + i] = data[i];
+        }
+
+        // Wait for all threads before the shared memory is reused for the next row
+        __syncthreads();
+    }
+}
+
+// Accumulate values of C, where the column entries of C are known from a previous symbolic
+// stage and each row is processed by a single block. The row of C is accumulated in global
+// memory, which is used for rows exceeding the shared memory capacity.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__device__ void csrgemm_numeric_fill_global_device(const J* __restrict__ offset,
+                                                   const J* __restrict__ perm,
+                                                   T alpha,
+                                                   const I* __restrict__ csr_row_ptr_A,
+                                                   const J* __restrict__ csr_col_ind_A,
+                                                   const T* __restrict__ csr_val_A,
+                                                   const I* __restrict__ csr_row_ptr_B,
+                                                   const J* __restrict__ csr_col_ind_B,
+                                                   const T* __restrict__ csr_val_B,
+                                                   T beta,
+                                                   const I* __restrict__ csr_row_ptr_D,
+                                                   const J* __restrict__ csr_col_ind_D,
+                                                   const T* __restrict__ csr_val_D,
+                                                   const I* __restrict__ csr_row_ptr_C,
+                                                   const J* __restrict__ csr_col_ind_C,
+                                                   T* __restrict__ csr_val_C,
+                                                   rocsparse_index_base idx_base_A,
+                                                   rocsparse_index_base idx_base_B,
+                                                   rocsparse_index_base idx_base_C,
+                                                   rocsparse_index_base idx_base_D,
+                                                   bool                 mul,
+                                                   bool                 add)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Number of rows of the current group, which is only known on the device
+    J size = offset[1] - offset[0];
+
+    // Each block processes a row of the group and loops over the group with a bounded grid.
+    // Blocks without a row exit before any shared memory is touched
+    for(J pos = hipBlockIdx_x; pos < size; pos += hipGridDim_x)
+    {
+        // Apply permutation
+        J row = perm[pos + *offset];
+
+        // Row boundaries of the current row in C
+        I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+        I row_nnz_C   = csr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
+
+        // Current row of C
+        const J* cols = csr_col_ind_C + row_begin_C;
+        T*       data = csr_val_C + row_begin_C;
+
+        // Initialize values
+        for(I i = hipThreadIdx_x; i < row_nnz_C; i += BLOCKSIZE)
+        {
+            data[i] = static_cast<T>(0);
+        }
+
+        // Wait for all threads to finish initialization
+        __threadfence();
+        __syncthreads();
+
+        // alpha * A * B part
+        if(mul == true)
+        {
+            // Get row boundaries of the current row in A
+            I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+            // Loop over columns of A in current row
+            for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
             {
-                scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
-            }
+                // Column of A in current row
+                J col_A = csr_col_ind_A[j] - idx_base_A;
+                // Value of A in current row
+                T val_A = alpha * csr_val_A[j];
 
-            // Wait for last thread in block to finish writing
-            __syncthreads();
+                // Loop over columns of B in row col_A
+                I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+                // Accumulate into the corresponding entries of C
+                for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+                {
+                    J col = csr_col_ind_B[k] - idx_base_B + idx_base_C;
+                    I idx = csrgemm_numeric_search(col, cols, row_nnz_C);
 
-            // Each thread reads the block-wide offset and adds it to its local offset into C
-            row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+                    // Skip products that are not part of C
+                    if(idx < row_nnz_C)
+                    {
+                        atomicAdd(&data[idx], val_A * csr_val_B[k]);
+                    }
+                }
+            }
         }
 
-        // Each thread loads the new chunk beginning and end point
-        chunk_begin = next_chunk;
-        chunk_end   = chunk_begin + CHUNKSIZE;
+        // beta * D part
+        if(add == true)
+        {
+            // Get row boundaries of the current row in D
+            I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+            I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
 
-        // Wait for all threads to finish load from shared memory
-        __syncthreads();
+            // Loop over columns of D in current row and accumulate into the entries of C
+            for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+            {
+                J col = csr_col_ind_D[j] - idx_base_D + idx_base_C;
+                atomicAdd(&data[csrgemm_numeric_search(col, cols, row_nnz_C)],
+                          beta * csr_val_D[j]);
+            }
+        }
     }
 }
 
@@ -23,7 +23,6 @@
  * ************************************************************************ */
 
 #include "rocsparse_csrgemm.hpp"
-#include "../conversion/rocsparse_identity.hpp"
 #include "csrgemm_device.h"
 #include "definitions.h"
 #include "utility.h"
@@ -38,8 +37,7 @@ template <unsigned int BLOCKSIZE,
           typename J,
           typename T>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_fill_wf_per_row_host_pointer(J m,
-                                              J nk,
+    void csrgemm_fill_wf_per_row_host_pointer(J nk,
                                               const J* __restrict__ offset,
                                               const J* __restrict__ perm,
                                               T alpha,
@@ -61,10 +59,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                               rocsparse_index_base idx_base_C,
                                               rocsparse_index_base idx_base_D,
                                               bool                 mul,
-                                              bool                 add)
+                                              bool                 add,
+                                              const I* __restrict__ csr_row_ptr_M,
+                                              const J* __restrict__ csr_col_ind_M,
+                                              rocsparse_index_base idx_base_M,
+                                              bool                 complement_M)
 {
-    csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(m,
-                                                                         nk,
+    csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(nk,
                                                                          offset,
                                                                          perm,
                                                                          alpha,
@@ -86,7 +87,11 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                                          idx_base_C,
                                                                          idx_base_D,
                                                                          mul,
-                                                                         add);
+                                                                         add,
+                                                                         csr_row_ptr_M,
+                                                                         csr_col_ind_M,
+                                                                         idx_base_M,
+                                                                         complement_M);
 }
 
 template <unsigned int BLOCKSIZE,
@@ -97,8 +102,7 @@ template <unsigned int BLOCKSIZE,
           typename J,
           typename T>
 __launch_bounds__(BLOCKSIZE) __global__
-    void csrgemm_fill_wf_per_row_device_pointer(J m,
-                                                J nk,
+    void csrgemm_fill_wf_per_row_device_pointer(J nk,
                                                 const J* __restrict__ offset,
                                                 const J* __restrict__ perm,
                                                 const T* __restrict__ alpha,
@@ -120,10 +124,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                 rocsparse_index_base idx_base_C,
                                                 rocsparse_index_base idx_base_D,
                                                 bool                 mul,
-                                                bool                 add)
+                                                bool                 add,
+                                                const I* __restrict__ csr_row_ptr_M,
+                                                const J* __restrict__ csr_col_ind_M,
+                                                rocsparse_index_base idx_base_M,
+                                                bool                 complement_M)
 {
     csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
-        m,
         nk,
         offset,
         perm,
@@ -146,7 +153,11 @@ __launch_bounds__(BLOCKSIZE) __global__
         idx_base_C,
         idx_base_D,
         mul,
-        add);
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M);
 }
 
 template <unsigned int BLOCKSIZE,
@@ -179,7 +190,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                  rocsparse_index_base idx_base_C,
                                                  rocsparse_index_base idx_base_D,
                                                  bool                 mul,
-                                                 bool                 add)
+                                                 bool                 add,
+                                                 csrgemm_accumulator  acc,
+                                                 const int* __restrict__ group_prod,
+                                                 const I* __restrict__ csr_row_ptr_M,
+                                                 const J* __restrict__ csr_col_ind_M,
+                                                 rocsparse_index_base idx_base_M,
+                                                 bool                 complement_M)
 {
     csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(nk,
                                                                             offset,
@@ -203,7 +220,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                                             idx_base_C,
                                                                             idx_base_D,
                                                                             mul,
-                                                                            add);
+                                                                            add,
+                                                                            acc,
+                                                                            group_prod,
+                                                                            csr_row_ptr_M,
+                                                                            csr_col_ind_M,
+                                                                            idx_base_M,
+                                                                            complement_M);
 }
 
 template <unsigned int BLOCKSIZE,
@@ -236,7 +259,13 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                    rocsparse_index_base idx_base_C,
                                                    rocsparse_index_base idx_base_D,
                                                    bool                 mul,
-                                                   bool                 add)
+                                                   bool                 add,
+                                                   csrgemm_accumulator  acc,
+                                                   const int* __restrict__ group_prod,
+                                                   const I* __restrict__ csr_row_ptr_M,
+                                                   const J* __restrict__ csr_col_ind_M,
+                                                   rocsparse_index_base idx_base_M,
+                                                   bool                 complement_M)
 {
     csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
         nk,
@@ -261,7 +290,13 @@ __launch_bounds__(BLOCKSIZE) __global__
         idx_base_C,
         idx_base_D,
         mul,
-        add);
+        add,
+        acc,
+        group_prod,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M);
 }
 
 template <unsigned int BLOCKSIZE,
@@ -294,7 +329,11 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                            rocsparse_index_base idx_base_C,
                                                            rocsparse_index_base idx_base_D,
                                                            bool                 mul,
-                                                           bool                 add)
+                                                           bool                 add,
+                                                           const I* __restrict__ csr_row_ptr_M,
+                                                           const J* __restrict__ csr_col_ind_M,
+                                                           rocsparse_index_base idx_base_M,
+                                                           bool                 complement_M)
 {
     csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(n,
                                                                               offset,
@@ -319,7 +358,11 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                                               idx_base_C,
                                                                               idx_base_D,
                                                                               mul,
-                                                                              add);
+                                                                              add,
+                                                                              csr_row_ptr_M,
+                                                                              csr_col_ind_M,
+                                                                              idx_base_M,
+                                                                              complement_M);
 }
 
 template <unsigned int BLOCKSIZE,
@@ -352,7 +395,11 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                              rocsparse_index_base idx_base_C,
                                                              rocsparse_index_base idx_base_D,
                                                              bool                 mul,
-                                                             bool                 add)
+                                                             bool                 add,
+                                                             const I* __restrict__ csr_row_ptr_M,
+                                                             const J* __restrict__ csr_col_ind_M,
+                                                             rocsparse_index_base idx_base_M,
+                                                             bool                 complement_M)
 {
     csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
         n,
@@ -378,7 +425,11 @@ __launch_bounds__(BLOCKSIZE) __global__
         idx_base_C,
         idx_base_D,
         mul,
-        add);
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M);
 }
 
 // Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
@@ -395,7 +446,6 @@ template <typename I,
               int>::type
           = 0>
 static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
-                                                J                    group_size,
                                                 const J*             group_offset,
                                                 const J*             perm,
                                                 J                    m,
@@ -420,7 +470,13 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 rocsparse_index_base base_C,
                                                 rocsparse_index_base base_D,
                                                 bool                 mul,
-                                                bool                 add)
+                                                bool                 add,
+                                                rocsparse_spgemm_alg alg,
+                                                const int*           group_prod,
+                                                const I*             csr_row_ptr_M,
+                                                const J*             csr_col_ind_M,
+                                                rocsparse_index_base base_M,
+                                                bool                 complement_M)
 {
     return rocsparse_status_internal_error;
 }
@@ -437,7 +493,6 @@ template <typename I,
               int>::type
           = 0>
 static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
-                                                J                    group_size,
                                                 const J*             group_offset,
                                                 const J*             perm,
                                                 J                    m,
@@ -462,7 +517,13 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 rocsparse_index_base base_C,
                                                 rocsparse_index_base base_D,
                                                 bool                 mul,
-                                                bool                 add)
+                                                bool                 add,
+                                                rocsparse_spgemm_alg alg,
+                                                const int*           group_prod,
+                                                const I*             csr_row_ptr_M,
+                                                const J*             csr_col_ind_M,
+                                                rocsparse_index_base base_M,
+                                                bool                 complement_M)
 {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 64
@@ -473,7 +534,7 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
                                                                       CSRGEMM_FLL_HASH>),
-                           dim3(group_size),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            handle->stream,
@@ -499,7 +560,13 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                            base_C,
                            base_D,
                            mul,
-                           add);
+                           add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                           group_prod,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
     }
     else
     {
@@ -507,7 +574,7 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                                     CSRGEMM_SUB,
                                                                     CSRGEMM_HASHSIZE,
                                                                     CSRGEMM_FLL_HASH>),
-                           dim3(group_size),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            handle->stream,
@@ -533,7 +600,13 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                            base_C,
                            base_D,
                            mul,
-                           add);
+                           add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                           group_prod,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
     }
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
@@ -542,6 +615,46 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
+// Store the row grouping and permutation of C in the csrgemm info structure, such that
+// subsequent numeric computations can skip the analysis of the rows of C
+template <typename J>
+static inline rocsparse_status csrgemm_symbolic_store(rocsparse_handle   handle,
+                                                      J                  m,
+                                                      const J*           d_group_offset,
+                                                      const J*           d_perm,
+                                                      rocsparse_mat_info info_C)
+{
+    rocsparse_csrgemm_info info = info_C->csrgemm_info;
+
+    // Release meta data of a previous symbolic computation
+    if(info->group_offset != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->group_offset));
+        info->group_offset = nullptr;
+    }
+
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->perm));
+        info->perm = nullptr;
+    }
+
+    // Group offsets, including the end of the last group
+    RETURN_IF_HIP_ERROR(hipMalloc(&info->group_offset, sizeof(J) * (CSRGEMM_MAXGROUPS + 1)));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->group_offset,
+                                       d_group_offset,
+                                       sizeof(J) * (CSRGEMM_MAXGROUPS + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       handle->stream));
+
+    // Row permutation
+    RETURN_IF_HIP_ERROR(hipMalloc(&info->perm, sizeof(J) * m));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info->perm, d_perm, sizeof(J) * m, hipMemcpyDeviceToDevice, handle->stream));
+
+    return rocsparse_status_success;
+}
+
 template <typename I, typename J, typename T>
 static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handle,
                                                                rocsparse_operation       trans_A,
@@ -571,7 +684,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                const I* csr_row_ptr_C,
                                                                J*       csr_col_ind_C,
                                                                const rocsparse_mat_info info_C,
-                                                               void*                    temp_buffer)
+                                                               void* temp_buffer,
+                                                               bool                      symbolic)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -584,6 +698,17 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     rocsparse_index_base base_D
         = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
 
+    // SpGEMM algorithm, selecting the accumulator of each row group
+    rocsparse_spgemm_alg alg = info_C->csrgemm_info->alg;
+
+    // Mask of C = alpha * A * B, if any
+    const I* csr_row_ptr_M = static_cast<const I*>(info_C->csrgemm_info->mask_row_ptr);
+    const J* csr_col_ind_M = static_cast<const J*>(info_C->csrgemm_info->mask_col_ind);
+
+    // Index base of the mask and whether C is restricted to the complement of the mask
+    rocsparse_index_base base_M       = info_C->csrgemm_info->mask_base;
+    bool                 complement_M = info_C->csrgemm_info->mask_complement;
+
     // Flag for exceeding shared memory
     constexpr bool exceeding_smem
         = std::is_same<T, rocsparse_double_complex>::value
@@ -599,150 +724,133 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     size_t rocprim_size;
     void*  rocprim_buffer;
 
-    // Determine maximum non-zero entries per row of all rows
-    J* workspace = reinterpret_cast<J*>(buffer);
+    // Group offset buffer
+    J* d_group_offset = reinterpret_cast<J*>(buffer);
+    buffer += sizeof(J) * 256;
+
+    // Group size buffer
+    J* d_group_size = reinterpret_cast<J*>(buffer);
+    buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
+
+    // Permutation array
+    J* d_perm = reinterpret_cast<J*>(buffer);
+    buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+
+    // Group of each row
+    int* tmp_groups = reinterpret_cast<int*>(buffer);
+    buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
+    // Process the rows in groups of similar sized row nnz. The group sizes remain on the
+    // device, such that no host synchronization is required.
 #define CSRGEMM_DIM 256
-    hipLaunchKernelGGL((csrgemm_max_row_nnz_part1<CSRGEMM_DIM>),
+    hipLaunchKernelGGL((csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, exceeding_smem>),
                        dim3(CSRGEMM_DIM),
                        dim3(CSRGEMM_DIM),
                        0,
                        stream,
                        m,
                        csr_row_ptr_C,
-                       workspace);
+                       d_group_size,
+                       tmp_groups);
 
-    hipLaunchKernelGGL(
-        (csrgemm_max_row_nnz_part2<CSRGEMM_DIM>), dim3(1), dim3(CSRGEMM_DIM), 0, stream, workspace);
+    hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       d_group_size);
 #undef CSRGEMM_DIM
 
-    J nnz_max;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&nnz_max, workspace, sizeof(J), hipMemcpyDeviceToHost, stream));
+    // Append an empty group, such that the exclusive sum also yields the end of the last group
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(&d_group_size[CSRGEMM_MAXGROUPS], 0, sizeof(J), stream));
+
+    // Exclusive sum to obtain group offsets
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                d_group_size,
+                                                d_group_offset,
+                                                0,
+                                                CSRGEMM_MAXGROUPS + 1,
+                                                rocprim::plus<J>(),
+                                                stream));
+    rocprim_buffer = reinterpret_cast<void*>(buffer);
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                d_group_size,
+                                                d_group_offset,
+                                                0,
+                                                CSRGEMM_MAXGROUPS + 1,
+                                                rocprim::plus<J>(),
+                                                stream));
+
+    // Sort rows by groups. The group sizes are reused as counters, such that each row is
+    // scattered into its group
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_size, 0, sizeof(J) * CSRGEMM_MAXGROUPS, stream));
 
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-    // Group offset buffer
-    J* d_group_offset = reinterpret_cast<J*>(buffer);
-    buffer += sizeof(J) * 256;
-
-    // Group size buffer
-    J h_group_size[CSRGEMM_MAXGROUPS];
-
-    // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_group_permutation<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3((m - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       tmp_groups,
+                       d_group_offset,
+                       d_group_size,
+                       d_perm);
+#undef CSRGEMM_DIM
 
-    // Permutation array
-    J* d_perm = nullptr;
+    // The group sizes are no longer required and hold the maximum number of intermediate
+    // products of the rows of each group instead. The ESC groups fall back to the hash table,
+    // if any of their rows exceeds the shared memory table. This is estimated once for all
+    // groups, such that the fill kernels do not need to count the products of each row.
+    int* d_group_prod = reinterpret_cast<int*>(d_group_size);
 
-    // If maximum of row nnz exceeds 16, we process the rows in groups of
-    // similar sized row nnz
-    if(nnz_max > 16)
+    if(alg == rocsparse_spgemm_alg_esc || alg == rocsparse_spgemm_alg_default)
     {
-        // Group size buffer
-        J* d_group_size = reinterpret_cast<J*>(buffer);
-        buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
-
-        // Permutation temporary arrays
-        J* tmp_vals = reinterpret_cast<J*>(buffer);
-        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
-
-        J* tmp_perm = reinterpret_cast<J*>(buffer);
-        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
-
-        int* tmp_keys = reinterpret_cast<int*>(buffer);
-        buffer += ((sizeof(int) * m - 1) / 256 + 1) * 256;
-
-        int* tmp_groups = reinterpret_cast<int*>(buffer);
-        buffer += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(d_group_prod, 0, sizeof(int) * CSRGEMM_MAXGROUPS, stream));
 
-        // Determine number of rows per group
 #define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
         hipLaunchKernelGGL(
-            (csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, exceeding_smem>),
-            dim3(CSRGEMM_DIM),
+            (csrgemm_group_max_products<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_MAXGROUPS>),
+            dim3((m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
             dim3(CSRGEMM_DIM),
             0,
             stream,
             m,
-            csr_row_ptr_C,
-            d_group_size,
-            tmp_groups);
-
-        hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
-                           dim3(1),
-                           dim3(CSRGEMM_DIM),
-                           0,
-                           stream,
-                           d_group_size);
+            tmp_groups,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_B,
+            csr_row_ptr_D,
+            d_group_prod,
+            base_A,
+            info_C->csrgemm_info->mul,
+            info_C->csrgemm_info->add);
+#undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
+    }
 
-        // Exclusive sum to obtain group offsets
-        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
-                                                    rocprim_size,
-                                                    d_group_size,
-                                                    d_group_offset,
-                                                    0,
-                                                    CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<J>(),
-                                                    stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
-                                                    rocprim_size,
-                                                    d_group_size,
-                                                    d_group_offset,
-                                                    0,
-                                                    CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<J>(),
-                                                    stream));
-
-        // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
-                                           d_group_size,
-                                           sizeof(J) * CSRGEMM_MAXGROUPS,
-                                           hipMemcpyDeviceToHost,
-                                           stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-        // Create identity permutation for group access
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_create_identity_permutation_template(handle, m, tmp_perm));
-
-        rocprim::double_buffer<int> d_keys(tmp_groups, tmp_keys);
-        rocprim::double_buffer<J>   d_vals(tmp_perm, tmp_vals);
-
-        // Sort pairs (by groups)
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-            rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
-
-        d_perm = d_vals.current();
-
-        // Release tmp_groups buffer
-        buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    // Additional buffer for C = alpha * A * B of rows exceeding the shared memory
+    I* workspace_B
+        = (info_C->csrgemm_info->mul == true) ? reinterpret_cast<I*>(buffer) : nullptr;
 
-        // Release tmp_keys buffer
-        buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
-    }
-    else
+    // Keep row grouping for subsequent numeric computations
+    if(symbolic == true)
     {
-        // First group processes all rows
-        h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
+        RETURN_IF_ROCSPARSE_ERROR(
+            csrgemm_symbolic_store(handle, m, d_group_offset, d_perm, info_C));
     }
 
-    // Compute columns and accumulate values for each group
+    // Compute columns and accumulate values for each group, where each kernel is launched with
+    // a bounded grid and loops over the rows of its group
 
     // pointer mode device
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         // Group 0: 0 - 16 non-zeros per row
-        if(h_group_size[0] > 0)
         {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
@@ -751,11 +859,10 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                        CSRGEMM_SUB,
                                                                        CSRGEMM_HASHSIZE,
                                                                        CSRGEMM_FLL_HASH>),
-                               dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                               csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
-                               h_group_size[0],
                                std::max(k, n),
                                &d_group_offset[0],
                                d_perm,
@@ -778,14 +885,17 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 1: 17 - 32 non-zeros per row
-        if(h_group_size[1] > 0)
         {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
@@ -794,11 +904,10 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                        CSRGEMM_SUB,
                                                                        CSRGEMM_HASHSIZE,
                                                                        CSRGEMM_FLL_HASH>),
-                               dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                               csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
-                               h_group_size[1],
                                std::max(k, n),
                                &d_group_offset[1],
                                d_perm,
@@ -821,14 +930,17 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 2: 33 - 256 non-zeros per row
-        if(h_group_size[2] > 0)
         {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 16
@@ -837,7 +949,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
                                                                           CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[2]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -863,14 +975,19 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[2],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 3: 257 - 512 non-zeros per row
-        if(h_group_size[3] > 0)
         {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 32
@@ -879,7 +996,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
                                                                           CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[3]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -905,14 +1022,19 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[3],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 4: 513 - 1024 non-zeros per row
-        if(h_group_size[4] > 0)
         {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 32
@@ -921,7 +1043,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
                                                                           CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[4]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -947,14 +1069,19 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[4],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 5: 1025 - 2048 non-zeros per row
-        if(h_group_size[5] > 0)
         {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
@@ -963,7 +1090,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
                                                                           CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[5]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -989,7 +1116,13 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[5],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -997,10 +1130,9 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 
 #ifndef rocsparse_ILP64
         // Group 6: 2049 - 4096 non-zeros per row
-        if(h_group_size[6] > 0 && !exceeding_smem)
+        if(!exceeding_smem)
         {
             RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
-                                                       h_group_size[6],
                                                        &d_group_offset[6],
                                                        d_perm,
                                                        m,
@@ -1025,29 +1157,26 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                        descr_C->base,
                                                        base_D,
                                                        info_C->csrgemm_info->mul,
-                                                       info_C->csrgemm_info->add));
+                                                       info_C->csrgemm_info->add,
+                                                       alg,
+                                                       &d_group_prod[6],
+                                                       csr_row_ptr_M,
+                                                       csr_col_ind_M,
+                                                       base_M,
+                                                       complement_M));
         }
 #endif
 
         // Group 7: more than 4096 non-zeros per row
-        if(h_group_size[7] > 0)
         {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_CHUNKSIZE 2048
-            I* workspace_B = nullptr;
-
-            if(info_C->csrgemm_info->mul == true)
-            {
-                // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
-            }
-
             hipLaunchKernelGGL(
                 (csrgemm_fill_block_per_row_multipass_device_pointer<CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_CHUNKSIZE>),
-                dim3(h_group_size[7]),
+                csrgemm_group_grid(handle, m, 1),
                 dim3(CSRGEMM_DIM),
                 0,
                 stream,
@@ -1074,12 +1203,11 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                 descr_C->base,
                 base_D,
                 info_C->csrgemm_info->mul,
-                info_C->csrgemm_info->add);
-
-            if(info_C->csrgemm_info->mul == true)
-            {
-                RETURN_IF_HIP_ERROR(hipFree(workspace_B));
-            }
+                info_C->csrgemm_info->add,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                base_M,
+                complement_M);
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1088,7 +1216,6 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     else
     {
         // Group 0: 0 - 16 non-zeros per row
-        if(h_group_size[0] > 0)
         {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
@@ -1097,11 +1224,10 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_HASHSIZE,
                                                                      CSRGEMM_FLL_HASH>),
-                               dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                               csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
-                               h_group_size[0],
                                std::max(k, n),
                                &d_group_offset[0],
                                d_perm,
@@ -1124,14 +1250,17 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 1: 17 - 32 non-zeros per row
-        if(h_group_size[1] > 0)
         {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
@@ -1140,11 +1269,10 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_HASHSIZE,
                                                                      CSRGEMM_FLL_HASH>),
-                               dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                               csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
-                               h_group_size[1],
                                std::max(k, n),
                                &d_group_offset[1],
                                d_perm,
@@ -1167,14 +1295,17 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 2: 33 - 256 non-zeros per row
-        if(h_group_size[2] > 0)
         {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 16
@@ -1183,7 +1314,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
                                                                         CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[2]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -1209,14 +1340,19 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[2],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 3: 257 - 512 non-zeros per row
-        if(h_group_size[3] > 0)
         {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 32
@@ -1225,7 +1361,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
                                                                         CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[3]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -1251,14 +1387,19 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[3],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 4: 513 - 1024 non-zeros per row
-        if(h_group_size[4] > 0)
         {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 32
@@ -1267,7 +1408,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
                                                                         CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[4]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -1293,14 +1434,19 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[4],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
         }
 
         // Group 5: 1025 - 2048 non-zeros per row
-        if(h_group_size[5] > 0)
         {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
@@ -1309,7 +1455,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
                                                                         CSRGEMM_FLL_HASH>),
-                               dim3(h_group_size[5]),
+                               csrgemm_group_grid(handle, m, 1),
                                dim3(CSRGEMM_DIM),
                                0,
                                stream,
@@ -1335,7 +1481,13 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE),
+                               &d_group_prod[5],
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1343,10 +1495,9 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 
 #ifndef rocsparse_ILP64
         // Group 6: 2049 - 4096 non-zeros per row
-        if(h_group_size[6] > 0 && !exceeding_smem)
+        if(!exceeding_smem)
         {
             RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
-                                                       h_group_size[6],
                                                        &d_group_offset[6],
                                                        d_perm,
                                                        m,
@@ -1371,29 +1522,26 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                        descr_C->base,
                                                        base_D,
                                                        info_C->csrgemm_info->mul,
-                                                       info_C->csrgemm_info->add));
+                                                       info_C->csrgemm_info->add,
+                                                       alg,
+                                                       &d_group_prod[6],
+                                                       csr_row_ptr_M,
+                                                       csr_col_ind_M,
+                                                       base_M,
+                                                       complement_M));
         }
 #endif
 
         // Group 7: more than 4096 non-zeros per row
-        if(h_group_size[7] > 0)
         {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_CHUNKSIZE 2048
-            I* workspace_B = nullptr;
-
-            if(info_C->csrgemm_info->mul == true)
-            {
-                // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
-            }
-
             hipLaunchKernelGGL(
                 (csrgemm_fill_block_per_row_multipass_host_pointer<CSRGEMM_DIM,
                                                                    CSRGEMM_SUB,
                                                                    CSRGEMM_CHUNKSIZE>),
-                dim3(h_group_size[7]),
+                csrgemm_group_grid(handle, m, 1),
                 dim3(CSRGEMM_DIM),
                 0,
                 stream,
@@ -1420,12 +1568,11 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                 descr_C->base,
                 base_D,
                 info_C->csrgemm_info->mul,
-                info_C->csrgemm_info->add);
-
-            if(info_C->csrgemm_info->mul == true)
-            {
-                RETURN_IF_HIP_ERROR(hipFree(workspace_B));
-            }
+                info_C->csrgemm_info->add,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                base_M,
+                complement_M);
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1464,7 +1611,8 @@ static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_hand
                                                                   const I* csr_row_ptr_C,
                                                                   J*       csr_col_ind_C,
                                                                   const rocsparse_mat_info info_C,
-                                                                  void* temp_buffer)
+                                                                  void* temp_buffer,
+                                                                  bool symbolic)
 {
     // Check for valid info structure
     if(info_C->csrgemm_info == nullptr)
@@ -1578,7 +1726,8 @@ static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_hand
                                                csr_row_ptr_C,
                                                csr_col_ind_C,
                                                info_C,
-                                               temp_buffer);
+                                               temp_buffer,
+                                               symbolic);
     }
 
     // Perform gemm calculation
@@ -1610,7 +1759,8 @@ static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_hand
                                            csr_row_ptr_C,
                                            csr_col_ind_C,
                                            info_C,
-                                           temp_buffer);
+                                           temp_buffer,
+                                           symbolic);
 }
 
 template <typename I, typename J, typename T>
@@ -1636,7 +1786,8 @@ static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle
                                                                const I* csr_row_ptr_C,
                                                                J*       csr_col_ind_C,
                                                                const rocsparse_mat_info info_C,
-                                                               void*                    temp_buffer)
+                                                               void* temp_buffer,
+                                                               bool                      symbolic)
 {
     // Check for valid info structure
     if(info_C->csrgemm_info == nullptr)
@@ -1723,7 +1874,8 @@ static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle
                                            csr_row_ptr_C,
                                            csr_col_ind_C,
                                            info_C,
-                                           temp_buffer);
+                                           temp_buffer,
+                                           symbolic);
 }
 
 template <unsigned int BLOCKSIZE, typename I, typename T>
@@ -1857,83 +2009,37 @@ static inline rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle
 }
 
 template <typename I, typename J, typename T>
-rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
-                                            rocsparse_operation       trans_A,
-                                            rocsparse_operation       trans_B,
-                                            J                         m,
-                                            J                         n,
-                                            J                         k,
-                                            const T*                  alpha,
-                                            const rocsparse_mat_descr descr_A,
-                                            I                         nnz_A,
-                                            const T*                  csr_val_A,
-                                            const I*                  csr_row_ptr_A,
-                                            const J*                  csr_col_ind_A,
-                                            const rocsparse_mat_descr descr_B,
-                                            I                         nnz_B,
-                                            const T*                  csr_val_B,
-                                            const I*                  csr_row_ptr_B,
-                                            const J*                  csr_col_ind_B,
-                                            const T*                  beta,
-                                            const rocsparse_mat_descr descr_D,
-                                            I                         nnz_D,
-                                            const T*                  csr_val_D,
-                                            const I*                  csr_row_ptr_D,
-                                            const J*                  csr_col_ind_D,
-                                            const rocsparse_mat_descr descr_C,
-                                            T*                        csr_val_C,
-                                            const I*                  csr_row_ptr_C,
-                                            J*                        csr_col_ind_C,
-                                            const rocsparse_mat_info  info_C,
-                                            void*                     temp_buffer)
+static inline rocsparse_status rocsparse_csrgemm_core_template(rocsparse_handle          handle,
+                                                               rocsparse_operation       trans_A,
+                                                               rocsparse_operation       trans_B,
+                                                               J                         m,
+                                                               J                         n,
+                                                               J                         k,
+                                                               const T*                  alpha,
+                                                               const rocsparse_mat_descr descr_A,
+                                                               I                         nnz_A,
+                                                               const T*                  csr_val_A,
+                                                               const I* csr_row_ptr_A,
+                                                               const J* csr_col_ind_A,
+                                                               const rocsparse_mat_descr descr_B,
+                                                               I                         nnz_B,
+                                                               const T*                  csr_val_B,
+                                                               const I* csr_row_ptr_B,
+                                                               const J* csr_col_ind_B,
+                                                               const T* beta,
+                                                               const rocsparse_mat_descr descr_D,
+                                                               I                         nnz_D,
+                                                               const T*                  csr_val_D,
+                                                               const I* csr_row_ptr_D,
+                                                               const J* csr_col_ind_D,
+                                                               const rocsparse_mat_descr descr_C,
+                                                               T*                        csr_val_C,
+                                                               const I* csr_row_ptr_C,
+                                                               J*       csr_col_ind_C,
+                                                               const rocsparse_mat_info info_C,
+                                                               void* temp_buffer,
+                                                               bool                      symbolic)
 {
-    // Check for valid handle and info structure
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-
-    // Logging
-    log_trace(handle,
-              replaceX<T>("rocsparse_Xcsrgemm"),
-              trans_A,
-              trans_B,
-              m,
-              n,
-              k,
-              LOG_TRACE_SCALAR_VALUE(handle, alpha),
-              (const void*&)descr_A,
-              nnz_A,
-              (const void*&)csr_val_A,
-              (const void*&)csr_row_ptr_A,
-              (const void*&)csr_col_ind_A,
-              (const void*&)descr_B,
-              nnz_B,
-              (const void*&)csr_val_B,
-              (const void*&)csr_row_ptr_B,
-              (const void*&)csr_col_ind_B,
-              LOG_TRACE_SCALAR_VALUE(handle, beta),
-              (const void*&)descr_D,
-              nnz_D,
-              (const void*&)csr_val_D,
-              (const void*&)csr_row_ptr_D,
-              (const void*&)csr_col_ind_D,
-              (const void*&)descr_C,
-              (const void*&)csr_val_C,
-              (const void*&)csr_row_ptr_C,
-              (const void*&)csr_col_ind_C,
-              (const void*&)info_C,
-              (const void*&)temp_buffer);
-
-    log_bench(handle,
-              "./rocsparse-bench -f csrgemm -r",
-              replaceX<T>("X"),
-              "--mtx <matrix.mtx> ",
-              "--alpha",
-              LOG_BENCH_SCALAR_VALUE(handle, alpha),
-              "--beta",
-              LOG_BENCH_SCALAR_VALUE(handle, beta));
-
     // Check for valid rocsparse_mat_info
     if(info_C == nullptr)
     {
@@ -1978,7 +2084,8 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                                   csr_row_ptr_C,
                                                   csr_col_ind_C,
                                                   info_C,
-                                                  temp_buffer);
+                                                  temp_buffer,
+                                                  symbolic);
     }
     else if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == false)
     {
@@ -2005,7 +2112,8 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                                csr_row_ptr_C,
                                                csr_col_ind_C,
                                                info_C,
-                                               temp_buffer);
+                                               temp_buffer,
+                                               symbolic);
     }
     else if(info_C->csrgemm_info->mul == false && info_C->csrgemm_info->add == true)
     {
@@ -2035,36 +2143,1368 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                       \
-    template rocsparse_status rocsparse_csrgemm_template<ITYPE, JTYPE, TTYPE>( \
-        rocsparse_handle          handle,                                      \
-        rocsparse_operation       trans_A,                                     \
-        rocsparse_operation       trans_B,                                     \
-        JTYPE                     m,                                           \
-        JTYPE                     n,                                           \
-        JTYPE                     k,                                           \
-        const TTYPE*              alpha,                                       \
-        const rocsparse_mat_descr descr_A,                                     \
-        ITYPE                     nnz_A,                                       \
-        const TTYPE*              csr_val_A,                                   \
-        const ITYPE*              csr_row_ptr_A,                               \
-        const JTYPE*              csr_col_ind_A,                               \
-        const rocsparse_mat_descr descr_B,                                     \
-        ITYPE                     nnz_B,                                       \
-        const TTYPE*              csr_val_B,                                   \
-        const ITYPE*              csr_row_ptr_B,                               \
-        const JTYPE*              csr_col_ind_B,                               \
-        const TTYPE*              beta,                                        \
-        const rocsparse_mat_descr descr_D,                                     \
-        ITYPE                     nnz_D,                                       \
-        const TTYPE*              csr_val_D,                                   \
-        const ITYPE*              csr_row_ptr_D,                               \
-        const JTYPE*              csr_col_ind_D,                               \
-        const rocsparse_mat_descr descr_C,                                     \
-        TTYPE*                    csr_val_C,                                   \
-        const ITYPE*              csr_row_ptr_C,                               \
-        JTYPE*                    csr_col_ind_C,                               \
-        const rocsparse_mat_info  info_C,                                      \
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            J                         m,
+                                            J                         n,
+                                            J                         k,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            I                         nnz_A,
+                                            const T*                  csr_val_A,
+                                            const I*                  csr_row_ptr_A,
+                                            const J*                  csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            I                         nnz_B,
+                                            const T*                  csr_val_B,
+                                            const I*                  csr_row_ptr_B,
+                                            const J*                  csr_col_ind_B,
+                                            const T*                  beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            I                         nnz_D,
+                                            const T*                  csr_val_D,
+                                            const I*                  csr_row_ptr_D,
+                                            const J*                  csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        csr_val_C,
+                                            const I*                  csr_row_ptr_C,
+                                            J*                        csr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_val_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrgemm -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--alpha",
+              LOG_BENCH_SCALAR_VALUE(handle, alpha),
+              "--beta",
+              LOG_BENCH_SCALAR_VALUE(handle, beta));
+
+    return rocsparse_csrgemm_core_template(handle,
+                                           trans_A,
+                                           trans_B,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           descr_A,
+                                           nnz_A,
+                                           csr_val_A,
+                                           csr_row_ptr_A,
+                                           csr_col_ind_A,
+                                           descr_B,
+                                           nnz_B,
+                                           csr_val_B,
+                                           csr_row_ptr_B,
+                                           csr_col_ind_B,
+                                           beta,
+                                           descr_D,
+                                           nnz_D,
+                                           csr_val_D,
+                                           csr_row_ptr_D,
+                                           csr_col_ind_D,
+                                           descr_C,
+                                           csr_val_C,
+                                           csr_row_ptr_C,
+                                           csr_col_ind_C,
+                                           info_C,
+                                           temp_buffer,
+                                           false);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int NNZSIZE,
+          typename I,
+          typename J,
+          typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_fill_wf_per_row_host_pointer(const J* __restrict__ offset,
+                                                      const J* __restrict__ perm,
+                                                      T alpha,
+                                                      const I* __restrict__ csr_row_ptr_A,
+                                                      const J* __restrict__ csr_col_ind_A,
+                                                      const T* __restrict__ csr_val_A,
+                                                      const I* __restrict__ csr_row_ptr_B,
+                                                      const J* __restrict__ csr_col_ind_B,
+                                                      const T* __restrict__ csr_val_B,
+                                                      T beta,
+                                                      const I* __restrict__ csr_row_ptr_D,
+                                                      const J* __restrict__ csr_col_ind_D,
+                                                      const T* __restrict__ csr_val_D,
+                                                      const I* __restrict__ csr_row_ptr_C,
+                                                      const J* __restrict__ csr_col_ind_C,
+                                                      T* __restrict__ csr_val_C,
+                                                      rocsparse_index_base idx_base_A,
+                                                      rocsparse_index_base idx_base_B,
+                                                      rocsparse_index_base idx_base_C,
+                                                      rocsparse_index_base idx_base_D,
+                                                      bool                 mul,
+                                                      bool                 add)
+{
+    csrgemm_numeric_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, NNZSIZE>(offset,
+                                                                       perm,
+                                                                       alpha,
+                                                                       csr_row_ptr_A,
+                                                                       csr_col_ind_A,
+                                                                       csr_val_A,
+                                                                       csr_row_ptr_B,
+                                                                       csr_col_ind_B,
+                                                                       csr_val_B,
+                                                                       beta,
+                                                                       csr_row_ptr_D,
+                                                                       csr_col_ind_D,
+                                                                       csr_val_D,
+                                                                       csr_row_ptr_C,
+                                                                       csr_col_ind_C,
+                                                                       csr_val_C,
+                                                                       idx_base_A,
+                                                                       idx_base_B,
+                                                                       idx_base_C,
+                                                                       idx_base_D,
+                                                                       mul,
+                                                                       add);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int NNZSIZE,
+          typename I,
+          typename J,
+          typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_fill_wf_per_row_device_pointer(const J* __restrict__ offset,
+                                                        const J* __restrict__ perm,
+                                                        const T* __restrict__ alpha,
+                                                        const I* __restrict__ csr_row_ptr_A,
+                                                        const J* __restrict__ csr_col_ind_A,
+                                                        const T* __restrict__ csr_val_A,
+                                                        const I* __restrict__ csr_row_ptr_B,
+                                                        const J* __restrict__ csr_col_ind_B,
+                                                        const T* __restrict__ csr_val_B,
+                                                        const T* __restrict__ beta,
+                                                        const I* __restrict__ csr_row_ptr_D,
+                                                        const J* __restrict__ csr_col_ind_D,
+                                                        const T* __restrict__ csr_val_D,
+                                                        const I* __restrict__ csr_row_ptr_C,
+                                                        const J* __restrict__ csr_col_ind_C,
+                                                        T* __restrict__ csr_val_C,
+                                                        rocsparse_index_base idx_base_A,
+                                                        rocsparse_index_base idx_base_B,
+                                                        rocsparse_index_base idx_base_C,
+                                                        rocsparse_index_base idx_base_D,
+                                                        bool                 mul,
+                                                        bool                 add)
+{
+    csrgemm_numeric_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, NNZSIZE>(
+        offset,
+        perm,
+        (mul == true) ? *alpha : static_cast<T>(0),
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        (add == true) ? *beta : static_cast<T>(0),
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int NNZSIZE,
+          typename I,
+          typename J,
+          typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_fill_block_per_row_host_pointer(const J* __restrict__ offset,
+                                                         const J* __restrict__ perm,
+                                                         T alpha,
+                                                         const I* __restrict__ csr_row_ptr_A,
+                                                         const J* __restrict__ csr_col_ind_A,
+                                                         const T* __restrict__ csr_val_A,
+                                                         const I* __restrict__ csr_row_ptr_B,
+                                                         const J* __restrict__ csr_col_ind_B,
+                                                         const T* __restrict__ csr_val_B,
+                                                         T beta,
+                                                         const I* __restrict__ csr_row_ptr_D,
+                                                         const J* __restrict__ csr_col_ind_D,
+                                                         const T* __restrict__ csr_val_D,
+                                                         const I* __restrict__ csr_row_ptr_C,
+                                                         const J* __restrict__ csr_col_ind_C,
+                                                         T* __restrict__ csr_val_C,
+                                                         rocsparse_index_base idx_base_A,
+                                                         rocsparse_index_base idx_base_B,
+                                                         rocsparse_index_base idx_base_C,
+                                                         rocsparse_index_base idx_base_D,
+                                                         bool                 mul,
+                                                         bool                 add)
+{
+    csrgemm_numeric_fill_block_per_row_device<BLOCKSIZE, WFSIZE, NNZSIZE>(offset,
+                                                                          perm,
+                                                                          alpha,
+                                                                          csr_row_ptr_A,
+                                                                          csr_col_ind_A,
+                                                                          csr_val_A,
+                                                                          csr_row_ptr_B,
+                                                                          csr_col_ind_B,
+                                                                          csr_val_B,
+                                                                          beta,
+                                                                          csr_row_ptr_D,
+                                                                          csr_col_ind_D,
+                                                                          csr_val_D,
+                                                                          csr_row_ptr_C,
+                                                                          csr_col_ind_C,
+                                                                          csr_val_C,
+                                                                          idx_base_A,
+                                                                          idx_base_B,
+                                                                          idx_base_C,
+                                                                          idx_base_D,
+                                                                          mul,
+                                                                          add);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int NNZSIZE,
+          typename I,
+          typename J,
+          typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_fill_block_per_row_device_pointer(const J* __restrict__ offset,
+                                                           const J* __restrict__ perm,
+                                                           const T* __restrict__ alpha,
+                                                           const I* __restrict__ csr_row_ptr_A,
+                                                           const J* __restrict__ csr_col_ind_A,
+                                                           const T* __restrict__ csr_val_A,
+                                                           const I* __restrict__ csr_row_ptr_B,
+                                                           const J* __restrict__ csr_col_ind_B,
+                                                           const T* __restrict__ csr_val_B,
+                                                           const T* __restrict__ beta,
+                                                           const I* __restrict__ csr_row_ptr_D,
+                                                           const J* __restrict__ csr_col_ind_D,
+                                                           const T* __restrict__ csr_val_D,
+                                                           const I* __restrict__ csr_row_ptr_C,
+                                                           const J* __restrict__ csr_col_ind_C,
+                                                           T* __restrict__ csr_val_C,
+                                                           rocsparse_index_base idx_base_A,
+                                                           rocsparse_index_base idx_base_B,
+                                                           rocsparse_index_base idx_base_C,
+                                                           rocsparse_index_base idx_base_D,
+                                                           bool                 mul,
+                                                           bool                 add)
+{
+    csrgemm_numeric_fill_block_per_row_device<BLOCKSIZE, WFSIZE, NNZSIZE>(
+        offset,
+        perm,
+        (mul == true) ? *alpha : static_cast<T>(0),
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        (add == true) ? *beta : static_cast<T>(0),
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_fill_global_host_pointer(const J* __restrict__ offset,
+                                                  const J* __restrict__ perm,
+                                                  T alpha,
+                                                  const I* __restrict__ csr_row_ptr_A,
+                                                  const J* __restrict__ csr_col_ind_A,
+                                                  const T* __restrict__ csr_val_A,
+                                                  const I* __restrict__ csr_row_ptr_B,
+                                                  const J* __restrict__ csr_col_ind_B,
+                                                  const T* __restrict__ csr_val_B,
+                                                  T beta,
+                                                  const I* __restrict__ csr_row_ptr_D,
+                                                  const J* __restrict__ csr_col_ind_D,
+                                                  const T* __restrict__ csr_val_D,
+                                                  const I* __restrict__ csr_row_ptr_C,
+                                                  const J* __restrict__ csr_col_ind_C,
+                                                  T* __restrict__ csr_val_C,
+                                                  rocsparse_index_base idx_base_A,
+                                                  rocsparse_index_base idx_base_B,
+                                                  rocsparse_index_base idx_base_C,
+                                                  rocsparse_index_base idx_base_D,
+                                                  bool                 mul,
+                                                  bool                 add)
+{
+    csrgemm_numeric_fill_global_device<BLOCKSIZE, WFSIZE>(offset,
+                                                          perm,
+                                                          alpha,
+                                                          csr_row_ptr_A,
+                                                          csr_col_ind_A,
+                                                          csr_val_A,
+                                                          csr_row_ptr_B,
+                                                          csr_col_ind_B,
+                                                          csr_val_B,
+                                                          beta,
+                                                          csr_row_ptr_D,
+                                                          csr_col_ind_D,
+                                                          csr_val_D,
+                                                          csr_row_ptr_C,
+                                                          csr_col_ind_C,
+                                                          csr_val_C,
+                                                          idx_base_A,
+                                                          idx_base_B,
+                                                          idx_base_C,
+                                                          idx_base_D,
+                                                          mul,
+                                                          add);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_numeric_fill_global_device_pointer(const J* __restrict__ offset,
+                                                    const J* __restrict__ perm,
+                                                    const T* __restrict__ alpha,
+                                                    const I* __restrict__ csr_row_ptr_A,
+                                                    const J* __restrict__ csr_col_ind_A,
+                                                    const T* __restrict__ csr_val_A,
+                                                    const I* __restrict__ csr_row_ptr_B,
+                                                    const J* __restrict__ csr_col_ind_B,
+                                                    const T* __restrict__ csr_val_B,
+                                                    const T* __restrict__ beta,
+                                                    const I* __restrict__ csr_row_ptr_D,
+                                                    const J* __restrict__ csr_col_ind_D,
+                                                    const T* __restrict__ csr_val_D,
+                                                    const I* __restrict__ csr_row_ptr_C,
+                                                    const J* __restrict__ csr_col_ind_C,
+                                                    T* __restrict__ csr_val_C,
+                                                    rocsparse_index_base idx_base_A,
+                                                    rocsparse_index_base idx_base_B,
+                                                    rocsparse_index_base idx_base_C,
+                                                    rocsparse_index_base idx_base_D,
+                                                    bool                 mul,
+                                                    bool                 add)
+{
+    csrgemm_numeric_fill_global_device<BLOCKSIZE, WFSIZE>(
+        offset,
+        perm,
+        (mul == true) ? *alpha : static_cast<T>(0),
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        (add == true) ? *beta : static_cast<T>(0),
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add);
+}
+
+#define CSRGEMM_NUMERIC_LAUNCH(KERNEL, GRID, BLOCK, ALPHA, BETA, ...) \
+    hipLaunchKernelGGL(KERNEL,                                         \
+                       GRID,                                           \
+                       BLOCK,                                          \
+                       0,                                              \
+                       stream,                                         \
+                       __VA_ARGS__,                                    \
+                       perm,                                           \
+                       ALPHA,                                          \
+                       csr_row_ptr_A,                                  \
+                       csr_col_ind_A,                                  \
+                       csr_val_A,                                      \
+                       csr_row_ptr_B,                                  \
+                       csr_col_ind_B,                                  \
+                       csr_val_B,                                      \
+                       BETA,                                           \
+                       csr_row_ptr_D,                                  \
+                       csr_col_ind_D,                                  \
+                       csr_val_D,                                      \
+                       csr_row_ptr_C,                                  \
+                       csr_col_ind_C,                                  \
+                       csr_val_C,                                      \
+                       base_A,                                         \
+                       base_B,                                         \
+                       base_C,                                         \
+                       base_D,                                         \
+                       mul,                                            \
+                       add)
+
+// Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
+// if I == J == int64_t, as required size would exceed available memory
+template <typename I,
+          typename J,
+          typename T,
+          typename std::enable_if<
+              std::is_same<T, rocsparse_double_complex>::value
+                  || (std::is_same<T, double>::value && std::is_same<I, int64_t>::value
+                      && std::is_same<J, int64_t>::value)
+                  || (std::is_same<T, rocsparse_float_complex>::value
+                      && std::is_same<I, int64_t>::value && std::is_same<J, int64_t>::value),
+              int>::type
+          = 0>
+static inline rocsparse_status csrgemm_numeric_launcher(rocsparse_handle     handle,
+                                                        J                    m,
+                                                        const J*             group_offset,
+                                                        const J*             perm,
+                                                        const T*             alpha,
+                                                        const I*             csr_row_ptr_A,
+                                                        const J*             csr_col_ind_A,
+                                                        const T*             csr_val_A,
+                                                        const I*             csr_row_ptr_B,
+                                                        const J*             csr_col_ind_B,
+                                                        const T*             csr_val_B,
+                                                        const T*             beta,
+                                                        const I*             csr_row_ptr_D,
+                                                        const J*             csr_col_ind_D,
+                                                        const T*             csr_val_D,
+                                                        const I*             csr_row_ptr_C,
+                                                        const J*             csr_col_ind_C,
+                                                        T*                   csr_val_C,
+                                                        rocsparse_index_base base_A,
+                                                        rocsparse_index_base base_B,
+                                                        rocsparse_index_base base_C,
+                                                        rocsparse_index_base base_D,
+                                                        bool                 mul,
+                                                        bool                 add)
+{
+    return rocsparse_status_internal_error;
+}
+
+template <typename I,
+          typename J,
+          typename T,
+          typename std::enable_if<
+              std::is_same<T, float>::value
+                  || (std::is_same<T, double>::value
+                      && (std::is_same<I, int32_t>::value || std::is_same<J, int32_t>::value))
+                  || (std::is_same<T, rocsparse_float_complex>::value
+                      && (std::is_same<I, int32_t>::value || std::is_same<J, int32_t>::value)),
+              int>::type
+          = 0>
+static inline rocsparse_status csrgemm_numeric_launcher(rocsparse_handle     handle,
+                                                        J                    m,
+                                                        const J*             group_offset,
+                                                        const J*             perm,
+                                                        const T*             alpha,
+                                                        const I*             csr_row_ptr_A,
+                                                        const J*             csr_col_ind_A,
+                                                        const T*             csr_val_A,
+                                                        const I*             csr_row_ptr_B,
+                                                        const J*             csr_col_ind_B,
+                                                        const T*             csr_val_B,
+                                                        const T*             beta,
+                                                        const I*             csr_row_ptr_D,
+                                                        const J*             csr_col_ind_D,
+                                                        const T*             csr_val_D,
+                                                        const I*             csr_row_ptr_C,
+                                                        const J*             csr_col_ind_C,
+                                                        T*                   csr_val_C,
+                                                        rocsparse_index_base base_A,
+                                                        rocsparse_index_base base_B,
+                                                        rocsparse_index_base base_C,
+                                                        rocsparse_index_base base_D,
+                                                        bool                 mul,
+                                                        bool                 add)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 64
+#define CSRGEMM_NNZSIZE 4096
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        CSRGEMM_NUMERIC_LAUNCH((csrgemm_numeric_fill_block_per_row_device_pointer<CSRGEMM_DIM,
+                                                                                  CSRGEMM_SUB,
+                                                                                  CSRGEMM_NNZSIZE>),
+                               csrgemm_group_grid(handle, m, 1),
+                               dim3(CSRGEMM_DIM),
+                               alpha,
+                               beta,
+                               group_offset);
+    }
+    else
+    {
+        CSRGEMM_NUMERIC_LAUNCH((csrgemm_numeric_fill_block_per_row_host_pointer<CSRGEMM_DIM,
+                                                                                CSRGEMM_SUB,
+                                                                                CSRGEMM_NNZSIZE>),
+                               csrgemm_group_grid(handle, m, 1),
+                               dim3(CSRGEMM_DIM),
+                               mul ? *alpha : static_cast<T>(0),
+                               add ? *beta : static_cast<T>(0),
+                               group_offset);
+    }
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+static inline rocsparse_status
+    rocsparse_csrgemm_numeric_calc_template(rocsparse_handle          handle,
+                                            J                         m,
+                                            J                         n,
+                                            J                         k,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            const T*                  csr_val_A,
+                                            const I*                  csr_row_ptr_A,
+                                            const J*                  csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            const T*                  csr_val_B,
+                                            const I*                  csr_row_ptr_B,
+                                            const J*                  csr_col_ind_B,
+                                            const T*                  beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            const T*                  csr_val_D,
+                                            const I*                  csr_row_ptr_D,
+                                            const J*                  csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        csr_val_C,
+                                            const I*                  csr_row_ptr_C,
+                                            const J*                  csr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            bool                      mul,
+                                            bool                      add)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_csrgemm_info info = info_C->csrgemm_info;
+
+    // Row grouping of C must be available from the symbolic stage
+    if(info->group_offset == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Index base
+    rocsparse_index_base base_A = mul ? descr_A->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_B = mul ? descr_B->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_C = descr_C->base;
+    rocsparse_index_base base_D = add ? descr_D->base : rocsparse_index_base_zero;
+
+    // Flag for exceeding shared memory
+    constexpr bool exceeding_smem
+        = std::is_same<T, rocsparse_double_complex>::value
+          || (std::is_same<T, double>::value && std::is_same<I, int64_t>::value
+              && std::is_same<J, int64_t>::value)
+          || (std::is_same<T, rocsparse_float_complex>::value && std::is_same<I, int64_t>::value
+              && std::is_same<J, int64_t>::value);
+
+    // Row grouping of C, obtained from the symbolic stage
+    const J* group_offset = reinterpret_cast<const J*>(info->group_offset);
+    const J* perm         = reinterpret_cast<const J*>(info->perm);
+
+    // Accumulate values for each group, where each kernel is launched with a bounded grid and
+    // loops over the rows of its group
+
+    // pointer mode device
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // Group 0: 0 - 16 non-zeros per row
+        {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+#define CSRGEMM_NNZSIZE 16
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_wf_per_row_device_pointer<CSRGEMM_DIM,
+                                                                CSRGEMM_SUB,
+                                                                CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[0]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 1: 17 - 32 non-zeros per row
+        {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_NNZSIZE 32
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_wf_per_row_device_pointer<CSRGEMM_DIM,
+                                                                CSRGEMM_SUB,
+                                                                CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[1]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 2: 33 - 256 non-zeros per row
+        {
+#define CSRGEMM_DIM 128
+#define CSRGEMM_SUB 16
+#define CSRGEMM_NNZSIZE 256
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_device_pointer<CSRGEMM_DIM,
+                                                                   CSRGEMM_SUB,
+                                                                   CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[2]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 3: 257 - 512 non-zeros per row
+        {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+#define CSRGEMM_NNZSIZE 512
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_device_pointer<CSRGEMM_DIM,
+                                                                   CSRGEMM_SUB,
+                                                                   CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[3]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 4: 513 - 1024 non-zeros per row
+        {
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 32
+#define CSRGEMM_NNZSIZE 1024
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_device_pointer<CSRGEMM_DIM,
+                                                                   CSRGEMM_SUB,
+                                                                   CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[4]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 5: 1025 - 2048 non-zeros per row
+        {
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_NNZSIZE 2048
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_device_pointer<CSRGEMM_DIM,
+                                                                   CSRGEMM_SUB,
+                                                                   CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[5]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+#ifndef rocsparse_ILP64
+        // Group 6: 2049 - 4096 non-zeros per row
+        if(!exceeding_smem)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(csrgemm_numeric_launcher(handle,
+                                                               m,
+                                                               &group_offset[6],
+                                                               perm,
+                                                               alpha,
+                                                               csr_row_ptr_A,
+                                                               csr_col_ind_A,
+                                                               csr_val_A,
+                                                               csr_row_ptr_B,
+                                                               csr_col_ind_B,
+                                                               csr_val_B,
+                                                               beta,
+                                                               csr_row_ptr_D,
+                                                               csr_col_ind_D,
+                                                               csr_val_D,
+                                                               csr_row_ptr_C,
+                                                               csr_col_ind_C,
+                                                               csr_val_C,
+                                                               base_A,
+                                                               base_B,
+                                                               base_C,
+                                                               base_D,
+                                                               mul,
+                                                               add));
+        }
+#endif
+
+        // Group 7: more than 4096 non-zeros per row
+        {
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_global_device_pointer<CSRGEMM_DIM, CSRGEMM_SUB>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                alpha,
+                beta,
+                &group_offset[7]);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+    }
+    else
+    {
+        // Group 0: 0 - 16 non-zeros per row
+        {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+#define CSRGEMM_NNZSIZE 16
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_wf_per_row_host_pointer<CSRGEMM_DIM,
+                                                              CSRGEMM_SUB,
+                                                              CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[0]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 1: 17 - 32 non-zeros per row
+        {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_NNZSIZE 32
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_wf_per_row_host_pointer<CSRGEMM_DIM,
+                                                              CSRGEMM_SUB,
+                                                              CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[1]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 2: 33 - 256 non-zeros per row
+        {
+#define CSRGEMM_DIM 128
+#define CSRGEMM_SUB 16
+#define CSRGEMM_NNZSIZE 256
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_host_pointer<CSRGEMM_DIM,
+                                                                 CSRGEMM_SUB,
+                                                                 CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[2]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 3: 257 - 512 non-zeros per row
+        {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+#define CSRGEMM_NNZSIZE 512
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_host_pointer<CSRGEMM_DIM,
+                                                                 CSRGEMM_SUB,
+                                                                 CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[3]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 4: 513 - 1024 non-zeros per row
+        {
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 32
+#define CSRGEMM_NNZSIZE 1024
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_host_pointer<CSRGEMM_DIM,
+                                                                 CSRGEMM_SUB,
+                                                                 CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[4]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+        // Group 5: 1025 - 2048 non-zeros per row
+        {
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_NNZSIZE 2048
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_block_per_row_host_pointer<CSRGEMM_DIM,
+                                                                 CSRGEMM_SUB,
+                                                                 CSRGEMM_NNZSIZE>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[5]);
+#undef CSRGEMM_NNZSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+
+#ifndef rocsparse_ILP64
+        // Group 6: 2049 - 4096 non-zeros per row
+        if(!exceeding_smem)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(csrgemm_numeric_launcher(handle,
+                                                               m,
+                                                               &group_offset[6],
+                                                               perm,
+                                                               alpha,
+                                                               csr_row_ptr_A,
+                                                               csr_col_ind_A,
+                                                               csr_val_A,
+                                                               csr_row_ptr_B,
+                                                               csr_col_ind_B,
+                                                               csr_val_B,
+                                                               beta,
+                                                               csr_row_ptr_D,
+                                                               csr_col_ind_D,
+                                                               csr_val_D,
+                                                               csr_row_ptr_C,
+                                                               csr_col_ind_C,
+                                                               csr_val_C,
+                                                               base_A,
+                                                               base_B,
+                                                               base_C,
+                                                               base_D,
+                                                               mul,
+                                                               add));
+        }
+#endif
+
+        // Group 7: more than 4096 non-zeros per row
+        {
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+            CSRGEMM_NUMERIC_LAUNCH(
+                (csrgemm_numeric_fill_global_host_pointer<CSRGEMM_DIM, CSRGEMM_SUB>),
+                csrgemm_group_grid(handle, m, 1),
+                dim3(CSRGEMM_DIM),
+                mul ? *alpha : static_cast<T>(0),
+                add ? *beta : static_cast<T>(0),
+                &group_offset[7]);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef CSRGEMM_NUMERIC_LAUNCH
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_symbolic_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const T*                  csr_val_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const T*                  csr_val_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const T*                  beta,
+                                                     const rocsparse_mat_descr descr_D,
+                                                     I                         nnz_D,
+                                                     const T*                  csr_val_D,
+                                                     const I*                  csr_row_ptr_D,
+                                                     const J*                  csr_col_ind_D,
+                                                     const rocsparse_mat_descr descr_C,
+                                                     T*                        csr_val_C,
+                                                     const I*                  csr_row_ptr_C,
+                                                     J*                        csr_col_ind_C,
+                                                     const rocsparse_mat_info  info_C,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_symbolic"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_val_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Compute C and keep its row grouping
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_core_template(handle,
+                                                              trans_A,
+                                                              trans_B,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              alpha,
+                                                              descr_A,
+                                                              nnz_A,
+                                                              csr_val_A,
+                                                              csr_row_ptr_A,
+                                                              csr_col_ind_A,
+                                                              descr_B,
+                                                              nnz_B,
+                                                              csr_val_B,
+                                                              csr_row_ptr_B,
+                                                              csr_col_ind_B,
+                                                              beta,
+                                                              descr_D,
+                                                              nnz_D,
+                                                              csr_val_D,
+                                                              csr_row_ptr_D,
+                                                              csr_col_ind_D,
+                                                              descr_C,
+                                                              csr_val_C,
+                                                              csr_row_ptr_C,
+                                                              csr_col_ind_C,
+                                                              info_C,
+                                                              temp_buffer,
+                                                              true));
+
+    // Structure of C is known, numeric computations can be performed
+    info_C->csrgemm_info->symbolic = true;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_numeric_template(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    J                         m,
+                                                    J                         n,
+                                                    J                         k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    I                         nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const I*                  csr_row_ptr_A,
+                                                    const J*                  csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    I                         nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const I*                  csr_row_ptr_B,
+                                                    const J*                  csr_col_ind_B,
+                                                    const T*                  beta,
+                                                    const rocsparse_mat_descr descr_D,
+                                                    I                         nnz_D,
+                                                    const T*                  csr_val_D,
+                                                    const I*                  csr_row_ptr_D,
+                                                    const J*                  csr_col_ind_D,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const I*                  csr_row_ptr_C,
+                                                    const J*                  csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_numeric"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_val_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Structure of C must have been computed in the symbolic stage
+    if(info_C->csrgemm_info->symbolic == false)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_D < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    bool mul = info_C->csrgemm_info->mul;
+    bool add = info_C->csrgemm_info->add;
+
+    // C = 0
+    if(mul == false && add == false)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Skip contributions without any non-zero entries
+    mul = mul && k != 0 && nnz_A != 0 && nnz_B != 0;
+    add = add && nnz_D != 0;
+
+    // Check valid pointers
+    if(descr_C == nullptr || csr_val_C == nullptr || csr_row_ptr_C == nullptr
+       || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mul == true
+       && (alpha == nullptr || descr_A == nullptr || csr_val_A == nullptr
+           || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr || descr_B == nullptr
+           || csr_val_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(add == true
+       && (beta == nullptr || descr_D == nullptr || csr_val_D == nullptr
+           || csr_row_ptr_D == nullptr || csr_col_ind_D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // C = 0, as both contributions are empty
+    if(mul == false && add == false)
+    {
+        return rocsparse_status_success;
+    }
+
+    // C = beta * D, where C shares the structure of D
+    if(mul == false)
+    {
+        hipStream_t stream = handle->stream;
+
+#define CSRGEMM_DIM 1024
+        dim3 csrgemm_blocks((nnz_D - 1) / CSRGEMM_DIM + 1);
+        dim3 csrgemm_threads(CSRGEMM_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrgemm_copy_scale_device_pointer<CSRGEMM_DIM>),
+                               csrgemm_blocks,
+                               csrgemm_threads,
+                               0,
+                               stream,
+                               nnz_D,
+                               beta,
+                               csr_val_D,
+                               csr_val_C);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrgemm_copy_scale_host_pointer<CSRGEMM_DIM>),
+                               csrgemm_blocks,
+                               csrgemm_threads,
+                               0,
+                               stream,
+                               nnz_D,
+                               *beta,
+                               csr_val_D,
+                               csr_val_C);
+        }
+#undef CSRGEMM_DIM
+
+        return rocsparse_status_success;
+    }
+
+    // Accumulate the values of C, using the row grouping of the symbolic stage
+    return rocsparse_csrgemm_numeric_calc_template(handle,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   descr_A,
+                                                   csr_val_A,
+                                                   csr_row_ptr_A,
+                                                   csr_col_ind_A,
+                                                   descr_B,
+                                                   csr_val_B,
+                                                   csr_row_ptr_B,
+                                                   csr_col_ind_B,
+                                                   beta,
+                                                   descr_D,
+                                                   csr_val_D,
+                                                   csr_row_ptr_D,
+                                                   csr_col_ind_D,
+                                                   descr_C,
+                                                   csr_val_C,
+                                                   csr_row_ptr_C,
+                                                   csr_col_ind_C,
+                                                   info_C,
+                                                   mul,
+                                                   add);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                \
+    template rocsparse_status rocsparse_csrgemm_template<ITYPE, JTYPE, TTYPE>(          \
+        rocsparse_handle          handle,                                               \
+        rocsparse_operation       trans_A,                                              \
+        rocsparse_operation       trans_B,                                              \
+        JTYPE                     m,                                                    \
+        JTYPE                     n,                                                    \
+        JTYPE                     k,                                                    \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr_A,                                              \
+        ITYPE                     nnz_A,                                                \
+        const TTYPE*              csr_val_A,                                            \
+        const ITYPE*              csr_row_ptr_A,                                        \
+        const JTYPE*              csr_col_ind_A,                                        \
+        const rocsparse_mat_descr descr_B,                                              \
+        ITYPE                     nnz_B,                                                \
+        const TTYPE*              csr_val_B,                                            \
+        const ITYPE*              csr_row_ptr_B,                                        \
+        const JTYPE*              csr_col_ind_B,                                        \
+        const TTYPE*              beta,                                                 \
+        const rocsparse_mat_descr descr_D,                                              \
+        ITYPE                     nnz_D,                                                \
+        const TTYPE*              csr_val_D,                                            \
+        const ITYPE*              csr_row_ptr_D,                                        \
+        const JTYPE*              csr_col_ind_D,                                        \
+        const rocsparse_mat_descr descr_C,                                              \
+        TTYPE*                    csr_val_C,                                            \
+        const ITYPE*              csr_row_ptr_C,                                        \
+        JTYPE*                    csr_col_ind_C,                                        \
+        const rocsparse_mat_info  info_C,                                               \
+        void*                     temp_buffer);                                         \
+    template rocsparse_status rocsparse_csrgemm_symbolic_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                               \
+        rocsparse_operation       trans_A,                                              \
+        rocsparse_operation       trans_B,                                              \
+        JTYPE                     m,                                                    \
+        JTYPE                     n,                                                    \
+        JTYPE                     k,                                                    \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr_A,                                              \
+        ITYPE                     nnz_A,                                                \
+        const TTYPE*              csr_val_A,                                            \
+        const ITYPE*              csr_row_ptr_A,                                        \
+        const JTYPE*              csr_col_ind_A,                                        \
+        const rocsparse_mat_descr descr_B,                                              \
+        ITYPE                     nnz_B,                                                \
+        const TTYPE*              csr_val_B,                                            \
+        const ITYPE*              csr_row_ptr_B,                                        \
+        const JTYPE*              csr_col_ind_B,                                        \
+        const TTYPE*              beta,                                                 \
+        const rocsparse_mat_descr descr_D,                                              \
+        ITYPE                     nnz_D,                                                \
+        const TTYPE*              csr_val_D,                                            \
+        const ITYPE*              csr_row_ptr_D,                                        \
+        const JTYPE*              csr_col_ind_D,                                        \
+        const rocsparse_mat_descr descr_C,                                              \
+        TTYPE*                    csr_val_C,                                            \
+        const ITYPE*              csr_row_ptr_C,                                        \
+        JTYPE*                    csr_col_ind_C,                                        \
+        const rocsparse_mat_info  info_C,                                               \
+        void*                     temp_buffer);                                         \
+    template rocsparse_status rocsparse_csrgemm_numeric_template<ITYPE, JTYPE, TTYPE>(  \
+        rocsparse_handle          handle,                                               \
+        rocsparse_operation       trans_A,                                              \
+        rocsparse_operation       trans_B,                                              \
+        JTYPE                     m,                                                    \
+        JTYPE                     n,                                                    \
+        JTYPE                     k,                                                    \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr_A,                                              \
+        ITYPE                     nnz_A,                                                \
+        const TTYPE*              csr_val_A,                                            \
+        const ITYPE*              csr_row_ptr_A,                                        \
+        const JTYPE*              csr_col_ind_A,                                        \
+        const rocsparse_mat_descr descr_B,                                              \
+        ITYPE                     nnz_B,                                                \
+        const TTYPE*              csr_val_B,                                            \
+        const ITYPE*              csr_row_ptr_B,                                        \
+        const JTYPE*              csr_col_ind_B,                                        \
+        const TTYPE*              beta,                                                 \
+        const rocsparse_mat_descr descr_D,                                              \
+        ITYPE                     nnz_D,                                                \
+        const TTYPE*              csr_val_D,                                            \
+        const ITYPE*              csr_row_ptr_D,                                        \
+        const JTYPE*              csr_col_ind_D,                                        \
+        const rocsparse_mat_descr descr_C,                                              \
+        TTYPE*                    csr_val_C,                                            \
+        const ITYPE*              csr_row_ptr_C,                                        \
+        const JTYPE*              csr_col_ind_C,                                        \
+        const rocsparse_mat_info  info_C,                                               \
         void*                     temp_buffer);
 
 INSTANTIATE(int32_t, int32_t, float);
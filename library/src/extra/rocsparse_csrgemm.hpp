@@ -28,9 +28,24 @@
 
 #include "handle.h"
 
+#include <algorithm>
+
 #define CSRGEMM_MAXGROUPS 8
 #define CSRGEMM_NNZ_HASH 79
 #define CSRGEMM_FLL_HASH 137
+#define CSRGEMM_MAXBLOCKS_PER_CU 16
+
+// Grid of a group kernel, where each block processes rows_per_block rows at a time. The group
+// sizes are only known on the device, thus the grid is bounded by the number of compute units
+// and the kernels loop over the rows of their group
+static inline dim3 csrgemm_group_grid(rocsparse_handle handle, int64_t m, int64_t rows_per_block)
+{
+    int64_t nblocks = (m - 1) / rows_per_block + 1;
+    int64_t maxblocks
+        = static_cast<int64_t>(handle->properties.multiProcessorCount) * CSRGEMM_MAXBLOCKS_PER_CU;
+
+    return dim3(static_cast<unsigned int>(std::min(nblocks, maxblocks)));
+}
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle          handle,
@@ -112,4 +127,66 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             const rocsparse_mat_info  info_C,
                                             void*                     temp_buffer);
 
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_symbolic_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const T*                  csr_val_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const T*                  csr_val_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const T*                  beta,
+                                                     const rocsparse_mat_descr descr_D,
+                                                     I                         nnz_D,
+                                                     const T*                  csr_val_D,
+                                                     const I*                  csr_row_ptr_D,
+                                                     const J*                  csr_col_ind_D,
+                                                     const rocsparse_mat_descr descr_C,
+                                                     T*                        csr_val_C,
+                                                     const I*                  csr_row_ptr_C,
+                                                     J*                        csr_col_ind_C,
+                                                     const rocsparse_mat_info  info_C,
+                                                     void*                     temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_numeric_template(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    J                         m,
+                                                    J                         n,
+                                                    J                         k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    I                         nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const I*                  csr_row_ptr_A,
+                                                    const J*                  csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    I                         nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const I*                  csr_row_ptr_B,
+                                                    const J*                  csr_col_ind_B,
+                                                    const T*                  beta,
+                                                    const rocsparse_mat_descr descr_D,
+                                                    I                         nnz_D,
+                                                    const T*                  csr_val_D,
+                                                    const I*                  csr_row_ptr_D,
+                                                    const J*                  csr_col_ind_D,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const I*                  csr_row_ptr_C,
+                                                    const J*                  csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C,
+                                                    void*                     temp_buffer);
+
 #endif // ROCSPARSE_CSRGEMM_HPP
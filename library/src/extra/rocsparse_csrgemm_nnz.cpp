@@ -22,7 +22,6 @@
  *
  * ************************************************************************ */
 
-#include "../conversion/rocsparse_identity.hpp"
 #include "csrgemm_device.h"
 #include "definitions.h"
 #include "rocsparse_csrgemm.hpp"
@@ -157,23 +156,11 @@ static inline rocsparse_status
     size_t rocprim_size;
     size_t rocprim_max = 0;
 
-    // rocprim::reduce
-    RETURN_IF_HIP_ERROR(rocprim::reduce(
-        nullptr, rocprim_size, csr_row_ptr_A, &nnz_A, 0, m, rocprim::maximum<I>(), stream));
-    rocprim_max = std::max(rocprim_max, rocprim_size);
-
     // rocprim exclusive scan
     RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
         nullptr, rocprim_size, csr_row_ptr_A, &nnz_A, 0, m + 1, rocprim::plus<I>(), stream));
     rocprim_max = std::max(rocprim_max, rocprim_size);
 
-    // rocprim::radix_sort_pairs
-    rocprim::double_buffer<I> buf1(&nnz_A, &nnz_B);
-    rocprim::double_buffer<J> buf2(&n, &k);
-    RETURN_IF_HIP_ERROR(
-        rocprim::radix_sort_pairs(nullptr, rocprim_size, buf1, buf2, m, 0, 3, stream));
-    rocprim_max = std::max(rocprim_max, rocprim_size);
-
     *buffer_size = ((rocprim_max - 1) / 256 + 1) * 256;
 
     // Group arrays
@@ -181,10 +168,14 @@ static inline rocsparse_status
     *buffer_size += sizeof(J) * 256;
     *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-    // Permutation arrays
-    *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+    // Permutation array
     *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
-    *buffer_size += ((sizeof(I) * m - 1) / 256 + 1) * 256;
+
+    // Additional buffer for C = alpha * A * B of rows exceeding the shared memory
+    if(nnz_A > 0)
+    {
+        *buffer_size += ((sizeof(I) * nnz_A - 1) / 256 + 1) * 256;
+    }
 
     return rocsparse_status_success;
 }
@@ -273,23 +264,11 @@ static inline rocsparse_status
     size_t rocprim_size;
     size_t rocprim_max = 0;
 
-    // rocprim::reduce
-    RETURN_IF_HIP_ERROR(rocprim::reduce(
-        nullptr, rocprim_size, csr_row_ptr_A, &nnz_A, 0, m, rocprim::maximum<I>(), stream));
-    rocprim_max = std::max(rocprim_max, rocprim_size);
-
     // rocprim exclusive scan
     RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
         nullptr, rocprim_size, csr_row_ptr_A, &nnz_A, 0, m + 1, rocprim::plus<I>(), stream));
     rocprim_max = std::max(rocprim_max, rocprim_size);
 
-    // rocprim::radix_sort_pairs
-    rocprim::double_buffer<I> buf1(&nnz_A, &nnz_B);
-    rocprim::double_buffer<J> buf2(&n, &k);
-    RETURN_IF_HIP_ERROR(
-        rocprim::radix_sort_pairs(nullptr, rocprim_size, buf1, buf2, m, 0, 3, stream));
-    rocprim_max = std::max(rocprim_max, rocprim_size);
-
     *buffer_size = ((rocprim_max - 1) / 256 + 1) * 256;
 
     // Group arrays
@@ -297,10 +276,14 @@ static inline rocsparse_status
     *buffer_size += sizeof(J) * 256;
     *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-    // Permutation arrays
-    *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
+    // Permutation array
     *buffer_size += ((sizeof(J) * m - 1) / 256 + 1) * 256;
-    *buffer_size += ((sizeof(I) * m - 1) / 256 + 1) * 256;
+
+    // Additional buffer for C = alpha * A * B of rows exceeding the shared memory
+    if(nnz_A > 0)
+    {
+        *buffer_size += ((sizeof(I) * nnz_A - 1) / 256 + 1) * 256;
+    }
 
     return rocsparse_status_success;
 }
@@ -633,6 +616,17 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     rocsparse_index_base base_D
         = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
 
+    // SpGEMM algorithm, selecting the accumulator of each row group
+    rocsparse_spgemm_alg alg = info_C->csrgemm_info->alg;
+
+    // Mask of C = alpha * A * B, if any
+    const I* csr_row_ptr_M = static_cast<const I*>(info_C->csrgemm_info->mask_row_ptr);
+    const J* csr_col_ind_M = static_cast<const J*>(info_C->csrgemm_info->mask_col_ind);
+
+    // Index base of the mask and whether C is restricted to the complement of the mask
+    rocsparse_index_base base_M       = info_C->csrgemm_info->mask_base;
+    bool                 complement_M = info_C->csrgemm_info->mask_complement;
+
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
@@ -653,6 +647,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                        csr_col_ind_A,
                        csr_row_ptr_B,
                        csr_row_ptr_D,
+                       complement_M ? nullptr : csr_row_ptr_M,
                        csr_row_ptr_C,
                        base_A,
                        info_C->csrgemm_info->mul,
@@ -660,152 +655,97 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
 
-    // Determine maximum of all intermediate products
-    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<I>(),
-                                        stream));
-    rocprim_buffer = reinterpret_cast<void*>(buffer);
-    RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
-                                        rocprim_size,
-                                        csr_row_ptr_C,
-                                        csr_row_ptr_C + m,
-                                        0,
-                                        m,
-                                        rocprim::maximum<I>(),
-                                        stream));
-
-    I int_max;
-    RETURN_IF_HIP_ERROR(
-        hipMemcpyAsync(&int_max, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
     // Group offset buffer
     J* d_group_offset = reinterpret_cast<J*>(buffer);
     buffer += sizeof(J) * 256;
 
     // Group size buffer
-    J h_group_size[CSRGEMM_MAXGROUPS];
+    J* d_group_size = reinterpret_cast<J*>(buffer);
+    buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
 
-    // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
+    // Process the rows in groups of similar sized intermediate products. Group sizes and
+    // offsets remain on the device, such that no host synchronization is required.
 
-    // Permutation array
-    J* d_perm = nullptr;
-
-    // If maximum of intermediate products exceeds 32, we process the rows in groups of
-    // similar sized intermediate products
-    if(int_max > 32)
-    {
-        // Group size buffer
-        J* d_group_size = reinterpret_cast<J*>(buffer);
-        buffer += sizeof(J) * 256 * CSRGEMM_MAXGROUPS;
-
-        // Determine number of rows per group
+    // Determine number of rows per group
 #define CSRGEMM_DIM 256
-        hipLaunchKernelGGL((csrgemm_group_reduce_part1<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
-                           dim3(CSRGEMM_DIM),
-                           dim3(CSRGEMM_DIM),
-                           0,
-                           stream,
-                           m,
-                           csr_row_ptr_C,
-                           d_group_size);
+    hipLaunchKernelGGL((csrgemm_group_reduce_part1<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(CSRGEMM_DIM),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_C,
+                       d_group_size);
 
-        hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
-                           dim3(1),
-                           dim3(CSRGEMM_DIM),
-                           0,
-                           stream,
-                           d_group_size);
+    hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       d_group_size);
 #undef CSRGEMM_DIM
 
-        // Exclusive sum to obtain group offsets
-        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
-                                                    rocprim_size,
-                                                    d_group_size,
-                                                    d_group_offset,
-                                                    0,
-                                                    CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<J>(),
-                                                    stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
-                                                    rocprim_size,
-                                                    d_group_size,
-                                                    d_group_offset,
-                                                    0,
-                                                    CSRGEMM_MAXGROUPS,
-                                                    rocprim::plus<J>(),
-                                                    stream));
-
-        // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
-                                           d_group_size,
-                                           sizeof(J) * CSRGEMM_MAXGROUPS,
-                                           hipMemcpyDeviceToHost,
-                                           stream));
-
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-        // Permutation temporary arrays
-        J* tmp_vals = reinterpret_cast<J*>(buffer);
-        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
-
-        J* tmp_perm = reinterpret_cast<J*>(buffer);
-        buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
-
-        I* tmp_keys = reinterpret_cast<I*>(buffer);
-        buffer += ((sizeof(I) * m - 1) / 256 + 1) * 256;
-
-        // Create identity permutation for group access
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_create_identity_permutation_template(handle, m, tmp_perm));
-
-        rocprim::double_buffer<I> d_keys(csr_row_ptr_C, tmp_keys);
-        rocprim::double_buffer<J> d_vals(tmp_perm, tmp_vals);
-
-        // Sort pairs (by groups)
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-            rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+    // Append an empty group, such that the exclusive sum also yields the end of the last group
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(&d_group_size[CSRGEMM_MAXGROUPS], 0, sizeof(J), stream));
+
+    // Exclusive sum to obtain group offsets
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                d_group_size,
+                                                d_group_offset,
+                                                0,
+                                                CSRGEMM_MAXGROUPS + 1,
+                                                rocprim::plus<J>(),
+                                                stream));
+    rocprim_buffer = reinterpret_cast<void*>(buffer);
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                d_group_size,
+                                                d_group_offset,
+                                                0,
+                                                CSRGEMM_MAXGROUPS + 1,
+                                                rocprim::plus<J>(),
+                                                stream));
 
-        d_perm = d_vals.current();
+    // Permutation array
+    J* d_perm = reinterpret_cast<J*>(buffer);
+    buffer += ((sizeof(J) * m - 1) / 256 + 1) * 256;
 
-        // Release tmp_keys buffer
-        buffer -= ((sizeof(I) * m - 1) / 256 + 1) * 256;
-    }
-    else
-    {
-        // First group processes all rows
-        h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
-    }
+    // Sort rows by groups. The group sizes are reused as counters, such that each row is
+    // scattered into its group
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_size, 0, sizeof(J) * CSRGEMM_MAXGROUPS, stream));
+
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_group_permutation<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3((m - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_C,
+                       d_group_offset,
+                       d_group_size,
+                       d_perm);
+#undef CSRGEMM_DIM
 
-    // Compute non-zero entries per row for each group
+    // Additional buffer for C = alpha * A * B of rows exceeding the shared memory
+    I* workspace_B
+        = (info_C->csrgemm_info->mul == true) ? reinterpret_cast<I*>(buffer) : nullptr;
+
+    // Compute non-zero entries per row for each group, where each kernel is launched with a
+    // bounded grid and loops over the rows of its group
 
     // Group 0: 0 - 32 intermediate products
-    if(h_group_size[0] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 4
 #define CSRGEMM_HASHSIZE 32
         hipLaunchKernelGGL(
             (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+            csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
             dim3(CSRGEMM_DIM),
             0,
             stream,
-            h_group_size[0],
             &d_group_offset[0],
             d_perm,
             csr_row_ptr_A,
@@ -819,25 +759,27 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
             base_B,
             base_D,
             info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+            info_C->csrgemm_info->add,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            base_M,
+            complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 1: 33 - 64 intermediate products
-    if(h_group_size[1] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 8
 #define CSRGEMM_HASHSIZE 64
         hipLaunchKernelGGL(
             (csrgemm_nnz_wf_per_row<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_HASHSIZE, CSRGEMM_NNZ_HASH>),
-            dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+            csrgemm_group_grid(handle, m, CSRGEMM_DIM / CSRGEMM_SUB),
             dim3(CSRGEMM_DIM),
             0,
             stream,
-            h_group_size[1],
             &d_group_offset[1],
             d_perm,
             csr_row_ptr_A,
@@ -851,14 +793,17 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
             base_B,
             base_D,
             info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+            info_C->csrgemm_info->add,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            base_M,
+            complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 2: 65 - 512 intermediate products
-    if(h_group_size[2] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 8
@@ -867,7 +812,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[2]),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
@@ -884,14 +829,19 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE)
+                               == csrgemm_accumulator_dense,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 3: 513 - 1024 intermediate products
-    if(h_group_size[3] > 0)
     {
 #define CSRGEMM_DIM 128
 #define CSRGEMM_SUB 8
@@ -900,7 +850,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[3]),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
@@ -917,14 +867,19 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE)
+                               == csrgemm_accumulator_dense,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 4: 1025 - 2048 intermediate products
-    if(h_group_size[4] > 0)
     {
 #define CSRGEMM_DIM 256
 #define CSRGEMM_SUB 16
@@ -933,7 +888,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[4]),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
@@ -950,14 +905,19 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE)
+                               == csrgemm_accumulator_dense,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 5: 2049 - 4096 intermediate products
-    if(h_group_size[5] > 0)
     {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
@@ -966,7 +926,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[5]),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
@@ -983,14 +943,19 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE)
+                               == csrgemm_accumulator_dense,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 6: 4097 - 8192 intermediate products
-    if(h_group_size[6] > 0)
     {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 32
@@ -999,7 +964,7 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                       CSRGEMM_SUB,
                                                       CSRGEMM_HASHSIZE,
                                                       CSRGEMM_NNZ_HASH>),
-                           dim3(h_group_size[6]),
+                           csrgemm_group_grid(handle, m, 1),
                            dim3(CSRGEMM_DIM),
                            0,
                            stream,
@@ -1016,29 +981,64 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csrgemm_select_accumulator(alg, n, CSRGEMM_HASHSIZE)
+                               == csrgemm_accumulator_dense,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
     }
 
     // Group 7: more than 8192 intermediate products
-    if(h_group_size[7] > 0)
+    if(csrgemm_select_accumulator(alg, n, 8192) == csrgemm_accumulator_dense)
+    {
+        // All columns of C fit into shared memory, such that a single pass suffices
+#define CSRGEMM_DIM 1024
+#define CSRGEMM_SUB 32
+#define CSRGEMM_HASHSIZE 8192
+        hipLaunchKernelGGL((csrgemm_nnz_block_per_row<CSRGEMM_DIM,
+                                                      CSRGEMM_SUB,
+                                                      CSRGEMM_HASHSIZE,
+                                                      CSRGEMM_NNZ_HASH>),
+                           csrgemm_group_grid(handle, m, 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           &d_group_offset[7],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_row_ptr_C,
+                           base_A,
+                           base_B,
+                           base_D,
+                           info_C->csrgemm_info->mul,
+                           info_C->csrgemm_info->add,
+                           true,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+    else
     {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
 #define CSRGEMM_CHUNKSIZE 2048
-        I* workspace_B = nullptr;
-
-        if(info_C->csrgemm_info->mul == true)
-        {
-            // Allocate additional buffer for C = alpha * A * B
-            RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
-        }
-
         hipLaunchKernelGGL(
             (csrgemm_nnz_block_per_row_multipass<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
-            dim3(h_group_size[7]),
+            csrgemm_group_grid(handle, m, 1),
             dim3(CSRGEMM_DIM),
             0,
             stream,
@@ -1057,12 +1057,11 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
             base_B,
             base_D,
             info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
-
-        if(info_C->csrgemm_info->mul == true)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(workspace_B));
-        }
+            info_C->csrgemm_info->add,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            base_M,
+            complement_M);
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
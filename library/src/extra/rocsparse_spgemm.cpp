@@ -94,28 +94,33 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
         // CSR format
         if(A->format == rocsparse_format_csr)
         {
-            return rocsparse_csrgemm_buffer_size_template(handle,
-                                                          trans_A,
-                                                          trans_B,
-                                                          (J)A->rows,
-                                                          (J)B->cols,
-                                                          (J)A->cols,
-                                                          (const T*)alpha,
-                                                          A->descr,
-                                                          (I)A->nnz,
-                                                          (const I*)A->row_data,
-                                                          (const J*)A->col_data,
-                                                          B->descr,
-                                                          (I)B->nnz,
-                                                          (const I*)B->row_data,
-                                                          (const J*)B->col_data,
-                                                          (const T*)beta,
-                                                          D->descr,
-                                                          (I)D->nnz,
-                                                          (const I*)D->row_data,
-                                                          (const J*)D->col_data,
-                                                          C->info,
-                                                          buffer_size);
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size_template(handle,
+                                                                             trans_A,
+                                                                             trans_B,
+                                                                             (J)A->rows,
+                                                                             (J)B->cols,
+                                                                             (J)A->cols,
+                                                                             (const T*)alpha,
+                                                                             A->descr,
+                                                                             (I)A->nnz,
+                                                                             (const I*)A->row_data,
+                                                                             (const J*)A->col_data,
+                                                                             B->descr,
+                                                                             (I)B->nnz,
+                                                                             (const I*)B->row_data,
+                                                                             (const J*)B->col_data,
+                                                                             (const T*)beta,
+                                                                             D->descr,
+                                                                             (I)D->nnz,
+                                                                             (const I*)D->row_data,
+                                                                             (const J*)D->col_data,
+                                                                             C->info,
+                                                                             buffer_size));
+
+            // Keep the algorithm for the subsequent stages
+            C->info->csrgemm_info->alg = alg;
+
+            return rocsparse_status_success;
         }
 
         return rocsparse_status_not_implemented;
@@ -207,6 +212,82 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
         }
     }
 
+    // STAGE 4 - perform SpGEMM computation and keep the structure of C
+    if(stage == rocsparse_spgemm_stage_symbolic)
+    {
+        // CSR format
+        if(A->format == rocsparse_format_csr)
+        {
+            return rocsparse_csrgemm_symbolic_template(handle,
+                                                       trans_A,
+                                                       trans_B,
+                                                       (J)A->rows,
+                                                       (J)B->cols,
+                                                       (J)A->cols,
+                                                       (const T*)alpha,
+                                                       A->descr,
+                                                       (I)A->nnz,
+                                                       (const T*)A->val_data,
+                                                       (const I*)A->row_data,
+                                                       (const J*)A->col_data,
+                                                       B->descr,
+                                                       (I)B->nnz,
+                                                       (const T*)B->val_data,
+                                                       (const I*)B->row_data,
+                                                       (const J*)B->col_data,
+                                                       (const T*)beta,
+                                                       D->descr,
+                                                       (I)D->nnz,
+                                                       (const T*)D->val_data,
+                                                       (const I*)D->row_data,
+                                                       (const J*)D->col_data,
+                                                       C->descr,
+                                                       (T*)C->val_data,
+                                                       (const I*)C->row_data,
+                                                       (J*)C->col_data,
+                                                       C->info,
+                                                       temp_buffer);
+        }
+    }
+
+    // STAGE 5 - re-compute the values of C, using the structure of C from stage 4
+    if(stage == rocsparse_spgemm_stage_numeric)
+    {
+        // CSR format
+        if(A->format == rocsparse_format_csr)
+        {
+            return rocsparse_csrgemm_numeric_template(handle,
+                                                      trans_A,
+                                                      trans_B,
+                                                      (J)A->rows,
+                                                      (J)B->cols,
+                                                      (J)A->cols,
+                                                      (const T*)alpha,
+                                                      A->descr,
+                                                      (I)A->nnz,
+                                                      (const T*)A->val_data,
+                                                      (const I*)A->row_data,
+                                                      (const J*)A->col_data,
+                                                      B->descr,
+                                                      (I)B->nnz,
+                                                      (const T*)B->val_data,
+                                                      (const I*)B->row_data,
+                                                      (const J*)B->col_data,
+                                                      (const T*)beta,
+                                                      D->descr,
+                                                      (I)D->nnz,
+                                                      (const T*)D->val_data,
+                                                      (const I*)D->row_data,
+                                                      (const J*)D->col_data,
+                                                      C->descr,
+                                                      (T*)C->val_data,
+                                                      (const I*)C->row_data,
+                                                      (const J*)C->col_data,
+                                                      C->info,
+                                                      temp_buffer);
+        }
+    }
+
     return rocsparse_status_not_implemented;
 }
 
@@ -263,6 +344,12 @@ extern "C" rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Check for valid algorithm
+    if(rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check for valid buffer_size pointer only if temp_buffer is nullptr
     if(temp_buffer == nullptr)
     {
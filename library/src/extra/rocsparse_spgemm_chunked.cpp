@@ -0,0 +1,1041 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrgemm_device.h"
+#include "rocsparse_csrgemm.hpp"
+
+#include <vector>
+
+#define RETURN_SPGEMM_CHUNKED(itype, jtype, ctype, ...)                                           \
+    {                                                                                             \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f32_r)                                                  \
+            return rocsparse_spgemm_chunked_template<int32_t, int32_t, float>(__VA_ARGS__);       \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f64_r)                                                  \
+            return rocsparse_spgemm_chunked_template<int32_t, int32_t, double>(__VA_ARGS__);      \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f32_c)                                                  \
+            return rocsparse_spgemm_chunked_template<int32_t, int32_t, rocsparse_float_complex>(  \
+                __VA_ARGS__);                                                                     \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f64_c)                                                  \
+            return rocsparse_spgemm_chunked_template<int32_t, int32_t, rocsparse_double_complex>( \
+                __VA_ARGS__);                                                                     \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f32_r)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int32_t, float>(__VA_ARGS__);       \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f64_r)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int32_t, double>(__VA_ARGS__);      \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f32_c)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int32_t, rocsparse_float_complex>(  \
+                __VA_ARGS__);                                                                     \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                   \
+           && ctype == rocsparse_datatype_f64_c)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int32_t, rocsparse_double_complex>( \
+                __VA_ARGS__);                                                                     \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                   \
+           && ctype == rocsparse_datatype_f32_r)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int64_t, float>(__VA_ARGS__);       \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                   \
+           && ctype == rocsparse_datatype_f64_r)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int64_t, double>(__VA_ARGS__);      \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                   \
+           && ctype == rocsparse_datatype_f32_c)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int64_t, rocsparse_float_complex>(  \
+                __VA_ARGS__);                                                                     \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                   \
+           && ctype == rocsparse_datatype_f64_c)                                                  \
+            return rocsparse_spgemm_chunked_template<int64_t, int64_t, rocsparse_double_complex>( \
+                __VA_ARGS__);                                                                     \
+    }
+
+// Rows begin to end of A and D, where the row offsets of both matrices are rebased,
+// such that each chunk is a CSR matrix on its own
+template <typename I, typename J, typename T>
+struct rocsparse_spgemm_chunk
+{
+    J row_begin;
+    J row_end;
+
+    I        nnz_A;
+    I        shift_A;
+    I*       csr_row_ptr_A;
+    const J* csr_col_ind_A;
+    const T* csr_val_A;
+
+    I        nnz_D;
+    I        shift_D;
+    I*       csr_row_ptr_D;
+    const J* csr_col_ind_D;
+    const T* csr_val_D;
+
+    // Workspace size of the chunk and its csrgemm temporary storage buffer
+    size_t buffer_size;
+    void*  temp_buffer;
+};
+
+// Size of the row offsets, column indices and values of a chunk of C
+template <typename I, typename J, typename T>
+static inline size_t rocsparse_spgemm_chunked_slot_size(int64_t rows, int64_t nnz, bool values)
+{
+    size_t size = ((sizeof(I) * (rows + 1) - 1) / 256 + 1) * 256;
+
+    if(values == true && nnz > 0)
+    {
+        size += ((sizeof(J) * nnz - 1) / 256 + 1) * 256;
+        size += ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+    }
+
+    return size;
+}
+
+// Set up the chunk of rows begin to end in the workspace and query its csrgemm buffer size
+template <typename I, typename J, typename T>
+static rocsparse_status rocsparse_spgemm_chunked_setup(rocsparse_handle                 handle,
+                                                       rocsparse_operation              trans_A,
+                                                       rocsparse_operation              trans_B,
+                                                       const void*                      alpha,
+                                                       const rocsparse_spmat_descr      A,
+                                                       const rocsparse_spmat_descr      B,
+                                                       const void*                      beta,
+                                                       const rocsparse_spmat_descr      D,
+                                                       rocsparse_spmat_descr            C,
+                                                       const std::vector<I>&            row_ptr_A,
+                                                       const std::vector<I>&            row_ptr_D,
+                                                       J                                row_begin,
+                                                       J                                row_end,
+                                                       void*                            workspace,
+                                                       rocsparse_spgemm_chunk<I, J, T>* chunk)
+{
+    bool mul = (alpha != nullptr);
+    bool add = (beta != nullptr);
+
+    char* buffer = reinterpret_cast<char*>(workspace);
+
+    chunk->row_begin = row_begin;
+    chunk->row_end   = row_end;
+
+    // Chunk of A
+    chunk->nnz_A         = 0;
+    chunk->shift_A       = 0;
+    chunk->csr_row_ptr_A = (I*)A->row_data;
+    chunk->csr_col_ind_A = (const J*)A->col_data;
+    chunk->csr_val_A     = (const T*)A->val_data;
+
+    if(mul == true)
+    {
+        I offset = row_ptr_A[row_begin] - A->descr->base;
+
+        chunk->nnz_A         = row_ptr_A[row_end] - row_ptr_A[row_begin];
+        chunk->shift_A       = -offset;
+        chunk->csr_row_ptr_A = reinterpret_cast<I*>(buffer);
+        chunk->csr_col_ind_A = (const J*)A->col_data + offset;
+        chunk->csr_val_A     = (const T*)A->val_data + offset;
+
+        buffer += ((sizeof(I) * (row_end - row_begin + 1) - 1) / 256 + 1) * 256;
+    }
+
+    // Chunk of D
+    chunk->nnz_D         = 0;
+    chunk->shift_D       = 0;
+    chunk->csr_row_ptr_D = (I*)D->row_data;
+    chunk->csr_col_ind_D = (const J*)D->col_data;
+    chunk->csr_val_D     = (const T*)D->val_data;
+
+    if(add == true)
+    {
+        I offset = row_ptr_D[row_begin] - D->descr->base;
+
+        chunk->nnz_D         = row_ptr_D[row_end] - row_ptr_D[row_begin];
+        chunk->shift_D       = -offset;
+        chunk->csr_row_ptr_D = reinterpret_cast<I*>(buffer);
+        chunk->csr_col_ind_D = (const J*)D->col_data + offset;
+        chunk->csr_val_D     = (const T*)D->val_data + offset;
+
+        buffer += ((sizeof(I) * (row_end - row_begin + 1) - 1) / 256 + 1) * 256;
+    }
+
+    // csrgemm temporary storage buffer
+    chunk->temp_buffer = reinterpret_cast<void*>(buffer);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size_template(handle,
+                                                                     trans_A,
+                                                                     trans_B,
+                                                                     row_end - row_begin,
+                                                                     (J)B->cols,
+                                                                     (J)A->cols,
+                                                                     (const T*)alpha,
+                                                                     A->descr,
+                                                                     chunk->nnz_A,
+                                                                     chunk->csr_row_ptr_A,
+                                                                     chunk->csr_col_ind_A,
+                                                                     B->descr,
+                                                                     (I)B->nnz,
+                                                                     (const I*)B->row_data,
+                                                                     (const J*)B->col_data,
+                                                                     (const T*)beta,
+                                                                     D->descr,
+                                                                     chunk->nnz_D,
+                                                                     chunk->csr_row_ptr_D,
+                                                                     chunk->csr_col_ind_D,
+                                                                     C->info,
+                                                                     &chunk->buffer_size));
+
+    chunk->buffer_size += (buffer - reinterpret_cast<char*>(workspace));
+
+    return rocsparse_status_success;
+}
+
+// Partition the rows of C into chunks that fit into the workspace and an output slot
+template <typename I, typename J, typename T>
+static rocsparse_status rocsparse_spgemm_chunked_plan(rocsparse_handle            handle,
+                                                      rocsparse_operation         trans_A,
+                                                      rocsparse_operation         trans_B,
+                                                      const void*                 alpha,
+                                                      const rocsparse_spmat_descr A,
+                                                      const rocsparse_spmat_descr B,
+                                                      const void*                 beta,
+                                                      const rocsparse_spmat_descr D,
+                                                      rocsparse_spmat_descr       C,
+                                                      const std::vector<I>&       row_ptr_A,
+                                                      const std::vector<I>&       row_ptr_D,
+                                                      const std::vector<int64_t>& row_ptr_bound,
+                                                      bool                        values,
+                                                      size_t                      work_size,
+                                                      size_t                      slot_size,
+                                                      void*                       workspace,
+                                                      std::vector<J>&             chunk_ptr,
+                                                      size_t*                     max_slot_size)
+{
+    J m = (J)A->rows;
+
+    chunk_ptr.clear();
+    chunk_ptr.push_back(0);
+
+    *max_slot_size = 0;
+
+    J row_begin = 0;
+
+    while(row_begin < m)
+    {
+        // Extend the chunk as long as the upper bound of its non-zero entries fits into a slot
+        J row_end = row_begin;
+
+        while(row_end < m
+              && rocsparse_spgemm_chunked_slot_size<I, J, T>(
+                     row_end + 1 - row_begin,
+                     row_ptr_bound[row_end + 1] - row_ptr_bound[row_begin],
+                     values)
+                     <= slot_size)
+        {
+            ++row_end;
+        }
+
+        // A single row does not fit into a slot
+        if(row_end == row_begin)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        // Shrink the chunk until its csrgemm temporary storage fits into the workspace
+        while(true)
+        {
+            rocsparse_spgemm_chunk<I, J, T> chunk;
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_spgemm_chunked_setup<I, J, T>(handle,
+                                                                               trans_A,
+                                                                               trans_B,
+                                                                               alpha,
+                                                                               A,
+                                                                               B,
+                                                                               beta,
+                                                                               D,
+                                                                               C,
+                                                                               row_ptr_A,
+                                                                               row_ptr_D,
+                                                                               row_begin,
+                                                                               row_end,
+                                                                               workspace,
+                                                                               &chunk)));
+
+            if(chunk.buffer_size <= work_size)
+            {
+                break;
+            }
+
+            if(row_end - row_begin == 1)
+            {
+                return rocsparse_status_invalid_size;
+            }
+
+            row_end = row_begin + (row_end - row_begin) / 2;
+        }
+
+        *max_slot_size = std::max(*max_slot_size,
+                                  rocsparse_spgemm_chunked_slot_size<I, J, T>(
+                                      row_end - row_begin,
+                                      row_ptr_bound[row_end] - row_ptr_bound[row_begin],
+                                      values));
+
+        chunk_ptr.push_back(row_end);
+
+        row_begin = row_end;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Keep the first error of a sequence of releases
+static inline void rocsparse_spgemm_chunked_keep(rocsparse_status& status, hipError_t hip_status)
+{
+    if(status == rocsparse_status_success && hip_status != hipSuccess)
+    {
+        status = get_rocsparse_status_for_hip_status(hip_status);
+    }
+}
+
+// Compute the chunks of C and transfer them to the host, where the transfer of a chunk
+// on copy_stream overlaps with the computation of the next chunk on the handle stream
+template <typename I, typename J, typename T>
+static rocsparse_status
+    rocsparse_spgemm_chunked_process(rocsparse_handle                handle,
+                                     rocsparse_operation             trans_A,
+                                     rocsparse_operation             trans_B,
+                                     const void*                     alpha,
+                                     const rocsparse_spmat_descr     A,
+                                     const rocsparse_spmat_descr     B,
+                                     const void*                     beta,
+                                     const rocsparse_spmat_descr     D,
+                                     rocsparse_spmat_descr           C,
+                                     rocsparse_spgemm_alg            alg,
+                                     rocsparse_spgemm_chunk_callback callback,
+                                     void*                           user_data,
+                                     void*                           host_row_ptr_C,
+                                     void*                           host_col_ind_C,
+                                     void*                           host_val_C,
+                                     const std::vector<I>&           row_ptr_A,
+                                     const std::vector<I>&           row_ptr_D,
+                                     const std::vector<int64_t>&     row_ptr_bound,
+                                     const std::vector<J>&           chunk_ptr,
+                                     bool                            values,
+                                     void*                           workspace,
+                                     char*                           slots[2],
+                                     char*                           staging[2],
+                                     hipStream_t                     copy_stream,
+                                     hipEvent_t                      computed[2],
+                                     hipEvent_t                      copied[2])
+{
+    hipStream_t stream = handle->stream;
+
+    bool mul = (alpha != nullptr);
+    bool add = (beta != nullptr);
+
+    // Offset of the current chunk into the column indices and values of C
+    I nnz_offset = 0;
+
+    // Previous chunk, which is handed to the callback once it has been transferred
+    J      prev_row_begin  = 0;
+    J      prev_row_end    = 0;
+    I      prev_nnz        = 0;
+    size_t prev_col_offset = 0;
+    size_t prev_val_offset = 0;
+
+    for(size_t c = 0; c + 1 < chunk_ptr.size(); ++c)
+    {
+        int slot = c & 1;
+
+        rocsparse_spgemm_chunk<I, J, T> chunk;
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_spgemm_chunked_setup<I, J, T>(handle,
+                                                                           trans_A,
+                                                                           trans_B,
+                                                                           alpha,
+                                                                           A,
+                                                                           B,
+                                                                           beta,
+                                                                           D,
+                                                                           C,
+                                                                           row_ptr_A,
+                                                                           row_ptr_D,
+                                                                           chunk_ptr[c],
+                                                                           chunk_ptr[c + 1],
+                                                                           workspace,
+                                                                           &chunk)));
+
+        // The csrgemm info of C is recreated for each chunk
+        C->info->csrgemm_info->alg = alg;
+
+        J rows = chunk.row_end - chunk.row_begin;
+
+        // Rebase the row offsets of the chunk of A and D
+#define SPGEMM_CHUNKED_DIM 256
+        if(mul == true)
+        {
+            hipLaunchKernelGGL((csrgemm_shift_row_ptr<SPGEMM_CHUNKED_DIM>),
+                               dim3(rows / SPGEMM_CHUNKED_DIM + 1),
+                               dim3(SPGEMM_CHUNKED_DIM),
+                               0,
+                               stream,
+                               rows + 1,
+                               chunk.shift_A,
+                               (const I*)A->row_data + chunk.row_begin,
+                               chunk.csr_row_ptr_A);
+        }
+
+        if(add == true)
+        {
+            hipLaunchKernelGGL((csrgemm_shift_row_ptr<SPGEMM_CHUNKED_DIM>),
+                               dim3(rows / SPGEMM_CHUNKED_DIM + 1),
+                               dim3(SPGEMM_CHUNKED_DIM),
+                               0,
+                               stream,
+                               rows + 1,
+                               chunk.shift_D,
+                               (const I*)D->row_data + chunk.row_begin,
+                               chunk.csr_row_ptr_D);
+        }
+
+        // Slot of the chunk of C
+        int64_t bound = row_ptr_bound[chunk.row_end] - row_ptr_bound[chunk.row_begin];
+
+        size_t col_offset = ((sizeof(I) * (rows + 1) - 1) / 256 + 1) * 256;
+        size_t val_offset
+            = col_offset + ((bound > 0) ? ((sizeof(J) * bound - 1) / 256 + 1) * 256 : 0);
+
+        I* csr_row_ptr_C = reinterpret_cast<I*>(slots[slot]);
+        J* csr_col_ind_C = reinterpret_cast<J*>(slots[slot] + col_offset);
+        T* csr_val_C     = reinterpret_cast<T*>(slots[slot] + val_offset);
+
+        // The slot must have been transferred before it is overwritten
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, copied[slot], 0));
+
+        // Number of non-zero entries of the chunk, which is required on the host to
+        // transfer the chunk
+        I nnz_C;
+
+        rocsparse_pointer_mode ptr_mode;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(handle, &ptr_mode));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_status status = rocsparse_csrgemm_nnz_template(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 rows,
+                                                                 (J)B->cols,
+                                                                 (J)A->cols,
+                                                                 A->descr,
+                                                                 chunk.nnz_A,
+                                                                 chunk.csr_row_ptr_A,
+                                                                 chunk.csr_col_ind_A,
+                                                                 B->descr,
+                                                                 (I)B->nnz,
+                                                                 (const I*)B->row_data,
+                                                                 (const J*)B->col_data,
+                                                                 D->descr,
+                                                                 chunk.nnz_D,
+                                                                 chunk.csr_row_ptr_D,
+                                                                 chunk.csr_col_ind_D,
+                                                                 C->descr,
+                                                                 csr_row_ptr_C,
+                                                                 &nnz_C,
+                                                                 C->info,
+                                                                 chunk.temp_buffer);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, ptr_mode));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        if(values == true)
+        {
+            // Column indices and values of C must fit into the user arrays
+            if(callback == nullptr && nnz_offset + nnz_C > C->nnz)
+            {
+                return rocsparse_status_invalid_size;
+            }
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_template(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 rows,
+                                                                 (J)B->cols,
+                                                                 (J)A->cols,
+                                                                 (const T*)alpha,
+                                                                 A->descr,
+                                                                 chunk.nnz_A,
+                                                                 chunk.csr_val_A,
+                                                                 chunk.csr_row_ptr_A,
+                                                                 chunk.csr_col_ind_A,
+                                                                 B->descr,
+                                                                 (I)B->nnz,
+                                                                 (const T*)B->val_data,
+                                                                 (const I*)B->row_data,
+                                                                 (const J*)B->col_data,
+                                                                 (const T*)beta,
+                                                                 D->descr,
+                                                                 chunk.nnz_D,
+                                                                 chunk.csr_val_D,
+                                                                 chunk.csr_row_ptr_D,
+                                                                 chunk.csr_col_ind_D,
+                                                                 C->descr,
+                                                                 csr_val_C,
+                                                                 csr_row_ptr_C,
+                                                                 csr_col_ind_C,
+                                                                 C->info,
+                                                                 chunk.temp_buffer));
+        }
+
+        // Place the chunk within the row offsets of C
+        if(callback == nullptr && nnz_offset > 0)
+        {
+            hipLaunchKernelGGL((csrgemm_shift_row_ptr<SPGEMM_CHUNKED_DIM>),
+                               dim3(rows / SPGEMM_CHUNKED_DIM + 1),
+                               dim3(SPGEMM_CHUNKED_DIM),
+                               0,
+                               stream,
+                               rows + 1,
+                               nnz_offset,
+                               csr_row_ptr_C,
+                               csr_row_ptr_C);
+        }
+#undef SPGEMM_CHUNKED_DIM
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(computed[slot], stream));
+
+        // Transfer the chunk on the copy stream
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(copy_stream, computed[slot], 0));
+
+        char* dst_row_ptr = staging[slot];
+        char* dst_col_ind = staging[slot] + col_offset;
+        char* dst_val     = staging[slot] + val_offset;
+
+        if(callback == nullptr)
+        {
+            dst_row_ptr = reinterpret_cast<char*>((I*)host_row_ptr_C + chunk.row_begin);
+            dst_col_ind = reinterpret_cast<char*>((J*)host_col_ind_C + nnz_offset);
+            dst_val     = reinterpret_cast<char*>((T*)host_val_C + nnz_offset);
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(dst_row_ptr,
+                                           csr_row_ptr_C,
+                                           sizeof(I) * (rows + 1),
+                                           hipMemcpyDeviceToHost,
+                                           copy_stream));
+
+        if(values == true && nnz_C > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                dst_col_ind, csr_col_ind_C, sizeof(J) * nnz_C, hipMemcpyDeviceToHost, copy_stream));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                dst_val, csr_val_C, sizeof(T) * nnz_C, hipMemcpyDeviceToHost, copy_stream));
+        }
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(copied[slot], copy_stream));
+
+        // Hand the previous chunk to the user, while the current chunk is processed
+        if(callback != nullptr && c > 0)
+        {
+            int prev_slot = slot ^ 1;
+
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(copied[prev_slot]));
+            RETURN_IF_ROCSPARSE_ERROR(callback(prev_row_begin,
+                                               prev_row_end,
+                                               prev_nnz,
+                                               staging[prev_slot],
+                                               staging[prev_slot] + prev_col_offset,
+                                               staging[prev_slot] + prev_val_offset,
+                                               user_data));
+        }
+
+        prev_row_begin  = chunk.row_begin;
+        prev_row_end    = chunk.row_end;
+        prev_nnz        = nnz_C;
+        prev_col_offset = col_offset;
+        prev_val_offset = val_offset;
+
+        nnz_offset += nnz_C;
+    }
+
+    // Wait for the last transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(copy_stream));
+
+    // Hand the last chunk to the user
+    if(callback != nullptr && chunk_ptr.size() > 1)
+    {
+        int prev_slot = (chunk_ptr.size() - 2) & 1;
+
+        RETURN_IF_ROCSPARSE_ERROR(callback(prev_row_begin,
+                                           prev_row_end,
+                                           prev_nnz,
+                                           staging[prev_slot],
+                                           staging[prev_slot] + prev_col_offset,
+                                           staging[prev_slot] + prev_val_offset,
+                                           user_data));
+    }
+
+    // Number of non-zero entries of C
+    if(callback == nullptr && values == false)
+    {
+        C->nnz = nnz_offset;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Process the chunks on a copy stream with two pairs of slot events. The stream and the
+// events are released in reverse order of their creation on every path, returning the
+// first error that occurred.
+template <typename I, typename J, typename T>
+static rocsparse_status
+    rocsparse_spgemm_chunked_run(rocsparse_handle                handle,
+                                 rocsparse_operation             trans_A,
+                                 rocsparse_operation             trans_B,
+                                 const void*                     alpha,
+                                 const rocsparse_spmat_descr     A,
+                                 const rocsparse_spmat_descr     B,
+                                 const void*                     beta,
+                                 const rocsparse_spmat_descr     D,
+                                 rocsparse_spmat_descr           C,
+                                 rocsparse_spgemm_alg            alg,
+                                 rocsparse_spgemm_chunk_callback callback,
+                                 void*                           user_data,
+                                 void*                           host_row_ptr_C,
+                                 void*                           host_col_ind_C,
+                                 void*                           host_val_C,
+                                 const std::vector<I>&           row_ptr_A,
+                                 const std::vector<I>&           row_ptr_D,
+                                 const std::vector<int64_t>&     row_ptr_bound,
+                                 const std::vector<J>&           chunk_ptr,
+                                 bool                            values,
+                                 void*                           workspace,
+                                 char*                           slots[2],
+                                 char*                           staging[2])
+{
+    // The copy stream must not wait for the blocking host transfers of csrgemm_nnz
+    hipStream_t copy_stream;
+    RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking));
+
+    hipEvent_t computed[2] = {nullptr, nullptr};
+    hipEvent_t copied[2]   = {nullptr, nullptr};
+
+    rocsparse_status status = rocsparse_status_success;
+
+    for(int i = 0; i < 2 && status == rocsparse_status_success; ++i)
+    {
+        rocsparse_spgemm_chunked_keep(
+            status, hipEventCreateWithFlags(&computed[i], hipEventDisableTiming));
+
+        if(status == rocsparse_status_success)
+        {
+            rocsparse_spgemm_chunked_keep(
+                status, hipEventCreateWithFlags(&copied[i], hipEventDisableTiming));
+        }
+
+        // Both slots are initially free
+        if(status == rocsparse_status_success)
+        {
+            rocsparse_spgemm_chunked_keep(status, hipEventRecord(copied[i], copy_stream));
+        }
+    }
+
+    if(status == rocsparse_status_success)
+    {
+        status = rocsparse_spgemm_chunked_process<I, J, T>(handle,
+                                                            trans_A,
+                                                            trans_B,
+                                                            alpha,
+                                                            A,
+                                                            B,
+                                                            beta,
+                                                            D,
+                                                            C,
+                                                            alg,
+                                                            callback,
+                                                            user_data,
+                                                            host_row_ptr_C,
+                                                            host_col_ind_C,
+                                                            host_val_C,
+                                                            row_ptr_A,
+                                                            row_ptr_D,
+                                                            row_ptr_bound,
+                                                            chunk_ptr,
+                                                            values,
+                                                            workspace,
+                                                            slots,
+                                                            staging,
+                                                            copy_stream,
+                                                            computed,
+                                                            copied);
+    }
+
+    // Release resources, also if the computation has been aborted. Pending transfers
+    // into the slots and the staging buffers have to finish first.
+    rocsparse_spgemm_chunked_keep(status, hipStreamSynchronize(copy_stream));
+
+    for(int i = 1; i >= 0; --i)
+    {
+        if(copied[i] != nullptr)
+        {
+            rocsparse_spgemm_chunked_keep(status, hipEventDestroy(copied[i]));
+        }
+
+        if(computed[i] != nullptr)
+        {
+            rocsparse_spgemm_chunked_keep(status, hipEventDestroy(computed[i]));
+        }
+    }
+
+    rocsparse_spgemm_chunked_keep(status, hipStreamDestroy(copy_stream));
+
+    return status;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_spgemm_chunked_template(rocsparse_handle                handle,
+                                                   rocsparse_operation             trans_A,
+                                                   rocsparse_operation             trans_B,
+                                                   const void*                     alpha,
+                                                   const rocsparse_spmat_descr     A,
+                                                   const rocsparse_spmat_descr     B,
+                                                   const void*                     beta,
+                                                   const rocsparse_spmat_descr     D,
+                                                   rocsparse_spmat_descr           C,
+                                                   rocsparse_spgemm_alg            alg,
+                                                   void*                           host_row_ptr_C,
+                                                   void*                           host_col_ind_C,
+                                                   void*                           host_val_C,
+                                                   rocsparse_spgemm_chunk_callback callback,
+                                                   void*                           user_data,
+                                                   size_t                          buffer_size,
+                                                   void*                           temp_buffer)
+{
+    // Currently, only CSR format is supported
+    if(A->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    J m = (J)A->rows;
+    J n = (J)B->cols;
+
+    bool mul = (alpha != nullptr);
+    bool add = (beta != nullptr);
+
+    // Without callback, column indices and values are computed once the user has
+    // allocated them, otherwise only the row offsets of C are computed
+    bool values = (callback != nullptr || C->nnz > 0);
+
+    // Quick return
+    if(m == 0)
+    {
+        if(callback == nullptr && values == false)
+        {
+            *(I*)host_row_ptr_C = C->descr->base;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Row offsets of A and D on the host, to determine the chunks
+    std::vector<I> row_ptr_A(mul ? m + 1 : 0);
+    std::vector<I> row_ptr_D(add ? m + 1 : 0);
+
+    if(mul == true)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_ptr_A.data(),
+                                           A->row_data,
+                                           sizeof(I) * (m + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    }
+
+    if(add == true)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_ptr_D.data(),
+                                           D->row_data,
+                                           sizeof(I) * (m + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    }
+
+    // Number of intermediate products of each row, computed in pieces of rows that fit
+    // into the temporary storage buffer
+    J piece = (J)std::min(buffer_size / sizeof(I), (size_t)m);
+
+    if(piece == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    std::vector<I> int_prod(m);
+
+    for(J row_begin = 0; row_begin < m; row_begin += piece)
+    {
+        J rows = std::min(piece, m - row_begin);
+
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+        hipLaunchKernelGGL((csrgemm_intermediate_products<CSRGEMM_DIM, CSRGEMM_SUB>),
+                           dim3((rows - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           rows,
+                           mul ? (const I*)A->row_data + row_begin : nullptr,
+                           (const J*)A->col_data,
+                           (const I*)B->row_data,
+                           add ? (const I*)D->row_data + row_begin : nullptr,
+                           nullptr,
+                           (I*)temp_buffer,
+                           A->descr->base,
+                           mul,
+                           add);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(int_prod.data() + row_begin,
+                                           temp_buffer,
+                                           sizeof(I) * rows,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    }
+
+    // Wait for host transfers to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Offsets of the upper bounds of non-zero entries per row of C
+    std::vector<int64_t> row_ptr_bound(m + 1);
+
+    row_ptr_bound[0] = 0;
+
+    for(J i = 0; i < m; ++i)
+    {
+        row_ptr_bound[i + 1] = row_ptr_bound[i] + std::min((int64_t)int_prod[i], (int64_t)n);
+    }
+
+    // Half of the buffer is the workspace of the current chunk, the other half holds two
+    // slots of computed chunks that are transferred to the host
+    size_t slot_size = buffer_size / 4 / 256 * 256;
+    size_t work_size = buffer_size - 2 * slot_size;
+
+    char* workspace = reinterpret_cast<char*>(temp_buffer);
+    char* slots[2]  = {workspace + work_size, workspace + work_size + slot_size};
+
+    // Partition the rows of C into chunks
+    std::vector<J> chunk_ptr;
+    size_t         max_slot_size;
+
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse_spgemm_chunked_plan<I, J, T>(handle,
+                                                                      trans_A,
+                                                                      trans_B,
+                                                                      alpha,
+                                                                      A,
+                                                                      B,
+                                                                      beta,
+                                                                      D,
+                                                                      C,
+                                                                      row_ptr_A,
+                                                                      row_ptr_D,
+                                                                      row_ptr_bound,
+                                                                      values,
+                                                                      work_size,
+                                                                      slot_size,
+                                                                      workspace,
+                                                                      chunk_ptr,
+                                                                      &max_slot_size)));
+
+    // Pinned host slots for the callback
+    char* staging[2] = {nullptr, nullptr};
+
+    if(callback != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipHostMalloc((void**)&staging[0], 2 * max_slot_size));
+        staging[1] = staging[0] + max_slot_size;
+    }
+
+    rocsparse_status status = rocsparse_spgemm_chunked_run<I, J, T>(handle,
+                                                                     trans_A,
+                                                                     trans_B,
+                                                                     alpha,
+                                                                     A,
+                                                                     B,
+                                                                     beta,
+                                                                     D,
+                                                                     C,
+                                                                     alg,
+                                                                     callback,
+                                                                     user_data,
+                                                                     host_row_ptr_C,
+                                                                     host_col_ind_C,
+                                                                     host_val_C,
+                                                                     row_ptr_A,
+                                                                     row_ptr_D,
+                                                                     row_ptr_bound,
+                                                                     chunk_ptr,
+                                                                     values,
+                                                                     workspace,
+                                                                     slots,
+                                                                     staging);
+
+    // The copy stream has been drained by rocsparse_spgemm_chunked_run
+    if(staging[0] != nullptr)
+    {
+        rocsparse_spgemm_chunked_keep(status, hipHostFree(staging[0]));
+    }
+
+    return status;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_spgemm_chunked(rocsparse_handle                handle,
+                                                     rocsparse_operation             trans_A,
+                                                     rocsparse_operation             trans_B,
+                                                     const void*                     alpha,
+                                                     const rocsparse_spmat_descr     A,
+                                                     const rocsparse_spmat_descr     B,
+                                                     const void*                     beta,
+                                                     const rocsparse_spmat_descr     D,
+                                                     rocsparse_spmat_descr           C,
+                                                     rocsparse_datatype              compute_type,
+                                                     rocsparse_spgemm_alg            alg,
+                                                     void*                           csr_row_ptr_C,
+                                                     void*                           csr_col_ind_C,
+                                                     void*                           csr_val_C,
+                                                     rocsparse_spgemm_chunk_callback callback,
+                                                     void*                           user_data,
+                                                     size_t                          buffer_size,
+                                                     void*                           temp_buffer)
+{
+    // Check for invalid handle
+    RETURN_IF_INVALID_HANDLE(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spgemm_chunked",
+              trans_A,
+              trans_B,
+              (const void*&)alpha,
+              (const void*&)A,
+              (const void*&)B,
+              (const void*&)beta,
+              (const void*&)D,
+              (const void*&)C,
+              compute_type,
+              alg,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)csr_val_C,
+              (const void*&)callback,
+              (const void*&)user_data,
+              buffer_size,
+              (const void*&)temp_buffer);
+
+    // Check for invalid descriptors
+    RETURN_IF_NULLPTR(A);
+    RETURN_IF_NULLPTR(B);
+    RETURN_IF_NULLPTR(D);
+    RETURN_IF_NULLPTR(C);
+    RETURN_IF_NULLPTR(temp_buffer);
+
+    // Check for valid scalars
+    if(alpha == nullptr && beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid algorithm
+    if(rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check if descriptors are initialized
+    if(A->init == false || B->init == false || C->init == false || D->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Without callback, C is written to the host arrays
+    if(callback == nullptr)
+    {
+        RETURN_IF_NULLPTR(csr_row_ptr_C);
+
+        if(C->nnz > 0 && (csr_col_ind_C == nullptr || csr_val_C == nullptr))
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check if all sparse matrices are in the same format
+    if(A->format != B->format || A->format != C->format || A->format != D->format)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check for matching data types while we do not support mixed precision computation
+    if(compute_type != A->data_type || compute_type != B->data_type || compute_type != C->data_type
+       || compute_type != D->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check for matching index types
+    if(A->row_type != B->row_type || A->row_type != C->row_type || A->row_type != D->row_type
+       || A->col_type != B->col_type || A->col_type != C->col_type || A->col_type != D->col_type)
+    {
+        return rocsparse_status_type_mismatch;
+    }
+
+    RETURN_SPGEMM_CHUNKED(A->row_type,
+                          A->col_type,
+                          compute_type,
+                          handle,
+                          trans_A,
+                          trans_B,
+                          alpha,
+                          A,
+                          B,
+                          beta,
+                          D,
+                          C,
+                          alg,
+                          csr_row_ptr_C,
+                          csr_col_ind_C,
+                          csr_val_C,
+                          callback,
+                          user_data,
+                          buffer_size,
+                          temp_buffer);
+
+    return rocsparse_status_not_implemented;
+}
@@ -0,0 +1,452 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "rocsparse_csrgemm.hpp"
+
+#define RETURN_SPGEMM_MASKED(itype, jtype, ctype, ...)                                           \
+    {                                                                                            \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f32_r)                                                 \
+            return rocsparse_spgemm_masked_template<int32_t, int32_t, float>(__VA_ARGS__);       \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f64_r)                                                 \
+            return rocsparse_spgemm_masked_template<int32_t, int32_t, double>(__VA_ARGS__);      \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f32_c)                                                 \
+            return rocsparse_spgemm_masked_template<int32_t, int32_t, rocsparse_float_complex>(  \
+                __VA_ARGS__);                                                                    \
+        if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f64_c)                                                 \
+            return rocsparse_spgemm_masked_template<int32_t, int32_t, rocsparse_double_complex>( \
+                __VA_ARGS__);                                                                    \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f32_r)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int32_t, float>(__VA_ARGS__);       \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f64_r)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int32_t, double>(__VA_ARGS__);      \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f32_c)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int32_t, rocsparse_float_complex>(  \
+                __VA_ARGS__);                                                                    \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32                  \
+           && ctype == rocsparse_datatype_f64_c)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int32_t, rocsparse_double_complex>( \
+                __VA_ARGS__);                                                                    \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                  \
+           && ctype == rocsparse_datatype_f32_r)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int64_t, float>(__VA_ARGS__);       \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                  \
+           && ctype == rocsparse_datatype_f64_r)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int64_t, double>(__VA_ARGS__);      \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                  \
+           && ctype == rocsparse_datatype_f32_c)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int64_t, rocsparse_float_complex>(  \
+                __VA_ARGS__);                                                                    \
+        if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64                  \
+           && ctype == rocsparse_datatype_f64_c)                                                 \
+            return rocsparse_spgemm_masked_template<int64_t, int64_t, rocsparse_double_complex>( \
+                __VA_ARGS__);                                                                    \
+    }
+
+// Attach the mask to the csrgemm info of C, such that the intermediate products of the
+// current stage are restricted to the (complemented) sparsity pattern of M
+static inline rocsparse_status rocsparse_spgemm_set_mask(const rocsparse_spmat_descr M,
+                                                         rocsparse_spgemm_mask       mask,
+                                                         rocsparse_mat_info          info_C)
+{
+    // Mask requires the csrgemm info from the buffer size stage
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    info_C->csrgemm_info->mask_row_ptr    = M->row_data;
+    info_C->csrgemm_info->mask_col_ind    = M->col_data;
+    info_C->csrgemm_info->mask_base       = M->idx_base;
+    info_C->csrgemm_info->mask_complement = (mask == rocsparse_spgemm_mask_complement);
+
+    return rocsparse_status_success;
+}
+
+// Detach the mask from the csrgemm info of C
+static inline void rocsparse_spgemm_clear_mask(rocsparse_mat_info info_C)
+{
+    if(info_C->csrgemm_info != nullptr)
+    {
+        info_C->csrgemm_info->mask_row_ptr    = nullptr;
+        info_C->csrgemm_info->mask_col_ind    = nullptr;
+        info_C->csrgemm_info->mask_base       = rocsparse_index_base_zero;
+        info_C->csrgemm_info->mask_complement = false;
+    }
+}
+
+// Compute the masked product for all stages following the buffer size stage
+template <typename I, typename J, typename T>
+static inline rocsparse_status
+    rocsparse_spgemm_masked_compute_template(rocsparse_handle            handle,
+                                             rocsparse_operation         trans_A,
+                                             rocsparse_operation         trans_B,
+                                             const void*                 alpha,
+                                             const rocsparse_spmat_descr A,
+                                             const rocsparse_spmat_descr B,
+                                             rocsparse_spmat_descr       C,
+                                             rocsparse_spgemm_stage      stage,
+                                             void*                       temp_buffer)
+{
+    // STAGE 2 - compute number of non-zero entries of C
+    if(stage == rocsparse_spgemm_stage_nnz || (stage == rocsparse_spgemm_stage_auto && C->nnz == 0))
+    {
+        I nnz_C;
+
+        // non-zeros of C need to be on host
+        rocsparse_pointer_mode ptr_mode;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(handle, &ptr_mode));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_status status = rocsparse_csrgemm_nnz_template(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 (J)A->rows,
+                                                                 (J)B->cols,
+                                                                 (J)A->cols,
+                                                                 A->descr,
+                                                                 (I)A->nnz,
+                                                                 (const I*)A->row_data,
+                                                                 (const J*)A->col_data,
+                                                                 B->descr,
+                                                                 (I)B->nnz,
+                                                                 (const I*)B->row_data,
+                                                                 (const J*)B->col_data,
+                                                                 nullptr,
+                                                                 (I)0,
+                                                                 (const I*)nullptr,
+                                                                 (const J*)nullptr,
+                                                                 C->descr,
+                                                                 (I*)C->row_data,
+                                                                 &nnz_C,
+                                                                 C->info,
+                                                                 temp_buffer);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, ptr_mode));
+
+        C->nnz = nnz_C;
+
+        return status;
+    }
+
+    // STAGE 3 - perform SpGEMM computation
+    if(stage == rocsparse_spgemm_stage_compute || stage == rocsparse_spgemm_stage_auto)
+    {
+        return rocsparse_csrgemm_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          (J)A->rows,
+                                          (J)B->cols,
+                                          (J)A->cols,
+                                          (const T*)alpha,
+                                          A->descr,
+                                          (I)A->nnz,
+                                          (const T*)A->val_data,
+                                          (const I*)A->row_data,
+                                          (const J*)A->col_data,
+                                          B->descr,
+                                          (I)B->nnz,
+                                          (const T*)B->val_data,
+                                          (const I*)B->row_data,
+                                          (const J*)B->col_data,
+                                          (const T*)nullptr,
+                                          nullptr,
+                                          (I)0,
+                                          (const T*)nullptr,
+                                          (const I*)nullptr,
+                                          (const J*)nullptr,
+                                          C->descr,
+                                          (T*)C->val_data,
+                                          (const I*)C->row_data,
+                                          (J*)C->col_data,
+                                          C->info,
+                                          temp_buffer);
+    }
+
+    // STAGE 4 - perform SpGEMM computation and keep the structure of C
+    if(stage == rocsparse_spgemm_stage_symbolic)
+    {
+        return rocsparse_csrgemm_symbolic_template(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   (J)A->rows,
+                                                   (J)B->cols,
+                                                   (J)A->cols,
+                                                   (const T*)alpha,
+                                                   A->descr,
+                                                   (I)A->nnz,
+                                                   (const T*)A->val_data,
+                                                   (const I*)A->row_data,
+                                                   (const J*)A->col_data,
+                                                   B->descr,
+                                                   (I)B->nnz,
+                                                   (const T*)B->val_data,
+                                                   (const I*)B->row_data,
+                                                   (const J*)B->col_data,
+                                                   (const T*)nullptr,
+                                                   nullptr,
+                                                   (I)0,
+                                                   (const T*)nullptr,
+                                                   (const I*)nullptr,
+                                                   (const J*)nullptr,
+                                                   C->descr,
+                                                   (T*)C->val_data,
+                                                   (const I*)C->row_data,
+                                                   (J*)C->col_data,
+                                                   C->info,
+                                                   temp_buffer);
+    }
+
+    // STAGE 5 - re-compute the values of C, using the structure of C from stage 4. Products
+    // outside of the structure of C are masked out and skipped
+    if(stage == rocsparse_spgemm_stage_numeric)
+    {
+        return rocsparse_csrgemm_numeric_template(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  (J)A->rows,
+                                                  (J)B->cols,
+                                                  (J)A->cols,
+                                                  (const T*)alpha,
+                                                  A->descr,
+                                                  (I)A->nnz,
+                                                  (const T*)A->val_data,
+                                                  (const I*)A->row_data,
+                                                  (const J*)A->col_data,
+                                                  B->descr,
+                                                  (I)B->nnz,
+                                                  (const T*)B->val_data,
+                                                  (const I*)B->row_data,
+                                                  (const J*)B->col_data,
+                                                  (const T*)nullptr,
+                                                  nullptr,
+                                                  (I)0,
+                                                  (const T*)nullptr,
+                                                  (const I*)nullptr,
+                                                  (const J*)nullptr,
+                                                  C->descr,
+                                                  (T*)C->val_data,
+                                                  (const I*)C->row_data,
+                                                  (const J*)C->col_data,
+                                                  C->info,
+                                                  temp_buffer);
+    }
+
+    return rocsparse_status_not_implemented;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_spgemm_masked_template(rocsparse_handle            handle,
+                                                  rocsparse_operation         trans_A,
+                                                  rocsparse_operation         trans_B,
+                                                  const void*                 alpha,
+                                                  const rocsparse_spmat_descr A,
+                                                  const rocsparse_spmat_descr B,
+                                                  const rocsparse_spmat_descr M,
+                                                  rocsparse_spgemm_mask       mask,
+                                                  rocsparse_spmat_descr       C,
+                                                  rocsparse_spgemm_alg        alg,
+                                                  rocsparse_spgemm_stage      stage,
+                                                  size_t*                     buffer_size,
+                                                  void*                       temp_buffer)
+{
+    // STAGE 1 - compute required buffer size of temp_buffer
+    if(stage == rocsparse_spgemm_stage_buffer_size
+       || (stage == rocsparse_spgemm_stage_auto && temp_buffer == nullptr))
+    {
+        // CSR format
+        if(A->format == rocsparse_format_csr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size_template(handle,
+                                                                             trans_A,
+                                                                             trans_B,
+                                                                             (J)A->rows,
+                                                                             (J)B->cols,
+                                                                             (J)A->cols,
+                                                                             (const T*)alpha,
+                                                                             A->descr,
+                                                                             (I)A->nnz,
+                                                                             (const I*)A->row_data,
+                                                                             (const J*)A->col_data,
+                                                                             B->descr,
+                                                                             (I)B->nnz,
+                                                                             (const I*)B->row_data,
+                                                                             (const J*)B->col_data,
+                                                                             (const T*)nullptr,
+                                                                             nullptr,
+                                                                             (I)0,
+                                                                             (const I*)nullptr,
+                                                                             (const J*)nullptr,
+                                                                             C->info,
+                                                                             buffer_size));
+
+            // Keep the algorithm for the subsequent stages
+            C->info->csrgemm_info->alg = alg;
+
+            return rocsparse_status_success;
+        }
+
+        return rocsparse_status_not_implemented;
+    }
+
+    // CSR format
+    if(A->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // All subsequent stages discard the intermediate products that are masked out. The mask
+    // is only attached to C for the duration of this call
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_spgemm_set_mask(M, mask, C->info));
+
+    rocsparse_status status = rocsparse_spgemm_masked_compute_template<I, J, T>(
+        handle, trans_A, trans_B, alpha, A, B, C, stage, temp_buffer);
+
+    // Detach the mask on every exit path, such that subsequent SpGEMM and csrgemm calls on C
+    // are not masked
+    rocsparse_spgemm_clear_mask(C->info);
+
+    return status;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_spgemm_masked(rocsparse_handle            handle,
+                                                    rocsparse_operation         trans_A,
+                                                    rocsparse_operation         trans_B,
+                                                    const void*                 alpha,
+                                                    const rocsparse_spmat_descr A,
+                                                    const rocsparse_spmat_descr B,
+                                                    const rocsparse_spmat_descr M,
+                                                    rocsparse_spgemm_mask       mask,
+                                                    rocsparse_spmat_descr       C,
+                                                    rocsparse_datatype          compute_type,
+                                                    rocsparse_spgemm_alg        alg,
+                                                    rocsparse_spgemm_stage      stage,
+                                                    size_t*                     buffer_size,
+                                                    void*                       temp_buffer)
+{
+    // Check for invalid handle
+    RETURN_IF_INVALID_HANDLE(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spgemm_masked",
+              trans_A,
+              trans_B,
+              (const void*&)alpha,
+              (const void*&)A,
+              (const void*&)B,
+              (const void*&)M,
+              mask,
+              (const void*&)C,
+              compute_type,
+              alg,
+              stage,
+              (const void*&)buffer_size,
+              (const void*&)temp_buffer);
+
+    // Check for invalid descriptors
+    RETURN_IF_NULLPTR(A);
+    RETURN_IF_NULLPTR(B);
+    RETURN_IF_NULLPTR(M);
+    RETURN_IF_NULLPTR(C);
+
+    // Check for valid scalar
+    RETURN_IF_NULLPTR(alpha);
+
+    // Check for valid mask and algorithm
+    if(rocsparse_enum_utils::is_invalid(mask) || rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid buffer_size pointer only if temp_buffer is nullptr
+    if(temp_buffer == nullptr)
+    {
+        RETURN_IF_NULLPTR(buffer_size);
+    }
+
+    // Check if descriptors are initialized
+    if(A->init == false || B->init == false || M->init == false || C->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check if all sparse matrices are in the same format
+    if(A->format != B->format || A->format != M->format || A->format != C->format)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check for matching data types while we do not support mixed precision computation
+    if(compute_type != A->data_type || compute_type != B->data_type || compute_type != C->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check for matching index types
+    if(A->row_type != B->row_type || A->row_type != M->row_type || A->row_type != C->row_type
+       || A->col_type != B->col_type || A->col_type != M->col_type || A->col_type != C->col_type)
+    {
+        return rocsparse_status_type_mismatch;
+    }
+
+    // Check that the mask matches the dimensions of C
+    if(M->rows != A->rows || M->cols != B->cols)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    RETURN_SPGEMM_MASKED(A->row_type,
+                         A->col_type,
+                         compute_type,
+                         handle,
+                         trans_A,
+                         trans_B,
+                         alpha,
+                         A,
+                         B,
+                         M,
+                         mask,
+                         C,
+                         alg,
+                         stage,
+                         buffer_size,
+                         temp_buffer);
+
+    return rocsparse_status_not_implemented;
+}
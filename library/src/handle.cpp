@@ -207,6 +207,13 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
         RETURN_IF_HIP_ERROR(hipFree(info->wg_ids));
     }
 
+    // Clean up merge path
+    if(info->merge_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->merge_path));
+        RETURN_IF_HIP_ERROR(hipFree(info->merge_carry));
+    }
+
     // Destruct
     try
     {
@@ -270,6 +277,12 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
         info->trm_diag_ind = nullptr;
     }
 
+    if(info->level_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->level_ptr));
+        info->level_ptr = nullptr;
+    }
+
     // Clear trmt arrays
     if(info->trmt_perm != nullptr)
     {
@@ -289,6 +302,12 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
         info->trmt_col_ind = nullptr;
     }
 
+    if(info->trm_col_nnz != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trm_col_nnz));
+        info->trm_col_nnz = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -387,6 +406,17 @@ rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info)
         return rocsparse_status_success;
     }
 
+    // Clean up row grouping of C
+    if(info->group_offset != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->group_offset));
+    }
+
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->perm));
+    }
+
     // Destruct
     try
     {
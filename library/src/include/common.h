@@ -28,6 +28,7 @@
 
 #include "rocsparse.h"
 
+#include <hip/hip_bfloat16.h>
 #include <hip/hip_runtime.h>
 
 // clang-format off
@@ -59,6 +60,9 @@ __device__ __forceinline__ float rocsparse_ldg(const float* ptr) { return __ldg(
 __device__ __forceinline__ double rocsparse_ldg(const double* ptr) { return __ldg(ptr); }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_ldg(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__ldg((const float*)ptr), __ldg((const float*)ptr + 1)); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_ldg(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__ldg((const double*)ptr), __ldg((const double*)ptr + 1)); }
+__device__ __forceinline__ _Float16 rocsparse_ldg(const _Float16* ptr) { return *ptr; }
+__device__ __forceinline__ hip_bfloat16 rocsparse_ldg(const hip_bfloat16* ptr) { return *ptr; }
+__device__ __forceinline__ int8_t rocsparse_ldg(const int8_t* ptr) { return __ldg(ptr); }
 __device__ __forceinline__ int32_t rocsparse_ldg(const int32_t* ptr) { return __ldg(ptr); }
 __device__ __forceinline__ int64_t rocsparse_ldg(const int64_t* ptr) { return __ldg(ptr); }
 
@@ -86,6 +90,9 @@ __device__ __forceinline__ float rocsparse_nontemporal_load(const float* ptr) {
 __device__ __forceinline__ double rocsparse_nontemporal_load(const double* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ rocsparse_float_complex rocsparse_nontemporal_load(const rocsparse_float_complex* ptr) { return rocsparse_float_complex(__builtin_nontemporal_load((const float*)ptr), __builtin_nontemporal_load((const float*)ptr + 1)); }
 __device__ __forceinline__ rocsparse_double_complex rocsparse_nontemporal_load(const rocsparse_double_complex* ptr) { return rocsparse_double_complex(__builtin_nontemporal_load((const double*)ptr), __builtin_nontemporal_load((const double*)ptr + 1)); }
+__device__ __forceinline__ _Float16 rocsparse_nontemporal_load(const _Float16* ptr) { return __builtin_nontemporal_load(ptr); }
+__device__ __forceinline__ hip_bfloat16 rocsparse_nontemporal_load(const hip_bfloat16* ptr) { return *ptr; }
+__device__ __forceinline__ int8_t rocsparse_nontemporal_load(const int8_t* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ int32_t rocsparse_nontemporal_load(const int32_t* ptr) { return __builtin_nontemporal_load(ptr); }
 __device__ __forceinline__ int64_t rocsparse_nontemporal_load(const int64_t* ptr) { return __builtin_nontemporal_load(ptr); }
 
@@ -179,6 +179,17 @@ struct _rocsparse_mat_info
     int         use_double_prec_tol = 0;
     const void* boost_tol           = nullptr;
     const void* boost_val           = nullptr;
+
+    // number of sweeps of the approximate csrsv solve
+    rocsparse_int csrsv_jacobi_sweeps = 3;
+
+    // coloring algorithm and balancing of csrcolor
+    rocsparse_color_alg color_alg     = rocsparse_color_alg_jpl;
+    int                 color_balance = 0;
+
+    // color offsets computed by csrcolor
+    rocsparse_int  ncolors   = 0;
+    rocsparse_int* color_ptr = nullptr;
 };
 
 /********************************************************************************
@@ -206,6 +217,15 @@ struct _rocsparse_csrmv_info
     void*         row_blocks = nullptr;
     unsigned int* wg_flags   = nullptr;
     void*         wg_ids     = nullptr;
+    // size in bytes of a single row block and workgroup id
+    size_t row_blocks_type_size = 0;
+    size_t wg_ids_type_size     = 0;
+
+    // num merge path tiles
+    size_t merge_size = 0;
+    // merge path row coordinates and tile carry-outs
+    void* merge_path  = nullptr;
+    void* merge_carry = nullptr;
 
     // some data to verify correct execution
     rocsparse_operation         trans;
@@ -243,6 +263,16 @@ struct _rocsparse_trm_info
     rocsparse_int* trmt_perm    = nullptr;
     rocsparse_int* trmt_row_ptr = nullptr;
     rocsparse_int* trmt_col_ind = nullptr;
+    // device array to hold the number of strictly triangular entries per column, used
+    // by transposed solves that operate on the non-transposed matrix
+    int* trm_col_nnz = nullptr;
+
+    // number of levels
+    rocsparse_int nlevels = 0;
+    // device array to hold the offsets of the levels into the row permutation
+    rocsparse_int* level_ptr = nullptr;
+    // host copy of the level offsets
+    std::vector<rocsparse_int> level_ptr_host;
 
     // some data to verify correct execution
     rocsparse_int               m;
@@ -284,6 +314,24 @@ struct _rocsparse_csrgemm_info
     bool mul = true;
     // Perform beta * D
     bool add = true;
+    // SpGEMM algorithm, selecting the accumulator of each row group
+    rocsparse_spgemm_alg alg = rocsparse_spgemm_alg_default;
+
+    // Device row offsets and column indices of the mask of C, restricting the intermediate
+    // products of alpha * A * B (nullptr, if C is not masked)
+    const void* mask_row_ptr = nullptr;
+    const void* mask_col_ind = nullptr;
+    // Index base of the mask
+    rocsparse_index_base mask_base = rocsparse_index_base_zero;
+    // Restrict C to the entries that are not in the mask
+    bool mask_complement = false;
+
+    // Symbolic stage has been performed and row grouping of C is available
+    bool symbolic = false;
+    // Device group offsets into the row permutation (8 groups and total number of rows)
+    void* group_offset = nullptr;
+    // Device row permutation of C
+    void* perm = nullptr;
 };
 
 /********************************************************************************
@@ -322,6 +370,17 @@ struct _rocsparse_spvec_descr
     rocsparse_index_base idx_base;
 };
 
+// Parameters of a SpMV that affect which SpMV algorithm is the fastest. The scalars only
+// contribute whether beta is zero, which is known in host pointer mode only.
+struct rocsparse_spmv_tuning_key
+{
+    rocsparse_operation    trans;
+    rocsparse_datatype     x_type;
+    rocsparse_datatype     compute_type;
+    rocsparse_pointer_mode pointer_mode;
+    bool                   beta_zero;
+};
+
 struct _rocsparse_spmat_descr
 {
     bool init     = false;
@@ -343,6 +402,19 @@ struct _rocsparse_spmat_descr
     rocsparse_index_base idx_base;
     rocsparse_format     format;
 
+    // BSR block properties
+    rocsparse_direction block_dir = rocsparse_direction_row;
+    int64_t             block_dim = 1;
+
+    // SELL slice properties
+    int64_t slice_size = 1;
+
+    // SpMV algorithm selected by rocsparse_spmv_alg_auto and the SpMV parameters it has
+    // been selected for
+    bool                      spmv_tuned = false;
+    rocsparse_spmv_alg        spmv_alg   = rocsparse_spmv_alg_default;
+    rocsparse_spmv_tuning_key spmv_key;
+
     rocsparse_mat_descr descr;
     rocsparse_mat_info  info;
 };
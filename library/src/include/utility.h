@@ -30,6 +30,7 @@
 #include "logging.h"
 #include <algorithm>
 #include <exception>
+#include <hip/hip_bfloat16.h>
 
 // Return the leftmost significant bit position
 #if defined(rocsparse_ILP64)
@@ -333,6 +334,9 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_datatype value_)
     case rocsparse_datatype_f64_r:
     case rocsparse_datatype_f32_c:
     case rocsparse_datatype_f64_c:
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
     {
         return false;
     }
@@ -350,6 +354,9 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_spmv_alg value_)
     case rocsparse_spmv_alg_csr_adaptive:
     case rocsparse_spmv_alg_csr_stream:
     case rocsparse_spmv_alg_ell:
+    case rocsparse_spmv_alg_csr_merge:
+    case rocsparse_spmv_alg_sell:
+    case rocsparse_spmv_alg_auto:
     {
         return false;
     }
@@ -392,6 +399,35 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_spmm_stage value_)
     return true;
 };
 
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_spgemm_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_spgemm_alg_default:
+    case rocsparse_spgemm_alg_esc:
+    case rocsparse_spgemm_alg_dense_acc:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_spgemm_mask value_)
+{
+    switch(value_)
+    {
+    case rocsparse_spgemm_mask_structural:
+    case rocsparse_spgemm_mask_complement:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
 template <>
 inline bool rocsparse_enum_utils::is_invalid(rocsparse_sddmm_alg value_)
 {
@@ -411,6 +447,53 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_solve_policy value_)
     switch(value_)
     {
     case rocsparse_solve_policy_auto:
+    case rocsparse_solve_policy_level:
+    case rocsparse_solve_policy_push:
+    case rocsparse_solve_policy_jacobi:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_color_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_color_alg_jpl:
+    case rocsparse_color_alg_jpl_distance2:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_gtsv_interleaved_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_gtsv_interleaved_alg_default:
+    case rocsparse_gtsv_interleaved_alg_thomas:
+    case rocsparse_gtsv_interleaved_alg_lu:
+    case rocsparse_gtsv_interleaved_alg_qr:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_gpsv_interleaved_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_gpsv_interleaved_alg_default:
+    case rocsparse_gpsv_interleaved_alg_qr:
     {
         return false;
     }
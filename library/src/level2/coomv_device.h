@@ -42,6 +42,37 @@ __device__ void coomv_scale_device(I size, T beta, T* __restrict__ data)
     data[gid] = data[gid] * beta;
 }
 
+// Transposed COO SpMV, where each thread scatters a single non-zero entry into y.
+// The row and column indices are accessed with stride ind_inc, such that the same
+// kernel can be used for both, the SoA and AoS COO formats.
+template <unsigned int BLOCKSIZE, typename I, typename T>
+static __device__ void coomvt_device(rocsparse_operation  trans,
+                                     I                    nnz,
+                                     I                    ind_inc,
+                                     T                    alpha,
+                                     const I*             coo_row_ind,
+                                     const I*             coo_col_ind,
+                                     const T*             coo_val,
+                                     const T*             x,
+                                     T*                   y,
+                                     rocsparse_index_base idx_base)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    I row = coo_row_ind[gid * ind_inc] - idx_base;
+    I col = coo_col_ind[gid * ind_inc] - idx_base;
+
+    T val = (trans == rocsparse_operation_conjugate_transpose) ? rocsparse_conj(coo_val[gid])
+                                                               : coo_val[gid];
+
+    atomicAdd(&y[col], alpha * val * rocsparse_ldg(x + row));
+}
+
 // Implementation motivated by papers 'Efficient Sparse Matrix-Vector Multiplication on CUDA',
 // 'Implementing Sparse Matrix-Vector Multiplication on Throughput-Oriented Processors' and
 // 'Segmented operations for sparse matrix computation on vector multiprocessors'
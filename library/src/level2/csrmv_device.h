@@ -28,13 +28,19 @@
 
 #include "common.h"
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmvn_general_device(J                    m,
                                              T                    alpha,
                                              const I*             row_offset,
                                              const J*             csr_col_ind,
-                                             const T*             csr_val,
-                                             const T*             x,
+                                             const A*             csr_val,
+                                             const X*             x,
                                              T                    beta,
                                              T*                   y,
                                              rocsparse_index_base idx_base)
@@ -56,8 +62,9 @@ static __device__ void csrmvn_general_device(J                    m,
         // Loop over non-zero elements
         for(I j = row_start + lid; j < row_end; j += WF_SIZE)
         {
-            sum = rocsparse_fma(
-                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+            sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                static_cast<T>(rocsparse_ldg(x + csr_col_ind[j] - idx_base)),
+                                sum);
         }
 
         // Obtain row sum using parallel reduction
@@ -78,6 +85,306 @@ static __device__ void csrmvn_general_device(J                    m,
     }
 }
 
+// Scale kernel for beta != 1.0
+template <typename I, typename T>
+static __device__ void csrmv_scale_device(I size, T beta, T* __restrict__ data)
+{
+    I gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    data[gid] = data[gid] * beta;
+}
+
+// See Y. Tao et al., "Atomic reduction based sparse matrix-transpose vector multiplication
+// on GPUs," 2014 20th IEEE International Conference on Parallel and Distributed Systems
+// (ICPADS), 2014, pp. 987-992, doi: 10.1109/PADSW.2014.7097920.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
+static __device__ void csrmvt_general_device(rocsparse_operation  trans,
+                                             J                    m,
+                                             T                    alpha,
+                                             const I*             csr_row_ptr,
+                                             const J*             csr_col_ind,
+                                             const A*             csr_val,
+                                             const X*             x,
+                                             T*                   y,
+                                             rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = csr_row_ptr[row] - idx_base;
+        I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T row_val = alpha * static_cast<T>(rocsparse_ldg(x + row));
+
+        // Loop over non-zero elements and scatter into y
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            T val = static_cast<T>(csr_val[j]);
+            val   = (trans == rocsparse_operation_conjugate_transpose) ? rocsparse_conj(val) : val;
+
+            atomicAdd(&y[csr_col_ind[j] - idx_base], row_val * val);
+        }
+    }
+}
+
+// Symmetric and Hermitian matrices only store the triangle selected by the fill
+// mode (including the diagonal). Each wavefront processes one row, gathers the
+// stored entries of the row and scatters their mirrored counterparts into y.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
+static __device__ void csrmv_symm_general_device(bool                 conj_direct,
+                                                 bool                 conj_mirror,
+                                                 rocsparse_fill_mode  fill_mode,
+                                                 J                    m,
+                                                 T                    alpha,
+                                                 const I*             csr_row_ptr,
+                                                 const J*             csr_col_ind,
+                                                 const A*             csr_val,
+                                                 const X*             x,
+                                                 T*                   y,
+                                                 rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(J row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        I row_start = csr_row_ptr[row] - idx_base;
+        I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T row_val = alpha * static_cast<T>(rocsparse_ldg(x + row));
+        T sum     = static_cast<T>(0);
+
+        for(I j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            J col = csr_col_ind[j] - idx_base;
+
+            // Entries outside of the stored triangle are ignored
+            if((fill_mode == rocsparse_fill_mode_lower && col > row)
+               || (fill_mode == rocsparse_fill_mode_upper && col < row))
+            {
+                continue;
+            }
+
+            T val = static_cast<T>(csr_val[j]);
+
+            sum = rocsparse_fma(conj_direct ? rocsparse_conj(val) : val,
+                                static_cast<T>(rocsparse_ldg(x + col)),
+                                sum);
+
+            // Mirrored entry of the triangle that is not stored
+            if(col != row)
+            {
+                atomicAdd(&y[col], (conj_mirror ? rocsparse_conj(val) : val) * row_val);
+            }
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // First thread of each wavefront adds the result into y
+        if(lid == WF_SIZE - 1)
+        {
+            atomicAdd(&y[row], alpha * sum);
+        }
+    }
+}
+
+// Number of row block entries that start at the given row. Rows are packed into
+// row blocks by the position of their last non-zero entry, such that all rows
+// of a block end within the same chunk of BLOCKSIZE / 2 non-zeros. Rows with
+// more than BLOCKSIZE / 2 entries form a row block on their own and rows with
+// more than BLOCKSIZE entries are split across multiple workgroups (CSR-LongRows).
+// This bounds the number of non-zeros of a CSR-Stream row block by BLOCKSIZE.
+template <unsigned int BLOCKSIZE, unsigned int BLOCK_MULTIPLIER, typename I, typename J>
+static __device__ __forceinline__ I
+    csrmvn_preprocess_row_entries(J row, const I* csr_row_ptr, rocsparse_index_base idx_base)
+{
+    I row_begin = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+    I row_nnz   = row_end - row_begin;
+
+    // Long rows
+    if(row_nnz > BLOCKSIZE)
+    {
+        return (row_nnz - 1) / (BLOCK_MULTIPLIER * BLOCKSIZE) + 1;
+    }
+
+    // Rows that exceed half of the block size are isolated
+    if(row_nnz > BLOCKSIZE / 2 || row == 0)
+    {
+        return 1;
+    }
+
+    // Row following an isolated row starts a new row block
+    I prev_begin = csr_row_ptr[row - 1] - idx_base;
+    if(row_begin - prev_begin > BLOCKSIZE / 2)
+    {
+        return 1;
+    }
+
+    // Row ends in a new chunk
+    return (row_end / (BLOCKSIZE / 2) != row_begin / (BLOCKSIZE / 2)) ? 1 : 0;
+}
+
+// Compute the number of row block entries of each tile of rows
+template <unsigned int BLOCKSIZE,
+          unsigned int ROW_BLOCK_SIZE,
+          unsigned int BLOCK_MULTIPLIER,
+          typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_preprocess_count_kernel(J m,
+                                        const I* __restrict__ csr_row_ptr,
+                                        I* __restrict__ tile_ptr,
+                                        rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    J   row = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ I sdata[BLOCKSIZE];
+
+    sdata[tid] = (row < m) ? csrmvn_preprocess_row_entries<ROW_BLOCK_SIZE, BLOCK_MULTIPLIER>(
+                     row, csr_row_ptr, idx_base)
+                           : static_cast<I>(0);
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        tile_ptr[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+// Initialize row blocks with the terminating row and clear workgroup data
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_preprocess_init_kernel(J      m,
+                                       size_t size,
+                                       I* __restrict__ row_blocks,
+                                       unsigned int* __restrict__ wg_flags,
+                                       J* __restrict__ wg_ids)
+{
+    size_t gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    row_blocks[gid] = m;
+    wg_flags[gid]   = 0U;
+    wg_ids[gid]     = 0;
+}
+
+// Write the row block entries of each row, using the tile offsets
+template <unsigned int BLOCKSIZE,
+          unsigned int ROW_BLOCK_SIZE,
+          unsigned int BLOCK_MULTIPLIER,
+          typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_preprocess_fill_kernel(J m,
+                                       const I* __restrict__ csr_row_ptr,
+                                       const I* __restrict__ tile_ptr,
+                                       I* __restrict__ row_blocks,
+                                       J* __restrict__ wg_ids,
+                                       rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    J   row = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ I sdata[BLOCKSIZE];
+
+    I entries = (row < m) ? csrmvn_preprocess_row_entries<ROW_BLOCK_SIZE, BLOCK_MULTIPLIER>(
+                    row, csr_row_ptr, idx_base)
+                          : static_cast<I>(0);
+
+    sdata[tid] = entries;
+
+    __syncthreads();
+
+    // Inclusive scan of the tile entries
+    for(unsigned int i = 1; i < BLOCKSIZE; i <<= 1)
+    {
+        I val = (tid >= i) ? sdata[tid - i] : static_cast<I>(0);
+        __syncthreads();
+        sdata[tid] += val;
+        __syncthreads();
+    }
+
+    I offset = tile_ptr[hipBlockIdx_x] + sdata[tid] - entries;
+
+    // A long row is processed by multiple workgroups, each of them
+    // obtaining its id within the row
+    for(I w = 0; w < entries; ++w)
+    {
+        row_blocks[offset + w] = row;
+        wg_ids[offset + w]     = static_cast<J>(w);
+    }
+}
+
+// Store the number of threads that could team up in a CSR-Stream row block reduction.
+// If there are a relatively small number of rows, we choose to do a horizontal
+// reduction (groups of threads all reduce the same row). If there are many rows
+// (e.g. more rows than the size of our workgroup) then we choose to have each
+// thread serially reduce the row.
+template <unsigned int BLOCKSIZE,
+          unsigned int WG_SIZE,
+          unsigned int ROWS_FOR_VECTOR,
+          typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_preprocess_reduction_kernel(size_t nblocks,
+                                            const I* __restrict__ row_blocks,
+                                            J* __restrict__ wg_ids)
+{
+    size_t gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nblocks)
+    {
+        return;
+    }
+
+    I num_rows = row_blocks[gid + 1] - row_blocks[gid];
+
+    if(num_rows > ROWS_FOR_VECTOR)
+    {
+        // Largest power of two such that num_rows groups of threads fit into WG_SIZE
+        wg_ids[gid] = (num_rows > WG_SIZE)
+                          ? static_cast<J>(0)
+                          : static_cast<J>(WG_SIZE >> (32 - __clz((unsigned int)(num_rows - 1))));
+    }
+}
+
 template <typename I, typename T>
 static inline __device__ T sum2_reduce(T cur_sum, T* partial, int lid, I max_size, int reduc_size)
 {
@@ -96,15 +403,17 @@ template <rocsparse_int BLOCKSIZE,
           rocsparse_int WG_SIZE,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A,
+          typename X>
 __device__ void csrmvn_adaptive_device(const I*             row_blocks,
                                        unsigned int*        wg_flags,
                                        const J*             wg_ids,
                                        T                    alpha,
                                        const I*             csr_row_ptr,
                                        const J*             csr_col_ind,
-                                       const T*             csr_val,
-                                       const T*             x,
+                                       const A*             csr_val,
+                                       const X*             x,
                                        T                    beta,
                                        T*                   y,
                                        rocsparse_index_base idx_base)
@@ -125,7 +434,7 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
     // part of the row to operate on.
     // Alternately, on short row blocks, wg_ids are used to communicate
     // the number of threads that should be used for the reduction. Pre-calculating
-    // this on the CPU-side results in a noticable performance uplift on many matrices.
+    // this during analysis results in a noticable performance uplift on many matrices.
     // wg_flags contains the flag bit used so that the multiple WGs calculating a long row can
     // know when the first workgroup for that row has finished initializing the output
     // value. While this bit is the same as the first workgroup's flag bit, this
@@ -134,6 +443,14 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
     I stop_row = row_blocks[gid + 1];
     J num_rows = stop_row - row;
 
+    // The row blocks array is sized to its upper bound during analysis. Trailing
+    // entries point to the last row and have no work assigned.
+    I last_row = row_blocks[hipGridDim_x];
+    if(row == last_row)
+    {
+        return;
+    }
+
     // Get the workgroup within this long row ID
     J wg = wg_ids[gid];
 
@@ -174,32 +491,30 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
         // threads, 4 rows = 64 threads, 5 rows = 32 threads, etc.
         // int numThreadsForRed = get_local_size(0) >> ((CHAR_BIT*sizeof(unsigned
         // int))-clz(num_rows-1));
-        J numThreadsForRed = wg; // Same calculation as above, done on host.
+        J numThreadsForRed = wg; // Same calculation as above, done during analysis.
 
         // Stream all of this row block's matrix values into local memory.
         // Perform the matvec in parallel with this work.
         I col = csr_row_ptr[row] + lid - idx_base;
-        if(gid != (gridDim.x - 1))
+        if(csr_row_ptr[row] + BLOCKSIZE <= csr_row_ptr[last_row])
         {
             for(J i = 0; i < BLOCKSIZE; i += WG_SIZE)
             {
-                partialSums[lid + i]
-                    = alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                partialSums[lid + i] = alpha * static_cast<T>(csr_val[col + i])
+                                       * static_cast<T>(x[csr_col_ind[col + i] - idx_base]);
             }
         }
         else
         {
             // This is required so that we stay in bounds for csr_val[] and csr_col_ind[].
             // Otherwise, if the matrix's endpoints don't line up with BLOCKSIZE,
-            // we will buffer overflow. On today's dGPUs, this doesn't cause problems.
-            // The values are within a dGPU's page, which is zeroed out on allocation.
-            // However, this may change in the future (e.g. with shared virtual memory.)
-            // This causes a minor performance loss because this is the last workgroup
-            // to be launched, and this loop can't be unrolled.
+            // we will buffer overflow.
+            // This causes a minor performance loss for the workgroups at the end of
+            // the matrix, because this loop can't be unrolled.
             for(I i = 0; col + i < csr_row_ptr[stop_row] - idx_base; i += WG_SIZE)
             {
-                partialSums[lid + i]
-                    = alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                partialSums[lid + i] = alpha * static_cast<T>(csr_val[col + i])
+                                       * static_cast<T>(x[csr_col_ind[col + i] - idx_base]);
             }
         }
         __syncthreads();
@@ -321,8 +636,9 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
             // things.
             for(I j = vecStart + lid; j < vecEnd; j += WG_SIZE)
             {
-                temp_sum
-                    = rocsparse_fma(alpha * csr_val[j], x[csr_col_ind[j] - idx_base], temp_sum);
+                temp_sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                         static_cast<T>(x[csr_col_ind[j] - idx_base]),
+                                         temp_sum);
             }
 
             partialSums[lid] = temp_sum;
@@ -393,7 +709,9 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
         // Then dump the partially reduced answers into the LDS for inter-work-item reduction.
         for(I j = vecStart + lid; j < vecEnd; j += WG_SIZE)
         {
-            temp_sum = rocsparse_fma(alpha * csr_val[j], x[csr_col_ind[j] - idx_base], temp_sum);
+            temp_sum = rocsparse_fma(alpha * static_cast<T>(csr_val[j]),
+                                     static_cast<T>(x[csr_col_ind[j] - idx_base]),
+                                     temp_sum);
         }
 
         partialSums[lid] = temp_sum;
@@ -410,4 +728,283 @@ __device__ void csrmvn_adaptive_device(const I*             row_blocks,
     }
 }
 
+// Transposed CSR-Adaptive. Each workgroup scatters the non-zeros of its row block into y
+// using atomics. The row blocks are the same as for the non-transposed product, such that
+// the work is balanced across workgroups independently of the row length distribution.
+template <unsigned int BLOCKSIZE,
+          unsigned int BLOCK_MULTIPLIER,
+          unsigned int WG_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
+__device__ void csrmvt_adaptive_device(rocsparse_operation  trans,
+                                       const I*             row_blocks,
+                                       const J*             wg_ids,
+                                       T                    alpha,
+                                       const I*             csr_row_ptr,
+                                       const J*             csr_col_ind,
+                                       const A*             csr_val,
+                                       const X*             x,
+                                       T*                   y,
+                                       rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x;
+    int gid = hipBlockIdx_x;
+
+    I row      = row_blocks[gid];
+    I stop_row = row_blocks[gid + 1];
+
+    // Skip trailing row blocks
+    if(row == row_blocks[hipGridDim_x])
+    {
+        return;
+    }
+
+    if(stop_row - row > 1)
+    {
+        // Row block with multiple short rows. Each thread processes a single non-zero
+        // and obtains its row by binary search within the row block.
+        I block_start = csr_row_ptr[row] - idx_base;
+        I block_end   = csr_row_ptr[stop_row] - idx_base;
+
+        for(I j = block_start + lid; j < block_end; j += WG_SIZE)
+        {
+            I left  = row;
+            I right = stop_row - 1;
+
+            while(left < right)
+            {
+                I mid = (left + right + 1) >> 1;
+
+                if(csr_row_ptr[mid] - idx_base <= j)
+                {
+                    left = mid;
+                }
+                else
+                {
+                    right = mid - 1;
+                }
+            }
+
+            T val = static_cast<T>(csr_val[j]);
+            val   = (trans == rocsparse_operation_conjugate_transpose) ? rocsparse_conj(val) : val;
+
+            atomicAdd(&y[csr_col_ind[j] - idx_base],
+                      alpha * val * static_cast<T>(rocsparse_ldg(x + left)));
+        }
+    }
+    else
+    {
+        // Single row, that might be split across multiple workgroups
+        J wg = wg_ids[gid];
+
+        I vec_start = (I)wg * (I)BLOCK_MULTIPLIER * BLOCKSIZE + csr_row_ptr[row] - idx_base;
+        I vec_end = min(csr_row_ptr[row + 1] - idx_base, vec_start + BLOCK_MULTIPLIER * BLOCKSIZE);
+
+        T row_val = alpha * static_cast<T>(rocsparse_ldg(x + row));
+
+        for(I j = vec_start + lid; j < vec_end; j += WG_SIZE)
+        {
+            T val = static_cast<T>(csr_val[j]);
+            val   = (trans == rocsparse_operation_conjugate_transpose) ? rocsparse_conj(val) : val;
+
+            atomicAdd(&y[csr_col_ind[j] - idx_base], row_val * val);
+        }
+    }
+}
+
+// Merge path search (Merrill and Garland, SC16). The merge path of the row end offsets
+// and the non-zero indices is intersected with the given diagonal. Returns the row
+// coordinate of the intersection, the non-zero coordinate is diag - row.
+template <typename I, typename J>
+static __device__ __forceinline__ J csrmv_merge_path_search(I                    diag,
+                                                            J                    row_begin,
+                                                            J                    row_end,
+                                                            I                    nnz,
+                                                            const I*             csr_row_ptr,
+                                                            rocsparse_index_base idx_base)
+{
+    J left  = max(static_cast<I>(row_begin), diag - nnz);
+    J right = min(static_cast<I>(row_end), diag);
+
+    while(left < right)
+    {
+        J mid = left + ((right - left) >> 1);
+
+        if(csr_row_ptr[mid + 1] - idx_base <= diag - mid - 1)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+
+    return left;
+}
+
+// Compute the merge path row coordinate of each tile boundary
+template <unsigned int BLOCKSIZE, unsigned int TILE_SIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_preprocess_kernel(J m,
+                                        I nnz,
+                                        I ntiles,
+                                        const I* __restrict__ csr_row_ptr,
+                                        J* __restrict__ merge_path,
+                                        rocsparse_index_base idx_base)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid > ntiles)
+    {
+        return;
+    }
+
+    I diag = min(gid * static_cast<I>(TILE_SIZE), static_cast<I>(m) + nnz);
+
+    merge_path[gid]
+        = csrmv_merge_path_search(diag, static_cast<J>(0), m, nnz, csr_row_ptr, idx_base);
+}
+
+// Add the carry-out of each tile to the row that continues into the next tile
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T>
+static __device__ void csrmvn_merge_fixup_device(J m,
+                                                 I ntiles,
+                                                 const J* __restrict__ merge_path,
+                                                 const T* __restrict__ merge_carry,
+                                                 T* __restrict__ y)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= ntiles)
+    {
+        return;
+    }
+
+    J row = merge_path[gid + 1];
+
+    if(row < m)
+    {
+        atomicAdd(&y[row], merge_carry[gid]);
+    }
+}
+
+// Merge path CSR SpMV. Each workgroup processes the same number of rows plus non-zeros,
+// such that the work is balanced independently of the row length distribution. Rows
+// that end within a tile are written directly, partial sums of rows that span multiple
+// threads are combined by a segmented scan and the partial sum of the row that continues
+// into the next tile is stored as carry-out of the tile.
+template <unsigned int BLOCKSIZE,
+          unsigned int ITEMS_PER_THREAD,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
+static __device__ void csrmvn_merge_device(J m,
+                                           I nnz,
+                                           const J* __restrict__ merge_path,
+                                           T alpha,
+                                           const I* __restrict__ csr_row_ptr,
+                                           const J* __restrict__ csr_col_ind,
+                                           const A* __restrict__ csr_val,
+                                           const X* __restrict__ x,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           T* __restrict__ merge_carry,
+                                           rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    I   bid = hipBlockIdx_x;
+
+    __shared__ J srow[BLOCKSIZE];
+    __shared__ T sval[BLOCKSIZE];
+
+    // Merge path coordinates of the tile
+    J tile_row_begin = merge_path[bid];
+    J tile_row_end   = merge_path[bid + 1];
+
+    I tile_size       = static_cast<I>(BLOCKSIZE * ITEMS_PER_THREAD);
+    I tile_diag_begin = bid * tile_size;
+    I tile_diag_end   = min(tile_diag_begin + tile_size, static_cast<I>(m) + nnz);
+
+    // Merge path coordinates of the thread
+    I diag     = min(tile_diag_begin + static_cast<I>(tid * ITEMS_PER_THREAD), tile_diag_end);
+    I diag_end = min(diag + static_cast<I>(ITEMS_PER_THREAD), tile_diag_end);
+
+    J row
+        = csrmv_merge_path_search(diag, tile_row_begin, tile_row_end, nnz, csr_row_ptr, idx_base);
+    I j   = diag - row;
+
+    I row_end = (row < m) ? csr_row_ptr[row + 1] - idx_base : nnz;
+
+    T sum = static_cast<T>(0);
+
+    for(I k = diag; k < diag_end; ++k)
+    {
+        if(j < row_end)
+        {
+            // Consume non-zero
+            sum = rocsparse_fma(static_cast<T>(csr_val[j]),
+                                static_cast<T>(rocsparse_ldg(x + csr_col_ind[j] - idx_base)),
+                                sum);
+            ++j;
+        }
+        else
+        {
+            // Consume row end
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = alpha * sum;
+            }
+            else
+            {
+                y[row] = rocsparse_fma(beta, y[row], alpha * sum);
+            }
+
+            sum = static_cast<T>(0);
+            ++row;
+
+            row_end = (row < m) ? csr_row_ptr[row + 1] - idx_base : nnz;
+        }
+    }
+
+    srow[tid] = row;
+    sval[tid] = sum;
+
+    __syncthreads();
+
+    // Segmented scan of the partial sums of each thread. Rows are non-decreasing
+    // across the threads of the tile.
+    for(unsigned int offset = 1; offset < BLOCKSIZE; offset <<= 1)
+    {
+        T val = static_cast<T>(0);
+
+        if(tid >= offset && srow[tid - offset] == row)
+        {
+            val = sval[tid - offset];
+        }
+
+        __syncthreads();
+
+        sval[tid] += val;
+
+        __syncthreads();
+    }
+
+    if(tid == BLOCKSIZE - 1)
+    {
+        // The row of the last thread continues into the next tile
+        merge_carry[bid] = alpha * sval[tid];
+    }
+    else if(row != srow[tid + 1])
+    {
+        // Last thread of a row that ends within the tile
+        y[row] = rocsparse_fma(alpha, sval[tid], y[row]);
+    }
+}
+
 #endif // CSRMV_DEVICE_H
@@ -504,4 +504,508 @@ __device__ void csrsv_device(rocsparse_int m,
     }
 }
 
+// Extracts the first row index of each level from the sorted (1-based) row levels
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_ptr_kernel(rocsparse_int m,
+                                const int* __restrict__ levels,
+                                rocsparse_int* __restrict__ level_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= m)
+    {
+        return;
+    }
+
+    int level = levels[gid];
+
+    // First row of a new level
+    if(gid == 0 || levels[gid - 1] != level)
+    {
+        level_ptr[level - 1] = gid;
+    }
+
+    // Last row closes the last level
+    if(gid == m - 1)
+    {
+        level_ptr[level] = m;
+    }
+}
+
+// Solves a single row with a wavefront. All dependencies of the row must have
+// been resolved before, e.g. by a previous level.
+template <unsigned int WF_SIZE, typename T>
+__device__ void csrsv_level_row_device(rocsparse_int row,
+                                       T             alpha,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const T* __restrict__ x,
+                                       T* __restrict__ y,
+                                       T* __restrict__ diagonal,
+                                       rocsparse_int* __restrict__ zero_pivot,
+                                       rocsparse_index_base idx_base,
+                                       rocsparse_fill_mode  fill_mode,
+                                       rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Local summation variable.
+    T local_sum = static_cast<T>(0);
+
+    if(lid == 0)
+    {
+        // Lane 0 initializes its local sum with alpha and x
+        local_sum = alpha * rocsparse_nontemporal_load(x + row);
+    }
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Ignore all entries outside of the triangular part
+        if((fill_mode == rocsparse_fill_mode_upper && local_col < row)
+           || (fill_mode == rocsparse_fill_mode_lower && local_col > row))
+        {
+            continue;
+        }
+
+        // Local value this lane operates with
+        T local_val = rocsparse_nontemporal_load(csr_val + j);
+
+        // Diagonal entry
+        if(local_col == row)
+        {
+            // If diagonal type is non unit, do division by diagonal entry
+            // This is not required for unit diagonal for obvious reasons
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                // Check for numerical zero
+                if(local_val == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    atomicMin(zero_pivot, row + idx_base);
+                    local_val = static_cast<T>(1);
+                }
+
+                *diagonal = static_cast<T>(1) / local_val;
+            }
+
+            continue;
+        }
+
+        // Local sum computation for each lane, the dependency has already been resolved
+        local_sum = rocsparse_fma(-local_val, y[local_col], local_sum);
+    }
+
+    // Gather all local sums for each lane
+    local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+    // If we have non unit diagonal, take the diagonal into account
+    // For unit diagonal, this would be multiplication with one
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        __threadfence_block();
+
+        local_sum = local_sum * (*diagonal);
+    }
+
+    if(lid == WF_SIZE - 1)
+    {
+        // Store the rows result in y
+        y[row] = local_sum;
+    }
+}
+
+// Solves all rows of a single level, one wavefront per row
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrsv_level_device(rocsparse_int nrows,
+                                   T             alpha,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   const T* __restrict__ csr_val,
+                                   const T* __restrict__ x,
+                                   T* __restrict__ y,
+                                   const rocsparse_int* __restrict__ map,
+                                   rocsparse_int offset,
+                                   rocsparse_int* __restrict__ zero_pivot,
+                                   rocsparse_index_base idx_base,
+                                   rocsparse_fill_mode  fill_mode,
+                                   rocsparse_diag_type  diag_type)
+{
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    // Do not run out of bounds
+    if(idx >= nrows)
+    {
+        return;
+    }
+
+    csrsv_level_row_device<WF_SIZE>(map[idx + offset],
+                                    alpha,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    csr_val,
+                                    x,
+                                    y,
+                                    &diagonal[wid],
+                                    zero_pivot,
+                                    idx_base,
+                                    fill_mode,
+                                    diag_type);
+}
+
+// Solves a group of consecutive (small) levels within a single block, levels
+// are separated by block-wide barriers instead of kernel launches
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrsv_level_group_device(rocsparse_int level_begin,
+                                         rocsparse_int level_end,
+                                         const rocsparse_int* __restrict__ level_ptr,
+                                         T alpha,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         const T* __restrict__ csr_val,
+                                         const T* __restrict__ x,
+                                         T* __restrict__ y,
+                                         const rocsparse_int* __restrict__ map,
+                                         rocsparse_int* __restrict__ zero_pivot,
+                                         rocsparse_index_base idx_base,
+                                         rocsparse_fill_mode  fill_mode,
+                                         rocsparse_diag_type  diag_type)
+{
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    for(rocsparse_int level = level_begin; level < level_end; ++level)
+    {
+        rocsparse_int level_end_idx = level_ptr[level + 1];
+
+        for(rocsparse_int idx = level_ptr[level] + wid; idx < level_end_idx;
+            idx += BLOCKSIZE / WF_SIZE)
+        {
+            csrsv_level_row_device<WF_SIZE>(map[idx],
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            y,
+                                            &diagonal[wid],
+                                            zero_pivot,
+                                            idx_base,
+                                            fill_mode,
+                                            diag_type);
+        }
+
+        // Results of this level need to be visible to the whole block
+        __threadfence_block();
+        __syncthreads();
+    }
+}
+
+// Analysis for transposed solves that operate on the non-transposed matrix. Counts the
+// strictly triangular entries of each column, which is the number of rows that push
+// their contribution into the corresponding row of the transposed system.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_push_analysis_kernel(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    rocsparse_int* __restrict__ csr_diag_ind,
+                                    int* __restrict__ col_nnz,
+                                    rocsparse_int* __restrict__ max_nnz,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode  fill_mode,
+                                    rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    // Row that the wavefront will process
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Initialize matrix diagonal index
+    if(lid == 0)
+    {
+        csr_diag_ind[row] = -1;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        if(local_col == row)
+        {
+            // Store diagonal index
+            csr_diag_ind[row] = j;
+        }
+        else if((fill_mode == rocsparse_fill_mode_lower && local_col < row)
+                || (fill_mode == rocsparse_fill_mode_upper && local_col > row))
+        {
+            // Row local_col of the transposed system depends on this row
+            atomicAdd(&col_nnz[local_col], 1);
+        }
+    }
+
+    if(lid == WF_SIZE - 1)
+    {
+        // Obtain maximum nnz
+        atomicMax(max_nnz, row_end - row_begin);
+
+        if(csr_diag_ind[row] == -1 && diag_type == rocsparse_diag_type_non_unit)
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+        }
+    }
+}
+
+// Transposed triangular solve on the non-transposed matrix. Each wavefront solves a
+// single row of the transposed system, once all contributions have been pushed into
+// its partial sum. Then, the solution is pushed into the partial sums of all
+// dependent rows, which are given by the (strictly triangular) row of the matrix.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP, typename T>
+__device__ void csrsv_push_device(rocsparse_int m,
+                                  T             alpha,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const T* __restrict__ csr_val,
+                                  const rocsparse_int* __restrict__ csr_diag_ind,
+                                  const T* __restrict__ x,
+                                  T* __restrict__ y,
+                                  T* __restrict__ partial_sum,
+                                  int* __restrict__ dep_count,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base,
+                                  rocsparse_fill_mode  fill_mode,
+                                  rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Solve order
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // The transposed lower triangular matrix is upper triangular and thus, solved
+    // from the last to the first row
+    rocsparse_int row = (fill_mode == rocsparse_fill_mode_lower) ? m - 1 - idx : idx;
+
+    // Spin loop until all dependencies have been resolved
+    int          local_count   = atomicOr(&dep_count[row], 0);
+    unsigned int times_through = 0;
+    while(local_count != 0)
+    {
+        if(SLEEP)
+        {
+            for(unsigned int i = 0; i < times_through; ++i)
+            {
+                __builtin_amdgcn_s_sleep(1);
+            }
+
+            if(times_through < 3907)
+            {
+                ++times_through;
+            }
+        }
+
+        local_count = atomicOr(&dep_count[row], 0);
+    }
+
+    // Wait for the partial sum to be visible globally
+    __threadfence();
+
+    T local_y = alpha * rocsparse_nontemporal_load(x + row) - partial_sum[row];
+
+    // If we have non unit diagonal, take the diagonal into account
+    // For unit diagonal, this would be multiplication with one
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        rocsparse_int diag = csr_diag_ind[row];
+
+        // Structural zero pivots have already been reported during analysis
+        T diagonal = (diag == -1) ? static_cast<T>(1) : csr_val[diag];
+
+        // Check for numerical zero
+        if(diagonal == static_cast<T>(0))
+        {
+            // Numerical zero pivot found, avoid division by 0
+            // and store index for later use.
+            if(lid == 0)
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            diagonal = static_cast<T>(1);
+        }
+
+        local_y = local_y * (static_cast<T>(1) / diagonal);
+    }
+
+    if(lid == 0)
+    {
+        // Store the rows result in y
+        rocsparse_nontemporal_store(local_y, &y[row]);
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Ignore the diagonal and all entries outside of the triangular part
+        if((fill_mode == rocsparse_fill_mode_lower && local_col >= row)
+           || (fill_mode == rocsparse_fill_mode_upper && local_col <= row))
+        {
+            continue;
+        }
+
+        // Push the contribution of this row
+        atomicAdd(&partial_sum[local_col], rocsparse_nontemporal_load(csr_val + j) * local_y);
+
+        // Make sure the contribution is visible globally before resolving the dependency
+        __threadfence();
+
+        atomicSub(&dep_count[local_col], 1);
+    }
+}
+
+// One Jacobi sweep of the approximate triangular solve, one wavefront per row.
+// y_new = D^-1 (alpha * x - (L - D) * y_old) for lower and accordingly for upper fill mode.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrsv_jacobi_device(rocsparse_int m,
+                                    T             alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const T* __restrict__ csr_val,
+                                    const T* __restrict__ x,
+                                    const T* __restrict__ y_old,
+                                    T* __restrict__ y_new,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode  fill_mode,
+                                    rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Row this wavefront operates on
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Shared memory to hold diagonal entry
+    __shared__ T diagonal[BLOCKSIZE / WF_SIZE];
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Local summation variable.
+    T local_sum = static_cast<T>(0);
+
+    if(lid == 0)
+    {
+        // Lane 0 initializes its local sum with alpha and x
+        local_sum = alpha * x[row];
+
+        // A missing diagonal entry has been reported by the analysis already
+        diagonal[wid] = static_cast<T>(1);
+    }
+
+    __threadfence_block();
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Ignore all entries outside of the triangular part
+        if((fill_mode == rocsparse_fill_mode_upper && local_col < row)
+           || (fill_mode == rocsparse_fill_mode_lower && local_col > row))
+        {
+            continue;
+        }
+
+        // Local value this lane operates with
+        T local_val = csr_val[j];
+
+        // Diagonal entry
+        if(local_col == row)
+        {
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                // Check for numerical zero
+                if(local_val == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    atomicMin(zero_pivot, row + idx_base);
+                    local_val = static_cast<T>(1);
+                }
+
+                diagonal[wid] = static_cast<T>(1) / local_val;
+            }
+
+            continue;
+        }
+
+        // All off-diagonal entries use the previous iterate
+        local_sum = rocsparse_fma(-local_val, y_old[local_col], local_sum);
+    }
+
+    // Gather all local sums for each lane
+    local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+    // If we have non unit diagonal, take the diagonal into account
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        __threadfence_block();
+
+        local_sum = local_sum * diagonal[wid];
+    }
+
+    if(lid == WF_SIZE - 1)
+    {
+        // Store the rows result in the next iterate
+        y_new[row] = local_sum;
+    }
+}
+
 #endif // CSRSV_DEVICE_H
@@ -412,6 +412,29 @@ rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,
     }
 }
 
+#define INSTANTIATE(TTYPE)                                                                    \
+    template rocsparse_status rocsparse_bsrmv_template(rocsparse_handle          handle,      \
+                                                       rocsparse_direction       dir,         \
+                                                       rocsparse_operation       trans,       \
+                                                       rocsparse_int             mb,          \
+                                                       rocsparse_int             nb,          \
+                                                       rocsparse_int             nnzb,        \
+                                                       const TTYPE*              alpha,       \
+                                                       const rocsparse_mat_descr descr,       \
+                                                       const TTYPE*              bsr_val,     \
+                                                       const rocsparse_int*      bsr_row_ptr, \
+                                                       const rocsparse_int*      bsr_col_ind, \
+                                                       rocsparse_int             block_dim,   \
+                                                       const TTYPE*              x,           \
+                                                       const TTYPE*              beta,        \
+                                                       TTYPE*                    y);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -193,7 +193,8 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
             bsr_col_ind,
             (trans == rocsparse_operation_none) ? info->bsrsv_upper_info : info->bsrsvt_upper_info,
             &info->zero_pivot,
-            temp_buffer));
+            temp_buffer,
+            false));
     }
     else
     {
@@ -260,7 +261,8 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
             bsr_col_ind,
             (trans == rocsparse_operation_none) ? info->bsrsv_lower_info : info->bsrsvt_lower_info,
             &info->zero_pivot,
-            temp_buffer));
+            temp_buffer,
+            false));
     }
 
     return rocsparse_status_success;
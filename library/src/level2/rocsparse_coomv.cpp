@@ -66,6 +66,26 @@ __launch_bounds__(BLOCKSIZE) __global__ void coomvn_wf(I nnz,
                                                  idx_base);
 }
 
+template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void coomvt_kernel(rocsparse_operation trans,
+                                                           I                   nnz,
+                                                           I                   ind_inc,
+                                                           U                   alpha_device_host,
+                                                           const I* __restrict__ coo_row_ind,
+                                                           const I* __restrict__ coo_col_ind,
+                                                           const T* __restrict__ coo_val,
+                                                           const T* __restrict__ x,
+                                                           T* __restrict__ y,
+                                                           rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        coomvt_device<BLOCKSIZE>(
+            trans, nnz, ind_inc, alpha, coo_row_ind, coo_col_ind, coo_val, x, y, idx_base);
+    }
+}
+
 template <typename I, typename T, typename U>
 rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -200,8 +220,59 @@ rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            // Scale y with beta
+            hipLaunchKernelGGL((coomv_scale<1024>),
+                               dim3((n - 1) / 1024 + 1),
+                               dim3(1024),
+                               0,
+                               handle->stream,
+                               n,
+                               beta_device_host,
+                               y);
+        }
+        else
+        {
+            auto beta = load_scalar_device_host(beta_device_host);
+            // If beta == 0.0 we need to set y to 0
+            if(beta == static_cast<T>(0))
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * n, handle->stream));
+            }
+            else if(beta != static_cast<T>(1))
+            {
+                hipLaunchKernelGGL((coomv_scale<1024>),
+                                   dim3((n - 1) / 1024 + 1),
+                                   dim3(1024),
+                                   0,
+                                   handle->stream,
+                                   n,
+                                   beta,
+                                   y);
+            }
+        }
+
+        if(nnz > 0)
+        {
+#define COOMVT_DIM 256
+            hipLaunchKernelGGL((coomvt_kernel<COOMVT_DIM>),
+                               dim3((nnz - 1) / COOMVT_DIM + 1),
+                               dim3(COOMVT_DIM),
+                               0,
+                               stream,
+                               trans,
+                               nnz,
+                               static_cast<I>(1),
+                               alpha_device_host,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base);
+#undef COOMVT_DIM
+        }
     }
     return rocsparse_status_success;
 }
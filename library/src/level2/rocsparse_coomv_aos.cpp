@@ -56,6 +56,26 @@ __launch_bounds__(BLOCKSIZE) __global__ void coomvn_aos_wf(I nnz,
         nnz, loops, alpha, coo_ind, coo_val, x, y, row_block_red, val_block_red, idx_base);
 }
 
+template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void coomvt_kernel(rocsparse_operation trans,
+                                                           I                   nnz,
+                                                           I                   ind_inc,
+                                                           U                   alpha_device_host,
+                                                           const I* __restrict__ coo_row_ind,
+                                                           const I* __restrict__ coo_col_ind,
+                                                           const T* __restrict__ coo_val,
+                                                           const T* __restrict__ x,
+                                                           T* __restrict__ y,
+                                                           rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        coomvt_device<BLOCKSIZE>(
+            trans, nnz, ind_inc, alpha, coo_row_ind, coo_col_ind, coo_val, x, y, idx_base);
+    }
+}
+
 template <typename I, typename T, typename U>
 rocsparse_status rocsparse_coomv_aos_dispatch(rocsparse_handle          handle,
                                               rocsparse_operation       trans,
@@ -153,8 +173,26 @@ rocsparse_status rocsparse_coomv_aos_dispatch(rocsparse_handle          handle,
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        if(nnz > 0)
+        {
+#define COOMVT_DIM 256
+            hipLaunchKernelGGL((coomvt_kernel<COOMVT_DIM>),
+                               dim3((nnz - 1) / COOMVT_DIM + 1),
+                               dim3(COOMVT_DIM),
+                               0,
+                               stream,
+                               trans,
+                               nnz,
+                               static_cast<I>(2),
+                               alpha_device_host,
+                               coo_ind,
+                               coo_ind + 1,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base);
+#undef COOMVT_DIM
+        }
     }
     return rocsparse_status_success;
 }
@@ -251,15 +289,18 @@ rocsparse_status rocsparse_coomv_aos_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Size of y
+    I ysize = (trans == rocsparse_operation_none) ? m : n;
+
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         // Scale y with beta
         hipLaunchKernelGGL((coomv_scale<1024>),
-                           dim3((m - 1) / 1024 + 1),
+                           dim3((ysize - 1) / 1024 + 1),
                            dim3(1024),
                            0,
                            handle->stream,
-                           m,
+                           ysize,
                            beta_device_host,
                            y);
 
@@ -282,16 +323,16 @@ rocsparse_status rocsparse_coomv_aos_template(rocsparse_handle          handle,
         // If beta == 0.0 we need to set y to 0
         if(*beta_device_host == static_cast<T>(0))
         {
-            RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * m, handle->stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * ysize, handle->stream));
         }
         else if(*beta_device_host != static_cast<T>(1))
         {
             hipLaunchKernelGGL((coomv_scale<1024>),
-                               dim3((m - 1) / 1024 + 1),
+                               dim3((ysize - 1) / 1024 + 1),
                                dim3(1024),
                                0,
                                handle->stream,
-                               m,
+                               ysize,
                                *beta_device_host,
                                y);
         }
@@ -28,265 +28,17 @@
 
 #include "csrmv_device.h"
 
+#include <rocprim/rocprim.hpp>
+
 #define BLOCK_SIZE 1024
 #define BLOCK_MULTIPLIER 3
 #define ROWS_FOR_VECTOR 1
 #define WG_SIZE 256
 
-__attribute__((unused)) static unsigned int flp2(unsigned int x)
-{
-    x |= (x >> 1);
-    x |= (x >> 2);
-    x |= (x >> 4);
-    x |= (x >> 8);
-    x |= (x >> 16);
-    return x - (x >> 1);
-}
-
-// Short rows in CSR-Adaptive are batched together into a single row block.
-// If there are a relatively small number of these, then we choose to do
-// a horizontal reduction (groups of threads all reduce the same row).
-// If there are many threads (e.g. more threads than the maximum size
-// of our workgroup) then we choose to have each thread serially reduce
-// the row.
-// This function calculates the number of threads that could team up
-// to reduce these groups of rows. For instance, if you have a
-// workgroup size of 256 and 4 rows, you could have 64 threads
-// working on each row. If you have 5 rows, only 32 threads could
-// reliably work on each row because our reduction assumes power-of-2.
-static unsigned long long numThreadsForReduction(unsigned long long num_rows)
-{
-#if defined(__INTEL_COMPILER)
-    return WG_SIZE >> (_bit_scan_reverse(num_rows - 1) + 1);
-#elif(defined(__clang__) && __has_builtin(__builtin_clz)) \
-    || !defined(__clang) && defined(__GNUG__)             \
-           && ((__GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__) > 30202)
-    return (WG_SIZE >> (8 * sizeof(int) - __builtin_clz(num_rows - 1)));
-#elif defined(_MSC_VER) && (_MSC_VER >= 1400)
-    unsigned long long bit_returned;
-    _BitScanReverse(&bit_returned, (num_rows - 1));
-    return WG_SIZE >> (bit_returned + 1);
-#else
-    return flp2(WG_SIZE / num_rows);
-#endif
-}
-
-template <typename I, typename J>
-static inline void ComputeRowBlocks(I*       rowBlocks,
-                                    J*       wgIds,
-                                    size_t&  rowBlockSize,
-                                    const I* rowDelimiters,
-                                    I        nRows,
-                                    bool     allocate_row_blocks = true)
-{
-    I* rowBlocksBase;
-
-    // Start at one because of rowBlock[0]
-    I total_row_blocks = 1;
-
-    if(allocate_row_blocks)
-    {
-        rowBlocksBase = rowBlocks;
-        *rowBlocks    = 0;
-        *wgIds        = 0;
-        ++rowBlocks;
-        ++wgIds;
-    }
-
-    I sum = 0;
-    I i;
-    I last_i = 0;
-
-    I consecutive_long_rows = 0;
-    for(i = 1; i <= nRows; ++i)
-    {
-        I row_length = (rowDelimiters[i] - rowDelimiters[i - 1]);
-        sum += row_length;
-
-        // The following section of code calculates whether you're moving between
-        // a series of "short" rows and a series of "long" rows.
-        // This is because the reduction in CSR-Adaptive likes things to be
-        // roughly the same length. Long rows can be reduced horizontally.
-        // Short rows can be reduced one-thread-per-row. Try not to mix them.
-        if(row_length > 128)
-        {
-            ++consecutive_long_rows;
-        }
-        else if(consecutive_long_rows > 0)
-        {
-            // If it turns out we WERE in a long-row region, cut if off now.
-            if(row_length < 32) // Now we're in a short-row region
-            {
-                consecutive_long_rows = -1;
-            }
-            else
-            {
-                consecutive_long_rows++;
-            }
-        }
-
-        // If you just entered into a "long" row from a series of short rows,
-        // then we need to make sure we cut off those short rows. Put them in
-        // their own workgroup.
-        if(consecutive_long_rows == 1)
-        {
-            // Assuming there *was* a previous workgroup. If not, nothing to do here.
-            if(i - last_i > 1)
-            {
-                if(allocate_row_blocks)
-                {
-                    *rowBlocks = i - 1;
-
-                    // If this row fits into CSR-Stream, calculate how many rows
-                    // can be used to do a parallel reduction.
-                    // Fill in the low-order bits with the numThreadsForRed
-                    if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                    {
-                        *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                    }
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                ++total_row_blocks;
-                last_i = i - 1;
-                sum    = row_length;
-            }
-        }
-        else if(consecutive_long_rows == -1)
-        {
-            // We see the first short row after some long ones that
-            // didn't previously fill up a row block.
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i - 1;
-                if(((i - 1) - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction((i - 1) - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            ++total_row_blocks;
-            last_i                = i - 1;
-            sum                   = row_length;
-            consecutive_long_rows = 0;
-        }
-
-        // Now, what's up with this row? What did it do?
-
-        // exactly one row results in non-zero elements to be greater than blockSize
-        // This is csr-vector case;
-        if((i - last_i == 1) && sum > static_cast<I>(BLOCK_SIZE))
-        {
-            I numWGReq = static_cast<I>(
-                std::ceil(static_cast<double>(row_length) / (BLOCK_MULTIPLIER * BLOCK_SIZE)));
-
-            // Check to ensure #workgroups can fit in 32 bits, if not
-            // then the last workgroup will do all the remaining work
-            // Note: Maximum number of workgroups is 2^31-1 = 2147483647
-            numWGReq = (numWGReq < static_cast<I>(std::pow(2, 31) - 1))
-                           ? numWGReq
-                           : static_cast<I>(std::pow(2, 31) - 1);
-
-            if(allocate_row_blocks)
-            {
-                for(I w = 1; w < numWGReq; ++w)
-                {
-                    *rowBlocks = (i - 1);
-                    *wgIds |= static_cast<J>(w);
-
-                    ++rowBlocks;
-                    ++wgIds;
-                }
-
-                *rowBlocks = i;
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            total_row_blocks += numWGReq;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // more than one row results in non-zero elements to be greater than blockSize
-        // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if((i - last_i > 1) && sum > static_cast<I>(BLOCK_SIZE))
-        {
-            // This row won't fit, so back off one.
-            --i;
-
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-        // This is csr-stream case; wgIds holds number of parallel reduction threads
-        else if(sum == static_cast<I>(BLOCK_SIZE))
-        {
-            if(allocate_row_blocks)
-            {
-                *rowBlocks = i;
-                if((i - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-                {
-                    *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-                }
-
-                ++rowBlocks;
-                ++wgIds;
-            }
-
-            ++total_row_blocks;
-            last_i                = i;
-            sum                   = 0;
-            consecutive_long_rows = 0;
-        }
-    }
-
-    // If we didn't fill a row block with the last row, make sure we don't lose it.
-    if(allocate_row_blocks && *(rowBlocks - 1) != nRows)
-    {
-        *rowBlocks = nRows;
-        if((nRows - last_i) > static_cast<I>(ROWS_FOR_VECTOR))
-        {
-            *(wgIds - 1) |= numThreadsForReduction(i - last_i);
-        }
-
-        ++rowBlocks;
-        ++wgIds;
-    }
-
-    ++total_row_blocks;
+#define CSRMV_PREPROCESS_DIM 1024
 
-    if(allocate_row_blocks)
-    {
-        size_t dist = std::distance(rowBlocksBase, rowBlocks);
-
-        assert((dist) <= rowBlockSize);
-        // Update the size of rowBlocks to reflect the actual amount of memory used
-        rowBlockSize = dist;
-    }
-    else
-    {
-        rowBlockSize = total_row_blocks;
-    }
-}
+#define CSRMV_MERGE_DIM 256
+#define CSRMV_MERGE_ITEMS_PER_THREAD 8
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          handle,
@@ -332,8 +84,8 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_value;
     }
 
-    // Check index base
-    if(descr->type != rocsparse_matrix_type_general)
+    // Check matrix type
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -345,6 +97,12 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices need to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -357,6 +115,12 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Symmetric and Hermitian matrices do not make use of row blocks
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_success;
+    }
+
     // Clear csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
 
@@ -366,59 +130,127 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     // Stream
     hipStream_t stream = handle->stream;
 
-    // row blocks size
-    info->csrmv_info->size = 0;
-
-    // Temporary arrays to hold device data
-    std::vector<I> hptr(m + 1);
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        hptr.data(), csr_row_ptr, sizeof(I) * (m + 1), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
-    // Determine row blocks array size
-    ComputeRowBlocks<I, J>((I*)NULL, (J*)NULL, info->csrmv_info->size, hptr.data(), m, false);
-
-    // Create row blocks, workgroup flag, and workgroup data structures
-    std::vector<I>            row_blocks(info->csrmv_info->size, 0);
-    std::vector<unsigned int> wg_flags(info->csrmv_info->size, 0);
-    std::vector<J>            wg_ids(info->csrmv_info->size, 0);
-
-    ComputeRowBlocks<I, J>(
-        row_blocks.data(), wg_ids.data(), info->csrmv_info->size, hptr.data(), m, true);
-
-    // Allocate memory on device to hold csrmv info, if required
-    if(info->csrmv_info->size > 0)
-    {
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&info->csrmv_info->row_blocks, sizeof(I) * info->csrmv_info->size));
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->wg_flags,
-                                      sizeof(unsigned int) * info->csrmv_info->size));
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&info->csrmv_info->wg_ids, sizeof(J) * info->csrmv_info->size));
-
-        // Copy row blocks information to device
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->row_blocks,
-                                           row_blocks.data(),
-                                           sizeof(I) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->wg_flags,
-                                           wg_flags.data(),
-                                           sizeof(unsigned int) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->csrmv_info->wg_ids,
-                                           wg_ids.data(),
-                                           sizeof(J) * info->csrmv_info->size,
-                                           hipMemcpyHostToDevice,
-                                           stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Upper bound for the number of row blocks. Each row block either starts a new
+    // chunk of BLOCK_SIZE / 2 non-zeros, is or follows an isolated row with more than
+    // BLOCK_SIZE / 2 entries, or is an additional workgroup of a long row.
+    I nchunks = nnz / (BLOCK_SIZE / 2);
+    I nlong   = nnz / (BLOCK_MULTIPLIER * BLOCK_SIZE);
+
+    info->csrmv_info->size = std::min(static_cast<I>(m), 3 * nchunks + 2) + nlong + 1;
+
+    // Allocate memory on device to hold csrmv info
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csrmv_info->row_blocks, sizeof(I) * info->csrmv_info->size));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->wg_flags,
+                                  sizeof(unsigned int) * info->csrmv_info->size));
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csrmv_info->wg_ids, sizeof(J) * info->csrmv_info->size));
+
+    I* row_blocks = reinterpret_cast<I*>(info->csrmv_info->row_blocks);
+    J* wg_ids     = reinterpret_cast<J*>(info->csrmv_info->wg_ids);
+
+    // Number of row tiles
+    J ntiles = (m - 1) / CSRMV_PREPROCESS_DIM + 1;
+
+    // Temporary storage for the row block offsets of each tile
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                (I*)nullptr,
+                                                (I*)nullptr,
+                                                static_cast<I>(0),
+                                                ntiles + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+
+    size_t tile_ptr_size   = ((sizeof(I) * (ntiles + 1) - 1) / 256 + 1) * 256;
+    size_t temp_storage_sz = tile_ptr_size + rocprim_size;
+
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= temp_storage_sz)
+    {
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_sz));
+        temp_alloc = true;
+    }
+
+    I*    tile_ptr       = reinterpret_cast<I*>(temp_storage_ptr);
+    void* rocprim_buffer = reinterpret_cast<char*>(temp_storage_ptr) + tile_ptr_size;
+
+    // Initialize row blocks. All entries that are not written below point to the last row.
+    hipLaunchKernelGGL((csrmvn_preprocess_init_kernel<CSRMV_PREPROCESS_DIM>),
+                       dim3((info->csrmv_info->size - 1) / CSRMV_PREPROCESS_DIM + 1),
+                       dim3(CSRMV_PREPROCESS_DIM),
+                       0,
+                       stream,
+                       m,
+                       info->csrmv_info->size,
+                       row_blocks,
+                       info->csrmv_info->wg_flags,
+                       wg_ids);
+
+    // Count row block entries per tile
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(tile_ptr + ntiles, 0, sizeof(I), stream));
+
+    hipLaunchKernelGGL(
+        (csrmvn_preprocess_count_kernel<CSRMV_PREPROCESS_DIM, BLOCK_SIZE, BLOCK_MULTIPLIER>),
+        dim3(ntiles),
+        dim3(CSRMV_PREPROCESS_DIM),
+        0,
+        stream,
+        m,
+        csr_row_ptr,
+        tile_ptr,
+        descr->base);
+
+    // Exclusive sum to obtain the tile offsets into the row blocks array
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                tile_ptr,
+                                                tile_ptr,
+                                                static_cast<I>(0),
+                                                ntiles + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+
+    // Fill row blocks and workgroup ids
+    hipLaunchKernelGGL(
+        (csrmvn_preprocess_fill_kernel<CSRMV_PREPROCESS_DIM, BLOCK_SIZE, BLOCK_MULTIPLIER>),
+        dim3(ntiles),
+        dim3(CSRMV_PREPROCESS_DIM),
+        0,
+        stream,
+        m,
+        csr_row_ptr,
+        tile_ptr,
+        row_blocks,
+        wg_ids,
+        descr->base);
+
+    // Number of threads used for the CSR-Stream reduction of each row block
+    hipLaunchKernelGGL(
+        (csrmvn_preprocess_reduction_kernel<CSRMV_PREPROCESS_DIM, WG_SIZE, ROWS_FOR_VECTOR>),
+        dim3((info->csrmv_info->size - 2) / CSRMV_PREPROCESS_DIM + 1),
+        dim3(CSRMV_PREPROCESS_DIM),
+        0,
+        stream,
+        info->csrmv_info->size - 1,
+        row_blocks,
+        wg_ids);
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
     }
 
+    info->csrmv_info->row_blocks_type_size = sizeof(I);
+    info->csrmv_info->wg_ids_type_size     = sizeof(J);
+
     // Store some pointers to verify correct execution
     info->csrmv_info->trans       = trans;
     info->csrmv_info->m           = m;
@@ -431,19 +263,138 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
     return rocsparse_status_success;
 }
 
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_merge_analysis_template(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans,
+                                                         J                         m,
+                                                         J                         n,
+                                                         I                         nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const I*                  csr_row_ptr,
+                                                         const J*                  csr_col_ind,
+                                                         rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type == rocsparse_matrix_type_triangular)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Symmetric and Hermitian matrices need to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || csr_col_ind == nullptr || csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The merge path is only used for the non-transposed product of general matrices
+    if(trans != rocsparse_operation_none || descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Create csrmv info, if not already available from the adaptive analysis
+    if(info->csrmv_info == nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
+    }
+
+    rocsparse_csrmv_info csrmv_info = info->csrmv_info;
+
+    // Clear previous merge path
+    if(csrmv_info->merge_size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(csrmv_info->merge_path));
+        RETURN_IF_HIP_ERROR(hipFree(csrmv_info->merge_carry));
+
+        csrmv_info->merge_size  = 0;
+        csrmv_info->merge_path  = nullptr;
+        csrmv_info->merge_carry = nullptr;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of tiles, each tile holds the same number of rows plus non-zeros
+    I tile_size = CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS_PER_THREAD;
+    I ntiles    = (static_cast<I>(m) + nnz - 1) / tile_size + 1;
+
+    RETURN_IF_HIP_ERROR(hipMalloc(&csrmv_info->merge_path, sizeof(J) * (ntiles + 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc(&csrmv_info->merge_carry, sizeof(T) * ntiles));
+
+    csrmv_info->merge_size = ntiles;
+
+    // Merge path coordinates of the tile boundaries
+    hipLaunchKernelGGL(
+        (csrmvn_merge_preprocess_kernel<CSRMV_PREPROCESS_DIM,
+                                        CSRMV_MERGE_DIM * CSRMV_MERGE_ITEMS_PER_THREAD>),
+        dim3(ntiles / CSRMV_PREPROCESS_DIM + 1),
+        dim3(CSRMV_PREPROCESS_DIM),
+        0,
+        stream,
+        m,
+        nnz,
+        ntiles,
+        csr_row_ptr,
+        static_cast<J*>(csrmv_info->merge_path),
+        descr->base);
+
+    return rocsparse_status_success;
+}
+
 template <unsigned int BLOCKSIZE,
           unsigned int WF_SIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmvn_general_kernel(J m,
                                U alpha_device_host,
                                const I* __restrict__ csr_row_ptr,
                                const J* __restrict__ csr_col_ind,
-                               const T* __restrict__ csr_val,
-                               const T* __restrict__ x,
+                               const A* __restrict__ csr_val,
+                               const X* __restrict__ x,
                                U beta_device_host,
                                T* __restrict__ y,
                                rocsparse_index_base idx_base)
@@ -457,7 +408,7 @@ __launch_bounds__(BLOCKSIZE) __global__
     }
 }
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel(const I* __restrict__ row_blocks,
                                 unsigned int* __restrict__ wg_flags,
@@ -465,8 +416,8 @@ __launch_bounds__(WG_SIZE) __global__
                                 U alpha_device_host,
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
-                                const T* __restrict__ csr_val,
-                                const T* __restrict__ x,
+                                const A* __restrict__ csr_val,
+                                const X* __restrict__ x,
                                 U beta_device_host,
                                 T* __restrict__ y,
                                 rocsparse_index_base idx_base)
@@ -489,7 +440,229 @@ __launch_bounds__(WG_SIZE) __global__
     }
 }
 
-template <typename I, typename J, typename T, typename U>
+template <unsigned int BLOCKSIZE,
+          unsigned int ITEMS_PER_THREAD,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_kernel(J m,
+                             I nnz,
+                             const J* __restrict__ merge_path,
+                             U alpha_device_host,
+                             const I* __restrict__ csr_row_ptr,
+                             const J* __restrict__ csr_col_ind,
+                             const A* __restrict__ csr_val,
+                             const X* __restrict__ x,
+                             U beta_device_host,
+                             T* __restrict__ y,
+                             T* __restrict__ merge_carry,
+                             rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_merge_device<BLOCKSIZE, ITEMS_PER_THREAD>(m,
+                                                         nnz,
+                                                         merge_path,
+                                                         alpha,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         csr_val,
+                                                         x,
+                                                         beta,
+                                                         y,
+                                                         merge_carry,
+                                                         idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_merge_fixup_kernel(J m,
+                                   I ntiles,
+                                   const J* __restrict__ merge_path,
+                                   const T* __restrict__ merge_carry,
+                                   U alpha_device_host,
+                                   U beta_device_host,
+                                   T* __restrict__ y)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvn_merge_fixup_device<BLOCKSIZE>(m, ntiles, merge_path, merge_carry, y);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmv_scale(I size, U beta_device_host, T* __restrict__ data)
+{
+    auto beta = load_scalar_device_host(beta_device_host);
+    if(beta != static_cast<T>(1))
+    {
+        csrmv_scale_device(size, beta, data);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvt_general_kernel(rocsparse_operation trans,
+                               J                   m,
+                               U                   alpha_device_host,
+                               const I* __restrict__ csr_row_ptr,
+                               const J* __restrict__ csr_col_ind,
+                               const A* __restrict__ csr_val,
+                               const X* __restrict__ x,
+                               T* __restrict__ y,
+                               rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvt_general_device<BLOCKSIZE, WF_SIZE>(
+            trans, m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+    }
+}
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvt_adaptive_kernel(rocsparse_operation trans,
+                                const I* __restrict__ row_blocks,
+                                const J* __restrict__ wg_ids,
+                                U alpha_device_host,
+                                const I* __restrict__ csr_row_ptr,
+                                const J* __restrict__ csr_col_ind,
+                                const A* __restrict__ csr_val,
+                                const X* __restrict__ x,
+                                T* __restrict__ y,
+                                rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmvt_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, WG_SIZE>(trans,
+                                                                      row_blocks,
+                                                                      wg_ids,
+                                                                      alpha,
+                                                                      csr_row_ptr,
+                                                                      csr_col_ind,
+                                                                      csr_val,
+                                                                      x,
+                                                                      y,
+                                                                      idx_base);
+    }
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmv_symm_general_kernel(bool                conj_direct,
+                                   bool                conj_mirror,
+                                   rocsparse_fill_mode fill_mode,
+                                   J                   m,
+                                   U                   alpha_device_host,
+                                   const I* __restrict__ csr_row_ptr,
+                                   const J* __restrict__ csr_col_ind,
+                                   const A* __restrict__ csr_val,
+                                   const X* __restrict__ x,
+                                   T* __restrict__ y,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    if(alpha != static_cast<T>(0))
+    {
+        csrmv_symm_general_device<BLOCKSIZE, WF_SIZE>(conj_direct,
+                                                      conj_mirror,
+                                                      fill_mode,
+                                                      m,
+                                                      alpha,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      csr_val,
+                                                      x,
+                                                      y,
+                                                      idx_base);
+    }
+}
+
+template <typename I, typename T, typename U>
+static rocsparse_status rocsparse_csrmvt_scale(rocsparse_handle handle,
+                                               I                n,
+                                               U                beta_device_host,
+                                               T*               y)
+{
+    // Scale y with beta
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmv_scale<1024>),
+                           dim3((n - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           handle->stream,
+                           n,
+                           beta_device_host,
+                           y);
+    }
+    else
+    {
+        auto beta = load_scalar_device_host(beta_device_host);
+        // If beta == 0.0 we need to set y to 0
+        if(beta == static_cast<T>(0))
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * n, handle->stream));
+        }
+        else if(beta != static_cast<T>(1))
+        {
+            hipLaunchKernelGGL((csrmv_scale<1024>),
+                               dim3((n - 1) / 1024 + 1),
+                               dim3(1024),
+                               0,
+                               handle->stream,
+                               n,
+                               beta,
+                               y);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, WF_SIZE)            \
+    hipLaunchKernelGGL((csrmvt_general_kernel<CSRMVT_DIM, WF_SIZE>), \
+                       dim3((m - 1) / (CSRMVT_DIM / WF_SIZE) + 1),   \
+                       dim3(CSRMVT_DIM),                             \
+                       0,                                            \
+                       stream,                                       \
+                       trans,                                        \
+                       m,                                            \
+                       alpha_device_host,                            \
+                       csr_row_ptr,                                  \
+                       csr_col_ind,                                  \
+                       csr_val,                                      \
+                       x,                                            \
+                       y,                                            \
+                       descr->base);
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
                                                    J                         m,
@@ -497,10 +670,10 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                                    I                         nnz,
                                                    U                         alpha_device_host,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const A*                  csr_val,
                                                    const I*                  csr_row_ptr,
                                                    const J*                  csr_col_ind,
-                                                   const T*                  x,
+                                                   const X*                  x,
                                                    U                         beta_device_host,
                                                    T*                        y)
 {
@@ -717,13 +890,116 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Scale y with beta
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmvt_scale(handle, n, beta_device_host, y));
+
+        // Scatter alpha * op(A) * x into y
+#define CSRMVT_DIM 256
+        J nnz_per_row = nnz / m;
+
+        if(nnz_per_row < 4)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 4);
+        }
+        else if(nnz_per_row < 8)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 8);
+        }
+        else if(nnz_per_row < 16)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 16);
+        }
+        else if(nnz_per_row < 32 || handle->wavefront_size == 32)
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 32);
+        }
+        else
+        {
+            LAUNCH_CSRMVT_GENERAL_KERNEL(CSRMVT_DIM, 64);
+        }
+#undef CSRMVT_DIM
     }
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T, typename U>
+#define LAUNCH_CSRMV_SYMM_GENERAL_KERNEL(CSRMV_SYMM_DIM, WF_SIZE)            \
+    hipLaunchKernelGGL((csrmv_symm_general_kernel<CSRMV_SYMM_DIM, WF_SIZE>), \
+                       dim3((m - 1) / (CSRMV_SYMM_DIM / WF_SIZE) + 1),       \
+                       dim3(CSRMV_SYMM_DIM),                                 \
+                       0,                                                    \
+                       stream,                                               \
+                       conj_direct,                                          \
+                       conj_mirror,                                          \
+                       descr->fill_mode,                                     \
+                       m,                                                    \
+                       alpha_device_host,                                    \
+                       csr_row_ptr,                                          \
+                       csr_col_ind,                                          \
+                       csr_val,                                              \
+                       x,                                                    \
+                       y,                                                    \
+                       descr->base);
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+rocsparse_status rocsparse_csrmv_symm_template_dispatch(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        J                         m,
+                                                        J                         n,
+                                                        I                         nnz,
+                                                        U                         alpha_device_host,
+                                                        const rocsparse_mat_descr descr,
+                                                        const A*                  csr_val,
+                                                        const I*                  csr_row_ptr,
+                                                        const J*                  csr_col_ind,
+                                                        const X*                  x,
+                                                        U                         beta_device_host,
+                                                        T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // A symmetric matrix equals its transpose and a Hermitian matrix equals its conjugate
+    // transpose. Depending on the operation, the stored triangle (direct) and the mirrored
+    // triangle that is not stored thus need to be conjugated.
+    bool symmetric   = (descr->type == rocsparse_matrix_type_symmetric);
+    bool conj_direct = symmetric ? (trans == rocsparse_operation_conjugate_transpose)
+                                 : (trans == rocsparse_operation_transpose);
+    bool conj_mirror = symmetric ? (trans == rocsparse_operation_conjugate_transpose)
+                                 : (trans != rocsparse_operation_transpose);
+
+    // Scale y with beta
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmvt_scale(handle, m, beta_device_host, y));
+
+    // Gather the stored triangle and scatter the mirrored triangle into y
+#define CSRMV_SYMM_DIM 256
+    J nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMV_SYMM_GENERAL_KERNEL(CSRMV_SYMM_DIM, 4);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMV_SYMM_GENERAL_KERNEL(CSRMV_SYMM_DIM, 8);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMV_SYMM_GENERAL_KERNEL(CSRMV_SYMM_DIM, 16);
+    }
+    else if(nnz_per_row < 32 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMV_SYMM_GENERAL_KERNEL(CSRMV_SYMM_DIM, 32);
+    }
+    else
+    {
+        LAUNCH_CSRMV_SYMM_GENERAL_KERNEL(CSRMV_SYMM_DIM, 64);
+    }
+#undef CSRMV_SYMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle    handle,
                                                             rocsparse_operation trans,
                                                             J                   m,
@@ -731,11 +1007,11 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
                                                             I                   nnz,
                                                             U                   alpha_device_host,
                                                             const rocsparse_mat_descr descr,
-                                                            const T*                  csr_val,
+                                                            const A*                  csr_val,
                                                             const I*                  csr_row_ptr,
                                                             const J*                  csr_col_ind,
                                                             rocsparse_csrmv_info      info,
-                                                            const T*                  x,
+                                                            const X*                  x,
                                                             U  beta_device_host,
                                                             T* y)
 {
@@ -787,13 +1063,87 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
     }
     else
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        // Scale y with beta
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmvt_scale(handle, n, beta_device_host, y));
+
+        dim3 csrmvt_blocks((info->size) - 1);
+        dim3 csrmvt_threads(WG_SIZE);
+        hipLaunchKernelGGL((csrmvt_adaptive_kernel),
+                           csrmvt_blocks,
+                           csrmvt_threads,
+                           0,
+                           stream,
+                           trans,
+                           static_cast<I*>(info->row_blocks),
+                           static_cast<J*>(info->wg_ids),
+                           alpha_device_host,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
     }
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+rocsparse_status rocsparse_csrmv_merge_template_dispatch(rocsparse_handle handle,
+                                                         J                m,
+                                                         J                n,
+                                                         I                nnz,
+                                                         U                alpha_device_host,
+                                                         const rocsparse_mat_descr descr,
+                                                         const A*                  csr_val,
+                                                         const I*                  csr_row_ptr,
+                                                         const J*                  csr_col_ind,
+                                                         rocsparse_csrmv_info      info,
+                                                         const X*                  x,
+                                                         U  beta_device_host,
+                                                         T* y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    I ntiles = info->merge_size;
+
+    // Rows and non-zeros of each tile
+    hipLaunchKernelGGL((csrmvn_merge_kernel<CSRMV_MERGE_DIM, CSRMV_MERGE_ITEMS_PER_THREAD>),
+                       dim3(ntiles),
+                       dim3(CSRMV_MERGE_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       static_cast<const J*>(info->merge_path),
+                       alpha_device_host,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       x,
+                       beta_device_host,
+                       y,
+                       static_cast<T*>(info->merge_carry),
+                       descr->base);
+
+    // Rows that span multiple tiles
+    hipLaunchKernelGGL((csrmvn_merge_fixup_kernel<CSRMV_MERGE_DIM>),
+                       dim3((ntiles - 1) / CSRMV_MERGE_DIM + 1),
+                       dim3(CSRMV_MERGE_DIM),
+                       0,
+                       stream,
+                       m,
+                       ntiles,
+                       static_cast<const J*>(info->merge_path),
+                       static_cast<const T*>(info->merge_carry),
+                       alpha_device_host,
+                       beta_device_host,
+                       y);
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T, typename A, typename X>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
                                           J                         m,
@@ -801,11 +1151,11 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           I                         nnz,
                                           const T*                  alpha_device_host,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  csr_val,
+                                          const A*                  csr_val,
                                           const I*                  csr_row_ptr,
                                           const J*                  csr_col_ind,
                                           rocsparse_mat_info        info,
-                                          const T*                  x,
+                                          const X*                  x,
                                           const T*                  beta_device_host,
                                           T*                        y)
 {
@@ -850,7 +1200,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     {
         return rocsparse_status_invalid_value;
     }
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -862,6 +1212,12 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices need to be square
+    if(descr->type != rocsparse_matrix_type_general && m != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -892,7 +1248,43 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
-    if(info == nullptr || info->csrmv_info == nullptr)
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // Symmetric and Hermitian matrices only store one triangle
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return rocsparse_csrmv_symm_template_dispatch(handle,
+                                                          trans,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          alpha_device_host,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          x,
+                                                          beta_device_host,
+                                                          y);
+        }
+        else
+        {
+            return rocsparse_csrmv_symm_template_dispatch(handle,
+                                                          trans,
+                                                          m,
+                                                          n,
+                                                          nnz,
+                                                          *alpha_device_host,
+                                                          descr,
+                                                          csr_val,
+                                                          csr_row_ptr,
+                                                          csr_col_ind,
+                                                          x,
+                                                          *beta_device_host,
+                                                          y);
+        }
+    }
+    else if(info == nullptr || info->csrmv_info == nullptr || info->csrmv_info->size == 0)
     {
         // If csrmv info is not available, call csrmv general
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -971,33 +1363,148 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     }
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                              \
-    template rocsparse_status rocsparse_csrmv_analysis_template<ITYPE, JTYPE, TTYPE>( \
-        rocsparse_handle          handle,                                             \
-        rocsparse_operation       trans,                                              \
-        JTYPE                     m,                                                  \
-        JTYPE                     n,                                                  \
-        ITYPE                     nnz,                                                \
-        const rocsparse_mat_descr descr,                                              \
-        const TTYPE*              csr_val,                                            \
-        const ITYPE*              csr_row_ptr,                                        \
-        const JTYPE*              csr_col_ind,                                        \
-        rocsparse_mat_info        info);                                                     \
-    template rocsparse_status rocsparse_csrmv_template<ITYPE, JTYPE, TTYPE>(          \
-        rocsparse_handle          handle,                                             \
-        rocsparse_operation       trans,                                              \
-        JTYPE                     m,                                                  \
-        JTYPE                     n,                                                  \
-        ITYPE                     nnz,                                                \
-        const TTYPE*              alpha_device_host,                                  \
-        const rocsparse_mat_descr descr,                                              \
-        const TTYPE*              csr_val,                                            \
-        const ITYPE*              csr_row_ptr,                                        \
-        const JTYPE*              csr_col_ind,                                        \
-        rocsparse_mat_info        info,                                               \
-        const TTYPE*              x,                                                  \
-        const TTYPE*              beta_device_host,                                   \
-        TTYPE*                    y);
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha_device_host,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const X*                  x,
+                                                const T*                  beta_device_host,
+                                                T*                        y)
+{
+    // Without merge path, for the transposed product, or for symmetric and Hermitian
+    // matrices, fall back to csrmv general
+    if(trans != rocsparse_operation_none || info == nullptr || info->csrmv_info == nullptr
+       || info->csrmv_info->merge_size == 0
+       || (descr != nullptr && descr->type != rocsparse_matrix_type_general))
+    {
+        return rocsparse_csrmv_template(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha_device_host,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        nullptr,
+                                        x,
+                                        beta_device_host,
+                                        y);
+    }
+
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(descr->type == rocsparse_matrix_type_triangular)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || x == nullptr
+       || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_merge_template_dispatch(handle,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       alpha_device_host,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       info->csrmv_info,
+                                                       x,
+                                                       beta_device_host,
+                                                       y);
+    }
+    else
+    {
+        return rocsparse_csrmv_merge_template_dispatch(handle,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       *alpha_device_host,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       info->csrmv_info,
+                                                       x,
+                                                       *beta_device_host,
+                                                       y);
+    }
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                    \
+    template rocsparse_status rocsparse_csrmv_analysis_template<ITYPE, JTYPE, TTYPE>(       \
+        rocsparse_handle          handle,                                                   \
+        rocsparse_operation       trans,                                                    \
+        JTYPE                     m,                                                        \
+        JTYPE                     n,                                                        \
+        ITYPE                     nnz,                                                      \
+        const rocsparse_mat_descr descr,                                                    \
+        const TTYPE*              csr_val,                                                  \
+        const ITYPE*              csr_row_ptr,                                              \
+        const JTYPE*              csr_col_ind,                                              \
+        rocsparse_mat_info        info);                                                    \
+    template rocsparse_status rocsparse_csrmv_merge_analysis_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                                   \
+        rocsparse_operation       trans,                                                    \
+        JTYPE                     m,                                                        \
+        JTYPE                     n,                                                        \
+        ITYPE                     nnz,                                                      \
+        const rocsparse_mat_descr descr,                                                    \
+        const TTYPE*              csr_val,                                                  \
+        const ITYPE*              csr_row_ptr,                                              \
+        const JTYPE*              csr_col_ind,                                              \
+        rocsparse_mat_info        info);
 
 INSTANTIATE(int32_t, int32_t, float);
 INSTANTIATE(int32_t, int32_t, double);
@@ -1013,6 +1520,114 @@ INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
 #undef INSTANTIATE
 
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE, ATYPE, XTYPE)                                           \
+    template rocsparse_status rocsparse_csrmv_template<ITYPE, JTYPE, TTYPE, ATYPE, XTYPE>(       \
+        rocsparse_handle          handle,                                                        \
+        rocsparse_operation       trans,                                                         \
+        JTYPE                     m,                                                             \
+        JTYPE                     n,                                                             \
+        ITYPE                     nnz,                                                           \
+        const TTYPE*              alpha_device_host,                                             \
+        const rocsparse_mat_descr descr,                                                         \
+        const ATYPE*              csr_val,                                                       \
+        const ITYPE*              csr_row_ptr,                                                   \
+        const JTYPE*              csr_col_ind,                                                   \
+        rocsparse_mat_info        info,                                                          \
+        const XTYPE*              x,                                                             \
+        const TTYPE*              beta_device_host,                                              \
+        TTYPE*                    y);                                                            \
+    template rocsparse_status rocsparse_csrmv_merge_template<ITYPE, JTYPE, TTYPE, ATYPE, XTYPE>( \
+        rocsparse_handle          handle,                                                        \
+        rocsparse_operation       trans,                                                         \
+        JTYPE                     m,                                                             \
+        JTYPE                     n,                                                             \
+        ITYPE                     nnz,                                                           \
+        const TTYPE*              alpha_device_host,                                             \
+        const rocsparse_mat_descr descr,                                                         \
+        const ATYPE*              csr_val,                                                       \
+        const ITYPE*              csr_row_ptr,                                                   \
+        const JTYPE*              csr_col_ind,                                                   \
+        rocsparse_mat_info        info,                                                          \
+        const XTYPE*              x,                                                             \
+        const TTYPE*              beta_device_host,                                              \
+        TTYPE*                    y);
+
+INSTANTIATE(int32_t, int32_t, float, float, float);
+INSTANTIATE(int32_t, int32_t, double, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, float, float);
+INSTANTIATE(int64_t, int32_t, double, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, float, float);
+INSTANTIATE(int64_t, int64_t, double, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float);
+INSTANTIATE(int32_t, int32_t, double, float, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float);
+INSTANTIATE(int64_t, int32_t, double, float, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float);
+INSTANTIATE(int64_t, int64_t, double, float, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
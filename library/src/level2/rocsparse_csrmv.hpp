@@ -40,7 +40,19 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
                                                    const J*                  csr_col_ind,
                                                    rocsparse_mat_info        info);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_merge_analysis_template(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans,
+                                                         J                         m,
+                                                         J                         n,
+                                                         I                         nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const I*                  csr_row_ptr,
+                                                         const J*                  csr_col_ind,
+                                                         rocsparse_mat_info        info);
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
                                                    J                         m,
@@ -48,14 +60,14 @@ rocsparse_status rocsparse_csrmv_template_dispatch(rocsparse_handle          han
                                                    I                         nnz,
                                                    U                         alpha_device_host,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const A*                  csr_val,
                                                    const I*                  csr_row_ptr,
                                                    const J*                  csr_col_ind,
-                                                   const T*                  x,
+                                                   const X*                  x,
                                                    U                         beta_device_host,
                                                    T*                        y);
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A, typename X>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
                                           J                         m,
@@ -63,12 +75,28 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           I                         nnz,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  csr_val,
+                                          const A*                  csr_val,
                                           const I*                  csr_row_ptr,
                                           const J*                  csr_col_ind,
                                           rocsparse_mat_info        info,
-                                          const T*                  x,
+                                          const X*                  x,
                                           const T*                  beta,
                                           T*                        y);
 
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_csrmv_merge_template(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                J                         m,
+                                                J                         n,
+                                                I                         nnz,
+                                                const T*                  alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                const X*                  x,
+                                                const T*                  beta,
+                                                T*                        y);
+
 #endif // ROCSPARSE_CSRMV_HPP
@@ -116,6 +116,101 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csrsv_level_count(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        const rocsparse_mat_descr descr,
+                                                        rocsparse_mat_info        info,
+                                                        rocsparse_int*            nlevels)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsv_level_count",
+              trans,
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)nlevels);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check pointer arguments
+    if(nlevels == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_trm_info csrsv
+        = (descr->fill_mode == rocsparse_fill_mode_upper)
+              ? ((trans == rocsparse_operation_none) ? info->csrsv_upper_info
+                                                     : info->csrsvt_upper_info)
+              : ((trans == rocsparse_operation_none) ? info->csrsv_lower_info
+                                                     : info->csrsvt_lower_info);
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, there are no levels.
+    rocsparse_int count = (csrsv == nullptr) ? 0 : csrsv->nlevels;
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nlevels, &count, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+    }
+    else
+    {
+        *nlevels = count;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrsv_jacobi_sweeps(rocsparse_handle   handle,
+                                                          rocsparse_mat_info info,
+                                                          rocsparse_int      nsweeps)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrsv_jacobi_sweeps", (const void*&)info, nsweeps);
+
+    // At least one sweep is required
+    if(nsweeps <= 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    info->csrsv_jacobi_sweeps = nsweeps;
+
+    return rocsparse_status_success;
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
                                                   const rocsparse_mat_descr descr,
                                                   rocsparse_mat_info        info)
@@ -51,7 +51,8 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         const rocsparse_int*      csr_col_ind,
                                         rocsparse_trm_info        info,
                                         rocsparse_int**           zero_pivot,
-                                        void*                     temp_buffer);
+                                        void*                     temp_buffer,
+                                        bool                      level_ptr);
 
 template <typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
@@ -40,7 +40,8 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         const rocsparse_int*      csr_col_ind,
                                         rocsparse_trm_info        info,
                                         rocsparse_int**           zero_pivot,
-                                        void*                     temp_buffer)
+                                        void*                     temp_buffer,
+                                        bool                      level_ptr)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -429,13 +430,6 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     }
 #undef CSRSV_DIM
 
-    // Post processing
-    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-        &info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
-
-    // Wait for host transfer to finish
-    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
-
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, workspace));
 
     size_t rocprim_size;
@@ -460,6 +454,52 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                            stream));
     }
 
+    // The analysis kernels store the level of each row, starting with 1. After sorting,
+    // the rows of each level are contiguous in the row map and the last row belongs to
+    // the deepest level.
+    int* levels = keys.current();
+
+    // Post processing
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &info->nlevels, levels + m - 1, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // The level offsets are only required by the level scheduled solve. They cannot be
+    // computed later, since the sorted levels only live in the temporary buffer.
+    if(level_ptr)
+    {
+        // Allocate buffer to hold the level offsets
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&info->level_ptr, sizeof(rocsparse_int) * (info->nlevels + 1)));
+
+#define CSRSV_DIM 256
+        hipLaunchKernelGGL((csrsv_level_ptr_kernel<CSRSV_DIM>),
+                           dim3((m - 1) / CSRSV_DIM + 1),
+                           dim3(CSRSV_DIM),
+                           0,
+                           stream,
+                           m,
+                           levels,
+                           info->level_ptr);
+#undef CSRSV_DIM
+
+        // The level scheduled solve launches its kernels based on the level sizes
+        info->level_ptr_host.resize(info->nlevels + 1);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->level_ptr_host.data(),
+                                           info->level_ptr,
+                                           sizeof(rocsparse_int) * (info->nlevels + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
     // Store some pointers to verify correct execution
     info->m           = m;
     info->nnz         = nnz;
@@ -470,6 +510,144 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+rocsparse_status rocsparse_trm_push_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_trm_info        info,
+                                             rocsparse_int**           zero_pivot,
+                                             void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // max_nnz
+    rocsparse_int* d_max_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_max_nnz, 0, sizeof(rocsparse_int), stream));
+
+    // Allocate buffer to hold diagonal entry point
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trm_diag_ind, sizeof(rocsparse_int) * m));
+
+    // Allocate buffer to hold the number of dependencies of each row of the transposed
+    // matrix. This is the only array that scales with m, no transposed matrix is stored.
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trm_col_nnz, sizeof(int) * m));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info->trm_col_nnz, 0, sizeof(int) * m, stream));
+
+    // Allocate buffer to hold zero pivot
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)zero_pivot, sizeof(rocsparse_int)));
+
+    // Initialize zero pivot
+    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(*zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csrsv_push_analysis_kernel<CSRSV_DIM, 32>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           info->trm_diag_ind,
+                           info->trm_col_nnz,
+                           d_max_nnz,
+                           *zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csrsv_push_analysis_kernel<CSRSV_DIM, 64>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           info->trm_diag_ind,
+                           info->trm_col_nnz,
+                           d_max_nnz,
+                           *zero_pivot,
+                           descr->base,
+                           descr->fill_mode,
+                           descr->diag_type);
+    }
+#undef CSRSV_DIM
+
+    // Post processing
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &info->max_nnz, d_max_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Store some pointers to verify correct execution
+    info->m           = m;
+    info->nnz         = nnz;
+    info->descr       = descr;
+    info->trm_row_ptr = csr_row_ptr;
+    info->trm_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+// Checks whether existing analysis meta data provides everything the solve policy
+// relies on. The level scheduled solve requires the level offsets, the transposed push
+// solve requires that no transposed matrix has been created and all other transposed
+// solves require the transposed matrix.
+static bool rocsparse_csrsv_reusable(rocsparse_trm_info     trm,
+                                     rocsparse_operation    trans,
+                                     rocsparse_solve_policy solve)
+{
+    if(trm == nullptr)
+    {
+        return false;
+    }
+
+    if(solve == rocsparse_solve_policy_level && trm->level_ptr == nullptr)
+    {
+        return false;
+    }
+
+    if(trans == rocsparse_operation_transpose)
+    {
+        return (solve == rocsparse_solve_policy_push) == (trm->trmt_perm == nullptr);
+    }
+
+    return true;
+}
+
+// Releases csrsv meta data, that cannot be re-used. Meta data that is shared with
+// other routines is only detached.
+static rocsparse_status rocsparse_csrsv_release(rocsparse_mat_info info, rocsparse_trm_info& trm)
+{
+    if(!rocsparse_check_trm_shared(info, trm))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(trm));
+    }
+
+    trm = nullptr;
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -573,6 +751,9 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // The level offsets are only computed for the level scheduled solve
+    bool level_ptr = (solve == rocsparse_solve_policy_level);
+
     // Switch between lower and upper triangular analysis
     if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
@@ -583,42 +764,48 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             // It is the user's responsibility that this data is still valid,
             // since he passed the 'reuse' flag.
 
-            // If csrsv meta data is already available, do nothing
-            if(trans == rocsparse_operation_none && info->csrsv_upper_info != nullptr)
+            // If compatible csrsv meta data is already available, do nothing
+            if(trans == rocsparse_operation_none
+               && rocsparse_csrsv_reusable(info->csrsv_upper_info, trans, solve))
             {
                 return rocsparse_status_success;
             }
-            else if(trans == rocsparse_operation_transpose && info->csrsvt_upper_info != nullptr)
+            else if(trans == rocsparse_operation_transpose
+                    && rocsparse_csrsv_reusable(info->csrsvt_upper_info, trans, solve))
             {
                 return rocsparse_status_success;
             }
 
-            // Check for other lower analysis meta data
+            // Check for other compatible upper analysis meta data
 
-            if(trans == rocsparse_operation_none && info->csrsm_upper_info != nullptr)
+            if(trans == rocsparse_operation_none
+               && rocsparse_csrsv_reusable(info->csrsm_upper_info, trans, solve))
             {
                 // csrsm meta data
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info, info->csrsv_upper_info));
                 info->csrsv_upper_info = info->csrsm_upper_info;
                 return rocsparse_status_success;
             }
 
-            if(trans == rocsparse_operation_transpose && info->csrsmt_upper_info != nullptr)
+            if(trans == rocsparse_operation_transpose
+               && rocsparse_csrsv_reusable(info->csrsmt_upper_info, trans, solve))
             {
-                // csrsv meta data
+                // csrsm meta data
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info, info->csrsvt_upper_info));
                 info->csrsvt_upper_info = info->csrsmt_upper_info;
                 return rocsparse_status_success;
             }
         }
 
-        // User is explicitly asking to force a re-analysis, or no valid data has been
-        // found to be re-used.
-
-        // Clear csrsv info
+        // User is explicitly asking to force a re-analysis, or no data that is compatible
+        // with the solve policy has been found to be re-used, e.g. when the level offsets
+        // or the push analysis are missing.
 
         // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info((trans == rocsparse_operation_none)
-                                                                 ? info->csrsv_upper_info
-                                                                 : info->csrsvt_upper_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info,
+                                                          (trans == rocsparse_operation_none)
+                                                              ? info->csrsv_upper_info
+                                                              : info->csrsvt_upper_info));
 
         // Create csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info((trans == rocsparse_operation_none)
@@ -626,18 +813,36 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                                 : &info->csrsvt_upper_info));
 
         // Perform analysis
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(
-            handle,
-            trans,
-            m,
-            nnz,
-            descr,
-            csr_val,
-            csr_row_ptr,
-            csr_col_ind,
-            (trans == rocsparse_operation_none) ? info->csrsv_upper_info : info->csrsvt_upper_info,
-            &info->zero_pivot,
-            temp_buffer));
+        if(trans == rocsparse_operation_transpose && solve == rocsparse_solve_policy_push)
+        {
+            // Transposed solve operates on the non-transposed matrix
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_push_analysis(handle,
+                                                                  m,
+                                                                  nnz,
+                                                                  descr,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  info->csrsvt_upper_info,
+                                                                  &info->zero_pivot,
+                                                                  temp_buffer));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                             trans,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             (trans == rocsparse_operation_none)
+                                                                 ? info->csrsv_upper_info
+                                                                 : info->csrsvt_upper_info,
+                                                             &info->zero_pivot,
+                                                             temp_buffer,
+                                                             level_ptr));
+        }
     }
     else
     {
@@ -648,51 +853,63 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             // It is the user's responsibility that this data is still valid,
             // since he passed the 'reuse' flag.
 
-            // If csrsv meta data is already available, do nothing
-            if(trans == rocsparse_operation_none && info->csrsv_lower_info != nullptr)
+            // If compatible csrsv meta data is already available, do nothing
+            if(trans == rocsparse_operation_none
+               && rocsparse_csrsv_reusable(info->csrsv_lower_info, trans, solve))
             {
                 return rocsparse_status_success;
             }
-            else if(trans == rocsparse_operation_transpose && info->csrsvt_lower_info != nullptr)
+            else if(trans == rocsparse_operation_transpose
+                    && rocsparse_csrsv_reusable(info->csrsvt_lower_info, trans, solve))
             {
                 return rocsparse_status_success;
             }
 
-            // Check for other lower analysis meta data
+            // Check for other compatible lower analysis meta data
 
-            if(trans == rocsparse_operation_none && info->csrilu0_info != nullptr)
+            if(trans == rocsparse_operation_none
+               && rocsparse_csrsv_reusable(info->csrilu0_info, trans, solve))
             {
                 // csrilu0 meta data
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info, info->csrsv_lower_info));
                 info->csrsv_lower_info = info->csrilu0_info;
                 return rocsparse_status_success;
             }
-            else if(trans == rocsparse_operation_none && info->csric0_info != nullptr)
+            else if(trans == rocsparse_operation_none
+                    && rocsparse_csrsv_reusable(info->csric0_info, trans, solve))
             {
                 // csric0 meta data
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info, info->csrsv_lower_info));
                 info->csrsv_lower_info = info->csric0_info;
                 return rocsparse_status_success;
             }
-            else if(trans == rocsparse_operation_none && info->csrsm_lower_info != nullptr)
+            else if(trans == rocsparse_operation_none
+                    && rocsparse_csrsv_reusable(info->csrsm_lower_info, trans, solve))
             {
                 // csrsm meta data
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info, info->csrsv_lower_info));
                 info->csrsv_lower_info = info->csrsm_lower_info;
                 return rocsparse_status_success;
             }
-            else if(trans == rocsparse_operation_transpose && info->csrsmt_lower_info != nullptr)
+            else if(trans == rocsparse_operation_transpose
+                    && rocsparse_csrsv_reusable(info->csrsmt_lower_info, trans, solve))
             {
                 // csrsm meta data
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info, info->csrsvt_lower_info));
                 info->csrsvt_lower_info = info->csrsmt_lower_info;
                 return rocsparse_status_success;
             }
         }
 
-        // User is explicitly asking to force a re-analysis, or no valid data has been
-        // found to be re-used.
+        // User is explicitly asking to force a re-analysis, or no data that is compatible
+        // with the solve policy has been found to be re-used, e.g. when the level offsets
+        // or the push analysis are missing.
 
         // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info((trans == rocsparse_operation_none)
-                                                                 ? info->csrsv_lower_info
-                                                                 : info->csrsvt_lower_info));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_release(info,
+                                                          (trans == rocsparse_operation_none)
+                                                              ? info->csrsv_lower_info
+                                                              : info->csrsvt_lower_info));
 
         // Create csrsv info
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info((trans == rocsparse_operation_none)
@@ -700,18 +917,36 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                                 : &info->csrsvt_lower_info));
 
         // Perform analysis
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(
-            handle,
-            trans,
-            m,
-            nnz,
-            descr,
-            csr_val,
-            csr_row_ptr,
-            csr_col_ind,
-            (trans == rocsparse_operation_none) ? info->csrsv_lower_info : info->csrsvt_lower_info,
-            &info->zero_pivot,
-            temp_buffer));
+        if(trans == rocsparse_operation_transpose && solve == rocsparse_solve_policy_push)
+        {
+            // Transposed solve operates on the non-transposed matrix
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_push_analysis(handle,
+                                                                  m,
+                                                                  nnz,
+                                                                  descr,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  info->csrsvt_lower_info,
+                                                                  &info->zero_pivot,
+                                                                  temp_buffer));
+        }
+        else
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                             trans,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             (trans == rocsparse_operation_none)
+                                                                 ? info->csrsv_lower_info
+                                                                 : info->csrsvt_lower_info,
+                                                             &info->zero_pivot,
+                                                             temp_buffer,
+                                                             level_ptr));
+        }
     }
 
     return rocsparse_status_success;
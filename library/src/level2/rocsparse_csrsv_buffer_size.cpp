@@ -163,8 +163,29 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
         transpose_size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
 
         *buffer_size = std::max(*buffer_size, transpose_size);
+
+        // Transposed solve without transposed matrix needs the dependency counters and
+        // partial sums of the transposed system
+        size_t push_size = 256;
+        push_size += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+        push_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+        *buffer_size = std::max(*buffer_size, push_size);
+    }
+
+    // Approximate solve by Jacobi sweeps needs a second iterate, behind the transposed
+    // matrix values in the transposed case
+    size_t jacobi_size = 256;
+    jacobi_size += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+    jacobi_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    if(trans == rocsparse_operation_transpose)
+    {
+        jacobi_size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
     }
 
+    *buffer_size = std::max(*buffer_size, jacobi_size);
+
     return rocsparse_status_success;
 }
 
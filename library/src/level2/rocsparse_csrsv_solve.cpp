@@ -64,6 +64,275 @@ __launch_bounds__(BLOCKSIZE) __global__
                                             diag_type);
 }
 
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_push_kernel(rocsparse_int m,
+                           U             alpha_device_host,
+                           const rocsparse_int* __restrict__ csr_row_ptr,
+                           const rocsparse_int* __restrict__ csr_col_ind,
+                           const T* __restrict__ csr_val,
+                           const rocsparse_int* __restrict__ csr_diag_ind,
+                           const T* __restrict__ x,
+                           T* __restrict__ y,
+                           T* __restrict__ partial_sum,
+                           int* __restrict__ dep_count,
+                           rocsparse_int* __restrict__ zero_pivot,
+                           rocsparse_index_base idx_base,
+                           rocsparse_fill_mode  fill_mode,
+                           rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_push_device<BLOCKSIZE, WF_SIZE, SLEEP>(m,
+                                                 alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 csr_diag_ind,
+                                                 x,
+                                                 y,
+                                                 partial_sum,
+                                                 dep_count,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_kernel(rocsparse_int nrows,
+                            U             alpha_device_host,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ x,
+                            T* __restrict__ y,
+                            const rocsparse_int* __restrict__ map,
+                            rocsparse_int offset,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_level_device<BLOCKSIZE, WF_SIZE>(nrows,
+                                           alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           x,
+                                           y,
+                                           map,
+                                           offset,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_group_kernel(rocsparse_int level_begin,
+                                  rocsparse_int level_end,
+                                  const rocsparse_int* __restrict__ level_ptr,
+                                  U alpha_device_host,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const T* __restrict__ csr_val,
+                                  const T* __restrict__ x,
+                                  T* __restrict__ y,
+                                  const rocsparse_int* __restrict__ map,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base,
+                                  rocsparse_fill_mode  fill_mode,
+                                  rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_level_group_device<BLOCKSIZE, WF_SIZE>(level_begin,
+                                                 level_end,
+                                                 level_ptr,
+                                                 alpha,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 csr_val,
+                                                 x,
+                                                 y,
+                                                 map,
+                                                 zero_pivot,
+                                                 idx_base,
+                                                 fill_mode,
+                                                 diag_type);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_jacobi_kernel(rocsparse_int m,
+                             U             alpha_device_host,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             const T* __restrict__ x,
+                             const T* __restrict__ y_old,
+                             T* __restrict__ y_new,
+                             rocsparse_int* __restrict__ zero_pivot,
+                             rocsparse_index_base idx_base,
+                             rocsparse_fill_mode  fill_mode,
+                             rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_jacobi_device<BLOCKSIZE, WF_SIZE>(m,
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            x,
+                                            y_old,
+                                            y_new,
+                                            zero_pivot,
+                                            idx_base,
+                                            fill_mode,
+                                            diag_type);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+rocsparse_status rocsparse_csrsv_solve_level(rocsparse_handle          handle,
+                                             U                         alpha_device_host,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             const rocsparse_trm_info  csrsv,
+                                             const T*                  x,
+                                             T*                        y,
+                                             rocsparse_fill_mode       fill_mode)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Levels with at most this many rows fit into a single block
+    static constexpr rocsparse_int small_level = BLOCKSIZE / WF_SIZE;
+
+    const std::vector<rocsparse_int>& level_ptr = csrsv->level_ptr_host;
+
+    rocsparse_int level = 0;
+    while(level < csrsv->nlevels)
+    {
+        rocsparse_int nrows = level_ptr[level + 1] - level_ptr[level];
+
+        if(nrows > small_level)
+        {
+            // Large level, solve all its rows with a single launch
+            hipLaunchKernelGGL((csrsv_level_kernel<BLOCKSIZE, WF_SIZE>),
+                               dim3((nrows - 1) / small_level + 1),
+                               dim3(BLOCKSIZE),
+                               0,
+                               stream,
+                               nrows,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               csrsv->row_map,
+                               level_ptr[level],
+                               info->zero_pivot,
+                               descr->base,
+                               fill_mode,
+                               descr->diag_type);
+
+            ++level;
+        }
+        else
+        {
+            // Group all consecutive small levels into a single launch
+            rocsparse_int level_end = level + 1;
+            while(level_end < csrsv->nlevels
+                  && level_ptr[level_end + 1] - level_ptr[level_end] <= small_level)
+            {
+                ++level_end;
+            }
+
+            hipLaunchKernelGGL((csrsv_level_group_kernel<BLOCKSIZE, WF_SIZE>),
+                               dim3(1),
+                               dim3(BLOCKSIZE),
+                               0,
+                               stream,
+                               level,
+                               level_end,
+                               csrsv->level_ptr,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y,
+                               csrsv->row_map,
+                               info->zero_pivot,
+                               descr->base,
+                               fill_mode,
+                               descr->diag_type);
+
+            level = level_end;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+rocsparse_status rocsparse_csrsv_solve_jacobi(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              U                         alpha_device_host,
+                                              const rocsparse_mat_descr descr,
+                                              const T*                  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              const T*                  x,
+                                              T*                        y,
+                                              T*                        y_tmp,
+                                              rocsparse_fill_mode       fill_mode)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int nsweeps = info->csrsv_jacobi_sweeps;
+
+    // The iterates alternate between y and y_tmp, such that the last sweep writes y.
+    // The first sweep starts from a zero iterate.
+    T* y_old = (nsweeps % 2 == 0) ? y : y_tmp;
+    T* y_new = (nsweeps % 2 == 0) ? y_tmp : y;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(y_old, 0, sizeof(T) * m, stream));
+
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        hipLaunchKernelGGL((csrsv_jacobi_kernel<BLOCKSIZE, WF_SIZE>),
+                           dim3((WF_SIZE * m - 1) / BLOCKSIZE + 1),
+                           dim3(BLOCKSIZE),
+                           0,
+                           stream,
+                           m,
+                           alpha_device_host,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y_old,
+                           y_new,
+                           info->zero_pivot,
+                           descr->base,
+                           fill_mode,
+                           descr->diag_type);
+
+        std::swap(y_old, y_new);
+    }
+
+    return rocsparse_status_success;
+}
+
 template <typename T, typename U>
 rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
@@ -118,6 +387,101 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
         RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
     }
 
+    // Determine gcnArch
+    int gcnArch = handle->properties.gcnArch;
+    int asicRev = handle->asic_rev;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    // Transposed solve, if the analysis did not create the transposed matrix
+    if(trans == rocsparse_operation_transpose && csrsv->trmt_perm == nullptr)
+    {
+        // Partial sums of the transposed system
+        T* partial_sum = reinterpret_cast<T*>(ptr);
+
+        // Each row of the transposed system waits for its dependencies to be pushed
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            done_array, csrsv->trm_col_nnz, sizeof(int) * m, hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(partial_sum, 0, sizeof(T) * m, stream));
+
+        // gfx908
+        if(gcnArch == 908 && asicRev < 2)
+        {
+            // LCOV_EXCL_START
+            hipLaunchKernelGGL((csrsv_push_kernel<CSRSV_DIM, 64, true>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrsv->trm_diag_ind,
+                               x,
+                               y,
+                               partial_sum,
+                               done_array,
+                               info->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+            // LCOV_EXCL_STOP
+        }
+        else if(handle->wavefront_size == 32)
+        {
+            // LCOV_EXCL_START
+            hipLaunchKernelGGL((csrsv_push_kernel<CSRSV_DIM, 32, false>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrsv->trm_diag_ind,
+                               x,
+                               y,
+                               partial_sum,
+                               done_array,
+                               info->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            assert(handle->wavefront_size == 64);
+            hipLaunchKernelGGL((csrsv_push_kernel<CSRSV_DIM, 64, false>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               csrsv->trm_diag_ind,
+                               x,
+                               y,
+                               partial_sum,
+                               done_array,
+                               info->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+
+        return rocsparse_status_success;
+    }
+
     // Pointers to differentiate between transpose mode
     const rocsparse_int* local_csr_row_ptr = csr_row_ptr;
     const rocsparse_int* local_csr_col_ind = csr_col_ind;
@@ -130,6 +494,7 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
     if(trans == rocsparse_operation_transpose)
     {
         T* csrt_val = reinterpret_cast<T*>(ptr);
+        ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
 
         // Gather values
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
@@ -143,13 +508,90 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                                              : rocsparse_fill_mode_lower;
     }
 
-    // Determine gcnArch
-    int gcnArch = handle->properties.gcnArch;
-    int asicRev = handle->asic_rev;
+    // Approximate solve by Jacobi sweeps, all rows are updated concurrently in each sweep
+    if(policy == rocsparse_solve_policy_jacobi)
+    {
+        // Second iterate
+        T* y_tmp = reinterpret_cast<T*>(ptr);
 
-#define CSRSV_DIM 1024
-    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
-    dim3 csrsv_threads(CSRSV_DIM);
+        if(handle->wavefront_size == 32)
+        {
+            // LCOV_EXCL_START
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrsv_solve_jacobi<CSRSV_DIM, 32>(handle,
+                                                             m,
+                                                             alpha_device_host,
+                                                             descr,
+                                                             local_csr_val,
+                                                             local_csr_row_ptr,
+                                                             local_csr_col_ind,
+                                                             info,
+                                                             x,
+                                                             y,
+                                                             y_tmp,
+                                                             fill_mode)));
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            assert(handle->wavefront_size == 64);
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrsv_solve_jacobi<CSRSV_DIM, 64>(handle,
+                                                             m,
+                                                             alpha_device_host,
+                                                             descr,
+                                                             local_csr_val,
+                                                             local_csr_row_ptr,
+                                                             local_csr_col_ind,
+                                                             info,
+                                                             x,
+                                                             y,
+                                                             y_tmp,
+                                                             fill_mode)));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Level scheduled solve, if the level offsets are available. They are only computed
+    // by an analysis with rocsparse_solve_policy_level, analysis data that has been
+    // shared from other routines does not provide them.
+    if(policy == rocsparse_solve_policy_level && csrsv->level_ptr != nullptr)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            // LCOV_EXCL_START
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsv_solve_level<CSRSV_DIM, 32>(handle,
+                                                                                  alpha_device_host,
+                                                                                  descr,
+                                                                                  local_csr_val,
+                                                                                  local_csr_row_ptr,
+                                                                                  local_csr_col_ind,
+                                                                                  info,
+                                                                                  csrsv,
+                                                                                  x,
+                                                                                  y,
+                                                                                  fill_mode)));
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            assert(handle->wavefront_size == 64);
+            RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrsv_solve_level<CSRSV_DIM, 64>(handle,
+                                                                                  alpha_device_host,
+                                                                                  descr,
+                                                                                  local_csr_val,
+                                                                                  local_csr_row_ptr,
+                                                                                  local_csr_col_ind,
+                                                                                  info,
+                                                                                  csrsv,
+                                                                                  x,
+                                                                                  y,
+                                                                                  fill_mode)));
+        }
+
+        return rocsparse_status_success;
+    }
 
     // gfx908
     if(gcnArch == 908 && asicRev < 2)
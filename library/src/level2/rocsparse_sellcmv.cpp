@@ -0,0 +1,270 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_sellcmv.hpp"
+
+#include "definitions.h"
+#include "sellcmv_device.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void sellcmvn_kernel(J m,
+                                                             J n,
+                                                             J slice_size,
+                                                             U alpha_device_host,
+                                                             const I* __restrict__ sell_slice_ptr,
+                                                             const J* __restrict__ sell_perm,
+                                                             const J* __restrict__ sell_col_ind,
+                                                             const T* __restrict__ sell_val,
+                                                             const T* __restrict__ x,
+                                                             U beta_device_host,
+                                                             T* __restrict__ y,
+                                                             rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        sellcmvn_device<BLOCKSIZE>(m,
+                                   n,
+                                   slice_size,
+                                   alpha,
+                                   sell_slice_ptr,
+                                   sell_perm,
+                                   sell_col_ind,
+                                   sell_val,
+                                   x,
+                                   beta,
+                                   y,
+                                   idx_base);
+    }
+}
+
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_sellcmv_dispatch(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            J                         m,
+                                            J                         n,
+                                            J                         slice_size,
+                                            U                         alpha_device_host,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  sell_val,
+                                            const I*                  sell_slice_ptr,
+                                            const J*                  sell_perm,
+                                            const J*                  sell_col_ind,
+                                            const T*                  x,
+                                            U                         beta_device_host,
+                                            T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different sellcmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define SELLCMVN_DIM 512
+        dim3 sellcmvn_blocks((m - 1) / SELLCMVN_DIM + 1);
+        dim3 sellcmvn_threads(SELLCMVN_DIM);
+
+        hipLaunchKernelGGL((sellcmvn_kernel<SELLCMVN_DIM>),
+                           sellcmvn_blocks,
+                           sellcmvn_threads,
+                           0,
+                           stream,
+                           m,
+                           n,
+                           slice_size,
+                           alpha_device_host,
+                           sell_slice_ptr,
+                           sell_perm,
+                           sell_col_ind,
+                           sell_val,
+                           x,
+                           beta_device_host,
+                           y,
+                           descr->base);
+
+#undef SELLCMVN_DIM
+    }
+    else
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_sellcmv_template(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            J                         m,
+                                            J                         n,
+                                            J                         slice_size,
+                                            const T*                  alpha_device_host,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  sell_val,
+                                            const I*                  sell_slice_ptr,
+                                            const J*                  sell_perm,
+                                            const J*                  sell_col_ind,
+                                            const T*                  x,
+                                            const T*                  beta_device_host,
+                                            T*                        y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xsellcmv"),
+              trans,
+              m,
+              n,
+              slice_size,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)sell_val,
+              (const void*&)sell_slice_ptr,
+              (const void*&)sell_perm,
+              (const void*&)sell_col_ind,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || n < 0 || slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of the pointer arguments
+    if(sell_slice_ptr == nullptr || sell_perm == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_sellcmv_dispatch(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          slice_size,
+                                          alpha_device_host,
+                                          descr,
+                                          sell_val,
+                                          sell_slice_ptr,
+                                          sell_perm,
+                                          sell_col_ind,
+                                          x,
+                                          beta_device_host,
+                                          y);
+    }
+    else
+    {
+        return rocsparse_sellcmv_dispatch(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          slice_size,
+                                          *alpha_device_host,
+                                          descr,
+                                          sell_val,
+                                          sell_slice_ptr,
+                                          sell_perm,
+                                          sell_col_ind,
+                                          x,
+                                          *beta_device_host,
+                                          y);
+    }
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                       \
+    template rocsparse_status rocsparse_sellcmv_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                      \
+        rocsparse_operation       trans,                                       \
+        JTYPE                     m,                                           \
+        JTYPE                     n,                                           \
+        JTYPE                     slice_size,                                  \
+        const TTYPE*              alpha,                                       \
+        const rocsparse_mat_descr descr,                                       \
+        const TTYPE*              sell_val,                                    \
+        const ITYPE*              sell_slice_ptr,                              \
+        const JTYPE*              sell_perm,                                   \
+        const JTYPE*              sell_col_ind,                                \
+        const TTYPE*              x,                                           \
+        const TTYPE*              beta,                                        \
+        TTYPE*                    y);
+
+INSTANTIATE(int32_t, int32_t, float)
+INSTANTIATE(int32_t, int32_t, double)
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex)
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, int32_t, float)
+INSTANTIATE(int64_t, int32_t, double)
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex)
+INSTANTIATE(int64_t, int64_t, float)
+INSTANTIATE(int64_t, int64_t, double)
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex)
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex)
+#undef INSTANTIATE
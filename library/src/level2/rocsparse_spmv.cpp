@@ -26,10 +26,428 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include "rocsparse_bsrmv.hpp"
 #include "rocsparse_coomv.hpp"
 #include "rocsparse_coomv_aos.hpp"
 #include "rocsparse_csrmv.hpp"
 #include "rocsparse_ellmv.hpp"
+#include "rocsparse_sellcmv.hpp"
+
+#include <cstring>
+
+// Operation on the CSR matrix that shares its arrays with a CSC matrix
+static rocsparse_operation rocsparse_spmv_csc_operation(rocsparse_operation trans)
+{
+    return (trans == rocsparse_operation_none) ? rocsparse_operation_transpose
+                                               : rocsparse_operation_none;
+}
+
+// Number of timed runs per candidate algorithm of rocsparse_spmv_alg_auto
+#define SPMV_AUTOTUNE_ITERS 10
+
+// Runs the csrmv kernels of the given CSR algorithm. y is passed separately, such that
+// the autotuning can run the candidate algorithms on a scratch vector
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_spmv_csrx_compute(rocsparse_handle            handle,
+                                             rocsparse_operation         csr_trans,
+                                             J                           csr_m,
+                                             J                           csr_n,
+                                             const I*                    csr_row_ptr,
+                                             const J*                    csr_col_ind,
+                                             const void*                 alpha,
+                                             const rocsparse_spmat_descr mat,
+                                             const X*                    x,
+                                             const void*                 beta,
+                                             T*                          y,
+                                             rocsparse_spmv_alg          alg)
+{
+    if(alg == rocsparse_spmv_alg_csr_merge)
+    {
+        return rocsparse_csrmv_merge_template(handle,
+                                              csr_trans,
+                                              csr_m,
+                                              csr_n,
+                                              (I)mat->nnz,
+                                              (const T*)alpha,
+                                              mat->descr,
+                                              (const A*)mat->val_data,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              mat->info,
+                                              x,
+                                              (const T*)beta,
+                                              y);
+    }
+
+    return rocsparse_csrmv_template(handle,
+                                    csr_trans,
+                                    csr_m,
+                                    csr_n,
+                                    (I)mat->nnz,
+                                    (const T*)alpha,
+                                    mat->descr,
+                                    (const A*)mat->val_data,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    (alg == rocsparse_spmv_alg_csr_stream) ? nullptr : mat->info,
+                                    x,
+                                    (const T*)beta,
+                                    y);
+}
+
+// Candidate algorithms of rocsparse_spmv_alg_auto for CSR and CSC matrices
+static const rocsparse_spmv_alg spmv_autotune_candidates[] = {rocsparse_spmv_alg_csr_stream,
+                                                              rocsparse_spmv_alg_csr_adaptive,
+                                                              rocsparse_spmv_alg_csr_merge};
+
+#define SPMV_AUTOTUNE_CANDIDATES \
+    (sizeof(spmv_autotune_candidates) / sizeof(spmv_autotune_candidates[0]))
+
+// Parameters of the current SpMV, which rocsparse_spmv_alg_auto tunes the algorithm for.
+// The values and addresses of the scalars do not change the best algorithm, such that
+// repeated SpMVs with changing scalars keep the tuned algorithm.
+template <typename T>
+static rocsparse_spmv_tuning_key rocsparse_spmv_tuning_key_create(rocsparse_handle    handle,
+                                                                  rocsparse_operation trans,
+                                                                  const void*         beta,
+                                                                  const rocsparse_dnvec_descr x,
+                                                                  const rocsparse_dnvec_descr y)
+{
+    rocsparse_spmv_tuning_key key;
+    memset(&key, 0, sizeof(key));
+
+    key.trans        = trans;
+    key.x_type       = x->data_type;
+    key.compute_type = y->data_type;
+    key.pointer_mode = handle->pointer_mode;
+    key.beta_zero    = (handle->pointer_mode == rocsparse_pointer_mode_host)
+                       && (*(const T*)beta == static_cast<T>(0));
+
+    return key;
+}
+
+// Checks whether the algorithm of rocsparse_spmv_alg_auto has been tuned for key
+static bool rocsparse_spmv_tuned(const rocsparse_spmat_descr      mat,
+                                 const rocsparse_spmv_tuning_key& key)
+{
+    return mat->spmv_tuned
+           && memcmp(&mat->spmv_key, &key, sizeof(rocsparse_spmv_tuning_key)) == 0;
+}
+
+// Times the candidate algorithms between consecutive events, using a single host
+// synchronization. Candidates that do not support the matrix obtain a negative time.
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_spmv_csrx_time(rocsparse_handle            handle,
+                                          rocsparse_operation         csr_trans,
+                                          J                           csr_m,
+                                          J                           csr_n,
+                                          const I*                    csr_row_ptr,
+                                          const J*                    csr_col_ind,
+                                          const void*                 alpha,
+                                          const rocsparse_spmat_descr mat,
+                                          const X*                    x,
+                                          const void*                 beta,
+                                          T*                          y_tmp,
+                                          hipEvent_t*                 events,
+                                          float*                      times)
+{
+    hipStream_t stream = handle->stream;
+
+    bool supported[SPMV_AUTOTUNE_CANDIDATES];
+
+    // Warm up, candidates that do not support the matrix are skipped
+    for(size_t i = 0; i < SPMV_AUTOTUNE_CANDIDATES; ++i)
+    {
+        supported[i] = (rocsparse_spmv_csrx_compute<I, J, T, A, X>(handle,
+                                                                   csr_trans,
+                                                                   csr_m,
+                                                                   csr_n,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   alpha,
+                                                                   mat,
+                                                                   x,
+                                                                   beta,
+                                                                   y_tmp,
+                                                                   spmv_autotune_candidates[i])
+                        == rocsparse_status_success);
+    }
+
+    RETURN_IF_HIP_ERROR(hipEventRecord(events[0], stream));
+
+    for(size_t i = 0; i < SPMV_AUTOTUNE_CANDIDATES; ++i)
+    {
+        for(int iter = 0; iter < SPMV_AUTOTUNE_ITERS && supported[i]; ++iter)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_spmv_csrx_compute<I, J, T, A, X>(handle,
+                                                            csr_trans,
+                                                            csr_m,
+                                                            csr_n,
+                                                            csr_row_ptr,
+                                                            csr_col_ind,
+                                                            alpha,
+                                                            mat,
+                                                            x,
+                                                            beta,
+                                                            y_tmp,
+                                                            spmv_autotune_candidates[i])));
+        }
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(events[i + 1], stream));
+    }
+
+    // Wait for the last candidate, all timings are available afterwards
+    RETURN_IF_HIP_ERROR(hipEventSynchronize(events[SPMV_AUTOTUNE_CANDIDATES]));
+
+    for(size_t i = 0; i < SPMV_AUTOTUNE_CANDIDATES; ++i)
+    {
+        times[i] = -1.0f;
+
+        if(supported[i])
+        {
+            RETURN_IF_HIP_ERROR(hipEventElapsedTime(&times[i], events[i], events[i + 1]));
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+// Times the CSR algorithms on the actual matrix and stores the fastest one in the
+// sparse matrix descriptor, together with the parameters it has been tuned for. The
+// metadata of all candidates must have been computed. The candidates write into the
+// scratch vector y_tmp, such that y is left untouched.
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_spmv_csrx_autotune(rocsparse_handle                 handle,
+                                              rocsparse_operation              csr_trans,
+                                              J                                csr_m,
+                                              J                                csr_n,
+                                              const I*                         csr_row_ptr,
+                                              const J*                         csr_col_ind,
+                                              const void*                      alpha,
+                                              const rocsparse_spmat_descr      mat,
+                                              const rocsparse_dnvec_descr      x,
+                                              const void*                      beta,
+                                              const rocsparse_dnvec_descr      y,
+                                              const rocsparse_spmv_tuning_key& key,
+                                              T*                               y_tmp)
+{
+    // Nothing to tune for empty matrices
+    if(csr_m == 0 || csr_n == 0 || mat->nnz == 0)
+    {
+        mat->spmv_alg   = rocsparse_spmv_alg_csr_stream;
+        mat->spmv_key   = key;
+        mat->spmv_tuned = true;
+
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(y_tmp, 0, sizeof(T) * y->size, handle->stream));
+
+    hipEvent_t events[SPMV_AUTOTUNE_CANDIDATES + 1];
+    float      times[SPMV_AUTOTUNE_CANDIDATES];
+
+    rocsparse_status status  = rocsparse_status_success;
+    size_t           nevents = 0;
+
+    // Create the events, stop at the first failure
+    for(; nevents < SPMV_AUTOTUNE_CANDIDATES + 1; ++nevents)
+    {
+        hipError_t hip_status = hipEventCreate(&events[nevents]);
+
+        if(hip_status != hipSuccess)
+        {
+            status = get_rocsparse_status_for_hip_status(hip_status);
+            break;
+        }
+    }
+
+    if(status == rocsparse_status_success)
+    {
+        status = rocsparse_spmv_csrx_time<I, J, T, A, X>(handle,
+                                                         csr_trans,
+                                                         csr_m,
+                                                         csr_n,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         alpha,
+                                                         mat,
+                                                         (const X*)x->values,
+                                                         beta,
+                                                         y_tmp,
+                                                         events,
+                                                         times);
+    }
+
+    // Release the events in reverse order on every path, keeping the first error
+    while(nevents > 0)
+    {
+        hipError_t hip_status = hipEventDestroy(events[--nevents]);
+
+        if(status == rocsparse_status_success && hip_status != hipSuccess)
+        {
+            status = get_rocsparse_status_for_hip_status(hip_status);
+        }
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(status);
+
+    rocsparse_spmv_alg best_alg  = rocsparse_spmv_alg_csr_stream;
+    float              best_time = -1.0f;
+
+    for(size_t i = 0; i < SPMV_AUTOTUNE_CANDIDATES; ++i)
+    {
+        if(times[i] >= 0.0f && (best_time < 0.0f || times[i] < best_time))
+        {
+            best_alg  = spmv_autotune_candidates[i];
+            best_time = times[i];
+        }
+    }
+
+    mat->spmv_alg   = best_alg;
+    mat->spmv_key   = key;
+    mat->spmv_tuned = true;
+
+    return rocsparse_status_success;
+}
+
+// CSR and CSC matrices are processed by the csrmv kernels, which also support matrices
+// and x vectors that are stored in a lower precision than the compute type
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_spmv_csrx_template(rocsparse_handle            handle,
+                                              rocsparse_operation         trans,
+                                              const void*                 alpha,
+                                              const rocsparse_spmat_descr mat,
+                                              const rocsparse_dnvec_descr x,
+                                              const void*                 beta,
+                                              const rocsparse_dnvec_descr y,
+                                              rocsparse_spmv_alg          alg,
+                                              size_t*                     buffer_size,
+                                              void*                       temp_buffer)
+{
+    // A CSC matrix is processed as the transpose of the CSR matrix with the same arrays
+    bool csc = (mat->format == rocsparse_format_csc);
+
+    if(csc
+       && (trans == rocsparse_operation_conjugate_transpose
+           || mat->descr->type != rocsparse_matrix_type_general))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    rocsparse_operation csr_trans = csc ? rocsparse_spmv_csc_operation(trans) : trans;
+
+    J        csr_m       = (J)(csc ? mat->cols : mat->rows);
+    J        csr_n       = (J)(csc ? mat->rows : mat->cols);
+    const I* csr_row_ptr = (const I*)(csc ? mat->col_data : mat->row_data);
+    const J* csr_col_ind = (const J*)(csc ? mat->row_data : mat->col_data);
+
+    // Parameters the algorithm of rocsparse_spmv_alg_auto is tuned for
+    rocsparse_spmv_tuning_key key
+        = rocsparse_spmv_tuning_key_create<T>(handle, trans, beta, x, y);
+
+    // If temp_buffer is nullptr, return buffer_size
+    if(temp_buffer == nullptr)
+    {
+        // We do not need a buffer
+        *buffer_size = 4;
+
+        // The analysis only depends on the sparsity pattern and the compute type, in
+        // which the merge path carry-out is stored
+        const T* csr_val = (const T*)mat->val_data;
+
+        // If algorithm 1 or default is selected and analysis step is required. This
+        // analysis re-creates the csrmv info and thus has to run before the merge path
+        // analysis. The autotuning requires the analysis of all candidate algorithms.
+        if((alg == rocsparse_spmv_alg_default || alg == rocsparse_spmv_alg_csr_adaptive
+            || alg == rocsparse_spmv_alg_auto)
+           && mat->analysed == false)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrmv_analysis_template(handle,
+                                                   csr_trans,
+                                                   csr_m,
+                                                   csr_n,
+                                                   (I)mat->nnz,
+                                                   mat->descr,
+                                                   csr_val,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   mat->info)));
+
+            mat->analysed = true;
+        }
+
+        // If merge path algorithm is selected and the merge path is not yet computed
+        if((alg == rocsparse_spmv_alg_csr_merge || alg == rocsparse_spmv_alg_auto)
+           && (mat->info->csrmv_info == nullptr || mat->info->csrmv_info->merge_size == 0))
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                (rocsparse_csrmv_merge_analysis_template(handle,
+                                                         csr_trans,
+                                                         csr_m,
+                                                         csr_n,
+                                                         (I)mat->nnz,
+                                                         mat->descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         mat->info)));
+        }
+
+        // The algorithm of rocsparse_spmv_alg_auto is tuned once per set of parameters,
+        // such that the computation does not block the host
+        if(alg == rocsparse_spmv_alg_auto && !rocsparse_spmv_tuned(mat, key))
+        {
+            // Scratch vector of the candidates
+            T* y_tmp = nullptr;
+            RETURN_IF_HIP_ERROR(
+                hipMalloc((void**)&y_tmp, sizeof(T) * std::max(y->size, (int64_t)1)));
+
+            rocsparse_status status = rocsparse_spmv_csrx_autotune<I, J, T, A, X>(handle,
+                                                                                  csr_trans,
+                                                                                  csr_m,
+                                                                                  csr_n,
+                                                                                  csr_row_ptr,
+                                                                                  csr_col_ind,
+                                                                                  alpha,
+                                                                                  mat,
+                                                                                  x,
+                                                                                  beta,
+                                                                                  y,
+                                                                                  key,
+                                                                                  y_tmp);
+
+            // The timing has synchronized the stream, unless it failed
+            hipError_t hip_status = hipFree(y_tmp);
+
+            RETURN_IF_ROCSPARSE_ERROR(status);
+            RETURN_IF_HIP_ERROR(hip_status);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Run the algorithm that has been selected by the autotuning. If the parameters have
+    // changed since the tuning, the stream algorithm is run, which requires no analysis.
+    if(alg == rocsparse_spmv_alg_auto)
+    {
+        alg = rocsparse_spmv_tuned(mat, key) ? mat->spmv_alg : rocsparse_spmv_alg_csr_stream;
+    }
+
+    return rocsparse_spmv_csrx_compute<I, J, T, A, X>(handle,
+                                                      csr_trans,
+                                                      csr_m,
+                                                      csr_n,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      alpha,
+                                                      mat,
+                                                      (const X*)x->values,
+                                                      beta,
+                                                      (T*)y->values,
+                                                      alg);
+}
 
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
@@ -43,35 +461,14 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
                                          size_t*                     buffer_size,
                                          void*                       temp_buffer)
 {
-    // If temp_buffer is nullptr, return buffer_size
-    if(temp_buffer == nullptr)
+    // If temp_buffer is nullptr, return buffer_size. CSR and CSC matrices are analysed
+    // by the csrmv kernels.
+    if(temp_buffer == nullptr && mat->format != rocsparse_format_csr
+       && mat->format != rocsparse_format_csc)
     {
         // We do not need a buffer
         *buffer_size = 4;
 
-        // Run CSR analysis step when format is CSR
-        if(mat->format == rocsparse_format_csr)
-        {
-            // If algorithm 1 or default is selected and analysis step is required
-            if((alg == rocsparse_spmv_alg_default || alg == rocsparse_spmv_alg_csr_adaptive)
-               && mat->analysed == false)
-            {
-                RETURN_IF_ROCSPARSE_ERROR(
-                    (rocsparse_csrmv_analysis_template(handle,
-                                                       trans,
-                                                       (J)mat->rows,
-                                                       (J)mat->cols,
-                                                       (I)mat->nnz,
-                                                       mat->descr,
-                                                       (const T*)mat->val_data,
-                                                       (const I*)mat->row_data,
-                                                       (const J*)mat->col_data,
-                                                       mat->info)));
-
-                mat->analysed = true;
-            }
-        }
-
         return rocsparse_status_success;
     }
 
@@ -111,24 +508,12 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
                                             (T*)y->values);
     }
 
-        // CSR
+        // CSR and CSC
     case rocsparse_format_csr:
+    case rocsparse_format_csc:
     {
-        return rocsparse_csrmv_template(handle,
-                                        trans,
-                                        (J)mat->rows,
-                                        (J)mat->cols,
-                                        (I)mat->nnz,
-                                        (const T*)alpha,
-                                        mat->descr,
-                                        (const T*)mat->val_data,
-                                        (const I*)mat->row_data,
-                                        (const J*)mat->col_data,
-                                        (alg == rocsparse_spmv_alg_csr_stream) ? nullptr
-                                                                               : mat->info,
-                                        (const T*)x->values,
-                                        (const T*)beta,
-                                        (T*)y->values);
+        return rocsparse_spmv_csrx_template<I, J, T, T, T>(
+            handle, trans, alpha, mat, x, beta, y, alg, buffer_size, temp_buffer);
     }
 
         // ELL
@@ -148,12 +533,49 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
                                         (T*)y->values);
     }
 
-        // CSC
-    case rocsparse_format_csc:
+        // BSR
+    case rocsparse_format_bsr:
     {
-        // LCOV_EXCL_START
-        return rocsparse_status_not_implemented;
-        // LCOV_EXCL_STOP
+        // The blocked kernels only support 32 bit indexing
+        if(!std::is_same<I, rocsparse_int>() || !std::is_same<J, rocsparse_int>())
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        return rocsparse_bsrmv_template(handle,
+                                        mat->block_dir,
+                                        trans,
+                                        (rocsparse_int)mat->rows,
+                                        (rocsparse_int)mat->cols,
+                                        (rocsparse_int)mat->nnz,
+                                        (const T*)alpha,
+                                        mat->descr,
+                                        (const T*)mat->val_data,
+                                        (const rocsparse_int*)mat->row_data,
+                                        (const rocsparse_int*)mat->col_data,
+                                        (rocsparse_int)mat->block_dim,
+                                        (const T*)x->values,
+                                        (const T*)beta,
+                                        (T*)y->values);
+    }
+
+        // SELL
+    case rocsparse_format_sell:
+    {
+        return rocsparse_sellcmv_template(handle,
+                                          trans,
+                                          (J)mat->rows,
+                                          (J)mat->cols,
+                                          (J)mat->slice_size,
+                                          (const T*)alpha,
+                                          mat->descr,
+                                          (const T*)mat->val_data,
+                                          (const I*)mat->row_data,
+                                          (const J*)mat->ind_data,
+                                          (const J*)mat->col_data,
+                                          (const T*)x->values,
+                                          (const T*)beta,
+                                          (T*)y->values);
     }
     }
 
@@ -162,12 +584,126 @@ rocsparse_status rocsparse_spmv_template(rocsparse_handle            handle,
     // LCOV_EXCL_STOP
 }
 
+// Mixed precision, where the matrix and x are stored in a lower precision than the
+// compute type. y is stored in the compute type.
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_spmv_mixed_template(rocsparse_handle            handle,
+                                               rocsparse_operation         trans,
+                                               const void*                 alpha,
+                                               const rocsparse_spmat_descr mat,
+                                               const rocsparse_dnvec_descr x,
+                                               const void*                 beta,
+                                               const rocsparse_dnvec_descr y,
+                                               rocsparse_spmv_alg          alg,
+                                               size_t*                     buffer_size,
+                                               void*                       temp_buffer)
+{
+    // Mixed precision is only supported for CSR and CSC matrices
+    if(mat->format != rocsparse_format_csr && mat->format != rocsparse_format_csc)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_spmv_csrx_template<I, J, T, A, X>(
+        handle, trans, alpha, mat, x, beta, y, alg, buffer_size, temp_buffer);
+}
+
+template <typename T, typename A, typename X, typename... Ts>
+rocsparse_status rocsparse_spmv_mixed_dispatch(rocsparse_indextype itype,
+                                               rocsparse_indextype jtype,
+                                               Ts&&... ts)
+{
+    if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmv_mixed_template<int32_t, int32_t, T, A, X>(ts...);
+    }
+    else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmv_mixed_template<int64_t, int32_t, T, A, X>(ts...);
+    }
+    else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64)
+    {
+        return rocsparse_spmv_mixed_template<int64_t, int64_t, T, A, X>(ts...);
+    }
+
+    return rocsparse_status_not_implemented;
+}
+
 template <typename... Ts>
 rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
                                                  rocsparse_indextype jtype,
+                                                 rocsparse_datatype  atype,
+                                                 rocsparse_datatype  xtype,
+                                                 rocsparse_datatype  ytype,
                                                  rocsparse_datatype  ctype,
                                                  Ts&&... ts)
 {
+    // Mixed precision
+    if(atype != ctype || xtype != ctype || ytype != ctype)
+    {
+        // y is always stored in the compute type
+        if(ytype != ctype)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        // i8 matrix and i8 or f32 vector with f32 computation
+        if(ctype == rocsparse_datatype_f32_r && atype == rocsparse_datatype_i8_r
+           && xtype == rocsparse_datatype_i8_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<float, int8_t, int8_t>(itype, jtype, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && atype == rocsparse_datatype_i8_r
+           && xtype == rocsparse_datatype_f32_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<float, int8_t, float>(itype, jtype, ts...);
+        }
+
+        // f16 or bf16 matrix and f16, bf16 or f32 vector with f32 computation
+        if(ctype == rocsparse_datatype_f32_r && atype == rocsparse_datatype_f16_r
+           && xtype == rocsparse_datatype_f16_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<float, _Float16, _Float16>(itype, jtype, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && atype == rocsparse_datatype_f16_r
+           && xtype == rocsparse_datatype_f32_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<float, _Float16, float>(itype, jtype, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && atype == rocsparse_datatype_bf16_r
+           && xtype == rocsparse_datatype_bf16_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<float, hip_bfloat16, hip_bfloat16>(
+                itype, jtype, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && atype == rocsparse_datatype_bf16_r
+           && xtype == rocsparse_datatype_f32_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<float, hip_bfloat16, float>(itype, jtype, ts...);
+        }
+
+        // f32 matrix and f64 vectors with f64 computation
+        if(ctype == rocsparse_datatype_f64_r && atype == rocsparse_datatype_f32_r
+           && xtype == rocsparse_datatype_f64_r)
+        {
+            return rocsparse_spmv_mixed_dispatch<double, float, double>(itype, jtype, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f64_c && atype == rocsparse_datatype_f32_c
+           && xtype == rocsparse_datatype_f64_c)
+        {
+            return rocsparse_spmv_mixed_dispatch<rocsparse_double_complex,
+                                                 rocsparse_float_complex,
+                                                 rocsparse_double_complex>(itype, jtype, ts...);
+        }
+
+        return rocsparse_status_not_implemented;
+    }
+
     switch(ctype)
     {
 
@@ -222,6 +758,13 @@ rocsparse_status rocsparse_spmv_dynamic_dispatch(rocsparse_indextype itype,
         DATATYPE_CASE(rocsparse_datatype_f64_c, rocsparse_double_complex);
 
 #undef DATATYPE_CASE
+
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
     // LCOV_EXCL_START
     return rocsparse_status_invalid_value;
@@ -302,24 +845,21 @@ extern "C" rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
     }
     // LCOV_EXCL_STOP
 
-    // Check for matching types while we do not support mixed precision computation
-    if(compute_type != mat->data_type || compute_type != x->data_type
-       || compute_type != y->data_type)
-    {
-        return rocsparse_status_not_implemented;
-    }
-
-    return rocsparse_spmv_dynamic_dispatch(mat->row_type,
-                                           mat->col_type,
-                                           compute_type,
-                                           handle,
-                                           trans,
-                                           alpha,
-                                           mat,
-                                           x,
-                                           beta,
-                                           y,
-                                           alg,
-                                           buffer_size,
-                                           temp_buffer);
+    return rocsparse_spmv_dynamic_dispatch(
+        (mat->format == rocsparse_format_csc) ? mat->col_type : mat->row_type,
+        (mat->format == rocsparse_format_csc) ? mat->row_type : mat->col_type,
+        mat->data_type,
+        x->data_type,
+        y->data_type,
+        compute_type,
+        handle,
+        trans,
+        alpha,
+        mat,
+        x,
+        beta,
+        y,
+        alg,
+        buffer_size,
+        temp_buffer);
 }
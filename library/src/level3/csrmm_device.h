@@ -28,7 +28,13 @@
 
 #include "common.h"
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmnn_general_device(rocsparse_operation trans_A,
                                               rocsparse_operation trans_B,
                                               J                   M,
@@ -38,8 +44,8 @@ static __device__ void csrmmnn_general_device(rocsparse_operation trans_A,
                                               T                   alpha,
                                               const I* __restrict__ csr_row_ptr,
                                               const J* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
-                                              const T* __restrict__ B,
+                                              const A* __restrict__ csr_val,
+                                              const X* __restrict__ B,
                                               J ldb,
                                               T beta,
                                               T* __restrict__ C,
@@ -78,7 +84,7 @@ static __device__ void csrmmnn_general_device(rocsparse_operation trans_A,
         if(k < row_end)
         {
             shared_col[wid][lid] = csr_col_ind[k] - idx_base;
-            shared_val[wid][lid] = csr_val[k];
+            shared_val[wid][lid] = static_cast<T>(csr_val[k]);
         }
         else
         {
@@ -95,14 +101,17 @@ static __device__ void csrmmnn_general_device(rocsparse_operation trans_A,
                 for(J i = 0; i < WF_SIZE; ++i)
                 {
                     sum = rocsparse_fma(
-                        shared_val[wid][i], rocsparse_conj(B[shared_col[wid][i] + colB]), sum);
+                        shared_val[wid][i],
+                        rocsparse_conj(static_cast<T>(B[shared_col[wid][i] + colB])),
+                        sum);
                 }
             }
             else
             {
                 for(J i = 0; i < WF_SIZE; ++i)
                 {
-                    sum = rocsparse_fma(shared_val[wid][i], B[shared_col[wid][i] + colB], sum);
+                    sum = rocsparse_fma(
+                        shared_val[wid][i], static_cast<T>(B[shared_col[wid][i] + colB]), sum);
                 }
             }
         }
@@ -140,7 +149,9 @@ template <unsigned int BLOCKSIZE,
           unsigned int LOOPS,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmnt_general_main_device(rocsparse_operation trans_A,
                                                    rocsparse_operation trans_B,
                                                    J                   offset,
@@ -152,8 +163,8 @@ static __device__ void csrmmnt_general_main_device(rocsparse_operation trans_A,
                                                    T                   alpha,
                                                    const I* __restrict__ csr_row_ptr,
                                                    const J* __restrict__ csr_col_ind,
-                                                   const T* __restrict__ csr_val,
-                                                   const T* __restrict__ B,
+                                                   const A* __restrict__ csr_val,
+                                                   const X* __restrict__ B,
                                                    J ldb,
                                                    T beta,
                                                    T* __restrict__ C,
@@ -199,7 +210,7 @@ static __device__ void csrmmnt_general_main_device(rocsparse_operation trans_A,
             {
                 shared_col[wid][lid]
                     = ldb * (rocsparse_nontemporal_load(csr_col_ind + k) - idx_base);
-                shared_val[wid][lid] = rocsparse_nontemporal_load(csr_val + k);
+                shared_val[wid][lid] = static_cast<T>(rocsparse_nontemporal_load(csr_val + k));
             }
             else
             {
@@ -219,7 +230,10 @@ static __device__ void csrmmnt_general_main_device(rocsparse_operation trans_A,
                     for(J p = 0; p < LOOPS; p++)
                     {
                         sum[p] = rocsparse_fma(
-                            sv, rocsparse_conj(rocsparse_ldg(B + col + p * WF_SIZE + sc)), sum[p]);
+                            sv,
+                            rocsparse_conj(
+                                static_cast<T>(rocsparse_ldg(B + col + p * WF_SIZE + sc))),
+                            sum[p]);
                     }
                 }
             }
@@ -232,8 +246,8 @@ static __device__ void csrmmnt_general_main_device(rocsparse_operation trans_A,
 
                     for(J p = 0; p < LOOPS; p++)
                     {
-                        sum[p]
-                            = rocsparse_fma(sv, rocsparse_ldg(B + col + p * WF_SIZE + sc), sum[p]);
+                        sum[p] = rocsparse_fma(
+                            sv, static_cast<T>(rocsparse_ldg(B + col + p * WF_SIZE + sc)), sum[p]);
                     }
                 }
             }
@@ -278,7 +292,13 @@ static __device__ void csrmmnt_general_main_device(rocsparse_operation trans_A,
     }
 }
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmnt_general_remainder_device(rocsparse_operation trans_A,
                                                         rocsparse_operation trans_B,
                                                         J                   offset,
@@ -290,8 +310,8 @@ static __device__ void csrmmnt_general_remainder_device(rocsparse_operation tran
                                                         T                   alpha,
                                                         const I* __restrict__ csr_row_ptr,
                                                         const J* __restrict__ csr_col_ind,
-                                                        const T* __restrict__ csr_val,
-                                                        const T* __restrict__ B,
+                                                        const A* __restrict__ csr_val,
+                                                        const X* __restrict__ B,
                                                         J ldb,
                                                         T beta,
                                                         T* __restrict__ C,
@@ -331,7 +351,7 @@ static __device__ void csrmmnt_general_remainder_device(rocsparse_operation tran
             {
                 shared_col[wid][lid]
                     = ldb * (rocsparse_nontemporal_load(csr_col_ind + k) - idx_base);
-                shared_val[wid][lid] = rocsparse_nontemporal_load(csr_val + k);
+                shared_val[wid][lid] = static_cast<T>(rocsparse_nontemporal_load(csr_val + k));
             }
             else
             {
@@ -349,7 +369,8 @@ static __device__ void csrmmnt_general_remainder_device(rocsparse_operation tran
                     {
                         sum = rocsparse_fma(
                             shared_val[wid][i],
-                            rocsparse_conj(rocsparse_ldg(B + col + shared_col[wid][i])),
+                            rocsparse_conj(
+                                static_cast<T>(rocsparse_ldg(B + col + shared_col[wid][i]))),
                             sum);
                     }
                 }
@@ -358,7 +379,9 @@ static __device__ void csrmmnt_general_remainder_device(rocsparse_operation tran
                     for(J i = 0; i < WF_SIZE; ++i)
                     {
                         sum = rocsparse_fma(
-                            shared_val[wid][i], rocsparse_ldg(B + col + shared_col[wid][i]), sum);
+                            shared_val[wid][i],
+                            static_cast<T>(rocsparse_ldg(B + col + shared_col[wid][i])),
+                            sum);
                     }
                 }
             }
@@ -418,7 +441,13 @@ static __device__ void
 // See Y. Tao et al., "Atomic reduction based sparse matrix-transpose vector multiplication on GPUs,"
 // 2014 20th IEEE International Conference on Parallel and Distributed Systems (ICPADS), 2014, pp. 987-992,
 // doi: 10.1109/PADSW.2014.7097920.
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmtn_general_device(rocsparse_operation trans_A,
                                               rocsparse_operation trans_B,
                                               J                   M,
@@ -428,8 +457,8 @@ static __device__ void csrmmtn_general_device(rocsparse_operation trans_A,
                                               T                   alpha,
                                               const I* __restrict__ csr_row_ptr,
                                               const J* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
-                                              const T* __restrict__ B,
+                                              const A* __restrict__ csr_val,
+                                              const X* __restrict__ B,
                                               J ldb,
                                               T beta,
                                               T* __restrict__ C,
@@ -456,11 +485,12 @@ static __device__ void csrmmtn_general_device(rocsparse_operation trans_A,
 
     if(trans_B == rocsparse_operation_conjugate_transpose)
     {
-        shared_B[wid][lid] = (cid < N) ? rocsparse_conj(B[row + colB]) : static_cast<T>(0);
+        shared_B[wid][lid]
+            = (cid < N) ? rocsparse_conj(static_cast<T>(B[row + colB])) : static_cast<T>(0);
     }
     else
     {
-        shared_B[wid][lid] = (cid < N) ? B[row + colB] : static_cast<T>(0);
+        shared_B[wid][lid] = (cid < N) ? static_cast<T>(B[row + colB]) : static_cast<T>(0);
     }
 
     __threadfence_block();
@@ -475,11 +505,11 @@ static __device__ void csrmmtn_general_device(rocsparse_operation trans_A,
 
         if(trans_A == rocsparse_operation_conjugate_transpose)
         {
-            val = alpha * rocsparse_conj(csr_val[j]);
+            val = alpha * rocsparse_conj(static_cast<T>(csr_val[j]));
         }
         else
         {
-            val = alpha * csr_val[j];
+            val = alpha * static_cast<T>(csr_val[j]);
         }
 
         if(order == rocsparse_order_column)
@@ -502,7 +532,13 @@ static __device__ void csrmmtn_general_device(rocsparse_operation trans_A,
 // See Y. Tao et al., "Atomic reduction based sparse matrix-transpose vector multiplication on GPUs,"
 // 2014 20th IEEE International Conference on Parallel and Distributed Systems (ICPADS), 2014, pp. 987-992,
 // doi: 10.1109/PADSW.2014.7097920.
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmtt_general_device(rocsparse_operation trans_A,
                                               rocsparse_operation trans_B,
                                               J                   M,
@@ -512,8 +548,8 @@ static __device__ void csrmmtt_general_device(rocsparse_operation trans_A,
                                               T                   alpha,
                                               const I* __restrict__ csr_row_ptr,
                                               const J* __restrict__ csr_col_ind,
-                                              const T* __restrict__ csr_val,
-                                              const T* __restrict__ B,
+                                              const A* __restrict__ csr_val,
+                                              const X* __restrict__ B,
                                               J ldb,
                                               T beta,
                                               T* __restrict__ C,
@@ -538,11 +574,12 @@ static __device__ void csrmmtt_general_device(rocsparse_operation trans_A,
 
     if(trans_B == rocsparse_operation_conjugate_transpose)
     {
-        shared_B[wid][lid] = (cid < N) ? rocsparse_conj(B[ldb * row + cid]) : static_cast<T>(0);
+        shared_B[wid][lid]
+            = (cid < N) ? rocsparse_conj(static_cast<T>(B[ldb * row + cid])) : static_cast<T>(0);
     }
     else
     {
-        shared_B[wid][lid] = (cid < N) ? B[ldb * row + cid] : static_cast<T>(0);
+        shared_B[wid][lid] = (cid < N) ? static_cast<T>(B[ldb * row + cid]) : static_cast<T>(0);
     }
 
     __threadfence_block();
@@ -557,11 +594,11 @@ static __device__ void csrmmtt_general_device(rocsparse_operation trans_A,
 
         if(trans_A == rocsparse_operation_conjugate_transpose)
         {
-            val = alpha * rocsparse_conj(csr_val[j]);
+            val = alpha * rocsparse_conj(static_cast<T>(csr_val[j]));
         }
         else
         {
-            val = alpha * csr_val[j];
+            val = alpha * static_cast<T>(csr_val[j]);
         }
 
         if(order == rocsparse_order_column)
@@ -581,4 +618,88 @@ static __device__ void csrmmtt_general_device(rocsparse_operation trans_A,
     }
 }
 
+// Symmetric and Hermitian matrices only store the triangle selected by the fill
+// mode (including the diagonal). Each wavefront processes one row of A and each
+// lane one column of C. The stored triangle is gathered into the row of C while
+// the mirrored triangle, which is not stored, is scattered into C.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
+static __device__ void csrmm_symm_general_device(bool                conj_direct,
+                                                 bool                conj_mirror,
+                                                 rocsparse_fill_mode fill_mode,
+                                                 rocsparse_operation trans_B,
+                                                 J                   M,
+                                                 J                   N,
+                                                 T                   alpha,
+                                                 const I* __restrict__ csr_row_ptr,
+                                                 const J* __restrict__ csr_col_ind,
+                                                 const A* __restrict__ csr_val,
+                                                 const X* __restrict__ B,
+                                                 J ldb,
+                                                 T* __restrict__ C,
+                                                 J                    ldc,
+                                                 rocsparse_order      order,
+                                                 rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    J   gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    int lid = gid & (WF_SIZE - 1);
+    J   row = gid / WF_SIZE;
+    J   col = lid + hipBlockIdx_y * WF_SIZE;
+
+    if(row >= M || col >= N)
+    {
+        return;
+    }
+
+    // Strides between consecutive rows and columns of op(B) and C
+    bool colB   = (order == rocsparse_order_column) == (trans_B == rocsparse_operation_none);
+    J    incB_r = colB ? 1 : ldb;
+    J    incB_c = colB ? ldb : 1;
+    J    incC_r = (order == rocsparse_order_column) ? 1 : ldc;
+    J    incC_c = (order == rocsparse_order_column) ? ldc : 1;
+
+    bool conj_B = (trans_B == rocsparse_operation_conjugate_transpose);
+
+    T B_row = static_cast<T>(B[row * incB_r + col * incB_c]);
+    B_row   = alpha * (conj_B ? rocsparse_conj(B_row) : B_row);
+
+    I row_start = csr_row_ptr[row] - idx_base;
+    I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(I j = row_start; j < row_end; ++j)
+    {
+        J k = csr_col_ind[j] - idx_base;
+
+        // Entries outside of the stored triangle are ignored
+        if((fill_mode == rocsparse_fill_mode_lower && k > row)
+           || (fill_mode == rocsparse_fill_mode_upper && k < row))
+        {
+            continue;
+        }
+
+        T val = static_cast<T>(csr_val[j]);
+        T B_k = static_cast<T>(B[k * incB_r + col * incB_c]);
+
+        sum = rocsparse_fma(
+            conj_direct ? rocsparse_conj(val) : val, conj_B ? rocsparse_conj(B_k) : B_k, sum);
+
+        // Mirrored entry of the triangle that is not stored
+        if(k != row)
+        {
+            atomicAdd(&C[k * incC_r + col * incC_c],
+                      (conj_mirror ? rocsparse_conj(val) : val) * B_row);
+        }
+    }
+
+    atomicAdd(&C[row * incC_r + col * incC_c], alpha * sum);
+}
+
 #endif // CSRMM_DEVICE_H
@@ -36,7 +36,9 @@ template <unsigned int BLOCKSIZE,
           unsigned int LOOPS,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmnn_row_split_device(rocsparse_operation trans_A,
                                                 rocsparse_operation trans_B,
                                                 J                   offset,
@@ -47,8 +49,8 @@ static __device__ void csrmmnn_row_split_device(rocsparse_operation trans_A,
                                                 T                   alpha,
                                                 const I* __restrict__ csr_row_ptr,
                                                 const J* __restrict__ csr_col_ind,
-                                                const T* __restrict__ csr_val,
-                                                const T* __restrict__ B,
+                                                const A* __restrict__ csr_val,
+                                                const X* __restrict__ B,
                                                 J ldb,
                                                 T beta,
                                                 T* __restrict__ C,
@@ -75,21 +77,24 @@ static __device__ void csrmmnn_row_split_device(rocsparse_operation trans_A,
     for(I j = row_start + lid; j < row_end; j += WF_SIZE)
     {
         J col = csr_col_ind[j] - idx_base;
-        T val = csr_val[j];
+        T val = static_cast<T>(csr_val[j]);
 
         if(trans_B == rocsparse_operation_conjugate_transpose)
         {
             for(J p = 0; p < LOOPS; p++)
             {
                 sum[p] = rocsparse_fma(
-                    val, rocsparse_conj(rocsparse_ldg(B + col + (colB + p) * ldb)), sum[p]);
+                    val,
+                    rocsparse_conj(static_cast<T>(rocsparse_ldg(B + col + (colB + p) * ldb))),
+                    sum[p]);
             }
         }
         else
         {
             for(J p = 0; p < LOOPS; p++)
             {
-                sum[p] = rocsparse_fma(val, rocsparse_ldg(B + col + (colB + p) * ldb), sum[p]);
+                sum[p] = rocsparse_fma(
+                    val, static_cast<T>(rocsparse_ldg(B + col + (colB + p) * ldb)), sum[p]);
             }
         }
     }
@@ -148,7 +153,9 @@ template <unsigned int BLOCKSIZE,
           unsigned int LOOPS,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmnt_row_split_main_device(rocsparse_operation trans_A,
                                                      rocsparse_operation trans_B,
                                                      J                   offset,
@@ -160,8 +167,8 @@ static __device__ void csrmmnt_row_split_main_device(rocsparse_operation trans_A
                                                      T                   alpha,
                                                      const I* __restrict__ csr_row_ptr,
                                                      const J* __restrict__ csr_col_ind,
-                                                     const T* __restrict__ csr_val,
-                                                     const T* __restrict__ B,
+                                                     const A* __restrict__ csr_val,
+                                                     const X* __restrict__ B,
                                                      J ldb,
                                                      T beta,
                                                      T* __restrict__ C,
@@ -203,7 +210,7 @@ static __device__ void csrmmnt_row_split_main_device(rocsparse_operation trans_A
             if(k < row_end)
             {
                 col = ldb * (rocsparse_nontemporal_load(csr_col_ind + k) - idx_base);
-                val = rocsparse_nontemporal_load(csr_val + k);
+                val = static_cast<T>(rocsparse_nontemporal_load(csr_val + k));
             }
             else
             {
@@ -221,7 +228,10 @@ static __device__ void csrmmnt_row_split_main_device(rocsparse_operation trans_A
                     for(J p = 0; p < LOOPS; p++)
                     {
                         sum[p] = rocsparse_fma(
-                            v, rocsparse_conj(rocsparse_ldg(B + colB + p * WF_SIZE + c)), sum[p]);
+                            v,
+                            rocsparse_conj(
+                                static_cast<T>(rocsparse_ldg(B + colB + p * WF_SIZE + c))),
+                            sum[p]);
                     }
                 }
             }
@@ -234,8 +244,8 @@ static __device__ void csrmmnt_row_split_main_device(rocsparse_operation trans_A
 
                     for(J p = 0; p < LOOPS; p++)
                     {
-                        sum[p]
-                            = rocsparse_fma(v, rocsparse_ldg(B + colB + p * WF_SIZE + c), sum[p]);
+                        sum[p] = rocsparse_fma(
+                            v, static_cast<T>(rocsparse_ldg(B + colB + p * WF_SIZE + c)), sum[p]);
                     }
                 }
             }
@@ -283,7 +293,13 @@ static __device__ void csrmmnt_row_split_main_device(rocsparse_operation trans_A
 // See Yang C., Bulu? A., Owens J.D. (2018) Design Principles for Sparse Matrix Multiplication on the GPU.
 // In: Aldinucci M., Padovani L., Torquati M. (eds) Euro-Par 2018: Parallel Processing. Euro-Par 2018.
 // Lecture Notes in Computer Science, vol 11014. Springer, Cham. https://doi.org/10.1007/978-3-319-96983-1_48
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X>
 static __device__ void csrmmnt_row_split_remainder_device(rocsparse_operation trans_A,
                                                           rocsparse_operation trans_B,
                                                           J                   offset,
@@ -295,8 +311,8 @@ static __device__ void csrmmnt_row_split_remainder_device(rocsparse_operation tr
                                                           T                   alpha,
                                                           const I* __restrict__ csr_row_ptr,
                                                           const J* __restrict__ csr_col_ind,
-                                                          const T* __restrict__ csr_val,
-                                                          const T* __restrict__ B,
+                                                          const A* __restrict__ csr_val,
+                                                          const X* __restrict__ B,
                                                           J ldb,
                                                           T beta,
                                                           T* __restrict__ C,
@@ -332,7 +348,7 @@ static __device__ void csrmmnt_row_split_remainder_device(rocsparse_operation tr
             if(k < row_end)
             {
                 col = ldb * (rocsparse_nontemporal_load(csr_col_ind + k) - idx_base);
-                val = rocsparse_nontemporal_load(csr_val + k);
+                val = static_cast<T>(rocsparse_nontemporal_load(csr_val + k));
             }
             else
             {
@@ -346,10 +362,11 @@ static __device__ void csrmmnt_row_split_remainder_device(rocsparse_operation tr
                 {
                     T v = rocsparse_shfl(val, i, WF_SIZE);
                     J c = __shfl(col, i, WF_SIZE);
-                    sum = rocsparse_fma(v,
-                                        (colB < ncol) ? rocsparse_conj(rocsparse_ldg(B + colB + c))
-                                                      : static_cast<T>(0),
-                                        sum);
+                    sum = rocsparse_fma(
+                        v,
+                        (colB < ncol) ? rocsparse_conj(static_cast<T>(rocsparse_ldg(B + colB + c)))
+                                      : static_cast<T>(0),
+                        sum);
                 }
             }
             else
@@ -359,7 +376,10 @@ static __device__ void csrmmnt_row_split_remainder_device(rocsparse_operation tr
                     T v = rocsparse_shfl(val, i, WF_SIZE);
                     J c = __shfl(col, i, WF_SIZE);
                     sum = rocsparse_fma(
-                        v, (colB < ncol) ? rocsparse_ldg(B + colB + c) : static_cast<T>(0), sum);
+                        v,
+                        (colB < ncol) ? static_cast<T>(rocsparse_ldg(B + colB + c))
+                                      : static_cast<T>(0),
+                        sum);
                 }
             }
         }
@@ -408,6 +408,33 @@ rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,
     }
 }
 
+#define INSTANTIATE(TTYPE)                                                                    \
+    template rocsparse_status rocsparse_bsrmm_template(rocsparse_handle          handle,      \
+                                                       rocsparse_direction       dir,         \
+                                                       rocsparse_operation       trans_A,     \
+                                                       rocsparse_operation       trans_B,     \
+                                                       rocsparse_int             mb,          \
+                                                       rocsparse_int             n,           \
+                                                       rocsparse_int             kb,          \
+                                                       rocsparse_int             nnzb,        \
+                                                       const TTYPE*              alpha,       \
+                                                       const rocsparse_mat_descr descr,       \
+                                                       const TTYPE*              bsr_val,     \
+                                                       const rocsparse_int*      bsr_row_ptr, \
+                                                       const rocsparse_int*      bsr_col_ind, \
+                                                       rocsparse_int             block_dim,   \
+                                                       const TTYPE*              B,           \
+                                                       rocsparse_int             ldb,         \
+                                                       const TTYPE*              beta,        \
+                                                       TTYPE*                    C,           \
+                                                       rocsparse_int             ldc);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
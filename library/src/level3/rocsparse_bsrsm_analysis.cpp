@@ -168,7 +168,8 @@ rocsparse_status rocsparse_bsrsm_analysis_template(rocsparse_handle          han
                                                              ? info->bsrsm_upper_info
                                                              : info->bsrsmt_upper_info,
                                                          &info->zero_pivot,
-                                                         temp_buffer));
+                                                         temp_buffer,
+                                                         false));
     }
     else
     {
@@ -244,7 +245,8 @@ rocsparse_status rocsparse_bsrsm_analysis_template(rocsparse_handle          han
                                                              ? info->bsrsm_lower_info
                                                              : info->bsrsmt_lower_info,
                                                          &info->zero_pivot,
-                                                         temp_buffer));
+                                                         temp_buffer,
+                                                         false));
     }
 
     return rocsparse_status_success;
@@ -373,6 +373,12 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_value;
     }
 
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
     if(order_B != order_C)
     {
         return rocsparse_status_invalid_value;
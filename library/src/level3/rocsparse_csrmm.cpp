@@ -93,8 +93,8 @@ rocsparse_status rocsparse_csrmm_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_value;
     }
 
-    // Check index base
-    if(descr->type != rocsparse_matrix_type_general)
+    // Check matrix type
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -106,6 +106,12 @@ rocsparse_status rocsparse_csrmm_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices need to be square
+    if(descr->type != rocsparse_matrix_type_general && m != k)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || k == 0 || nnz == 0)
     {
@@ -196,8 +202,8 @@ rocsparse_status rocsparse_csrmm_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_value;
     }
 
-    // Check index base
-    if(descr->type != rocsparse_matrix_type_general)
+    // Check matrix type
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -209,6 +215,12 @@ rocsparse_status rocsparse_csrmm_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices need to be square
+    if(descr->type != rocsparse_matrix_type_general && m != k)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || k == 0 || nnz == 0)
     {
@@ -222,6 +234,12 @@ rocsparse_status rocsparse_csrmm_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Symmetric and Hermitian matrices do not require any analysis
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_success;
+    }
+
     switch(alg)
     {
     case rocsparse_csrmm_alg_merge:
@@ -253,7 +271,7 @@ rocsparse_status rocsparse_csrmm_analysis_template(rocsparse_handle          han
     }
 }
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          handle,
                                                   rocsparse_operation       trans_A,
                                                   rocsparse_operation       trans_B,
@@ -264,16 +282,16 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                                   I                         nnz,
                                                   U                         alpha_device_host,
                                                   const rocsparse_mat_descr descr,
-                                                  const T*                  csr_val,
+                                                  const A*                  csr_val,
                                                   const I*                  csr_row_ptr,
                                                   const J*                  csr_col_ind,
-                                                  const T*                  B,
+                                                  const X*                  B,
                                                   J                         ldb,
                                                   U                         beta_device_host,
                                                   T*                        C,
                                                   J                         ldc);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          handle,
                                                     rocsparse_operation       trans_A,
                                                     rocsparse_operation       trans_B,
@@ -284,16 +302,16 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                                     I                         nnz,
                                                     U                         alpha_device_host,
                                                     const rocsparse_mat_descr descr,
-                                                    const T*                  csr_val,
+                                                    const A*                  csr_val,
                                                     const I*                  csr_row_ptr,
                                                     const J*                  csr_col_ind,
-                                                    const T*                  B,
+                                                    const X*                  B,
                                                     J                         ldb,
                                                     U                         beta_device_host,
                                                     T*                        C,
                                                     J                         ldc);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle,
                                                 rocsparse_operation       trans_A,
                                                 rocsparse_operation       trans_B,
@@ -304,17 +322,37 @@ rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle
                                                 I                         nnz,
                                                 U                         alpha_device_host,
                                                 const rocsparse_mat_descr descr,
-                                                const T*                  csr_val,
+                                                const A*                  csr_val,
                                                 const I*                  csr_row_ptr,
                                                 const J*                  csr_col_ind,
-                                                const T*                  B,
+                                                const X*                  B,
                                                 J                         ldb,
                                                 U                         beta_device_host,
                                                 T*                        C,
                                                 J                         ldc,
                                                 void*                     temp_buffer);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+rocsparse_status rocsparse_csrmm_template_symm(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_order           order,
+                                               J                         m,
+                                               J                         n,
+                                               J                         k,
+                                               I                         nnz,
+                                               U                         alpha_device_host,
+                                               const rocsparse_mat_descr descr,
+                                               const A*                  csr_val,
+                                               const I*                  csr_row_ptr,
+                                               const J*                  csr_col_ind,
+                                               const X*                  B,
+                                               J                         ldb,
+                                               U                         beta_device_host,
+                                               T*                        C,
+                                               J                         ldc);
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_operation       trans_A,
                                                    rocsparse_operation       trans_B,
@@ -326,16 +364,39 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                    I                         nnz,
                                                    U                         alpha_device_host,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const A*                  csr_val,
                                                    const I*                  csr_row_ptr,
                                                    const J*                  csr_col_ind,
-                                                   const T*                  B,
+                                                   const X*                  B,
                                                    J                         ldb,
                                                    U                         beta_device_host,
                                                    T*                        C,
                                                    J                         ldc,
                                                    void*                     temp_buffer)
 {
+    // Symmetric and Hermitian matrices only store one triangle
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_csrmm_template_symm(handle,
+                                             trans_A,
+                                             trans_B,
+                                             order,
+                                             m,
+                                             n,
+                                             k,
+                                             nnz,
+                                             alpha_device_host,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             B,
+                                             ldb,
+                                             beta_device_host,
+                                             C,
+                                             ldc);
+    }
+
     switch(alg)
     {
 
@@ -464,7 +525,7 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
     }
 }
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A, typename X>
 rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans_A,
                                           rocsparse_operation       trans_B,
@@ -477,10 +538,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           I                         nnz,
                                           const T*                  alpha_device_host,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  csr_val,
+                                          const A*                  csr_val,
                                           const I*                  csr_row_ptr,
                                           const J*                  csr_col_ind,
-                                          const T*                  B,
+                                          const X*                  B,
                                           J                         ldb,
                                           const T*                  beta_device_host,
                                           T*                        C,
@@ -532,7 +593,7 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_value;
     }
 
-    if(descr->type != rocsparse_matrix_type_general)
+    if(descr->type == rocsparse_matrix_type_triangular)
     {
         // TODO
         return rocsparse_status_not_implemented;
@@ -549,6 +610,12 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Symmetric and Hermitian matrices need to be square
+    if(descr->type != rocsparse_matrix_type_general && m != k)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
     // Quick return if possible
     if(m == 0 || n == 0 || k == 0)
     {
@@ -678,6 +745,17 @@ INSTANTIATE(int64_t, int64_t, float);
 INSTANTIATE(int64_t, int64_t, double);
 INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, int8_t);
+INSTANTIATE(int32_t, int32_t, _Float16);
+INSTANTIATE(int32_t, int32_t, hip_bfloat16);
+INSTANTIATE(int64_t, int32_t, int8_t);
+INSTANTIATE(int64_t, int32_t, _Float16);
+INSTANTIATE(int64_t, int32_t, hip_bfloat16);
+INSTANTIATE(int64_t, int64_t, int8_t);
+INSTANTIATE(int64_t, int64_t, _Float16);
+INSTANTIATE(int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE
 
 #define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                              \
@@ -707,44 +785,117 @@ INSTANTIATE(int64_t, int64_t, float);
 INSTANTIATE(int64_t, int64_t, double);
 INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, int8_t);
+INSTANTIATE(int32_t, int32_t, _Float16);
+INSTANTIATE(int32_t, int32_t, hip_bfloat16);
+INSTANTIATE(int64_t, int32_t, int8_t);
+INSTANTIATE(int64_t, int32_t, _Float16);
+INSTANTIATE(int64_t, int32_t, hip_bfloat16);
+INSTANTIATE(int64_t, int64_t, int8_t);
+INSTANTIATE(int64_t, int64_t, _Float16);
+INSTANTIATE(int64_t, int64_t, hip_bfloat16);
 #undef INSTANTIATE
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                     \
-    template rocsparse_status rocsparse_csrmm_template<ITYPE, JTYPE, TTYPE>( \
-        rocsparse_handle          handle,                                    \
-        rocsparse_operation       trans_A,                                   \
-        rocsparse_operation       trans_B,                                   \
-        rocsparse_order           order_B,                                   \
-        rocsparse_order           order_C,                                   \
-        rocsparse_csrmm_alg       alg,                                       \
-        JTYPE                     m,                                         \
-        JTYPE                     n,                                         \
-        JTYPE                     k,                                         \
-        ITYPE                     nnz,                                       \
-        const TTYPE*              alpha_device_host,                         \
-        const rocsparse_mat_descr descr,                                     \
-        const TTYPE*              csr_val,                                   \
-        const ITYPE*              csr_row_ptr,                               \
-        const JTYPE*              csr_col_ind,                               \
-        const TTYPE*              B,                                         \
-        JTYPE                     ldb,                                       \
-        const TTYPE*              beta_device_host,                          \
-        TTYPE*                    C,                                         \
-        JTYPE                     ldc,                                       \
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE, ATYPE, XTYPE)                                     \
+    template rocsparse_status rocsparse_csrmm_template<ITYPE, JTYPE, TTYPE, ATYPE, XTYPE>( \
+        rocsparse_handle          handle,                                                  \
+        rocsparse_operation       trans_A,                                                 \
+        rocsparse_operation       trans_B,                                                 \
+        rocsparse_order           order_B,                                                 \
+        rocsparse_order           order_C,                                                 \
+        rocsparse_csrmm_alg       alg,                                                     \
+        JTYPE                     m,                                                       \
+        JTYPE                     n,                                                       \
+        JTYPE                     k,                                                       \
+        ITYPE                     nnz,                                                     \
+        const TTYPE*              alpha_device_host,                                       \
+        const rocsparse_mat_descr descr,                                                   \
+        const ATYPE*              csr_val,                                                 \
+        const ITYPE*              csr_row_ptr,                                             \
+        const JTYPE*              csr_col_ind,                                             \
+        const XTYPE*              B,                                                       \
+        JTYPE                     ldb,                                                     \
+        const TTYPE*              beta_device_host,                                        \
+        TTYPE*                    C,                                                       \
+        JTYPE                     ldc,                                                     \
         void*                     temp_buffer);
 
-INSTANTIATE(int32_t, int32_t, float);
-INSTANTIATE(int32_t, int32_t, double);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
-INSTANTIATE(int64_t, int32_t, float);
-INSTANTIATE(int64_t, int32_t, double);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
-INSTANTIATE(int64_t, int64_t, float);
-INSTANTIATE(int64_t, int64_t, double);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+INSTANTIATE(int32_t, int32_t, float, float, float);
+INSTANTIATE(int32_t, int32_t, double, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, float, float);
+INSTANTIATE(int64_t, int32_t, double, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, float, float);
+INSTANTIATE(int64_t, int64_t, double, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float);
+INSTANTIATE(int32_t, int32_t, double, float, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float);
+INSTANTIATE(int64_t, int32_t, double, float, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float);
+INSTANTIATE(int64_t, int64_t, double, float, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex);
 #undef INSTANTIATE
 
 /*
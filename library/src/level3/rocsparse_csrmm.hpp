@@ -63,7 +63,7 @@ rocsparse_status rocsparse_csrmm_analysis_template(rocsparse_handle          han
                                                    const J*                  csr_col_ind,
                                                    void*                     temp_buffer);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          handle,
                                                    rocsparse_operation       trans_A,
                                                    rocsparse_operation       trans_B,
@@ -75,17 +75,17 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                    I                         nnz,
                                                    U                         alpha_device_host,
                                                    const rocsparse_mat_descr descr,
-                                                   const T*                  csr_val,
+                                                   const A*                  csr_val,
                                                    const I*                  csr_row_ptr,
                                                    const J*                  csr_col_ind,
-                                                   const T*                  B,
+                                                   const X*                  B,
                                                    J                         ldb,
                                                    U                         beta_device_host,
                                                    T*                        C,
                                                    J                         ldc,
                                                    void*                     temp_buffer);
 
-template <typename I, typename J, typename T>
+template <typename I, typename J, typename T, typename A, typename X>
 rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans_A,
                                           rocsparse_operation       trans_B,
@@ -98,10 +98,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           I                         nnz,
                                           const T*                  alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T*                  csr_val,
+                                          const A*                  csr_val,
                                           const I*                  csr_row_ptr,
                                           const J*                  csr_col_ind,
-                                          const T*                  B,
+                                          const X*                  B,
                                           J                         ldb,
                                           const T*                  beta,
                                           T*                        C,
@@ -42,6 +42,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnn_general_kernel(rocsparse_operation trans_A,
@@ -53,8 +55,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                 U                   alpha_device_host,
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
-                                const T* __restrict__ csr_val,
-                                const T* __restrict__ B,
+                                const A* __restrict__ csr_val,
+                                const X* __restrict__ B,
                                 J ldb,
                                 U beta_device_host,
                                 T* __restrict__ C,
@@ -95,6 +97,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnt_general_main_kernel(rocsparse_operation trans_A,
@@ -108,8 +112,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                      U                   alpha_device_host,
                                      const I* __restrict__ csr_row_ptr,
                                      const J* __restrict__ csr_col_ind,
-                                     const T* __restrict__ csr_val,
-                                     const T* __restrict__ B,
+                                     const A* __restrict__ csr_val,
+                                     const X* __restrict__ B,
                                      J ldb,
                                      U beta_device_host,
                                      T* __restrict__ C,
@@ -150,6 +154,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnt_general_remainder_kernel(rocsparse_operation trans_A,
@@ -163,8 +169,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                           U                   alpha_device_host,
                                           const I* __restrict__ csr_row_ptr,
                                           const J* __restrict__ csr_col_ind,
-                                          const T* __restrict__ csr_val,
-                                          const T* __restrict__ B,
+                                          const A* __restrict__ csr_val,
+                                          const X* __restrict__ B,
                                           J ldb,
                                           U beta_device_host,
                                           T* __restrict__ C,
@@ -205,6 +211,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmtn_general_kernel(rocsparse_operation trans_A,
@@ -216,8 +224,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                 U                   alpha_device_host,
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
-                                const T* __restrict__ csr_val,
-                                const T* __restrict__ B,
+                                const A* __restrict__ csr_val,
+                                const X* __restrict__ B,
                                 J ldb,
                                 U beta_device_host,
                                 T* __restrict__ C,
@@ -256,6 +264,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmtt_general_kernel(rocsparse_operation trans_A,
@@ -267,8 +277,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                 U                   alpha_device_host,
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
-                                const T* __restrict__ csr_val,
-                                const T* __restrict__ B,
+                                const A* __restrict__ csr_val,
+                                const X* __restrict__ B,
                                 J ldb,
                                 U beta_device_host,
                                 T* __restrict__ C,
@@ -302,6 +312,57 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                idx_base);
 }
 
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename A,
+          typename X,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmm_symm_general_kernel(bool                conj_direct,
+                                   bool                conj_mirror,
+                                   rocsparse_fill_mode fill_mode,
+                                   rocsparse_operation trans_B,
+                                   J                   m,
+                                   J                   n,
+                                   U                   alpha_device_host,
+                                   const I* __restrict__ csr_row_ptr,
+                                   const J* __restrict__ csr_col_ind,
+                                   const A* __restrict__ csr_val,
+                                   const X* __restrict__ B,
+                                   J ldb,
+                                   T* __restrict__ C,
+                                   J                    ldc,
+                                   rocsparse_order      order,
+                                   rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+
+    if(alpha == static_cast<T>(0))
+    {
+        return;
+    }
+
+    csrmm_symm_general_device<BLOCKSIZE, WF_SIZE>(conj_direct,
+                                                  conj_mirror,
+                                                  fill_mode,
+                                                  trans_B,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  B,
+                                                  ldb,
+                                                  C,
+                                                  ldc,
+                                                  order,
+                                                  idx_base);
+}
+
 #define LAUNCH_CSRMMNN_GENERAL_KERNEL(CSRMMNN_DIM, WF_SIZE)                              \
     hipLaunchKernelGGL((csrmmnn_general_kernel<CSRMMNN_DIM, WF_SIZE>),                   \
                        dim3((WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / WF_SIZE + 1), \
@@ -378,7 +439,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                        order,                                                    \
                        descr->base);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          handle,
                                                   rocsparse_operation       trans_A,
                                                   rocsparse_operation       trans_B,
@@ -389,10 +450,10 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                                   I                         nnz,
                                                   U                         alpha_device_host,
                                                   const rocsparse_mat_descr descr,
-                                                  const T*                  csr_val,
+                                                  const A*                  csr_val,
                                                   const I*                  csr_row_ptr,
                                                   const J*                  csr_col_ind,
-                                                  const T*                  B,
+                                                  const X*                  B,
                                                   J                         ldb,
                                                   U                         beta_device_host,
                                                   T*                        C,
@@ -731,49 +792,454 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
     return rocsparse_status_success;
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE, UTYPE)                                                   \
-    template rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle    handle,        \
-                                                               rocsparse_operation trans_A,       \
-                                                               rocsparse_operation trans_B,       \
-                                                               rocsparse_order     order,         \
-                                                               JTYPE               m,             \
-                                                               JTYPE               n,             \
-                                                               JTYPE               k,             \
-                                                               ITYPE               nnz,           \
-                                                               UTYPE alpha_device_host,           \
-                                                               const rocsparse_mat_descr descr,   \
-                                                               const TTYPE*              csr_val, \
-                                                               const ITYPE* csr_row_ptr,          \
-                                                               const JTYPE* csr_col_ind,          \
-                                                               const TTYPE* B,                    \
-                                                               JTYPE        ldb,                  \
-                                                               UTYPE        beta_device_host,     \
-                                                               TTYPE*       C,                    \
-                                                               JTYPE        ldc)
-
-INSTANTIATE(int32_t, int32_t, float, float);
-INSTANTIATE(int32_t, int32_t, double, double);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex, rocsparse_double_complex);
-INSTANTIATE(int64_t, int32_t, float, float);
-INSTANTIATE(int64_t, int32_t, double, double);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, rocsparse_double_complex);
-INSTANTIATE(int64_t, int64_t, float, float);
-INSTANTIATE(int64_t, int64_t, double, double);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex, rocsparse_double_complex);
-
-INSTANTIATE(int32_t, int32_t, float, const float*);
-INSTANTIATE(int32_t, int32_t, double, const double*);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
-INSTANTIATE(int64_t, int32_t, float, const float*);
-INSTANTIATE(int64_t, int32_t, double, const double*);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
-INSTANTIATE(int64_t, int64_t, float, const float*);
-INSTANTIATE(int64_t, int64_t, double, const double*);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex, const rocsparse_double_complex*);
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+rocsparse_status rocsparse_csrmm_template_symm(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_order           order,
+                                               J                         m,
+                                               J                         n,
+                                               J                         k,
+                                               I                         nnz,
+                                               U                         alpha_device_host,
+                                               const rocsparse_mat_descr descr,
+                                               const A*                  csr_val,
+                                               const I*                  csr_row_ptr,
+                                               const J*                  csr_col_ind,
+                                               const X*                  B,
+                                               J                         ldb,
+                                               U                         beta_device_host,
+                                               T*                        C,
+                                               J                         ldc)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // A symmetric matrix equals its transpose and a Hermitian matrix equals its conjugate
+    // transpose. Depending on the operation, the stored triangle (direct) and the mirrored
+    // triangle that is not stored thus need to be conjugated.
+    bool symmetric   = (descr->type == rocsparse_matrix_type_symmetric);
+    bool conj_direct = symmetric ? (trans_A == rocsparse_operation_conjugate_transpose)
+                                 : (trans_A == rocsparse_operation_transpose);
+    bool conj_mirror = symmetric ? (trans_A == rocsparse_operation_conjugate_transpose)
+                                 : (trans_A != rocsparse_operation_transpose);
+
+#define CSRMM_SYMM_DIM 256
+#define WF_SIZE 8
+    // Scale C with beta
+    hipLaunchKernelGGL((csrmm_scale<CSRMM_SYMM_DIM, WF_SIZE>),
+                       dim3((m - 1) / CSRMM_SYMM_DIM + 1, (n - 1) / WF_SIZE + 1),
+                       dim3(CSRMM_SYMM_DIM, WF_SIZE),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       beta_device_host,
+                       C,
+                       ldc,
+                       order);
+
+    hipLaunchKernelGGL((csrmm_symm_general_kernel<CSRMM_SYMM_DIM, WF_SIZE>),
+                       dim3((WF_SIZE * m - 1) / CSRMM_SYMM_DIM + 1, (n - 1) / WF_SIZE + 1),
+                       dim3(CSRMM_SYMM_DIM),
+                       0,
+                       stream,
+                       conj_direct,
+                       conj_mirror,
+                       descr->fill_mode,
+                       trans_B,
+                       m,
+                       n,
+                       alpha_device_host,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       B,
+                       ldb,
+                       C,
+                       ldc,
+                       order,
+                       descr->base);
+#undef CSRMM_SYMM_DIM
+#undef WF_SIZE
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE, ATYPE, XTYPE, UTYPE)   \
+    template rocsparse_status rocsparse_csrmm_template_general( \
+        rocsparse_handle          handle,                       \
+        rocsparse_operation       trans_A,                      \
+        rocsparse_operation       trans_B,                      \
+        rocsparse_order           order,                        \
+        JTYPE                     m,                            \
+        JTYPE                     n,                            \
+        JTYPE                     k,                            \
+        ITYPE                     nnz,                          \
+        UTYPE                     alpha_device_host,            \
+        const rocsparse_mat_descr descr,                        \
+        const ATYPE*              csr_val,                      \
+        const ITYPE*              csr_row_ptr,                  \
+        const JTYPE*              csr_col_ind,                  \
+        const XTYPE*              B,                            \
+        JTYPE                     ldb,                          \
+        UTYPE                     beta_device_host,             \
+        TTYPE*                    C,                            \
+        JTYPE                     ldc);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, float);
+INSTANTIATE(int32_t, int32_t, double, double, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, float, float, float);
+INSTANTIATE(int64_t, int32_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, float, float, float);
+INSTANTIATE(int64_t, int64_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int32_t, int32_t, double, float, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int32_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int64_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+#undef INSTANTIATE
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE, ATYPE, XTYPE, UTYPE) \
+    template rocsparse_status rocsparse_csrmm_template_symm(  \
+        rocsparse_handle          handle,                     \
+        rocsparse_operation       trans_A,                    \
+        rocsparse_operation       trans_B,                    \
+        rocsparse_order           order,                      \
+        JTYPE                     m,                          \
+        JTYPE                     n,                          \
+        JTYPE                     k,                          \
+        ITYPE                     nnz,                        \
+        UTYPE                     alpha_device_host,          \
+        const rocsparse_mat_descr descr,                      \
+        const ATYPE*              csr_val,                    \
+        const ITYPE*              csr_row_ptr,                \
+        const JTYPE*              csr_col_ind,                \
+        const XTYPE*              B,                          \
+        JTYPE                     ldb,                        \
+        UTYPE                     beta_device_host,           \
+        TTYPE*                    C,                          \
+        JTYPE                     ldc);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, float);
+INSTANTIATE(int32_t, int32_t, double, double, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, float, float, float);
+INSTANTIATE(int64_t, int32_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, float, float, float);
+INSTANTIATE(int64_t, int64_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int32_t, int32_t, double, float, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int32_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int64_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
 #undef INSTANTIATE
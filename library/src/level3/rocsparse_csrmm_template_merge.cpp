@@ -26,26 +26,47 @@
 
 #include "rocsparse_coomm.hpp"
 
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans_A,
+                                                  rocsparse_operation       trans_B,
+                                                  rocsparse_order           order,
+                                                  J                         m,
+                                                  J                         n,
+                                                  J                         k,
+                                                  I                         nnz,
+                                                  U                         alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const A*                  csr_val,
+                                                  const I*                  csr_row_ptr,
+                                                  const J*                  csr_col_ind,
+                                                  const X*                  B,
+                                                  J                         ldb,
+                                                  U                         beta_device_host,
+                                                  T*                        C,
+                                                  J                         ldc);
+
+// The segmented COO kernels require the matrix and B to be stored in the compute type
 template <typename I, typename J, typename T, typename U>
-rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle,
-                                                rocsparse_operation       trans_A,
-                                                rocsparse_operation       trans_B,
-                                                rocsparse_order           order,
-                                                J                         m,
-                                                J                         n,
-                                                J                         k,
-                                                I                         nnz,
-                                                U                         alpha_device_host,
-                                                const rocsparse_mat_descr descr,
-                                                const T*                  csr_val,
-                                                const I*                  csr_row_ptr,
-                                                const J*                  csr_col_ind,
-                                                const T*                  B,
-                                                J                         ldb,
-                                                U                         beta_device_host,
-                                                T*                        C,
-                                                J                         ldc,
-                                                void*                     temp_buffer)
+static rocsparse_status rocsparse_csrmm_merge_segmented(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans_A,
+                                                        rocsparse_operation       trans_B,
+                                                        rocsparse_order           order,
+                                                        J                         m,
+                                                        J                         n,
+                                                        J                         k,
+                                                        I                         nnz,
+                                                        U                         alpha_device_host,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const I*                  csr_row_ptr,
+                                                        const J*                  csr_col_ind,
+                                                        const T*                  B,
+                                                        J                         ldb,
+                                                        U                         beta_device_host,
+                                                        T*                        C,
+                                                        J                         ldc,
+                                                        void*                     temp_buffer)
 {
     // Temporary buffer entry points
     char* ptr         = reinterpret_cast<char*>(temp_buffer);
@@ -73,50 +94,276 @@ rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle
                                              ldc);
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE, UTYPE)                                                     \
-    template rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle    handle,            \
-                                                             rocsparse_operation trans_A,           \
-                                                             rocsparse_operation trans_B,           \
-                                                             rocsparse_order     order,             \
-                                                             JTYPE               m,                 \
-                                                             JTYPE               n,                 \
-                                                             JTYPE               k,                 \
-                                                             ITYPE               nnz,               \
-                                                             UTYPE               alpha_device_host, \
-                                                             const rocsparse_mat_descr descr,       \
-                                                             const TTYPE*              csr_val,     \
-                                                             const ITYPE*              csr_row_ptr, \
-                                                             const JTYPE*              csr_col_ind, \
-                                                             const TTYPE*              B,           \
-                                                             JTYPE                     ldb,         \
-                                                             UTYPE  beta_device_host,               \
-                                                             TTYPE* C,                              \
-                                                             JTYPE  ldc,                            \
-                                                             void*  temp_buffer)
+// Mixed precision falls back to the general kernels, which convert on load
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+static rocsparse_status rocsparse_csrmm_merge_segmented(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans_A,
+                                                        rocsparse_operation       trans_B,
+                                                        rocsparse_order           order,
+                                                        J                         m,
+                                                        J                         n,
+                                                        J                         k,
+                                                        I                         nnz,
+                                                        U                         alpha_device_host,
+                                                        const rocsparse_mat_descr descr,
+                                                        const A*                  csr_val,
+                                                        const I*                  csr_row_ptr,
+                                                        const J*                  csr_col_ind,
+                                                        const X*                  B,
+                                                        J                         ldb,
+                                                        U                         beta_device_host,
+                                                        T*                        C,
+                                                        J                         ldc,
+                                                        void*                     temp_buffer)
+{
+    return rocsparse_csrmm_template_general(handle,
+                                            trans_A,
+                                            trans_B,
+                                            order,
+                                            m,
+                                            n,
+                                            k,
+                                            nnz,
+                                            alpha_device_host,
+                                            descr,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            B,
+                                            ldb,
+                                            beta_device_host,
+                                            C,
+                                            ldc);
+}
+
+template <typename I, typename J, typename T, typename A, typename X, typename U>
+rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_order           order,
+                                                J                         m,
+                                                J                         n,
+                                                J                         k,
+                                                I                         nnz,
+                                                U                         alpha_device_host,
+                                                const rocsparse_mat_descr descr,
+                                                const A*                  csr_val,
+                                                const I*                  csr_row_ptr,
+                                                const J*                  csr_col_ind,
+                                                const X*                  B,
+                                                J                         ldb,
+                                                U                         beta_device_host,
+                                                T*                        C,
+                                                J                         ldc,
+                                                void*                     temp_buffer)
+{
+    return rocsparse_csrmm_merge_segmented(handle,
+                                           trans_A,
+                                           trans_B,
+                                           order,
+                                           m,
+                                           n,
+                                           k,
+                                           nnz,
+                                           alpha_device_host,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           B,
+                                           ldb,
+                                           beta_device_host,
+                                           C,
+                                           ldc,
+                                           temp_buffer);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE, ATYPE, XTYPE, UTYPE) \
+    template rocsparse_status rocsparse_csrmm_template_merge( \
+        rocsparse_handle          handle,                     \
+        rocsparse_operation       trans_A,                    \
+        rocsparse_operation       trans_B,                    \
+        rocsparse_order           order,                      \
+        JTYPE                     m,                          \
+        JTYPE                     n,                          \
+        JTYPE                     k,                          \
+        ITYPE                     nnz,                        \
+        UTYPE                     alpha_device_host,          \
+        const rocsparse_mat_descr descr,                      \
+        const ATYPE*              csr_val,                    \
+        const ITYPE*              csr_row_ptr,                \
+        const JTYPE*              csr_col_ind,                \
+        const XTYPE*              B,                          \
+        JTYPE                     ldb,                        \
+        UTYPE                     beta_device_host,           \
+        TTYPE*                    C,                          \
+        JTYPE                     ldc,                        \
+        void*                     temp_buffer);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, float);
+INSTANTIATE(int32_t, int32_t, double, double, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, float, float, float);
+INSTANTIATE(int64_t, int32_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, float, float, float);
+INSTANTIATE(int64_t, int64_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
 
-INSTANTIATE(int32_t, int32_t, float, float);
-INSTANTIATE(int32_t, int32_t, double, double);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex, rocsparse_double_complex);
-INSTANTIATE(int64_t, int32_t, float, float);
-INSTANTIATE(int64_t, int32_t, double, double);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, rocsparse_double_complex);
-INSTANTIATE(int64_t, int64_t, float, float);
-INSTANTIATE(int64_t, int64_t, double, double);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex, rocsparse_double_complex);
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int32_t, int32_t, double, float, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int32_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int64_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
 
-INSTANTIATE(int32_t, int32_t, float, const float*);
-INSTANTIATE(int32_t, int32_t, double, const double*);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
-INSTANTIATE(int64_t, int32_t, float, const float*);
-INSTANTIATE(int64_t, int32_t, double, const double*);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
-INSTANTIATE(int64_t, int64_t, float, const float*);
-INSTANTIATE(int64_t, int64_t, double, const double*);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex, const rocsparse_double_complex*);
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
 #undef INSTANTIATE
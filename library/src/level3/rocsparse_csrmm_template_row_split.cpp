@@ -32,6 +32,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnn_row_split_kernel(rocsparse_operation trans_A,
@@ -44,8 +46,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                   U                   alpha_device_host,
                                   const I* __restrict__ csr_row_ptr,
                                   const J* __restrict__ csr_col_ind,
-                                  const T* __restrict__ csr_val,
-                                  const T* __restrict__ B,
+                                  const A* __restrict__ csr_val,
+                                  const X* __restrict__ B,
                                   J ldb,
                                   U beta_device_host,
                                   T* __restrict__ C,
@@ -87,6 +89,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnt_row_split_main_kernel(rocsparse_operation trans_A,
@@ -100,8 +104,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                        U                   alpha_device_host,
                                        const I* __restrict__ csr_row_ptr,
                                        const J* __restrict__ csr_col_ind,
-                                       const T* __restrict__ csr_val,
-                                       const T* __restrict__ B,
+                                       const A* __restrict__ csr_val,
+                                       const X* __restrict__ B,
                                        J ldb,
                                        U beta_device_host,
                                        T* __restrict__ C,
@@ -143,6 +147,8 @@ template <unsigned int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename A,
+          typename X,
           typename U>
 __launch_bounds__(BLOCKSIZE) __global__
     void csrmmnt_row_split_remainder_kernel(rocsparse_operation trans_A,
@@ -156,8 +162,8 @@ __launch_bounds__(BLOCKSIZE) __global__
                                             U                   alpha_device_host,
                                             const I* __restrict__ csr_row_ptr,
                                             const J* __restrict__ csr_col_ind,
-                                            const T* __restrict__ csr_val,
-                                            const T* __restrict__ B,
+                                            const A* __restrict__ csr_val,
+                                            const X* __restrict__ B,
                                             J ldb,
                                             U beta_device_host,
                                             T* __restrict__ C,
@@ -246,7 +252,7 @@ __launch_bounds__(BLOCKSIZE) __global__
                        order,                                                      \
                        descr->base);
 
-template <typename I, typename J, typename T, typename U>
+template <typename I, typename J, typename T, typename A, typename X, typename U>
 rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          handle,
                                                     rocsparse_operation       trans_A,
                                                     rocsparse_operation       trans_B,
@@ -257,10 +263,10 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                                     I                         nnz,
                                                     U                         alpha_device_host,
                                                     const rocsparse_mat_descr descr,
-                                                    const T*                  csr_val,
+                                                    const A*                  csr_val,
                                                     const I*                  csr_row_ptr,
                                                     const J*                  csr_col_ind,
-                                                    const T*                  B,
+                                                    const X*                  B,
                                                     J                         ldb,
                                                     U                         beta_device_host,
                                                     T*                        C,
@@ -564,49 +570,191 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
     return rocsparse_status_success;
 }
 
-#define INSTANTIATE(ITYPE, JTYPE, TTYPE, UTYPE)                                                     \
-    template rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle    handle,        \
-                                                                 rocsparse_operation trans_A,       \
-                                                                 rocsparse_operation trans_B,       \
-                                                                 rocsparse_order     order,         \
-                                                                 JTYPE               m,             \
-                                                                 JTYPE               n,             \
-                                                                 JTYPE               k,             \
-                                                                 ITYPE               nnz,           \
-                                                                 UTYPE alpha_device_host,           \
-                                                                 const rocsparse_mat_descr descr,   \
-                                                                 const TTYPE*              csr_val, \
-                                                                 const ITYPE* csr_row_ptr,          \
-                                                                 const JTYPE* csr_col_ind,          \
-                                                                 const TTYPE* B,                    \
-                                                                 JTYPE        ldb,                  \
-                                                                 UTYPE        beta_device_host,     \
-                                                                 TTYPE*       C,                    \
-                                                                 JTYPE        ldc)
-
-INSTANTIATE(int32_t, int32_t, float, float);
-INSTANTIATE(int32_t, int32_t, double, double);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex, rocsparse_double_complex);
-INSTANTIATE(int64_t, int32_t, float, float);
-INSTANTIATE(int64_t, int32_t, double, double);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, rocsparse_double_complex);
-INSTANTIATE(int64_t, int64_t, float, float);
-INSTANTIATE(int64_t, int64_t, double, double);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, rocsparse_float_complex);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex, rocsparse_double_complex);
-
-INSTANTIATE(int32_t, int32_t, float, const float*);
-INSTANTIATE(int32_t, int32_t, double, const double*);
-INSTANTIATE(int32_t, int32_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int32_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
-INSTANTIATE(int64_t, int32_t, float, const float*);
-INSTANTIATE(int64_t, int32_t, double, const double*);
-INSTANTIATE(int64_t, int32_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int64_t, int32_t, rocsparse_double_complex, const rocsparse_double_complex*);
-INSTANTIATE(int64_t, int64_t, float, const float*);
-INSTANTIATE(int64_t, int64_t, double, const double*);
-INSTANTIATE(int64_t, int64_t, rocsparse_float_complex, const rocsparse_float_complex*);
-INSTANTIATE(int64_t, int64_t, rocsparse_double_complex, const rocsparse_double_complex*);
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE, ATYPE, XTYPE, UTYPE)     \
+    template rocsparse_status rocsparse_csrmm_template_row_split( \
+        rocsparse_handle          handle,                         \
+        rocsparse_operation       trans_A,                        \
+        rocsparse_operation       trans_B,                        \
+        rocsparse_order           order,                          \
+        JTYPE                     m,                              \
+        JTYPE                     n,                              \
+        JTYPE                     k,                              \
+        ITYPE                     nnz,                            \
+        UTYPE                     alpha_device_host,              \
+        const rocsparse_mat_descr descr,                          \
+        const ATYPE*              csr_val,                        \
+        const ITYPE*              csr_row_ptr,                    \
+        const JTYPE*              csr_col_ind,                    \
+        const XTYPE*              B,                              \
+        JTYPE                     ldb,                            \
+        UTYPE                     beta_device_host,               \
+        TTYPE*                    C,                              \
+        JTYPE                     ldc);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, float);
+INSTANTIATE(int32_t, int32_t, double, double, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, float, float, float);
+INSTANTIATE(int64_t, int32_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, float, float, float);
+INSTANTIATE(int64_t, int64_t, double, double, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, float, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, double, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            rocsparse_float_complex,
+            const rocsparse_float_complex*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+
+// Mixed precision
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int32_t, int32_t, double, float, double, double);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int32_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, float);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, float);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, float);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, float);
+INSTANTIATE(int64_t, int64_t, double, float, double, double);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            rocsparse_double_complex);
+
+INSTANTIATE(int32_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int32_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int32_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int32_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int32_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int32_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int32_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int32_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int32_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int32_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int32_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, int8_t, const float*);
+INSTANTIATE(int64_t, int64_t, float, int8_t, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, _Float16, const float*);
+INSTANTIATE(int64_t, int64_t, float, _Float16, float, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, hip_bfloat16, const float*);
+INSTANTIATE(int64_t, int64_t, float, hip_bfloat16, float, const float*);
+INSTANTIATE(int64_t, int64_t, double, float, double, const double*);
+INSTANTIATE(int64_t,
+            int64_t,
+            rocsparse_double_complex,
+            rocsparse_float_complex,
+            rocsparse_double_complex,
+            const rocsparse_double_complex*);
 #undef INSTANTIATE
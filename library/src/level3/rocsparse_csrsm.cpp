@@ -364,7 +364,9 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            if(trans_A == rocsparse_operation_transpose && info->csrsvt_upper_info != nullptr)
+            // csrsv meta data without transposed matrix cannot be re-used
+            if(trans_A == rocsparse_operation_transpose && info->csrsvt_upper_info != nullptr
+               && info->csrsvt_upper_info->trmt_perm != nullptr)
             {
                 // csrsv meta data
                 info->csrsmt_upper_info = info->csrsvt_upper_info;
@@ -398,7 +400,8 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                                                              ? info->csrsm_upper_info
                                                              : info->csrsmt_upper_info,
                                                          &info->zero_pivot,
-                                                         temp_buffer));
+                                                         temp_buffer,
+                                                         false));
     }
     else
     {
@@ -440,7 +443,9 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            if(trans_A == rocsparse_operation_transpose && info->csrsvt_lower_info != nullptr)
+            // csrsv meta data without transposed matrix cannot be re-used
+            if(trans_A == rocsparse_operation_transpose && info->csrsvt_lower_info != nullptr
+               && info->csrsvt_lower_info->trmt_perm != nullptr)
             {
                 // csrsv meta data
                 info->csrsm_upper_info = info->csrsvt_lower_info;
@@ -474,7 +479,8 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                                                              ? info->csrsm_lower_info
                                                              : info->csrsmt_lower_info,
                                                          &info->zero_pivot,
-                                                         temp_buffer));
+                                                         temp_buffer,
+                                                         false));
     }
 
     return rocsparse_status_success;
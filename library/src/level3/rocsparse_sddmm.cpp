@@ -29,21 +29,26 @@
 
 #include "rocsparse_sddmm.hpp"
 
-template <rocsparse_format FORMAT, typename I, typename J, typename T, typename... Ts>
+template <rocsparse_format FORMAT,
+          typename I,
+          typename J,
+          typename T,
+          typename X,
+          typename... Ts>
 rocsparse_status rocsparse_sddmm_buffer_size_dispatch_alg(rocsparse_sddmm_alg alg, Ts&&... ts)
 {
     switch(alg)
     {
     case rocsparse_sddmm_alg_default:
     {
-        return rocsparse_sddmm_st<FORMAT, rocsparse_sddmm_alg_default, I, J, T>::
+        return rocsparse_sddmm_st<FORMAT, rocsparse_sddmm_alg_default, I, J, T, X>::
             buffer_size_template(ts...);
     }
     }
     return rocsparse_status_invalid_value;
 }
 
-template <typename I, typename J, typename T, typename... Ts>
+template <typename I, typename J, typename T, typename X, typename... Ts>
 rocsparse_status rocsparse_sddmm_buffer_size_dispatch_format(rocsparse_format    format,
                                                              rocsparse_sddmm_alg alg,
                                                              Ts&&... ts)
@@ -52,29 +57,91 @@ rocsparse_status rocsparse_sddmm_buffer_size_dispatch_format(rocsparse_format
     {
     case rocsparse_format_coo:
     {
-        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_coo, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_coo, I, I, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_csr:
     {
-        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_csr, I, J, T>(alg, ts...);
+        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_csr, I, J, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_coo_aos:
     {
-
-        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_coo_aos, I, I, T>(alg,
-                                                                                           ts...);
+        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_coo_aos, I, I, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_csc:
     {
-        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_csc, I, J, T>(alg, ts...);
+        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_csc, I, J, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_ell:
     {
-        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_ell, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_buffer_size_dispatch_alg<rocsparse_format_ell, I, I, T, X>(
+            alg, ts...);
+    }
+
+    case rocsparse_format_bsr:
+    case rocsparse_format_sell:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    }
+    return rocsparse_status_invalid_value;
+}
+
+template <typename T, typename X, typename... Ts>
+rocsparse_status rocsparse_sddmm_buffer_size_dispatch_index(rocsparse_format    format,
+                                                            rocsparse_indextype itype,
+                                                            rocsparse_indextype jtype,
+                                                            rocsparse_sddmm_alg alg,
+                                                            Ts&&... ts)
+{
+    switch(itype)
+    {
+    case rocsparse_indextype_u16:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    case rocsparse_indextype_i32:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_sddmm_buffer_size_dispatch_format<int32_t, int32_t, T, X>(
+                format, alg, ts...);
+        }
+        }
+    }
+    case rocsparse_indextype_i64:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_sddmm_buffer_size_dispatch_format<int64_t, int32_t, T, X>(
+                format, alg, ts...);
+        }
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_sddmm_buffer_size_dispatch_format<int64_t, int64_t, T, X>(
+                format, alg, ts...);
+        }
+        }
     }
     }
     return rocsparse_status_invalid_value;
@@ -85,66 +152,59 @@ rocsparse_status rocsparse_sddmm_buffer_size_dispatch(rocsparse_format    format
                                                       rocsparse_indextype itype,
                                                       rocsparse_indextype jtype,
                                                       rocsparse_datatype  ctype,
+                                                      rocsparse_datatype  xtype,
                                                       rocsparse_sddmm_alg alg,
                                                       Ts&&... ts)
 {
+    // Dense matrices stored in f16 or bf16 with f32 computation
+    if(xtype != ctype)
+    {
+        if(ctype == rocsparse_datatype_f32_r && xtype == rocsparse_datatype_f16_r)
+        {
+            return rocsparse_sddmm_buffer_size_dispatch_index<float, _Float16>(
+                format, itype, jtype, alg, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && xtype == rocsparse_datatype_bf16_r)
+        {
+            return rocsparse_sddmm_buffer_size_dispatch_index<float, hip_bfloat16>(
+                format, itype, jtype, alg, ts...);
+        }
+
+        return rocsparse_status_not_implemented;
+    }
+
     switch(ctype)
     {
+    case rocsparse_datatype_f32_r:
+    {
+        return rocsparse_sddmm_buffer_size_dispatch_index<float, float>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f64_r:
+    {
+        return rocsparse_sddmm_buffer_size_dispatch_index<double, double>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f32_c:
+    {
+        return rocsparse_sddmm_buffer_size_dispatch_index<rocsparse_float_complex,
+                                                          rocsparse_float_complex>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f64_c:
+    {
+        return rocsparse_sddmm_buffer_size_dispatch_index<rocsparse_double_complex,
+                                                          rocsparse_double_complex>(
+            format, itype, jtype, alg, ts...);
+    }
 
-#define DATATYPE_CASE(ENUMVAL, TYPE)                                                        \
-    case ENUMVAL:                                                                           \
-    {                                                                                       \
-        switch(itype)                                                                       \
-        {                                                                                   \
-        case rocsparse_indextype_u16:                                                       \
-        {                                                                                   \
-            return rocsparse_status_not_implemented;                                        \
-        }                                                                                   \
-        case rocsparse_indextype_i32:                                                       \
-        {                                                                                   \
-            switch(jtype)                                                                   \
-            {                                                                               \
-            case rocsparse_indextype_u16:                                                   \
-            case rocsparse_indextype_i64:                                                   \
-            {                                                                               \
-                return rocsparse_status_not_implemented;                                    \
-            }                                                                               \
-            case rocsparse_indextype_i32:                                                   \
-            {                                                                               \
-                return rocsparse_sddmm_buffer_size_dispatch_format<int32_t, int32_t, TYPE>( \
-                    format, alg, ts...);                                                    \
-            }                                                                               \
-            }                                                                               \
-        }                                                                                   \
-        case rocsparse_indextype_i64:                                                       \
-        {                                                                                   \
-            switch(jtype)                                                                   \
-            {                                                                               \
-            case rocsparse_indextype_u16:                                                   \
-            {                                                                               \
-                return rocsparse_status_not_implemented;                                    \
-            }                                                                               \
-            case rocsparse_indextype_i32:                                                   \
-            {                                                                               \
-                return rocsparse_sddmm_buffer_size_dispatch_format<int64_t, int32_t, TYPE>( \
-                    format, alg, ts...);                                                    \
-            }                                                                               \
-            case rocsparse_indextype_i64:                                                   \
-            {                                                                               \
-                return rocsparse_sddmm_buffer_size_dispatch_format<int64_t, int64_t, TYPE>( \
-                    format, alg, ts...);                                                    \
-            }                                                                               \
-            }                                                                               \
-        }                                                                                   \
-        }                                                                                   \
-    }
-
-        DATATYPE_CASE(rocsparse_datatype_f32_r, float);
-        DATATYPE_CASE(rocsparse_datatype_f64_r, double);
-        DATATYPE_CASE(rocsparse_datatype_f32_c, rocsparse_float_complex);
-        DATATYPE_CASE(rocsparse_datatype_f64_c, rocsparse_double_complex);
-
-#undef DATATYPE_CASE
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
 
     return rocsparse_status_invalid_value;
@@ -213,9 +273,8 @@ extern "C" rocsparse_status rocsparse_sddmm_buffer_size(rocsparse_handle
         return rocsparse_status_not_initialized;
     }
 
-    // Check for matching types while we do not support mixed precision computation
-    if(compute_type != mat_A->data_type || compute_type != mat_B->data_type
-       || compute_type != mat_C->data_type)
+    // C is stored in the compute type, the dense matrices can be stored in a lower precision
+    if(compute_type != mat_C->data_type || mat_A->data_type != mat_B->data_type)
     {
         return rocsparse_status_not_implemented;
     }
@@ -224,6 +283,7 @@ extern "C" rocsparse_status rocsparse_sddmm_buffer_size(rocsparse_handle
         (mat_C->format == rocsparse_format_csc) ? mat_C->col_type : mat_C->row_type,
         (mat_C->format == rocsparse_format_csc) ? mat_C->row_type : mat_C->col_type,
         compute_type,
+        mat_A->data_type,
         alg,
         //
         handle,
@@ -239,21 +299,26 @@ extern "C" rocsparse_status rocsparse_sddmm_buffer_size(rocsparse_handle
         buffer_size);
 }
 
-template <rocsparse_format FORMAT, typename I, typename J, typename T, typename... Ts>
+template <rocsparse_format FORMAT,
+          typename I,
+          typename J,
+          typename T,
+          typename X,
+          typename... Ts>
 rocsparse_status rocsparse_sddmm_preprocess_dispatch_alg(rocsparse_sddmm_alg alg, Ts&&... ts)
 {
     switch(alg)
     {
     case rocsparse_sddmm_alg_default:
     {
-        return rocsparse_sddmm_st<FORMAT, rocsparse_sddmm_alg_default, I, J, T>::
+        return rocsparse_sddmm_st<FORMAT, rocsparse_sddmm_alg_default, I, J, T, X>::
             preprocess_template(ts...);
     }
     }
     return rocsparse_status_invalid_value;
 }
 
-template <typename I, typename J, typename T, typename... Ts>
+template <typename I, typename J, typename T, typename X, typename... Ts>
 rocsparse_status rocsparse_sddmm_preprocess_dispatch_format(rocsparse_format    format,
                                                             rocsparse_sddmm_alg alg,
                                                             Ts&&... ts)
@@ -262,29 +327,91 @@ rocsparse_status rocsparse_sddmm_preprocess_dispatch_format(rocsparse_format
     {
     case rocsparse_format_coo:
     {
-        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_coo, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_coo, I, I, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_csr:
     {
-        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_csr, I, J, T>(alg, ts...);
+        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_csr, I, J, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_coo_aos:
     {
-
-        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_coo_aos, I, I, T>(alg,
-                                                                                          ts...);
+        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_coo_aos, I, I, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_csc:
     {
-        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_csc, I, J, T>(alg, ts...);
+        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_csc, I, J, T, X>(
+            alg, ts...);
     }
 
     case rocsparse_format_ell:
     {
-        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_ell, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_preprocess_dispatch_alg<rocsparse_format_ell, I, I, T, X>(
+            alg, ts...);
+    }
+
+    case rocsparse_format_bsr:
+    case rocsparse_format_sell:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    }
+    return rocsparse_status_invalid_value;
+}
+
+template <typename T, typename X, typename... Ts>
+rocsparse_status rocsparse_sddmm_preprocess_dispatch_index(rocsparse_format    format,
+                                                           rocsparse_indextype itype,
+                                                           rocsparse_indextype jtype,
+                                                           rocsparse_sddmm_alg alg,
+                                                           Ts&&... ts)
+{
+    switch(itype)
+    {
+    case rocsparse_indextype_u16:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    case rocsparse_indextype_i32:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_sddmm_preprocess_dispatch_format<int32_t, int32_t, T, X>(
+                format, alg, ts...);
+        }
+        }
+    }
+    case rocsparse_indextype_i64:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_sddmm_preprocess_dispatch_format<int64_t, int32_t, T, X>(
+                format, alg, ts...);
+        }
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_sddmm_preprocess_dispatch_format<int64_t, int64_t, T, X>(
+                format, alg, ts...);
+        }
+        }
     }
     }
     return rocsparse_status_invalid_value;
@@ -295,65 +422,59 @@ rocsparse_status rocsparse_sddmm_preprocess_dispatch(rocsparse_format    format,
                                                      rocsparse_indextype itype,
                                                      rocsparse_indextype jtype,
                                                      rocsparse_datatype  ctype,
+                                                     rocsparse_datatype  xtype,
                                                      rocsparse_sddmm_alg alg,
                                                      Ts&&... ts)
 {
+    // Dense matrices stored in f16 or bf16 with f32 computation
+    if(xtype != ctype)
+    {
+        if(ctype == rocsparse_datatype_f32_r && xtype == rocsparse_datatype_f16_r)
+        {
+            return rocsparse_sddmm_preprocess_dispatch_index<float, _Float16>(
+                format, itype, jtype, alg, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && xtype == rocsparse_datatype_bf16_r)
+        {
+            return rocsparse_sddmm_preprocess_dispatch_index<float, hip_bfloat16>(
+                format, itype, jtype, alg, ts...);
+        }
+
+        return rocsparse_status_not_implemented;
+    }
+
     switch(ctype)
     {
-#define DATATYPE_CASE(ENUMVAL, TYPE)                                                       \
-    case ENUMVAL:                                                                          \
-    {                                                                                      \
-        switch(itype)                                                                      \
-        {                                                                                  \
-        case rocsparse_indextype_u16:                                                      \
-        {                                                                                  \
-            return rocsparse_status_not_implemented;                                       \
-        }                                                                                  \
-        case rocsparse_indextype_i32:                                                      \
-        {                                                                                  \
-            switch(jtype)                                                                  \
-            {                                                                              \
-            case rocsparse_indextype_u16:                                                  \
-            case rocsparse_indextype_i64:                                                  \
-            {                                                                              \
-                return rocsparse_status_not_implemented;                                   \
-            }                                                                              \
-            case rocsparse_indextype_i32:                                                  \
-            {                                                                              \
-                return rocsparse_sddmm_preprocess_dispatch_format<int32_t, int32_t, TYPE>( \
-                    format, alg, ts...);                                                   \
-            }                                                                              \
-            }                                                                              \
-        }                                                                                  \
-        case rocsparse_indextype_i64:                                                      \
-        {                                                                                  \
-            switch(jtype)                                                                  \
-            {                                                                              \
-            case rocsparse_indextype_u16:                                                  \
-            {                                                                              \
-                return rocsparse_status_not_implemented;                                   \
-            }                                                                              \
-            case rocsparse_indextype_i32:                                                  \
-            {                                                                              \
-                return rocsparse_sddmm_preprocess_dispatch_format<int64_t, int32_t, TYPE>( \
-                    format, alg, ts...);                                                   \
-            }                                                                              \
-            case rocsparse_indextype_i64:                                                  \
-            {                                                                              \
-                return rocsparse_sddmm_preprocess_dispatch_format<int64_t, int64_t, TYPE>( \
-                    format, alg, ts...);                                                   \
-            }                                                                              \
-            }                                                                              \
-        }                                                                                  \
-        }                                                                                  \
-    }
-
-        DATATYPE_CASE(rocsparse_datatype_f32_r, float);
-        DATATYPE_CASE(rocsparse_datatype_f64_r, double);
-        DATATYPE_CASE(rocsparse_datatype_f32_c, rocsparse_float_complex);
-        DATATYPE_CASE(rocsparse_datatype_f64_c, rocsparse_double_complex);
-
-#undef DATATYPE_CASE
+    case rocsparse_datatype_f32_r:
+    {
+        return rocsparse_sddmm_preprocess_dispatch_index<float, float>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f64_r:
+    {
+        return rocsparse_sddmm_preprocess_dispatch_index<double, double>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f32_c:
+    {
+        return rocsparse_sddmm_preprocess_dispatch_index<rocsparse_float_complex,
+                                                         rocsparse_float_complex>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f64_c:
+    {
+        return rocsparse_sddmm_preprocess_dispatch_index<rocsparse_double_complex,
+                                                         rocsparse_double_complex>(
+            format, itype, jtype, alg, ts...);
+    }
+
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
 
     return rocsparse_status_invalid_value;
@@ -421,9 +542,8 @@ extern "C" rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle
         return rocsparse_status_not_initialized;
     }
 
-    // Check for matching types while we do not support mixed precision computation
-    if(compute_type != mat_A->data_type || compute_type != mat_B->data_type
-       || compute_type != mat_C->data_type)
+    // C is stored in the compute type, the dense matrices can be stored in a lower precision
+    if(compute_type != mat_C->data_type || mat_A->data_type != mat_B->data_type)
     {
         return rocsparse_status_not_implemented;
     }
@@ -438,6 +558,7 @@ extern "C" rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle
         (mat_C->format == rocsparse_format_csc) ? mat_C->col_type : mat_C->row_type,
         (mat_C->format == rocsparse_format_csc) ? mat_C->row_type : mat_C->col_type,
         compute_type,
+        mat_A->data_type,
         alg,
         //
         handle,
@@ -453,50 +574,111 @@ extern "C" rocsparse_status rocsparse_sddmm_preprocess(rocsparse_handle
         temp_buffer);
 }
 
-template <rocsparse_format FORMAT, typename I, typename J, typename T, typename... Ts>
+template <rocsparse_format FORMAT,
+          typename I,
+          typename J,
+          typename T,
+          typename X,
+          typename... Ts>
 rocsparse_status rocsparse_sddmm_dispatch_alg(rocsparse_sddmm_alg alg, Ts&&... ts)
 {
     switch(alg)
     {
     case rocsparse_sddmm_alg_default:
     {
-        return rocsparse_sddmm_st<FORMAT, rocsparse_sddmm_alg_default, I, J, T>::compute_template(
-            ts...);
+        return rocsparse_sddmm_st<FORMAT, rocsparse_sddmm_alg_default, I, J, T, X>::
+            compute_template(ts...);
     }
     }
     return rocsparse_status_invalid_value;
 }
 
-template <typename I, typename J, typename T, typename... Ts>
-rocsparse_status
-    rocsparse_sddmm_dispatch_format(rocsparse_format format, rocsparse_sddmm_alg alg, Ts&&... ts)
+template <typename I, typename J, typename T, typename X, typename... Ts>
+rocsparse_status rocsparse_sddmm_dispatch_format(rocsparse_format    format,
+                                                 rocsparse_sddmm_alg alg,
+                                                 Ts&&... ts)
 {
     switch(format)
     {
     case rocsparse_format_coo:
     {
-        return rocsparse_sddmm_dispatch_alg<rocsparse_format_coo, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_dispatch_alg<rocsparse_format_coo, I, I, T, X>(alg, ts...);
     }
 
     case rocsparse_format_csr:
     {
-        return rocsparse_sddmm_dispatch_alg<rocsparse_format_csr, I, J, T>(alg, ts...);
+        return rocsparse_sddmm_dispatch_alg<rocsparse_format_csr, I, J, T, X>(alg, ts...);
     }
 
     case rocsparse_format_coo_aos:
     {
-
-        return rocsparse_sddmm_dispatch_alg<rocsparse_format_coo_aos, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_dispatch_alg<rocsparse_format_coo_aos, I, I, T, X>(alg, ts...);
     }
 
     case rocsparse_format_csc:
     {
-        return rocsparse_sddmm_dispatch_alg<rocsparse_format_csc, I, J, T>(alg, ts...);
+        return rocsparse_sddmm_dispatch_alg<rocsparse_format_csc, I, J, T, X>(alg, ts...);
     }
 
     case rocsparse_format_ell:
     {
-        return rocsparse_sddmm_dispatch_alg<rocsparse_format_ell, I, I, T>(alg, ts...);
+        return rocsparse_sddmm_dispatch_alg<rocsparse_format_ell, I, I, T, X>(alg, ts...);
+    }
+
+    case rocsparse_format_bsr:
+    case rocsparse_format_sell:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    }
+    return rocsparse_status_invalid_value;
+}
+
+template <typename T, typename X, typename... Ts>
+rocsparse_status rocsparse_sddmm_dispatch_index(rocsparse_format    format,
+                                                rocsparse_indextype itype,
+                                                rocsparse_indextype jtype,
+                                                rocsparse_sddmm_alg alg,
+                                                Ts&&... ts)
+{
+    switch(itype)
+    {
+    case rocsparse_indextype_u16:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    case rocsparse_indextype_i32:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_sddmm_dispatch_format<int32_t, int32_t, T, X>(format, alg, ts...);
+        }
+        }
+    }
+    case rocsparse_indextype_i64:
+    {
+        switch(jtype)
+        {
+        case rocsparse_indextype_u16:
+        {
+            return rocsparse_status_not_implemented;
+        }
+        case rocsparse_indextype_i32:
+        {
+            return rocsparse_sddmm_dispatch_format<int64_t, int32_t, T, X>(format, alg, ts...);
+        }
+        case rocsparse_indextype_i64:
+        {
+            return rocsparse_sddmm_dispatch_format<int64_t, int64_t, T, X>(format, alg, ts...);
+        }
+        }
     }
     }
     return rocsparse_status_invalid_value;
@@ -507,67 +689,59 @@ rocsparse_status rocsparse_sddmm_dispatch(rocsparse_format    format,
                                           rocsparse_indextype itype,
                                           rocsparse_indextype jtype,
                                           rocsparse_datatype  ctype,
+                                          rocsparse_datatype  xtype,
                                           rocsparse_sddmm_alg alg,
                                           Ts&&... ts)
 {
+    // Dense matrices stored in f16 or bf16 with f32 computation
+    if(xtype != ctype)
+    {
+        if(ctype == rocsparse_datatype_f32_r && xtype == rocsparse_datatype_f16_r)
+        {
+            return rocsparse_sddmm_dispatch_index<float, _Float16>(
+                format, itype, jtype, alg, ts...);
+        }
+
+        if(ctype == rocsparse_datatype_f32_r && xtype == rocsparse_datatype_bf16_r)
+        {
+            return rocsparse_sddmm_dispatch_index<float, hip_bfloat16>(
+                format, itype, jtype, alg, ts...);
+        }
+
+        return rocsparse_status_not_implemented;
+    }
+
     switch(ctype)
     {
+    case rocsparse_datatype_f32_r:
+    {
+        return rocsparse_sddmm_dispatch_index<float, float>(format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f64_r:
+    {
+        return rocsparse_sddmm_dispatch_index<double, double>(format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f32_c:
+    {
+        return rocsparse_sddmm_dispatch_index<rocsparse_float_complex,
+                                              rocsparse_float_complex>(
+            format, itype, jtype, alg, ts...);
+    }
+    case rocsparse_datatype_f64_c:
+    {
+        return rocsparse_sddmm_dispatch_index<rocsparse_double_complex,
+                                              rocsparse_double_complex>(
+            format, itype, jtype, alg, ts...);
+    }
 
-#define DATATYPE_CASE(ENUMVAL, TYPE)                                            \
-    case ENUMVAL:                                                               \
-    {                                                                           \
-        switch(itype)                                                           \
-        {                                                                       \
-        case rocsparse_indextype_u16:                                           \
-        {                                                                       \
-            return rocsparse_status_not_implemented;                            \
-        }                                                                       \
-        case rocsparse_indextype_i32:                                           \
-        {                                                                       \
-            switch(jtype)                                                       \
-            {                                                                   \
-            case rocsparse_indextype_u16:                                       \
-            case rocsparse_indextype_i64:                                       \
-            {                                                                   \
-                return rocsparse_status_not_implemented;                        \
-            }                                                                   \
-            case rocsparse_indextype_i32:                                       \
-            {                                                                   \
-                return rocsparse_sddmm_dispatch_format<int32_t, int32_t, TYPE>( \
-                    format, alg, ts...);                                        \
-            }                                                                   \
-            }                                                                   \
-        }                                                                       \
-        case rocsparse_indextype_i64:                                           \
-        {                                                                       \
-            switch(jtype)                                                       \
-            {                                                                   \
-            case rocsparse_indextype_u16:                                       \
-            {                                                                   \
-                return rocsparse_status_not_implemented;                        \
-            }                                                                   \
-            case rocsparse_indextype_i32:                                       \
-            {                                                                   \
-                return rocsparse_sddmm_dispatch_format<int64_t, int32_t, TYPE>( \
-                    format, alg, ts...);                                        \
-            }                                                                   \
-            case rocsparse_indextype_i64:                                       \
-            {                                                                   \
-                return rocsparse_sddmm_dispatch_format<int64_t, int64_t, TYPE>( \
-                    format, alg, ts...);                                        \
-            }                                                                   \
-            }                                                                   \
-        }                                                                       \
-        }                                                                       \
-    }
-
-        DATATYPE_CASE(rocsparse_datatype_f32_r, float);
-        DATATYPE_CASE(rocsparse_datatype_f64_r, double);
-        DATATYPE_CASE(rocsparse_datatype_f32_c, rocsparse_float_complex);
-        DATATYPE_CASE(rocsparse_datatype_f64_c, rocsparse_double_complex);
-
-#undef DATATYPE_CASE
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
+
     return rocsparse_status_invalid_value;
 }
 
@@ -633,9 +807,8 @@ extern "C" rocsparse_status rocsparse_sddmm(rocsparse_handle            handle,
         return rocsparse_status_not_initialized;
     }
 
-    // Check for matching types while we do not support mixed precision computation
-    if(compute_type != mat_A->data_type || compute_type != mat_B->data_type
-       || compute_type != mat_C->data_type)
+    // C is stored in the compute type, the dense matrices can be stored in a lower precision
+    if(compute_type != mat_C->data_type || mat_A->data_type != mat_B->data_type)
     {
         return rocsparse_status_not_implemented;
     }
@@ -649,6 +822,7 @@ extern "C" rocsparse_status rocsparse_sddmm(rocsparse_handle            handle,
         (mat_C->format == rocsparse_format_csc) ? mat_C->col_type : mat_C->row_type,
         (mat_C->format == rocsparse_format_csc) ? mat_C->row_type : mat_C->col_type,
         compute_type,
+        mat_A->data_type,
         alg,
         //
         handle,
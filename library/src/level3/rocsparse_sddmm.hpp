@@ -28,7 +28,14 @@
 
 #include "handle.h"
 
-template <rocsparse_format FORMAT, rocsparse_sddmm_alg ALG, typename I, typename J, typename T>
+// T is the compute type, in which alpha, beta and C are stored. X is the storage type of
+// the dense matrices A and B, which are converted to T on load.
+template <rocsparse_format    FORMAT,
+          rocsparse_sddmm_alg ALG,
+          typename I,
+          typename J,
+          typename T,
+          typename X = T>
 struct rocsparse_sddmm_st
 {
 
@@ -42,9 +49,9 @@ struct rocsparse_sddmm_st
                                         J                    k,
                                         I                    nnz,
                                         const T*             alpha,
-                                        const T*             A_val,
+                                        const X*             A_val,
                                         J                    A_ld,
-                                        const T*             B_val,
+                                        const X*             B_val,
                                         J                    B_ld,
                                         const T*             beta,
                                         const I*             C_row_data,
@@ -64,9 +71,9 @@ struct rocsparse_sddmm_st
                                        J                    k,
                                        I                    nnz,
                                        const T*             alpha,
-                                       const T*             A_val,
+                                       const X*             A_val,
                                        J                    A_ld,
-                                       const T*             B_val,
+                                       const X*             B_val,
                                        J                    B_ld,
                                        const T*             beta,
                                        const I*             C_row_data,
@@ -86,9 +93,9 @@ struct rocsparse_sddmm_st
                                     J                    k,
                                     I                    nnz,
                                     const T*             alpha,
-                                    const T*             A_val,
+                                    const X*             A_val,
                                     J                    A_ld,
-                                    const T*             B_val,
+                                    const X*             B_val,
                                     J                    B_ld,
                                     const T*             beta,
                                     const I*             C_row_data,
@@ -115,7 +122,7 @@ struct rocsparse_sddmm_st
         case rocsparse_format_csr:
         case rocsparse_format_coo:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::buffer_size(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::buffer_size(
                 handle,
                 trans_A,
                 trans_B,
@@ -126,9 +133,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->row_data,
@@ -141,7 +148,7 @@ struct rocsparse_sddmm_st
 
         case rocsparse_format_csc:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::buffer_size(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::buffer_size(
                 handle,
                 trans_A,
                 trans_B,
@@ -152,9 +159,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->col_data,
@@ -166,7 +173,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_ell:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::buffer_size(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::buffer_size(
                 handle,
                 trans_A,
                 trans_B,
@@ -177,9 +184,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)nullptr,
@@ -192,7 +199,7 @@ struct rocsparse_sddmm_st
 
         case rocsparse_format_coo_aos:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::buffer_size(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::buffer_size(
                 handle,
                 trans_A,
                 trans_B,
@@ -203,9 +210,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->ind_data,
@@ -215,6 +222,12 @@ struct rocsparse_sddmm_st
                 alg,
                 out_buffer_size);
         }
+
+        case rocsparse_format_bsr:
+        case rocsparse_format_sell:
+        {
+            return rocsparse_status_not_implemented;
+        }
         }
         return rocsparse_status_invalid_value;
     }
@@ -236,7 +249,7 @@ struct rocsparse_sddmm_st
         case rocsparse_format_csr:
         case rocsparse_format_coo:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::preprocess(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::preprocess(
                 handle,
                 trans_A,
                 trans_B,
@@ -247,9 +260,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->row_data,
@@ -261,7 +274,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_csc:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::preprocess(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::preprocess(
                 handle,
                 trans_A,
                 trans_B,
@@ -272,9 +285,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->col_data,
@@ -286,7 +299,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_ell:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::preprocess(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::preprocess(
                 handle,
                 trans_A,
                 trans_B,
@@ -297,9 +310,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)nullptr,
@@ -311,7 +324,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_coo_aos:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::preprocess(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::preprocess(
                 handle,
                 trans_A,
                 trans_B,
@@ -322,9 +335,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->ind_data,
@@ -334,6 +347,12 @@ struct rocsparse_sddmm_st
                 alg,
                 buffer);
         }
+
+        case rocsparse_format_bsr:
+        case rocsparse_format_sell:
+        {
+            return rocsparse_status_not_implemented;
+        }
         }
         return rocsparse_status_invalid_value;
     }
@@ -355,7 +374,7 @@ struct rocsparse_sddmm_st
         case rocsparse_format_csr:
         case rocsparse_format_coo:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::compute(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::compute(
                 handle,
                 trans_A,
                 trans_B,
@@ -366,9 +385,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->row_data,
@@ -380,7 +399,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_csc:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::compute(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::compute(
                 handle,
                 trans_A,
                 trans_B,
@@ -391,9 +410,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->col_data,
@@ -405,7 +424,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_ell:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::compute(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::compute(
                 handle,
                 trans_A,
                 trans_B,
@@ -416,9 +435,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)nullptr,
@@ -430,7 +449,7 @@ struct rocsparse_sddmm_st
         }
         case rocsparse_format_coo_aos:
         {
-            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T>::compute(
+            return rocsparse_sddmm_st<FORMAT, ALG, I, J, T, X>::compute(
                 handle,
                 trans_A,
                 trans_B,
@@ -441,9 +460,9 @@ struct rocsparse_sddmm_st
                 (trans_A == rocsparse_operation_none) ? mat_A->cols : mat_A->rows,
                 mat_C->nnz,
                 (const T*)alpha,
-                (const T*)mat_A->values,
+                (const X*)mat_A->values,
                 mat_A->ld,
-                (const T*)mat_B->values,
+                (const X*)mat_B->values,
                 mat_B->ld,
                 (const T*)beta,
                 (const I*)mat_C->ind_data,
@@ -453,6 +472,12 @@ struct rocsparse_sddmm_st
                 alg,
                 buffer);
         }
+
+        case rocsparse_format_bsr:
+        case rocsparse_format_sell:
+        {
+            return rocsparse_status_not_implemented;
+        }
         }
         return rocsparse_status_invalid_value;
     }
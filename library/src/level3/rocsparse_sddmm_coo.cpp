@@ -34,6 +34,7 @@ template <rocsparse_int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename X,
           typename U>
 __global__ __launch_bounds__(BLOCKSIZE, 1) void sddmm_coo_kernel(rocsparse_operation transA,
                                                                  rocsparse_operation transB,
@@ -44,9 +45,9 @@ __global__ __launch_bounds__(BLOCKSIZE, 1) void sddmm_coo_kernel(rocsparse_opera
                                                                  J                   K,
                                                                  I                   nnz,
                                                                  U alpha_device_host,
-                                                                 const T* __restrict__ A,
+                                                                 const X* __restrict__ A,
                                                                  J lda,
-                                                                 const T* __restrict__ B,
+                                                                 const X* __restrict__ B,
                                                                  J ldb,
                                                                  U beta_device_host,
                                                                  T* __restrict__ coo_val,
@@ -62,13 +63,13 @@ __global__ __launch_bounds__(BLOCKSIZE, 1) void sddmm_coo_kernel(rocsparse_opera
     I i  = coo_row_ind[at] - coo_base;
     I j  = coo_col_ind[at] - coo_base;
 
-    const T* x = (orderA == rocsparse_order_column)
+    const X* x = (orderA == rocsparse_order_column)
                      ? ((transA == rocsparse_operation_none) ? (A + i) : (A + lda * i))
                      : ((transA == rocsparse_operation_none) ? (A + lda * i) : (A + i));
     J incx = (orderA == rocsparse_order_column) ? ((transA == rocsparse_operation_none) ? lda : 1)
                                                 : ((transA == rocsparse_operation_none) ? 1 : lda);
 
-    const T* y = (orderB == rocsparse_order_column)
+    const X* y = (orderB == rocsparse_order_column)
                      ? ((transB == rocsparse_operation_none) ? (B + ldb * j) : (B + j))
                      : ((transB == rocsparse_operation_none) ? (B + j) : (B + ldb * j));
     J incy = (orderB == rocsparse_order_column) ? ((transB == rocsparse_operation_none) ? 1 : ldb)
@@ -81,7 +82,7 @@ __global__ __launch_bounds__(BLOCKSIZE, 1) void sddmm_coo_kernel(rocsparse_opera
     size_t inc = hipBlockDim_x * hipGridDim_x;
     for(J l = 0; l < WIN && gid < K; l++, gid += inc)
     {
-        sum += y[gid * incy] * x[gid * incx];
+        sum += static_cast<T>(y[gid * incy]) * static_cast<T>(x[gid * incx]);
     }
 
     sum = rocsparse_reduce_block<BLOCKSIZE>(sum);
@@ -128,8 +129,8 @@ __global__ __launch_bounds__(NB) void coo_finalize_kernel(rocsparse_int n_sums,
         out[hipBlockIdx_y] = out[hipBlockIdx_y] * beta + alpha * sum;
 }
 
-template <typename I, typename J, typename T>
-struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I, J, T>
+template <typename I, typename J, typename T, typename X>
+struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I, J, T, X>
 {
     static rocsparse_status buffer_size(rocsparse_handle     handle,
                                         rocsparse_operation  trans_A,
@@ -141,9 +142,9 @@ struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I,
                                         J                    k,
                                         I                    nnz,
                                         const T*             alpha,
-                                        const T*             A_val,
+                                        const X*             A_val,
                                         J                    A_ld,
-                                        const T*             B_val,
+                                        const X*             B_val,
                                         J                    B_ld,
                                         const T*             beta,
                                         const I*             C_row_data,
@@ -168,9 +169,9 @@ struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I,
                                        J                    k,
                                        I                    nnz,
                                        const T*             alpha,
-                                       const T*             A_val,
+                                       const X*             A_val,
                                        J                    A_ld,
-                                       const T*             B_val,
+                                       const X*             B_val,
                                        J                    B_ld,
                                        const T*             beta,
                                        const I*             C_row_data,
@@ -193,9 +194,9 @@ struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I,
                                     J                    k,
                                     I                    nnz,
                                     const T*             alpha,
-                                    const T*             A_val,
+                                    const X*             A_val,
                                     J                    A_ld,
-                                    const T*             B_val,
+                                    const X*             B_val,
                                     J                    B_ld,
                                     const T*             beta,
                                     const I*             C_row_data,
@@ -214,7 +215,7 @@ struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I,
 
         if(handle->pointer_mode == rocsparse_pointer_mode_host)
         {
-            hipLaunchKernelGGL((sddmm_coo_kernel<NB, WIN, I, J, T>),
+            hipLaunchKernelGGL((sddmm_coo_kernel<NB, WIN, I, J, T, X>),
                                blocks,
                                threads,
                                0,
@@ -256,7 +257,7 @@ struct rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, I,
         else
         {
 
-            hipLaunchKernelGGL((sddmm_coo_kernel<NB, WIN, I, J, T>),
+            hipLaunchKernelGGL((sddmm_coo_kernel<NB, WIN, I, J, T, X>),
                                blocks,
                                threads,
                                0,
@@ -340,3 +341,29 @@ template struct rocsparse_sddmm_st<rocsparse_format_coo,
                                    int64_t,
                                    int64_t,
                                    rocsparse_double_complex>;
+
+// Dense matrices stored in f16 or bf16 with f32 computation
+template struct rocsparse_sddmm_st<rocsparse_format_coo,
+                                   rocsparse_sddmm_alg_default,
+                                   int32_t,
+                                   int32_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_coo,
+                                   rocsparse_sddmm_alg_default,
+                                   int32_t,
+                                   int32_t,
+                                   float,
+                                   hip_bfloat16>;
+template struct rocsparse_sddmm_st<rocsparse_format_coo,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int64_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_coo,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int64_t,
+                                   float,
+                                   hip_bfloat16>;
@@ -34,6 +34,7 @@ template <rocsparse_int BLOCKSIZE,
           typename I,
           typename J,
           typename T,
+          typename X,
           typename U>
 __global__ __launch_bounds__(BLOCKSIZE,
                              1) void sddmm_coo_aos_kernel(rocsparse_operation transA,
@@ -45,9 +46,9 @@ __global__ __launch_bounds__(BLOCKSIZE,
                                                           J                   K,
                                                           I                   nnz,
                                                           U                   alpha_device_host,
-                                                          const T* __restrict__ A,
+                                                          const X* __restrict__ A,
                                                           J lda,
-                                                          const T* __restrict__ B,
+                                                          const X* __restrict__ B,
                                                           J ldb,
                                                           U beta_device_host,
                                                           T* __restrict__ coo_aos_val,
@@ -63,13 +64,13 @@ __global__ __launch_bounds__(BLOCKSIZE,
     I i  = coo_aos_row_ind[2 * at] - coo_aos_base;
     I j  = coo_aos_col_ind[2 * at] - coo_aos_base;
 
-    const T* x = (orderA == rocsparse_order_column)
+    const X* x = (orderA == rocsparse_order_column)
                      ? ((transA == rocsparse_operation_none) ? (A + i) : (A + lda * i))
                      : ((transA == rocsparse_operation_none) ? (A + lda * i) : (A + i));
     J incx = (orderA == rocsparse_order_column) ? ((transA == rocsparse_operation_none) ? lda : 1)
                                                 : ((transA == rocsparse_operation_none) ? 1 : lda);
 
-    const T* y = (orderB == rocsparse_order_column)
+    const X* y = (orderB == rocsparse_order_column)
                      ? ((transB == rocsparse_operation_none) ? (B + ldb * j) : (B + j))
                      : ((transB == rocsparse_operation_none) ? (B + j) : (B + ldb * j));
     J incy = (orderB == rocsparse_order_column) ? ((transB == rocsparse_operation_none) ? 1 : ldb)
@@ -82,7 +83,7 @@ __global__ __launch_bounds__(BLOCKSIZE,
     size_t inc = hipBlockDim_x * hipGridDim_x;
     for(J l = 0; l < WIN && gid < K; l++, gid += inc)
     {
-        sum += y[gid * incy] * x[gid * incx];
+        sum += static_cast<T>(y[gid * incy]) * static_cast<T>(x[gid * incx]);
     }
 
     sum = rocsparse_reduce_block<BLOCKSIZE>(sum);
@@ -129,8 +130,8 @@ __global__ __launch_bounds__(NB) void coo_aos_finalize_kernel(rocsparse_int n_su
         out[hipBlockIdx_y] = out[hipBlockIdx_y] * beta + alpha * sum;
 }
 
-template <typename I, typename J, typename T>
-struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default, I, J, T>
+template <typename I, typename J, typename T, typename X>
+struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default, I, J, T, X>
 {
 
     static rocsparse_status buffer_size(rocsparse_handle     handle,
@@ -143,9 +144,9 @@ struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default,
                                         J                    k,
                                         I                    nnz,
                                         const T*             alpha,
-                                        const T*             A_val,
+                                        const X*             A_val,
                                         J                    A_ld,
-                                        const T*             B_val,
+                                        const X*             B_val,
                                         J                    B_ld,
                                         const T*             beta,
                                         const I*             C_row_data,
@@ -170,9 +171,9 @@ struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default,
                                        J                    k,
                                        I                    nnz,
                                        const T*             alpha,
-                                       const T*             A_val,
+                                       const X*             A_val,
                                        J                    A_ld,
-                                       const T*             B_val,
+                                       const X*             B_val,
                                        J                    B_ld,
                                        const T*             beta,
                                        const I*             C_row_data,
@@ -195,9 +196,9 @@ struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default,
                                     J                    k,
                                     I                    nnz,
                                     const T*             alpha,
-                                    const T*             A_val,
+                                    const X*             A_val,
                                     J                    A_ld,
-                                    const T*             B_val,
+                                    const X*             B_val,
                                     J                    B_ld,
                                     const T*             beta,
                                     const I*             C_row_data,
@@ -216,7 +217,7 @@ struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default,
 
         if(handle->pointer_mode == rocsparse_pointer_mode_host)
         {
-            hipLaunchKernelGGL((sddmm_coo_aos_kernel<NB, WIN, I, J, T>),
+            hipLaunchKernelGGL((sddmm_coo_aos_kernel<NB, WIN, I, J, T, X>),
                                blocks,
                                threads,
                                0,
@@ -258,7 +259,7 @@ struct rocsparse_sddmm_st<rocsparse_format_coo_aos, rocsparse_sddmm_alg_default,
         else
         {
 
-            hipLaunchKernelGGL((sddmm_coo_aos_kernel<NB, WIN, I, J, T>),
+            hipLaunchKernelGGL((sddmm_coo_aos_kernel<NB, WIN, I, J, T, X>),
                                blocks,
                                threads,
                                0,
@@ -342,3 +343,29 @@ template struct rocsparse_sddmm_st<rocsparse_format_coo_aos,
                                    int64_t,
                                    int64_t,
                                    rocsparse_double_complex>;
+
+// Dense matrices stored in f16 or bf16 with f32 computation
+template struct rocsparse_sddmm_st<rocsparse_format_coo_aos,
+                                   rocsparse_sddmm_alg_default,
+                                   int32_t,
+                                   int32_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_coo_aos,
+                                   rocsparse_sddmm_alg_default,
+                                   int32_t,
+                                   int32_t,
+                                   float,
+                                   hip_bfloat16>;
+template struct rocsparse_sddmm_st<rocsparse_format_coo_aos,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int64_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_coo_aos,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int64_t,
+                                   float,
+                                   hip_bfloat16>;
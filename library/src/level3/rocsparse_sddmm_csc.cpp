@@ -36,8 +36,8 @@ rocsparse_status rocsparse_csr2coo_template(rocsparse_handle     handle,
                                             J*                   coo_row_ind,
                                             rocsparse_index_base idx_base);
 
-template <typename I, typename J, typename T>
-struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I, J, T>
+template <typename I, typename J, typename T, typename X>
+struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I, J, T, X>
 {
 
     static rocsparse_status buffer_size(rocsparse_handle     handle,
@@ -50,9 +50,9 @@ struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I,
                                         J                    k,
                                         I                    nnz,
                                         const T*             alpha,
-                                        const T*             A_val,
+                                        const X*             A_val,
                                         J                    A_ld,
-                                        const T*             B_val,
+                                        const X*             B_val,
                                         J                    B_ld,
                                         const T*             beta,
                                         const I*             C_row_data,
@@ -63,7 +63,7 @@ struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I,
                                         size_t*              buffer_size)
     {
         rocsparse_status status
-            = rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, J, J, T>::
+            = rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, J, J, T, X>::
                 buffer_size(handle,
                             trans_A,
                             trans_B,
@@ -105,9 +105,9 @@ struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I,
                                        J                    k,
                                        I                    nnz,
                                        const T*             alpha,
-                                       const T*             A_val,
+                                       const X*             A_val,
                                        J                    A_ld,
-                                       const T*             B_val,
+                                       const X*             B_val,
                                        J                    B_ld,
                                        const T*             beta,
                                        const I*             C_ptr_data,
@@ -130,7 +130,7 @@ struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I,
         {
             return status;
         }
-        return rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, J, J, T>::
+        return rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, J, J, T, X>::
             preprocess(handle,
                        trans_A,
                        trans_B,
@@ -164,9 +164,9 @@ struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I,
                                     J                    k,
                                     I                    nnz,
                                     const T*             alpha,
-                                    const T*             A_val,
+                                    const X*             A_val,
                                     J                    A_ld,
-                                    const T*             B_val,
+                                    const X*             B_val,
                                     J                    B_ld,
                                     const T*             beta,
                                     const I*             C_ptr_data,
@@ -178,7 +178,7 @@ struct rocsparse_sddmm_st<rocsparse_format_csc, rocsparse_sddmm_alg_default, I,
     {
         J*    col_data   = (J*)buffer;
         void* coo_buffer = col_data + nnz;
-        return rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, J, J, T>::
+        return rocsparse_sddmm_st<rocsparse_format_coo, rocsparse_sddmm_alg_default, J, J, T, X>::
             compute(handle,
                     trans_A,
                     trans_B,
@@ -265,3 +265,41 @@ template struct rocsparse_sddmm_st<rocsparse_format_csc,
                                    int64_t,
                                    int64_t,
                                    rocsparse_double_complex>;
+
+// Dense matrices stored in f16 or bf16 with f32 computation
+template struct rocsparse_sddmm_st<rocsparse_format_csc,
+                                   rocsparse_sddmm_alg_default,
+                                   int32_t,
+                                   int32_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_csc,
+                                   rocsparse_sddmm_alg_default,
+                                   int32_t,
+                                   int32_t,
+                                   float,
+                                   hip_bfloat16>;
+template struct rocsparse_sddmm_st<rocsparse_format_csc,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int32_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_csc,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int32_t,
+                                   float,
+                                   hip_bfloat16>;
+template struct rocsparse_sddmm_st<rocsparse_format_csc,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int64_t,
+                                   float,
+                                   _Float16>;
+template struct rocsparse_sddmm_st<rocsparse_format_csc,
+                                   rocsparse_sddmm_alg_default,
+                                   int64_t,
+                                   int64_t,
+                                   float,
+                                   hip_bfloat16>;
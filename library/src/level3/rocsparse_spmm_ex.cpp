@@ -26,6 +26,7 @@
 #include "rocsparse.h"
 #include "utility.h"
 
+#include "rocsparse_bsrmm.hpp"
 #include "rocsparse_coomm.hpp"
 #include "rocsparse_csrmm.hpp"
 
@@ -309,9 +310,88 @@ rocsparse_status rocsparse_spmm_ex_template(rocsparse_handle            handle,
         }
     }
 
+    case rocsparse_format_bsr:
+    {
+        // The blocked kernels only support 32 bit indexing and column major dense matrices
+        if(!std::is_same<I, rocsparse_int>() || !std::is_same<J, rocsparse_int>()
+           || mat_B->order != rocsparse_order_column || mat_C->order != rocsparse_order_column)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        if(alg != rocsparse_spmm_alg_default)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        switch(stage)
+        {
+            //
+            // STAGE BUFFER SIZE
+            //
+        case rocsparse_spmm_stage_buffer_size:
+        {
+            RETURN_IF_NULLPTR(buffer_size);
+            *buffer_size = 4;
+            return rocsparse_status_success;
+        }
+
+            //
+            // STAGE PREPROCESS
+            //
+        case rocsparse_spmm_stage_preprocess:
+        {
+            RETURN_IF_NULLPTR(temp_buffer);
+            return rocsparse_status_success;
+        }
+
+            //
+            // STAGE COMPUTE
+            //
+        case rocsparse_spmm_stage_compute:
+        {
+            return rocsparse_bsrmm_template(handle,
+                                            mat_A->block_dir,
+                                            trans_A,
+                                            trans_B,
+                                            (rocsparse_int)mat_A->rows,
+                                            (rocsparse_int)mat_C->cols,
+                                            (rocsparse_int)mat_A->cols,
+                                            (rocsparse_int)mat_A->nnz,
+                                            (const T*)alpha,
+                                            mat_A->descr,
+                                            (const T*)mat_A->val_data,
+                                            (const rocsparse_int*)mat_A->row_data,
+                                            (const rocsparse_int*)mat_A->col_data,
+                                            (rocsparse_int)mat_A->block_dim,
+                                            (const T*)mat_B->values,
+                                            (rocsparse_int)mat_B->ld,
+                                            (const T*)beta,
+                                            (T*)mat_C->values,
+                                            (rocsparse_int)mat_C->ld);
+        }
+
+        case rocsparse_spmm_stage_auto:
+        {
+            return rocsparse_spmm_ex_template_auto<I, J, T>(handle,
+                                                            trans_A,
+                                                            trans_B,
+                                                            alpha,
+                                                            mat_A,
+                                                            mat_B,
+                                                            beta,
+                                                            mat_C,
+                                                            alg,
+                                                            buffer_size,
+                                                            temp_buffer);
+        }
+        }
+    }
+
     case rocsparse_format_coo_aos:
     case rocsparse_format_csc:
     case rocsparse_format_ell:
+    case rocsparse_format_sell:
     {
         return rocsparse_status_not_implemented;
     }
@@ -381,6 +461,247 @@ rocsparse_status rocsparse_spmm_ex_template_auto(rocsparse_handle            han
     }
 }
 
+// Mixed precision, where the sparse matrix and B are stored in a lower precision than the
+// compute type. C is stored in the compute type.
+template <typename I, typename J, typename T, typename A, typename X>
+rocsparse_status rocsparse_spmm_ex_mixed_template(rocsparse_handle            handle,
+                                                  rocsparse_operation         trans_A,
+                                                  rocsparse_operation         trans_B,
+                                                  const void*                 alpha,
+                                                  const rocsparse_spmat_descr mat_A,
+                                                  const rocsparse_dnmat_descr mat_B,
+                                                  const void*                 beta,
+                                                  const rocsparse_dnmat_descr mat_C,
+                                                  rocsparse_spmm_alg          alg,
+                                                  rocsparse_spmm_stage        stage,
+                                                  size_t*                     buffer_size,
+                                                  void*                       temp_buffer)
+{
+    // Mixed precision is only supported for CSR matrices
+    if(mat_A->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    rocsparse_csrmm_alg csrmm_alg;
+    rocsparse_status    status = rocsparse_spmm_alg2csrmm_alg(alg, csrmm_alg);
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    const J m = (J)mat_C->rows;
+    const J n = (J)mat_C->cols;
+    const J k = trans_A == rocsparse_operation_none ? (J)mat_A->cols : (J)mat_A->rows;
+
+    switch(stage)
+    {
+    case rocsparse_spmm_stage_buffer_size:
+    {
+        return rocsparse_csrmm_buffer_size_template(handle,
+                                                    trans_A,
+                                                    csrmm_alg,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    (I)mat_A->nnz,
+                                                    mat_A->descr,
+                                                    (const A*)mat_A->val_data,
+                                                    (const I*)mat_A->row_data,
+                                                    (const J*)mat_A->col_data,
+                                                    buffer_size);
+    }
+
+    case rocsparse_spmm_stage_preprocess:
+    {
+        return rocsparse_csrmm_analysis_template(handle,
+                                                 trans_A,
+                                                 csrmm_alg,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 (I)mat_A->nnz,
+                                                 mat_A->descr,
+                                                 (const A*)mat_A->val_data,
+                                                 (const I*)mat_A->row_data,
+                                                 (const J*)mat_A->col_data,
+                                                 temp_buffer);
+    }
+
+    case rocsparse_spmm_stage_compute:
+    {
+        return rocsparse_csrmm_template(handle,
+                                        trans_A,
+                                        trans_B,
+                                        mat_B->order,
+                                        mat_C->order,
+                                        csrmm_alg,
+                                        m,
+                                        n,
+                                        k,
+                                        (I)mat_A->nnz,
+                                        (const T*)alpha,
+                                        mat_A->descr,
+                                        (const A*)mat_A->val_data,
+                                        (const I*)mat_A->row_data,
+                                        (const J*)mat_A->col_data,
+                                        (const X*)mat_B->values,
+                                        (J)mat_B->ld,
+                                        (const T*)beta,
+                                        (T*)mat_C->values,
+                                        (J)mat_C->ld,
+                                        temp_buffer);
+    }
+
+    case rocsparse_spmm_stage_auto:
+    {
+        if(temp_buffer == nullptr)
+        {
+            return rocsparse_spmm_ex_mixed_template<I, J, T, A, X>(handle,
+                                                                   trans_A,
+                                                                   trans_B,
+                                                                   alpha,
+                                                                   mat_A,
+                                                                   mat_B,
+                                                                   beta,
+                                                                   mat_C,
+                                                                   alg,
+                                                                   rocsparse_spmm_stage_buffer_size,
+                                                                   buffer_size,
+                                                                   temp_buffer);
+        }
+
+        status = rocsparse_spmm_ex_mixed_template<I, J, T, A, X>(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 alpha,
+                                                                 mat_A,
+                                                                 mat_B,
+                                                                 beta,
+                                                                 mat_C,
+                                                                 alg,
+                                                                 rocsparse_spmm_stage_preprocess,
+                                                                 buffer_size,
+                                                                 temp_buffer);
+        if(status != rocsparse_status_success)
+        {
+            return status;
+        }
+
+        return rocsparse_spmm_ex_mixed_template<I, J, T, A, X>(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               alpha,
+                                                               mat_A,
+                                                               mat_B,
+                                                               beta,
+                                                               mat_C,
+                                                               alg,
+                                                               rocsparse_spmm_stage_compute,
+                                                               buffer_size,
+                                                               temp_buffer);
+    }
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+template <typename T, typename A, typename X, typename... Ts>
+rocsparse_status rocsparse_spmm_ex_mixed_dispatch(rocsparse_indextype itype,
+                                                  rocsparse_indextype jtype,
+                                                  Ts&&... ts)
+{
+    if(itype == rocsparse_indextype_i32 && jtype == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmm_ex_mixed_template<int32_t, int32_t, T, A, X>(ts...);
+    }
+    else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i32)
+    {
+        return rocsparse_spmm_ex_mixed_template<int64_t, int32_t, T, A, X>(ts...);
+    }
+    else if(itype == rocsparse_indextype_i64 && jtype == rocsparse_indextype_i64)
+    {
+        return rocsparse_spmm_ex_mixed_template<int64_t, int64_t, T, A, X>(ts...);
+    }
+
+    return rocsparse_status_not_implemented;
+}
+
+template <typename... Ts>
+static inline rocsparse_status
+    rocsparse_spmm_ex_mixed_dynamic_dispatch(rocsparse_indextype itype,
+                                             rocsparse_indextype jtype,
+                                             rocsparse_datatype  atype,
+                                             rocsparse_datatype  btype,
+                                             rocsparse_datatype  ctype,
+                                             rocsparse_datatype  compute_type,
+                                             Ts&&... ts)
+{
+    // C is always stored in the compute type
+    if(ctype != compute_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // i8 matrix and i8 or f32 B with f32 computation
+    if(compute_type == rocsparse_datatype_f32_r && atype == rocsparse_datatype_i8_r
+       && btype == rocsparse_datatype_i8_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<float, int8_t, int8_t>(itype, jtype, ts...);
+    }
+
+    if(compute_type == rocsparse_datatype_f32_r && atype == rocsparse_datatype_i8_r
+       && btype == rocsparse_datatype_f32_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<float, int8_t, float>(itype, jtype, ts...);
+    }
+
+    // f16 or bf16 matrix and f16, bf16 or f32 B with f32 computation
+    if(compute_type == rocsparse_datatype_f32_r && atype == rocsparse_datatype_f16_r
+       && btype == rocsparse_datatype_f16_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<float, _Float16, _Float16>(itype, jtype, ts...);
+    }
+
+    if(compute_type == rocsparse_datatype_f32_r && atype == rocsparse_datatype_f16_r
+       && btype == rocsparse_datatype_f32_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<float, _Float16, float>(itype, jtype, ts...);
+    }
+
+    if(compute_type == rocsparse_datatype_f32_r && atype == rocsparse_datatype_bf16_r
+       && btype == rocsparse_datatype_bf16_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<float, hip_bfloat16, hip_bfloat16>(
+            itype, jtype, ts...);
+    }
+
+    if(compute_type == rocsparse_datatype_f32_r && atype == rocsparse_datatype_bf16_r
+       && btype == rocsparse_datatype_f32_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<float, hip_bfloat16, float>(itype, jtype, ts...);
+    }
+
+    // f32 matrix and f64 B with f64 computation
+    if(compute_type == rocsparse_datatype_f64_r && atype == rocsparse_datatype_f32_r
+       && btype == rocsparse_datatype_f64_r)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<double, float, double>(itype, jtype, ts...);
+    }
+
+    if(compute_type == rocsparse_datatype_f64_c && atype == rocsparse_datatype_f32_c
+       && btype == rocsparse_datatype_f64_c)
+    {
+        return rocsparse_spmm_ex_mixed_dispatch<rocsparse_double_complex,
+                                                rocsparse_float_complex,
+                                                rocsparse_double_complex>(itype, jtype, ts...);
+    }
+
+    return rocsparse_status_not_implemented;
+}
+
 template <typename... Ts>
 static inline rocsparse_status rocsparse_spmm_ex_dynamic_dispatch(rocsparse_datatype  ctype,
                                                                   rocsparse_indextype itype,
@@ -568,7 +889,18 @@ static inline rocsparse_status rocsparse_spmm_ex_dynamic_dispatch(rocsparse_data
         }
         }
     }
+
+    case rocsparse_datatype_i8_r:
+    case rocsparse_datatype_f16_r:
+    case rocsparse_datatype_bf16_r:
+    {
+        return rocsparse_status_not_implemented;
+    }
     }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
 }
 
 /*
@@ -645,11 +977,28 @@ extern "C" rocsparse_status rocsparse_spmm_ex(rocsparse_handle            handle
         return rocsparse_status_not_initialized;
     }
 
-    // Check for matching types while we do not support mixed precision computation
+    // Mixed precision
     if(compute_type != mat_A->data_type || compute_type != mat_B->data_type
        || compute_type != mat_C->data_type)
     {
-        return rocsparse_status_not_implemented;
+        return rocsparse_spmm_ex_mixed_dynamic_dispatch(mat_A->row_type,
+                                                        mat_A->col_type,
+                                                        mat_A->data_type,
+                                                        mat_B->data_type,
+                                                        mat_C->data_type,
+                                                        compute_type,
+                                                        handle,
+                                                        trans_A,
+                                                        trans_B,
+                                                        alpha,
+                                                        mat_A,
+                                                        mat_B,
+                                                        beta,
+                                                        mat_C,
+                                                        alg,
+                                                        stage,
+                                                        buffer_size,
+                                                        temp_buffer);
     }
 
     return rocsparse_spmm_ex_dynamic_dispatch(compute_type,
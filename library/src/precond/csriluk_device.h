@@ -0,0 +1,89 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRILUK_DEVICE_H
+#define CSRILUK_DEVICE_H
+
+#include "common.h"
+
+// Copy the entries of A into the sparsity pattern of LU, where LU is a superset of A.
+// Each segment of WFSIZE threads processes a single row, where each thread looks up
+// the entry of A for a single LU entry.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csriluk_scatter_device(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ csr_row_ptr_lu,
+                                       const rocsparse_int* __restrict__ csr_col_ind_lu,
+                                       T* __restrict__ csr_val_lu,
+                                       rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int row_begin_lu = csr_row_ptr_lu[row] - idx_base;
+    rocsparse_int row_end_lu   = csr_row_ptr_lu[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin_lu + lid; j < row_end_lu; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind_lu[j];
+
+        // Binary search for the column in the row of A
+        rocsparse_int l = row_begin;
+        rocsparse_int r = row_end;
+
+        while(l < r)
+        {
+            rocsparse_int mid = (l + r) >> 1;
+
+            if(csr_col_ind[mid] < col)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        // Fill-in entries are initialized with zero
+        csr_val_lu[j] = (l < row_end && csr_col_ind[l] == col) ? csr_val[l] : static_cast<T>(0);
+    }
+}
+
+#endif // CSRILUK_DEVICE_H
@@ -0,0 +1,319 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRILUT_DEVICE_H
+#define CSRILUT_DEVICE_H
+
+#include "common.h"
+
+// Order preserving integer keys of non-negative magnitudes
+__device__ __forceinline__ int csrilut_key(float val)
+{
+    return __float_as_int(val);
+}
+
+__device__ __forceinline__ int64_t csrilut_key(double val)
+{
+    return static_cast<int64_t>(__double_as_longlong(val));
+}
+
+// Count the entries in [begin, end) of the current row whose magnitude key is at least key.
+// The result is broadcast to all lanes of the wavefront.
+template <unsigned int WFSIZE, typename T, typename K>
+__device__ __forceinline__ int csrilut_count(rocsparse_int begin,
+                                             rocsparse_int end,
+                                             const T* __restrict__ csr_val,
+                                             K             key)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    int count = 0;
+    for(rocsparse_int j = begin + lid; j < end; j += WFSIZE)
+    {
+        count += (csrilut_key(rocsparse_abs(csr_val[j])) >= key);
+    }
+
+    rocsparse_wfreduce_sum<WFSIZE>(&count);
+
+    return __shfl(count, WFSIZE - 1, WFSIZE);
+}
+
+// Drop all entries in [begin, end) of the current row that are below the tolerance and
+// keep only the max_fill entries of largest magnitude. Ties are broken by position.
+// The magnitude of the max_fill-th largest entry is found by bisection on its key, such
+// that each row costs O(len) per bisection step instead of O(len^2).
+template <unsigned int WFSIZE, typename T, typename U>
+__device__ __forceinline__ void csrilut_drop(rocsparse_int begin,
+                                             rocsparse_int end,
+                                             T* __restrict__ csr_val,
+                                             U             tau,
+                                             rocsparse_int max_fill)
+{
+    typedef decltype(csrilut_key(tau)) K;
+
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Smallest key that is kept and the number of entries with exactly this key,
+    // that can be kept
+    K   key_last = csrilut_key(tau);
+    int quota    = end - begin;
+
+    if(csrilut_count<WFSIZE>(begin, end, csr_val, key_last) > max_fill)
+    {
+        if(max_fill <= 0)
+        {
+            // Drop all entries
+            key_last = std::numeric_limits<K>::max();
+            quota    = 0;
+        }
+        else
+        {
+            // Bisection for the largest key with at least max_fill entries above
+            K lo = key_last;
+            K hi = csrilut_key(std::numeric_limits<U>::infinity());
+
+            while(lo < hi)
+            {
+                K mid = lo + (hi - lo + 1) / 2;
+
+                if(csrilut_count<WFSIZE>(begin, end, csr_val, mid) >= max_fill)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid - 1;
+                }
+            }
+
+            key_last = lo;
+            quota    = max_fill - csrilut_count<WFSIZE>(begin, end, csr_val, lo + 1);
+        }
+    }
+
+    // Number of entries with key key_last that have already been processed
+    int ties = 0;
+
+    // All lanes run through the loop, such that ties can be ranked by position
+    for(rocsparse_int base = begin; base < end; base += WFSIZE)
+    {
+        rocsparse_int j = base + lid;
+
+        K key = (j < end) ? csrilut_key(rocsparse_abs(csr_val[j])) : static_cast<K>(-1);
+
+        bool          tie  = (key == key_last);
+        uint64_t      mask = __ballot(tie);
+        int           rank = ties + __popcll(mask & ((1ull << lid) - 1));
+
+        bool keep = (key > key_last) || (tie && rank < quota);
+
+        if(j < end && !keep)
+        {
+            csr_val[j] = static_cast<T>(0);
+        }
+
+        ties += __popcll(mask);
+    }
+}
+
+// Incomplete LU factorization with dual threshold dropping on a given sparsity pattern.
+// Rows are processed by one wavefront each, following the dependency scheme of the
+// csrilu0 binary search kernel.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP, typename T, typename U>
+__device__ void csrilut_binsearch_kernel(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         T* __restrict__ csr_val,
+                                         const rocsparse_int* __restrict__ csr_diag_ind,
+                                         int* __restrict__ done,
+                                         const rocsparse_int* __restrict__ map,
+                                         rocsparse_int* __restrict__ zero_pivot,
+                                         rocsparse_index_base idx_base,
+                                         U                    drop_tol,
+                                         rocsparse_int        max_fill)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Drop tolerance relative to the 2-norm of the current row
+    U norm = static_cast<U>(0);
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        U val = rocsparse_abs(csr_val[j]);
+        norm += val * val;
+    }
+
+    norm  = rocsparse_wfreduce_sum<WFSIZE>(norm);
+    U tau = drop_tol * sqrt(__shfl(norm, WFSIZE - 1, WFSIZE));
+
+    // Loop over column of current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        // End of the row that corresponds to local_col
+        rocsparse_int local_end = csr_row_ptr[local_col + 1] - idx_base;
+
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            local_diag = local_end - 1;
+        }
+
+        // Spin loop until dependency has been resolved
+        int          local_done    = atomicOr(&done[local_col], 0);
+        unsigned int times_through = 0;
+        while(!local_done)
+        {
+            if(SLEEP)
+            {
+                for(unsigned int i = 0; i < times_through; ++i)
+                {
+                    __builtin_amdgcn_s_sleep(1);
+                }
+
+                if(times_through < 3907)
+                {
+                    ++times_through;
+                }
+            }
+
+            local_done = atomicOr(&done[local_col], 0);
+        }
+
+        // Make sure updated csr_val is visible
+        __threadfence();
+
+        // Load diagonal entry
+        T diag_val = csr_val[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col + idx_base);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        local_val = local_val / diag_val;
+
+        // Drop small multipliers, such that row local_col is not eliminated
+        if(rocsparse_abs(local_val) < tau)
+        {
+            csr_val[j] = static_cast<T>(0);
+            continue;
+        }
+
+        csr_val[j] = local_val;
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        rocsparse_int l = j + 1;
+        for(rocsparse_int k = local_diag + 1 + lid; k < local_end; k += WFSIZE)
+        {
+            // Perform a binary search to find matching columns
+            rocsparse_int r     = row_end - 1;
+            rocsparse_int mid   = (r + l) >> 1;
+            rocsparse_int col_j = csr_col_ind[mid];
+
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Binary search
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = mid + 1;
+                }
+                else
+                {
+                    r = mid;
+                }
+
+                mid   = (r + l) >> 1;
+                col_j = csr_col_ind[mid];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                // If a match has been found, do ILU computation
+                csr_val[l] = rocsparse_fma(-local_val, csr_val[k], csr_val[l]);
+            }
+        }
+    }
+
+    // Make sure updated csr_val is visible to all lanes
+    __threadfence_block();
+
+    // Dual threshold dropping of the strictly lower and strictly upper part
+    if(row_diag != -1)
+    {
+        csrilut_drop<WFSIZE>(row_begin, row_diag, csr_val, tau, max_fill);
+        csrilut_drop<WFSIZE>(row_diag + 1, row_end, csr_val, tau, max_fill);
+    }
+
+    // Make sure updated csr_val is written to global memory
+    __threadfence();
+
+    if(lid == 0)
+    {
+        // First lane writes "we are done" flag
+        atomicOr(&done[row], 1);
+    }
+}
+
+#endif // CSRILUT_DEVICE_H
@@ -0,0 +1,250 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRITILU0_DEVICE_H
+#define CSRITILU0_DEVICE_H
+
+#include "common.h"
+
+// Binary search for col in csr_col_ind[begin, end), returns -1 if col is not present
+static __device__ __forceinline__ rocsparse_int csritilu0_binsearch(
+    const rocsparse_int* __restrict__ csr_col_ind,
+    rocsparse_int begin,
+    rocsparse_int end,
+    rocsparse_int col)
+{
+    rocsparse_int l = begin;
+    rocsparse_int r = end;
+
+    while(l < r)
+    {
+        rocsparse_int mid = (l + r) >> 1;
+
+        if(csr_col_ind[mid] < col)
+        {
+            l = mid + 1;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    return (l < end && csr_col_ind[l] == col) ? l : -1;
+}
+
+// Determine the position of the diagonal entry of each row, -1 if it is missing
+template <unsigned int BLOCKSIZE>
+__device__ void csritilu0_diag_device(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      rocsparse_int* __restrict__ csr_diag_ind,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    csr_diag_ind[row] = csritilu0_binsearch(csr_col_ind,
+                                            csr_row_ptr[row] - idx_base,
+                                            csr_row_ptr[row + 1] - idx_base,
+                                            row + idx_base);
+}
+
+// Single fixed-point sweep of the iterative ILU0 factorization. Each entry (i, j)
+// of the LU pattern is updated independently from the previous iterate src by
+//
+//   s = a_ij - sum_{k < min(i, j)} l_ik * u_kj
+//   l_ij = s / u_jj (j < i), u_ij = s (j >= i)
+//
+// Each segment of WFSIZE threads processes a single row, where each thread updates
+// a single entry. Zero or missing diagonal entries skip the division.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csritilu0_sweep_device(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val_a,
+                                       const T* __restrict__ csr_val_src,
+                                       T* __restrict__ csr_val_dst,
+                                       const rocsparse_int* __restrict__ csr_diag_ind,
+                                       rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col  = csr_col_ind[j] - idx_base;
+        rocsparse_int kmax = min(row, col);
+
+        T sum = csr_val_a[j];
+
+        // Loop over l_ik, k < min(i, j)
+        for(rocsparse_int k = row_begin; k < row_end; ++k)
+        {
+            rocsparse_int col_k = csr_col_ind[k] - idx_base;
+
+            if(col_k >= kmax)
+            {
+                break;
+            }
+
+            // Look up u_kj in row k
+            rocsparse_int idx = csritilu0_binsearch(csr_col_ind,
+                                                    csr_row_ptr[col_k] - idx_base,
+                                                    csr_row_ptr[col_k + 1] - idx_base,
+                                                    col + idx_base);
+
+            if(idx != -1)
+            {
+                sum = rocsparse_fma(-csr_val_src[k], csr_val_src[idx], sum);
+            }
+        }
+
+        if(col < row)
+        {
+            rocsparse_int diag = csr_diag_ind[col];
+            T             u_jj = (diag != -1) ? csr_val_src[diag] : static_cast<T>(1);
+
+            csr_val_dst[j] = (u_jj != static_cast<T>(0)) ? sum / u_jj : sum;
+        }
+        else
+        {
+            csr_val_dst[j] = sum;
+        }
+    }
+}
+
+// Single fixed-point sweep of the iterative IC0 factorization. Each entry (i, j),
+// j <= i, of the lower triangular pattern is updated independently from the
+// previous iterate src by
+//
+//   s = a_ij - sum_{k < j} l_jk * conj(l_ik)
+//   l_ij = s / l_jj (j < i), l_ii = sqrt(|s|)
+//
+// Entries of the strictly upper triangular part are not touched. If zero_pivot is
+// given, the first row with a missing or non-positive diagonal s_ii is recorded.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csritic0_sweep_device(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ csr_val_a,
+                                      const T* __restrict__ csr_val_src,
+                                      T* __restrict__ csr_val_dst,
+                                      const rocsparse_int* __restrict__ csr_diag_ind,
+                                      rocsparse_int* __restrict__ zero_pivot,
+                                      rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Structural zero pivot
+    if(zero_pivot != nullptr && lid == 0 && csr_diag_ind[row] == -1)
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, row + idx_base);
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Skip upper triangular part
+        if(col > row)
+        {
+            break;
+        }
+
+        T sum = csr_val_a[j];
+
+        // Loop over l_ik, k < j
+        for(rocsparse_int k = row_begin; k < row_end; ++k)
+        {
+            rocsparse_int col_k = csr_col_ind[k] - idx_base;
+
+            if(col_k >= col)
+            {
+                break;
+            }
+
+            // Look up l_jk in row j
+            rocsparse_int idx = csritilu0_binsearch(csr_col_ind,
+                                                    csr_row_ptr[col] - idx_base,
+                                                    csr_row_ptr[col + 1] - idx_base,
+                                                    col_k + idx_base);
+
+            if(idx != -1)
+            {
+                sum = rocsparse_fma(-csr_val_src[idx], rocsparse_conj(csr_val_src[k]), sum);
+            }
+        }
+
+        if(col < row)
+        {
+            rocsparse_int diag = csr_diag_ind[col];
+            T             l_jj = (diag != -1) ? csr_val_src[diag] : static_cast<T>(1);
+
+            csr_val_dst[j] = (l_jj != static_cast<T>(0)) ? sum / l_jj : sum;
+        }
+        else
+        {
+            // Numerical zero pivot, the matrix is not positive definite
+            if(zero_pivot != nullptr && rocsparse_real(sum) <= 0)
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            csr_val_dst[j] = sqrt(rocsparse_abs(sum));
+        }
+    }
+}
+
+#endif // CSRITILU0_DEVICE_H
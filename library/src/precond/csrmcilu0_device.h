@@ -0,0 +1,291 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRMCILU0_DEVICE_H
+#define CSRMCILU0_DEVICE_H
+
+#include "common.h"
+
+// Multicolor ILU0, processes all rows [row_begin, row_end) of a single color. Rows of
+// the same color do not depend on each other, and all rows of previous colors have
+// already been factorized. Thus, no synchronization is required within a launch.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+__device__ void csrmcilu0_device(rocsparse_int color_begin,
+                                 rocsparse_int color_end,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 T* __restrict__ csr_val,
+                                 const rocsparse_int* __restrict__ csr_diag_ind,
+                                 rocsparse_int* __restrict__ zero_pivot,
+                                 rocsparse_index_base idx_base,
+                                 int                  boost,
+                                 U                    boost_tol,
+                                 T                    boost_val)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Current row this wavefront is working on
+    rocsparse_int row = color_begin + hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= color_end)
+    {
+        return;
+    }
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Loop over column of current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        // End of the row that corresponds to local_col
+        rocsparse_int local_end = csr_row_ptr[local_col + 1] - idx_base;
+
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            local_diag = local_end - 1;
+        }
+
+        // Load diagonal entry
+        T diag_val = csr_val[local_diag];
+
+        // Numeric boost
+        if(boost)
+        {
+            diag_val = (boost_tol >= rocsparse_abs(diag_val)) ? boost_val : diag_val;
+
+            if(lid == 0)
+            {
+                csr_val[local_diag] = diag_val;
+            }
+        }
+        else
+        {
+            // Row has numerical zero diagonal
+            if(diag_val == static_cast<T>(0))
+            {
+                if(lid == 0)
+                {
+                    // We are looking for the first zero pivot
+                    atomicMin(zero_pivot, local_col + idx_base);
+                }
+
+                // Skip this row if it has a zero pivot
+                break;
+            }
+        }
+
+        csr_val[j] = local_val = local_val / diag_val;
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        rocsparse_int l = j + 1;
+        for(rocsparse_int k = local_diag + 1 + lid; k < local_end; k += WFSIZE)
+        {
+            // Perform a binary search to find matching columns
+            rocsparse_int r     = row_end - 1;
+            rocsparse_int m     = (r + l) >> 1;
+            rocsparse_int col_j = csr_col_ind[m];
+
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Binary search
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = m + 1;
+                }
+                else
+                {
+                    r = m;
+                }
+
+                m     = (r + l) >> 1;
+                col_j = csr_col_ind[m];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                // If a match has been found, do ILU computation
+                csr_val[l] = rocsparse_fma(-local_val, csr_val[k], csr_val[l]);
+            }
+        }
+    }
+}
+
+// Multicolor IC0, processes all rows [row_begin, row_end) of a single color
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrmcic0_device(rocsparse_int color_begin,
+                                rocsparse_int color_end,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                T* __restrict__ csr_val,
+                                const rocsparse_int* __restrict__ csr_diag_ind,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Current row this wavefront is working on
+    rocsparse_int row = color_begin + hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= color_end)
+    {
+        return;
+    }
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Row sum accumulator
+    T sum = static_cast<T>(0);
+
+    // Loop over column of current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        // Beginning of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Local row sum
+        T local_sum = static_cast<T>(0);
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            local_diag = row_diag - 1;
+        }
+
+        // Load diagonal entry
+        T diag_val = csr_val[local_diag];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col + idx_base);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        // Compute reciprocal
+        diag_val = static_cast<T>(1) / diag_val;
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        rocsparse_int l = row_begin;
+        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WFSIZE)
+        {
+            // Perform a binary search to find matching columns
+            rocsparse_int r     = row_end - 1;
+            rocsparse_int m     = (r + l) >> 1;
+            rocsparse_int col_j = csr_col_ind[m];
+
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Binary search
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = m + 1;
+                }
+                else
+                {
+                    r = m;
+                }
+
+                m     = (r + l) >> 1;
+                col_j = csr_col_ind[m];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                // If a match has been found, do linear combination
+                local_sum = rocsparse_fma(csr_val[k], rocsparse_conj(csr_val[m]), local_sum);
+            }
+        }
+
+        // Accumulate row sum
+        local_sum = rocsparse_wfreduce_sum<WFSIZE>(local_sum);
+
+        // Last lane id computes the Cholesky factor and writes it to global memory
+        if(lid == WFSIZE - 1)
+        {
+            local_val = (local_val - local_sum) * diag_val;
+            sum       = rocsparse_fma(local_val, rocsparse_conj(local_val), sum);
+
+            csr_val[j] = local_val;
+        }
+    }
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane processes the diagonal entry
+        if(row_diag >= 0)
+        {
+            csr_val[row_diag] = sqrt(rocsparse_abs(csr_val[row_diag] - sum));
+        }
+    }
+}
+
+#endif // CSRMCILU0_DEVICE_H
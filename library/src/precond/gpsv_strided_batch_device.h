@@ -0,0 +1,426 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (c) 2021 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef GPSV_STRIDED_BATCH_DEVICE_H
+#define GPSV_STRIDED_BATCH_DEVICE_H
+
+#include "common.h"
+
+// Pentadiagonal system with entries ds (second lower), dl (lower), d (diagonal),
+// du (upper) and dw (second upper diagonal):
+//
+// [ d0 u0 w0 0  0  0  0  0 ]
+// [ l1 d1 u1 w1 0  0  0  0 ]
+// [ s2 l2 d2 u2 w2 0  0  0 ]
+// [ 0  s3 l3 d3 u3 w3 0  0 ]
+// [ 0  0  s4 l4 d4 u4 w4 0 ]
+// [ 0  0  0  s5 l5 d5 u5 w5]
+// [ 0  0  0  0  s6 l6 d6 u6]
+// [ 0  0  0  0  0  s7 l7 d7]
+//
+// Grouping two consecutive rows and columns results in a block tridiagonal system with
+// 2 x 2 blocks A_k, B_k and C_k, which is solved using parallel cyclic reduction, analogous
+// to the tridiagonal solver. For odd m, the last block is padded with an identity row.
+
+// c = a * b, where all matrices are 2 x 2 and stored row major
+template <typename T>
+__device__ __forceinline__ void gpsv_gemm_2x2(const T* a, const T* b, T* c)
+{
+    c[0] = a[0] * b[0] + a[1] * b[2];
+    c[1] = a[0] * b[1] + a[1] * b[3];
+    c[2] = a[2] * b[0] + a[3] * b[2];
+    c[3] = a[2] * b[1] + a[3] * b[3];
+}
+
+// b = -a^-1
+template <typename T>
+__device__ __forceinline__ void gpsv_neg_inverse_2x2(const T* a, T* b)
+{
+    T inv = static_cast<T>(-1) / (a[0] * a[3] - a[1] * a[2]);
+
+    b[0] = a[3] * inv;
+    b[1] = -a[1] * inv;
+    b[2] = -a[2] * inv;
+    b[3] = a[0] * inv;
+}
+
+// Block parallel cyclic reduction algorithm using shared memory, one thread per 2 x 2 block
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gpsv_strided_batch_pcr_shared_kernel(rocsparse_int m,
+                                              rocsparse_int batch_count,
+                                              rocsparse_int batch_stride,
+                                              const T* __restrict__ ds,
+                                              const T* __restrict__ dl,
+                                              const T* __restrict__ d,
+                                              const T* __restrict__ du,
+                                              const T* __restrict__ dw,
+                                              T* __restrict__ x)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int bid = hipBlockIdx_x;
+
+    // Number of block rows
+    rocsparse_int n = (m + 1) / 2;
+
+    // Rows of the current block
+    rocsparse_int r0  = 2 * tid;
+    rocsparse_int r1  = r0 + 1;
+    rocsparse_int idx = batch_stride * bid + r0;
+
+    // Block parallel cyclic reduction shared memory
+    __shared__ T sa[4 * BLOCKSIZE];
+    __shared__ T sb[4 * BLOCKSIZE];
+    __shared__ T sc[4 * BLOCKSIZE];
+    __shared__ T srhs[2 * BLOCKSIZE];
+
+    // Fill block parallel cyclic reduction shared memory, entries outside the matrix are zero
+    if(tid < n)
+    {
+        sa[tid]                 = (r0 >= 2) ? ds[idx] : static_cast<T>(0);
+        sa[tid + BLOCKSIZE]     = (r0 >= 1) ? dl[idx] : static_cast<T>(0);
+        sa[tid + 2 * BLOCKSIZE] = static_cast<T>(0);
+        sa[tid + 3 * BLOCKSIZE] = (r1 >= 2 && r1 < m) ? ds[idx + 1] : static_cast<T>(0);
+
+        sb[tid]                 = d[idx];
+        sb[tid + BLOCKSIZE]     = (r1 < m) ? du[idx] : static_cast<T>(0);
+        sb[tid + 2 * BLOCKSIZE] = (r1 < m) ? dl[idx + 1] : static_cast<T>(0);
+        sb[tid + 3 * BLOCKSIZE] = (r1 < m) ? d[idx + 1] : static_cast<T>(1);
+
+        sc[tid]                 = (r0 + 2 < m) ? dw[idx] : static_cast<T>(0);
+        sc[tid + BLOCKSIZE]     = static_cast<T>(0);
+        sc[tid + 2 * BLOCKSIZE] = (r1 + 1 < m) ? du[idx + 1] : static_cast<T>(0);
+        sc[tid + 3 * BLOCKSIZE] = (r1 + 2 < m) ? dw[idx + 1] : static_cast<T>(0);
+
+        srhs[tid]             = x[idx];
+        srhs[tid + BLOCKSIZE] = (r1 < m) ? x[idx + 1] : static_cast<T>(0);
+    }
+
+    __syncthreads();
+
+    for(rocsparse_int stride = 1; stride < n; stride <<= 1)
+    {
+        T a[4];
+        T b[4];
+        T c[4];
+        T rhs[2];
+
+        if(tid < n)
+        {
+            rocsparse_int left  = tid - stride;
+            rocsparse_int right = tid + stride;
+
+            for(int j = 0; j < 4; ++j)
+            {
+                a[j] = static_cast<T>(0);
+                b[j] = sb[tid + j * BLOCKSIZE];
+                c[j] = static_cast<T>(0);
+            }
+
+            rhs[0] = srhs[tid];
+            rhs[1] = srhs[tid + BLOCKSIZE];
+
+            if(left >= 0)
+            {
+                T k1[4];
+                T self[4];
+                T other[4];
+                T tmp[4];
+
+                // k1 = -A_k * B_left^-1
+                for(int j = 0; j < 4; ++j)
+                {
+                    self[j]  = sa[tid + j * BLOCKSIZE];
+                    other[j] = sb[left + j * BLOCKSIZE];
+                }
+
+                gpsv_neg_inverse_2x2(other, tmp);
+                gpsv_gemm_2x2(self, tmp, k1);
+
+                // A_k = k1 * A_left
+                for(int j = 0; j < 4; ++j)
+                {
+                    other[j] = sa[left + j * BLOCKSIZE];
+                }
+
+                gpsv_gemm_2x2(k1, other, a);
+
+                // B_k += k1 * C_left
+                for(int j = 0; j < 4; ++j)
+                {
+                    other[j] = sc[left + j * BLOCKSIZE];
+                }
+
+                gpsv_gemm_2x2(k1, other, tmp);
+
+                for(int j = 0; j < 4; ++j)
+                {
+                    b[j] += tmp[j];
+                }
+
+                rhs[0] += k1[0] * srhs[left] + k1[1] * srhs[left + BLOCKSIZE];
+                rhs[1] += k1[2] * srhs[left] + k1[3] * srhs[left + BLOCKSIZE];
+            }
+
+            if(right < n)
+            {
+                T k2[4];
+                T self[4];
+                T other[4];
+                T tmp[4];
+
+                // k2 = -C_k * B_right^-1
+                for(int j = 0; j < 4; ++j)
+                {
+                    self[j]  = sc[tid + j * BLOCKSIZE];
+                    other[j] = sb[right + j * BLOCKSIZE];
+                }
+
+                gpsv_neg_inverse_2x2(other, tmp);
+                gpsv_gemm_2x2(self, tmp, k2);
+
+                // C_k = k2 * C_right
+                for(int j = 0; j < 4; ++j)
+                {
+                    other[j] = sc[right + j * BLOCKSIZE];
+                }
+
+                gpsv_gemm_2x2(k2, other, c);
+
+                // B_k += k2 * A_right
+                for(int j = 0; j < 4; ++j)
+                {
+                    other[j] = sa[right + j * BLOCKSIZE];
+                }
+
+                gpsv_gemm_2x2(k2, other, tmp);
+
+                for(int j = 0; j < 4; ++j)
+                {
+                    b[j] += tmp[j];
+                }
+
+                rhs[0] += k2[0] * srhs[right] + k2[1] * srhs[right + BLOCKSIZE];
+                rhs[1] += k2[2] * srhs[right] + k2[3] * srhs[right + BLOCKSIZE];
+            }
+        }
+
+        __syncthreads();
+
+        if(tid < n)
+        {
+            for(int j = 0; j < 4; ++j)
+            {
+                sa[tid + j * BLOCKSIZE] = a[j];
+                sb[tid + j * BLOCKSIZE] = b[j];
+                sc[tid + j * BLOCKSIZE] = c[j];
+            }
+
+            srhs[tid]             = rhs[0];
+            srhs[tid + BLOCKSIZE] = rhs[1];
+        }
+
+        __syncthreads();
+    }
+
+    // All blocks are decoupled, solve the remaining 2 x 2 systems
+    if(tid < n)
+    {
+        T b[4];
+        T inv[4];
+
+        for(int j = 0; j < 4; ++j)
+        {
+            b[j] = sb[tid + j * BLOCKSIZE];
+        }
+
+        // inv = -B_k^-1
+        gpsv_neg_inverse_2x2(b, inv);
+
+        x[idx] = -(inv[0] * srhs[tid] + inv[1] * srhs[tid + BLOCKSIZE]);
+
+        if(r1 < m)
+        {
+            x[idx + 1] = -(inv[2] * srhs[tid] + inv[3] * srhs[tid + BLOCKSIZE]);
+        }
+    }
+}
+
+// QR factorization using Givens rotations, one thread per system in interleaved layout.
+// Row i of the upper triangular factor R has five non-zero entries in column i to i + 4,
+// which are stored in place in d, du, dw, dl and ds, respectively.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gpsv_interleaved_batch_qr_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          T* __restrict__ ds,
+                                          T* __restrict__ dl,
+                                          T* __restrict__ d,
+                                          T* __restrict__ du,
+                                          T* __restrict__ dw,
+                                          T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Current row i, holding entries in column i to i + 4
+    T a0 = d[gid];
+    T a1 = du[gid];
+    T a2 = dw[gid];
+    T a3 = static_cast<T>(0);
+    T a4 = static_cast<T>(0);
+    T ra = x[gid];
+
+    // Row i + 1, holding entries in column i to i + 3
+    T b0 = dl[batch_stride + gid];
+    T b1 = d[batch_stride + gid];
+    T b2 = du[batch_stride + gid];
+    T b3 = (m > 3) ? dw[batch_stride + gid] : static_cast<T>(0);
+    T rb = x[batch_stride + gid];
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int idx = i * batch_stride + gid;
+
+        // Givens rotation of row i and i + 1 that annihilates b0
+        if(i + 1 < m)
+        {
+            T inv = static_cast<T>(1) / static_cast<T>(hypot(rocsparse_abs(a0), rocsparse_abs(b0)));
+            T cs  = a0 * inv;
+            T sn  = b0 * inv;
+
+            T t0 = rocsparse_conj(cs) * a0 + rocsparse_conj(sn) * b0;
+            T t1 = rocsparse_conj(cs) * a1 + rocsparse_conj(sn) * b1;
+            T t2 = rocsparse_conj(cs) * a2 + rocsparse_conj(sn) * b2;
+            T t3 = rocsparse_conj(cs) * a3 + rocsparse_conj(sn) * b3;
+            T tr = rocsparse_conj(cs) * ra + rocsparse_conj(sn) * rb;
+
+            b1 = cs * b1 - sn * a1;
+            b2 = cs * b2 - sn * a2;
+            b3 = cs * b3 - sn * a3;
+            rb = cs * rb - sn * ra;
+
+            a0 = t0;
+            a1 = t1;
+            a2 = t2;
+            a3 = t3;
+            ra = tr;
+        }
+
+        // Row i + 2, holding entries in column i to i + 4
+        T c0 = static_cast<T>(0);
+        T c1 = static_cast<T>(0);
+        T c2 = static_cast<T>(0);
+        T c3 = static_cast<T>(0);
+        T c4 = static_cast<T>(0);
+        T rc = static_cast<T>(0);
+
+        // Givens rotation of row i and i + 2 that annihilates c0
+        if(i + 2 < m)
+        {
+            rocsparse_int next = idx + 2 * batch_stride;
+
+            c0 = ds[next];
+            c1 = dl[next];
+            c2 = d[next];
+            c3 = (i + 3 < m) ? du[next] : static_cast<T>(0);
+            c4 = (i + 4 < m) ? dw[next] : static_cast<T>(0);
+            rc = x[next];
+
+            T inv = static_cast<T>(1) / static_cast<T>(hypot(rocsparse_abs(a0), rocsparse_abs(c0)));
+            T cs  = a0 * inv;
+            T sn  = c0 * inv;
+
+            T t0 = rocsparse_conj(cs) * a0 + rocsparse_conj(sn) * c0;
+            T t1 = rocsparse_conj(cs) * a1 + rocsparse_conj(sn) * c1;
+            T t2 = rocsparse_conj(cs) * a2 + rocsparse_conj(sn) * c2;
+            T t3 = rocsparse_conj(cs) * a3 + rocsparse_conj(sn) * c3;
+            T t4 = rocsparse_conj(sn) * c4;
+            T tr = rocsparse_conj(cs) * ra + rocsparse_conj(sn) * rc;
+
+            c1 = cs * c1 - sn * a1;
+            c2 = cs * c2 - sn * a2;
+            c3 = cs * c3 - sn * a3;
+            c4 = cs * c4;
+            rc = cs * rc - sn * ra;
+
+            a0 = t0;
+            a1 = t1;
+            a2 = t2;
+            a3 = t3;
+            a4 = t4;
+            ra = tr;
+        }
+
+        // Row i of R is final
+        d[idx]  = a0;
+        du[idx] = a1;
+        dw[idx] = a2;
+        dl[idx] = a3;
+        ds[idx] = a4;
+        x[idx]  = ra;
+
+        // Shift rows
+        a0 = b1;
+        a1 = b2;
+        a2 = b3;
+        a3 = static_cast<T>(0);
+        a4 = static_cast<T>(0);
+        ra = rb;
+
+        b0 = c1;
+        b1 = c2;
+        b2 = c3;
+        b3 = c4;
+        rb = rc;
+    }
+
+    // Backward substitution
+    T x1 = static_cast<T>(0);
+    T x2 = static_cast<T>(0);
+    T x3 = static_cast<T>(0);
+    T x4 = static_cast<T>(0);
+
+    for(rocsparse_int i = m - 1; i >= 0; --i)
+    {
+        rocsparse_int idx = i * batch_stride + gid;
+
+        T x0 = (x[idx] - du[idx] * x1 - dw[idx] * x2 - dl[idx] * x3 - ds[idx] * x4) / d[idx];
+
+        x[idx] = x0;
+
+        x4 = x3;
+        x3 = x2;
+        x2 = x1;
+        x1 = x0;
+    }
+}
+
+#endif // GPSV_STRIDED_BATCH_DEVICE_H
@@ -0,0 +1,337 @@
+/*! \file */
+/* ************************************************************************
+* Copyright (c) 2021 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+* THE SOFTWARE.
+*
+* ************************************************************************ */
+
+#pragma once
+#ifndef GTSV_INTERLEAVED_BATCH_DEVICE_H
+#define GTSV_INTERLEAVED_BATCH_DEVICE_H
+
+#include "common.h"
+
+// In the interleaved batch layout, entry i of system j is stored at i * batch_stride + j.
+// Each thread solves one system and consecutive threads access consecutive addresses, such
+// that all loads and stores are coalesced regardless of the system size m.
+//
+// The LU and QR kernels factorize in place. Row i of the upper triangular factor U has (at
+// most) three non-zero entries u0, u1 and u2 in columns i, i + 1 and i + 2. They are stored
+// in d, du and dl, respectively, and the right-hand side x is overwritten with Q^H * x (QR)
+// or L^-1 * P * x (LU), before a final backward substitution.
+
+// Thomas algorithm, no pivoting
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_interleaved_batch_thomas_kernel(rocsparse_int m,
+                                              rocsparse_int batch_count,
+                                              rocsparse_int batch_stride,
+                                              const T* __restrict__ dl,
+                                              const T* __restrict__ d,
+                                              T* __restrict__ du,
+                                              T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Forward elimination, c' is stored in du
+    T inv = static_cast<T>(1) / d[gid];
+    T c   = du[gid] * inv;
+    T r   = x[gid] * inv;
+
+    du[gid] = c;
+    x[gid]  = r;
+
+    for(rocsparse_int i = 1; i < m; ++i)
+    {
+        rocsparse_int idx = i * batch_stride + gid;
+
+        T a = dl[idx];
+
+        inv = static_cast<T>(1) / (d[idx] - a * c);
+        c   = (i < m - 1) ? du[idx] * inv : static_cast<T>(0);
+        r   = (x[idx] - a * r) * inv;
+
+        du[idx] = c;
+        x[idx]  = r;
+    }
+
+    // Backward substitution
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        rocsparse_int idx = i * batch_stride + gid;
+
+        r = x[idx] - du[idx] * r;
+
+        x[idx] = r;
+    }
+}
+
+// LU factorization with partial pivoting
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_interleaved_batch_lu_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          T* __restrict__ dl,
+                                          T* __restrict__ d,
+                                          T* __restrict__ du,
+                                          T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Current row after elimination, holding entries in column i and i + 1
+    T b = d[gid];
+    T c = du[gid];
+    T r = x[gid];
+
+    for(rocsparse_int i = 0; i < m - 1; ++i)
+    {
+        rocsparse_int idx  = i * batch_stride + gid;
+        rocsparse_int next = idx + batch_stride;
+
+        // Next row, holding entries in column i, i + 1 and i + 2
+        T a  = dl[next];
+        T bn = d[next];
+        T cn = (i < m - 2) ? du[next] : static_cast<T>(0);
+        T rn = x[next];
+
+        if(rocsparse_abs(b) >= rocsparse_abs(a))
+        {
+            // No row interchange
+            T l = a / b;
+
+            d[idx]  = b;
+            du[idx] = c;
+            dl[idx] = static_cast<T>(0);
+            x[idx]  = r;
+
+            b = bn - l * c;
+            c = cn;
+            r = rn - l * r;
+        }
+        else
+        {
+            // Interchange current and next row
+            T l = b / a;
+
+            d[idx]  = a;
+            du[idx] = bn;
+            dl[idx] = cn;
+            x[idx]  = rn;
+
+            b = c - l * bn;
+            c = -l * cn;
+            r = r - l * rn;
+        }
+    }
+
+    // Backward substitution
+    rocsparse_int idx = (m - 1) * batch_stride + gid;
+
+    T x2 = static_cast<T>(0);
+    T x1 = r / b;
+
+    d[idx]  = b;
+    du[idx] = static_cast<T>(0);
+    dl[idx] = static_cast<T>(0);
+    x[idx]  = x1;
+
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        idx = i * batch_stride + gid;
+
+        T x0 = (x[idx] - du[idx] * x1 - dl[idx] * x2) / d[idx];
+
+        x[idx] = x0;
+
+        x2 = x1;
+        x1 = x0;
+    }
+}
+
+// QR factorization using Givens rotations
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_interleaved_batch_qr_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          T* __restrict__ dl,
+                                          T* __restrict__ d,
+                                          T* __restrict__ du,
+                                          T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Current row after rotation, holding entries in column i and i + 1
+    T b = d[gid];
+    T c = du[gid];
+    T r = x[gid];
+
+    for(rocsparse_int i = 0; i < m - 1; ++i)
+    {
+        rocsparse_int idx  = i * batch_stride + gid;
+        rocsparse_int next = idx + batch_stride;
+
+        // Next row, holding entries in column i, i + 1 and i + 2
+        T a  = dl[next];
+        T bn = d[next];
+        T cn = (i < m - 2) ? du[next] : static_cast<T>(0);
+        T rn = x[next];
+
+        // Givens rotation that annihilates a
+        T inv = static_cast<T>(1) / static_cast<T>(hypot(rocsparse_abs(b), rocsparse_abs(a)));
+        T cs  = b * inv;
+        T sn  = a * inv;
+
+        d[idx]  = rocsparse_conj(cs) * b + rocsparse_conj(sn) * a;
+        du[idx] = rocsparse_conj(cs) * c + rocsparse_conj(sn) * bn;
+        dl[idx] = rocsparse_conj(sn) * cn;
+        x[idx]  = rocsparse_conj(cs) * r + rocsparse_conj(sn) * rn;
+
+        b = cs * bn - sn * c;
+        c = cs * cn;
+        r = cs * rn - sn * r;
+    }
+
+    // Backward substitution
+    rocsparse_int idx = (m - 1) * batch_stride + gid;
+
+    T x2 = static_cast<T>(0);
+    T x1 = r / b;
+
+    d[idx]  = b;
+    du[idx] = static_cast<T>(0);
+    dl[idx] = static_cast<T>(0);
+    x[idx]  = x1;
+
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        idx = i * batch_stride + gid;
+
+        T x0 = (x[idx] - du[idx] * x1 - dl[idx] * x2) / d[idx];
+
+        x[idx] = x0;
+
+        x2 = x1;
+        x1 = x0;
+    }
+}
+
+// Transpose m x batch_count entries from strided into interleaved layout, using shared
+// memory tiles such that both, reads and writes, are coalesced
+template <unsigned int DIM_X, unsigned int DIM_Y, typename T>
+__launch_bounds__(DIM_X* DIM_Y) __global__
+    void gtsv_strided_to_interleaved_kernel(rocsparse_int m,
+                                            rocsparse_int batch_count,
+                                            rocsparse_int batch_stride,
+                                            const T* __restrict__ src,
+                                            T* __restrict__ dst)
+{
+    rocsparse_int tx = hipThreadIdx_x;
+    rocsparse_int ty = hipThreadIdx_y;
+
+    rocsparse_int row_begin   = hipBlockIdx_y * DIM_X;
+    rocsparse_int batch_begin = hipBlockIdx_x * DIM_X;
+
+    __shared__ T tile[DIM_X][DIM_X + 1];
+
+    for(unsigned int k = ty; k < DIM_X; k += DIM_Y)
+    {
+        rocsparse_int row   = row_begin + tx;
+        rocsparse_int batch = batch_begin + k;
+
+        if(row < m && batch < batch_count)
+        {
+            tile[k][tx] = src[batch_stride * batch + row];
+        }
+    }
+
+    __syncthreads();
+
+    for(unsigned int k = ty; k < DIM_X; k += DIM_Y)
+    {
+        rocsparse_int row   = row_begin + k;
+        rocsparse_int batch = batch_begin + tx;
+
+        if(row < m && batch < batch_count)
+        {
+            dst[batch_count * row + batch] = tile[tx][k];
+        }
+    }
+}
+
+// Transpose m x batch_count entries from interleaved back into strided layout
+template <unsigned int DIM_X, unsigned int DIM_Y, typename T>
+__launch_bounds__(DIM_X* DIM_Y) __global__
+    void gtsv_interleaved_to_strided_kernel(rocsparse_int m,
+                                            rocsparse_int batch_count,
+                                            rocsparse_int batch_stride,
+                                            const T* __restrict__ src,
+                                            T* __restrict__ dst)
+{
+    rocsparse_int tx = hipThreadIdx_x;
+    rocsparse_int ty = hipThreadIdx_y;
+
+    rocsparse_int row_begin   = hipBlockIdx_y * DIM_X;
+    rocsparse_int batch_begin = hipBlockIdx_x * DIM_X;
+
+    __shared__ T tile[DIM_X][DIM_X + 1];
+
+    for(unsigned int k = ty; k < DIM_X; k += DIM_Y)
+    {
+        rocsparse_int row   = row_begin + k;
+        rocsparse_int batch = batch_begin + tx;
+
+        if(row < m && batch < batch_count)
+        {
+            tile[k][tx] = src[batch_count * row + batch];
+        }
+    }
+
+    __syncthreads();
+
+    for(unsigned int k = ty; k < DIM_X; k += DIM_Y)
+    {
+        rocsparse_int row   = row_begin + tx;
+        rocsparse_int batch = batch_begin + k;
+
+        if(row < m && batch < batch_count)
+        {
+            dst[batch_stride * batch + row] = tile[tx][k];
+        }
+    }
+}
+
+#endif // GTSV_INTERLEAVED_BATCH_DEVICE_H
@@ -274,7 +274,8 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
                                                      bsr_col_ind,
                                                      info->bsric0_info,
                                                      &info->zero_pivot,
-                                                     temp_buffer));
+                                                     temp_buffer,
+                                                     false));
 
     return rocsparse_status_success;
 }
@@ -319,7 +319,8 @@ rocsparse_status rocsparse_bsrilu0_analysis_template(rocsparse_handle          h
                                                      bsr_col_ind,
                                                      info->bsrilu0_info,
                                                      &info->zero_pivot,
-                                                     temp_buffer));
+                                                     temp_buffer,
+                                                     false));
 
     return rocsparse_status_success;
 }
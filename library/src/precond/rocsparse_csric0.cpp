@@ -331,8 +331,8 @@ extern "C" rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handl
     hipStream_t stream = handle->stream;
 
     // If m == 0 || nnz == 0 it can happen, that info structure is not created.
-    // In this case, always return -1.
-    if(info->csric0_info == nullptr)
+    // In this case, always return -1. rocsparse_csritic0() only sets the zero pivot.
+    if(info->csric0_info == nullptr && info->zero_pivot == nullptr)
     {
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
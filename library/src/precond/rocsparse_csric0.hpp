@@ -195,7 +195,8 @@ rocsparse_status rocsparse_csric0_analysis_template(rocsparse_handle          ha
                                                      csr_col_ind,
                                                      info->csric0_info,
                                                      &info->zero_pivot,
-                                                     temp_buffer));
+                                                     temp_buffer,
+                                                     false));
 
     return rocsparse_status_success;
 }
@@ -246,7 +246,8 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
                                                      csr_col_ind,
                                                      info->csrilu0_info,
                                                      &info->zero_pivot,
-                                                     temp_buffer));
+                                                     temp_buffer,
+                                                     false));
 
     return rocsparse_status_success;
 }
@@ -0,0 +1,444 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csriluk.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+
+// Computes the level of fill pattern of the incomplete LU factorization row by row. The
+// level of a fill-in entry (i,j) that is created by eliminating row k is
+// lev(i,k) + lev(k,j) + 1, entries of A and the diagonal have level 0.
+static rocsparse_status rocsparse_csriluk_pattern(rocsparse_handle            handle,
+                                                  rocsparse_int               m,
+                                                  rocsparse_int               nnz,
+                                                  const rocsparse_mat_descr   descr,
+                                                  const rocsparse_int*        csr_row_ptr,
+                                                  const rocsparse_int*        csr_col_ind,
+                                                  rocsparse_int               level_of_fill,
+                                                  std::vector<rocsparse_int>& csr_row_ptr_lu,
+                                                  std::vector<rocsparse_int>* csr_col_ind_lu)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_index_base base = descr->base;
+
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+    std::vector<rocsparse_int> hcsr_col_ind(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_row_ptr.data(),
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_col_ind.data(),
+                                       csr_col_ind,
+                                       sizeof(rocsparse_int) * nnz,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Strictly upper part of the factor rows computed so far, with their levels
+    std::vector<rocsparse_int> u_row_ptr(m + 1, 0);
+    std::vector<rocsparse_int> u_col_ind;
+    std::vector<rocsparse_int> u_level;
+
+    // Level of each column of the current row, -1 if not part of the row
+    std::vector<rocsparse_int> level(m, -1);
+
+    // Columns of the current row
+    std::vector<rocsparse_int> cols;
+
+    // Columns of the strictly lower part of the current row that are left to eliminate
+    std::priority_queue<rocsparse_int, std::vector<rocsparse_int>, std::greater<rocsparse_int>>
+        lower;
+
+    csr_row_ptr_lu.resize(m + 1);
+    csr_row_ptr_lu[0] = base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        // Diagonal is always part of the pattern
+        level[i] = 0;
+        cols.push_back(i);
+
+        for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = hcsr_col_ind[j] - base;
+
+            if(col < 0 || col >= m)
+            {
+                return rocsparse_status_invalid_value;
+            }
+
+            if(level[col] == -1)
+            {
+                level[col] = 0;
+                cols.push_back(col);
+
+                if(col < i)
+                {
+                    lower.push(col);
+                }
+            }
+        }
+
+        // Eliminate the lower part in increasing column order. Fill-in in the lower part
+        // is created right of the current column only and thus processed later.
+        while(!lower.empty())
+        {
+            rocsparse_int k = lower.top();
+            lower.pop();
+
+            rocsparse_int level_k = level[k];
+
+            for(rocsparse_int j = u_row_ptr[k]; j < u_row_ptr[k + 1]; ++j)
+            {
+                rocsparse_int col       = u_col_ind[j];
+                rocsparse_int level_col = level_k + u_level[j] + 1;
+
+                if(level_col > level_of_fill)
+                {
+                    continue;
+                }
+
+                if(level[col] == -1)
+                {
+                    level[col] = level_col;
+                    cols.push_back(col);
+
+                    if(col < i)
+                    {
+                        lower.push(col);
+                    }
+                }
+                else
+                {
+                    level[col] = std::min(level[col], level_col);
+                }
+            }
+        }
+
+        std::sort(cols.begin(), cols.end());
+
+        csr_row_ptr_lu[i + 1] = csr_row_ptr_lu[i] + cols.size();
+
+        // Store the strictly upper part for the elimination of subsequent rows
+        for(size_t j = 0; j < cols.size(); ++j)
+        {
+            if(cols[j] > i)
+            {
+                u_col_ind.push_back(cols[j]);
+                u_level.push_back(level[cols[j]]);
+            }
+
+            if(csr_col_ind_lu != nullptr)
+            {
+                csr_col_ind_lu->push_back(cols[j] + base);
+            }
+
+            level[cols[j]] = -1;
+        }
+
+        u_row_ptr[i + 1] = u_col_ind.size();
+
+        cols.clear();
+    }
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status rocsparse_csriluk_check(rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             level_of_fill)
+{
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check level of fill
+    if(level_of_fill < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check pointer arguments
+    if(m > 0 && csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz > 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             level_of_fill,
+                                                  rocsparse_int*            csr_row_ptr_lu,
+                                                  rocsparse_int*            nnz_lu)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_nnz",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              level_of_fill,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)nnz_lu);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csriluk_check(m, nnz, descr, csr_row_ptr, csr_col_ind, level_of_fill));
+
+    if(nnz_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            *nnz_lu = 0;
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_lu, 0, sizeof(rocsparse_int), handle->stream));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    std::vector<rocsparse_int> hcsr_row_ptr_lu;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_pattern(
+        handle, m, nnz, descr, csr_row_ptr, csr_col_ind, level_of_fill, hcsr_row_ptr_lu, nullptr));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_row_ptr_lu,
+                                       hcsr_row_ptr_lu.data(),
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyHostToDevice,
+                                       handle->stream));
+
+    rocsparse_int hnnz_lu = hcsr_row_ptr_lu[m] - descr->base;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        *nnz_lu = hnnz_lu;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_lu, &hnnz_lu, sizeof(rocsparse_int), hipMemcpyHostToDevice, handle->stream));
+    }
+
+    // Wait for the transfers from host memory to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             level_of_fill,
+                                                       rocsparse_int*            csr_col_ind_lu)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_symbolic",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              level_of_fill,
+              (const void*&)csr_col_ind_lu);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csriluk_check(m, nnz, descr, csr_row_ptr, csr_col_ind, level_of_fill));
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    std::vector<rocsparse_int> hcsr_row_ptr_lu;
+    std::vector<rocsparse_int> hcsr_col_ind_lu;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_pattern(handle,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        level_of_fill,
+                                                        hcsr_row_ptr_lu,
+                                                        &hcsr_col_ind_lu));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind_lu,
+                                       hcsr_col_ind_lu.data(),
+                                       sizeof(rocsparse_int) * hcsr_col_ind_lu.size(),
+                                       hipMemcpyHostToDevice,
+                                       handle->stream));
+
+    // Wait for the transfer from host memory to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                                 \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                     \
+                                     rocsparse_int             m,                          \
+                                     rocsparse_int             nnz,                        \
+                                     const rocsparse_mat_descr descr,                      \
+                                     const TYPE*               csr_val,                    \
+                                     const rocsparse_int*      csr_row_ptr,                \
+                                     const rocsparse_int*      csr_col_ind,                \
+                                     rocsparse_int             nnz_lu,                     \
+                                     TYPE*                     csr_val_lu,                 \
+                                     const rocsparse_int*      csr_row_ptr_lu,             \
+                                     const rocsparse_int*      csr_col_ind_lu,             \
+                                     rocsparse_mat_info        info,                       \
+                                     rocsparse_solve_policy    policy,                     \
+                                     void*                     temp_buffer)                \
+    {                                                                                      \
+        if(info != nullptr && info->use_double_prec_tol)                                   \
+        {                                                                                  \
+            return rocsparse_csriluk_template<TYPE, double>(handle,                        \
+                                                            m,                             \
+                                                            nnz,                           \
+                                                            descr,                         \
+                                                            csr_val,                       \
+                                                            csr_row_ptr,                   \
+                                                            csr_col_ind,                   \
+                                                            nnz_lu,                        \
+                                                            csr_val_lu,                    \
+                                                            csr_row_ptr_lu,                \
+                                                            csr_col_ind_lu,                \
+                                                            info,                          \
+                                                            policy,                        \
+                                                            temp_buffer);                  \
+        }                                                                                  \
+        else                                                                               \
+        {                                                                                  \
+            return rocsparse_csriluk_template<TYPE, floating_data_t<TYPE>>(handle,         \
+                                                                           m,              \
+                                                                           nnz,            \
+                                                                           descr,          \
+                                                                           csr_val,        \
+                                                                           csr_row_ptr,    \
+                                                                           csr_col_ind,    \
+                                                                           nnz_lu,         \
+                                                                           csr_val_lu,     \
+                                                                           csr_row_ptr_lu, \
+                                                                           csr_col_ind_lu, \
+                                                                           info,           \
+                                                                           policy,         \
+                                                                           temp_buffer);   \
+        }                                                                                  \
+    }
+
+C_IMPL(rocsparse_scsriluk, float);
+C_IMPL(rocsparse_dcsriluk, double);
+C_IMPL(rocsparse_ccsriluk, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsriluk, rocsparse_double_complex);
+
+#undef C_IMPL
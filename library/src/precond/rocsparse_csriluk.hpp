@@ -0,0 +1,224 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUK_HPP
+#define ROCSPARSE_CSRILUK_HPP
+
+#include "csriluk_device.h"
+#include "definitions.h"
+#include "rocsparse_csrilu0.hpp"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_scatter_kernel(rocsparse_int        m,
+                                const rocsparse_int* csr_row_ptr,
+                                const rocsparse_int* csr_col_ind,
+                                const T*             csr_val,
+                                const rocsparse_int* csr_row_ptr_lu,
+                                const rocsparse_int* csr_col_ind_lu,
+                                T*                   csr_val_lu,
+                                rocsparse_index_base idx_base)
+{
+    csriluk_scatter_device<BLOCKSIZE, WFSIZE>(m,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val,
+                                              csr_row_ptr_lu,
+                                              csr_col_ind_lu,
+                                              csr_val_lu,
+                                              idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csriluk_scatter(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           T*                        csr_val_lu,
+                                           const rocsparse_int*      csr_row_ptr_lu,
+                                           const rocsparse_int*      csr_col_ind_lu)
+{
+#define CSRILUK_DIM 256
+#define CSRILUK_WFSIZE 32
+    hipLaunchKernelGGL((csriluk_scatter_kernel<CSRILUK_DIM, CSRILUK_WFSIZE>),
+                       dim3((m - 1) / (CSRILUK_DIM / CSRILUK_WFSIZE) + 1),
+                       dim3(CSRILUK_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr_row_ptr_lu,
+                       csr_col_ind_lu,
+                       csr_val_lu,
+                       descr->base);
+#undef CSRILUK_WFSIZE
+#undef CSRILUK_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csriluk_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             nnz_lu,
+                                            T*                        csr_val_lu,
+                                            const rocsparse_int*      csr_row_ptr_lu,
+                                            const rocsparse_int*      csr_col_ind_lu,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              nnz_lu,
+              (const void*&)csr_val_lu,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)csr_col_ind_lu,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csriluk -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_lu < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_lu == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz > 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Copy A into the pattern of LU
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_scatter(handle,
+                                                        m,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        csr_val_lu,
+                                                        csr_row_ptr_lu,
+                                                        csr_col_ind_lu));
+
+    // ILU(k) is ILU(0) on the level of fill pattern
+    return rocsparse_csrilu0_template<T, U>(handle,
+                                            m,
+                                            nnz_lu,
+                                            descr,
+                                            csr_val_lu,
+                                            csr_row_ptr_lu,
+                                            csr_col_ind_lu,
+                                            info,
+                                            policy,
+                                            temp_buffer);
+}
+
+#endif // ROCSPARSE_CSRILUK_HPP
@@ -0,0 +1,108 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csrilut.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle             handle,         \
+                                     rocsparse_int                m,              \
+                                     rocsparse_int                nnz,            \
+                                     const rocsparse_mat_descr    descr,          \
+                                     const TYPE*                  csr_val,        \
+                                     const rocsparse_int*         csr_row_ptr,    \
+                                     const rocsparse_int*         csr_col_ind,    \
+                                     const floating_data_t<TYPE>* drop_tol,       \
+                                     rocsparse_int                max_fill,       \
+                                     rocsparse_int                nnz_lu,         \
+                                     TYPE*                        csr_val_lu,     \
+                                     const rocsparse_int*         csr_row_ptr_lu, \
+                                     const rocsparse_int*         csr_col_ind_lu, \
+                                     rocsparse_mat_info           info,           \
+                                     rocsparse_solve_policy       policy,         \
+                                     void*                        temp_buffer)    \
+    {                                                                             \
+        return rocsparse_csrilut_template(handle,                                 \
+                                          m,                                      \
+                                          nnz,                                    \
+                                          descr,                                  \
+                                          csr_val,                                \
+                                          csr_row_ptr,                            \
+                                          csr_col_ind,                            \
+                                          drop_tol,                               \
+                                          max_fill,                               \
+                                          nnz_lu,                                 \
+                                          csr_val_lu,                             \
+                                          csr_row_ptr_lu,                         \
+                                          csr_col_ind_lu,                         \
+                                          info,                                   \
+                                          policy,                                 \
+                                          temp_buffer);                           \
+    }
+
+C_IMPL(rocsparse_scsrilut, float);
+C_IMPL(rocsparse_dcsrilut, double);
+C_IMPL(rocsparse_ccsrilut, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrilut, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,            \
+                                     rocsparse_int             m,                 \
+                                     const rocsparse_mat_descr descr,             \
+                                     rocsparse_int             nnz_lu,            \
+                                     TYPE*                     csr_val_lu,        \
+                                     rocsparse_int*            csr_row_ptr_lu,    \
+                                     rocsparse_int*            csr_col_ind_lu,    \
+                                     rocsparse_int*            nnz_lu_compressed, \
+                                     rocsparse_mat_info        info,              \
+                                     rocsparse_solve_policy    policy,            \
+                                     void*                     temp_buffer)       \
+    {                                                                             \
+        return rocsparse_csrilut_compress_template(handle,                        \
+                                                   m,                             \
+                                                   descr,                         \
+                                                   nnz_lu,                        \
+                                                   csr_val_lu,                    \
+                                                   csr_row_ptr_lu,                \
+                                                   csr_col_ind_lu,                \
+                                                   nnz_lu_compressed,             \
+                                                   info,                          \
+                                                   policy,                        \
+                                                   temp_buffer);                  \
+    }
+
+C_IMPL(rocsparse_scsrilut_compress, float);
+C_IMPL(rocsparse_dcsrilut_compress, double);
+C_IMPL(rocsparse_ccsrilut_compress, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrilut_compress, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,582 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRILUT_HPP
+#define ROCSPARSE_CSRILUT_HPP
+
+#include "../conversion/rocsparse_csr2csr_compress.hpp"
+#include "../conversion/rocsparse_nnz_compress.hpp"
+#include "csrilut_device.h"
+#include "definitions.h"
+#include "rocsparse_csriluk.hpp"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void csrilut_binsearch(rocsparse_int        m,
+                                                               const rocsparse_int* csr_row_ptr,
+                                                               const rocsparse_int* csr_col_ind,
+                                                               T*                   csr_val,
+                                                               const rocsparse_int* csr_diag_ind,
+                                                               int*                 done,
+                                                               const rocsparse_int* map,
+                                                               rocsparse_int*       zero_pivot,
+                                                               rocsparse_index_base idx_base,
+                                                               U drop_tol_device_host,
+                                                               rocsparse_int max_fill)
+{
+    auto drop_tol = load_scalar_device_host(drop_tol_device_host);
+
+    csrilut_binsearch_kernel<BLOCKSIZE, WFSIZE, SLEEP>(m,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       csr_val,
+                                                       csr_diag_ind,
+                                                       done,
+                                                       map,
+                                                       zero_pivot,
+                                                       idx_base,
+                                                       drop_tol,
+                                                       max_fill);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilut_dispatch(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        csr_val_lu,
+                                            const rocsparse_int*      csr_row_ptr_lu,
+                                            const rocsparse_int*      csr_col_ind_lu,
+                                            rocsparse_mat_info        info,
+                                            void*                     temp_buffer,
+                                            U                         drop_tol_device_host,
+                                            rocsparse_int             max_fill)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    // Determine gcnArch and ASIC revision
+    int gcnArch = handle->properties.gcnArch;
+    int asicRev = handle->asic_rev;
+
+#define CSRILUT_DIM 256
+    dim3 csrilut_blocks((m * handle->wavefront_size - 1) / CSRILUT_DIM + 1);
+    dim3 csrilut_threads(CSRILUT_DIM);
+
+    if(gcnArch == 908 && asicRev < 2)
+    {
+        hipLaunchKernelGGL((csrilut_binsearch<CSRILUT_DIM, 64, true>),
+                           csrilut_blocks,
+                           csrilut_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           info->csrilu0_info->trm_diag_ind,
+                           d_done_array,
+                           info->csrilu0_info->row_map,
+                           info->zero_pivot,
+                           descr->base,
+                           drop_tol_device_host,
+                           max_fill);
+    }
+    else if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrilut_binsearch<CSRILUT_DIM, 32, false>),
+                           csrilut_blocks,
+                           csrilut_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           info->csrilu0_info->trm_diag_ind,
+                           d_done_array,
+                           info->csrilu0_info->row_map,
+                           info->zero_pivot,
+                           descr->base,
+                           drop_tol_device_host,
+                           max_fill);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrilut_binsearch<CSRILUT_DIM, 64, false>),
+                           csrilut_blocks,
+                           csrilut_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           info->csrilu0_info->trm_diag_ind,
+                           d_done_array,
+                           info->csrilu0_info->row_map,
+                           info->zero_pivot,
+                           descr->base,
+                           drop_tol_device_host,
+                           max_fill);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+#undef CSRILUT_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            const floating_data_t<T>* drop_tol,
+                                            rocsparse_int             max_fill,
+                                            rocsparse_int             nnz_lu,
+                                            T*                        csr_val_lu,
+                                            const rocsparse_int*      csr_row_ptr_lu,
+                                            const rocsparse_int*      csr_col_ind_lu,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              LOG_TRACE_SCALAR_VALUE(handle, drop_tol),
+              max_fill,
+              nnz_lu,
+              (const void*&)csr_val_lu,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)csr_col_ind_lu,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrilut -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--threshold",
+              LOG_BENCH_SCALAR_VALUE(handle, drop_tol),
+              "--maxfill",
+              max_fill);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_lu < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check maximum fill
+    if(max_fill < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_lu == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz > 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(drop_tol == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Copy A into the pattern of LU
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_scatter(handle,
+                                                        m,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        csr_val_lu,
+                                                        csr_row_ptr_lu,
+                                                        csr_col_ind_lu));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrilut_dispatch(handle,
+                                          m,
+                                          descr,
+                                          csr_val_lu,
+                                          csr_row_ptr_lu,
+                                          csr_col_ind_lu,
+                                          info,
+                                          temp_buffer,
+                                          drop_tol,
+                                          max_fill);
+    }
+    else
+    {
+        // Check drop tolerance
+        if(*drop_tol < static_cast<floating_data_t<T>>(0))
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        return rocsparse_csrilut_dispatch(handle,
+                                          m,
+                                          descr,
+                                          csr_val_lu,
+                                          csr_row_ptr_lu,
+                                          csr_col_ind_lu,
+                                          info,
+                                          temp_buffer,
+                                          *drop_tol,
+                                          max_fill);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_compress_dispatch(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     const rocsparse_mat_descr descr,
+                                                     rocsparse_int             nnz_lu,
+                                                     T*                        csr_val_lu,
+                                                     rocsparse_int*            csr_row_ptr_lu,
+                                                     rocsparse_int*            csr_col_ind_lu,
+                                                     rocsparse_int*            nnz_lu_compressed,
+                                                     rocsparse_mat_info        info,
+                                                     rocsparse_solve_policy    policy,
+                                                     void*                     temp_buffer,
+                                                     void*                     copy_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Copy buffer
+    char* ptr = reinterpret_cast<char*>(copy_buffer);
+
+    // Number of non-zeros per row of the compressed LU
+    rocsparse_int* nnz_per_row = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Copy of LU, since the compression cannot be done in place
+    rocsparse_int* row_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * (m + 1) - 1) / 256 + 1) * 256;
+
+    rocsparse_int* col_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * nnz_lu - 1) / 256 + 1) * 256;
+
+    T* val = reinterpret_cast<T*>(ptr);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(row_ptr,
+                                       csr_row_ptr_lu,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(col_ind,
+                                       csr_col_ind_lu,
+                                       sizeof(rocsparse_int) * nnz_lu,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        val, csr_val_lu, sizeof(T) * nnz_lu, hipMemcpyDeviceToDevice, stream));
+
+    // Count the entries that have not been dropped
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_nnz_compress_template(
+        handle, m, descr, val, row_ptr, nnz_per_row, nnz_lu_compressed, static_cast<T>(0)));
+
+    // The analysis requires the compressed number of non-zeros on the host
+    rocsparse_int nnz;
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &nnz, nnz_lu_compressed, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+    {
+        nnz = *nnz_lu_compressed;
+    }
+
+    // Remove the dropped entries from LU
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csr_compress_template(handle,
+                                                                  m,
+                                                                  m,
+                                                                  descr,
+                                                                  val,
+                                                                  row_ptr,
+                                                                  col_ind,
+                                                                  nnz_lu,
+                                                                  nnz_per_row,
+                                                                  csr_val_lu,
+                                                                  csr_row_ptr_lu,
+                                                                  csr_col_ind_lu,
+                                                                  static_cast<T>(0)));
+
+    // The csrilu0 meta data belongs to the uncompressed pattern. If it is shared, the other
+    // structures are stale as well and it is up to the user to clear them.
+    if(!rocsparse_check_trm_shared(info, info->csrilu0_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrilu0_info));
+    }
+
+    info->csrilu0_info = nullptr;
+
+    // Re-analyse the compressed pattern
+    return rocsparse_csrilu0_analysis_template(handle,
+                                               m,
+                                               nnz,
+                                               descr,
+                                               csr_val_lu,
+                                               csr_row_ptr_lu,
+                                               csr_col_ind_lu,
+                                               info,
+                                               rocsparse_analysis_policy_force,
+                                               policy,
+                                               temp_buffer);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_compress_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     const rocsparse_mat_descr descr,
+                                                     rocsparse_int             nnz_lu,
+                                                     T*                        csr_val_lu,
+                                                     rocsparse_int*            csr_row_ptr_lu,
+                                                     rocsparse_int*            csr_col_ind_lu,
+                                                     rocsparse_int*            nnz_lu_compressed,
+                                                     rocsparse_mat_info        info,
+                                                     rocsparse_solve_policy    policy,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_compress"),
+              m,
+              (const void*&)descr,
+              nnz_lu,
+              (const void*&)csr_val_lu,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)csr_col_ind_lu,
+              (const void*&)nnz_lu_compressed,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_lu < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check output pointer
+    if(nnz_lu_compressed == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_lu == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(nnz_lu_compressed, 0, sizeof(rocsparse_int), handle->stream));
+        }
+        else
+        {
+            *nnz_lu_compressed = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Temporary copy of LU and the non-zeros per row
+    size_t copy_size = ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256
+                       + ((sizeof(rocsparse_int) * (m + 1) - 1) / 256 + 1) * 256
+                       + ((sizeof(rocsparse_int) * nnz_lu - 1) / 256 + 1) * 256
+                       + ((sizeof(T) * nnz_lu - 1) / 256 + 1) * 256;
+
+    void* copy_buffer = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc(&copy_buffer, copy_size));
+
+    rocsparse_status status = rocsparse_csrilut_compress_dispatch(handle,
+                                                                  m,
+                                                                  descr,
+                                                                  nnz_lu,
+                                                                  csr_val_lu,
+                                                                  csr_row_ptr_lu,
+                                                                  csr_col_ind_lu,
+                                                                  nnz_lu_compressed,
+                                                                  info,
+                                                                  policy,
+                                                                  temp_buffer,
+                                                                  copy_buffer);
+
+    // Release the copy on every path, the compression runs asynchronously
+    hipError_t hip_status  = hipStreamSynchronize(handle->stream);
+    hipError_t free_status = hipFree(copy_buffer);
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    RETURN_IF_HIP_ERROR(hip_status);
+    RETURN_IF_HIP_ERROR(free_status);
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRILUT_HPP
@@ -0,0 +1,88 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_csritilu0.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     size_t*                   buffer_size) \
+    {                                                                       \
+        return rocsparse_csritilu0_buffer_size_template(handle,             \
+                                                        m,                  \
+                                                        nnz,                \
+                                                        descr,              \
+                                                        csr_val,            \
+                                                        csr_row_ptr,        \
+                                                        csr_col_ind,        \
+                                                        buffer_size);       \
+    }
+
+C_IMPL(rocsparse_scsritilu0_buffer_size, float);
+C_IMPL(rocsparse_dcsritilu0_buffer_size, double);
+C_IMPL(rocsparse_ccsritilu0_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsritilu0_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     TYPE*                     csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_int             nsweeps,     \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csritilu0_template(handle,                         \
+                                            m,                              \
+                                            nnz,                            \
+                                            descr,                          \
+                                            csr_val,                        \
+                                            csr_row_ptr,                    \
+                                            csr_col_ind,                    \
+                                            nsweeps,                        \
+                                            temp_buffer);                   \
+    }
+
+C_IMPL(rocsparse_scsritilu0, float);
+C_IMPL(rocsparse_dcsritilu0, double);
+C_IMPL(rocsparse_ccsritilu0, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsritilu0, rocsparse_double_complex);
+
+#undef C_IMPL
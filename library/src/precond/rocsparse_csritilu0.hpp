@@ -0,0 +1,437 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_CSRITILU0_HPP
+#define ROCSPARSE_CSRITILU0_HPP
+
+#include "csritilu0_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__ void csritilu0_diag(rocsparse_int        m,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            const rocsparse_int* csr_col_ind,
+                                                            rocsparse_int*       csr_diag_ind,
+                                                            rocsparse_index_base idx_base)
+{
+    csritilu0_diag_device<BLOCKSIZE>(m, csr_row_ptr, csr_col_ind, csr_diag_ind, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csritilu0_sweep(rocsparse_int        m,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             const T*             csr_val_a,
+                                                             const T*             csr_val_src,
+                                                             T*                   csr_val_dst,
+                                                             const rocsparse_int* csr_diag_ind,
+                                                             rocsparse_index_base idx_base)
+{
+    csritilu0_sweep_device<BLOCKSIZE, WFSIZE>(m,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val_a,
+                                              csr_val_src,
+                                              csr_val_dst,
+                                              csr_diag_ind,
+                                              idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csritic0_sweep(rocsparse_int        m,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            const rocsparse_int* csr_col_ind,
+                                                            const T*             csr_val_a,
+                                                            const T*             csr_val_src,
+                                                            T*                   csr_val_dst,
+                                                            const rocsparse_int* csr_diag_ind,
+                                                            rocsparse_int*       zero_pivot,
+                                                            rocsparse_index_base idx_base)
+{
+    csritic0_sweep_device<BLOCKSIZE, WFSIZE>(m,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             csr_val_a,
+                                             csr_val_src,
+                                             csr_val_dst,
+                                             csr_diag_ind,
+                                             zero_pivot,
+                                             idx_base);
+}
+
+// Temporary storage: diagonal offsets, a copy of A and the second iterate
+template <typename T>
+size_t rocsparse_csritilu0_buffer_size_core(rocsparse_int m, rocsparse_int nnz)
+{
+    size_t size = 256;
+
+    size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256 * 2;
+
+    return size;
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+void rocsparse_csritilu0_launch_sweep(rocsparse_handle     handle,
+                                      bool                 cholesky,
+                                      rocsparse_int        m,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      const T*             csr_val_a,
+                                      const T*             csr_val_src,
+                                      T*                   csr_val_dst,
+                                      const rocsparse_int* csr_diag_ind,
+                                      rocsparse_int*       zero_pivot,
+                                      rocsparse_index_base idx_base)
+{
+    dim3 sweep_blocks((m - 1) / (BLOCKSIZE / WFSIZE) + 1);
+    dim3 sweep_threads(BLOCKSIZE);
+
+    if(cholesky)
+    {
+        hipLaunchKernelGGL((csritic0_sweep<BLOCKSIZE, WFSIZE>),
+                           sweep_blocks,
+                           sweep_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val_a,
+                           csr_val_src,
+                           csr_val_dst,
+                           csr_diag_ind,
+                           zero_pivot,
+                           idx_base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csritilu0_sweep<BLOCKSIZE, WFSIZE>),
+                           sweep_blocks,
+                           sweep_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val_a,
+                           csr_val_src,
+                           csr_val_dst,
+                           csr_diag_ind,
+                           idx_base);
+    }
+}
+
+// Performs nsweeps synchronous fixed-point sweeps, starting from A. Two iterates are
+// ping-ponged between csr_val and the temporary storage, such that the final sweep
+// writes to csr_val. If zero_pivot is given, the final sweep records the first zero
+// pivot of the factorization.
+template <typename T>
+rocsparse_status rocsparse_csritilu0_sweeps(rocsparse_handle          handle,
+                                            bool                      cholesky,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T*                        csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             nsweeps,
+                                            void*                     temp_buffer,
+                                            rocsparse_int*            zero_pivot)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    rocsparse_int* d_diag_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    T* d_val_a = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    T* d_val_tmp = reinterpret_cast<T*>(ptr);
+
+    // Keep a copy of A, both iterates start from A
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(d_val_a, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(d_val_tmp, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+#define CSRITILU0_DIM 256
+    hipLaunchKernelGGL((csritilu0_diag<CSRITILU0_DIM>),
+                       dim3((m - 1) / CSRITILU0_DIM + 1),
+                       dim3(CSRITILU0_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       d_diag_ind,
+                       descr->base);
+
+    const T* src = d_val_a;
+
+    for(rocsparse_int s = 1; s <= nsweeps; ++s)
+    {
+        T* dst = ((nsweeps - s) % 2 == 0) ? csr_val : d_val_tmp;
+
+        // Intermediate iterates may have non-positive diagonals, only the final
+        // iterate is checked for zero pivots
+        rocsparse_int* pivot = (s == nsweeps) ? zero_pivot : nullptr;
+
+        if(handle->wavefront_size == 32)
+        {
+            rocsparse_csritilu0_launch_sweep<CSRITILU0_DIM, 32>(handle,
+                                                                cholesky,
+                                                                m,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                d_val_a,
+                                                                src,
+                                                                dst,
+                                                                d_diag_ind,
+                                                                pivot,
+                                                                descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            rocsparse_csritilu0_launch_sweep<CSRITILU0_DIM, 64>(handle,
+                                                                cholesky,
+                                                                m,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                d_val_a,
+                                                                src,
+                                                                dst,
+                                                                d_diag_ind,
+                                                                pivot,
+                                                                descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        src = dst;
+    }
+#undef CSRITILU0_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0_buffer_size_template(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritilu0_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *buffer_size = rocsparse_csritilu0_buffer_size_core<T>(m, nnz);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              T*                        csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_int             nsweeps,
+                                              void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              nsweeps,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csritilu0 -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--sweeps",
+              nsweeps);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check number of sweeps
+    if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || nsweeps == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csritilu0_sweeps(handle,
+                                      false,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      nsweeps,
+                                      temp_buffer,
+                                      nullptr);
+}
+
+#endif // ROCSPARSE_CSRITILU0_HPP
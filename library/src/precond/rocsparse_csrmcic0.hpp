@@ -0,0 +1,248 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMCIC0_HPP
+#define ROCSPARSE_CSRMCIC0_HPP
+
+#include "csrmcilu0_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <vector>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csrmcic0_kernel(rocsparse_int        color_begin,
+                                                             rocsparse_int        color_end,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             T*                   csr_val,
+                                                             const rocsparse_int* csr_diag_ind,
+                                                             rocsparse_int*       zero_pivot,
+                                                             rocsparse_index_base idx_base)
+{
+    csrmcic0_device<BLOCKSIZE, WFSIZE>(color_begin,
+                                       color_end,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       csr_diag_ind,
+                                       zero_pivot,
+                                       idx_base);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmcic0_dispatch(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             T*                        csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             ncolors,
+                                             const rocsparse_int*      color_ptr,
+                                             rocsparse_mat_info        info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Color offsets are required on the host to launch one kernel per color
+    std::vector<rocsparse_int> hcolor_ptr(ncolors + 1);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcolor_ptr.data(),
+                                       color_ptr,
+                                       sizeof(rocsparse_int) * (ncolors + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+#define CSRMCIC0_DIM 256
+    dim3 csrmcic0_threads(CSRMCIC0_DIM);
+
+    // Process colors in order, all rows of a color are factorized concurrently
+    for(rocsparse_int c = 0; c < ncolors; ++c)
+    {
+        rocsparse_int color_begin = hcolor_ptr[c];
+        rocsparse_int color_end   = hcolor_ptr[c + 1];
+
+        // Skip empty colors
+        if(color_begin == color_end)
+        {
+            continue;
+        }
+
+        rocsparse_int color_size = color_end - color_begin;
+
+        dim3 csrmcic0_blocks((color_size * handle->wavefront_size - 1) / CSRMCIC0_DIM + 1);
+
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrmcic0_kernel<CSRMCIC0_DIM, 32>),
+                               csrmcic0_blocks,
+                               csrmcic0_threads,
+                               0,
+                               stream,
+                               color_begin,
+                               color_end,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               info->csric0_info->trm_diag_ind,
+                               info->zero_pivot,
+                               descr->base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrmcic0_kernel<CSRMCIC0_DIM, 64>),
+                               csrmcic0_blocks,
+                               csrmcic0_threads,
+                               0,
+                               stream,
+                               color_begin,
+                               color_end,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               info->csric0_info->trm_diag_ind,
+                               info->zero_pivot,
+                               descr->base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRMCIC0_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmcic0_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             T*                        csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             ncolors,
+                                             const rocsparse_int*      color_ptr,
+                                             rocsparse_mat_info        info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmcic0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              ncolors,
+              (const void*&)color_ptr,
+              (const void*&)info);
+
+    log_bench(handle, "./rocsparse-bench -f csrmcic0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ncolors < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Every row carries a color
+    if(ncolors == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(color_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csric0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrmcic0_dispatch(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, ncolors, color_ptr, info);
+}
+
+#endif // ROCSPARSE_CSRMCIC0_HPP
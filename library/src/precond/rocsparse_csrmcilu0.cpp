@@ -0,0 +1,62 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrmcilu0.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE, REAL)                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     TYPE*                     csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_int             ncolors,     \
+                                     const rocsparse_int*      color_ptr,   \
+                                     rocsparse_mat_info        info)        \
+    {                                                                       \
+        return rocsparse_csrmcilu0_template<TYPE, REAL>(handle,             \
+                                                        m,                  \
+                                                        nnz,                \
+                                                        descr,              \
+                                                        csr_val,            \
+                                                        csr_row_ptr,        \
+                                                        csr_col_ind,        \
+                                                        ncolors,            \
+                                                        color_ptr,          \
+                                                        info);              \
+    }
+
+C_IMPL(rocsparse_scsrmcilu0, float, float);
+C_IMPL(rocsparse_dcsrmcilu0, double, double);
+C_IMPL(rocsparse_ccsrmcilu0, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrmcilu0, rocsparse_double_complex, double);
+
+#undef C_IMPL
@@ -0,0 +1,438 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gpsv_strided_batch.hpp"
+
+#include "gpsv_strided_batch_device.h"
+#include "gtsv_interleaved_batch_device.h"
+
+#define GPSV_STRIDED_BATCH_DIM 128
+#define GPSV_TRANSPOSE_DIM_X 32
+#define GPSV_TRANSPOSE_DIM_Y 8
+
+#define LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, block_size)                \
+    hipLaunchKernelGGL((gpsv_strided_batch_pcr_shared_kernel<block_size>), \
+                       dim3(batch_count),                                  \
+                       dim3(block_size),                                   \
+                       0,                                                  \
+                       handle->stream,                                     \
+                       m,                                                  \
+                       batch_count,                                        \
+                       batch_stride,                                       \
+                       ds,                                                 \
+                       dl,                                                 \
+                       d,                                                  \
+                       du,                                                 \
+                       dw,                                                 \
+                       x);
+
+#define LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(src, dst)                                      \
+    hipLaunchKernelGGL(                                                                   \
+        (gtsv_strided_to_interleaved_kernel<GPSV_TRANSPOSE_DIM_X, GPSV_TRANSPOSE_DIM_Y>), \
+        transpose_blocks,                                                                 \
+        transpose_threads,                                                                \
+        0,                                                                                \
+        handle->stream,                                                                   \
+        m,                                                                                \
+        batch_count,                                                                      \
+        batch_stride,                                                                     \
+        src,                                                                              \
+        dst);
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_strided_batch_buffer_size_template(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const T*         ds,
+                                                                   const T*         dl,
+                                                                   const T*         d,
+                                                                   const T*         du,
+                                                                   const T*         dw,
+                                                                   const T*         x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgpsv_strided_batch_buffer_size"),
+              m,
+              (const void*&)ds,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)dw,
+              (const void*&)x,
+              batch_count,
+              batch_stride,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m <= 2 || batch_count < 0 || batch_stride < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(ds == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dw == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(m <= 512)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+    }
+    else
+    {
+        // Interleaved copies of the five diagonals and the right-hand side
+        size_t size = sizeof(T) * ((size_t(m) * batch_count - 1) / 256 + 1) * 256;
+
+        *buffer_size = 0;
+
+        *buffer_size += size; // ds
+        *buffer_size += size; // dl
+        *buffer_size += size; // d
+        *buffer_size += size; // du
+        *buffer_size += size; // dw
+        *buffer_size += size; // x
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_strided_batch_small_template(rocsparse_handle handle,
+                                                             rocsparse_int    m,
+                                                             const T*         ds,
+                                                             const T*         dl,
+                                                             const T*         d,
+                                                             const T*         du,
+                                                             const T*         dw,
+                                                             T*               x,
+                                                             rocsparse_int    batch_count,
+                                                             rocsparse_int    batch_stride,
+                                                             void*            temp_buffer)
+{
+    assert(m <= 512);
+
+    // Each thread processes a 2 x 2 block of the system
+    rocsparse_int n = (m + 1) / 2;
+
+    if(n <= 2)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 2);
+    }
+    else if(n <= 4)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 4);
+    }
+    else if(n <= 8)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 8);
+    }
+    else if(n <= 16)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 16);
+    }
+    else if(n <= 32)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 32);
+    }
+    else if(n <= 64)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 64);
+    }
+    else if(n <= 128)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 128);
+    }
+    else if(n <= 256)
+    {
+        LAUNCH_GPSV_STRIDED_BATCH_PCR_SHARED(T, 256);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_strided_batch_large_template(rocsparse_handle handle,
+                                                             rocsparse_int    m,
+                                                             const T*         ds,
+                                                             const T*         dl,
+                                                             const T*         d,
+                                                             const T*         du,
+                                                             const T*         dw,
+                                                             T*               x,
+                                                             rocsparse_int    batch_count,
+                                                             rocsparse_int    batch_stride,
+                                                             void*            temp_buffer)
+{
+    assert(m > 512);
+
+    size_t size = sizeof(T) * ((size_t(m) * batch_count - 1) / 256 + 1) * 256;
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    T*    tds = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* tdl = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* td = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* tdu = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* tdw = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* tx = reinterpret_cast<T*>(ptr);
+
+    // Systems that do not fit into shared memory are transposed into interleaved layout
+    // and solved by a single thread each
+    dim3 transpose_blocks((batch_count - 1) / GPSV_TRANSPOSE_DIM_X + 1,
+                          (m - 1) / GPSV_TRANSPOSE_DIM_X + 1);
+    dim3 transpose_threads(GPSV_TRANSPOSE_DIM_X, GPSV_TRANSPOSE_DIM_Y);
+
+    LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(ds, tds);
+    LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(dl, tdl);
+    LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(d, td);
+    LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(du, tdu);
+    LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(dw, tdw);
+    LAUNCH_GPSV_STRIDED_TO_INTERLEAVED(x, tx);
+
+    hipLaunchKernelGGL((gpsv_interleaved_batch_qr_kernel<GPSV_STRIDED_BATCH_DIM>),
+                       dim3((batch_count - 1) / GPSV_STRIDED_BATCH_DIM + 1),
+                       dim3(GPSV_STRIDED_BATCH_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       batch_count,
+                       batch_count,
+                       tds,
+                       tdl,
+                       td,
+                       tdu,
+                       tdw,
+                       tx);
+
+    // Transpose the solution back into strided layout
+    hipLaunchKernelGGL(
+        (gtsv_interleaved_to_strided_kernel<GPSV_TRANSPOSE_DIM_X, GPSV_TRANSPOSE_DIM_Y>),
+        transpose_blocks,
+        transpose_threads,
+        0,
+        handle->stream,
+        m,
+        batch_count,
+        batch_stride,
+        tx,
+        x);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_strided_batch_template(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const T*         ds,
+                                                       const T*         dl,
+                                                       const T*         d,
+                                                       const T*         du,
+                                                       const T*         dw,
+                                                       T*               x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgpsv_strided_batch"),
+              m,
+              (const void*&)ds,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)dw,
+              (const void*&)x,
+              batch_count,
+              batch_stride,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f gpsv_strided_batch -r",
+              replaceX<T>("X"),
+              "-m",
+              m,
+              "--batch_count",
+              batch_count);
+
+    // Check sizes
+    if(m <= 2 || batch_count < 0 || batch_stride < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(ds == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dw == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // If m is small we can solve the systems entirely in shared memory
+    if(m <= 512)
+    {
+        return rocsparse_gpsv_strided_batch_small_template(
+            handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+    }
+
+    return rocsparse_gpsv_strided_batch_large_template(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                         \
+                                     rocsparse_int    m,                              \
+                                     const TYPE*      ds,                             \
+                                     const TYPE*      dl,                             \
+                                     const TYPE*      d,                              \
+                                     const TYPE*      du,                             \
+                                     const TYPE*      dw,                             \
+                                     const TYPE*      x,                              \
+                                     rocsparse_int    batch_count,                    \
+                                     rocsparse_int    batch_stride,                   \
+                                     size_t*          buffer_size)                    \
+    {                                                                                 \
+        return rocsparse_gpsv_strided_batch_buffer_size_template(                     \
+            handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size); \
+    }
+
+C_IMPL(rocsparse_sgpsv_strided_batch_buffer_size, float);
+C_IMPL(rocsparse_dgpsv_strided_batch_buffer_size, double);
+C_IMPL(rocsparse_cgpsv_strided_batch_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zgpsv_strided_batch_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                         \
+                                     rocsparse_int    m,                              \
+                                     const TYPE*      ds,                             \
+                                     const TYPE*      dl,                             \
+                                     const TYPE*      d,                              \
+                                     const TYPE*      du,                             \
+                                     const TYPE*      dw,                             \
+                                     TYPE*            x,                              \
+                                     rocsparse_int    batch_count,                    \
+                                     rocsparse_int    batch_stride,                   \
+                                     void*            temp_buffer)                    \
+    {                                                                                 \
+        return rocsparse_gpsv_strided_batch_template(                                 \
+            handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer); \
+    }
+
+C_IMPL(rocsparse_sgpsv_strided_batch, float);
+C_IMPL(rocsparse_dgpsv_strided_batch, double);
+C_IMPL(rocsparse_cgpsv_strided_batch, rocsparse_float_complex);
+C_IMPL(rocsparse_zgpsv_strided_batch, rocsparse_double_complex);
+
+#undef C_IMPL
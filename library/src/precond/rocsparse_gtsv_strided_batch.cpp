@@ -0,0 +1,296 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gtsv_strided_batch.hpp"
+
+#include "gtsv_interleaved_batch_device.h"
+
+#define GTSV_STRIDED_BATCH_DIM 128
+#define GTSV_TRANSPOSE_DIM_X 32
+#define GTSV_TRANSPOSE_DIM_Y 8
+
+#define LAUNCH_GTSV_STRIDED_TO_INTERLEAVED(src, dst)                                      \
+    hipLaunchKernelGGL(                                                                   \
+        (gtsv_strided_to_interleaved_kernel<GTSV_TRANSPOSE_DIM_X, GTSV_TRANSPOSE_DIM_Y>), \
+        transpose_blocks,                                                                 \
+        transpose_threads,                                                                \
+        0,                                                                                \
+        handle->stream,                                                                   \
+        m,                                                                                \
+        batch_count,                                                                      \
+        batch_stride,                                                                     \
+        src,                                                                              \
+        dst);
+
+template <typename T>
+rocsparse_status rocsparse_gtsv_strided_batch_buffer_size_template(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const T*         dl,
+                                                                   const T*         d,
+                                                                   const T*         du,
+                                                                   const T*         x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgtsv_strided_batch_buffer_size"),
+              m,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)x,
+              batch_count,
+              batch_stride,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m <= 1 || batch_count < 0 || batch_stride < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Interleaved copies of the three diagonals and the right-hand side
+    size_t size = sizeof(T) * ((size_t(m) * batch_count - 1) / 256 + 1) * 256;
+
+    *buffer_size = 0;
+
+    *buffer_size += size; // dl
+    *buffer_size += size; // d
+    *buffer_size += size; // du
+    *buffer_size += size; // x
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gtsv_strided_batch_template(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const T*         dl,
+                                                       const T*         d,
+                                                       const T*         du,
+                                                       T*               x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgtsv_strided_batch"),
+              m,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)x,
+              batch_count,
+              batch_stride,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f gtsv_strided_batch -r",
+              replaceX<T>("X"),
+              "-m",
+              m,
+              "--batch_count",
+              batch_count);
+
+    // Check sizes
+    if(m <= 1 || batch_count < 0 || batch_stride < m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    size_t size = sizeof(T) * ((size_t(m) * batch_count - 1) / 256 + 1) * 256;
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    T*    tdl = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* td = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* tdu = reinterpret_cast<T*>(ptr);
+    ptr += size;
+    T* tx = reinterpret_cast<T*>(ptr);
+
+    // Transpose the systems into interleaved layout, such that each thread can solve its
+    // system sequentially with partial pivoting while all memory accesses are coalesced
+    dim3 transpose_blocks((batch_count - 1) / GTSV_TRANSPOSE_DIM_X + 1,
+                          (m - 1) / GTSV_TRANSPOSE_DIM_X + 1);
+    dim3 transpose_threads(GTSV_TRANSPOSE_DIM_X, GTSV_TRANSPOSE_DIM_Y);
+
+    LAUNCH_GTSV_STRIDED_TO_INTERLEAVED(dl, tdl);
+    LAUNCH_GTSV_STRIDED_TO_INTERLEAVED(d, td);
+    LAUNCH_GTSV_STRIDED_TO_INTERLEAVED(du, tdu);
+    LAUNCH_GTSV_STRIDED_TO_INTERLEAVED(x, tx);
+
+    // LU factorization with partial pivoting and solve
+    hipLaunchKernelGGL((gtsv_interleaved_batch_lu_kernel<GTSV_STRIDED_BATCH_DIM>),
+                       dim3((batch_count - 1) / GTSV_STRIDED_BATCH_DIM + 1),
+                       dim3(GTSV_STRIDED_BATCH_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       batch_count,
+                       batch_count,
+                       tdl,
+                       td,
+                       tdu,
+                       tx);
+
+    // Transpose the solution back into strided layout
+    hipLaunchKernelGGL(
+        (gtsv_interleaved_to_strided_kernel<GTSV_TRANSPOSE_DIM_X, GTSV_TRANSPOSE_DIM_Y>),
+        transpose_blocks,
+        transpose_threads,
+        0,
+        handle->stream,
+        m,
+        batch_count,
+        batch_stride,
+        tx,
+        x);
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                 \
+                                     rocsparse_int    m,                      \
+                                     const TYPE*      dl,                     \
+                                     const TYPE*      d,                      \
+                                     const TYPE*      du,                     \
+                                     const TYPE*      x,                      \
+                                     rocsparse_int    batch_count,            \
+                                     rocsparse_int    batch_stride,           \
+                                     size_t*          buffer_size)            \
+    {                                                                         \
+        return rocsparse_gtsv_strided_batch_buffer_size_template(             \
+            handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size); \
+    }
+
+C_IMPL(rocsparse_sgtsv_strided_batch_buffer_size, float);
+C_IMPL(rocsparse_dgtsv_strided_batch_buffer_size, double);
+C_IMPL(rocsparse_cgtsv_strided_batch_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zgtsv_strided_batch_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                 \
+                                     rocsparse_int    m,                      \
+                                     const TYPE*      dl,                     \
+                                     const TYPE*      d,                      \
+                                     const TYPE*      du,                     \
+                                     TYPE*            x,                      \
+                                     rocsparse_int    batch_count,            \
+                                     rocsparse_int    batch_stride,           \
+                                     void*            temp_buffer)            \
+    {                                                                         \
+        return rocsparse_gtsv_strided_batch_template(                         \
+            handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer); \
+    }
+
+C_IMPL(rocsparse_sgtsv_strided_batch, float);
+C_IMPL(rocsparse_dgtsv_strided_batch, double);
+C_IMPL(rocsparse_cgtsv_strided_batch, rocsparse_float_complex);
+C_IMPL(rocsparse_zgtsv_strided_batch, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -237,3 +237,373 @@ __launch_bounds__(BLOCKSIZE) __global__ void csrcolor_kernel_jpl(J m,
         colors[row] = color + 1;
     }
 }
+
+//
+// Compares the weight of row against the weight of an uncolored vertex nb
+//
+template <typename J>
+static __device__ __forceinline__ void csrcolor_jpl_compare(
+    J row, uint32_t row_hash, J nb, J color, const J* __restrict__ colors, bool& min, bool& max)
+{
+    //
+    // Skip diagonal
+    //
+    if(nb == row)
+    {
+        return;
+    }
+
+    //
+    // Skip already colored vertices
+    //
+    J color_nb = colors[nb];
+    if(color_nb != -1 && color_nb != color && color_nb != (color + 1))
+    {
+        return;
+    }
+
+    uint32_t nb_hash = murmur3_32(nb);
+
+    if(row_hash <= nb_hash)
+    {
+        max = false;
+    }
+
+    if(row_hash >= nb_hash)
+    {
+        min = false;
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I = rocsparse_int, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_jpl_distance2(J m,
+                                       J color,
+                                       const I* __restrict__ csr_row_ptr,
+                                       const J* __restrict__ csr_col_ind,
+                                       rocsparse_index_base csr_base,
+                                       J* __restrict__ colors)
+{
+    //
+    // Each thread processes a vertex
+    //
+    J row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    //
+    // Do not run out of bounds
+    //
+    if(row >= m)
+    {
+        return;
+    }
+
+    //
+    // Do not process already colored vertices
+    //
+    if(colors[row] != -1)
+    {
+        return;
+    }
+
+    //
+    // Assume current vertex is maximum and minimum
+    //
+    bool min = true, max = true;
+
+    //
+    // Get row weight
+    //
+    uint32_t row_hash = murmur3_32(row);
+
+    //
+    // Look at neighbors and neighbors of neighbors to check their random number
+    //
+    const I bound = csr_row_ptr[row + 1] - csr_base;
+    for(I j = csr_row_ptr[row] - csr_base; j < bound; ++j)
+    {
+        J col = csr_col_ind[j] - csr_base;
+
+        if(col == row)
+        {
+            continue;
+        }
+
+        csrcolor_jpl_compare(row, row_hash, col, color, colors, min, max);
+
+        const I col_bound = csr_row_ptr[col + 1] - csr_base;
+        for(I k = csr_row_ptr[col] - csr_base; k < col_bound; ++k)
+        {
+            csrcolor_jpl_compare(
+                row, row_hash, csr_col_ind[k] - csr_base, color, colors, min, max);
+        }
+    }
+
+    //
+    // If vertex is a maximum or a minimum then color it.
+    //
+    if(max)
+    {
+        colors[row] = color;
+    }
+    else if(min)
+    {
+        colors[row] = color + 1;
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_histogram(J size,
+                                   const J* __restrict__ colors,
+                                   J* __restrict__ counts)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    //
+    // Uncolored vertices are not counted
+    //
+    J color = colors[gid];
+    if(color >= 0)
+    {
+        atomicAdd(&counts[color], static_cast<J>(1));
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_used_colors(J size, const J* __restrict__ counts, J* __restrict__ used)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    used[gid] = (counts[gid] > 0) ? 1 : 0;
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_relabel(J size, const J* __restrict__ labels, J* __restrict__ colors)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    //
+    // labels holds the inclusive sum of the used colors
+    //
+    J color = colors[gid];
+    if(color >= 0)
+    {
+        colors[gid] = labels[color] - 1;
+    }
+}
+
+//
+// Returns true if a vertex within distance 1 (or 2) of row has the given color
+//
+template <bool DISTANCE2, typename I, typename J>
+static __device__ __forceinline__ bool csrcolor_color_conflict(J row,
+                                                               J color,
+                                                               const I* __restrict__ csr_row_ptr,
+                                                               const J* __restrict__ csr_col_ind,
+                                                               rocsparse_index_base csr_base,
+                                                               const J* __restrict__ colors)
+{
+    const I bound = csr_row_ptr[row + 1] - csr_base;
+    for(I j = csr_row_ptr[row] - csr_base; j < bound; ++j)
+    {
+        J col = csr_col_ind[j] - csr_base;
+
+        if(col == row)
+        {
+            continue;
+        }
+
+        if(colors[col] == color)
+        {
+            return true;
+        }
+
+        if(DISTANCE2)
+        {
+            const I col_bound = csr_row_ptr[col + 1] - csr_base;
+            for(I k = csr_row_ptr[col] - csr_base; k < col_bound; ++k)
+            {
+                J nb = csr_col_ind[k] - csr_base;
+                if(nb != row && colors[nb] == color)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+//
+// Returns true if a vertex within distance 1 (or 2) of row proposes the same color
+// and has a larger weight
+//
+template <bool DISTANCE2, typename I, typename J>
+static __device__ __forceinline__ bool csrcolor_proposal_conflict(J row,
+                                                                  J proposal,
+                                                                  const I* __restrict__ csr_row_ptr,
+                                                                  const J* __restrict__ csr_col_ind,
+                                                                  rocsparse_index_base csr_base,
+                                                                  const J* __restrict__ proposals)
+{
+    uint32_t row_hash = murmur3_32(row);
+
+    const I bound = csr_row_ptr[row + 1] - csr_base;
+    for(I j = csr_row_ptr[row] - csr_base; j < bound; ++j)
+    {
+        J col = csr_col_ind[j] - csr_base;
+
+        if(col == row)
+        {
+            continue;
+        }
+
+        if(proposals[col] == proposal && murmur3_32(col) > row_hash)
+        {
+            return true;
+        }
+
+        if(DISTANCE2)
+        {
+            const I col_bound = csr_row_ptr[col + 1] - csr_base;
+            for(I k = csr_row_ptr[col] - csr_base; k < col_bound; ++k)
+            {
+                J nb = csr_col_ind[k] - csr_base;
+                if(nb != row && proposals[nb] == proposal && murmur3_32(nb) > row_hash)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+template <unsigned int BLOCKSIZE, bool DISTANCE2, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_balance_propose(J m,
+                                         J ncolors,
+                                         J target,
+                                         const I* __restrict__ csr_row_ptr,
+                                         const J* __restrict__ csr_col_ind,
+                                         rocsparse_index_base csr_base,
+                                         const J* __restrict__ colors,
+                                         const J* __restrict__ counts,
+                                         J* __restrict__ proposals)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    J proposal = -1;
+
+    //
+    // Only vertices of colors that exceed the target size are moved
+    //
+    J color = colors[row];
+    if(color >= 0 && counts[color] > target)
+    {
+        //
+        // Start the search at a pseudo random color to spread the moves
+        //
+        J start = murmur3_32(row) % ncolors;
+
+        for(J i = 0; i < ncolors; ++i)
+        {
+            J candidate = start + i;
+            candidate -= (candidate >= ncolors) ? ncolors : 0;
+
+            if(candidate == color || counts[candidate] >= target)
+            {
+                continue;
+            }
+
+            if(!csrcolor_color_conflict<DISTANCE2>(
+                   row, candidate, csr_row_ptr, csr_col_ind, csr_base, colors))
+            {
+                proposal = candidate;
+                break;
+            }
+        }
+    }
+
+    proposals[row] = proposal;
+}
+
+template <unsigned int BLOCKSIZE, bool DISTANCE2, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_kernel_balance_commit(J m,
+                                        J target,
+                                        const I* __restrict__ csr_row_ptr,
+                                        const J* __restrict__ csr_col_ind,
+                                        rocsparse_index_base csr_base,
+                                        const J* __restrict__ proposals,
+                                        J* __restrict__ colors,
+                                        J* __restrict__ counts,
+                                        J* __restrict__ nmoved)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    J proposal = proposals[row];
+    if(proposal < 0)
+    {
+        return;
+    }
+
+    //
+    // Vertices within the coloring distance that propose the same color are resolved
+    // by their weight, such that the coloring remains valid
+    //
+    if(csrcolor_proposal_conflict<DISTANCE2>(
+           row, proposal, csr_row_ptr, csr_col_ind, csr_base, proposals))
+    {
+        return;
+    }
+
+    //
+    // Neither drop the old color below nor raise the new color above the target size
+    //
+    J color = colors[row];
+    if(atomicSub(&counts[color], static_cast<J>(1)) <= target)
+    {
+        atomicAdd(&counts[color], static_cast<J>(1));
+        return;
+    }
+
+    if(atomicAdd(&counts[proposal], static_cast<J>(1)) >= target)
+    {
+        atomicSub(&counts[proposal], static_cast<J>(1));
+        atomicAdd(&counts[color], static_cast<J>(1));
+        return;
+    }
+
+    colors[row] = proposal;
+    atomicAdd(nmoved, static_cast<J>(1));
+}
@@ -0,0 +1,172 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#include "common.h"
+
+// Count the number of rows of each color, color_ptr[c + 1] holds the size of color c
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_permute_count_kernel(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ coloring,
+                                       rocsparse_int* __restrict__ color_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    atomicAdd(&color_ptr[coloring[gid] + 1], 1);
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_identity_kernel(rocsparse_int m, rocsparse_int* __restrict__ identity)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    identity[gid] = gid;
+}
+
+// Compute the inverse permutation, iperm[perm[i]] = i
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_inverse_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ perm,
+                                   rocsparse_int* __restrict__ iperm)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    iperm[perm[gid]] = gid;
+}
+
+// Number of entries of each permuted row, stored shifted by one for the subsequent scan
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_row_nnz_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ perm,
+                                   rocsparse_int* __restrict__ csr_row_ptr_perm)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        csr_row_ptr_perm[0] = 0;
+    }
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row = perm[gid];
+
+    csr_row_ptr_perm[gid + 1] = csr_row_ptr[row + 1] - csr_row_ptr[row];
+}
+
+// Copy each row to its new position and relabel its column indices. The permuted
+// row pointer is expected to be zero based. Each wavefront processes a single row.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_scatter_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   const rocsparse_int* __restrict__ perm,
+                                   const rocsparse_int* __restrict__ iperm,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_perm,
+                                   rocsparse_int* __restrict__ csr_col_ind_perm,
+                                   rocsparse_int* __restrict__ csr_nnz_perm,
+                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_old   = perm[row];
+    rocsparse_int row_begin = csr_row_ptr[row_old] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row_old + 1] - idx_base;
+    rocsparse_int shift     = csr_row_ptr_perm[row] - row_begin;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        csr_col_ind_perm[j + shift] = iperm[csr_col_ind[j] - idx_base];
+        csr_nnz_perm[j + shift]     = j;
+    }
+}
+
+// Gather the values according to the sorted entry positions and shift the column
+// indices to the index base of the matrix
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_gather_kernel(rocsparse_int nnz,
+                                  const rocsparse_int* __restrict__ csr_nnz_perm,
+                                  const T* __restrict__ csr_val,
+                                  T* __restrict__ csr_val_perm,
+                                  rocsparse_int* __restrict__ csr_col_ind_perm,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csr_val_perm[gid] = csr_val[csr_nnz_perm[gid]];
+    csr_col_ind_perm[gid] += idx_base;
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_shift_row_ptr_kernel(rocsparse_int m,
+                                         rocsparse_int* __restrict__ csr_row_ptr_perm,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid > m)
+    {
+        return;
+    }
+
+    csr_row_ptr_perm[gid] += idx_base;
+}
@@ -0,0 +1,248 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRRCM_DEVICE_HPP
+#define CSRRCM_DEVICE_HPP
+
+#include "common.h"
+
+// Number of off-diagonal entries of each row. Rows without off-diagonal entries
+// are flagged as isolated, all other rows are reset to unvisited.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_degree_kernel(rocsparse_int m,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              rocsparse_int* __restrict__ degree,
+                              rocsparse_int* __restrict__ mark,
+                              rocsparse_int* __restrict__ parent,
+                              rocsparse_int* __restrict__ isolated,
+                              rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    rocsparse_int deg       = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        deg += (csr_col_ind[j] - idx_base != row);
+    }
+
+    degree[row]   = deg;
+    mark[row]     = 0;
+    parent[row]   = std::numeric_limits<rocsparse_int>::max();
+    isolated[row] = (deg == 0);
+}
+
+// Key of each node that has not been ordered yet, such that the minimum key
+// identifies the unordered node of minimum degree
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_start_key_kernel(rocsparse_int m,
+                                 rocsparse_int nbits,
+                                 const rocsparse_int* __restrict__ degree,
+                                 const rocsparse_int* __restrict__ mark,
+                                 uint64_t* __restrict__ keys)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    keys[gid] = (mark[gid] == -1) ? std::numeric_limits<uint64_t>::max()
+                                  : ((uint64_t)degree[gid] << nbits) | gid;
+}
+
+// Key of each node of a list, the minimum key identifies the node of minimum degree
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_level_key_kernel(rocsparse_int n,
+                                 rocsparse_int nbits,
+                                 const rocsparse_int* __restrict__ nodes,
+                                 const rocsparse_int* __restrict__ degree,
+                                 uint64_t* __restrict__ keys)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    rocsparse_int node = nodes[gid];
+
+    keys[gid] = ((uint64_t)degree[node] << nbits) | node;
+}
+
+// Place the node encoded in the key at the front of the queue
+__global__ void csrrcm_root_kernel(rocsparse_int   nbits,
+                                   rocsparse_int   stamp,
+                                   const uint64_t* key,
+                                   rocsparse_int*  queue,
+                                   rocsparse_int*  mark)
+{
+    rocsparse_int root = (rocsparse_int)(*key & ((1ULL << nbits) - 1));
+
+    queue[0]   = root;
+    mark[root] = stamp;
+}
+
+// Expand one BFS level. Each wavefront processes a node of the current level and
+// claims its unvisited neighbours. A neighbour is attached to the node of lowest
+// queue position that reaches it and appended once to the candidate list.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_expand_kernel(rocsparse_int level_begin,
+                              rocsparse_int level_end,
+                              rocsparse_int stamp,
+                              const rocsparse_int* __restrict__ queue,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const rocsparse_int* __restrict__ mark,
+                              rocsparse_int* __restrict__ parent,
+                              rocsparse_int* __restrict__ candidates,
+                              rocsparse_int* __restrict__ ncandidates,
+                              rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int pos = level_begin + hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    if(pos >= level_end)
+    {
+        return;
+    }
+
+    rocsparse_int row       = queue[pos];
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Skip nodes that have been visited by this search or that have been ordered
+        if(mark[col] == stamp || mark[col] == -1)
+        {
+            continue;
+        }
+
+        if(atomicMin(&parent[col], pos) == std::numeric_limits<rocsparse_int>::max())
+        {
+            candidates[atomicAdd(ncandidates, 1)] = col;
+        }
+    }
+}
+
+// Sort key of each candidate, ordering by parent position first and by degree second
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_parent_key_kernel(rocsparse_int n,
+                                  rocsparse_int nbits,
+                                  const rocsparse_int* __restrict__ candidates,
+                                  const rocsparse_int* __restrict__ parent,
+                                  const rocsparse_int* __restrict__ degree,
+                                  uint64_t* __restrict__ keys)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    rocsparse_int node = candidates[gid];
+
+    keys[gid] = ((uint64_t)parent[node] << nbits) | degree[node];
+}
+
+// Mark the nodes of a new level as visited and release their parent slot
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_visit_kernel(rocsparse_int n,
+                             rocsparse_int stamp,
+                             const rocsparse_int* __restrict__ nodes,
+                             rocsparse_int* __restrict__ mark,
+                             rocsparse_int* __restrict__ parent)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    rocsparse_int node = nodes[gid];
+
+    mark[node]   = stamp;
+    parent[node] = std::numeric_limits<rocsparse_int>::max();
+}
+
+// Mark the nodes of a list as ordered
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_finish_kernel(rocsparse_int n,
+                              const rocsparse_int* __restrict__ nodes,
+                              rocsparse_int* __restrict__ mark)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    mark[nodes[gid]] = -1;
+}
+
+// Reverse the Cuthill-McKee ordering in place
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_reverse_kernel(rocsparse_int m, rocsparse_int* __restrict__ perm)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m / 2)
+    {
+        return;
+    }
+
+    rocsparse_int tmp = perm[gid];
+
+    perm[gid]         = perm[m - 1 - gid];
+    perm[m - 1 - gid] = tmp;
+}
+
+#endif // CSRRCM_DEVICE_HPP
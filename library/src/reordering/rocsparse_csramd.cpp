@@ -0,0 +1,309 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+
+// Approximate minimum degree ordering on the quotient graph of the symmetrized pattern.
+// Eliminated nodes become elements, the elements adjacent to a pivot are absorbed by
+// the pivot and the external degree of the nodes of the new element is approximated
+// by the bound of Amestoy, Davis and Duff.
+static void rocsparse_csramd_host(rocsparse_int                     m,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  rocsparse_index_base              idx_base,
+                                  std::vector<rocsparse_int>&       perm)
+{
+    // Off-diagonal pattern of A + A^T
+    std::vector<std::vector<rocsparse_int>> var_adj(m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - idx_base; j < csr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(col != i)
+            {
+                var_adj[i].push_back(col);
+                var_adj[col].push_back(i);
+            }
+        }
+    }
+
+    // Adjacent elements of each node and nodes of each element
+    std::vector<std::vector<rocsparse_int>> elem_adj(m);
+    std::vector<std::vector<rocsparse_int>> elem_vars(m);
+
+    // 0 - variable, 1 - element, 2 - absorbed element
+    std::vector<int> status(m, 0);
+
+    std::vector<rocsparse_int> degree(m);
+    std::vector<rocsparse_int> mark(m, -1);
+    std::vector<rocsparse_int> ext(m, -1);
+
+    // Minimum degree first, ties broken by the smaller index
+    typedef std::pair<rocsparse_int, rocsparse_int> entry;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> heap;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        std::sort(var_adj[i].begin(), var_adj[i].end());
+        var_adj[i].erase(std::unique(var_adj[i].begin(), var_adj[i].end()), var_adj[i].end());
+
+        degree[i] = var_adj[i].size();
+        heap.push(entry(degree[i], i));
+    }
+
+    std::vector<rocsparse_int> touched;
+
+    for(rocsparse_int k = 0; k < m; ++k)
+    {
+        // Pivot of minimum approximate degree, skip outdated heap entries
+        rocsparse_int p;
+
+        while(true)
+        {
+            entry top = heap.top();
+            heap.pop();
+
+            p = top.second;
+
+            if(status[p] == 0 && degree[p] == top.first)
+            {
+                break;
+            }
+        }
+
+        perm[k]   = p;
+        status[p] = 1;
+        mark[p]   = k;
+
+        // Nodes of the new element, the union of the variable neighbours of the
+        // pivot and the nodes of all elements absorbed by the pivot
+        std::vector<rocsparse_int> lp;
+
+        for(rocsparse_int j : var_adj[p])
+        {
+            if(status[j] == 0 && mark[j] != k)
+            {
+                mark[j] = k;
+                lp.push_back(j);
+            }
+        }
+
+        for(rocsparse_int e : elem_adj[p])
+        {
+            if(status[e] != 1)
+            {
+                continue;
+            }
+
+            for(rocsparse_int j : elem_vars[e])
+            {
+                if(status[j] == 0 && mark[j] != k)
+                {
+                    mark[j] = k;
+                    lp.push_back(j);
+                }
+            }
+
+            status[e] = 2;
+            std::vector<rocsparse_int>().swap(elem_vars[e]);
+        }
+
+        std::vector<rocsparse_int>().swap(var_adj[p]);
+        std::vector<rocsparse_int>().swap(elem_adj[p]);
+
+        // |Le \ Lp| for all elements adjacent to the new element
+        for(rocsparse_int i : lp)
+        {
+            for(rocsparse_int e : elem_adj[i])
+            {
+                if(status[e] != 1)
+                {
+                    continue;
+                }
+
+                if(ext[e] < 0)
+                {
+                    ext[e] = elem_vars[e].size();
+                    touched.push_back(e);
+                }
+
+                --ext[e];
+            }
+        }
+
+        rocsparse_int nleft = m - k - 1;
+        rocsparse_int nlp   = lp.size();
+
+        for(rocsparse_int i : lp)
+        {
+            // Drop absorbed elements and attach the new element
+            std::vector<rocsparse_int>& ei = elem_adj[i];
+
+            rocsparse_int sum = 0;
+            rocsparse_int ne  = 0;
+
+            for(rocsparse_int e : ei)
+            {
+                if(status[e] == 1)
+                {
+                    ei[ne++] = e;
+                    sum += ext[e];
+                }
+            }
+
+            ei.resize(ne);
+            ei.push_back(p);
+
+            // Drop variable neighbours that are covered by the new element
+            std::vector<rocsparse_int>& ai = var_adj[i];
+
+            rocsparse_int na = 0;
+
+            for(rocsparse_int j : ai)
+            {
+                if(status[j] == 0 && mark[j] != k)
+                {
+                    ai[na++] = j;
+                }
+            }
+
+            ai.resize(na);
+
+            // Approximate external degree
+            rocsparse_int d = std::min(nleft - 1, degree[i] + nlp - 1);
+            d               = std::min(d, na + nlp - 1 + sum);
+
+            degree[i] = std::max(d, 0);
+            heap.push(entry(degree[i], i));
+        }
+
+        for(rocsparse_int e : touched)
+        {
+            ext[e] = -1;
+        }
+
+        touched.clear();
+
+        elem_vars[p].swap(lp);
+    }
+}
+
+extern "C" rocsparse_status rocsparse_csramd(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int*            perm)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csramd",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The elimination is inherently sequential, the pattern is processed on the host
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+    std::vector<rocsparse_int> hcsr_col_ind(nnz);
+    std::vector<rocsparse_int> hperm(m);
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(hcsr_row_ptr.data(),
+                                  csr_row_ptr,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+
+    if(nnz > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(hcsr_col_ind.data(),
+                                      csr_col_ind,
+                                      sizeof(rocsparse_int) * nnz,
+                                      hipMemcpyDeviceToHost));
+    }
+
+    rocsparse_csramd_host(m, hcsr_row_ptr, hcsr_col_ind, descr->base, hperm);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(perm, hperm.data(), sizeof(rocsparse_int) * m, hipMemcpyHostToDevice));
+
+    return rocsparse_status_success;
+}
@@ -312,6 +312,128 @@ static rocsparse_status rocsparse_csrcolor_assign_uncolored(rocsparse_handle han
     return rocsparse_status_success;
 }
 
+template <typename J>
+static rocsparse_status rocsparse_csrcolor_inclusive_scan(rocsparse_handle handle, J size, J* data)
+{
+    size_t temp_storage_bytes = 0;
+
+    //
+    // Obtain rocprim buffer size
+    //
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, temp_storage_bytes, data, data, size, rocprim::plus<J>(), handle->stream));
+
+    //
+    // Device buffer should be sufficient for rocprim in most cases
+    //
+    bool  d_temp_alloc;
+    void* d_temp_storage = nullptr;
+
+    if(handle->buffer_size >= temp_storage_bytes)
+    {
+        d_temp_storage = handle->buffer;
+        d_temp_alloc   = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        d_temp_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(d_temp_storage,
+                                                temp_storage_bytes,
+                                                data,
+                                                data,
+                                                size,
+                                                rocprim::plus<J>(),
+                                                handle->stream));
+
+    if(d_temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <bool DISTANCE2, typename I, typename J>
+static rocsparse_status rocsparse_csrcolor_balance(rocsparse_handle     handle,
+                                                   J                    m,
+                                                   J                    ncolors,
+                                                   J                    ncolored,
+                                                   const I*             csr_row_ptr,
+                                                   const J*             csr_col_ind,
+                                                   rocsparse_index_base csr_base,
+                                                   J*                   colors,
+                                                   J*                   counts)
+{
+    static constexpr rocsparse_int blocksize  = 256;
+    static constexpr int           max_rounds = 32;
+
+    hipStream_t stream = handle->stream;
+
+    //
+    // Each color should hold at most the average number of colored vertices.
+    //
+    J target = (ncolored - 1) / ncolors + 1;
+
+    J* proposals = nullptr;
+    J* nmoved    = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&proposals, sizeof(J) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&nmoved, sizeof(J)));
+
+    //
+    // Move vertices of oversized colors to undersized colors, until no vertex can be moved.
+    //
+    for(int round = 0; round < max_rounds; ++round)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(nmoved, 0, sizeof(J), stream));
+
+        hipLaunchKernelGGL((csrcolor_kernel_balance_propose<blocksize, DISTANCE2>),
+                           dim3((m - 1) / blocksize + 1),
+                           dim3(blocksize),
+                           0,
+                           stream,
+                           m,
+                           ncolors,
+                           target,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_base,
+                           colors,
+                           counts,
+                           proposals);
+
+        hipLaunchKernelGGL((csrcolor_kernel_balance_commit<blocksize, DISTANCE2>),
+                           dim3((m - 1) / blocksize + 1),
+                           dim3(blocksize),
+                           0,
+                           stream,
+                           m,
+                           target,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_base,
+                           proposals,
+                           colors,
+                           counts,
+                           nmoved);
+
+        J h_nmoved;
+        RETURN_IF_HIP_ERROR(hipMemcpy(&h_nmoved, nmoved, sizeof(J), hipMemcpyDeviceToHost));
+
+        if(h_nmoved == 0)
+        {
+            break;
+        }
+    }
+
+    RETURN_IF_HIP_ERROR(hipFree(proposals));
+    RETURN_IF_HIP_ERROR(hipFree(nmoved));
+
+    return rocsparse_status_success;
+}
+
 template <typename T, typename I, typename J>
 rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
                                              J                         m,
@@ -328,9 +450,10 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
 {
     static constexpr rocsparse_int blocksize = 256;
 
-    hipStream_t stream = handle->stream;
-    *ncolors           = -2;
+    hipStream_t stream    = handle->stream;
+    const bool  distance2 = (info->color_alg == rocsparse_color_alg_jpl_distance2);
 
+    J color             = -2;
     J num_uncolored     = m;
     J max_num_uncolored = m - m * fraction_to_color[0];
 
@@ -343,29 +466,46 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
     //
     // Initialize colors
     //
-    RETURN_IF_HIP_ERROR(hipMemsetAsync(colors, -1, sizeof(J) * m));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(colors, -1, sizeof(J) * m, stream));
 
     //
     // Iterate until the desired fraction of colored vertices is reached
     //
     while(num_uncolored > max_num_uncolored)
     {
-        *ncolors += 2;
+        color += 2;
 
         //
         // Run Jones-Plassmann Luby algorithm
         //
-        hipLaunchKernelGGL((csrcolor_kernel_jpl<blocksize, I, J>),
-                           dim3((m - 1) / blocksize + 1),
-                           dim3(blocksize),
-                           0,
-                           stream,
-                           m,
-                           *ncolors,
-                           csr_row_ptr,
-                           csr_col_ind,
-                           descr->base,
-                           colors);
+        if(distance2)
+        {
+            hipLaunchKernelGGL((csrcolor_kernel_jpl_distance2<blocksize, I, J>),
+                               dim3((m - 1) / blocksize + 1),
+                               dim3(blocksize),
+                               0,
+                               stream,
+                               m,
+                               color,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base,
+                               colors);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrcolor_kernel_jpl<blocksize, I, J>),
+                               dim3((m - 1) / blocksize + 1),
+                               dim3(blocksize),
+                               0,
+                               stream,
+                               m,
+                               color,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               descr->base,
+                               colors);
+        }
 
         //
         // Count colored vertices
@@ -396,34 +536,113 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
     }
 
     //
-    // Need to count the number of colors, compute the maximum value + 1.
-    // This is something I'll need to figure out.
-    // *ncolors += 2 is not the right number of colors, sometimes yes, sometimes no.
+    // Free workspace.
+    //
+    RETURN_IF_HIP_ERROR(hipFree(workspace));
+
     //
+    // Each iteration uses two colors, but not all of them are necessarily taken by a vertex.
+    // The unused colors are removed on the device, such that the colors of the colored
+    // vertices are contiguous and their number is exact.
+    //
+    J max_colors = color + 2;
+    J num_colors = 0;
+
+    if(max_colors > 0)
     {
-        hipLaunchKernelGGL((csrcolor_kernel_count_colors<blocksize, J>),
-                           dim3(blocksize),
+        J* counts = nullptr;
+        J* labels = nullptr;
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&counts, sizeof(J) * max_colors));
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&labels, sizeof(J) * max_colors));
+
+        //
+        // Count the vertices of each color.
+        //
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(counts, 0, sizeof(J) * max_colors, stream));
+        hipLaunchKernelGGL((csrcolor_kernel_histogram<blocksize, J>),
+                           dim3((m - 1) / blocksize + 1),
                            dim3(blocksize),
                            0,
                            stream,
                            m,
                            colors,
-                           workspace);
+                           counts);
 
-        hipLaunchKernelGGL((csrcolor_kernel_count_colors_finalize<blocksize, J>),
-                           dim3(1),
+        //
+        // New label of each used color.
+        //
+        hipLaunchKernelGGL((csrcolor_kernel_used_colors<blocksize, J>),
+                           dim3((max_colors - 1) / blocksize + 1),
                            dim3(blocksize),
                            0,
                            stream,
-                           workspace);
+                           max_colors,
+                           counts,
+                           labels);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrcolor_inclusive_scan(handle, max_colors, labels));
+
+        hipLaunchKernelGGL((csrcolor_kernel_relabel<blocksize, J>),
+                           dim3((m - 1) / blocksize + 1),
+                           dim3(blocksize),
+                           0,
+                           stream,
+                           m,
+                           labels,
+                           colors);
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            &num_colors, labels + max_colors - 1, sizeof(J), hipMemcpyDeviceToHost));
+
+        //
+        // Balance the sizes of the colors, if requested.
+        //
+        if(info->color_balance != 0 && num_colors > 1)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(counts, 0, sizeof(J) * num_colors, stream));
+            hipLaunchKernelGGL((csrcolor_kernel_histogram<blocksize, J>),
+                               dim3((m - 1) / blocksize + 1),
+                               dim3(blocksize),
+                               0,
+                               stream,
+                               m,
+                               colors,
+                               counts);
+
+            if(distance2)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrcolor_balance<true>(handle,
+                                                                           m,
+                                                                           num_colors,
+                                                                           m - num_uncolored,
+                                                                           csr_row_ptr,
+                                                                           csr_col_ind,
+                                                                           descr->base,
+                                                                           colors,
+                                                                           counts));
+            }
+            else
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrcolor_balance<false>(handle,
+                                                                            m,
+                                                                            num_colors,
+                                                                            m - num_uncolored,
+                                                                            csr_row_ptr,
+                                                                            csr_col_ind,
+                                                                            descr->base,
+                                                                            colors,
+                                                                            counts));
+            }
+        }
 
-        RETURN_IF_HIP_ERROR(hipMemcpy(ncolors, workspace, sizeof(J), hipMemcpyDeviceToHost));
-        *ncolors += 1;
+        RETURN_IF_HIP_ERROR(hipFree(counts));
+        RETURN_IF_HIP_ERROR(hipFree(labels));
     }
+
     //
-    // Free workspace.
+    // The remaining uncolored vertices receive distinct new colors.
     //
-    RETURN_IF_HIP_ERROR(hipFree(workspace));
+    *ncolors = num_colors;
 
     if(num_uncolored > 0)
     {
@@ -431,6 +650,35 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
         *ncolors += num_uncolored;
     }
 
+    //
+    // Offsets of the colors, such that the vertices of color c are at positions
+    // color_ptr[c] to color_ptr[c + 1] of the reordering.
+    //
+    if(info->color_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->color_ptr));
+        info->color_ptr = nullptr;
+    }
+
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->color_ptr, sizeof(rocsparse_int) * (*ncolors + 1)));
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(info->color_ptr, 0, sizeof(rocsparse_int) * (*ncolors + 1), stream));
+
+    hipLaunchKernelGGL((csrcolor_kernel_histogram<blocksize, J>),
+                       dim3((m - 1) / blocksize + 1),
+                       dim3(blocksize),
+                       0,
+                       stream,
+                       m,
+                       colors,
+                       info->color_ptr + 1);
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrcolor_inclusive_scan(handle, *ncolors + 1, info->color_ptr));
+
+    info->ncolors = *ncolors;
+
     //
     // Calculating reorering if required.
     //
@@ -468,38 +716,44 @@ rocsparse_status rocsparse_csrcolor_dispatch(rocsparse_handle          handle,
             size_t temporary_storage_size_bytes;
             void*  temporary_storage_ptr = nullptr;
 
+            //
+            // The sort is stable, such that the vertices of each color remain ordered
+            // by their index.
+            //
+            unsigned int endbit = rocsparse_clz(*ncolors);
+
             //
             // Get required size of the temporary storage
             //
-            rocprim::radix_sort_pairs(temporary_storage_ptr,
-                                      temporary_storage_size_bytes,
-                                      keys_input,
-                                      keys_output,
-                                      values_input,
-                                      values_output,
-                                      m,
-                                      0,
-                                      8 * sizeof(rocsparse_int),
-                                      stream);
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(temporary_storage_ptr,
+                                                          temporary_storage_size_bytes,
+                                                          keys_input,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_output,
+                                                          m,
+                                                          0,
+                                                          endbit,
+                                                          stream));
 
             //
             // allocate temporary storage
             //
-            hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+            RETURN_IF_HIP_ERROR(hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes));
 
             //
             // perform sort
             //
-            rocprim::radix_sort_pairs(temporary_storage_ptr,
-                                      temporary_storage_size_bytes,
-                                      keys_input,
-                                      keys_output,
-                                      values_input,
-                                      values_output,
-                                      m,
-                                      0,
-                                      8 * sizeof(rocsparse_int),
-                                      stream);
+            RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(temporary_storage_ptr,
+                                                          temporary_storage_size_bytes,
+                                                          keys_input,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_output,
+                                                          m,
+                                                          0,
+                                                          endbit,
+                                                          stream));
 
             RETURN_IF_HIP_ERROR(hipFree(temporary_storage_ptr));
         }
@@ -632,3 +886,64 @@ C_IMPL(rocsparse_ccsrcolor, rocsparse_float_complex, float);
 C_IMPL(rocsparse_zcsrcolor, rocsparse_double_complex, double);
 
 #undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_csrcolor_options(rocsparse_handle    handle,
+                                                       rocsparse_mat_info  info,
+                                                       rocsparse_color_alg alg,
+                                                       int                 enable_balance)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrcolor_options", (const void*&)info, alg, enable_balance);
+
+    if(rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    info->color_alg     = alg;
+    info->color_balance = enable_balance;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrcolor_color_ptr(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     color_ptr)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrcolor_color_ptr", (const void*&)info, (const void*&)color_ptr);
+
+    // Check pointer arguments and whether a coloring has been computed
+    if(color_ptr == nullptr || info->color_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(color_ptr,
+                                       info->color_ptr,
+                                       sizeof(rocsparse_int) * (info->ncolors + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       handle->stream));
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,350 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse_csrpermute.hpp"
+#include "utility.h"
+
+#include "csrpermute_device.hpp"
+#include <rocprim/rocprim.hpp>
+
+#define CSRPERMUTE_DIM 256
+
+extern "C" rocsparse_status
+    rocsparse_csrcolor_permute_buffer_size(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_int             ncolors,
+                                           size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrcolor_permute_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              ncolors,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ncolors < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Determine max rocprim buffer size
+    size_t size;
+    *buffer_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, ptr, ptr, ncolors + 1, rocprim::plus<rocsparse_int>(), stream));
+    *buffer_size = std::max(size, *buffer_size);
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, ptr, ptr, ptr, ptr, m, 0, 32, stream));
+    *buffer_size = std::max(size, *buffer_size);
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // identity buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    // sorted colors buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Buffer of the symmetric permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrpermute_buffer_size_dispatch(handle, m, nnz, &size));
+    *buffer_size += size;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrcolor_permute_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_int             ncolors,
+                                                     const rocsparse_int*      coloring,
+                                                     rocsparse_int*            perm,
+                                                     rocsparse_int*            color_ptr,
+                                                     T*                        csr_val_mc,
+                                                     rocsparse_int*            csr_row_ptr_mc,
+                                                     rocsparse_int*            csr_col_ind_mc,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcolor_permute"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              ncolors,
+              (const void*&)coloring,
+              (const void*&)perm,
+              (const void*&)color_ptr,
+              (const void*&)csr_val_mc,
+              (const void*&)csr_row_ptr_mc,
+              (const void*&)csr_col_ind_mc,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(ncolors < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Every row carries a color
+    if(ncolors == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr
+       || coloring == nullptr || perm == nullptr || color_ptr == nullptr || csr_val_mc == nullptr
+       || csr_row_ptr_mc == nullptr || csr_col_ind_mc == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // rocprim buffer, query the size that has been reserved by buffer_size
+    size_t size;
+    size_t rocprim_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, perm, perm, ncolors + 1, rocprim::plus<rocsparse_int>(), stream));
+    rocprim_size = std::max(size, rocprim_size);
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, perm, perm, perm, perm, m, 0, 32, stream));
+    rocprim_size = std::max(size, rocprim_size);
+    rocprim_size = ((rocprim_size - 1) / 256 + 1) * 256;
+
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+    ptr += rocprim_size;
+
+    // Identity
+    rocsparse_int* identity = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Sorted colors
+    rocsparse_int* sorted_colors = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    dim3 csrpermute_m_blocks((m - 1) / CSRPERMUTE_DIM + 1);
+    dim3 csrpermute_threads(CSRPERMUTE_DIM);
+
+    // Color offsets
+    RETURN_IF_HIP_ERROR(
+        hipMemsetAsync(color_ptr, 0, sizeof(rocsparse_int) * (ncolors + 1), stream));
+
+    hipLaunchKernelGGL((csrcolor_permute_count_kernel<CSRPERMUTE_DIM>),
+                       csrpermute_m_blocks,
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       coloring,
+                       color_ptr);
+
+    size = rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(tmp_rocprim,
+                                                size,
+                                                color_ptr,
+                                                color_ptr,
+                                                ncolors + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Stable sort of the rows by color, such that rows of the same color keep their
+    // relative order and perm[i] holds the original row of permuted row i
+    hipLaunchKernelGGL((csrpermute_identity_kernel<CSRPERMUTE_DIM>),
+                       csrpermute_m_blocks,
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       identity);
+
+    unsigned int endbit = rocsparse_clz(ncolors);
+    size                = rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        tmp_rocprim, size, coloring, sorted_colors, identity, perm, m, 0, endbit, stream));
+
+    // Move rows and columns to their new position
+    return rocsparse_csrpermute_dispatch(handle,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         perm,
+                                         csr_val_mc,
+                                         csr_row_ptr_mc,
+                                         csr_col_ind_mc,
+                                         ptr);
+}
+
+#undef CSRPERMUTE_DIM
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                     \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,         \
+                                     rocsparse_int             m,              \
+                                     rocsparse_int             nnz,            \
+                                     const rocsparse_mat_descr descr,          \
+                                     const TYPE*               csr_val,        \
+                                     const rocsparse_int*      csr_row_ptr,    \
+                                     const rocsparse_int*      csr_col_ind,    \
+                                     rocsparse_int             ncolors,        \
+                                     const rocsparse_int*      coloring,       \
+                                     rocsparse_int*            perm,           \
+                                     rocsparse_int*            color_ptr,      \
+                                     TYPE*                     csr_val_mc,     \
+                                     rocsparse_int*            csr_row_ptr_mc, \
+                                     rocsparse_int*            csr_col_ind_mc, \
+                                     void*                     temp_buffer)    \
+    {                                                                          \
+        return rocsparse_csrcolor_permute_template(handle,                     \
+                                                   m,                          \
+                                                   nnz,                        \
+                                                   descr,                      \
+                                                   csr_val,                    \
+                                                   csr_row_ptr,                \
+                                                   csr_col_ind,                \
+                                                   ncolors,                    \
+                                                   coloring,                   \
+                                                   perm,                       \
+                                                   color_ptr,                  \
+                                                   csr_val_mc,                 \
+                                                   csr_row_ptr_mc,             \
+                                                   csr_col_ind_mc,             \
+                                                   temp_buffer);               \
+    }
+
+C_IMPL(rocsparse_scsrcolor_permute, float);
+C_IMPL(rocsparse_dcsrcolor_permute, double);
+C_IMPL(rocsparse_ccsrcolor_permute, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrcolor_permute, rocsparse_double_complex);
+
+#undef C_IMPL
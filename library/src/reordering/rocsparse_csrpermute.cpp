@@ -0,0 +1,461 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrpermute.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrpermute_device.hpp"
+#include <rocprim/rocprim.hpp>
+
+#define CSRPERMUTE_DIM 256
+
+rocsparse_status rocsparse_csrpermute_buffer_size_dispatch(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           rocsparse_int    nnz,
+                                                           size_t*          buffer_size)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Determine max rocprim buffer size
+    size_t size;
+    *buffer_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), stream));
+    *buffer_size = std::max(size, *buffer_size);
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
+        nullptr, size, ptr, ptr, ptr, ptr, nnz, m, ptr, ptr + 1, 0, 32, stream));
+    *buffer_size = std::max(size, *buffer_size);
+    *buffer_size = ((*buffer_size - 1) / 256 + 1) * 256;
+
+    // inverse permutation buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    // unsorted columns buffer
+    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    // unsorted entry positions buffer
+    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    // sorted entry positions buffer
+    *buffer_size += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrpermute_dispatch(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               const rocsparse_int*      perm,
+                                               T*                        csr_val_perm,
+                                               rocsparse_int*            csr_row_ptr_perm,
+                                               rocsparse_int*            csr_col_ind_perm,
+                                               void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // rocprim buffer, query the size that has been reserved by buffer_size
+    size_t size;
+    size_t rocprim_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                size,
+                                                csr_row_ptr_perm,
+                                                csr_row_ptr_perm,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    rocprim_size = std::max(size, rocprim_size);
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(nullptr,
+                                                            size,
+                                                            csr_col_ind_perm,
+                                                            csr_col_ind_perm,
+                                                            csr_col_ind_perm,
+                                                            csr_col_ind_perm,
+                                                            nnz,
+                                                            m,
+                                                            csr_row_ptr_perm,
+                                                            csr_row_ptr_perm + 1,
+                                                            0,
+                                                            32,
+                                                            stream));
+    rocprim_size = std::max(size, rocprim_size);
+    rocprim_size = ((rocprim_size - 1) / 256 + 1) * 256;
+
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+    ptr += rocprim_size;
+
+    // Inverse permutation
+    rocsparse_int* iperm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Unsorted columns
+    rocsparse_int* col_tmp = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // Unsorted entry positions
+    rocsparse_int* nnz_tmp = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    // Sorted entry positions
+    rocsparse_int* nnz_sorted = reinterpret_cast<rocsparse_int*>(ptr);
+
+    dim3 csrpermute_m_blocks((m - 1) / CSRPERMUTE_DIM + 1);
+    dim3 csrpermute_threads(CSRPERMUTE_DIM);
+
+    // Inverse permutation
+    hipLaunchKernelGGL((csrpermute_inverse_kernel<CSRPERMUTE_DIM>),
+                       csrpermute_m_blocks,
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       perm,
+                       iperm);
+
+    // Zero based row pointer of the permuted matrix
+    hipLaunchKernelGGL((csrpermute_row_nnz_kernel<CSRPERMUTE_DIM>),
+                       csrpermute_m_blocks,
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       perm,
+                       csr_row_ptr_perm);
+
+    size = rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(tmp_rocprim,
+                                                size,
+                                                csr_row_ptr_perm,
+                                                csr_row_ptr_perm,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Move rows to their new position and relabel the columns
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrpermute_scatter_kernel<CSRPERMUTE_DIM, 32>),
+                           dim3((m - 1) / (CSRPERMUTE_DIM / 32) + 1),
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           iperm,
+                           csr_row_ptr_perm,
+                           col_tmp,
+                           nnz_tmp,
+                           descr->base);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        hipLaunchKernelGGL((csrpermute_scatter_kernel<CSRPERMUTE_DIM, 64>),
+                           dim3((m - 1) / (CSRPERMUTE_DIM / 64) + 1),
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           iperm,
+                           csr_row_ptr_perm,
+                           col_tmp,
+                           nnz_tmp,
+                           descr->base);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Sort columns per row
+    unsigned int endbit = rocsparse_clz(m);
+    size                = rocprim_size;
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(tmp_rocprim,
+                                                            size,
+                                                            col_tmp,
+                                                            csr_col_ind_perm,
+                                                            nnz_tmp,
+                                                            nnz_sorted,
+                                                            nnz,
+                                                            m,
+                                                            csr_row_ptr_perm,
+                                                            csr_row_ptr_perm + 1,
+                                                            0,
+                                                            endbit,
+                                                            stream));
+
+    // Gather values and restore the index base
+    hipLaunchKernelGGL((csrpermute_gather_kernel<CSRPERMUTE_DIM>),
+                       dim3((nnz - 1) / CSRPERMUTE_DIM + 1),
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       nnz,
+                       nnz_sorted,
+                       csr_val,
+                       csr_val_perm,
+                       csr_col_ind_perm,
+                       descr->base);
+
+    hipLaunchKernelGGL((csrpermute_shift_row_ptr_kernel<CSRPERMUTE_DIM>),
+                       dim3(m / CSRPERMUTE_DIM + 1),
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_perm,
+                       descr->base);
+
+    return rocsparse_status_success;
+}
+
+#undef CSRPERMUTE_DIM
+
+#define INSTANTIATE(TYPE)                                          \
+    template rocsparse_status rocsparse_csrpermute_dispatch<TYPE>( \
+        rocsparse_handle          handle,                          \
+        rocsparse_int             m,                               \
+        rocsparse_int             nnz,                             \
+        const rocsparse_mat_descr descr,                           \
+        const TYPE*               csr_val,                         \
+        const rocsparse_int*      csr_row_ptr,                     \
+        const rocsparse_int*      csr_col_ind,                     \
+        const rocsparse_int*      perm,                            \
+        TYPE*                     csr_val_perm,                    \
+        rocsparse_int*            csr_row_ptr_perm,                \
+        rocsparse_int*            csr_col_ind_perm,                \
+        void*                     temp_buffer);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
+template <typename T>
+rocsparse_status rocsparse_csrpermute_template(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               const rocsparse_int*      perm,
+                                               T*                        csr_val_perm,
+                                               rocsparse_int*            csr_row_ptr_perm,
+                                               rocsparse_int*            csr_col_ind_perm,
+                                               void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrpermute"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)csr_val_perm,
+              (const void*&)csr_row_ptr_perm,
+              (const void*&)csr_col_ind_perm,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr || csr_row_ptr == nullptr || csr_col_ind == nullptr || perm == nullptr
+       || csr_val_perm == nullptr || csr_row_ptr_perm == nullptr || csr_col_ind_perm == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrpermute_dispatch(handle,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         perm,
+                                         csr_val_perm,
+                                         csr_row_ptr_perm,
+                                         csr_col_ind_perm,
+                                         temp_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+extern "C" rocsparse_status rocsparse_csrpermute_buffer_size(rocsparse_handle          handle,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             size_t*              buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrpermute_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    return rocsparse_csrpermute_buffer_size_dispatch(handle, m, nnz, buffer_size);
+}
+
+#define C_IMPL(NAME, TYPE)                                                       \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,           \
+                                     rocsparse_int             m,                \
+                                     rocsparse_int             nnz,              \
+                                     const rocsparse_mat_descr descr,            \
+                                     const TYPE*               csr_val,          \
+                                     const rocsparse_int*      csr_row_ptr,      \
+                                     const rocsparse_int*      csr_col_ind,      \
+                                     const rocsparse_int*      perm,             \
+                                     TYPE*                     csr_val_perm,     \
+                                     rocsparse_int*            csr_row_ptr_perm, \
+                                     rocsparse_int*            csr_col_ind_perm, \
+                                     void*                     temp_buffer)      \
+    {                                                                            \
+        return rocsparse_csrpermute_template(handle,                             \
+                                             m,                                  \
+                                             nnz,                                \
+                                             descr,                              \
+                                             csr_val,                            \
+                                             csr_row_ptr,                        \
+                                             csr_col_ind,                        \
+                                             perm,                               \
+                                             csr_val_perm,                       \
+                                             csr_row_ptr_perm,                   \
+                                             csr_col_ind_perm,                   \
+                                             temp_buffer);                       \
+    }
+
+C_IMPL(rocsparse_scsrpermute, float);
+C_IMPL(rocsparse_dcsrpermute, double);
+C_IMPL(rocsparse_ccsrpermute, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrpermute, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,53 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRPERMUTE_HPP
+#define ROCSPARSE_CSRPERMUTE_HPP
+
+#include "utility.h"
+
+// Size of the temporary storage of rocsparse_csrpermute_dispatch for m > 0 and nnz > 0
+rocsparse_status rocsparse_csrpermute_buffer_size_dispatch(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           rocsparse_int    nnz,
+                                                           size_t*          buffer_size);
+
+// Symmetric permutation of a CSR matrix without argument checks, row i of the
+// permuted matrix is row perm[i] of the input matrix
+template <typename T>
+rocsparse_status rocsparse_csrpermute_dispatch(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               const rocsparse_int*      perm,
+                                               T*                        csr_val_perm,
+                                               rocsparse_int*            csr_row_ptr_perm,
+                                               rocsparse_int*            csr_col_ind_perm,
+                                               void*                     temp_buffer);
+
+#endif // ROCSPARSE_CSRPERMUTE_HPP
@@ -0,0 +1,612 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrrcm_device.hpp"
+#include <rocprim/rocprim.hpp>
+
+#define CSRRCM_DIM 256
+
+// Maximum number of additional breadth first searches to find a pseudo-peripheral node
+#define CSRRCM_MAX_SEARCH 8
+
+// Size of the rocprim temporary storage
+static rocsparse_status rocsparse_csrrcm_rocprim_size(rocsparse_int m,
+                                                      hipStream_t   stream,
+                                                      size_t*       rocprim_size)
+{
+    rocsparse_int* ptr  = reinterpret_cast<rocsparse_int*>(rocprim_size);
+    uint64_t*      keys = reinterpret_cast<uint64_t*>(rocprim_size);
+
+    size_t size;
+    *rocprim_size = 0;
+
+    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
+                                        size,
+                                        keys,
+                                        keys,
+                                        std::numeric_limits<uint64_t>::max(),
+                                        m,
+                                        rocprim::minimum<uint64_t>(),
+                                        stream));
+    *rocprim_size = std::max(size, *rocprim_size);
+    RETURN_IF_HIP_ERROR(rocprim::select(nullptr,
+                                        size,
+                                        rocprim::counting_iterator<rocsparse_int>(0),
+                                        ptr,
+                                        ptr,
+                                        ptr,
+                                        m,
+                                        stream));
+    *rocprim_size = std::max(size, *rocprim_size);
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(nullptr, size, ptr, ptr, m, 0, 32, stream));
+    *rocprim_size = std::max(size, *rocprim_size);
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, keys, ptr, ptr, m, 0, 64, stream));
+    *rocprim_size = std::max(size, *rocprim_size);
+    *rocprim_size = ((*rocprim_size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+// Level synchronous breadth first search from the node encoded in root_key. The
+// visited nodes are stored level by level in queue, where the nodes of each level
+// are sorted by the queue position of their parent and by degree.
+static rocsparse_status rocsparse_csrrcm_bfs(rocsparse_handle     handle,
+                                             rocsparse_int        m,
+                                             rocsparse_int        nbits,
+                                             rocsparse_int        stamp,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_index_base idx_base,
+                                             const rocsparse_int* degree,
+                                             rocsparse_int*       mark,
+                                             rocsparse_int*       parent,
+                                             rocsparse_int*       candidates,
+                                             rocsparse_int*       candidates_sorted,
+                                             rocsparse_int*       ncandidates,
+                                             uint64_t*            keys,
+                                             uint64_t*            keys_sorted,
+                                             const uint64_t*      root_key,
+                                             void*                tmp_rocprim,
+                                             size_t               rocprim_size,
+                                             rocsparse_int*       queue,
+                                             rocsparse_int*       nlevels,
+                                             rocsparse_int*       nvisited,
+                                             rocsparse_int*       last_level)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 csrrcm_threads(CSRRCM_DIM);
+
+    // Root of the search
+    hipLaunchKernelGGL(
+        csrrcm_root_kernel, dim3(1), dim3(1), 0, stream, nbits, stamp, root_key, queue, mark);
+
+    rocsparse_int level_begin = 0;
+    rocsparse_int level_end   = 1;
+
+    *nlevels    = 1;
+    *last_level = 0;
+
+    while(true)
+    {
+        rocsparse_int level_size = level_end - level_begin;
+
+        // Claim the unvisited neighbours of the current level
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(ncandidates, 0, sizeof(rocsparse_int), stream));
+
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrrcm_expand_kernel<CSRRCM_DIM, 32>),
+                               dim3((level_size - 1) / (CSRRCM_DIM / 32) + 1),
+                               csrrcm_threads,
+                               0,
+                               stream,
+                               level_begin,
+                               level_end,
+                               stamp,
+                               queue,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               mark,
+                               parent,
+                               candidates,
+                               ncandidates,
+                               idx_base);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            hipLaunchKernelGGL((csrrcm_expand_kernel<CSRRCM_DIM, 64>),
+                               dim3((level_size - 1) / (CSRRCM_DIM / 64) + 1),
+                               csrrcm_threads,
+                               0,
+                               stream,
+                               level_begin,
+                               level_end,
+                               stamp,
+                               queue,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               mark,
+                               parent,
+                               candidates,
+                               ncandidates,
+                               idx_base);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        rocsparse_int n;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&n, ncandidates, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // The search is complete if the level has no unvisited neighbours
+        if(n == 0)
+        {
+            break;
+        }
+
+        dim3 csrrcm_blocks((n - 1) / CSRRCM_DIM + 1);
+
+        // The candidates have been appended in arbitrary order, sort them by index
+        // such that the final order does not depend on the scheduling
+        size_t size = rocprim_size;
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_keys(
+            tmp_rocprim, size, candidates, candidates_sorted, n, 0, nbits, stream));
+
+        // Stable sort by parent position and degree, directly into the queue
+        hipLaunchKernelGGL((csrrcm_parent_key_kernel<CSRRCM_DIM>),
+                           csrrcm_blocks,
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           n,
+                           nbits,
+                           candidates_sorted,
+                           parent,
+                           degree,
+                           keys);
+
+        size = rocprim_size;
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(tmp_rocprim,
+                                                      size,
+                                                      keys,
+                                                      keys_sorted,
+                                                      candidates_sorted,
+                                                      queue + level_end,
+                                                      n,
+                                                      0,
+                                                      2 * nbits,
+                                                      stream));
+
+        hipLaunchKernelGGL((csrrcm_visit_kernel<CSRRCM_DIM>),
+                           csrrcm_blocks,
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           n,
+                           stamp,
+                           queue + level_end,
+                           mark,
+                           parent);
+
+        level_begin = level_end;
+        level_end += n;
+
+        ++*nlevels;
+        *last_level = level_begin;
+    }
+
+    *nvisited = level_end;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Determine rocprim buffer size
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_rocprim_size(m, handle->stream, buffer_size));
+
+    // degree, mark, parent, candidates and sorted candidates buffers
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 5;
+    // keys and sorted keys buffers
+    *buffer_size += sizeof(uint64_t) * ((m - 1) / 256 + 1) * 256 * 2;
+    // candidate counter and root key
+    *buffer_size += 256 * 2;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int*            perm,
+                                             void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || perm == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Both halves of a sort key hold a node index
+    rocsparse_int nbits = rocsparse_clz(m);
+
+    if(2 * nbits > 64)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // rocprim buffer
+    size_t rocprim_size;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_rocprim_size(m, stream, &rocprim_size));
+
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+    ptr += rocprim_size;
+
+    // Number of off-diagonal entries per row
+    rocsparse_int* degree = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Search stamp of each node, -1 if the node has been ordered
+    rocsparse_int* mark = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Queue position of the parent of each claimed node
+    rocsparse_int* parent = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Unsorted candidates of the next level
+    rocsparse_int* candidates = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Sorted candidates of the next level
+    rocsparse_int* candidates_sorted = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Sort keys
+    uint64_t* keys = reinterpret_cast<uint64_t*>(ptr);
+    ptr += sizeof(uint64_t) * ((m - 1) / 256 + 1) * 256;
+
+    uint64_t* keys_sorted = reinterpret_cast<uint64_t*>(ptr);
+    ptr += sizeof(uint64_t) * ((m - 1) / 256 + 1) * 256;
+
+    // Candidate counter
+    rocsparse_int* ncandidates = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+    // Start node of the current search
+    uint64_t* root_key = reinterpret_cast<uint64_t*>(ptr);
+
+    dim3 csrrcm_m_blocks((m - 1) / CSRRCM_DIM + 1);
+    dim3 csrrcm_threads(CSRRCM_DIM);
+
+    // Degrees, the candidate buffer holds the isolated node flags
+    hipLaunchKernelGGL((csrrcm_degree_kernel<CSRRCM_DIM>),
+                       csrrcm_m_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       degree,
+                       mark,
+                       parent,
+                       candidates,
+                       descr->base);
+
+    // Isolated nodes form components of their own, order them first at once
+    size_t size = rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::select(tmp_rocprim,
+                                        size,
+                                        rocprim::counting_iterator<rocsparse_int>(0),
+                                        candidates,
+                                        perm,
+                                        ncandidates,
+                                        m,
+                                        stream));
+
+    rocsparse_int nordered;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&nordered, ncandidates, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    if(nordered > 0)
+    {
+        hipLaunchKernelGGL((csrrcm_finish_kernel<CSRRCM_DIM>),
+                           dim3((nordered - 1) / CSRRCM_DIM + 1),
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           nordered,
+                           perm,
+                           mark);
+    }
+
+    rocsparse_int stamp = 0;
+
+    // Cuthill-McKee ordering, one connected component at a time
+    while(nordered < m)
+    {
+        rocsparse_int* queue = perm + nordered;
+
+        // Unordered node of minimum degree
+        hipLaunchKernelGGL((csrrcm_start_key_kernel<CSRRCM_DIM>),
+                           csrrcm_m_blocks,
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           m,
+                           nbits,
+                           degree,
+                           mark,
+                           keys);
+
+        size = rocprim_size;
+        RETURN_IF_HIP_ERROR(rocprim::reduce(tmp_rocprim,
+                                            size,
+                                            keys,
+                                            root_key,
+                                            std::numeric_limits<uint64_t>::max(),
+                                            m,
+                                            rocprim::minimum<uint64_t>(),
+                                            stream));
+
+        rocsparse_int nlevels;
+        rocsparse_int nvisited;
+        rocsparse_int last_level;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_bfs(handle,
+                                                       m,
+                                                       nbits,
+                                                       ++stamp,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       descr->base,
+                                                       degree,
+                                                       mark,
+                                                       parent,
+                                                       candidates,
+                                                       candidates_sorted,
+                                                       ncandidates,
+                                                       keys,
+                                                       keys_sorted,
+                                                       root_key,
+                                                       tmp_rocprim,
+                                                       rocprim_size,
+                                                       queue,
+                                                       &nlevels,
+                                                       &nvisited,
+                                                       &last_level));
+
+        // Pseudo-peripheral node (George and Liu), restart the search from the node of
+        // minimum degree of the last level as long as the number of levels grows
+        for(int i = 0; i < CSRRCM_MAX_SEARCH; ++i)
+        {
+            rocsparse_int n = nvisited - last_level;
+
+            hipLaunchKernelGGL((csrrcm_level_key_kernel<CSRRCM_DIM>),
+                               dim3((n - 1) / CSRRCM_DIM + 1),
+                               csrrcm_threads,
+                               0,
+                               stream,
+                               n,
+                               nbits,
+                               queue + last_level,
+                               degree,
+                               keys);
+
+            size = rocprim_size;
+            RETURN_IF_HIP_ERROR(rocprim::reduce(tmp_rocprim,
+                                                size,
+                                                keys,
+                                                root_key,
+                                                std::numeric_limits<uint64_t>::max(),
+                                                n,
+                                                rocprim::minimum<uint64_t>(),
+                                                stream));
+
+            rocsparse_int nlevels_prev = nlevels;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_bfs(handle,
+                                                           m,
+                                                           nbits,
+                                                           ++stamp,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           descr->base,
+                                                           degree,
+                                                           mark,
+                                                           parent,
+                                                           candidates,
+                                                           candidates_sorted,
+                                                           ncandidates,
+                                                           keys,
+                                                           keys_sorted,
+                                                           root_key,
+                                                           tmp_rocprim,
+                                                           rocprim_size,
+                                                           queue,
+                                                           &nlevels,
+                                                           &nvisited,
+                                                           &last_level));
+
+            // The eccentricity did not grow, keep the ordering of the last search
+            if(nlevels <= nlevels_prev)
+            {
+                break;
+            }
+        }
+
+        // Nodes of the component are final
+        hipLaunchKernelGGL((csrrcm_finish_kernel<CSRRCM_DIM>),
+                           dim3((nvisited - 1) / CSRRCM_DIM + 1),
+                           csrrcm_threads,
+                           0,
+                           stream,
+                           nvisited,
+                           queue,
+                           mark);
+
+        nordered += nvisited;
+    }
+
+    // Reverse Cuthill-McKee
+    hipLaunchKernelGGL((csrrcm_reverse_kernel<CSRRCM_DIM>),
+                       csrrcm_m_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       m,
+                       perm);
+
+    return rocsparse_status_success;
+}
+
+#undef CSRRCM_MAX_SEARCH
+#undef CSRRCM_DIM
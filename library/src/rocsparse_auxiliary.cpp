@@ -701,6 +701,13 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         info->zero_pivot = nullptr;
     }
 
+    // Clear color offsets
+    if(info->color_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->color_ptr));
+        info->color_ptr = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -1347,6 +1354,178 @@ rocsparse_status rocsparse_create_ell_descr(rocsparse_spmat_descr* descr,
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_create_bsr_descr creates a descriptor holding the BSR matrix
+ * data, sizes and properties. It must be called prior to all subsequent library
+ * function calls that involve sparse matrices. It should be destroyed at the end
+ * using rocsparse_destroy_spmat_descr(). All data pointers remain valid.
+ *******************************************************************************/
+rocsparse_status rocsparse_create_bsr_descr(rocsparse_spmat_descr* descr,
+                                            int64_t                mb,
+                                            int64_t                nb,
+                                            int64_t                nnzb,
+                                            rocsparse_direction    block_dir,
+                                            int64_t                block_dim,
+                                            void*                  bsr_row_ptr,
+                                            void*                  bsr_col_ind,
+                                            void*                  bsr_val,
+                                            rocsparse_indextype    row_ptr_type,
+                                            rocsparse_indextype    col_ind_type,
+                                            rocsparse_index_base   idx_base,
+                                            rocsparse_datatype     data_type)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid direction
+    if(rocsparse_enum_utils::is_invalid(block_dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check for valid sizes
+    if(mb < 0 || nb < 0 || nnzb < 0 || nnzb > mb * nb || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid pointers
+    if(mb > 0 && bsr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnzb > 0 && (bsr_col_ind == nullptr || bsr_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *descr = nullptr;
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_spmat_descr;
+
+        (*descr)->init = true;
+
+        (*descr)->rows = mb;
+        (*descr)->cols = nb;
+        (*descr)->nnz  = nnzb;
+
+        (*descr)->row_data = bsr_row_ptr;
+        (*descr)->col_data = bsr_col_ind;
+        (*descr)->val_data = bsr_val;
+
+        (*descr)->row_type  = row_ptr_type;
+        (*descr)->col_type  = col_ind_type;
+        (*descr)->data_type = data_type;
+
+        (*descr)->idx_base = idx_base;
+        (*descr)->format   = rocsparse_format_bsr;
+
+        (*descr)->block_dir = block_dir;
+        (*descr)->block_dim = block_dim;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&(*descr)->descr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&(*descr)->info));
+
+        // Initialize descriptor
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_mat_index_base((*descr)->descr, idx_base));
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_sell_descr creates a descriptor holding the SELL-C-sigma
+ * matrix data, sizes and properties. It must be called prior to all subsequent
+ * library function calls that involve sparse matrices. It should be destroyed at
+ * the end using rocsparse_destroy_spmat_descr(). All data pointers remain valid.
+ *******************************************************************************/
+rocsparse_status rocsparse_create_sell_descr(rocsparse_spmat_descr* descr,
+                                             int64_t                rows,
+                                             int64_t                cols,
+                                             int64_t                sell_nnz,
+                                             int64_t                slice_size,
+                                             void*                  sell_slice_ptr,
+                                             void*                  sell_perm,
+                                             void*                  sell_col_ind,
+                                             void*                  sell_val,
+                                             rocsparse_indextype    slice_ptr_type,
+                                             rocsparse_indextype    idx_type,
+                                             rocsparse_index_base   idx_base,
+                                             rocsparse_datatype     data_type)
+{
+    // Check for valid descriptor
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid sizes
+    if(rows < 0 || cols < 0 || sell_nnz < 0 || slice_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid pointers
+    if(rows > 0 && (sell_slice_ptr == nullptr || sell_perm == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(sell_nnz > 0 && (sell_col_ind == nullptr || sell_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *descr = nullptr;
+    // Allocate
+    try
+    {
+        *descr = new _rocsparse_spmat_descr;
+
+        (*descr)->init = true;
+
+        (*descr)->rows = rows;
+        (*descr)->cols = cols;
+        (*descr)->nnz  = sell_nnz;
+
+        (*descr)->row_data = sell_slice_ptr;
+        (*descr)->col_data = sell_col_ind;
+        (*descr)->ind_data = sell_perm;
+        (*descr)->val_data = sell_val;
+
+        (*descr)->row_type  = slice_ptr_type;
+        (*descr)->col_type  = idx_type;
+        (*descr)->data_type = data_type;
+
+        (*descr)->idx_base = idx_base;
+        (*descr)->format   = rocsparse_format_sell;
+
+        (*descr)->slice_size = slice_size;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_descr(&(*descr)->descr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&(*descr)->info));
+
+        // Initialize descriptor
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_mat_index_base((*descr)->descr, idx_base));
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_destroy_spmat_descr destroys a sparse matrix descriptor.
  *******************************************************************************/
@@ -1710,7 +1889,8 @@ rocsparse_status rocsparse_csr_set_pointers(rocsparse_spmat_descr descr,
     }
 
     // Sparsity structure might have changed, analysis is required before calling SpMV
-    descr->analysed = false;
+    descr->analysed   = false;
+    descr->spmv_tuned = false;
 
     descr->row_data = csr_row_ptr;
     descr->col_data = csr_col_ind;
@@ -1746,7 +1926,8 @@ rocsparse_status rocsparse_csc_set_pointers(rocsparse_spmat_descr descr,
     }
 
     // Sparsity structure might have changed, analysis is required before calling SpMV
-    descr->analysed = false;
+    descr->analysed   = false;
+    descr->spmv_tuned = false;
 
     descr->row_data = csc_row_ind;
     descr->col_data = csc_col_ptr;
@@ -1908,6 +2089,122 @@ rocsparse_status rocsparse_spmat_set_values(rocsparse_spmat_descr descr, void* v
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_spmat_get_attribute returns the requested attribute of the
+ * sparse matrix descriptor.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_get_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               void*                     data,
+                                               size_t                    data_size)
+{
+    // Check for valid pointers
+    if(descr == nullptr || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    switch(attribute)
+    {
+    case rocsparse_spmat_fill_mode:
+    {
+        if(data_size != sizeof(rocsparse_fill_mode))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        *reinterpret_cast<rocsparse_fill_mode*>(data) = descr->descr->fill_mode;
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_diag_type:
+    {
+        if(data_size != sizeof(rocsparse_diag_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        *reinterpret_cast<rocsparse_diag_type*>(data) = descr->descr->diag_type;
+        return rocsparse_status_success;
+    }
+    case rocsparse_spmat_matrix_type:
+    {
+        if(data_size != sizeof(rocsparse_matrix_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        *reinterpret_cast<rocsparse_matrix_type*>(data) = descr->descr->type;
+        return rocsparse_status_success;
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+/********************************************************************************
+ * \brief rocsparse_spmat_set_attribute sets the requested attribute of the
+ * sparse matrix descriptor.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_set_attribute(rocsparse_spmat_descr     descr,
+                                               rocsparse_spmat_attribute attribute,
+                                               const void*               data,
+                                               size_t                    data_size)
+{
+    // Check for valid pointers
+    if(descr == nullptr || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    switch(attribute)
+    {
+    case rocsparse_spmat_fill_mode:
+    {
+        if(data_size != sizeof(rocsparse_fill_mode))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        return rocsparse_set_mat_fill_mode(descr->descr,
+                                           *reinterpret_cast<const rocsparse_fill_mode*>(data));
+    }
+    case rocsparse_spmat_diag_type:
+    {
+        if(data_size != sizeof(rocsparse_diag_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        return rocsparse_set_mat_diag_type(descr->descr,
+                                           *reinterpret_cast<const rocsparse_diag_type*>(data));
+    }
+    case rocsparse_spmat_matrix_type:
+    {
+        if(data_size != sizeof(rocsparse_matrix_type))
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        return rocsparse_set_mat_type(descr->descr,
+                                      *reinterpret_cast<const rocsparse_matrix_type*>(data));
+    }
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
 /********************************************************************************
  * \brief rocsparse_create_dnvec_descr creates a descriptor holding the dense
  * vector data, size and properties. It must be called prior to all subsequent
@@ -0,0 +1,809 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "common.h"
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include <hip/hip_runtime.h>
+#include <vector>
+
+// Identifies a serialized rocsparse_mat_info ("rspinfo") and its layout version
+#define MAT_INFO_MAGIC 0x6f666e6970737200ULL
+#define MAT_INFO_VERSION 3
+
+// Number of serialized triangular meta data slots
+#define MAT_INFO_NTRM 10
+
+// Triangular meta data slots of the info structure that are serialized
+static rocsparse_trm_info _rocsparse_mat_info::*const mat_info_trm_slots[MAT_INFO_NTRM]
+    = {&_rocsparse_mat_info::csric0_info,
+       &_rocsparse_mat_info::csrilu0_info,
+       &_rocsparse_mat_info::csrsv_upper_info,
+       &_rocsparse_mat_info::csrsv_lower_info,
+       &_rocsparse_mat_info::csrsvt_upper_info,
+       &_rocsparse_mat_info::csrsvt_lower_info,
+       &_rocsparse_mat_info::csrsm_upper_info,
+       &_rocsparse_mat_info::csrsm_lower_info,
+       &_rocsparse_mat_info::csrsmt_upper_info,
+       &_rocsparse_mat_info::csrsmt_lower_info};
+
+struct mat_info_header
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t index_type_size;
+    uint64_t size;
+    uint64_t checksum;
+    uint64_t data_checksum;
+
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+    int64_t zero_pivot;
+    int32_t has_zero_pivot;
+    int32_t has_csrmv;
+    int32_t ntrm;
+
+    // Index into the serialized triangular meta data for each slot, -1 if empty.
+    // Shared meta data is serialized only once.
+    int32_t trm_slot[MAT_INFO_NTRM];
+};
+
+struct mat_info_trm_record
+{
+    int64_t m;
+    int64_t nnz;
+    int64_t max_nnz;
+    int64_t nlevels;
+    int32_t has_row_map;
+    int32_t has_diag_ind;
+    int32_t has_transpose;
+    int32_t has_col_nnz;
+    int32_t has_level_ptr;
+};
+
+struct mat_info_csrmv_record
+{
+    uint64_t size;
+    uint64_t row_blocks_type_size;
+    uint64_t wg_ids_type_size;
+    int64_t  m;
+    int64_t  n;
+    int64_t  nnz;
+    int32_t  trans;
+    int32_t  reserved;
+};
+
+// Sections are 8 byte aligned
+static inline size_t mat_info_align(size_t bytes)
+{
+    return (bytes + 7) / 8 * 8;
+}
+
+// Sequentially writes the sections of a serialized info structure, that can reside in
+// host or device memory. Without data, only the required size is determined.
+class mat_info_writer
+{
+public:
+    explicit mat_info_writer(char* data)
+        : data(data)
+        , offset(0)
+    {
+    }
+
+    rocsparse_status write(const void* src, size_t bytes)
+    {
+        if(this->data != nullptr && bytes > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpy(this->data + this->offset, src, bytes, hipMemcpyDefault));
+        }
+
+        this->offset += mat_info_align(bytes);
+
+        return rocsparse_status_success;
+    }
+
+    size_t size() const
+    {
+        return this->offset;
+    }
+
+private:
+    char*  data;
+    size_t offset;
+};
+
+// Sequentially reads the sections of a serialized info structure, that can reside in
+// host or device memory
+class mat_info_reader
+{
+public:
+    mat_info_reader(const char* data, size_t size)
+        : data(data)
+        , size(size)
+        , offset(0)
+    {
+    }
+
+    rocsparse_status read(void* dst, size_t bytes)
+    {
+        // Do not read beyond the serialized data
+        if(this->offset + mat_info_align(bytes) > this->size)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        if(bytes > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpy(dst, this->data + this->offset, bytes, hipMemcpyDefault));
+        }
+
+        this->offset += mat_info_align(bytes);
+
+        return rocsparse_status_success;
+    }
+
+    // Allocates device memory and reads the section into it
+    template <typename T>
+    rocsparse_status read_device(T** dst, size_t count)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)dst, sizeof(T) * count));
+        return this->read(*dst, sizeof(T) * count);
+    }
+
+private:
+    const char* data;
+    size_t      size;
+    size_t      offset;
+};
+
+__host__ __device__ __forceinline__ uint64_t mat_info_mix(uint64_t x)
+{
+    // splitmix64 finalizer
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Order dependent checksum of an index array. Each entry is hashed together with its
+// position, such that the hashes can be accumulated in any order.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void mat_info_checksum_kernel(rocsparse_int size,
+                                  const rocsparse_int* __restrict__ data,
+                                  uint64_t salt,
+                                  unsigned long long* __restrict__ checksum)
+{
+    int tid = hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+
+    unsigned long long sum = 0;
+    for(rocsparse_int i = hipBlockIdx_x * BLOCKSIZE + tid; i < size;
+        i += hipGridDim_x * BLOCKSIZE)
+    {
+        sum += mat_info_mix(salt ^ mat_info_mix(i) ^ static_cast<uint64_t>(data[i]));
+    }
+
+    sdata[tid] = sum;
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        atomicAdd(checksum, sdata[0]);
+    }
+}
+
+static rocsparse_status rocsparse_mat_info_checksum(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    uint64_t*                 checksum)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    unsigned long long* d_checksum = reinterpret_cast<unsigned long long*>(handle->buffer);
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_checksum, 0, sizeof(unsigned long long), stream));
+
+#define CHECKSUM_DIM 256
+#define CHECKSUM_MAX_BLOCKS 1024
+    hipLaunchKernelGGL((mat_info_checksum_kernel<CHECKSUM_DIM>),
+                       dim3(std::min(m / CHECKSUM_DIM + 1, CHECKSUM_MAX_BLOCKS)),
+                       dim3(CHECKSUM_DIM),
+                       0,
+                       stream,
+                       m + 1,
+                       csr_row_ptr,
+                       0x9e3779b97f4a7c15ULL,
+                       d_checksum);
+
+    if(nnz > 0)
+    {
+        hipLaunchKernelGGL((mat_info_checksum_kernel<CHECKSUM_DIM>),
+                           dim3(std::min((nnz - 1) / CHECKSUM_DIM + 1, CHECKSUM_MAX_BLOCKS)),
+                           dim3(CHECKSUM_DIM),
+                           0,
+                           stream,
+                           nnz,
+                           csr_col_ind,
+                           0xc2b2ae3d27d4eb4fULL,
+                           d_checksum);
+    }
+#undef CHECKSUM_MAX_BLOCKS
+#undef CHECKSUM_DIM
+
+    unsigned long long h_checksum;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &h_checksum, d_checksum, sizeof(unsigned long long), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Sizes and index base are part of the pattern
+    *checksum = h_checksum ^ (static_cast<uint64_t>(m) * 0xff51afd7ed558ccdULL)
+                ^ (static_cast<uint64_t>(n) * 0xc4ceb9fe1a85ec53ULL)
+                ^ (static_cast<uint64_t>(nnz) * 0x2127599bf4325c37ULL)
+                ^ static_cast<uint64_t>(descr->base);
+
+    return rocsparse_status_success;
+}
+
+// Checksum of the serialized meta data that follows the header, such that corrupted
+// data is rejected before any of it is imported
+static rocsparse_status rocsparse_mat_info_data_checksum(const char* data,
+                                                         size_t      size,
+                                                         uint64_t*   checksum)
+{
+    size_t begin = mat_info_align(sizeof(mat_info_header));
+
+    // Sections are 8 byte aligned, thus the data consists of 64 bit words
+    std::vector<uint64_t> words((size - begin) / sizeof(uint64_t));
+
+    if(words.size() > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            words.data(), data + begin, sizeof(uint64_t) * words.size(), hipMemcpyDefault));
+    }
+
+    uint64_t hash = 0x165667b19e3779f9ULL;
+    for(size_t i = 0; i < words.size(); ++i)
+    {
+        hash = mat_info_mix(hash ^ words[i]);
+    }
+
+    *checksum = hash;
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status rocsparse_mat_info_write(const rocsparse_mat_info info,
+                                                 mat_info_header*         header,
+                                                 mat_info_writer&         writer)
+{
+    // Collect the triangular meta data, shared meta data is written only once
+    std::vector<rocsparse_trm_info> trm;
+
+    for(int i = 0; i < MAT_INFO_NTRM; ++i)
+    {
+        rocsparse_trm_info slot = info->*mat_info_trm_slots[i];
+
+        header->trm_slot[i] = -1;
+
+        if(slot == nullptr)
+        {
+            continue;
+        }
+
+        for(size_t j = 0; j < trm.size(); ++j)
+        {
+            if(trm[j] == slot)
+            {
+                header->trm_slot[i] = j;
+                break;
+            }
+        }
+
+        if(header->trm_slot[i] == -1)
+        {
+            header->trm_slot[i] = trm.size();
+            trm.push_back(slot);
+        }
+    }
+
+    header->ntrm      = trm.size();
+    header->has_csrmv = (info->csrmv_info != nullptr && info->csrmv_info->size > 0);
+
+    RETURN_IF_ROCSPARSE_ERROR(writer.write(header, sizeof(mat_info_header)));
+
+    for(size_t i = 0; i < trm.size(); ++i)
+    {
+        rocsparse_trm_info  t = trm[i];
+        mat_info_trm_record record;
+
+        record.m             = t->m;
+        record.nnz           = t->nnz;
+        record.max_nnz       = t->max_nnz;
+        record.nlevels       = t->nlevels;
+        record.has_row_map   = (t->row_map != nullptr);
+        record.has_diag_ind  = (t->trm_diag_ind != nullptr);
+        record.has_transpose = (t->trmt_perm != nullptr);
+        record.has_col_nnz   = (t->trm_col_nnz != nullptr);
+        record.has_level_ptr = (t->level_ptr != nullptr);
+
+        RETURN_IF_ROCSPARSE_ERROR(writer.write(&record, sizeof(mat_info_trm_record)));
+
+        if(record.has_row_map)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(writer.write(t->row_map, sizeof(rocsparse_int) * t->m));
+        }
+
+        if(record.has_diag_ind)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(writer.write(t->trm_diag_ind, sizeof(rocsparse_int) * t->m));
+        }
+
+        if(record.has_level_ptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                writer.write(t->level_ptr, sizeof(rocsparse_int) * (t->nlevels + 1)));
+        }
+
+        if(record.has_transpose)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(writer.write(t->trmt_perm, sizeof(rocsparse_int) * t->nnz));
+            RETURN_IF_ROCSPARSE_ERROR(
+                writer.write(t->trmt_row_ptr, sizeof(rocsparse_int) * (t->m + 1)));
+            RETURN_IF_ROCSPARSE_ERROR(
+                writer.write(t->trmt_col_ind, sizeof(rocsparse_int) * t->nnz));
+        }
+
+        if(record.has_col_nnz)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(writer.write(t->trm_col_nnz, sizeof(int) * t->m));
+        }
+    }
+
+    if(header->has_csrmv)
+    {
+        rocsparse_csrmv_info  c = info->csrmv_info;
+        mat_info_csrmv_record record;
+
+        record.size                 = c->size;
+        record.row_blocks_type_size = c->row_blocks_type_size;
+        record.wg_ids_type_size     = c->wg_ids_type_size;
+        record.m                    = c->m;
+        record.n                    = c->n;
+        record.nnz                  = c->nnz;
+        record.trans                = c->trans;
+        record.reserved             = 0;
+
+        RETURN_IF_ROCSPARSE_ERROR(writer.write(&record, sizeof(mat_info_csrmv_record)));
+        RETURN_IF_ROCSPARSE_ERROR(writer.write(c->row_blocks, c->row_blocks_type_size * c->size));
+        RETURN_IF_ROCSPARSE_ERROR(writer.write(c->wg_flags, sizeof(unsigned int) * c->size));
+        RETURN_IF_ROCSPARSE_ERROR(writer.write(c->wg_ids, c->wg_ids_type_size * c->size));
+    }
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status rocsparse_mat_info_read(mat_info_reader&                 reader,
+                                                const mat_info_header&           header,
+                                                const rocsparse_mat_descr        descr,
+                                                const rocsparse_int*             csr_row_ptr,
+                                                const rocsparse_int*             csr_col_ind,
+                                                std::vector<rocsparse_trm_info>& trm,
+                                                rocsparse_csrmv_info*            csrmv)
+{
+    for(int32_t i = 0; i < header.ntrm; ++i)
+    {
+        mat_info_trm_record record;
+        RETURN_IF_ROCSPARSE_ERROR(reader.read(&record, sizeof(mat_info_trm_record)));
+
+        if(record.m != header.m || record.nnz != header.nnz || record.nlevels < 0
+           || record.nlevels > record.m)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        rocsparse_trm_info t;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&t));
+        trm.push_back(t);
+
+        t->m       = record.m;
+        t->nnz     = record.nnz;
+        t->max_nnz = record.max_nnz;
+        t->nlevels = record.nlevels;
+        t->descr   = descr;
+
+        if(record.has_row_map)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->row_map, t->m));
+        }
+
+        if(record.has_diag_ind)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->trm_diag_ind, t->m));
+        }
+
+        if(record.has_level_ptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->level_ptr, t->nlevels + 1));
+
+            t->level_ptr_host.resize(t->nlevels + 1);
+            RETURN_IF_HIP_ERROR(hipMemcpy(t->level_ptr_host.data(),
+                                          t->level_ptr,
+                                          sizeof(rocsparse_int) * (t->nlevels + 1),
+                                          hipMemcpyDeviceToHost));
+        }
+
+        if(record.has_transpose)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->trmt_perm, t->nnz));
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->trmt_row_ptr, t->m + 1));
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->trmt_col_ind, t->nnz));
+        }
+
+        if(record.has_col_nnz)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(reader.read_device(&t->trm_col_nnz, t->m));
+        }
+
+        t->trm_row_ptr = record.has_transpose ? t->trmt_row_ptr : csr_row_ptr;
+        t->trm_col_ind = record.has_transpose ? t->trmt_col_ind : csr_col_ind;
+    }
+
+    if(header.has_csrmv)
+    {
+        mat_info_csrmv_record record;
+        RETURN_IF_ROCSPARSE_ERROR(reader.read(&record, sizeof(mat_info_csrmv_record)));
+
+        if(record.m != header.m || record.n != header.n || record.nnz != header.nnz
+           || record.size == 0
+           || rocsparse_enum_utils::is_invalid((rocsparse_operation)record.trans))
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(csrmv));
+
+        rocsparse_csrmv_info c = *csrmv;
+
+        // Allocate all row block arrays before reading, such that the info can be
+        // destroyed consistently on failure
+        c->size                 = record.size;
+        c->row_blocks_type_size = record.row_blocks_type_size;
+        c->wg_ids_type_size     = record.wg_ids_type_size;
+
+        RETURN_IF_HIP_ERROR(hipMalloc(&c->row_blocks, c->row_blocks_type_size * c->size));
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&c->wg_flags, sizeof(unsigned int) * c->size));
+        RETURN_IF_HIP_ERROR(hipMalloc(&c->wg_ids, c->wg_ids_type_size * c->size));
+
+        RETURN_IF_ROCSPARSE_ERROR(reader.read(c->row_blocks, c->row_blocks_type_size * c->size));
+        RETURN_IF_ROCSPARSE_ERROR(reader.read(c->wg_flags, sizeof(unsigned int) * c->size));
+        RETURN_IF_ROCSPARSE_ERROR(reader.read(c->wg_ids, c->wg_ids_type_size * c->size));
+
+        c->trans       = (rocsparse_operation)record.trans;
+        c->m           = record.m;
+        c->n           = record.n;
+        c->nnz         = record.nnz;
+        c->descr       = descr;
+        c->csr_row_ptr = csr_row_ptr;
+        c->csr_col_ind = csr_col_ind;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_mat_info_export_size(rocsparse_handle         handle,
+                                                           const rocsparse_mat_info info,
+                                                           size_t*                  size)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_mat_info_export_size", (const void*&)info, (const void*&)size);
+
+    // Check pointer arguments
+    if(size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    mat_info_header header = {};
+    mat_info_writer writer(nullptr);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_write(info, &header, writer));
+
+    *size = writer.size();
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_mat_info_export(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      const rocsparse_mat_info  info,
+                                                      void*                     data)
+{
+    // Check for valid handle, matrix descriptor and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_mat_info_export",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)data);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || (nnz > 0 && csr_col_ind == nullptr) || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    mat_info_header header = {};
+
+    header.magic           = MAT_INFO_MAGIC;
+    header.version         = MAT_INFO_VERSION;
+    header.index_type_size = sizeof(rocsparse_int);
+    header.m               = m;
+    header.n               = n;
+    header.nnz             = nnz;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_checksum(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, &header.checksum));
+
+    if(info->zero_pivot != nullptr)
+    {
+        rocsparse_int zero_pivot;
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            &zero_pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        header.has_zero_pivot = 1;
+        header.zero_pivot     = zero_pivot;
+    }
+
+    // Determine the size, which is part of the header
+    mat_info_writer size_writer(nullptr);
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_write(info, &header, size_writer));
+
+    header.size = size_writer.size();
+
+    mat_info_writer writer(reinterpret_cast<char*>(data));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_write(info, &header, writer));
+
+    // Store the checksum of the meta data in the header
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_data_checksum(
+        reinterpret_cast<const char*>(data), header.size, &header.data_checksum));
+    RETURN_IF_HIP_ERROR(hipMemcpy(data, &header, sizeof(mat_info_header), hipMemcpyDefault));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_mat_info_import(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      const void*               data,
+                                                      size_t                    size)
+{
+    // Check for valid handle, matrix descriptor and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_mat_info_import",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)data,
+              size);
+
+    // Check sizes
+    if(m < 0 || n < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || (nnz > 0 && csr_col_ind == nullptr) || data == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Meta data that is already present is not replaced
+    if(info->csrmv_info != nullptr || info->zero_pivot != nullptr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    for(int i = 0; i < MAT_INFO_NTRM; ++i)
+    {
+        if(info->*mat_info_trm_slots[i] != nullptr)
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    mat_info_reader reader(reinterpret_cast<const char*>(data), size);
+
+    // Verify header
+    mat_info_header header;
+    RETURN_IF_ROCSPARSE_ERROR(reader.read(&header, sizeof(mat_info_header)));
+
+    if(header.magic != MAT_INFO_MAGIC || header.version != MAT_INFO_VERSION
+       || header.index_type_size != sizeof(rocsparse_int) || header.size > size
+       || header.size < mat_info_align(sizeof(mat_info_header)) || header.ntrm < 0
+       || header.ntrm > MAT_INFO_NTRM)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    for(int i = 0; i < MAT_INFO_NTRM; ++i)
+    {
+        if(header.trm_slot[i] < -1 || header.trm_slot[i] >= header.ntrm)
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    if(header.m != m || header.n != n || header.nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Verify meta data
+    uint64_t data_checksum;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_mat_info_data_checksum(
+        reinterpret_cast<const char*>(data), header.size, &data_checksum));
+
+    if(data_checksum != header.data_checksum)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Verify sparsity pattern
+    uint64_t checksum;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_mat_info_checksum(handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, &checksum));
+
+    if(checksum != header.checksum)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Read meta data
+    std::vector<rocsparse_trm_info> trm;
+    rocsparse_csrmv_info            csrmv = nullptr;
+
+    rocsparse_status status
+        = rocsparse_mat_info_read(reader, header, descr, csr_row_ptr, csr_col_ind, trm, &csrmv);
+
+    if(status == rocsparse_status_success && header.has_zero_pivot)
+    {
+        rocsparse_int zero_pivot = header.zero_pivot;
+
+        if(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)) != hipSuccess
+           || hipMemcpy(info->zero_pivot,
+                        &zero_pivot,
+                        sizeof(rocsparse_int),
+                        hipMemcpyHostToDevice)
+                  != hipSuccess)
+        {
+            status = rocsparse_status_internal_error;
+        }
+    }
+
+    // Clean up partially imported meta data
+    if(status != rocsparse_status_success)
+    {
+        for(size_t i = 0; i < trm.size(); ++i)
+        {
+            rocsparse_destroy_trm_info(trm[i]);
+        }
+
+        rocsparse_destroy_csrmv_info(csrmv);
+
+        if(info->zero_pivot != nullptr)
+        {
+            hipFree(info->zero_pivot);
+            info->zero_pivot = nullptr;
+        }
+
+        return status;
+    }
+
+    for(int i = 0; i < MAT_INFO_NTRM; ++i)
+    {
+        info->*mat_info_trm_slots[i]
+            = (header.trm_slot[i] == -1) ? nullptr : trm[header.trm_slot[i]];
+    }
+
+    info->csrmv_info = csrmv;
+
+    return rocsparse_status_success;
+}